@@ -0,0 +1,87 @@
+package com.example.augmentedrealityglasses.translation
+
+import org.json.JSONObject
+
+/**
+ * Change of the transcript of an utterance: the first [numStableBytes] bytes (UTF-8) of the text
+ * already sent are kept and the rest is replaced by [tail]
+ */
+data class TranscriptDelta(
+    val utteranceId: Int,
+    val numStableBytes: Int,
+    val tail: String
+) {
+    fun toJson(): JSONObject {
+        val json = JSONObject()
+        json.put("command", "tp")
+        json.put("u", utteranceId)
+        json.put("s", numStableBytes)
+        json.put("x", tail)
+        return json
+    }
+}
+
+/**
+ * Turns the successive versions of a live transcript into deltas, so that only the part revised by
+ * the speech recognizer (or by the translator) is sent to the external device.
+ *
+ * A delta only makes sense to a device holding the text sent before: one which missed it (e.g.
+ * reconnected, or showing the translation page anew) drops the deltas until the whole text arrives
+ * again. The whole text is sent after [resync] and every [fullTextInterval] deltas.
+ */
+class TranscriptDeltaEncoder(private val fullTextInterval: Int = 10) {
+
+    private var utteranceId = 0
+
+    private var lastSent = ByteArray(0)
+
+    //deltas sent since the whole text
+    private var numDeltas = 0
+
+    /**
+     * The next text is not a revision of the previous one
+     */
+    fun startUtterance() {
+        utteranceId++
+        lastSent = ByteArray(0)
+    }
+
+    /**
+     * The device may have missed the text sent so far: the next delta carries the whole text
+     */
+    fun resync() {
+        lastSent = ByteArray(0)
+    }
+
+    fun encode(text: String): TranscriptDelta {
+        val bytes = text.toByteArray(Charsets.UTF_8)
+
+        val maxNumStableBytes = minOf(bytes.size, lastSent.size)
+        var numStableBytes = 0
+        while (numStableBytes < maxNumStableBytes && bytes[numStableBytes] == lastSent[numStableBytes]) {
+            numStableBytes++
+        }
+        //never split a multi-byte character
+        while (numStableBytes > 0 && numStableBytes < bytes.size &&
+            (bytes[numStableBytes].toInt() and 0xC0) == 0x80
+        ) {
+            numStableBytes--
+        }
+
+        if (numStableBytes == 0 && lastSent.isNotEmpty()) {
+            //nothing in common: a new utterance began
+            startUtterance()
+        }
+        if (numStableBytes > 0 && numDeltas >= fullTextInterval) {
+            numStableBytes = 0
+        }
+        numDeltas = if (numStableBytes == 0) 0 else numDeltas + 1
+        lastSent = bytes
+
+        return TranscriptDelta(
+            utteranceId = utteranceId,
+            numStableBytes = numStableBytes,
+            tail = String(bytes, numStableBytes, bytes.size - numStableBytes, Charsets.UTF_8)
+        )
+    }
+}
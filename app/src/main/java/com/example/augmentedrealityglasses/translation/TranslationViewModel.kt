@@ -42,7 +42,6 @@ import kotlinx.coroutines.flow.asStateFlow
 import kotlinx.coroutines.flow.update
 import kotlinx.coroutines.launch
 import kotlinx.coroutines.tasks.await
-import org.json.JSONObject
 
 class TranslationViewModel(
     private val application: Application,
@@ -79,6 +78,8 @@ class TranslationViewModel(
 
     var errorMessage = MutableStateFlow("")
 
+    private val transcriptDeltaEncoder = TranscriptDeltaEncoder()
+
     private val TAG: String = "TranslationViewModel"
 
     init {
@@ -87,6 +88,10 @@ class TranslationViewModel(
                 bleManager.receiveUpdates()
                     .collect { connectionState ->
                         if (connectionState.connectionState is ConnectionState.Connected) {
+                            if (!isExtDeviceConnected) {
+                                //the device forgot the transcript while disconnected
+                                transcriptDeltaEncoder.resync()
+                            }
                             isExtDeviceConnected = true
                             bluetoothUpdateStatus = BluetoothUpdateStatus.DEVICE_CONNECTED
                         } else {
@@ -126,6 +131,7 @@ class TranslationViewModel(
         if (!_uiState.value.sourceLanguage.isNullOrBlank() && internetConnectionManager.status == ConnectivityStatus.ValidatedInternet) {
             initializeSpeechRecognizer()
             _uiState.update { _uiState.value.copy(isRecording = true, recognizedText = "") }
+            transcriptDeltaEncoder.startUtterance()
             recordJob = viewModelScope.launch {
                 recorder?.startListening(createIntent())
             }
@@ -510,18 +516,12 @@ class TranslationViewModel(
     private fun sendBluetoothMessage(
         msgContent: String
     ) {
+        if (isExtDeviceConnected) {
+            //only the part of the text revised since the last message is sent
+            val msg = transcriptDeltaEncoder.encode(msgContent).toJson().toString()
 
-        //Main json object that is sent through ble connection
-        val jsonToSend = JSONObject()
-
-        jsonToSend.put("command", "t")
-        jsonToSend.put("text", msgContent)
-
-        val msg = jsonToSend.toString()
-
-        Log.d(TAG, "BLE message:\n$msg")
+            Log.d(TAG, "BLE message (${msg.length} bytes, full text ${msgContent.length}):\n$msg")
 
-        if (isExtDeviceConnected) {
             viewModelScope.launch {
                 bleManager.send(msg)
             }
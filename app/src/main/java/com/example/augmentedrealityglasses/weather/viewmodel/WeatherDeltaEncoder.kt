@@ -0,0 +1,139 @@
+package com.example.augmentedrealityglasses.weather.viewmodel
+
+import org.json.JSONArray
+import org.json.JSONObject
+
+/**
+ * Condition of a time slot as shown by the external device. The [time] ("Now" or "HH:mm") identifies
+ * the slot
+ */
+data class DeviceCondition(
+    val time: String,
+    val temperature: Int,
+    val pressure: Int,
+    val iconName: String
+) {
+    fun toJson(): JSONObject {
+        val json = JSONObject()
+        json.put("time", time)
+        json.put("temperature", temperature)
+        json.put("iconName", iconName)
+        json.put("pressure", pressure)
+        return json
+    }
+}
+
+sealed interface WeatherUpdate {
+    fun toJson(): JSONObject
+
+    /**
+     * The whole forecast, replacing the one shown by the device
+     */
+    data class Full(val location: String, val conditions: List<DeviceCondition>) : WeatherUpdate {
+        override fun toJson(): JSONObject {
+            val json = JSONObject()
+            json.put("command", "w")
+            json.put("location", location)
+            json.put("conditions", JSONArray(conditions.map { it.toJson() }))
+            return json
+        }
+    }
+
+    /**
+     * The time slots [removed] are dropped, then the conditions [upserted] replace the ones of their
+     * slot or are appended
+     */
+    data class Delta(val removed: List<String>, val upserted: List<DeviceCondition>) : WeatherUpdate {
+        fun isEmpty() = removed.isEmpty() && upserted.isEmpty()
+
+        override fun toJson(): JSONObject {
+            val json = JSONObject()
+            json.put("command", "wd")
+            if (removed.isNotEmpty()) {
+                json.put("r", JSONArray(removed))
+            }
+            if (upserted.isNotEmpty()) {
+                json.put("u", JSONArray(upserted.map { it.toJson() }))
+            }
+            return json
+        }
+    }
+}
+
+/**
+ * Turns the successive forecasts sent to the external device into deltas by time slot, so that a
+ * refresh sends only the conditions which changed
+ *
+ * A delta only makes sense to a device holding the forecast sent before: one which missed it (e.g.
+ * rebooted) drops the deltas until the whole forecast arrives again. The whole forecast is sent
+ * after [reset] and every [fullUpdateInterval] deltas.
+ */
+class WeatherDeltaEncoder(private val fullUpdateInterval: Int = 10) {
+
+    private var lastLocation: String? = null
+
+    private var lastSent: List<DeviceCondition> = emptyList()
+
+    //deltas sent since the whole forecast
+    private var numDeltas = 0
+
+    /**
+     * The device may not have the last forecast anymore (e.g. it has been disconnected): the next
+     * update is a full one
+     */
+    fun reset() {
+        lastLocation = null
+        lastSent = emptyList()
+    }
+
+    fun encode(location: String, conditions: List<DeviceCondition>): WeatherUpdate {
+        val previous = lastSent
+        val isNewLocation = location != lastLocation
+        lastLocation = location
+        lastSent = conditions
+
+        if (isNewLocation || numDeltas >= fullUpdateInterval || !hasUniqueSlots(previous) ||
+            !hasUniqueSlots(conditions)
+        ) {
+            return full(location, conditions)
+        }
+
+        val times = conditions.mapTo(HashSet()) { it.time }
+        val delta = WeatherUpdate.Delta(
+            removed = previous.map { it.time }.filter { it !in times },
+            upserted = conditions.filter { it !in previous }
+        )
+        //a slot moving around (e.g. the same hour of the next day) cannot be told by a delta
+        if (apply(previous, delta) != conditions) {
+            return full(location, conditions)
+        }
+        numDeltas++
+        return delta
+    }
+
+    private fun full(location: String, conditions: List<DeviceCondition>): WeatherUpdate {
+        numDeltas = 0
+        return WeatherUpdate.Full(location, conditions)
+    }
+
+    private fun hasUniqueSlots(conditions: List<DeviceCondition>) =
+        conditions.distinctBy { it.time }.size == conditions.size
+
+    companion object {
+        /**
+         * Applies [delta] to [conditions] as the device does
+         */
+        fun apply(conditions: List<DeviceCondition>, delta: WeatherUpdate.Delta): List<DeviceCondition> {
+            val result = conditions.filter { it.time !in delta.removed }.toMutableList()
+            for (condition in delta.upserted) {
+                val idx = result.indexOfFirst { it.time == condition.time }
+                if (idx < 0) {
+                    result.add(condition)
+                } else {
+                    result[idx] = condition
+                }
+            }
+            return result
+        }
+    }
+}
@@ -47,8 +47,6 @@ import kotlinx.coroutines.flow.update
 import kotlinx.coroutines.launch
 import kotlinx.coroutines.suspendCancellableCoroutine
 import kotlinx.coroutines.withContext
-import org.json.JSONArray
-import org.json.JSONObject
 import java.text.SimpleDateFormat
 import java.util.Calendar
 import java.util.Date
@@ -87,6 +85,8 @@ class WeatherViewModel(
     // Tracks the Bluetooth connection status with the external device
     private var isExtDeviceConnected by mutableStateOf(false)
 
+    private val weatherDeltaEncoder = WeatherDeltaEncoder()
+
     var bluetoothUpdateStatus by mutableStateOf(BluetoothUpdateStatus.NONE)
         private set
 
@@ -102,6 +102,8 @@ class WeatherViewModel(
                         } else {
                             isExtDeviceConnected = false
                             bluetoothUpdateStatus = BluetoothUpdateStatus.DEVICE_DISCONNECTED
+                            //the device may restart meanwhile: the next forecast is sent in full
+                            weatherDeltaEncoder.reset()
                         }
                     }
             }
@@ -229,7 +231,8 @@ class WeatherViewModel(
     }
 
     /**
-     * This method sends the update message to the external device. The message is created with the current weatherState value (location and conditions are read)
+     * This method sends the update message to the external device. The message is created with the current weatherState value (location and conditions are read).
+     * Once the device has a forecast, only the time slots changed since the last message are sent
      */
     private fun sendBluetoothMessage(
         context: Context
@@ -238,60 +241,50 @@ class WeatherViewModel(
         val location = weatherState.value.location
         val conditions = weatherState.value.conditions
 
-        //Main json object that is sent through ble connection
-        val jsonToSend = JSONObject()
-
-        jsonToSend.put("command", "w")
-        jsonToSend.put("location", location.name) //location name
-
-        //Json array for the list of conditions
-        val jsonArray = JSONArray()
-
         val currCond = weatherState.value.conditions.find { it.isCurrent }
 
         if (currCond != null) {
 
             //Current condition
-            jsonArray.put(
-                conditionToJsonObject(
+            val deviceConditions = mutableListOf(
+                DeviceCondition(
                     time = "Now",
                     temperature = currCond.temp,
-                    wind = currCond.windSpeed,
                     //In order to get the image's name instead of the android identifier of the resource
                     iconName = context.resources.getResourceEntryName(currCond.iconId),
                     pressure = currCond.pressure
                 )
             )
 
+            //Time formatter
+            val timeFmt = SimpleDateFormat("HH:mm", Locale.getDefault())
+
             // Forecasts. The number of forecasts sent via BLE depends on Constants.FORECASTS_TO_SEND_WITH_BLE.
             // To adjust how many are included, just change that constant.
             conditions.filter { !it.isCurrent }.take(Constants.FORECASTS_TO_SEND_WITH_BLE)
                 .forEach { condition ->
-
-                    //In order to get the image's name instead of the android identifier of the resource
-                    val iconName = context.resources.getResourceEntryName(condition.iconId)
-
-                    //Time formatter
-                    val timeFmt = SimpleDateFormat("HH:mm", Locale.getDefault())
-
-                    val jsonCond = conditionToJsonObject(
-                        time = timeFmt.format(condition.dateTime),
-                        temperature = condition.temp,
-                        wind = condition.windSpeed,
-                        iconName = iconName,
-                        pressure = condition.pressure
+                    deviceConditions.add(
+                        DeviceCondition(
+                            time = timeFmt.format(condition.dateTime),
+                            temperature = condition.temp,
+                            //In order to get the image's name instead of the android identifier of the resource
+                            iconName = context.resources.getResourceEntryName(condition.iconId),
+                            pressure = condition.pressure
+                        )
                     )
-
-                    jsonArray.put(jsonCond)
                 }
 
-            jsonToSend.put("conditions", jsonArray)
+            if (isExtDeviceConnected) {
+                val update = weatherDeltaEncoder.encode(location.name, deviceConditions)
+                if (update is WeatherUpdate.Delta && update.isEmpty()) {
+                    Log.d(TAG, "Forecast unchanged, nothing sent")
+                    return
+                }
 
-            val msg = jsonToSend.toString()
+                val msg = update.toJson().toString()
 
-            Log.d(TAG, "BLE message:\n$msg")
+                Log.d(TAG, "BLE message:\n$msg")
 
-            if (isExtDeviceConnected) {
                 viewModelScope.launch {
                     proxy.send(msg)
                 }
@@ -301,24 +294,6 @@ class WeatherViewModel(
         }
     }
 
-    private fun conditionToJsonObject(
-        time: String,
-        temperature: Int,
-        wind: Float,
-        iconName: String,
-        pressure: Int
-    ): JSONObject {
-        val json = JSONObject()
-
-        json.put("time", time)
-        json.put("temperature", temperature)
-        //json.put("wind", wind)
-        json.put("iconName", iconName)
-        json.put("pressure", pressure)
-
-        return json
-    }
-
     private fun getGeolocationPermissions(context: Context): Map<String, Boolean> {
         val hasCoarseLocationPermission = ContextCompat.checkSelfPermission(
             context,
@@ -0,0 +1,115 @@
+package com.example.augmentedrealityglasses.translation
+
+import org.junit.Assert.assertEquals
+import org.junit.Assert.assertNotEquals
+import org.junit.Assert.assertTrue
+import org.junit.Test
+
+class TranscriptDeltaEncoderTest {
+
+    //partial results of a speech recognizer, as they arrive while the user speaks
+    private val partialResults = listOf(
+        "the",
+        "the weather",
+        "the weather today",
+        "the weather today is",
+        "the weather today is nice",
+        "the weather today was nice",
+        "the weather today was nice and",
+        "the weather today was nice and sunny",
+        "the weather today was nice and sunny in Milan",
+        "the weather today was nice and sunny in Milano"
+    )
+
+    private fun apply(text: String, delta: TranscriptDelta): String {
+        val bytes = text.toByteArray(Charsets.UTF_8)
+        return String(bytes, 0, delta.numStableBytes, Charsets.UTF_8) + delta.tail
+    }
+
+    @Test
+    fun `deltas rebuild every partial result`() {
+        val encoder = TranscriptDeltaEncoder()
+        var shown = ""
+        for (partial in partialResults) {
+            shown = apply(shown, encoder.encode(partial))
+            assertEquals(partial, shown)
+        }
+    }
+
+    @Test
+    fun `replayed transcript sends fewer bytes than full updates`() {
+        val encoder = TranscriptDeltaEncoder()
+        var fullBytes = 0
+        var deltaBytes = 0
+        for (partial in partialResults) {
+            fullBytes += partial.toByteArray(Charsets.UTF_8).size
+            deltaBytes += encoder.encode(partial).tail.toByteArray(Charsets.UTF_8).size
+        }
+
+        println("Transcript bytes: full = $fullBytes, delta = $deltaBytes")
+        assertTrue(deltaBytes * 3 < fullBytes)
+    }
+
+    @Test
+    fun `revision keeps the stable prefix only`() {
+        val encoder = TranscriptDeltaEncoder()
+        encoder.encode("the weather today is nice")
+        val delta = encoder.encode("the weather today was nice")
+
+        assertEquals("the weather today ".length, delta.numStableBytes)
+        assertEquals("was nice", delta.tail)
+    }
+
+    @Test
+    fun `stable prefix never splits a multi-byte character`() {
+        val encoder = TranscriptDeltaEncoder()
+        encoder.encode("perché")
+        //'é' and 'è' share the first byte of their UTF-8 encoding
+        val delta = encoder.encode("perchè")
+
+        assertEquals("perch".length, delta.numStableBytes)
+        assertEquals("è", delta.tail)
+    }
+
+    @Test
+    fun `unrelated text starts a new utterance`() {
+        val encoder = TranscriptDeltaEncoder()
+        val first = encoder.encode("hello")
+        val second = encoder.encode("goodbye")
+
+        assertNotEquals(first.utteranceId, second.utteranceId)
+        assertEquals(0, second.numStableBytes)
+        assertEquals("goodbye", second.tail)
+    }
+
+    @Test
+    fun `resync sends the whole text of the same utterance`() {
+        val encoder = TranscriptDeltaEncoder()
+        val first = encoder.encode("the weather")
+        encoder.resync()
+        val delta = encoder.encode("the weather today")
+
+        assertEquals(first.utteranceId, delta.utteranceId)
+        assertEquals(0, delta.numStableBytes)
+        assertEquals("the weather today", delta.tail)
+    }
+
+    @Test
+    fun `device missing the start catches up at the next whole text`() {
+        val encoder = TranscriptDeltaEncoder(fullTextInterval = 3)
+        //as the device: the deltas are dropped until a whole text arrives
+        var shown: String? = null
+        for ((i, partial) in partialResults.withIndex()) {
+            val delta = encoder.encode(partial)
+            if (i == 0) {
+                //lost
+                continue
+            }
+            shown = if (delta.numStableBytes == 0) delta.tail else shown?.let { apply(it, delta) }
+            if (shown != null) {
+                assertEquals(partial, shown)
+            }
+        }
+        assertEquals(partialResults.last(), shown)
+    }
+}
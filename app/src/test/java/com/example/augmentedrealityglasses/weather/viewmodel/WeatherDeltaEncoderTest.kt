@@ -0,0 +1,106 @@
+package com.example.augmentedrealityglasses.weather.viewmodel
+
+import org.junit.Assert.assertEquals
+import org.junit.Assert.assertTrue
+import org.junit.Test
+
+class WeatherDeltaEncoderTest {
+
+    private fun forecast(vararg slots: Pair<String, Int>) =
+        slots.map { (time, temperature) -> DeviceCondition(time, temperature, 1013, "clouds_1") }
+
+    //refreshes of a day: the current temperature changes, then the 3 hour forecasts roll
+    private val refreshes = listOf(
+        forecast("Now" to 15, "12:00" to 16, "15:00" to 18, "18:00" to 17, "21:00" to 14),
+        forecast("Now" to 15, "12:00" to 16, "15:00" to 18, "18:00" to 17, "21:00" to 14),
+        forecast("Now" to 16, "12:00" to 16, "15:00" to 18, "18:00" to 17, "21:00" to 14),
+        forecast("Now" to 16, "12:00" to 16, "15:00" to 19, "18:00" to 17, "21:00" to 14),
+        forecast("Now" to 17, "15:00" to 19, "18:00" to 17, "21:00" to 14, "00:00" to 12),
+        forecast("Now" to 18, "15:00" to 19, "18:00" to 17, "21:00" to 14, "00:00" to 12),
+        forecast("Now" to 18, "18:00" to 17, "21:00" to 13, "00:00" to 12, "03:00" to 11),
+        forecast("Now" to 17, "18:00" to 17, "21:00" to 13, "00:00" to 12, "03:00" to 11)
+    )
+
+    private fun size(update: WeatherUpdate) = when (update) {
+        is WeatherUpdate.Full -> update.conditions.size + 1
+        is WeatherUpdate.Delta -> update.removed.size + update.upserted.size
+    }
+
+    @Test
+    fun `deltas rebuild every refresh`() {
+        val encoder = WeatherDeltaEncoder()
+        var shown = listOf<DeviceCondition>()
+        for (refresh in refreshes) {
+            shown = when (val update = encoder.encode("Milano", refresh)) {
+                is WeatherUpdate.Full -> update.conditions
+                is WeatherUpdate.Delta -> WeatherDeltaEncoder.apply(shown, update)
+            }
+            assertEquals(refresh, shown)
+        }
+    }
+
+    @Test
+    fun `replayed refreshes send fewer conditions than full updates`() {
+        val encoder = WeatherDeltaEncoder()
+        var fullSize = 0
+        var deltaSize = 0
+        for (refresh in refreshes) {
+            fullSize += size(WeatherUpdate.Full("Milano", refresh))
+            deltaSize += size(encoder.encode("Milano", refresh))
+        }
+
+        println("Weather entries: full = $fullSize, delta = $deltaSize")
+        assertTrue(deltaSize * 2 < fullSize)
+    }
+
+    @Test
+    fun `rolling forecast removes the slot passed and appends the new one`() {
+        val encoder = WeatherDeltaEncoder()
+        encoder.encode("Milano", refreshes[5])
+        val delta = encoder.encode("Milano", refreshes[6]) as WeatherUpdate.Delta
+
+        assertEquals(listOf("15:00"), delta.removed)
+        assertEquals(listOf("21:00", "03:00"), delta.upserted.map { it.time })
+    }
+
+    @Test
+    fun `unchanged forecast gives an empty delta`() {
+        val encoder = WeatherDeltaEncoder()
+        encoder.encode("Milano", refreshes[0])
+        val delta = encoder.encode("Milano", refreshes[1])
+
+        assertTrue(delta is WeatherUpdate.Delta && delta.isEmpty())
+    }
+
+    @Test
+    fun `new location or reset sends the whole forecast`() {
+        val encoder = WeatherDeltaEncoder()
+        encoder.encode("Milano", refreshes[0])
+
+        assertTrue(encoder.encode("Roma", refreshes[0]) is WeatherUpdate.Full)
+        encoder.reset()
+        assertTrue(encoder.encode("Roma", refreshes[0]) is WeatherUpdate.Full)
+    }
+
+    @Test
+    fun `slot of the next day moving to the end sends the whole forecast`() {
+        val encoder = WeatherDeltaEncoder()
+        encoder.encode("Milano", forecast("Now" to 15, "03:00" to 10, "06:00" to 11))
+        //"03:00" is now the night of the next day, after "06:00"
+        val update = encoder.encode("Milano", forecast("Now" to 15, "06:00" to 11, "03:00" to 9))
+
+        assertTrue(update is WeatherUpdate.Full)
+    }
+
+    @Test
+    fun `whole forecast is sent every interval for a device which missed one`() {
+        val encoder = WeatherDeltaEncoder(fullUpdateInterval = 3)
+        val updates = (0 until 9).map { encoder.encode("Milano", refreshes[it % 4]) }
+
+        //the device applies the deltas to a forecast it got whole, which a reboot loses
+        assertEquals(
+            listOf(true, false, false, false, true, false, false, false, true),
+            updates.map { it is WeatherUpdate.Full }
+        )
+    }
+}
@@ -0,0 +1,221 @@
+#!/usr/bin/env python3
+"""
+Generates the bitmap fonts used by the firmware (see include/fonts/bitmap_font.h).
+
+For every font and size listed in fonts.json, the glyphs of the configured
+character set are rasterized and written to a header holding a table of glyphs
+sorted by codepoint and their bitmaps at 4 bits per pixel, both kept in flash.
+
+Glyphs are rasterized from the TrueType source when it exists and freetype-py
+is installed. Otherwise they are taken from the VLW font (the format produced
+by the Processing sketch shipped with TFT_eSPI, either as a .vlw file or as
+the C array of a header) and resampled when the size differs from the one of
+the VLW font.
+
+Usage: font_pipeline.py [fonts.json]
+Paths in the configuration are relative to the esp32 project directory.
+"""
+
+import json
+import math
+import os
+import re
+import struct
+import sys
+
+PROJECT_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+
+class Glyph:
+    def __init__(self, codepoint, width, height, x_advance, d_x, d_y, alpha):
+        self.codepoint = codepoint
+        self.width = width
+        self.height = height
+        self.x_advance = x_advance
+        self.d_x = d_x
+        self.d_y = d_y
+        # width * height bytes of alpha, row by row
+        self.alpha = alpha
+
+
+def parse_charset(ranges):
+    charset = set()
+    for r in ranges:
+        beg, _, end = r.partition("-")
+        charset.update(range(int(beg, 16), int(end or beg, 16) + 1))
+    return charset
+
+
+def read_vlw(path):
+    """Returns the size of the VLW font and its glyphs by codepoint"""
+    if path.endswith(".h"):
+        with open(path) as f:
+            src = f.read()
+        body = src[src.index("{") + 1:src.rindex("}")]
+        data = bytes(int(b, 16) for b in re.findall(r"0x([0-9A-Fa-f]{2})", body))
+    else:
+        with open(path, "rb") as f:
+            data = f.read()
+
+    num_glyphs, _, size, _, _, _ = struct.unpack(">6i", data[:24])
+    glyphs = {}
+    offset = 24 + 28 * num_glyphs
+    for i in range(num_glyphs):
+        codepoint, height, width, x_advance, d_y, d_x, _ = struct.unpack(
+            ">7i", data[24 + 28 * i:52 + 28 * i])
+        alpha = data[offset:offset + width * height]
+        offset += width * height
+        glyphs[codepoint] = Glyph(codepoint, width, height, x_advance, d_x,
+                                  d_y, alpha)
+    return size, glyphs
+
+
+def resample(glyph, scale):
+    """Scales a glyph by averaging the source pixels covered by each pixel"""
+    width = max(1, math.ceil(glyph.width * scale)) if glyph.width else 0
+    height = max(1, math.ceil(glyph.height * scale)) if glyph.height else 0
+    alpha = bytearray(width * height)
+    for y in range(height):
+        y0, y1 = y / scale, min((y + 1) / scale, glyph.height)
+        for x in range(width):
+            x0, x1 = x / scale, min((x + 1) / scale, glyph.width)
+            total = 0.0
+            for sy in range(int(y0), math.ceil(y1)):
+                cover_y = min(y1, sy + 1) - max(y0, sy)
+                for sx in range(int(x0), math.ceil(x1)):
+                    cover_x = min(x1, sx + 1) - max(x0, sx)
+                    total += glyph.alpha[sy * glyph.width + sx] * cover_x * cover_y
+            alpha[y * width + x] = min(255, round(total * scale * scale))
+    return Glyph(glyph.codepoint, width, height, round(glyph.x_advance * scale),
+                 round(glyph.d_x * scale), round(glyph.d_y * scale),
+                 bytes(alpha))
+
+
+def rasterize_ttf(path, size, charset):
+    import freetype
+
+    face = freetype.Face(path)
+    face.set_pixel_sizes(0, size)
+    glyphs = {}
+    for codepoint in sorted(charset):
+        if face.get_char_index(codepoint) == 0:
+            continue
+        face.load_char(codepoint, freetype.FT_LOAD_RENDER |
+                       freetype.FT_LOAD_TARGET_NORMAL)
+        slot = face.glyph
+        bitmap = slot.bitmap
+        alpha = bytearray()
+        for y in range(bitmap.rows):
+            row = bitmap.buffer[y * bitmap.pitch:y * bitmap.pitch + bitmap.width]
+            alpha.extend(row)
+        glyphs[codepoint] = Glyph(codepoint, bitmap.width, bitmap.rows,
+                                  (slot.advance.x + 32) >> 6, slot.bitmap_left,
+                                  slot.bitmap_top, bytes(alpha))
+    return glyphs
+
+
+def load_glyphs(font, size, charset):
+    ttf = os.path.join(PROJECT_DIR, font["ttf"]) if "ttf" in font else None
+    if ttf and os.path.exists(ttf):
+        try:
+            return rasterize_ttf(ttf, size, charset), ttf
+        except ImportError:
+            print("font_pipeline: freetype-py not installed, using the VLW font")
+
+    vlw = os.path.join(PROJECT_DIR, font["vlw"])
+    vlw_size, glyphs = read_vlw(vlw)
+    glyphs = {c: g for c, g in glyphs.items() if c in charset}
+    if size != vlw_size:
+        print(f"font_pipeline: resampling {font['vlw']} from {vlw_size} to {size} px")
+        glyphs = {c: resample(g, size / vlw_size) for c, g in glyphs.items()}
+    return glyphs, vlw
+
+
+def pack(alpha):
+    """4 bits per pixel, leftmost pixel in the high nibble"""
+    nibbles = [(a * 15 + 127) // 255 for a in alpha]
+    if len(nibbles) % 2:
+        nibbles.append(0)
+    return bytes((nibbles[i] << 4) | nibbles[i + 1]
+                 for i in range(0, len(nibbles), 2))
+
+
+def generate(font, size, charset, source, glyphs):
+    name = f"{font['name']}{size}"
+    missing = sorted(c for c in charset if c not in glyphs)
+    if missing:
+        print(f"font_pipeline: {name} lacks {len(missing)} characters of the charset")
+    if any(c > 0xFFFF for c in glyphs):
+        sys.exit(f"font_pipeline: {name} has characters out of the BMP")
+
+    # the height of a line is the one of the printable ASCII characters, as
+    # done by TFT_eSPI for smooth fonts
+    ascii_glyphs = [g for c, g in glyphs.items() if 0x20 < c < 0x7F]
+    ascent = max(g.d_y for g in ascii_glyphs)
+    descent = max(g.height - g.d_y for g in ascii_glyphs)
+
+    table = []
+    bitmaps = bytearray()
+    for codepoint in sorted(glyphs):
+        g = glyphs[codepoint]
+        if not any(g.alpha):
+            # blank glyphs, such as the space, may come with a placeholder
+            # pixel placed anywhere
+            g = Glyph(codepoint, 0, 0, g.x_advance, 0, 0, b"")
+        table.append(f"    {{{len(bitmaps)}, 0x{codepoint:04X}, {g.width}, {g.height}, "
+                     f"{g.x_advance}, {g.d_x}, {g.d_y}}},")
+        bitmaps += pack(g.alpha)
+
+    lines = [
+        "#pragma once",
+        "",
+        f"// Generated by fonts/font_pipeline.py from {os.path.relpath(source, PROJECT_DIR)},",
+        "// do not edit",
+        "",
+        '#include "fonts/bitmap_font.h"',
+        "",
+        "namespace fonts {",
+        f"constexpr Glyph {name}Glyphs[] = {{",
+        *table,
+        "};",
+        "",
+        f"constexpr uint8_t {name}Bitmaps[] = {{",
+    ]
+    for i in range(0, len(bitmaps), 12):
+        lines.append("    " + " ".join(f"0x{b:02X}," for b in bitmaps[i:i + 12]))
+    lines += [
+        "};",
+        "",
+        f"constexpr BitmapFont {name} = {{{name}Glyphs, {len(table)}, {name}Bitmaps,",
+        f"                                {ascent + descent}, {ascent}, {round(size / 4)}}};",
+        "}  // namespace fonts",
+        "",
+    ]
+    print(f"font_pipeline: {name}: {len(table)} glyphs, {len(bitmaps)} bytes of bitmaps")
+    return "\n".join(lines)
+
+
+def run(config_path):
+    with open(config_path) as f:
+        config = json.load(f)
+
+    charset = parse_charset(config["charset"])
+    output_dir = os.path.join(PROJECT_DIR, config["output_dir"])
+    os.makedirs(output_dir, exist_ok=True)
+    for font in config["fonts"]:
+        for size in font["sizes"]:
+            glyphs, source = load_glyphs(font, size, charset)
+            header = generate(font, size, charset, source, glyphs)
+            path = os.path.join(output_dir, f"{font['name']}{size}.h")
+            # leave untouched headers alone, not to trigger a rebuild
+            if os.path.exists(path):
+                with open(path) as f:
+                    if f.read() == header:
+                        continue
+            with open(path, "w") as f:
+                f.write(header)
+
+
+if __name__ == "__main__":
+    run(sys.argv[1] if len(sys.argv) > 1 else
+        os.path.join(PROJECT_DIR, "fonts", "fonts.json"))
@@ -0,0 +1,7 @@
+import os
+import sys
+Import("env")
+# regenerate the bitmap fonts before compiling the sources including them
+sys.path.insert(0, os.path.join(env["PROJECT_DIR"], "fonts"))
+import font_pipeline
+font_pipeline.run(os.path.join(env["PROJECT_DIR"], "fonts", "fonts.json"))
@@ -0,0 +1,17 @@
+#pragma once
+
+#include <esp_bt_defs.h>
+#include "ble/remote_events_handler.h"
+
+namespace ble {
+/**
+ * Events of the Bluedroid stack that only the BLE transport cares about
+ */
+class BleEventsHandler : public RemoteEventsHandler {
+public:
+    // called before the state changes to CONNECTED
+    virtual void onPeerConnected(esp_bd_addr_t const address) = 0;
+    // outcome of the last indication or notification sent
+    virtual void onSendStatus(bool isDelivered) = 0;
+};
+}  // namespace ble
@@ -0,0 +1,146 @@
+#pragma once
+
+#include <BLE2902.h>
+#include <BLEDevice.h>
+#include <BLEServer.h>
+#include <BLEUtils.h>
+#include <esp_timer.h>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include "ble/ble_events_handler.h"
+#include "ble/reconnector.h"
+#include "ble/transport.h"
+
+namespace ble {
+/**
+ * Transport over the Nordic UART Service of Bluedroid: the phone writes into
+ * the RX characteristic and the device indicates or notifies the TX one.
+ *
+ * While disconnected the device advertises on its own to get the bonded
+ * phone back, see Reconnector.
+ */
+class BleTransport : public Transport,
+                     public BleEventsHandler,
+                     private Reconnector::Gap {
+public:
+    BleTransport();
+
+    ~BleTransport();
+
+    void begin(RemoteEventsHandler* handler) override;
+
+    void advertise() override;
+
+    void disconnect() override;
+
+    bool transmit(std::string_view packet, bool isIndication) override;
+
+    size_t getMaxPacketSize() override;
+
+    void setLinkProfile(controller::LinkProfile profile) override;
+
+    controller::LinkStats getLinkStats() override;
+
+    // events of the stack, passed on to the handler after being looked at
+
+    void onPeerConnected(esp_bd_addr_t const address) override;
+
+    void onConnectionStateChange(ConnectionState const&) override;
+
+    void onBondingStateChange(BondingState const& ev) override {
+        m_handler->onBondingStateChange(ev);
+    }
+
+    void onCharacteristicChange(std::string_view data) override {
+        m_handler->onCharacteristicChange(data);
+    }
+
+    void onSendStatus(bool isDelivered) override {
+        m_isSendDelivered = isDelivered;
+    }
+
+private:
+    void setupConnectionMonitoring();
+    void setupCharacteristics();
+    void setupBonding();
+    void setupAdvertising();
+    // request the parameters of m_linkProfile to the phone connected
+    void applyLinkProfile();
+    // outcome of the requests, called by the BLE task
+    void onGapEvent(esp_gap_ble_cb_event_t event,
+                    esp_ble_gap_cb_param_t* param);
+
+    // advertising driven by the reconnection
+
+    bool findBondedPeer(Reconnector::Address& address,
+                        uint8_t& addressType) override;
+
+    void advertiseDirected(Reconnector::Address const& address,
+                           uint8_t addressType) override;
+
+    void advertiseUndirected(uint16_t minInterval,
+                             uint16_t maxInterval) override;
+
+    void stopAdvertising() override;
+
+    void startTimer(uint32_t ms) override;
+
+    void stopTimer() override;
+
+private:
+    inline static char const TAG[] = "BleTransport";
+
+    // size of the ATT header preceding the value in a packet, and the
+    // minimum MTU
+    static constexpr size_t attHeaderSize = 3;
+    static constexpr size_t minMTU = 23;
+
+    struct LinkParameters {
+        // in units of 1.25 ms
+        uint16_t m_minInterval;
+        uint16_t m_maxInterval;
+        uint16_t m_latency;
+        // in units of 10 ms, longer than (1 + latency) * max interval * 2
+        uint16_t m_timeout;
+        // whether to ask for the longest packets and the 2M PHY
+        bool m_isFast;
+    };
+
+    // 7.5-15 ms, the shortest Android accepts
+    static constexpr LinkParameters interactiveParameters{6, 12, 0, 200, true};
+    // 100-200 ms, and the device answers at least once a second
+    static constexpr LinkParameters idleParameters{80, 160, 4, 600, false};
+    // bytes of payload of a packet with the data length extension
+    static constexpr uint16_t maxDataLength = 251;
+
+private:
+    RemoteEventsHandler* m_handler;
+
+    std::unique_ptr<BLEServer> m_server;
+    std::unique_ptr<BLECharacteristic> m_rxCharacteristic;
+    std::unique_ptr<BLECharacteristic> m_txCharacteristic;
+    // read by the phone for the latencies of the messages, and of the
+    // touches
+    std::unique_ptr<BLECharacteristic> m_diagnosticsCharacteristic;
+    std::unique_ptr<BLECharacteristic> m_touchDiagnosticsCharacteristic;
+    // descriptor telling whether the phone subscribed to indications or
+    // notifications, owned by the characteristic
+    BLE2902* m_txSubscription;
+    // set by the callback of the last packet sent
+    std::atomic<bool> m_isSendDelivered;
+
+    // profile asked by the controller, and the state of the link it
+    // negotiated with the phone connected
+    std::atomic<controller::LinkProfile> m_linkProfile;
+    std::mutex m_linkMutex;
+    esp_bd_addr_t m_peerAddress;
+    controller::LinkStats m_linkStats;
+
+    std::atomic<bool> m_isConnected;
+    Reconnector m_reconnector;
+    // ends the windows of the reconnection
+    esp_timer_handle_t m_reconnectionTimer;
+};
+}  // namespace ble
@@ -1,25 +1,31 @@
 #pragma once
 
 #include <BLEServer.h>
-#include "ble/remote_events_handler.h"
+#include "ble/ble_events_handler.h"
 
 namespace ble {
 class CharacteristicCallback : public BLECharacteristicCallbacks {
 public:
-    CharacteristicCallback(RemoteEventsHandler* handler) : m_handler(handler) {}
+    CharacteristicCallback(BleEventsHandler* handler) : m_handler(handler) {}
 
     void onWrite(BLECharacteristic* pCharacteristic,
                  esp_ble_gatts_cb_param_t* param) {
-        std::string const& value = pCharacteristic->getValue();
-        ESP_LOGD(TAG, "Characteristic written with value: '%s'\n",
-                 value.c_str());
-        m_handler->onCharacteristicChange(value);
+        // getValue() would copy the value on the heap
+        m_handler->onCharacteristicChange(std::string_view{
+            reinterpret_cast<char const*>(pCharacteristic->getData()),
+            pCharacteristic->getLength()});
+    }
+
+    void onStatus(BLECharacteristic* pCharacteristic,
+                  Status s,
+                  uint32_t code) override {
+        m_handler->onSendStatus(s == SUCCESS_INDICATE || s == SUCCESS_NOTIFY);
     }
 
 private:
     inline static char const TAG[] = "CharacteristicCallabck";
 
 private:
-    RemoteEventsHandler* m_handler;
+    BleEventsHandler* m_handler;
 };
 }  // namespace ble
\ No newline at end of file
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <BLEServer.h>
+#include <functional>
+#include <string>
+
+namespace ble {
+/**
+ * Answers the reads of a diagnostics characteristic with a table, e.g. the
+ * latencies of the messages (see Tracer::dump()), refreshed at each read
+ */
+class DiagnosticsCallback : public BLECharacteristicCallbacks {
+public:
+    /**
+     * @param dump returning the table, at most 512 bytes
+     */
+    explicit DiagnosticsCallback(std::function<std::string()> dump)
+        : m_dump{std::move(dump)} {}
+
+    void onRead(BLECharacteristic* pCharacteristic,
+                esp_ble_gatts_cb_param_t* param) override {
+        // the stack serves the reads longer than the MTU from this value,
+        // without calling back
+        std::string dump = m_dump();
+        pCharacteristic->setValue(
+            reinterpret_cast<uint8_t*>(const_cast<char*>(dump.data())),
+            dump.size());
+    }
+
+private:
+    inline static char const TAG[] = "DiagnosticsCallback";
+
+private:
+    std::function<std::string()> const m_dump;
+};
+}  // namespace ble
@@ -1,13 +1,15 @@
 #pragma once
 #include <BLEServer.h>
-#include "ble/remote_events_handler.h"
+#include "ble/ble_events_handler.h"
 
 namespace ble {
 class ServerCallaback : public BLEServerCallbacks {
 public:
-    ServerCallaback(RemoteEventsHandler* handler) : m_handler(handler) {}
+    ServerCallaback(BleEventsHandler* handler) : m_handler(handler) {}
 
-    void onConnect(BLEServer* pServer) override {
+    void onConnect(BLEServer* pServer,
+                   esp_ble_gatts_cb_param_t* param) override {
+        m_handler->onPeerConnected(param->connect.remote_bda);
         m_handler->onConnectionStateChange(
             ConnectionState{.phase = ConnectionState::CONNECTED});
     };
@@ -18,6 +20,6 @@ public:
     }
 
 private:
-    RemoteEventsHandler* m_handler;
+    BleEventsHandler* m_handler;
 };
 }  // namespace ble
\ No newline at end of file
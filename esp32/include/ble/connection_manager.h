@@ -1,81 +1,170 @@
 #pragma once
 
-#include <BLE2902.h>
-#include <BLEDevice.h>
-#include <BLEServer.h>
-#include <BLEUtils.h>
-
-#include <Arduino.h>
 #include <esp_log.h>
 
 #include <atomic>
 #include <memory>
+#include <mutex>
+#include <thread>
 #include "ble/remote_events_handler.h"
+#include "ble/rx_ring.h"
+#include "ble/transport.h"
+#include "ble/tx_queue.h"
 #include "controller/remote_controller.h"
-#include "model/model_list.h"
+#include "model/message_log.h"
+#include "model/message_store.h"
+#include "model/weather.h"
+#include "protocol/reassembler.h"
+#include "protocol/wire.h"
+#include "storage/flash.h"
 
 namespace ble {
 /**
- * Class to manage remote events
+ * Class to manage remote events: it speaks the protocol of protocol/ with the
+ * phone over any Transport, and routes what the phone sends
  */
 class ConnectionManager : public controller::RemoteController,
                           public RemoteEventsHandler {
 public:
-    ConnectionManager();
-
-    void send(std::string const& msg) override {
-        ESP_LOGD(TAG, "sending the message '%s'\n", msg.c_str());
-        m_txCharacteristic->setValue(msg);
+    /**
+     * @param transport link with the phone
+     * @param historyFlash where the messages are kept across reboots, null to
+     * keep them in RAM only
+     */
+    ConnectionManager(std::unique_ptr<Transport> transport,
+                      std::unique_ptr<storage::Flash> historyFlash);
+
+    ~ConnectionManager();
+
+    bool send(std::string const& msg) override {
+        ESP_LOGD(TAG, "queueing a message of %u bytes\n", msg.size());
+        return m_txQueue->push(msg);
     }
 
     void advertise() override;
 
     void disconnect() override;
 
+    void setLinkProfile(controller::LinkProfile profile) override;
+
+    controller::LinkStats getLinkStats() override;
+
     bool isConnected() override {
         ESP_LOGD(TAG, "Checking connection");
         ConnectionState currentState = m_connectionState.load();
         return currentState.phase == ConnectionState::CONNECTED;
     }
 
-    std::vector<std::string> getMessages() override {
-        std::vector<std::string>&& messages = m_messageDb->drop(0);
+    size_t readMessagesSince(
+        uint32_t seq,
+        size_t maxNumMessages,
+        std::function<void(model::MessageView const&)> const& f) override;
 
-        // messages are stored from the latest to the recent, invert the order
-        size_t numMessages = messages.size();
-        for (size_t i = 0; i < numMessages / 2; i++) {
-            std::swap(messages[i], messages[numMessages - 1 - i]);
-        }
-        return messages;
-    }
+    bool readMessage(
+        uint32_t seq,
+        std::function<void(model::MessageView const&)> const& f) override;
+
+    void readWeather(
+        std::function<void(model::Weather const&)> const& f) override;
 
     void onConnectionStateChange(ConnectionState const&) override;
 
     void onBondingStateChange(BondingState const&) override;
 
-    void onCharacteristicChange(std::string const&) override;
+    /**
+     * Only copies @p{data} for the RX task, so that the transport, e.g. the
+     * BLE stack, is not held up by the decoding
+     */
+    void onCharacteristicChange(std::string_view data) override;
 
 private:
-    void setupConnectionMonitoring();
-    void setupCharacteristics();
-    void setupBonding();
+    void restoreHistory(std::unique_ptr<storage::Flash> flash);
+    // decode the writes of the phone out of the task of the transport
+    void runRx();
+    // @p{receivedTime} is when the transport received the write, see Tracer
+    void processWrite(std::string_view data, uint32_t receivedTime);
+    // decode and route a message, which may come from a batch
+    void handleMessage(std::string_view data, uint32_t receivedTime);
 
 private:
     inline static char const TAG[] = "ConnectionManager";
 
-private:
-    std::unique_ptr<BLEServer> m_server;
-    std::unique_ptr<BLECharacteristic> m_rxCharacteristic;
-    std::unique_ptr<BLECharacteristic> m_txCharacteristic;
-    std::unique_ptr<model::ModelList<std::string>> m_messageDb;
+    // bounds of the memory taken by the messages stored, whatever the number
+    // of notifications arriving
+    static constexpr size_t maxNumMessages = 32;
+    static constexpr size_t messagesArenaSize = 4096;
+
+    // messages reassembled at the same time from their fragments, and time in
+    // milliseconds after which the ones incomplete are discarded
+    static constexpr size_t numReassemblyBuffers = 4;
+    static constexpr uint32_t reassemblyTimeout = 2000;
+
+    // the fewest bytes of a message a fragment carries, in the payload of a
+    // packet of 251 bytes, and the writes of a message of maxFrameSize bytes
+    static constexpr size_t minFragmentPayloadSize =
+        244 - protocol::fragmentHeaderSize;
+    static constexpr size_t maxNumFragmentWrites =
+        (protocol::maxFrameSize + minFragmentPayloadSize - 1) /
+        minFragmentPayloadSize;
+
+    // bytes of the writes waiting to be decoded, the fragments of a message
+    // in each buffer of the reassembly, the largest write the phone can make,
+    // and the stack of the task decoding them, which transcodes JSON and
+    // appends to the history
+    static constexpr size_t rxRingCapacity =
+        numReassemblyBuffers *
+        (protocol::maxFrameSize +
+         maxNumFragmentWrites *
+             (protocol::fragmentHeaderSize + RxRing::headerSize));
+    // bytes of the urgent writes waiting, a few calls
+    static constexpr size_t urgentRxRingCapacity = 256;
+    static constexpr size_t maxWriteSize = 512;
+    static constexpr size_t rxTaskStackSize = 6144;
+    // microseconds the transport may spend in onCharacteristicChange
+    static constexpr uint32_t callbackTimeBudget = 200;
+
+    // bytes of the messages waiting to be sent to the phone
+    static constexpr size_t txQueueCapacity = 4096;
 
-    // messages arrive scattered, thus we need to store them waiting for the
-    // terminal character before performing any action
-    std::string buffer;
+private:
+    std::unique_ptr<Transport> m_transport;
+    // after the transport, which it sends through
+    std::unique_ptr<TxQueue> m_txQueue;
+    // messages are appended by the RX task and read by the main one
+    std::mutex m_messagesMutex;
+    model::MessageStore m_messageDb;
+    // the messages stored survive reboots, null if no flash is available
+    std::unique_ptr<model::MessageLog> m_history;
+    // forecast updated by the RX task and read by the weather page, which
+    // may be built after the updates arrived
+    std::mutex m_weatherMutex;
+    model::Weather m_weather;
+
+    // writes of the phone, pushed by the transport and popped by the RX task
+    RxRing m_rxRing;
+    // the write being decoded, and the time spent by the transport copying
+    // the writes: the longest and the number over budget
+    char m_rxBuffer[maxWriteSize];
+    std::atomic<uint32_t> m_maxCallbackTime;
+    std::atomic<uint32_t> m_numSlowCallbacks;
+
+    // messages longer than a write arrive in fragments, reassembled here
+    protocol::Reassembler m_reassembler;
+    // frame transcoded from the JSON messages or decompressed, written by
+    // the RX task only
+    char m_frameBuffer[protocol::maxFrameSize];
+    // the phone may compress the bodies of the frames in this connection
+    std::atomic<bool> m_isCompressionNegotiated;
+
+    // bytes sent and time in microseconds at the last call of getLinkStats
+    uint32_t m_lastNumBytesSent;
+    int64_t m_lastStatsTime;
 
-    std::atomic<bool> m_isAdvertising;
     std::atomic<ConnectionState> m_connectionState;
     std::atomic<BondingState> m_bondingState;
+
+    // started last, once the state it works on is set up
+    std::thread m_rxTask;
 };
 
 }  // namespace ble
\ No newline at end of file
@@ -14,4 +14,14 @@ std::string const characteristic_uuid_rx =
 // updates to the App: esp32 -> App
 std::string const characteristic_uuid_tx =
     "6e400003-b5a3-f393-e0a9-e50e24dcca9e";
+
+// UUID of the characteristic readable by the client to diagnose the device,
+// e.g. the latencies of the messages: esp32 -> App
+std::string const characteristic_uuid_diagnostics =
+    "6e400004-b5a3-f393-e0a9-e50e24dcca9e";
+
+// UUID of the characteristic readable by the client for the latencies from
+// the touches to the screen: esp32 -> App
+std::string const characteristic_uuid_touch_diagnostics =
+    "6e400005-b5a3-f393-e0a9-e50e24dcca9e";
 }
\ No newline at end of file
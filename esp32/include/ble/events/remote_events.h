@@ -2,6 +2,7 @@
 
 #include <string>
 #include "view/page/type.h"
+#include "view/ui_event.h"
 
 namespace ble {
 
@@ -13,11 +14,14 @@ struct BondingState {
 
 struct ConnectionState {
     inline static char const name[] = "connection_state";
+    inline static constexpr view::UIEventPriority priority =
+        view::UIEventPriority::URGENT;
     enum { CONNECTED, DISCONNECTED } phase;
 };
 
 struct UpdateMessage {
     inline static char const name[] = "message_from_remote";
+    // frame of the wire protocol, see protocol/wire.h
     std::string const msg;
 };
 
@@ -27,5 +31,8 @@ struct MessageNotification {
 
 struct CallNotification {
     inline static char const name[] = "call_notification";
+    // drawn before any other event waiting
+    inline static constexpr view::UIEventPriority priority =
+        view::UIEventPriority::URGENT;
 };
 }
\ No newline at end of file
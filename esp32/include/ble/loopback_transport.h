@@ -0,0 +1,71 @@
+#pragma once
+
+#include <functional>
+#include <mutex>
+#include <string_view>
+#include "ble/transport.h"
+
+namespace ble {
+/**
+ * Transport within the process, without a radio: a phone simulated by the
+ * caller writes through write() and receives the packets of the device
+ * through the function given to the constructor. It lets the protocol, the
+ * routing and the message store run and be measured on the host.
+ */
+class LoopbackTransport : public Transport {
+public:
+    /**
+     * Receives a packet sent by the device, called by its TX task
+     */
+    using Phone = std::function<void(std::string_view packet)>;
+
+    /**
+     * @param phone receiving the packets of the device
+     * @param maxPacketSize size of the largest packet, as with an MTU
+     */
+    LoopbackTransport(Phone phone, size_t maxPacketSize);
+
+    void begin(RemoteEventsHandler* handler) override;
+
+    void advertise() override;
+
+    void disconnect() override;
+
+    bool transmit(std::string_view packet, bool isIndication) override;
+
+    size_t getMaxPacketSize() override { return m_maxPacketSize; }
+
+    void setLinkProfile(controller::LinkProfile profile) override;
+
+    controller::LinkStats getLinkStats() override;
+
+    // side of the phone
+
+    /**
+     * Connects the phone, as if it had answered the advertising
+     */
+    void connect();
+
+    /**
+     * Writes @p{data} as the phone would, on the task of the caller
+     * @return false if the phone is not connected
+     */
+    bool write(std::string_view data);
+
+private:
+    void setConnected(bool isConnected);
+
+private:
+    inline static char const TAG[] = "LoopbackTransport";
+
+private:
+    Phone const m_phone;
+    size_t const m_maxPacketSize;
+    RemoteEventsHandler* m_handler;
+
+    // connection state and link profile, from the device and the phone
+    std::mutex m_mutex;
+    bool m_isConnected;
+    controller::LinkProfile m_linkProfile;
+};
+}  // namespace ble
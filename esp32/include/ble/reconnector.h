@@ -0,0 +1,130 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <mutex>
+
+namespace ble {
+/**
+ * Advertising of the device while it is disconnected, bringing the bonded
+ * phone back within a second when it is around without draining the battery
+ * when it is gone:
+ *
+ *   DIRECTED  high duty cycle, directed to the bonded phone, for 1.28 s
+ *   FAST      undirected every 20-30 ms, for 30 s
+ *   SLOW      undirected every 1-1.3 s, until a phone connects
+ *
+ * A disconnection starts from DIRECTED, or stays IDLE when no phone is
+ * bonded. Advertising for any phone, e.g. to pair a new one, starts from
+ * FAST once the phone connected, if any, has disconnected.
+ *
+ * The state machine only decides: the calls to the GAP and the timer go
+ * through Gap, thus it can be driven on the host too.
+ */
+class Reconnector {
+public:
+    enum class Phase { IDLE, DIRECTED, FAST, SLOW, CONNECTED };
+
+    // bluetooth address, as esp_bd_addr_t
+    using Address = std::array<uint8_t, 6>;
+
+    class Gap {
+    public:
+        virtual ~Gap() = default;
+
+        /**
+         * Looks up the bonding info stored for the phone to reconnect to
+         * @return false if no phone is bonded
+         */
+        virtual bool findBondedPeer(Address& address, uint8_t& addressType) = 0;
+
+        virtual void advertiseDirected(Address const& address,
+                                       uint8_t addressType) = 0;
+
+        /**
+         * @param minInterval, maxInterval in units of 0.625 ms
+         */
+        virtual void advertiseUndirected(uint16_t minInterval,
+                                         uint16_t maxInterval) = 0;
+
+        virtual void stopAdvertising() = 0;
+
+        /**
+         * Calls Reconnector::onTimeout() in @p{ms} milliseconds, replacing
+         * the timer started before
+         */
+        virtual void startTimer(uint32_t ms) = 0;
+
+        virtual void stopTimer() = 0;
+    };
+
+    struct Stats {
+        uint32_t m_numReconnections{0};
+        // milliseconds from the disconnection to the connection, of the last
+        // reconnection and at most
+        uint32_t m_lastTime{0};
+        uint32_t m_maxTime{0};
+        // advertising the last phone connected through
+        Phase m_lastPhase{Phase::IDLE};
+    };
+
+    explicit Reconnector(Gap& gap);
+
+    /**
+     * Starts advertising to the bonded phone, if any. The device starts
+     * disconnected, thus this is called at boot too.
+     * @param now in microseconds
+     */
+    void onDisconnected(int64_t now);
+
+    /**
+     * @param now in microseconds
+     */
+    void onConnected(int64_t now);
+
+    /**
+     * Advertises for any phone to connect, once the phone connected has
+     * disconnected if there is one
+     */
+    void advertiseToAny();
+
+    /**
+     * The window of the current phase has elapsed
+     */
+    void onTimeout();
+
+    Phase getPhase();
+
+    Stats getStats();
+
+    static char const* getPhaseName(Phase phase);
+
+private:
+    // called with m_mutex held
+    void enter(Phase phase);
+
+private:
+    inline static char const TAG[] = "Reconnector";
+
+    // the longest high duty cycle directed advertising allowed
+    inline static constexpr uint32_t directedWindow = 1280;
+    inline static constexpr uint32_t fastWindow = 30000;
+    // in units of 0.625 ms: 20-30 ms, then 1022.5-1285 ms
+    inline static constexpr uint16_t fastMinInterval = 32;
+    inline static constexpr uint16_t fastMaxInterval = 48;
+    inline static constexpr uint16_t slowMinInterval = 1636;
+    inline static constexpr uint16_t slowMaxInterval = 2056;
+
+private:
+    Gap& m_gap;
+    std::mutex m_mutex;
+    Phase m_phase;
+    // the next disconnection advertises for any phone
+    bool m_isAnyPhoneWanted;
+    // the advertising follows a disconnection, thus a connection is timed
+    bool m_isReconnecting;
+    // microseconds when the device got disconnected
+    int64_t m_disconnectionTime;
+    Stats m_stats;
+};
+}  // namespace ble
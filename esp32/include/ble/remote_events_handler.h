@@ -1,5 +1,6 @@
 #pragma once
 
+#include <string_view>
 #include "events/remote_events.h"
 
 namespace ble {
@@ -7,6 +8,8 @@ class RemoteEventsHandler {
 public:
     virtual void onConnectionStateChange(ConnectionState const&) = 0;
     virtual void onBondingStateChange(BondingState const&) = 0;
-    virtual void onCharacteristicChange(std::string const&) = 0;
+    // called by the task of the transport with the data written by the phone,
+    // which is valid only during the call
+    virtual void onCharacteristicChange(std::string_view) = 0;
 };
 }  // namespace ble
\ No newline at end of file
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string_view>
+
+namespace ble {
+/**
+ * Ring of the writes received from the phone, handing them from the BLE task
+ * to the one decoding them.
+ *
+ * The memory is allocated once: each write is copied as it is, preceded by
+ * its size and the time it arrived, and a write that does not fit is dropped
+ * rather than waited for, so that the BLE task spends a bounded time in push()
+ * whatever the consumer is doing.
+ *
+ * The urgent writes, e.g. calls, have a ring of their own, emptied first: a
+ * burst of other writes neither delays nor drops them.
+ */
+class RxRing {
+public:
+    struct Stats {
+        uint32_t m_numPushed{0};
+        // writes dropped since the ring was full or they were too long
+        uint32_t m_numDropped{0};
+        // bytes taken, now and at most
+        uint32_t m_used{0};
+        uint32_t m_maxUsed{0};
+    };
+
+    // size (2 bytes) and time (4 bytes) taken with each write, little endian
+    inline static constexpr size_t headerSize = 6;
+
+    /**
+     * @param capacity in bytes of the ring, including headerSize per write
+     * @param urgentCapacity in bytes of the ring of the urgent writes
+     */
+    RxRing(size_t capacity, size_t urgentCapacity);
+
+    /**
+     * Copies @p{data} into the ring, never waiting for room
+     * @param isUrgent true to have @p{data} popped before the other writes
+     * @param time when @p{data} arrived, handed back by pop()
+     * @return false if @p{data} has been dropped
+     */
+    bool push(std::string_view data, bool isUrgent, uint32_t time);
+
+    /**
+     * Moves the oldest urgent write, or else the oldest write, into
+     * @p{buffer}, waiting for one to arrive
+     * @param time set to the time the write arrived, as pushed
+     * @return the size of the write, 0 once stop() is called. A write longer
+     * than @p{capacity} is discarded
+     */
+    size_t pop(char* buffer, size_t capacity, uint32_t& time);
+
+    /**
+     * Wakes up the consumer waiting in pop() for good
+     */
+    void stop();
+
+    Stats getStats();
+
+private:
+    struct Ring {
+        explicit Ring(size_t capacity);
+
+        void write(char const* data, size_t size);
+        void read(char* data, size_t size);
+
+        size_t const m_capacity;
+        std::unique_ptr<char[]> const m_data;
+        size_t m_head;
+        size_t m_tail;
+        // bytes taken
+        size_t m_used;
+    };
+
+private:
+    inline static char const TAG[] = "RxRing";
+
+private:
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    bool m_isStopping;
+    Ring m_urgent;
+    Ring m_normal;
+    Stats m_stats;
+};
+}  // namespace ble
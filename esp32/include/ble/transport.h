@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+#include "ble/remote_events_handler.h"
+#include "controller/remote_controller.h"
+
+namespace ble {
+/**
+ * Link carrying the packets between the device and the phone, under the
+ * protocol of ConnectionManager. Its events, the data written by the phone
+ * included, are delivered to a RemoteEventsHandler.
+ */
+class Transport {
+public:
+    virtual ~Transport() = default;
+
+    /**
+     * Starts the link, delivering its events to @p{handler} from then on
+     */
+    virtual void begin(RemoteEventsHandler* handler) = 0;
+
+    virtual void advertise() = 0;
+
+    virtual void disconnect() = 0;
+
+    /**
+     * Sends @p{packet}, waiting for the link to take it
+     * @param isIndication true to wait for the confirmation of the phone
+     * @return true if the packet has been delivered
+     */
+    virtual bool transmit(std::string_view packet, bool isIndication) = 0;
+
+    /**
+     * Returns the size of the largest packet the link carries now
+     */
+    virtual size_t getMaxPacketSize() = 0;
+
+    virtual void setLinkProfile(controller::LinkProfile profile) = 0;
+
+    /**
+     * Returns the parameters of the link, the goodput excluded since it is
+     * measured above the transport
+     */
+    virtual controller::LinkStats getLinkStats() = 0;
+};
+}  // namespace ble
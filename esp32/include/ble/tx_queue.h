@@ -0,0 +1,113 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+
+namespace ble {
+/**
+ * Queue of the messages to send to the phone, serviced by a task of its own
+ * so that the senders never wait for the link.
+ *
+ * The task packs the messages into packets of at most the size the link
+ * carries: the short ones are coalesced into batches, the long ones split
+ * into fragments (see protocol/batch.h and protocol/reassembler.h), and a
+ * message alone in its packet is sent as it is. While a backlog drains the
+ * packets are notified, and the last one is indicated: waiting for its
+ * confirmation paces the queue on the phone without paying a round trip per
+ * packet.
+ */
+class TxQueue {
+public:
+    struct Stats {
+        uint32_t m_numMessagesQueued{0};
+        // messages refused since the queue was full
+        uint32_t m_numMessagesRejected{0};
+        // messages discarded by clear() or lost with a packet not delivered
+        uint32_t m_numMessagesDropped{0};
+        uint32_t m_numIndications{0};
+        uint32_t m_numNotifications{0};
+        uint32_t m_numPacketsFailed{0};
+        uint32_t m_numBytesSent{0};
+        // microseconds spent sending, to tell the throughput of the link
+        uint64_t m_sendTime{0};
+        // messages waiting, now and at most
+        uint32_t m_depth{0};
+        uint32_t m_maxDepth{0};
+    };
+
+    /**
+     * Sends a packet, blocking until the link takes it
+     * @param isIndication true to wait for the confirmation of the phone
+     * @return true if the packet has been delivered
+     */
+    using Link =
+        std::function<bool(std::string_view packet, bool isIndication)>;
+
+    /**
+     * @param link through which the packets are sent
+     * @param getMaxPacketSize returns the size of the largest packet the link
+     * carries now, which follows the MTU negotiated
+     * @param capacity in bytes of the messages waiting
+     */
+    TxQueue(Link link,
+            std::function<size_t()> getMaxPacketSize,
+            size_t capacity);
+
+    ~TxQueue();
+
+    /**
+     * Queues @p{msg} without waiting for it to be sent
+     * @return false if the queue is full: the caller has to slow down, try
+     * again later or give up the message
+     */
+    bool push(std::string msg);
+
+    /**
+     * Discards the messages waiting, e.g. when the phone disconnects
+     */
+    void clear();
+
+    Stats getStats();
+
+private:
+    struct Packet {
+        std::string m_data;
+        // messages lost if the packet is not delivered
+        uint32_t m_numMessages;
+    };
+
+    // build the next packets out of the messages at the front of the queue,
+    // called with m_mutex held
+    void takePackets(size_t maxPacketSize, std::deque<Packet>& packets);
+    void run();
+
+private:
+    inline static char const TAG[] = "TxQueue";
+
+    // statistics are logged every this number of packets
+    inline static constexpr uint32_t statsPeriod = 64;
+
+private:
+    Link const m_link;
+    std::function<size_t()> const m_getMaxPacketSize;
+    size_t const m_capacity;
+
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    bool m_isStopping;
+    std::deque<std::string> m_messages;
+    // bytes of the messages waiting
+    size_t m_size;
+    // id of the next message split into fragments
+    uint8_t m_idFragmented;
+    Stats m_stats;
+
+    std::thread m_sender;
+};
+}  // namespace ble
@@ -41,20 +41,53 @@ public:
 
     void disconnect() { m_remoteController->disconnect(); }
 
+    LinkStats getLinkStats() { return m_remoteController->getLinkStats(); }
+
     bool isConnected() {
         return m_remoteController && m_remoteController->isConnected();
     }
 
-    std::vector<std::string> getMessages(byte numMessages) {
-        std::vector<std::string> messages = m_remoteController->getMessages();
-        for (auto const& msg : messages) {
-            ESP_LOGD(TAG, "stored messages: '%s'", msg.c_str());
-        }
+    /**
+     * Calls @p{f} on the at most @p{numMessages} latest messages with sequence
+     * number @p{seq} or higher, from the latest one. The messages are views
+     * valid only during the call of @p{f}, and remain stored.
+     * @return the number of messages visited
+     */
+    size_t readMessagesSince(
+        uint32_t seq,
+        byte numMessages,
+        std::function<void(model::MessageView const&)> const& f) {
+        return m_remoteController->readMessagesSince(seq, numMessages, f);
+    }
+
+    /**
+     * Calls @p{f} on the message of sequence number @p{seq}, if still stored.
+     * The message is a view valid only during the call of @p{f}.
+     * @return true if the message has been visited
+     */
+    bool readMessage(uint32_t seq,
+                     std::function<void(model::MessageView const&)> const& f) {
+        return m_remoteController->readMessage(seq, f);
+    }
+
+    /**
+     * Calls @p{f} on the at most @p{numMessages} latest messages, from the
+     * latest one. The messages are views valid only during the call of
+     * @p{f}, and remain stored.
+     * @return the number of messages visited
+     */
+    size_t readLatestMessages(
+        byte numMessages,
+        std::function<void(model::MessageView const&)> const& f) {
+        return m_remoteController->readLatestMessages(numMessages, f);
+    }
 
-        byte numMessagesToextract =
-            std::min((byte)messages.size(), numMessages);
-        return std::vector<std::string>(messages.end() - numMessagesToextract,
-                                        messages.end());
+    /**
+     * Calls @p{f} on the forecast the phone sent last. The forecast is valid
+     * only during the call of @p{f}.
+     */
+    void readWeather(std::function<void(model::Weather const&)> const& f) {
+        m_remoteController->readWeather(f);
     }
 
 private:
@@ -1,16 +1,98 @@
 #pragma once
 
+#include <functional>
 #include <string>
-#include <vector>
+#include "model/message_store.h"
+#include "model/weather.h"
 
 namespace controller {
+/**
+ * Trade-off between latency and power consumption of the link with the phone
+ */
+enum class LinkProfile {
+    // short connection interval and packets as long as possible, for the
+    // streams
+    INTERACTIVE,
+    // long connection interval, some of which the device may skip
+    IDLE
+};
+
+struct LinkStats {
+    LinkProfile m_profile;
+    // parameters in effect, 0 when not connected: the interval in units of
+    // 1.25 ms, the connection events the device may skip, the supervision
+    // timeout in units of 10 ms and the bytes of payload of a packet
+    uint16_t m_interval;
+    uint16_t m_latency;
+    uint16_t m_timeout;
+    uint16_t m_dataLength;
+    bool m_is2MPhy;
+    // bytes per second delivered to the phone since the previous call
+    uint32_t m_goodput;
+    // milliseconds the phone took to come back after the last disconnection,
+    // 0 if it never did
+    uint32_t m_reconnectionTime;
+    // writes of the phone dropped since the boot, the device decoding them
+    // slower than they arrived
+    uint32_t m_numRxDropped;
+};
+
 class RemoteController {
 public:
     virtual bool isConnected() = 0;
-    virtual void send(std::string const&) = 0;
+    /**
+     * Queues a message for the phone, without waiting for it to be sent
+     * @return false if too many messages are waiting: the caller has to slow
+     * down
+     */
+    virtual bool send(std::string const&) = 0;
     virtual void advertise() = 0;
     virtual void disconnect() = 0;
-    virtual std::vector<std::string> getMessages() = 0;
+    /**
+     * Asks the phone for the parameters of @p{profile}, now and at the next
+     * connections
+     */
+    virtual void setLinkProfile(LinkProfile profile) = 0;
+    virtual LinkStats getLinkStats() = 0;
+    /**
+     * Calls @p{f} on the at most @p{maxNumMessages} latest messages stored
+     * with sequence number @p{seq} or higher, from the latest one. Nothing is
+     * copied: the messages are valid only during the call of @p{f}.
+     * @return the number of messages visited
+     */
+    virtual size_t readMessagesSince(
+        uint32_t seq,
+        size_t maxNumMessages,
+        std::function<void(model::MessageView const&)> const& f) = 0;
+
+    /**
+     * Calls @p{f} on the message of sequence number @p{seq}, if still stored.
+     * Nothing is copied: the message is valid only during the call of @p{f}.
+     * @return true if the message has been visited
+     */
+    virtual bool readMessage(
+        uint32_t seq,
+        std::function<void(model::MessageView const&)> const& f) = 0;
+
+    /**
+     * Calls @p{f} on the at most @p{maxNumMessages} latest messages stored,
+     * from the latest one. Nothing is copied: the messages are valid only
+     * during the call of @p{f}.
+     * @return the number of messages visited
+     */
+    size_t readLatestMessages(
+        size_t maxNumMessages,
+        std::function<void(model::MessageView const&)> const& f) {
+        return readMessagesSince(0, maxNumMessages, f);
+    }
+
+    /**
+     * Calls @p{f} on the forecast the phone sent last, kept whatever the
+     * page shown. Nothing is copied: the forecast is valid only during the
+     * call of @p{f}.
+     */
+    virtual void readWeather(
+        std::function<void(model::Weather const&)> const& f) = 0;
 };
 
 }
\ No newline at end of file
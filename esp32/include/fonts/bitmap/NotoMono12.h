@@ -0,0 +1,1686 @@
+#pragma once
+
+// Generated by fonts/font_pipeline.py from include/fonts/NotoMono18pt.h,
+// do not edit
+
+#include "fonts/bitmap_font.h"
+
+namespace fonts {
+constexpr Glyph NotoMono12Glyphs[] = {
+    {0, 0x0020, 0, 0, 7, 0, 0},
+    {0, 0x0021, 2, 9, 7, 3, 9},
+    {9, 0x0022, 5, 3, 7, 1, 9},
+    {17, 0x0023, 8, 9, 7, 0, 9},
+    {53, 0x0024, 6, 10, 7, 1, 9},
+    {83, 0x0025, 8, 9, 7, 0, 9},
+    {119, 0x0026, 7, 9, 7, 1, 9},
+    {151, 0x0027, 2, 3, 7, 3, 9},
+    {154, 0x0028, 4, 11, 7, 2, 9},
+    {176, 0x0029, 4, 11, 7, 2, 9},
+    {198, 0x002A, 6, 6, 7, 1, 9},
+    {216, 0x002B, 6, 6, 7, 1, 7},
+    {234, 0x002C, 2, 3, 7, 3, 1},
+    {237, 0x002D, 4, 2, 7, 2, 4},
+    {241, 0x002E, 2, 2, 7, 3, 1},
+    {243, 0x002F, 5, 9, 7, 1, 9},
+    {266, 0x0030, 6, 9, 7, 1, 9},
+    {293, 0x0031, 4, 9, 7, 1, 9},
+    {311, 0x0032, 6, 9, 7, 1, 9},
+    {338, 0x0033, 6, 9, 7, 1, 9},
+    {365, 0x0034, 7, 9, 7, 1, 9},
+    {397, 0x0035, 6, 9, 7, 1, 9},
+    {424, 0x0036, 6, 9, 7, 1, 9},
+    {451, 0x0037, 6, 9, 7, 1, 9},
+    {478, 0x0038, 6, 9, 7, 1, 9},
+    {505, 0x0039, 6, 9, 7, 1, 9},
+    {532, 0x003A, 2, 7, 7, 3, 7},
+    {539, 0x003B, 2, 8, 7, 2, 7},
+    {547, 0x003C, 6, 6, 7, 1, 7},
+    {565, 0x003D, 6, 4, 7, 1, 6},
+    {577, 0x003E, 6, 6, 7, 1, 7},
+    {595, 0x003F, 6, 9, 7, 1, 9},
+    {622, 0x0040, 8, 10, 7, 0, 9},
+    {662, 0x0041, 8, 9, 7, 0, 9},
+    {698, 0x0042, 6, 9, 7, 1, 9},
+    {725, 0x0043, 6, 9, 7, 1, 9},
+    {752, 0x0044, 6, 9, 7, 1, 9},
+    {779, 0x0045, 6, 9, 7, 1, 9},
+    {806, 0x0046, 6, 9, 7, 1, 9},
+    {833, 0x0047, 6, 9, 7, 1, 9},
+    {860, 0x0048, 6, 9, 7, 1, 9},
+    {887, 0x0049, 6, 9, 7, 1, 9},
+    {914, 0x004A, 6, 9, 7, 1, 9},
+    {941, 0x004B, 7, 9, 7, 1, 9},
+    {973, 0x004C, 6, 9, 7, 1, 9},
+    {1000, 0x004D, 6, 9, 7, 1, 9},
+    {1027, 0x004E, 6, 9, 7, 1, 9},
+    {1054, 0x004F, 6, 9, 7, 1, 9},
+    {1081, 0x0050, 6, 9, 7, 1, 9},
+    {1108, 0x0051, 6, 11, 7, 1, 9},
+    {1141, 0x0052, 8, 9, 7, 1, 9},
+    {1177, 0x0053, 6, 9, 7, 1, 9},
+    {1204, 0x0054, 7, 9, 7, 0, 9},
+    {1236, 0x0055, 6, 9, 7, 1, 9},
+    {1263, 0x0056, 8, 9, 7, 0, 9},
+    {1299, 0x0057, 8, 9, 7, 0, 9},
+    {1335, 0x0058, 8, 9, 7, 0, 9},
+    {1371, 0x0059, 7, 9, 7, 0, 9},
+    {1403, 0x005A, 6, 9, 7, 1, 9},
+    {1430, 0x005B, 3, 11, 7, 3, 9},
+    {1447, 0x005C, 5, 9, 7, 1, 9},
+    {1470, 0x005D, 3, 11, 7, 2, 9},
+    {1487, 0x005E, 6, 6, 7, 1, 9},
+    {1505, 0x005F, 8, 2, 7, 0, -1},
+    {1513, 0x0060, 2, 2, 7, 3, 9},
+    {1515, 0x0061, 6, 7, 7, 1, 7},
+    {1536, 0x0062, 6, 10, 7, 1, 9},
+    {1566, 0x0063, 5, 7, 7, 1, 7},
+    {1584, 0x0064, 6, 10, 7, 1, 9},
+    {1614, 0x0065, 6, 7, 7, 1, 7},
+    {1635, 0x0066, 6, 10, 7, 1, 9},
+    {1665, 0x0067, 8, 10, 7, 0, 7},
+    {1705, 0x0068, 6, 10, 7, 1, 9},
+    {1735, 0x0069, 6, 10, 7, 1, 9},
+    {1765, 0x006A, 4, 12, 7, 1, 9},
+    {1789, 0x006B, 6, 10, 7, 1, 9},
+    {1819, 0x006C, 6, 10, 7, 1, 9},
+    {1849, 0x006D, 6, 7, 7, 1, 7},
+    {1870, 0x006E, 6, 7, 7, 1, 7},
+    {1891, 0x006F, 6, 7, 7, 1, 7},
+    {1912, 0x0070, 6, 10, 7, 1, 7},
+    {1942, 0x0071, 6, 10, 7, 1, 7},
+    {1972, 0x0072, 5, 7, 7, 1, 7},
+    {1990, 0x0073, 5, 7, 7, 1, 7},
+    {2008, 0x0074, 5, 9, 7, 1, 9},
+    {2031, 0x0075, 6, 7, 7, 1, 7},
+    {2052, 0x0076, 6, 7, 7, 1, 7},
+    {2073, 0x0077, 8, 7, 7, 0, 7},
+    {2101, 0x0078, 6, 7, 7, 1, 7},
+    {2122, 0x0079, 6, 10, 7, 1, 7},
+    {2152, 0x007A, 5, 7, 7, 1, 7},
+    {2170, 0x007B, 5, 11, 7, 1, 9},
+    {2198, 0x007C, 2, 12, 7, 3, 9},
+    {2210, 0x007D, 5, 11, 7, 1, 9},
+    {2238, 0x007E, 6, 2, 7, 1, 5},
+    {2244, 0x00A0, 0, 0, 7, 0, 0},
+    {2244, 0x00A1, 2, 9, 7, 3, 7},
+    {2253, 0x00A2, 6, 9, 7, 1, 9},
+    {2280, 0x00A3, 6, 9, 7, 1, 9},
+    {2307, 0x00A4, 6, 6, 7, 1, 7},
+    {2325, 0x00A5, 7, 9, 7, 1, 9},
+    {2357, 0x00A6, 2, 12, 7, 3, 9},
+    {2369, 0x00A7, 6, 10, 7, 1, 9},
+    {2399, 0x00A8, 4, 2, 7, 2, 9},
+    {2403, 0x00A9, 8, 9, 7, 0, 9},
+    {2439, 0x00AA, 4, 4, 7, 1, 9},
+    {2447, 0x00AB, 6, 5, 7, 1, 5},
+    {2462, 0x00AC, 6, 4, 7, 1, 5},
+    {2474, 0x00AD, 4, 2, 7, 2, 4},
+    {2478, 0x00AE, 8, 9, 7, 0, 9},
+    {2514, 0x00AF, 8, 2, 7, 0, 11},
+    {2522, 0x00B0, 5, 5, 7, 1, 9},
+    {2535, 0x00B1, 6, 8, 7, 1, 7},
+    {2559, 0x00B2, 4, 5, 7, 2, 9},
+    {2569, 0x00B3, 4, 5, 7, 2, 9},
+    {2579, 0x00B4, 2, 2, 7, 3, 9},
+    {2581, 0x00B5, 6, 10, 7, 1, 7},
+    {2611, 0x00B6, 6, 11, 7, 1, 9},
+    {2644, 0x00B7, 2, 2, 7, 3, 5},
+    {2646, 0x00B8, 2, 3, 7, 3, 0},
+    {2649, 0x00B9, 3, 5, 7, 2, 9},
+    {2657, 0x00BA, 4, 4, 7, 1, 9},
+    {2665, 0x00BB, 6, 5, 7, 1, 5},
+    {2680, 0x00BC, 8, 9, 7, 0, 9},
+    {2716, 0x00BD, 8, 9, 7, 0, 9},
+    {2752, 0x00BE, 8, 9, 7, 0, 9},
+    {2788, 0x00BF, 6, 9, 7, 1, 7},
+    {2815, 0x00C0, 8, 12, 7, 0, 11},
+    {2863, 0x00C1, 8, 12, 7, 0, 11},
+    {2911, 0x00C2, 8, 12, 7, 0, 11},
+    {2959, 0x00C3, 8, 12, 7, 0, 12},
+    {3007, 0x00C4, 8, 11, 7, 0, 11},
+    {3051, 0x00C5, 8, 11, 7, 0, 11},
+    {3095, 0x00C6, 7, 9, 7, 0, 9},
+    {3127, 0x00C7, 6, 12, 7, 1, 9},
+    {3163, 0x00C8, 6, 12, 7, 1, 11},
+    {3199, 0x00C9, 6, 12, 7, 1, 11},
+    {3235, 0x00CA, 6, 12, 7, 1, 11},
+    {3271, 0x00CB, 6, 11, 7, 1, 11},
+    {3304, 0x00CC, 6, 12, 7, 1, 11},
+    {3340, 0x00CD, 6, 12, 7, 1, 11},
+    {3376, 0x00CE, 6, 12, 7, 1, 11},
+    {3412, 0x00CF, 6, 11, 7, 1, 11},
+    {3445, 0x00D0, 7, 9, 7, 0, 9},
+    {3477, 0x00D1, 6, 12, 7, 1, 12},
+    {3513, 0x00D2, 6, 12, 7, 1, 11},
+    {3549, 0x00D3, 6, 12, 7, 1, 11},
+    {3585, 0x00D4, 6, 12, 7, 1, 11},
+    {3621, 0x00D5, 6, 12, 7, 1, 12},
+    {3657, 0x00D6, 6, 11, 7, 1, 11},
+    {3690, 0x00D7, 6, 6, 7, 1, 7},
+    {3708, 0x00D8, 7, 10, 7, 1, 9},
+    {3743, 0x00D9, 6, 12, 7, 1, 11},
+    {3779, 0x00DA, 6, 12, 7, 1, 11},
+    {3815, 0x00DB, 6, 12, 7, 1, 11},
+    {3851, 0x00DC, 6, 11, 7, 1, 11},
+    {3884, 0x00DD, 7, 12, 7, 0, 11},
+    {3926, 0x00DE, 6, 9, 7, 1, 9},
+    {3953, 0x00DF, 6, 10, 7, 1, 9},
+    {3983, 0x00E0, 6, 10, 7, 1, 9},
+    {4013, 0x00E1, 6, 10, 7, 1, 9},
+    {4043, 0x00E2, 6, 10, 7, 1, 9},
+    {4073, 0x00E3, 6, 10, 7, 1, 10},
+    {4103, 0x00E4, 6, 9, 7, 1, 9},
+    {4130, 0x00E5, 6, 10, 7, 1, 10},
+    {4160, 0x00E6, 8, 7, 7, 0, 7},
+    {4188, 0x00E7, 5, 10, 7, 1, 7},
+    {4213, 0x00E8, 6, 10, 7, 1, 9},
+    {4243, 0x00E9, 6, 10, 7, 1, 9},
+    {4273, 0x00EA, 6, 10, 7, 1, 9},
+    {4303, 0x00EB, 6, 9, 7, 1, 9},
+    {4330, 0x00EC, 6, 10, 7, 1, 9},
+    {4360, 0x00ED, 6, 10, 7, 1, 9},
+    {4390, 0x00EE, 6, 10, 7, 1, 9},
+    {4420, 0x00EF, 6, 9, 7, 1, 9},
+    {4447, 0x00F0, 6, 10, 7, 1, 9},
+    {4477, 0x00F1, 6, 10, 7, 1, 10},
+    {4507, 0x00F2, 6, 10, 7, 1, 9},
+    {4537, 0x00F3, 6, 10, 7, 1, 9},
+    {4567, 0x00F4, 6, 10, 7, 1, 9},
+    {4597, 0x00F5, 6, 10, 7, 1, 10},
+    {4627, 0x00F6, 6, 9, 7, 1, 9},
+    {4654, 0x00F7, 6, 7, 7, 1, 7},
+    {4675, 0x00F8, 6, 8, 7, 1, 7},
+    {4699, 0x00F9, 6, 10, 7, 1, 9},
+    {4729, 0x00FA, 6, 10, 7, 1, 9},
+    {4759, 0x00FB, 6, 10, 7, 1, 9},
+    {4789, 0x00FC, 6, 9, 7, 1, 9},
+    {4816, 0x00FD, 6, 12, 7, 1, 9},
+    {4852, 0x00FE, 6, 12, 7, 1, 9},
+    {4888, 0x00FF, 6, 12, 7, 1, 9},
+    {4924, 0x0100, 8, 11, 7, 0, 11},
+    {4968, 0x0101, 6, 9, 7, 1, 9},
+    {4995, 0x0102, 8, 12, 7, 0, 11},
+    {5043, 0x0103, 6, 10, 7, 1, 9},
+    {5073, 0x0104, 8, 12, 7, 0, 9},
+    {5121, 0x0105, 6, 10, 7, 1, 7},
+    {5151, 0x0106, 6, 12, 7, 1, 11},
+    {5187, 0x0107, 5, 10, 7, 1, 9},
+    {5212, 0x0108, 6, 12, 7, 1, 11},
+    {5248, 0x0109, 5, 10, 7, 1, 9},
+    {5273, 0x010A, 6, 11, 7, 1, 11},
+    {5306, 0x010B, 5, 9, 7, 1, 9},
+    {5329, 0x010C, 6, 12, 7, 1, 11},
+    {5365, 0x010D, 5, 10, 7, 1, 9},
+    {5390, 0x010E, 6, 12, 7, 1, 11},
+    {5426, 0x010F, 8, 10, 7, 0, 9},
+    {5466, 0x0110, 7, 9, 7, 0, 9},
+    {5498, 0x0111, 7, 10, 7, 1, 9},
+    {5533, 0x0112, 6, 11, 7, 1, 11},
+    {5566, 0x0113, 6, 9, 7, 1, 9},
+    {5593, 0x0114, 6, 12, 7, 1, 11},
+    {5629, 0x0115, 6, 10, 7, 1, 9},
+    {5659, 0x0116, 6, 11, 7, 1, 11},
+    {5692, 0x0117, 6, 9, 7, 1, 9},
+    {5719, 0x0118, 6, 12, 7, 1, 9},
+    {5755, 0x0119, 6, 10, 7, 1, 7},
+    {5785, 0x011A, 6, 12, 7, 1, 11},
+    {5821, 0x011B, 6, 10, 7, 1, 9},
+    {5851, 0x011C, 6, 12, 7, 1, 11},
+    {5887, 0x011D, 8, 12, 7, 0, 9},
+    {5935, 0x011E, 6, 12, 7, 1, 11},
+    {5971, 0x011F, 8, 12, 7, 0, 9},
+    {6019, 0x0120, 6, 11, 7, 1, 11},
+    {6052, 0x0121, 8, 12, 7, 0, 9},
+    {6100, 0x0122, 6, 12, 7, 1, 9},
+    {6136, 0x0123, 8, 12, 7, 0, 9},
+    {6184, 0x0124, 6, 12, 7, 1, 11},
+    {6220, 0x0125, 6, 12, 7, 1, 12},
+    {6256, 0x0126, 9, 9, 7, -1, 9},
+    {6297, 0x0127, 7, 10, 7, -1, 9},
+    {6332, 0x0128, 6, 12, 7, 1, 12},
+    {6368, 0x0129, 6, 10, 7, 1, 10},
+    {6398, 0x012A, 6, 11, 7, 1, 11},
+    {6431, 0x012B, 6, 9, 7, 1, 9},
+    {6458, 0x012C, 6, 12, 7, 1, 11},
+    {6494, 0x012D, 6, 10, 7, 1, 9},
+    {6524, 0x012E, 6, 12, 7, 1, 9},
+    {6560, 0x012F, 6, 12, 7, 1, 9},
+    {6596, 0x0130, 6, 11, 7, 1, 11},
+    {6629, 0x0131, 6, 7, 7, 1, 7},
+    {6650, 0x0132, 6, 9, 7, 1, 9},
+    {6677, 0x0133, 6, 12, 7, 1, 9},
+    {6713, 0x0134, 7, 12, 7, 1, 11},
+    {6755, 0x0135, 5, 12, 7, 1, 9},
+    {6785, 0x0136, 7, 12, 7, 1, 9},
+    {6827, 0x0137, 6, 12, 7, 1, 9},
+    {6863, 0x0138, 6, 7, 7, 1, 7},
+    {6884, 0x0139, 6, 12, 7, 1, 11},
+    {6920, 0x013A, 6, 12, 7, 1, 12},
+    {6956, 0x013B, 6, 12, 7, 1, 9},
+    {6992, 0x013C, 6, 12, 7, 1, 9},
+    {7028, 0x013D, 6, 9, 7, 1, 9},
+    {7055, 0x013E, 6, 10, 7, 1, 9},
+    {7085, 0x013F, 6, 9, 7, 1, 9},
+    {7112, 0x0140, 6, 10, 7, 1, 9},
+    {7142, 0x0141, 7, 9, 7, 0, 9},
+    {7174, 0x0142, 6, 10, 7, 1, 9},
+    {7204, 0x0143, 6, 12, 7, 1, 11},
+    {7240, 0x0144, 6, 10, 7, 1, 9},
+    {7270, 0x0145, 6, 12, 7, 1, 9},
+    {7306, 0x0146, 6, 10, 7, 1, 7},
+    {7336, 0x0147, 6, 12, 7, 1, 11},
+    {7372, 0x0148, 6, 10, 7, 1, 9},
+    {7402, 0x0149, 7, 10, 7, 0, 9},
+    {7437, 0x014A, 6, 11, 7, 1, 9},
+    {7470, 0x014B, 6, 10, 7, 1, 7},
+    {7500, 0x014C, 6, 11, 7, 1, 11},
+    {7533, 0x014D, 6, 9, 7, 1, 9},
+    {7560, 0x014E, 6, 12, 7, 1, 11},
+    {7596, 0x014F, 6, 10, 7, 1, 9},
+    {7626, 0x0150, 6, 12, 7, 1, 11},
+    {7662, 0x0151, 6, 10, 7, 1, 9},
+    {7692, 0x0152, 7, 9, 7, 0, 9},
+    {7724, 0x0153, 8, 7, 7, 0, 7},
+    {7752, 0x0154, 8, 12, 7, 1, 11},
+    {7800, 0x0155, 5, 10, 7, 1, 9},
+    {7825, 0x0156, 8, 12, 7, 1, 9},
+    {7873, 0x0157, 5, 10, 7, 1, 7},
+    {7898, 0x0158, 8, 12, 7, 1, 11},
+    {7946, 0x0159, 5, 10, 7, 1, 9},
+    {7971, 0x015A, 6, 12, 7, 1, 11},
+    {8007, 0x015B, 5, 10, 7, 1, 9},
+    {8032, 0x015C, 6, 12, 7, 1, 11},
+    {8068, 0x015D, 5, 10, 7, 1, 9},
+    {8093, 0x015E, 6, 12, 7, 1, 9},
+    {8129, 0x015F, 5, 10, 7, 1, 7},
+    {8154, 0x0160, 6, 12, 7, 1, 11},
+    {8190, 0x0161, 5, 10, 7, 1, 9},
+    {8215, 0x0162, 7, 12, 7, 0, 9},
+    {8257, 0x0163, 5, 12, 7, 1, 9},
+    {8287, 0x0164, 7, 12, 7, 0, 11},
+    {8329, 0x0165, 6, 10, 7, 1, 9},
+    {8359, 0x0166, 7, 9, 7, 0, 9},
+    {8391, 0x0167, 5, 9, 7, 1, 9},
+    {8414, 0x0168, 6, 12, 7, 1, 12},
+    {8450, 0x0169, 6, 10, 7, 1, 10},
+    {8480, 0x016A, 6, 11, 7, 1, 11},
+    {8513, 0x016B, 6, 9, 7, 1, 9},
+    {8540, 0x016C, 6, 12, 7, 1, 11},
+    {8576, 0x016D, 6, 10, 7, 1, 9},
+    {8606, 0x016E, 6, 12, 7, 1, 12},
+    {8642, 0x016F, 6, 10, 7, 1, 10},
+    {8672, 0x0170, 6, 12, 7, 1, 11},
+    {8708, 0x0171, 6, 10, 7, 1, 9},
+    {8738, 0x0172, 6, 12, 7, 1, 9},
+    {8774, 0x0173, 6, 10, 7, 1, 7},
+    {8804, 0x0174, 8, 12, 7, 0, 11},
+    {8852, 0x0175, 8, 10, 7, 0, 9},
+    {8892, 0x0176, 7, 12, 7, 0, 11},
+    {8934, 0x0177, 6, 12, 7, 1, 9},
+    {8970, 0x0178, 7, 11, 7, 0, 11},
+    {9009, 0x0179, 6, 12, 7, 1, 11},
+    {9045, 0x017A, 5, 10, 7, 1, 9},
+    {9070, 0x017B, 6, 11, 7, 1, 11},
+    {9103, 0x017C, 5, 9, 7, 1, 9},
+    {9126, 0x017D, 6, 12, 7, 1, 11},
+    {9162, 0x017E, 5, 10, 7, 1, 9},
+    {9187, 0x017F, 4, 10, 7, 2, 9},
+    {9207, 0x0218, 6, 12, 7, 1, 9},
+    {9243, 0x0219, 5, 10, 7, 1, 7},
+    {9268, 0x021A, 7, 12, 7, 0, 9},
+    {9310, 0x021B, 5, 12, 7, 1, 9},
+    {9340, 0x0384, 2, 2, 7, 3, 9},
+    {9342, 0x0385, 4, 3, 7, 1, 11},
+    {9348, 0x0386, 8, 9, 7, 0, 9},
+    {9384, 0x0387, 2, 2, 7, 3, 5},
+    {9386, 0x0388, 7, 9, 7, 0, 9},
+    {9418, 0x0389, 8, 9, 7, -1, 9},
+    {9454, 0x038A, 7, 9, 7, -1, 9},
+    {9486, 0x038C, 8, 9, 7, -1, 9},
+    {9522, 0x038E, 8, 9, 7, -1, 9},
+    {9558, 0x038F, 8, 9, 7, -1, 9},
+    {9594, 0x0390, 5, 11, 7, 1, 11},
+    {9622, 0x0391, 8, 9, 7, 0, 9},
+    {9658, 0x0392, 6, 9, 7, 1, 9},
+    {9685, 0x0393, 6, 9, 7, 1, 9},
+    {9712, 0x0394, 6, 9, 7, 1, 9},
+    {9739, 0x0395, 6, 9, 7, 1, 9},
+    {9766, 0x0396, 6, 9, 7, 1, 9},
+    {9793, 0x0397, 6, 9, 7, 1, 9},
+    {9820, 0x0398, 6, 9, 7, 1, 9},
+    {9847, 0x0399, 6, 9, 7, 1, 9},
+    {9874, 0x039A, 7, 9, 7, 1, 9},
+    {9906, 0x039B, 8, 9, 7, 0, 9},
+    {9942, 0x039C, 6, 9, 7, 1, 9},
+    {9969, 0x039D, 6, 9, 7, 1, 9},
+    {9996, 0x039E, 6, 9, 7, 1, 9},
+    {10023, 0x039F, 6, 9, 7, 1, 9},
+    {10050, 0x03A0, 6, 9, 7, 1, 9},
+    {10077, 0x03A1, 6, 9, 7, 1, 9},
+    {10104, 0x03A3, 6, 9, 7, 1, 9},
+    {10131, 0x03A4, 7, 9, 7, 0, 9},
+    {10163, 0x03A5, 7, 9, 7, 0, 9},
+    {10195, 0x03A6, 7, 9, 7, 0, 9},
+    {10227, 0x03A7, 8, 9, 7, 0, 9},
+    {10263, 0x03A8, 7, 9, 7, 0, 9},
+    {10295, 0x03A9, 8, 9, 7, 0, 9},
+    {10331, 0x03AA, 6, 11, 7, 1, 11},
+    {10364, 0x03AB, 7, 11, 7, 0, 11},
+    {10403, 0x03AC, 7, 10, 7, 1, 9},
+    {10438, 0x03AD, 5, 10, 7, 1, 9},
+    {10463, 0x03AE, 6, 12, 7, 1, 9},
+    {10499, 0x03AF, 4, 10, 7, 3, 9},
+    {10519, 0x03B0, 6, 11, 7, 1, 11},
+    {10552, 0x03B1, 7, 7, 7, 1, 7},
+    {10577, 0x03B2, 6, 12, 7, 1, 9},
+    {10613, 0x03B3, 6, 10, 7, 1, 7},
+    {10643, 0x03B4, 6, 10, 7, 1, 9},
+    {10673, 0x03B5, 5, 7, 7, 1, 7},
+    {10691, 0x03B6, 6, 12, 7, 1, 9},
+    {10727, 0x03B7, 6, 10, 7, 1, 7},
+    {10757, 0x03B8, 6, 9, 7, 1, 9},
+    {10784, 0x03B9, 4, 7, 7, 3, 7},
+    {10798, 0x03BA, 6, 7, 7, 1, 7},
+    {10819, 0x03BB, 7, 10, 7, 1, 9},
+    {10854, 0x03BC, 6, 10, 7, 1, 7},
+    {10884, 0x03BD, 7, 7, 7, 0, 7},
+    {10909, 0x03BE, 5, 12, 7, 1, 9},
+    {10939, 0x03BF, 6, 7, 7, 1, 7},
+    {10960, 0x03C0, 7, 7, 7, 0, 7},
+    {10985, 0x03C1, 6, 10, 7, 1, 7},
+    {11015, 0x03C2, 5, 10, 7, 1, 7},
+    {11040, 0x03C3, 7, 7, 7, 1, 7},
+    {11065, 0x03C4, 6, 7, 7, 1, 7},
+    {11086, 0x03C5, 6, 7, 7, 1, 7},
+    {11107, 0x03C6, 7, 10, 7, 0, 7},
+    {11142, 0x03C7, 7, 10, 7, 0, 7},
+    {11177, 0x03C8, 7, 12, 7, 0, 9},
+    {11219, 0x03C9, 7, 7, 7, 0, 7},
+    {11244, 0x03CA, 4, 9, 7, 2, 9},
+    {11262, 0x03CB, 6, 9, 7, 1, 9},
+    {11289, 0x03CC, 6, 10, 7, 1, 9},
+    {11319, 0x03CD, 6, 10, 7, 1, 9},
+    {11349, 0x03CE, 7, 10, 7, 0, 9},
+    {11384, 0x0400, 6, 12, 7, 1, 11},
+    {11420, 0x0401, 6, 11, 7, 1, 11},
+    {11453, 0x0402, 7, 9, 7, 0, 9},
+    {11485, 0x0403, 6, 12, 7, 1, 11},
+    {11521, 0x0404, 6, 9, 7, 1, 9},
+    {11548, 0x0405, 6, 9, 7, 1, 9},
+    {11575, 0x0406, 6, 9, 7, 1, 9},
+    {11602, 0x0407, 6, 11, 7, 1, 11},
+    {11635, 0x0408, 6, 9, 7, 1, 9},
+    {11662, 0x0409, 8, 9, 7, 0, 9},
+    {11698, 0x040A, 7, 9, 7, 1, 9},
+    {11730, 0x040B, 7, 9, 7, 0, 9},
+    {11762, 0x040C, 7, 12, 7, 1, 11},
+    {11804, 0x040D, 6, 12, 7, 1, 11},
+    {11840, 0x040E, 8, 12, 7, 0, 11},
+    {11888, 0x040F, 6, 11, 7, 1, 9},
+    {11921, 0x0410, 8, 9, 7, 0, 9},
+    {11957, 0x0411, 6, 9, 7, 1, 9},
+    {11984, 0x0412, 6, 9, 7, 1, 9},
+    {12011, 0x0413, 6, 9, 7, 1, 9},
+    {12038, 0x0414, 8, 11, 7, 0, 9},
+    {12082, 0x0415, 6, 9, 7, 1, 9},
+    {12109, 0x0416, 8, 9, 7, -1, 9},
+    {12145, 0x0417, 6, 9, 7, 1, 9},
+    {12172, 0x0418, 6, 9, 7, 1, 9},
+    {12199, 0x0419, 6, 12, 7, 1, 11},
+    {12235, 0x041A, 7, 9, 7, 1, 9},
+    {12267, 0x041B, 7, 9, 7, 0, 9},
+    {12299, 0x041C, 6, 9, 7, 1, 9},
+    {12326, 0x041D, 6, 9, 7, 1, 9},
+    {12353, 0x041E, 6, 9, 7, 1, 9},
+    {12380, 0x041F, 6, 9, 7, 1, 9},
+    {12407, 0x0420, 6, 9, 7, 1, 9},
+    {12434, 0x0421, 6, 9, 7, 1, 9},
+    {12461, 0x0422, 7, 9, 7, 0, 9},
+    {12493, 0x0423, 8, 9, 7, 0, 9},
+    {12529, 0x0424, 7, 9, 7, 0, 9},
+    {12561, 0x0425, 8, 9, 7, 0, 9},
+    {12597, 0x0426, 7, 11, 7, 1, 9},
+    {12636, 0x0427, 6, 9, 7, 1, 9},
+    {12663, 0x0428, 7, 9, 7, 0, 9},
+    {12695, 0x0429, 8, 11, 7, 0, 9},
+    {12739, 0x042A, 7, 9, 7, 0, 9},
+    {12771, 0x042B, 6, 9, 7, 1, 9},
+    {12798, 0x042C, 6, 9, 7, 1, 9},
+    {12825, 0x042D, 7, 9, 7, 0, 9},
+    {12857, 0x042E, 6, 9, 7, 1, 9},
+    {12884, 0x042F, 8, 9, 7, -1, 9},
+    {12920, 0x0430, 6, 7, 7, 1, 7},
+    {12941, 0x0431, 6, 10, 7, 1, 9},
+    {12971, 0x0432, 6, 7, 7, 1, 7},
+    {12992, 0x0433, 4, 7, 7, 2, 7},
+    {13006, 0x0434, 7, 9, 7, 0, 7},
+    {13038, 0x0435, 6, 7, 7, 1, 7},
+    {13059, 0x0436, 8, 7, 7, -1, 7},
+    {13087, 0x0437, 5, 7, 7, 1, 7},
+    {13105, 0x0438, 6, 7, 7, 1, 7},
+    {13126, 0x0439, 6, 10, 7, 1, 9},
+    {13156, 0x043A, 6, 7, 7, 1, 7},
+    {13177, 0x043B, 6, 7, 7, 0, 7},
+    {13198, 0x043C, 6, 7, 7, 1, 7},
+    {13219, 0x043D, 6, 7, 7, 1, 7},
+    {13240, 0x043E, 6, 7, 7, 1, 7},
+    {13261, 0x043F, 6, 7, 7, 1, 7},
+    {13282, 0x0440, 6, 10, 7, 1, 7},
+    {13312, 0x0441, 5, 7, 7, 1, 7},
+    {13330, 0x0442, 7, 7, 7, 0, 7},
+    {13355, 0x0443, 6, 10, 7, 1, 7},
+    {13385, 0x0444, 7, 12, 7, 0, 9},
+    {13427, 0x0445, 6, 7, 7, 1, 7},
+    {13448, 0x0446, 6, 9, 7, 1, 7},
+    {13475, 0x0447, 6, 7, 7, 1, 7},
+    {13496, 0x0448, 7, 7, 7, 0, 7},
+    {13521, 0x0449, 8, 9, 7, 0, 7},
+    {13557, 0x044A, 7, 7, 7, 0, 7},
+    {13582, 0x044B, 6, 7, 7, 1, 7},
+    {13603, 0x044C, 6, 7, 7, 1, 7},
+    {13624, 0x044D, 5, 7, 7, 1, 7},
+    {13642, 0x044E, 6, 7, 7, 1, 7},
+    {13663, 0x044F, 6, 7, 7, 0, 7},
+    {13684, 0x0450, 6, 10, 7, 1, 9},
+    {13714, 0x0451, 6, 9, 7, 1, 9},
+    {13741, 0x0452, 7, 12, 7, -1, 9},
+    {13783, 0x0453, 4, 10, 7, 2, 9},
+    {13803, 0x0454, 6, 7, 7, 1, 7},
+    {13824, 0x0455, 5, 7, 7, 1, 7},
+    {13842, 0x0456, 6, 10, 7, 1, 9},
+    {13872, 0x0457, 6, 9, 7, 1, 9},
+    {13899, 0x0458, 4, 12, 7, 1, 9},
+    {13923, 0x0459, 8, 7, 7, 0, 7},
+    {13951, 0x045A, 7, 7, 7, 1, 7},
+    {13976, 0x045B, 7, 10, 7, -1, 9},
+    {14011, 0x045C, 6, 10, 7, 1, 9},
+    {14041, 0x045D, 6, 10, 7, 1, 9},
+    {14071, 0x045E, 6, 12, 7, 1, 9},
+    {14107, 0x045F, 6, 9, 7, 1, 7},
+};
+
+constexpr uint8_t NotoMono12Bitmaps[] = {
+    0xD6, 0xC5, 0xB5, 0xA4, 0x94, 0x83, 0x11, 0xB5, 0x84, 0xE5, 0x5E, 0x0D,
+    0x44, 0xD0, 0x73, 0x27, 0x00, 0x00, 0x94, 0x05, 0x80, 0x00, 0xB2, 0x09,
+    0x40, 0x4C, 0xEC, 0xCE, 0xC4, 0x16, 0x92, 0x4B, 0x21, 0x08, 0x50, 0x49,
+    0x00, 0xAD, 0xBA, 0xBD, 0x70, 0x5C, 0x33, 0xA7, 0x20, 0x3A, 0x00, 0xA4,
+    0x00, 0x36, 0x00, 0x71, 0x00, 0x00, 0x57, 0x00, 0x16, 0xBC, 0x85, 0xB9,
+    0x89, 0x65, 0xD4, 0x57, 0x00, 0x5B, 0xCA, 0x30, 0x02, 0x8C, 0xC6, 0x00,
+    0x57, 0x4D, 0x96, 0x8A, 0xAA, 0x69, 0xBC, 0x51, 0x00, 0x57, 0x00, 0x7A,
+    0x91, 0x4A, 0x00, 0xB2, 0x84, 0x86, 0x00, 0xA2, 0x85, 0xB2, 0x00, 0x7A,
+    0x98, 0x80, 0x00, 0x00, 0x2B, 0x34, 0x30, 0x00, 0x59, 0x87, 0x92, 0x00,
+    0xA4, 0xB1, 0x75, 0x02, 0xA1, 0xA3, 0x94, 0x05, 0x40, 0x39, 0x50, 0x19,
+    0xCC, 0x30, 0x04, 0xC2, 0x89, 0x00, 0x4C, 0x29, 0x70, 0x01, 0xAB, 0xB1,
+    0x00, 0x4B, 0xC7, 0x14, 0x0B, 0x75, 0xC7, 0xB0, 0xD4, 0x05, 0xF8, 0x0B,
+    0xA4, 0x9E, 0xA0, 0x27, 0x96, 0x18, 0x40, 0xE5, 0xD4, 0x73, 0x04, 0xB2,
+    0x2B, 0x40, 0x7A, 0x00, 0xB6, 0x00, 0xD4, 0x00, 0xD4, 0x00, 0xC4, 0x00,
+    0xA6, 0x00, 0x5B, 0x00, 0x1A, 0x50, 0x01, 0x82, 0x88, 0x00, 0x2B, 0x40,
+    0x05, 0xB1, 0x01, 0xD3, 0x00, 0xC4, 0x00, 0xC5, 0x00, 0xD4, 0x02, 0xD3,
+    0x07, 0x90, 0x3C, 0x30, 0x74, 0x00, 0x00, 0x88, 0x00, 0x31, 0x67, 0x13,
+    0x8B, 0xCD, 0xB9, 0x13, 0xCC, 0x41, 0x19, 0x65, 0xA1, 0x03, 0x11, 0x30,
+    0x00, 0x35, 0x00, 0x00, 0x58, 0x00, 0x35, 0x8A, 0x54, 0x58, 0xAC, 0x87,
+    0x00, 0x58, 0x00, 0x00, 0x47, 0x00, 0x6C, 0xA7, 0x82, 0xCC, 0xC4, 0x22,
+    0x21, 0xB4, 0x41, 0x00, 0x09, 0x60, 0x02, 0xC1, 0x00, 0x79, 0x00, 0x0B,
+    0x40, 0x04, 0xA1, 0x00, 0x96, 0x00, 0x3C, 0x00, 0x07, 0x80, 0x00, 0x83,
+    0x00, 0x00, 0x18, 0xCB, 0x81, 0x7A, 0x22, 0xB6, 0xC5, 0x00, 0x5C, 0xD4,
+    0x00, 0x4D, 0xD3, 0x00, 0x3D, 0xD4, 0x00, 0x4D, 0xA6, 0x00, 0x7A, 0x5C,
+    0x55, 0xC5, 0x04, 0x99, 0x40, 0x17, 0xD3, 0x8A, 0xD3, 0x51, 0xD3, 0x00,
+    0xD3, 0x00, 0xD3, 0x00, 0xD3, 0x00, 0xD3, 0x00, 0xD3, 0x00, 0x92, 0x4A,
+    0xCB, 0xA3, 0x56, 0x22, 0x8B, 0x00, 0x00, 0x4D, 0x00, 0x00, 0x7A, 0x00,
+    0x05, 0xB2, 0x00, 0x6B, 0x20, 0x17, 0x92, 0x00, 0x9B, 0x43, 0x33, 0xAA,
+    0xAA, 0xAA, 0x6B, 0xCB, 0xA4, 0x55, 0x22, 0x8C, 0x00, 0x00, 0x4D, 0x00,
+    0x03, 0xA8, 0x08, 0xCC, 0x82, 0x01, 0x23, 0x8A, 0x00, 0x00, 0x4D, 0x95,
+    0x45, 0xB9, 0x69, 0xA9, 0x51, 0x00, 0x03, 0xE5, 0x00, 0x01, 0xAC, 0x50,
+    0x00, 0x88, 0xB5, 0x00, 0x4B, 0x2B, 0x50, 0x2B, 0x20, 0xB5, 0x09, 0x70,
+    0x0B, 0x50, 0xCC, 0xCC, 0xED, 0x72, 0x22, 0x2B, 0x61, 0x00, 0x00, 0x73,
+    0x00, 0xBD, 0xCC, 0xC4, 0xB5, 0x22, 0x21, 0xC3, 0x00, 0x00, 0xDA, 0xA8,
+    0x30, 0x44, 0x46, 0xC8, 0x00, 0x00, 0x5D, 0x00, 0x00, 0x5C, 0x95, 0x45,
+    0xC7, 0x69, 0xA9, 0x30, 0x04, 0xAB, 0xC4, 0x3C, 0x52, 0x21, 0x97, 0x00,
+    0x00, 0xC6, 0x8A, 0x61, 0xEB, 0x43, 0xA9, 0xD4, 0x00, 0x4D, 0xB6, 0x00,
+    0x4C, 0x5C, 0x54, 0xB8, 0x03, 0x99, 0x51, 0xCC, 0xCC, 0xDE, 0x22, 0x22,
+    0x7A, 0x00, 0x00, 0xB4, 0x00, 0x04, 0xB1, 0x00, 0x1B, 0x50, 0x00, 0x4C,
+    0x10, 0x00, 0xA6, 0x00, 0x02, 0xC3, 0x00, 0x05, 0x60, 0x00, 0x4A, 0xBB,
+    0xA4, 0xC7, 0x22, 0x7C, 0xC5, 0x00, 0x6B, 0x5B, 0x79, 0xA4, 0x3A, 0xAB,
+    0x82, 0xB7, 0x01, 0x89, 0xD4, 0x00, 0x4D, 0xAA, 0x44, 0xA9, 0x16, 0x99,
+    0x51, 0x3A, 0xCC, 0x81, 0xA8, 0x23, 0xA7, 0xD3, 0x00, 0x4C, 0xD4, 0x00,
+    0x5E, 0x6B, 0x88, 0xBD, 0x03, 0x54, 0x5C, 0x00, 0x00, 0xA7, 0x13, 0x48,
+    0xB2, 0x3A, 0x96, 0x00, 0xB4, 0x41, 0x00, 0x00, 0x00, 0x83, 0x82, 0x4B,
+    0x14, 0x00, 0x00, 0x00, 0x49, 0x99, 0xB4, 0x00, 0x01, 0x6A, 0x01, 0x7B,
+    0x84, 0x8C, 0x72, 0x00, 0x8C, 0x72, 0x00, 0x01, 0x7B, 0x84, 0x00, 0x01,
+    0x6A, 0xCC, 0xCC, 0xCC, 0x22, 0x22, 0x22, 0x88, 0x88, 0x88, 0x55, 0x55,
+    0x55, 0xA6, 0x10, 0x00, 0x48, 0xB7, 0x10, 0x00, 0x27, 0xC8, 0x00, 0x27,
+    0xC8, 0x48, 0xB7, 0x10, 0xA6, 0x10, 0x00, 0x8B, 0xBB, 0x61, 0x43, 0x23,
+    0xC4, 0x00, 0x01, 0xC4, 0x00, 0x18, 0x91, 0x01, 0xB7, 0x00, 0x06, 0x90,
+    0x00, 0x01, 0x10, 0x00, 0x07, 0x70, 0x00, 0x05, 0x50, 0x00, 0x03, 0x9A,
+    0xA8, 0x10, 0x2A, 0x41, 0x27, 0x80, 0x85, 0x14, 0x52, 0xA3, 0xA3, 0x79,
+    0xA6, 0x84, 0xB1, 0xB2, 0x76, 0x75, 0xB1, 0xB1, 0x95, 0x84, 0xA2, 0x98,
+    0xA9, 0x92, 0x95, 0x24, 0x24, 0x30, 0x3A, 0x31, 0x13, 0x10, 0x04, 0x9A,
+    0xA9, 0x10, 0x00, 0x3D, 0x70, 0x00, 0x00, 0x6C, 0xB1, 0x00, 0x00, 0xC5,
+    0xC4, 0x00, 0x02, 0xC3, 0xA7, 0x00, 0x08, 0xA0, 0x5C, 0x00, 0x1B, 0xDA,
+    0xBF, 0x30, 0x5D, 0x44, 0x4A, 0x90, 0x89, 0x00, 0x04, 0xC2, 0x83, 0x00,
+    0x00, 0x93, 0xFD, 0xCC, 0xB5, 0xD5, 0x22, 0x8D, 0xD3, 0x00, 0x6C, 0xEB,
+    0xAA, 0x94, 0xE6, 0x45, 0xB8, 0xD3, 0x00, 0x5D, 0xD3, 0x00, 0x5D, 0xE6,
+    0x45, 0xC9, 0xAA, 0xAA, 0x51, 0x04, 0xBC, 0xC9, 0x4D, 0x63, 0x34, 0xB8,
+    0x00, 0x00, 0xD4, 0x00, 0x00, 0xE4, 0x00, 0x00, 0xD5, 0x00, 0x00, 0x9A,
+    0x10, 0x00, 0x3C, 0x95, 0x58, 0x01, 0x79, 0x97, 0xFD, 0xCB, 0x40, 0xD5,
+    0x35, 0xD4, 0xD3, 0x00, 0x7B, 0xD3, 0x00, 0x4D, 0xD3, 0x00, 0x4E, 0xD3,
+    0x00, 0x5D, 0xD3, 0x01, 0xB8, 0xE6, 0x6A, 0xB2, 0xAA, 0x96, 0x00, 0xFD,
+    0xCC, 0xC4, 0xD5, 0x22, 0x21, 0xD3, 0x00, 0x00, 0xEB, 0xAA, 0xA3, 0xE7,
+    0x44, 0x41, 0xD3, 0x00, 0x00, 0xD3, 0x00, 0x00, 0xE7, 0x44, 0x41, 0xAA,
+    0xAA, 0xA3, 0xFD, 0xCC, 0xC4, 0xD5, 0x22, 0x21, 0xD3, 0x00, 0x00, 0xEB,
+    0xAA, 0xA3, 0xE7, 0x44, 0x41, 0xD3, 0x00, 0x00, 0xD3, 0x00, 0x00, 0xD3,
+    0x00, 0x00, 0x92, 0x00, 0x00, 0x05, 0xBC, 0xC7, 0x4D, 0x53, 0x33, 0xB7,
+    0x00, 0x00, 0xD4, 0x06, 0xAA, 0xE4, 0x03, 0x7E, 0xD4, 0x00, 0x3D, 0x99,
+    0x00, 0x3D, 0x3C, 0x85, 0x8E, 0x02, 0x8A, 0x85, 0xD3, 0x00, 0x3D, 0xD3,
+    0x00, 0x3D, 0xD3, 0x00, 0x3D, 0xEB, 0xAA, 0xBE, 0xE7, 0x44, 0x7E, 0xD3,
+    0x00, 0x3D, 0xD3, 0x00, 0x3D, 0xD3, 0x00, 0x3D, 0x92, 0x00, 0x29, 0x5C,
+    0xED, 0xA2, 0x12, 0xC6, 0x10, 0x00, 0xB5, 0x00, 0x00, 0xB5, 0x00, 0x00,
+    0xB5, 0x00, 0x00, 0xB5, 0x00, 0x00, 0xB5, 0x00, 0x13, 0xC7, 0x20, 0x5A,
+    0xAA, 0x92, 0x00, 0x00, 0xB5, 0x00, 0x00, 0xB5, 0x00, 0x00, 0xB5, 0x00,
+    0x00, 0xB5, 0x00, 0x00, 0xB5, 0x00, 0x00, 0xB5, 0x00, 0x01, 0xD4, 0x85,
+    0x6A, 0xB2, 0x7A, 0x97, 0x10, 0xD3, 0x01, 0x9A, 0x0D, 0x30, 0x7A, 0x20,
+    0xD3, 0x7A, 0x10, 0x0D, 0x7B, 0x20, 0x00, 0xEB, 0xB4, 0x00, 0x0E, 0x45,
+    0xB0, 0x00, 0xD3, 0x08, 0x91, 0x0D, 0x30, 0x1C, 0x50, 0x92, 0x00, 0x49,
+    0x00, 0xD3, 0x00, 0x00, 0xD3, 0x00, 0x00, 0xD3, 0x00, 0x00, 0xD3, 0x00,
+    0x00, 0xD3, 0x00, 0x00, 0xD3, 0x00, 0x00, 0xD3, 0x00, 0x00, 0xE7, 0x44,
+    0x41, 0xAA, 0xAA, 0xA3, 0xE5, 0x00, 0x5F, 0xE7, 0x00, 0x8E, 0xDA, 0x00,
+    0xAD, 0xEA, 0x11, 0xAE, 0xE7, 0x55, 0x6E, 0xE4, 0x88, 0x4E, 0xE4, 0xA9,
+    0x4E, 0xE4, 0x98, 0x4E, 0x92, 0x44, 0x29, 0xF6, 0x00, 0x3D, 0xEC, 0x00,
+    0x3D, 0xC9, 0x70, 0x3D, 0xC4, 0xB2, 0x3D, 0xD3, 0x68, 0x3D, 0xD3, 0x2B,
+    0x5C, 0xD3, 0x04, 0xCD, 0xD3, 0x00, 0xBF, 0x82, 0x00, 0x3A, 0x18, 0xCC,
+    0x81, 0x7C, 0x33, 0xB6, 0xC6, 0x00, 0x5C, 0xD4, 0x00, 0x4D, 0xE4, 0x00,
+    0x4E, 0xD4, 0x00, 0x4D, 0xA8, 0x00, 0x8A, 0x5D, 0x66, 0xC5, 0x04, 0x99,
+    0x30, 0xFD, 0xCC, 0xA4, 0xD5, 0x23, 0x9C, 0xD3, 0x00, 0x4E, 0xD3, 0x02,
+    0xAB, 0xFD, 0xCB, 0x81, 0xD5, 0x21, 0x00, 0xD3, 0x00, 0x00, 0xD3, 0x00,
+    0x00, 0x92, 0x00, 0x00, 0x18, 0xCC, 0x81, 0x7C, 0x33, 0xB6, 0xC6, 0x00,
+    0x5C, 0xD4, 0x00, 0x4D, 0xE4, 0x00, 0x4D, 0xD4, 0x00, 0x4D, 0xA8, 0x00,
+    0x8A, 0x5D, 0x66, 0xC5, 0x04, 0x9C, 0x91, 0x00, 0x02, 0xC7, 0x00, 0x00,
+    0x35, 0xFD, 0xCC, 0xA3, 0x00, 0xD5, 0x23, 0x9B, 0x00, 0xD3, 0x00, 0x4D,
+    0x00, 0xD3, 0x02, 0xAA, 0x00, 0xFD, 0xDF, 0x71, 0x00, 0xD5, 0x3B, 0x80,
+    0x00, 0xD3, 0x01, 0xC6, 0x00, 0xD3, 0x00, 0x5C, 0x10, 0x92, 0x00, 0x06,
+    0x60, 0x4A, 0xCC, 0xC9, 0xC8, 0x33, 0x44, 0xD5, 0x00, 0x00, 0x8C, 0x61,
+    0x00, 0x03, 0xAC, 0xA3, 0x00, 0x02, 0x9B, 0x00, 0x00, 0x4D, 0x96, 0x45,
+    0xB9, 0x79, 0xA9, 0x51, 0x9C, 0xDF, 0xCC, 0x82, 0x25, 0xD2, 0x21, 0x00,
+    0x3D, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xD0,
+    0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x29, 0x00, 0x00,
+    0xD3, 0x00, 0x3D, 0xD3, 0x00, 0x3D, 0xD3, 0x00, 0x3D, 0xD3, 0x00, 0x3D,
+    0xD3, 0x00, 0x3D, 0xD3, 0x00, 0x3D, 0xD5, 0x00, 0x5C, 0x8C, 0x66, 0xC8,
+    0x15, 0x99, 0x50, 0xC5, 0x00, 0x01, 0xD4, 0x7A, 0x00, 0x05, 0xB1, 0x3C,
+    0x10, 0x1A, 0x60, 0x1B, 0x50, 0x3C, 0x20, 0x05, 0xA1, 0x6A, 0x00, 0x01,
+    0xC3, 0xA6, 0x00, 0x00, 0x97, 0xC2, 0x00, 0x00, 0x5C, 0xA0, 0x00, 0x00,
+    0x28, 0x30, 0x00, 0xC3, 0x00, 0x00, 0xA5, 0xB4, 0x00, 0x00, 0xB4, 0xA4,
+    0x04, 0x10, 0xB3, 0x95, 0x2B, 0x40, 0xC2, 0x77, 0x67, 0xA2, 0xB1, 0x68,
+    0x83, 0xA5, 0xA0, 0x49, 0x91, 0x7A, 0x90, 0x4C, 0x60, 0x4D, 0x70, 0x28,
+    0x10, 0x18, 0x40, 0x98, 0x00, 0x03, 0xB2, 0x2B, 0x30, 0x1B, 0x50, 0x04,
+    0xB2, 0x88, 0x00, 0x00, 0x8B, 0xB2, 0x00, 0x00, 0x4D, 0x80, 0x00, 0x00,
+    0xA7, 0xC3, 0x00, 0x08, 0x80, 0x5B, 0x10, 0x4B, 0x10, 0x1A, 0x70, 0x74,
+    0x00, 0x01, 0x92, 0x7A, 0x00, 0x1B, 0x63, 0xC2, 0x04, 0xC1, 0x07, 0x90,
+    0xA6, 0x00, 0x1C, 0x5C, 0x20, 0x00, 0x7E, 0x60, 0x00, 0x04, 0xE1, 0x00,
+    0x00, 0x3D, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x29, 0x00, 0x00, 0xCC,
+    0xCC, 0xDE, 0x22, 0x22, 0xA9, 0x00, 0x05, 0xB1, 0x00, 0x2C, 0x30, 0x00,
+    0xA7, 0x00, 0x05, 0xA1, 0x00, 0x4C, 0x20, 0x00, 0xBA, 0x44, 0x44, 0xAA,
+    0xAA, 0xAA, 0xFC, 0x8D, 0x51, 0xD3, 0x0D, 0x30, 0xD3, 0x0D, 0x30, 0xD3,
+    0x0D, 0x30, 0xD3, 0x0E, 0x62, 0xAA, 0x70, 0xB5, 0x00, 0x06, 0x90, 0x00,
+    0x2C, 0x20, 0x00, 0x87, 0x00, 0x02, 0xC2, 0x00, 0x0A, 0x50, 0x00, 0x5B,
+    0x00, 0x02, 0xB3, 0x00, 0x05, 0x50, 0xCD, 0xA2, 0x7A, 0x07, 0xA0, 0x7A,
+    0x07, 0xA0, 0x7A, 0x07, 0xA0, 0x7A, 0x07, 0xA3, 0x8A, 0xAA, 0x70, 0x00,
+    0x98, 0x00, 0x02, 0xBB, 0x10, 0x09, 0x45, 0x80, 0x3A, 0x00, 0xA3, 0x95,
+    0x00, 0x58, 0x41, 0x00, 0x14, 0xBB, 0xBB, 0xBB, 0xB4, 0x11, 0x11, 0x11,
+    0x10, 0xB7, 0x4B, 0x4A, 0xBC, 0x81, 0x24, 0x23, 0xC4, 0x03, 0x45, 0xC5,
+    0x7B, 0x76, 0xD5, 0xD4, 0x00, 0xD5, 0xC8, 0x38, 0xE5, 0x38, 0x95, 0x53,
+    0xD3, 0x00, 0x00, 0xD3, 0x00, 0x00, 0xD4, 0x45, 0x20, 0xEB, 0x99, 0xC4,
+    0xE5, 0x00, 0x6B, 0xD3, 0x00, 0x4D, 0xD3, 0x00, 0x4D, 0xF5, 0x00, 0x7B,
+    0xDB, 0x99, 0xC4, 0x42, 0x45, 0x20, 0x29, 0xCB, 0x69, 0xA2, 0x22, 0xD4,
+    0x00, 0x0D, 0x40, 0x00, 0xC5, 0x00, 0x07, 0xC5, 0x45, 0x05, 0x99, 0x40,
+    0x00, 0x00, 0xB5, 0x00, 0x00, 0xB5, 0x03, 0x53, 0xB5, 0x5C, 0x9A, 0xD5,
+    0xC6, 0x01, 0xE5, 0xD4, 0x00, 0xC5, 0xD4, 0x00, 0xC5, 0xC6, 0x00, 0xE5,
+    0x5C, 0x9A, 0xC5, 0x03, 0x53, 0x32, 0x28, 0xBC, 0x92, 0x89, 0x22, 0x89,
+    0xD8, 0x55, 0x7E, 0xEA, 0x88, 0x88, 0xC6, 0x00, 0x00, 0x6C, 0x54, 0x66,
+    0x03, 0x9A, 0x83, 0x00, 0x6C, 0xCA, 0x00, 0xC6, 0x22, 0x45, 0xE7, 0x52,
+    0x77, 0xE9, 0x83, 0x00, 0xD3, 0x00, 0x00, 0xD3, 0x00, 0x00, 0xD3, 0x00,
+    0x00, 0xD3, 0x00, 0x00, 0xD3, 0x00, 0x00, 0x41, 0x00, 0x17, 0xAB, 0xDE,
+    0x70, 0x4C, 0x21, 0x6C, 0x00, 0x4C, 0x21, 0x5C, 0x00, 0x18, 0xCA, 0xA5,
+    0x00, 0x08, 0x70, 0x00, 0x00, 0x07, 0xCA, 0xA7, 0x10, 0x88, 0x43, 0x4A,
+    0x80, 0xC3, 0x00, 0x07, 0x90, 0x8B, 0x88, 0xAB, 0x20, 0x13, 0x55, 0x42,
+    0x00, 0xD3, 0x00, 0x00, 0xD3, 0x00, 0x00, 0xD4, 0x44, 0x20, 0xEB, 0x9A,
+    0xA2, 0xF6, 0x00, 0xC4, 0xD3, 0x00, 0xB5, 0xD3, 0x00, 0xB5, 0xD3, 0x00,
+    0xB5, 0xD3, 0x00, 0xB5, 0x41, 0x00, 0x42, 0x00, 0x59, 0x00, 0x00, 0x23,
+    0x00, 0x14, 0x54, 0x00, 0x15, 0xAB, 0x00, 0x00, 0x5B, 0x00, 0x00, 0x5B,
+    0x00, 0x00, 0x5B, 0x00, 0x00, 0x5B, 0x00, 0x26, 0xAD, 0x75, 0x25, 0x55,
+    0x54, 0x00, 0x3B, 0x00, 0x14, 0x25, 0x55, 0x26, 0x9E, 0x00, 0x3D, 0x00,
+    0x3D, 0x00, 0x3D, 0x00, 0x3D, 0x00, 0x3D, 0x00, 0x3D, 0x32, 0x6C, 0xBB,
+    0xB5, 0xD3, 0x00, 0x00, 0xD3, 0x00, 0x00, 0xD3, 0x01, 0x41, 0xD3, 0x19,
+    0x71, 0xD4, 0x96, 0x00, 0xDA, 0x70, 0x00, 0xE9, 0xA3, 0x00, 0xD3, 0x5A,
+    0x10, 0xD3, 0x04, 0xB2, 0x41, 0x00, 0x42, 0x18, 0xCB, 0x00, 0x00, 0x6B,
+    0x00, 0x00, 0x5B, 0x00, 0x00, 0x5B, 0x00, 0x00, 0x5B, 0x00, 0x00, 0x5B,
+    0x00, 0x00, 0x5B, 0x00, 0x00, 0x5B, 0x00, 0x26, 0xAD, 0x75, 0x25, 0x55,
+    0x54, 0xDA, 0xA9, 0xB2, 0xE6, 0xE5, 0xC4, 0xD3, 0xD3, 0xB5, 0xD3, 0xD3,
+    0xB5, 0xD3, 0xD3, 0xB5, 0xD3, 0xD3, 0xB5, 0x92, 0x92, 0x73, 0xD8, 0xBC,
+    0x81, 0xF9, 0x23, 0xC4, 0xE4, 0x00, 0xB5, 0xD3, 0x00, 0xB5, 0xD3, 0x00,
+    0xB5, 0xD3, 0x00, 0xB5, 0x92, 0x00, 0x73, 0x29, 0xCC, 0x82, 0x8A, 0x22,
+    0xA8, 0xD4, 0x00, 0x4D, 0xD4, 0x00, 0x4D, 0xC5, 0x00, 0x5C, 0x6C, 0x55,
+    0xC6, 0x04, 0x99, 0x40, 0xD8, 0xBC, 0xA2, 0xF9, 0x22, 0xA9, 0xE4, 0x00,
+    0x4D, 0xD3, 0x00, 0x4D, 0xE5, 0x00, 0x5C, 0xFB, 0x55, 0xC7, 0xD5, 0x99,
+    0x50, 0xD3, 0x00, 0x00, 0xD3, 0x00, 0x00, 0x41, 0x00, 0x00, 0x3A, 0xC9,
+    0xA5, 0x99, 0x24, 0xE5, 0xD4, 0x00, 0xC5, 0xD3, 0x00, 0xB5, 0xC5, 0x00,
+    0xD5, 0x8B, 0x47, 0xE5, 0x16, 0x96, 0xB5, 0x00, 0x00, 0xB5, 0x00, 0x00,
+    0xB5, 0x00, 0x00, 0x42, 0xC6, 0xBC, 0x6E, 0x92, 0x22, 0xE4, 0x00, 0x0D,
+    0x30, 0x00, 0xD3, 0x00, 0x0D, 0x30, 0x00, 0x92, 0x00, 0x00, 0x6B, 0xBB,
+    0x5C, 0x52, 0x32, 0xAA, 0x41, 0x02, 0x6B, 0xB2, 0x00, 0x08, 0x98, 0x54,
+    0xB7, 0x79, 0x96, 0x00, 0x04, 0x40, 0x00, 0x86, 0x00, 0x9E, 0xDB, 0x81,
+    0xA7, 0x11, 0x0A, 0x60, 0x00, 0xA6, 0x00, 0x0A, 0x60, 0x00, 0x8A, 0x43,
+    0x01, 0x8A, 0x50, 0xD3, 0x00, 0xB5, 0xD3, 0x00, 0xB5, 0xD3, 0x00, 0xB5,
+    0xD3, 0x00, 0xB5, 0xD3, 0x00, 0xD5, 0xB9, 0x48, 0xE5, 0x27, 0x96, 0x63,
+    0xC5, 0x00, 0x5C, 0x79, 0x00, 0x98, 0x3C, 0x10, 0xC3, 0x1B, 0x44, 0xB1,
+    0x06, 0x99, 0x60, 0x02, 0xDD, 0x20, 0x00, 0x88, 0x00, 0xB3, 0x2B, 0x40,
+    0x94, 0x94, 0x4A, 0x80, 0xA3, 0x75, 0x75, 0xB2, 0xB1, 0x56, 0xA3, 0x95,
+    0xA0, 0x37, 0xA1, 0x69, 0x70, 0x2A, 0x70, 0x3C, 0x40, 0x17, 0x20, 0x18,
+    0x10, 0x8A, 0x00, 0xA8, 0x2B, 0x44, 0xB2, 0x02, 0xCC, 0x20, 0x00, 0xDD,
+    0x00, 0x07, 0x88, 0x70, 0x4C, 0x11, 0xC4, 0x84, 0x00, 0x48, 0xB5, 0x00,
+    0x5B, 0x79, 0x00, 0x97, 0x3C, 0x11, 0xC3, 0x1A, 0x54, 0xA1, 0x04, 0xBA,
+    0x40, 0x01, 0xCD, 0x10, 0x00, 0x98, 0x00, 0x00, 0xB4, 0x00, 0x8A, 0x80,
+    0x00, 0x54, 0x10, 0x00, 0xBB, 0xBD, 0x91, 0x13, 0xC4, 0x00, 0x98, 0x00,
+    0x4B, 0x20, 0x3B, 0x20, 0x0A, 0x93, 0x32, 0xAA, 0xAA, 0x70, 0x00, 0x6B,
+    0x80, 0x0D, 0x61, 0x00, 0xD3, 0x00, 0x0D, 0x30, 0x6A, 0x91, 0x09, 0xC7,
+    0x00, 0x01, 0xD3, 0x00, 0x0D, 0x30, 0x00, 0xD3, 0x00, 0x0C, 0x82, 0x00,
+    0x27, 0x60, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2,
+    0xC2, 0xC2, 0xBB, 0x30, 0x02, 0x99, 0x00, 0x07, 0xA0, 0x00, 0x6A, 0x00,
+    0x02, 0xB8, 0x40, 0x1B, 0xB6, 0x06, 0xB1, 0x00, 0x7A, 0x00, 0x07, 0xA0,
+    0x04, 0xB7, 0x00, 0x96, 0x00, 0x00, 0x9B, 0xA5, 0x27, 0x72, 0x5A, 0xB9,
+    0xD6, 0x42, 0x83, 0x94, 0xA4, 0xB4, 0xC5, 0xD5, 0x94, 0x00, 0xD3, 0x00,
+    0x16, 0xEB, 0x50, 0x9C, 0x54, 0x40, 0xD5, 0x00, 0x00, 0xD4, 0x00, 0x00,
+    0xC6, 0x00, 0x00, 0x5C, 0xA9, 0x70, 0x03, 0xE7, 0x20, 0x00, 0x92, 0x00,
+    0x02, 0xAC, 0xB6, 0x07, 0xA2, 0x32, 0x0A, 0x70, 0x00, 0x0A, 0x70, 0x00,
+    0xBE, 0xDB, 0x80, 0x1A, 0x71, 0x10, 0x1B, 0x50, 0x00, 0x6D, 0x53, 0x33,
+    0xAA, 0xAA, 0xAA, 0x44, 0x44, 0x44, 0x5C, 0xAA, 0xC4, 0x4A, 0x00, 0xA4,
+    0x4A, 0x00, 0xA4, 0x5C, 0xAA, 0xC4, 0x44, 0x44, 0x54, 0xA7, 0x00, 0x1A,
+    0x54, 0xC1, 0x06, 0xA0, 0x08, 0x72, 0xB3, 0x00, 0x2C, 0xB7, 0x00, 0x3A,
+    0xCE, 0xAA, 0x00, 0x16, 0xB1, 0x10, 0x3A, 0xCE, 0xAA, 0x00, 0x05, 0xB0,
+    0x00, 0x00, 0x37, 0x00, 0x00, 0xC2, 0xC2, 0xC2, 0xC2, 0x81, 0x00, 0x00,
+    0x81, 0xC2, 0xC2, 0xC2, 0xC2, 0x18, 0xBB, 0x92, 0x4C, 0x22, 0x31, 0x2C,
+    0xA5, 0x10, 0x2B, 0x7A, 0x91, 0x5C, 0x00, 0xC5, 0x2C, 0x94, 0xC3, 0x00,
+    0x6B, 0xB2, 0x00, 0x01, 0xC5, 0x5A, 0x88, 0xA2, 0x14, 0x54, 0x20, 0xA2,
+    0x84, 0x31, 0x31, 0x05, 0x99, 0x97, 0x10, 0x47, 0x10, 0x15, 0x70, 0x83,
+    0x9B, 0xB4, 0x73, 0x97, 0x82, 0x21, 0x54, 0x99, 0x50, 0x00, 0x55, 0x96,
+    0xA3, 0x32, 0x54, 0x74, 0x59, 0x93, 0x82, 0x39, 0x30, 0x28, 0x50, 0x01,
+    0x79, 0x83, 0x00, 0x5A, 0xA8, 0x49, 0xBE, 0xC4, 0x4D, 0xAA, 0x8C, 0x17,
+    0x51, 0x92, 0x6A, 0x29, 0x71, 0xB6, 0x3C, 0x20, 0x4B, 0x26, 0x91, 0x03,
+    0x40, 0x52, 0xCC, 0xCC, 0xCE, 0x22, 0x22, 0x3C, 0x00, 0x00, 0x2C, 0x00,
+    0x00, 0x14, 0xCC, 0xC4, 0x22, 0x21, 0x05, 0x99, 0x97, 0x10, 0x47, 0x10,
+    0x15, 0x70, 0x82, 0xEB, 0xA2, 0x73, 0x90, 0xD5, 0xB4, 0x54, 0x90, 0xEC,
+    0xA1, 0x55, 0x91, 0xC4, 0xB3, 0x54, 0x74, 0x81, 0x56, 0x82, 0x39, 0x30,
+    0x28, 0x50, 0x01, 0x79, 0x83, 0x00, 0x77, 0x77, 0x77, 0x72, 0x55, 0x55,
+    0x55, 0x52, 0x4A, 0xA9, 0x1A, 0x51, 0x87, 0xB2, 0x04, 0x99, 0x72, 0xA5,
+    0x17, 0x95, 0x00, 0x00, 0x35, 0x00, 0x00, 0x58, 0x00, 0x35, 0x8A, 0x54,
+    0x58, 0xAC, 0x87, 0x00, 0x58, 0x00, 0x00, 0x47, 0x00, 0x58, 0x88, 0x87,
+    0x35, 0x55, 0x54, 0x7A, 0xA2, 0x10, 0x94, 0x05, 0x81, 0x68, 0x10, 0xAA,
+    0xA3, 0x7A, 0xA3, 0x11, 0xA4, 0x3A, 0x92, 0x11, 0xA4, 0x8A, 0x61, 0x7B,
+    0xB4, 0xD3, 0x00, 0xB5, 0xD3, 0x00, 0xB5, 0xD3, 0x00, 0xB5, 0xD3, 0x00,
+    0xB5, 0xD3, 0x00, 0xD5, 0xF9, 0x48, 0xE5, 0xD9, 0x96, 0x63, 0xD3, 0x00,
+    0x00, 0xD3, 0x00, 0x00, 0x41, 0x00, 0x00, 0x4B, 0xFD, 0xCE, 0xBF, 0xF7,
+    0x2B, 0xFF, 0xF6, 0x0A, 0xFF, 0xF6, 0x0A, 0xCF, 0xF6, 0x0A, 0x5D, 0xF6,
+    0x0A, 0x00, 0x56, 0x0A, 0x00, 0x56, 0x0A, 0x00, 0x56, 0x0A, 0x00, 0x56,
+    0x0A, 0x00, 0x34, 0x07, 0xB4, 0x41, 0x56, 0x4A, 0x93, 0x6D, 0x33, 0xB3,
+    0x0A, 0x30, 0xA3, 0x07, 0x20, 0x6A, 0xA6, 0xB3, 0x3B, 0xB3, 0x3B, 0x6A,
+    0xA6, 0x85, 0x39, 0x10, 0x4B, 0x27, 0x91, 0x1A, 0x72, 0xC3, 0x6A, 0x29,
+    0x60, 0x62, 0x25, 0x00, 0x6D, 0x30, 0x08, 0x60, 0x3B, 0x30, 0x2B, 0x10,
+    0x0A, 0x30, 0x86, 0x00, 0x0A, 0x31, 0xB2, 0x00, 0x07, 0x28, 0x55, 0xC2,
+    0x00, 0x3B, 0x48, 0xB2, 0x00, 0x86, 0xB7, 0xD3, 0x02, 0xB2, 0x55, 0xD3,
+    0x05, 0x40, 0x00, 0x81, 0x6D, 0x30, 0x4A, 0x00, 0x3B, 0x30, 0x95, 0x00,
+    0x0A, 0x33, 0xA1, 0x00, 0x0A, 0x4A, 0x40, 0x00, 0x07, 0x79, 0x7A, 0xA2,
+    0x00, 0x95, 0x10, 0x94, 0x04, 0x91, 0x05, 0x81, 0x1A, 0x30, 0x68, 0x10,
+    0x27, 0x00, 0xAA, 0xA3, 0x7A, 0xA3, 0x08, 0x60, 0x11, 0xA4, 0x2B, 0x10,
+    0x3A, 0x92, 0x86, 0x00, 0x11, 0xA6, 0xB2, 0x00, 0x8A, 0x69, 0x55, 0xC2,
+    0x00, 0x3B, 0x48, 0xB2, 0x00, 0x86, 0xB7, 0xD3, 0x02, 0xB2, 0x55, 0xD3,
+    0x05, 0x40, 0x00, 0x81, 0x00, 0xC4, 0x00, 0x00, 0x72, 0x00, 0x00, 0x41,
+    0x00, 0x01, 0xC3, 0x00, 0x3B, 0x60, 0x00, 0xA8, 0x00, 0x00, 0xD3, 0x00,
+    0x00, 0xB9, 0x45, 0x83, 0x16, 0x99, 0x51, 0x00, 0x3D, 0x20, 0x00, 0x00,
+    0x07, 0x70, 0x00, 0x00, 0x14, 0x20, 0x00, 0x00, 0x4E, 0x80, 0x00, 0x00,
+    0x99, 0xC2, 0x00, 0x00, 0xC4, 0xC4, 0x00, 0x04, 0xB1, 0x89, 0x00, 0x09,
+    0x90, 0x5D, 0x00, 0x3C, 0xCC, 0xCE, 0x50, 0x5C, 0x22, 0x29, 0xA0, 0xB6,
+    0x00, 0x02, 0xD3, 0x41, 0x00, 0x00, 0x41, 0x00, 0x02, 0xD3, 0x00, 0x00,
+    0x07, 0x70, 0x00, 0x00, 0x14, 0x20, 0x00, 0x00, 0x4E, 0x80, 0x00, 0x00,
+    0x99, 0xC2, 0x00, 0x00, 0xC4, 0xC4, 0x00, 0x04, 0xB1, 0x89, 0x00, 0x09,
+    0x90, 0x5D, 0x00, 0x3C, 0xCC, 0xCE, 0x50, 0x5C, 0x22, 0x29, 0xA0, 0xB6,
+    0x00, 0x02, 0xD3, 0x41, 0x00, 0x00, 0x41, 0x00, 0x4C, 0x80, 0x00, 0x00,
+    0x95, 0xA3, 0x00, 0x00, 0x14, 0x20, 0x00, 0x00, 0x4E, 0x80, 0x00, 0x00,
+    0x99, 0xC2, 0x00, 0x00, 0xC4, 0xC4, 0x00, 0x04, 0xB1, 0x89, 0x00, 0x09,
+    0x90, 0x5D, 0x00, 0x3C, 0xCC, 0xCE, 0x50, 0x5C, 0x22, 0x29, 0xA0, 0xB6,
+    0x00, 0x02, 0xD3, 0x41, 0x00, 0x00, 0x41, 0x01, 0x42, 0x03, 0x00, 0x05,
+    0xAB, 0x6A, 0x00, 0x06, 0x02, 0x94, 0x00, 0x00, 0x28, 0x40, 0x00, 0x00,
+    0x5D, 0xA0, 0x00, 0x00, 0xA7, 0xC3, 0x00, 0x01, 0xD3, 0xB6, 0x00, 0x06,
+    0xB1, 0x7B, 0x00, 0x1B, 0xA5, 0x8E, 0x20, 0x3D, 0x99, 0x9D, 0x60, 0x7A,
+    0x00, 0x05, 0xB1, 0xC5, 0x00, 0x01, 0xD4, 0x00, 0xA2, 0x84, 0x00, 0x00,
+    0x31, 0x31, 0x00, 0x00, 0x3D, 0x70, 0x00, 0x00, 0x6C, 0xB1, 0x00, 0x00,
+    0xC5, 0xC4, 0x00, 0x02, 0xC3, 0xA7, 0x00, 0x08, 0xA0, 0x5C, 0x00, 0x1B,
+    0xDA, 0xBF, 0x30, 0x5D, 0x44, 0x4A, 0x90, 0x89, 0x00, 0x04, 0xC2, 0x83,
+    0x00, 0x00, 0x93, 0x00, 0x39, 0x93, 0x00, 0x00, 0x56, 0x65, 0x00, 0x00,
+    0x4E, 0xB1, 0x00, 0x00, 0x6C, 0xB1, 0x00, 0x00, 0xC5, 0xC4, 0x00, 0x02,
+    0xC3, 0xA7, 0x00, 0x08, 0xA0, 0x5C, 0x00, 0x1B, 0xDA, 0xBF, 0x30, 0x5D,
+    0x44, 0x4A, 0x90, 0x89, 0x00, 0x04, 0xC2, 0x83, 0x00, 0x00, 0x93, 0x02,
+    0xEE, 0xDC, 0x80, 0x59, 0xB8, 0x21, 0x09, 0x4A, 0x60, 0x01, 0xB1, 0xAC,
+    0xA7, 0x3C, 0x5C, 0x94, 0x34, 0xC9, 0xD6, 0x00, 0x86, 0x0A, 0x60, 0x0A,
+    0x40, 0xA9, 0x43, 0x82, 0x07, 0xAA, 0x70, 0x04, 0xBC, 0xC9, 0x4D, 0x63,
+    0x34, 0xB8, 0x00, 0x00, 0xD4, 0x00, 0x00, 0xE4, 0x00, 0x00, 0xD5, 0x00,
+    0x00, 0x9A, 0x10, 0x00, 0x3C, 0x95, 0x58, 0x01, 0x7C, 0x97, 0x00, 0x19,
+    0x40, 0x00, 0x27, 0x60, 0x00, 0x24, 0x00, 0x06, 0xB1, 0x00, 0x01, 0xA4,
+    0x00, 0x55, 0x55, 0x52, 0xEB, 0x99, 0x93, 0xD3, 0x00, 0x00, 0xD3, 0x00,
+    0x00, 0xFD, 0xCC, 0xC4, 0xD5, 0x22, 0x21, 0xD3, 0x00, 0x00, 0xD3, 0x00,
+    0x00, 0xEB, 0x99, 0x93, 0x55, 0x55, 0x52, 0x00, 0x7B, 0x00, 0x00, 0xB4,
+    0x00, 0x55, 0x55, 0x52, 0xEB, 0x99, 0x93, 0xD3, 0x00, 0x00, 0xD3, 0x00,
+    0x00, 0xFD, 0xCC, 0xC4, 0xD5, 0x22, 0x21, 0xD3, 0x00, 0x00, 0xD3, 0x00,
+    0x00, 0xEB, 0x99, 0x93, 0x55, 0x55, 0x52, 0x01, 0xCC, 0x10, 0x06, 0x88,
+    0x60, 0x55, 0x55, 0x52, 0xEB, 0x99, 0x93, 0xD3, 0x00, 0x00, 0xD3, 0x00,
+    0x00, 0xFD, 0xCC, 0xC4, 0xD5, 0x22, 0x21, 0xD3, 0x00, 0x00, 0xD3, 0x00,
+    0x00, 0xEB, 0x99, 0x93, 0x55, 0x55, 0x52, 0x08, 0x44, 0x80, 0x03, 0x11,
+    0x30, 0xFD, 0xCC, 0xC4, 0xD5, 0x22, 0x21, 0xD3, 0x00, 0x00, 0xEB, 0xAA,
+    0xA3, 0xE7, 0x44, 0x41, 0xD3, 0x00, 0x00, 0xD3, 0x00, 0x00, 0xE7, 0x44,
+    0x41, 0xAA, 0xAA, 0xA3, 0x06, 0xB1, 0x00, 0x01, 0xA4, 0x00, 0x25, 0x55,
+    0x41, 0x48, 0xDB, 0x71, 0x00, 0xB5, 0x00, 0x00, 0xB5, 0x00, 0x00, 0xB5,
+    0x00, 0x00, 0xB5, 0x00, 0x00, 0xB5, 0x00, 0x00, 0xB5, 0x00, 0x48, 0xDB,
+    0x71, 0x25, 0x55, 0x41, 0x00, 0x1B, 0x60, 0x00, 0x4A, 0x10, 0x25, 0x55,
+    0x41, 0x48, 0xDB, 0x71, 0x00, 0xB5, 0x00, 0x00, 0xB5, 0x00, 0x00, 0xB5,
+    0x00, 0x00, 0xB5, 0x00, 0x00, 0xB5, 0x00, 0x00, 0xB5, 0x00, 0x48, 0xDB,
+    0x71, 0x25, 0x55, 0x41, 0x01, 0xCC, 0x10, 0x06, 0x88, 0x60, 0x25, 0x55,
+    0x41, 0x48, 0xDB, 0x71, 0x00, 0xB5, 0x00, 0x00, 0xB5, 0x00, 0x00, 0xB5,
+    0x00, 0x00, 0xB5, 0x00, 0x00, 0xB5, 0x00, 0x00, 0xB5, 0x00, 0x48, 0xDB,
+    0x71, 0x25, 0x55, 0x41, 0x08, 0x44, 0x80, 0x03, 0x11, 0x30, 0x5C, 0xED,
+    0xA2, 0x12, 0xC6, 0x10, 0x00, 0xB5, 0x00, 0x00, 0xB5, 0x00, 0x00, 0xB5,
+    0x00, 0x00, 0xB5, 0x00, 0x00, 0xB5, 0x00, 0x13, 0xC7, 0x20, 0x5A, 0xAA,
+    0x92, 0x5E, 0xCC, 0x93, 0x05, 0xC2, 0x39, 0xC1, 0x5B, 0x00, 0x1B, 0x6C,
+    0xEA, 0xA0, 0x99, 0x8C, 0x44, 0x08, 0xA5, 0xB0, 0x00, 0x98, 0x5B, 0x00,
+    0x4D, 0x35, 0xC4, 0x6C, 0x90, 0x3A, 0xA8, 0x40, 0x00, 0x03, 0x30, 0x22,
+    0x39, 0xA8, 0x84, 0x33, 0x17, 0x61, 0xA3, 0x00, 0x28, 0xFB, 0x00, 0x3D,
+    0xDC, 0x40, 0x3D, 0xC5, 0xB2, 0x3D, 0xD3, 0x86, 0x3D, 0xD3, 0x2B, 0x4D,
+    0xD3, 0x07, 0x9C, 0xD3, 0x00, 0xCE, 0xD3, 0x00, 0x6F, 0x00, 0xB7, 0x00,
+    0x00, 0x4B, 0x00, 0x02, 0x55, 0x20, 0x3B, 0xBB, 0xB2, 0x99, 0x00, 0x99,
+    0xD5, 0x00, 0x5C, 0xE4, 0x00, 0x4D, 0xE4, 0x00, 0x4D, 0xD5, 0x00, 0x5C,
+    0x99, 0x00, 0x99, 0x3B, 0xBB, 0xA2, 0x02, 0x55, 0x20, 0x00, 0x1B, 0x60,
+    0x00, 0x4A, 0x10, 0x02, 0x55, 0x20, 0x3B, 0xBB, 0xB2, 0x99, 0x00, 0x99,
+    0xD5, 0x00, 0x5C, 0xE4, 0x00, 0x4D, 0xE4, 0x00, 0x4D, 0xD5, 0x00, 0x5C,
+    0x99, 0x00, 0x99, 0x3B, 0xBB, 0xA2, 0x02, 0x55, 0x20, 0x01, 0xCC, 0x10,
+    0x06, 0x88, 0x60, 0x02, 0x55, 0x20, 0x3B, 0xBB, 0xB2, 0x99, 0x00, 0x99,
+    0xD5, 0x00, 0x5C, 0xE4, 0x00, 0x4D, 0xE4, 0x00, 0x4D, 0xD5, 0x00, 0x5C,
+    0x99, 0x00, 0x99, 0x3B, 0xBB, 0xA2, 0x02, 0x55, 0x20, 0x03, 0x30, 0x22,
+    0x39, 0xA8, 0x84, 0x33, 0x17, 0x61, 0x04, 0x99, 0x30, 0x5D, 0x66, 0xC5,
+    0xB8, 0x00, 0x7A, 0xD4, 0x00, 0x4D, 0xE4, 0x00, 0x4E, 0xD4, 0x00, 0x4D,
+    0xC6, 0x00, 0x5C, 0x7C, 0x33, 0xB6, 0x18, 0xCC, 0x81, 0x08, 0x44, 0x80,
+    0x03, 0x11, 0x30, 0x18, 0xCC, 0x81, 0x7C, 0x33, 0xB6, 0xC6, 0x00, 0x5C,
+    0xD4, 0x00, 0x4D, 0xE4, 0x00, 0x4E, 0xD4, 0x00, 0x4D, 0xA8, 0x00, 0x8A,
+    0x5D, 0x66, 0xC5, 0x04, 0x99, 0x30, 0x23, 0x00, 0x32, 0x3A, 0x22, 0xA3,
+    0x02, 0xBB, 0x20, 0x02, 0xBB, 0x20, 0x3A, 0x22, 0xA3, 0x23, 0x00, 0x32,
+    0x02, 0x54, 0x35, 0x03, 0xBB, 0xBD, 0x90, 0x99, 0x01, 0xD9, 0x0D, 0x50,
+    0x79, 0xC0, 0xE4, 0x48, 0x4D, 0x0E, 0x48, 0x44, 0xD0, 0xC8, 0x80, 0x5C,
+    0x09, 0xE2, 0x09, 0x90, 0x9D, 0xBB, 0xA2, 0x05, 0x34, 0x52, 0x00, 0x00,
+    0xB7, 0x00, 0x00, 0x4B, 0x00, 0x41, 0x00, 0x14, 0xD3, 0x00, 0x3D, 0xD3,
+    0x00, 0x3D, 0xD3, 0x00, 0x3D, 0xD3, 0x00, 0x3D, 0xD3, 0x00, 0x3D, 0xD4,
+    0x00, 0x4D, 0xC7, 0x00, 0x7C, 0x5C, 0xBA, 0xC4, 0x03, 0x55, 0x20, 0x00,
+    0x1B, 0x60, 0x00, 0x4A, 0x10, 0x41, 0x00, 0x14, 0xD3, 0x00, 0x3D, 0xD3,
+    0x00, 0x3D, 0xD3, 0x00, 0x3D, 0xD3, 0x00, 0x3D, 0xD3, 0x00, 0x3D, 0xD4,
+    0x00, 0x4D, 0xC7, 0x00, 0x7C, 0x5C, 0xBA, 0xC4, 0x03, 0x55, 0x20, 0x01,
+    0xCC, 0x10, 0x06, 0x88, 0x60, 0x41, 0x00, 0x14, 0xD3, 0x00, 0x3D, 0xD3,
+    0x00, 0x3D, 0xD3, 0x00, 0x3D, 0xD3, 0x00, 0x3D, 0xD3, 0x00, 0x3D, 0xD4,
+    0x00, 0x4D, 0xC7, 0x00, 0x7C, 0x5C, 0xBA, 0xC4, 0x03, 0x55, 0x20, 0x08,
+    0x44, 0x80, 0x03, 0x11, 0x30, 0xD3, 0x00, 0x3D, 0xD3, 0x00, 0x3D, 0xD3,
+    0x00, 0x3D, 0xD3, 0x00, 0x3D, 0xD3, 0x00, 0x3D, 0xD3, 0x00, 0x3D, 0xD5,
+    0x00, 0x5C, 0x8C, 0x66, 0xC8, 0x15, 0x99, 0x50, 0x00, 0x02, 0xD3, 0x00,
+    0x00, 0x77, 0x00, 0x33, 0x00, 0x03, 0x26, 0xB0, 0x02, 0xB4, 0x1B, 0x40,
+    0x6B, 0x00, 0x5A, 0x1B, 0x50, 0x00, 0xB9, 0xA1, 0x00, 0x06, 0xE4, 0x00,
+    0x00, 0x3D, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x01,
+    0x40, 0x00, 0xD3, 0x00, 0x00, 0xEB, 0xA9, 0x51, 0xE6, 0x46, 0xC9, 0xD3,
+    0x00, 0x5D, 0xD3, 0x00, 0x5D, 0xE6, 0x46, 0xC8, 0xEB, 0xA9, 0x40, 0xD3,
+    0x00, 0x00, 0x92, 0x00, 0x00, 0x5B, 0xCB, 0x81, 0xC7, 0x23, 0xC4, 0xD3,
+    0x04, 0xB3, 0xD3, 0x5B, 0x30, 0xD3, 0x98, 0x10, 0xD3, 0x3B, 0x92, 0xD3,
+    0x00, 0x9B, 0xD3, 0x00, 0x4D, 0xD3, 0xB9, 0xB9, 0x41, 0x35, 0x41, 0x06,
+    0xB1, 0x00, 0x01, 0xA4, 0x00, 0x13, 0x55, 0x20, 0x4A, 0x9A, 0xA2, 0x00,
+    0x00, 0xC5, 0x15, 0x9A, 0xE5, 0xB9, 0x32, 0xC5, 0xD4, 0x01, 0xE5, 0x9A,
+    0x8A, 0xB5, 0x14, 0x53, 0x32, 0x00, 0x1B, 0x60, 0x00, 0x4A, 0x10, 0x13,
+    0x55, 0x20, 0x4A, 0x9A, 0xA2, 0x00, 0x00, 0xC5, 0x15, 0x9A, 0xE5, 0xB9,
+    0x32, 0xC5, 0xD4, 0x01, 0xE5, 0x9A, 0x8A, 0xB5, 0x14, 0x53, 0x32, 0x01,
+    0xCC, 0x10, 0x06, 0x88, 0x60, 0x13, 0x55, 0x20, 0x4A, 0x9A, 0xA2, 0x00,
+    0x00, 0xC5, 0x15, 0x9A, 0xE5, 0xB9, 0x32, 0xC5, 0xD4, 0x01, 0xE5, 0x9A,
+    0x8A, 0xB5, 0x14, 0x53, 0x32, 0x03, 0x30, 0x22, 0x39, 0xA8, 0x84, 0x33,
+    0x17, 0x61, 0x27, 0x99, 0x40, 0x37, 0x46, 0xD3, 0x00, 0x00, 0xB5, 0x49,
+    0xAA, 0xE5, 0xC7, 0x11, 0xC5, 0xC6, 0x24, 0xE5, 0x6B, 0xB9, 0xA5, 0x08,
+    0x44, 0x80, 0x03, 0x11, 0x30, 0x4A, 0xBC, 0x81, 0x24, 0x23, 0xC4, 0x03,
+    0x45, 0xC5, 0x7B, 0x76, 0xD5, 0xD4, 0x00, 0xD5, 0xC8, 0x38, 0xE5, 0x38,
+    0x95, 0x53, 0x00, 0x99, 0x50, 0x00, 0xA2, 0x90, 0x00, 0x59, 0x20, 0x27,
+    0x99, 0x40, 0x37, 0x46, 0xD3, 0x00, 0x00, 0xB5, 0x49, 0xAA, 0xE5, 0xC7,
+    0x11, 0xC5, 0xC6, 0x24, 0xE5, 0x6B, 0xB9, 0xA5, 0x4B, 0xC9, 0x8C, 0x81,
+    0x23, 0x3B, 0xA3, 0xC3, 0x13, 0x5C, 0xA5, 0xC5, 0x8B, 0x7C, 0xB8, 0x83,
+    0xD4, 0x1B, 0x80, 0x00, 0xC7, 0x7A, 0xC6, 0x62, 0x39, 0x71, 0x49, 0x71,
+    0x29, 0xCB, 0x69, 0xA2, 0x22, 0xD4, 0x00, 0x0D, 0x40, 0x00, 0xC5, 0x00,
+    0x07, 0xC5, 0x45, 0x05, 0xBB, 0x40, 0x06, 0x80, 0x00, 0x68, 0x00, 0x04,
+    0x10, 0x00, 0xB7, 0x00, 0x00, 0x4B, 0x00, 0x02, 0x45, 0x20, 0x3B, 0x99,
+    0xB4, 0xA6, 0x00, 0x5C, 0xEB, 0xAA, 0xBE, 0xD6, 0x33, 0x33, 0xB7, 0x00,
+    0x00, 0x3B, 0xA9, 0xA7, 0x01, 0x45, 0x42, 0x00, 0x1B, 0x60, 0x00, 0x4A,
+    0x10, 0x02, 0x45, 0x20, 0x3B, 0x99, 0xB4, 0xA6, 0x00, 0x5C, 0xEB, 0xAA,
+    0xBE, 0xD6, 0x33, 0x33, 0xB7, 0x00, 0x00, 0x3B, 0xA9, 0xA7, 0x01, 0x45,
+    0x42, 0x01, 0xCC, 0x10, 0x06, 0x88, 0x60, 0x02, 0x45, 0x20, 0x3B, 0x99,
+    0xB4, 0xA6, 0x00, 0x5C, 0xEB, 0xAA, 0xBE, 0xD6, 0x33, 0x33, 0xB7, 0x00,
+    0x00, 0x3B, 0xA9, 0xA7, 0x01, 0x45, 0x42, 0x08, 0x44, 0x80, 0x03, 0x11,
+    0x30, 0x28, 0xBC, 0x92, 0x89, 0x22, 0x89, 0xD8, 0x55, 0x7E, 0xEA, 0x88,
+    0x88, 0xC6, 0x00, 0x00, 0x6C, 0x54, 0x66, 0x03, 0x9A, 0x83, 0x00, 0xB7,
+    0x00, 0x00, 0x4B, 0x00, 0x14, 0x54, 0x00, 0x15, 0xAB, 0x00, 0x00, 0x5B,
+    0x00, 0x00, 0x5B, 0x00, 0x00, 0x5B, 0x00, 0x00, 0x5B, 0x00, 0x26, 0xAD,
+    0x75, 0x25, 0x55, 0x54, 0x00, 0x1B, 0x60, 0x00, 0x4A, 0x10, 0x14, 0x54,
+    0x00, 0x15, 0xAB, 0x00, 0x00, 0x5B, 0x00, 0x00, 0x5B, 0x00, 0x00, 0x5B,
+    0x00, 0x00, 0x5B, 0x00, 0x26, 0xAD, 0x75, 0x25, 0x55, 0x54, 0x01, 0xCC,
+    0x10, 0x06, 0x88, 0x60, 0x14, 0x54, 0x00, 0x15, 0xAB, 0x00, 0x00, 0x5B,
+    0x00, 0x00, 0x5B, 0x00, 0x00, 0x5B, 0x00, 0x00, 0x5B, 0x00, 0x26, 0xAD,
+    0x75, 0x25, 0x55, 0x54, 0x08, 0x44, 0x80, 0x03, 0x11, 0x30, 0x18, 0xCB,
+    0x00, 0x00, 0x6B, 0x00, 0x00, 0x5B, 0x00, 0x00, 0x5B, 0x00, 0x00, 0x5B,
+    0x00, 0x01, 0x6C, 0x21, 0x3A, 0xAA, 0xA8, 0x02, 0x84, 0x73, 0x02, 0xAC,
+    0x80, 0x04, 0x42, 0xB3, 0x15, 0x99, 0x98, 0x8C, 0x55, 0xCD, 0xD5, 0x00,
+    0x5E, 0xD4, 0x00, 0x4D, 0xC6, 0x00, 0x6A, 0x4B, 0x99, 0xB3, 0x02, 0x55,
+    0x20, 0x03, 0x30, 0x22, 0x39, 0xA8, 0x84, 0x33, 0x17, 0x61, 0x84, 0x99,
+    0x30, 0xEB, 0x46, 0xC3, 0xE5, 0x00, 0xC5, 0xD3, 0x00, 0xB5, 0xD3, 0x00,
+    0xB5, 0xD3, 0x00, 0xB5, 0xD3, 0x00, 0xB5, 0x00, 0xB7, 0x00, 0x00, 0x4B,
+    0x00, 0x02, 0x55, 0x20, 0x3B, 0x99, 0xB3, 0xB7, 0x00, 0x7B, 0xD4, 0x00,
+    0x4D, 0xD4, 0x00, 0x4D, 0xB7, 0x00, 0x7B, 0x3B, 0x99, 0xB3, 0x02, 0x55,
+    0x20, 0x00, 0x1B, 0x60, 0x00, 0x4A, 0x10, 0x02, 0x55, 0x20, 0x3B, 0x99,
+    0xB3, 0xB7, 0x00, 0x7B, 0xD4, 0x00, 0x4D, 0xD4, 0x00, 0x4D, 0xB7, 0x00,
+    0x7B, 0x3B, 0x99, 0xB3, 0x02, 0x55, 0x20, 0x01, 0xCC, 0x10, 0x06, 0x88,
+    0x60, 0x02, 0x55, 0x20, 0x3B, 0x99, 0xB3, 0xB7, 0x00, 0x7B, 0xD4, 0x00,
+    0x4D, 0xD4, 0x00, 0x4D, 0xB7, 0x00, 0x7B, 0x3B, 0x99, 0xB3, 0x02, 0x55,
+    0x20, 0x03, 0x30, 0x22, 0x39, 0xA8, 0x84, 0x33, 0x17, 0x61, 0x04, 0x99,
+    0x40, 0x6C, 0x55, 0xC6, 0xC5, 0x00, 0x5C, 0xD4, 0x00, 0x4D, 0xD4, 0x00,
+    0x4D, 0x8A, 0x22, 0xA8, 0x28, 0xCC, 0x82, 0x08, 0x44, 0x80, 0x03, 0x11,
+    0x30, 0x29, 0xCC, 0x82, 0x8A, 0x22, 0xA8, 0xD4, 0x00, 0x4D, 0xD4, 0x00,
+    0x4D, 0xC5, 0x00, 0x5C, 0x6C, 0x55, 0xC6, 0x04, 0x99, 0x40, 0x00, 0xB3,
+    0x00, 0x00, 0x41, 0x00, 0x55, 0x55, 0x52, 0x88, 0x88, 0x83, 0x00, 0x00,
+    0x00, 0x00, 0x72, 0x00, 0x00, 0x82, 0x00, 0x02, 0x55, 0x54, 0x3B, 0x99,
+    0xE6, 0xB6, 0x06, 0xBB, 0xD4, 0x39, 0x4D, 0xD4, 0x93, 0x4D, 0xBB, 0x70,
+    0x6B, 0x6E, 0x99, 0xB3, 0x45, 0x55, 0x20, 0x06, 0xB1, 0x00, 0x01, 0xA4,
+    0x00, 0x41, 0x00, 0x42, 0xD3, 0x00, 0xB5, 0xD3, 0x00, 0xB5, 0xD3, 0x00,
+    0xB5, 0xD3, 0x00, 0xB5, 0xD4, 0x01, 0xE5, 0x8C, 0x9A, 0xC5, 0x14, 0x53,
+    0x32, 0x00, 0x7B, 0x00, 0x00, 0xB4, 0x00, 0x41, 0x00, 0x42, 0xD3, 0x00,
+    0xB5, 0xD3, 0x00, 0xB5, 0xD3, 0x00, 0xB5, 0xD3, 0x00, 0xB5, 0xD4, 0x01,
+    0xE5, 0x8C, 0x9A, 0xC5, 0x14, 0x53, 0x32, 0x01, 0xCC, 0x10, 0x06, 0x88,
+    0x60, 0x41, 0x00, 0x42, 0xD3, 0x00, 0xB5, 0xD3, 0x00, 0xB5, 0xD3, 0x00,
+    0xB5, 0xD3, 0x00, 0xB5, 0xD4, 0x01, 0xE5, 0x8C, 0x9A, 0xC5, 0x14, 0x53,
+    0x32, 0x08, 0x44, 0x80, 0x03, 0x11, 0x30, 0xD3, 0x00, 0xB5, 0xD3, 0x00,
+    0xB5, 0xD3, 0x00, 0xB5, 0xD3, 0x00, 0xB5, 0xD3, 0x00, 0xD5, 0xB9, 0x48,
+    0xE5, 0x27, 0x96, 0x63, 0x00, 0x1B, 0x60, 0x00, 0x4A, 0x10, 0x41, 0x00,
+    0x14, 0xA6, 0x00, 0x6A, 0x5B, 0x00, 0xB5, 0x2C, 0x21, 0xC2, 0x08, 0x77,
+    0x80, 0x03, 0xBB, 0x30, 0x00, 0xBC, 0x00, 0x00, 0x97, 0x00, 0x23, 0xB2,
+    0x00, 0xBC, 0x50, 0x00, 0xD3, 0x00, 0x00, 0xD3, 0x00, 0x00, 0xD4, 0x45,
+    0x20, 0xEB, 0x99, 0xC4, 0xF5, 0x00, 0x6B, 0xD3, 0x00, 0x4D, 0xD3, 0x00,
+    0x4D, 0xF5, 0x00, 0x7B, 0xEB, 0x99, 0xC4, 0xD4, 0x45, 0x20, 0xD3, 0x00,
+    0x00, 0xD3, 0x00, 0x00, 0x08, 0x44, 0x80, 0x03, 0x11, 0x30, 0xB5, 0x00,
+    0x5B, 0x79, 0x00, 0x97, 0x3C, 0x11, 0xC3, 0x1A, 0x54, 0xA1, 0x04, 0xBA,
+    0x40, 0x01, 0xCD, 0x10, 0x00, 0x98, 0x00, 0x00, 0xB4, 0x00, 0x8A, 0x80,
+    0x00, 0x54, 0x10, 0x00, 0x00, 0x88, 0x83, 0x00, 0x00, 0x55, 0x52, 0x00,
+    0x00, 0x3D, 0x70, 0x00, 0x00, 0x6C, 0xB1, 0x00, 0x00, 0xC5, 0xC4, 0x00,
+    0x02, 0xC3, 0xA7, 0x00, 0x08, 0xA0, 0x5C, 0x00, 0x1B, 0xDA, 0xBF, 0x30,
+    0x5D, 0x44, 0x4A, 0x90, 0x89, 0x00, 0x04, 0xC2, 0x83, 0x00, 0x00, 0x93,
+    0x05, 0x88, 0x50, 0x03, 0x55, 0x30, 0x4A, 0xBC, 0x81, 0x24, 0x23, 0xC4,
+    0x03, 0x45, 0xC5, 0x7B, 0x76, 0xD5, 0xD4, 0x00, 0xD5, 0xC8, 0x38, 0xE5,
+    0x38, 0x95, 0x53, 0x00, 0xA2, 0x74, 0x00, 0x00, 0x7B, 0x81, 0x00, 0x00,
+    0x14, 0x20, 0x00, 0x00, 0x4E, 0x80, 0x00, 0x00, 0x99, 0xC2, 0x00, 0x00,
+    0xC4, 0xC4, 0x00, 0x04, 0xB1, 0x89, 0x00, 0x09, 0x90, 0x5D, 0x00, 0x3C,
+    0xCC, 0xCE, 0x50, 0x5C, 0x22, 0x29, 0xA0, 0xB6, 0x00, 0x02, 0xD3, 0x41,
+    0x00, 0x00, 0x41, 0x08, 0x33, 0x80, 0x03, 0xBB, 0x30, 0x13, 0x55, 0x20,
+    0x4A, 0x9A, 0xA2, 0x00, 0x00, 0xC5, 0x15, 0x9A, 0xE5, 0xB9, 0x32, 0xC5,
+    0xD4, 0x01, 0xE5, 0x9A, 0x8A, 0xB5, 0x14, 0x53, 0x32, 0x00, 0x3D, 0x70,
+    0x00, 0x00, 0x6C, 0xB1, 0x00, 0x00, 0xC5, 0xC4, 0x00, 0x02, 0xC3, 0xA7,
+    0x00, 0x08, 0xA0, 0x5C, 0x00, 0x1B, 0xDA, 0xBF, 0x30, 0x5D, 0x44, 0x4A,
+    0x90, 0x89, 0x00, 0x04, 0xC2, 0x83, 0x00, 0x01, 0xC3, 0x00, 0x00, 0x06,
+    0x71, 0x00, 0x00, 0x05, 0x86, 0x00, 0x00, 0x00, 0x45, 0x4A, 0xBC, 0x81,
+    0x24, 0x23, 0xC4, 0x03, 0x45, 0xC5, 0x7B, 0x76, 0xD5, 0xD4, 0x00, 0xD5,
+    0xC8, 0x38, 0xE5, 0x38, 0x96, 0x94, 0x00, 0x06, 0x71, 0x00, 0x05, 0x86,
+    0x00, 0x00, 0x45, 0x00, 0x02, 0xD3, 0x00, 0x07, 0x70, 0x00, 0x35, 0x43,
+    0x18, 0xCA, 0xBA, 0x7C, 0x10, 0x00, 0xC6, 0x00, 0x00, 0xD4, 0x00, 0x00,
+    0xD4, 0x00, 0x00, 0xC6, 0x00, 0x00, 0x7C, 0x10, 0x00, 0x18, 0xCA, 0xAB,
+    0x01, 0x45, 0x53, 0x00, 0x1B, 0x60, 0x04, 0xA1, 0x02, 0x55, 0x24, 0xC9,
+    0x96, 0xB7, 0x00, 0x0D, 0x40, 0x00, 0xD4, 0x00, 0x0B, 0x60, 0x00, 0x4C,
+    0x99, 0x70, 0x25, 0x52, 0x00, 0x4C, 0x80, 0x00, 0x95, 0xA3, 0x00, 0x35,
+    0x43, 0x18, 0xCA, 0xBA, 0x7C, 0x10, 0x00, 0xC6, 0x00, 0x00, 0xD4, 0x00,
+    0x00, 0xD4, 0x00, 0x00, 0xC6, 0x00, 0x00, 0x7C, 0x10, 0x00, 0x18, 0xCA,
+    0xAB, 0x01, 0x45, 0x53, 0x01, 0xCC, 0x10, 0x68, 0x86, 0x02, 0x55, 0x24,
+    0xC9, 0x96, 0xB7, 0x00, 0x0D, 0x40, 0x00, 0xD4, 0x00, 0x0B, 0x60, 0x00,
+    0x4C, 0x99, 0x70, 0x25, 0x52, 0x00, 0x08, 0x40, 0x00, 0x03, 0x10, 0x04,
+    0xBC, 0xC9, 0x4D, 0x63, 0x34, 0xB8, 0x00, 0x00, 0xD4, 0x00, 0x00, 0xE4,
+    0x00, 0x00, 0xD5, 0x00, 0x00, 0x9A, 0x10, 0x00, 0x3C, 0x95, 0x58, 0x01,
+    0x79, 0x97, 0x00, 0x48, 0x00, 0x01, 0x30, 0x29, 0xCB, 0x69, 0xA2, 0x22,
+    0xD4, 0x00, 0x0D, 0x40, 0x00, 0xC5, 0x00, 0x07, 0xC5, 0x45, 0x05, 0x99,
+    0x40, 0x00, 0x95, 0xA3, 0x00, 0x4C, 0x80, 0x00, 0x35, 0x43, 0x18, 0xCA,
+    0xBA, 0x7C, 0x10, 0x00, 0xC6, 0x00, 0x00, 0xD4, 0x00, 0x00, 0xD4, 0x00,
+    0x00, 0xC6, 0x00, 0x00, 0x7C, 0x10, 0x00, 0x18, 0xCA, 0xAB, 0x01, 0x45,
+    0x53, 0x06, 0x88, 0x60, 0x1C, 0xC1, 0x02, 0x55, 0x24, 0xC9, 0x96, 0xB7,
+    0x00, 0x0D, 0x40, 0x00, 0xD4, 0x00, 0x0B, 0x60, 0x00, 0x4C, 0x99, 0x70,
+    0x25, 0x52, 0x06, 0x88, 0x60, 0x01, 0xCC, 0x10, 0x55, 0x53, 0x00, 0xEA,
+    0xAC, 0x71, 0xD3, 0x01, 0xC7, 0xD3, 0x00, 0x6C, 0xD3, 0x00, 0x4D, 0xD3,
+    0x00, 0x4D, 0xD3, 0x00, 0x6B, 0xD3, 0x02, 0xC7, 0xEA, 0xAC, 0x71, 0x55,
+    0x43, 0x00, 0x00, 0x00, 0xB5, 0xA4, 0x00, 0x00, 0xB5, 0x91, 0x03, 0x53,
+    0xB5, 0x00, 0x5C, 0x9A, 0xD5, 0x00, 0xC6, 0x01, 0xE5, 0x00, 0xD4, 0x00,
+    0xC5, 0x00, 0xD4, 0x00, 0xC5, 0x00, 0xC6, 0x00, 0xE5, 0x00, 0x5C, 0x9A,
+    0xC5, 0x00, 0x03, 0x53, 0x32, 0x00, 0x5E, 0xCC, 0x93, 0x05, 0xC2, 0x39,
+    0xC1, 0x5B, 0x00, 0x1B, 0x6C, 0xEA, 0xA0, 0x99, 0x8C, 0x44, 0x08, 0xA5,
+    0xB0, 0x00, 0x98, 0x5B, 0x00, 0x4D, 0x35, 0xC4, 0x6C, 0x90, 0x3A, 0xA8,
+    0x40, 0x00, 0x00, 0x00, 0xB5, 0x00, 0x09, 0xAE, 0xC3, 0x03, 0x65, 0xB6,
+    0x05, 0xC9, 0xAD, 0x50, 0xC6, 0x01, 0xE5, 0x0D, 0x40, 0x0C, 0x50, 0xD4,
+    0x00, 0xC5, 0x0C, 0x60, 0x0E, 0x50, 0x5C, 0x9A, 0xD5, 0x00, 0x35, 0x33,
+    0x20, 0x05, 0x88, 0x50, 0x03, 0x55, 0x30, 0xFD, 0xCC, 0xC4, 0xD5, 0x22,
+    0x21, 0xD3, 0x00, 0x00, 0xEB, 0xAA, 0xA3, 0xE7, 0x44, 0x41, 0xD3, 0x00,
+    0x00, 0xD3, 0x00, 0x00, 0xE7, 0x44, 0x41, 0xAA, 0xAA, 0xA3, 0x05, 0x88,
+    0x50, 0x03, 0x55, 0x30, 0x28, 0xBC, 0x92, 0x89, 0x22, 0x89, 0xD8, 0x55,
+    0x7E, 0xEA, 0x88, 0x88, 0xC6, 0x00, 0x00, 0x6C, 0x54, 0x66, 0x03, 0x9A,
+    0x83, 0x08, 0x33, 0x80, 0x03, 0xBB, 0x30, 0x55, 0x55, 0x52, 0xEB, 0x99,
+    0x93, 0xD3, 0x00, 0x00, 0xD3, 0x00, 0x00, 0xFD, 0xCC, 0xC4, 0xD5, 0x22,
+    0x21, 0xD3, 0x00, 0x00, 0xD3, 0x00, 0x00, 0xEB, 0x99, 0x93, 0x55, 0x55,
+    0x52, 0x08, 0x33, 0x80, 0x03, 0xBB, 0x30, 0x02, 0x45, 0x20, 0x3B, 0x99,
+    0xB4, 0xA6, 0x00, 0x5C, 0xEB, 0xAA, 0xBE, 0xD6, 0x33, 0x33, 0xB7, 0x00,
+    0x00, 0x3B, 0xA9, 0xA7, 0x01, 0x45, 0x42, 0x00, 0x48, 0x00, 0x00, 0x13,
+    0x00, 0xFD, 0xCC, 0xC4, 0xD5, 0x22, 0x21, 0xD3, 0x00, 0x00, 0xEB, 0xAA,
+    0xA3, 0xE7, 0x44, 0x41, 0xD3, 0x00, 0x00, 0xD3, 0x00, 0x00, 0xE7, 0x44,
+    0x41, 0xAA, 0xAA, 0xA3, 0x00, 0x48, 0x00, 0x00, 0x13, 0x00, 0x28, 0xBC,
+    0x92, 0x89, 0x22, 0x89, 0xD8, 0x55, 0x7E, 0xEA, 0x88, 0x88, 0xC6, 0x00,
+    0x00, 0x6C, 0x54, 0x66, 0x03, 0x9A, 0x83, 0xFD, 0xCC, 0xC4, 0xD5, 0x22,
+    0x21, 0xD3, 0x00, 0x00, 0xEB, 0xAA, 0xA3, 0xE7, 0x44, 0x41, 0xD3, 0x00,
+    0x00, 0xD3, 0x00, 0x00, 0xE7, 0x44, 0x41, 0xAA, 0xAD, 0xB3, 0x00, 0x39,
+    0x10, 0x00, 0x39, 0x62, 0x00, 0x03, 0x51, 0x28, 0xBC, 0x92, 0x89, 0x22,
+    0x89, 0xD8, 0x55, 0x7E, 0xEA, 0x88, 0x88, 0xC6, 0x00, 0x00, 0x6C, 0x54,
+    0x66, 0x03, 0x9A, 0xB4, 0x00, 0x06, 0x71, 0x00, 0x05, 0x86, 0x00, 0x00,
+    0x45, 0x06, 0x88, 0x60, 0x01, 0xCC, 0x10, 0x55, 0x55, 0x52, 0xEB, 0x99,
+    0x93, 0xD3, 0x00, 0x00, 0xD3, 0x00, 0x00, 0xFD, 0xCC, 0xC4, 0xD5, 0x22,
+    0x21, 0xD3, 0x00, 0x00, 0xD3, 0x00, 0x00, 0xEB, 0x99, 0x93, 0x55, 0x55,
+    0x52, 0x06, 0x88, 0x60, 0x01, 0xCC, 0x10, 0x02, 0x45, 0x20, 0x3B, 0x99,
+    0xB4, 0xA6, 0x00, 0x5C, 0xEB, 0xAA, 0xBE, 0xD6, 0x33, 0x33, 0xB7, 0x00,
+    0x00, 0x3B, 0xA9, 0xA7, 0x01, 0x45, 0x42, 0x00, 0x4C, 0x80, 0x00, 0x95,
+    0xA3, 0x01, 0x45, 0x42, 0x18, 0xCA, 0xB8, 0x7C, 0x10, 0x00, 0xC6, 0x00,
+    0x00, 0xD4, 0x07, 0xDF, 0xD4, 0x01, 0x5D, 0xC6, 0x00, 0x3D, 0x8B, 0x00,
+    0x3D, 0x19, 0xCA, 0xBC, 0x01, 0x45, 0x43, 0x00, 0x4C, 0x80, 0x00, 0x00,
+    0x95, 0xA3, 0x00, 0x01, 0x45, 0x55, 0x40, 0x2A, 0x87, 0xCD, 0x40, 0x5B,
+    0x00, 0x3D, 0x00, 0x3C, 0x31, 0x7B, 0x00, 0x06, 0xCA, 0x71, 0x00, 0x09,
+    0x60, 0x00, 0x00, 0x27, 0xCC, 0xCB, 0x30, 0xA6, 0x22, 0x28, 0x90, 0xC6,
+    0x11, 0x3A, 0x70, 0x5A, 0xBB, 0xB8, 0x10, 0x00, 0xA2, 0x74, 0x00, 0x7B,
+    0x81, 0x01, 0x45, 0x42, 0x18, 0xCA, 0xB8, 0x7C, 0x10, 0x00, 0xC6, 0x00,
+    0x00, 0xD4, 0x07, 0xDF, 0xD4, 0x01, 0x5D, 0xC6, 0x00, 0x3D, 0x8B, 0x00,
+    0x3D, 0x19, 0xCA, 0xBC, 0x01, 0x45, 0x43, 0x00, 0xA2, 0x74, 0x00, 0x00,
+    0x7B, 0x81, 0x00, 0x01, 0x45, 0x55, 0x40, 0x2A, 0x87, 0xCD, 0x40, 0x5B,
+    0x00, 0x3D, 0x00, 0x3C, 0x31, 0x7B, 0x00, 0x06, 0xCA, 0x71, 0x00, 0x09,
+    0x60, 0x00, 0x00, 0x27, 0xCC, 0xCB, 0x30, 0xA6, 0x22, 0x28, 0x90, 0xC6,
+    0x11, 0x3A, 0x70, 0x5A, 0xBB, 0xB8, 0x10, 0x00, 0x08, 0x40, 0x00, 0x03,
+    0x10, 0x05, 0xBC, 0xC7, 0x4D, 0x53, 0x33, 0xB7, 0x00, 0x00, 0xD4, 0x06,
+    0xAA, 0xE4, 0x03, 0x7E, 0xD4, 0x00, 0x3D, 0x99, 0x00, 0x3D, 0x3C, 0x85,
+    0x8E, 0x02, 0x8A, 0x85, 0x00, 0x08, 0x40, 0x00, 0x00, 0x03, 0x10, 0x00,
+    0x17, 0xAB, 0xDE, 0x70, 0x4C, 0x21, 0x6C, 0x00, 0x4C, 0x21, 0x5C, 0x00,
+    0x18, 0xCA, 0xA5, 0x00, 0x08, 0x70, 0x00, 0x00, 0x07, 0xCA, 0xA7, 0x10,
+    0x88, 0x43, 0x4A, 0x80, 0xC3, 0x00, 0x07, 0x90, 0x8B, 0x88, 0xAB, 0x20,
+    0x13, 0x55, 0x42, 0x00, 0x05, 0xBC, 0xC7, 0x4D, 0x53, 0x33, 0xB7, 0x00,
+    0x00, 0xD4, 0x06, 0xAA, 0xE4, 0x03, 0x7E, 0xD4, 0x00, 0x3D, 0x99, 0x00,
+    0x3D, 0x3C, 0x85, 0x8E, 0x02, 0x8A, 0x85, 0x00, 0x28, 0x00, 0x00, 0x47,
+    0x00, 0x00, 0x12, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x08, 0x50, 0x00,
+    0x01, 0x45, 0x55, 0x40, 0x2A, 0x87, 0xCD, 0x40, 0x5B, 0x00, 0x3D, 0x00,
+    0x3C, 0x31, 0x7B, 0x00, 0x06, 0xCA, 0x71, 0x00, 0x09, 0x60, 0x00, 0x00,
+    0x27, 0xCC, 0xCB, 0x30, 0xA6, 0x22, 0x28, 0x90, 0xC6, 0x11, 0x3A, 0x70,
+    0x5A, 0xBB, 0xB8, 0x10, 0x01, 0xCC, 0x10, 0x06, 0x88, 0x60, 0x41, 0x00,
+    0x14, 0xD3, 0x00, 0x3D, 0xD3, 0x00, 0x3D, 0xD3, 0x00, 0x3D, 0xFD, 0xCC,
+    0xDF, 0xD5, 0x22, 0x5D, 0xD3, 0x00, 0x3D, 0xD3, 0x00, 0x3D, 0xD3, 0x00,
+    0x3D, 0x41, 0x00, 0x14, 0x01, 0xCC, 0x10, 0x06, 0x88, 0x60, 0x41, 0x00,
+    0x00, 0xD3, 0x00, 0x00, 0xD3, 0x00, 0x00, 0xD6, 0x99, 0x30, 0xFB, 0x46,
+    0xC3, 0xE5, 0x00, 0xC5, 0xD3, 0x00, 0xB5, 0xD3, 0x00, 0xB5, 0xD3, 0x00,
+    0xB5, 0xD3, 0x00, 0xB5, 0x0A, 0x60, 0x00, 0xB5, 0x05, 0xDC, 0xAA, 0xAE,
+    0xC1, 0x2B, 0x94, 0x44, 0xC8, 0x00, 0xAC, 0xAA, 0xAE, 0x50, 0x0A, 0x94,
+    0x44, 0xC5, 0x00, 0xA6, 0x00, 0x0B, 0x50, 0x0A, 0x60, 0x00, 0xB5, 0x00,
+    0xA6, 0x00, 0x0B, 0x50, 0x07, 0x40, 0x00, 0x83, 0x00, 0x0A, 0x60, 0x00,
+    0x06, 0xDC, 0xA8, 0x10, 0x1B, 0x85, 0x63, 0x00, 0xAB, 0xA9, 0xC4, 0x0A,
+    0x90, 0x08, 0x90, 0xA7, 0x00, 0x6A, 0x0A, 0x60, 0x06, 0xA0, 0xA6, 0x00,
+    0x6A, 0x0A, 0x60, 0x06, 0xA0, 0x32, 0x00, 0x23, 0x03, 0x30, 0x22, 0x39,
+    0xA8, 0x84, 0x33, 0x17, 0x61, 0x5A, 0xAA, 0x92, 0x13, 0xC7, 0x20, 0x00,
+    0xB5, 0x00, 0x00, 0xB5, 0x00, 0x00, 0xB5, 0x00, 0x00, 0xB5, 0x00, 0x00,
+    0xB5, 0x00, 0x12, 0xC6, 0x10, 0x5C, 0xED, 0xA2, 0x03, 0x30, 0x22, 0x39,
+    0xA8, 0x84, 0x33, 0x17, 0x61, 0x18, 0xA7, 0x00, 0x01, 0x6B, 0x00, 0x00,
+    0x5B, 0x00, 0x00, 0x5B, 0x00, 0x00, 0x5B, 0x00, 0x01, 0x6B, 0x10, 0x4B,
+    0xCE, 0xB8, 0x05, 0x88, 0x50, 0x03, 0x55, 0x30, 0x5C, 0xED, 0xA2, 0x12,
+    0xC6, 0x10, 0x00, 0xB5, 0x00, 0x00, 0xB5, 0x00, 0x00, 0xB5, 0x00, 0x00,
+    0xB5, 0x00, 0x00, 0xB5, 0x00, 0x13, 0xC7, 0x20, 0x5A, 0xAA, 0x92, 0x05,
+    0x88, 0x50, 0x03, 0x55, 0x30, 0x18, 0xCB, 0x00, 0x00, 0x6B, 0x00, 0x00,
+    0x5B, 0x00, 0x00, 0x5B, 0x00, 0x00, 0x5B, 0x00, 0x01, 0x6C, 0x21, 0x3A,
+    0xAA, 0xA8, 0x08, 0x33, 0x80, 0x03, 0xBB, 0x30, 0x25, 0x55, 0x41, 0x48,
+    0xDB, 0x71, 0x00, 0xB5, 0x00, 0x00, 0xB5, 0x00, 0x00, 0xB5, 0x00, 0x00,
+    0xB5, 0x00, 0x00, 0xB5, 0x00, 0x00, 0xB5, 0x00, 0x48, 0xDB, 0x71, 0x25,
+    0x55, 0x41, 0x00, 0xA2, 0x74, 0x00, 0x7B, 0x81, 0x14, 0x54, 0x00, 0x15,
+    0xAB, 0x00, 0x00, 0x5B, 0x00, 0x00, 0x5B, 0x00, 0x00, 0x5B, 0x00, 0x00,
+    0x5B, 0x00, 0x26, 0xAD, 0x75, 0x25, 0x55, 0x54, 0x5C, 0xED, 0xA2, 0x12,
+    0xC6, 0x10, 0x00, 0xB5, 0x00, 0x00, 0xB5, 0x00, 0x00, 0xB5, 0x00, 0x00,
+    0xB5, 0x00, 0x00, 0xB5, 0x00, 0x13, 0xC7, 0x20, 0x5A, 0xCD, 0x92, 0x00,
+    0x94, 0x00, 0x00, 0x87, 0x40, 0x00, 0x25, 0x30, 0x00, 0x59, 0x00, 0x00,
+    0x23, 0x00, 0x14, 0x54, 0x00, 0x15, 0xAB, 0x00, 0x00, 0x5B, 0x00, 0x00,
+    0x5B, 0x00, 0x00, 0x5B, 0x00, 0x00, 0x5B, 0x00, 0x26, 0xAD, 0x75, 0x25,
+    0x9B, 0x54, 0x00, 0xA3, 0x00, 0x00, 0x7A, 0x60, 0x00, 0x48, 0x00, 0x00,
+    0x13, 0x00, 0x5C, 0xED, 0xA2, 0x12, 0xC6, 0x10, 0x00, 0xB5, 0x00, 0x00,
+    0xB5, 0x00, 0x00, 0xB5, 0x00, 0x00, 0xB5, 0x00, 0x00, 0xB5, 0x00, 0x13,
+    0xC7, 0x20, 0x5A, 0xAA, 0x92, 0x18, 0xCB, 0x00, 0x00, 0x6B, 0x00, 0x00,
+    0x5B, 0x00, 0x00, 0x5B, 0x00, 0x00, 0x5B, 0x00, 0x01, 0x6C, 0x21, 0x3A,
+    0xAA, 0xA8, 0xD3, 0x00, 0x3D, 0xD3, 0x00, 0x3D, 0xD3, 0x00, 0x3D, 0xD3,
+    0x00, 0x3D, 0xD3, 0x00, 0x3D, 0xD3, 0x00, 0x3D, 0xD3, 0x00, 0x4D, 0xD3,
+    0x64, 0xAA, 0x92, 0x8A, 0x61, 0x59, 0x00, 0xA4, 0x23, 0x00, 0x31, 0x24,
+    0x03, 0x52, 0x5B, 0x04, 0xD5, 0x5B, 0x00, 0xB5, 0x5B, 0x00, 0xB5, 0x5B,
+    0x00, 0xB5, 0x5B, 0x00, 0xB5, 0x5B, 0x00, 0xB5, 0x24, 0x00, 0xB5, 0x00,
+    0x12, 0xC4, 0x00, 0x4B, 0xA1, 0x00, 0x01, 0xCC, 0x10, 0x00, 0x68, 0x86,
+    0x00, 0x00, 0x42, 0x00, 0x00, 0x0B, 0x50, 0x00, 0x00, 0xB5, 0x00, 0x00,
+    0x0B, 0x50, 0x00, 0x00, 0xB5, 0x00, 0x00, 0x0B, 0x50, 0x00, 0x00, 0xC5,
+    0x00, 0x00, 0x2D, 0x40, 0xBA, 0xAC, 0x70, 0x04, 0x55, 0x30, 0x00, 0x01,
+    0xCC, 0x10, 0x68, 0x86, 0x25, 0x55, 0x02, 0x69, 0xE0, 0x00, 0x3D, 0x00,
+    0x03, 0xD0, 0x00, 0x3D, 0x00, 0x03, 0xD0, 0x00, 0x3D, 0x00, 0x03, 0xD0,
+    0x32, 0x6C, 0x0B, 0xBB, 0x50, 0xD3, 0x01, 0x9A, 0x0D, 0x30, 0x7A, 0x20,
+    0xD3, 0x7A, 0x10, 0x0D, 0x7B, 0x20, 0x00, 0xEB, 0xB4, 0x00, 0x0E, 0x45,
+    0xB0, 0x00, 0xD3, 0x08, 0x91, 0x0D, 0x30, 0x1C, 0x50, 0x92, 0x00, 0x49,
+    0x00, 0x06, 0x30, 0x00, 0x00, 0x92, 0x00, 0x00, 0x03, 0x00, 0x00, 0xD3,
+    0x00, 0x00, 0xD3, 0x00, 0x00, 0xD3, 0x01, 0x41, 0xD3, 0x19, 0x71, 0xD4,
+    0x96, 0x00, 0xDA, 0x70, 0x00, 0xE9, 0xA3, 0x00, 0xD3, 0x5A, 0x10, 0xD3,
+    0x04, 0xB2, 0x41, 0x00, 0x42, 0x00, 0x94, 0x00, 0x00, 0x91, 0x00, 0xD3,
+    0x06, 0xA2, 0xD3, 0x5A, 0x20, 0xD6, 0xA2, 0x00, 0xED, 0x91, 0x00, 0xD4,
+    0x88, 0x00, 0xD3, 0x19, 0x70, 0x92, 0x00, 0x84, 0x1B, 0x60, 0x00, 0x4A,
+    0x10, 0x00, 0x41, 0x00, 0x00, 0xD3, 0x00, 0x00, 0xD3, 0x00, 0x00, 0xD3,
+    0x00, 0x00, 0xD3, 0x00, 0x00, 0xD3, 0x00, 0x00, 0xD3, 0x00, 0x00, 0xD3,
+    0x00, 0x00, 0xEB, 0x99, 0x93, 0x55, 0x55, 0x52, 0x00, 0x1B, 0x60, 0x00,
+    0x4A, 0x10, 0x14, 0x54, 0x00, 0x15, 0xAB, 0x00, 0x00, 0x5B, 0x00, 0x00,
+    0x5B, 0x00, 0x00, 0x5B, 0x00, 0x00, 0x5B, 0x00, 0x00, 0x5B, 0x00, 0x00,
+    0x5B, 0x00, 0x01, 0x6B, 0x10, 0x4B, 0xCE, 0xB8, 0xD3, 0x00, 0x00, 0xD3,
+    0x00, 0x00, 0xD3, 0x00, 0x00, 0xD3, 0x00, 0x00, 0xD3, 0x00, 0x00, 0xD3,
+    0x00, 0x00, 0xD3, 0x00, 0x00, 0xE7, 0x44, 0x41, 0xAA, 0xAA, 0xA3, 0x00,
+    0x63, 0x00, 0x00, 0x92, 0x00, 0x00, 0x30, 0x00, 0x18, 0xCB, 0x00, 0x00,
+    0x6B, 0x00, 0x00, 0x5B, 0x00, 0x00, 0x5B, 0x00, 0x00, 0x5B, 0x00, 0x00,
+    0x5B, 0x00, 0x00, 0x5B, 0x00, 0x00, 0x5B, 0x00, 0x26, 0xAD, 0x75, 0x25,
+    0x55, 0x54, 0x00, 0x3A, 0x00, 0x00, 0x46, 0x00, 0xD3, 0x06, 0x80, 0xD3,
+    0x08, 0x20, 0xD3, 0x00, 0x00, 0xD3, 0x00, 0x00, 0xD3, 0x00, 0x00, 0xD3,
+    0x00, 0x00, 0xD3, 0x00, 0x00, 0xE7, 0x44, 0x41, 0xAA, 0xAA, 0xA3, 0x18,
+    0xCB, 0x3B, 0x00, 0x6B, 0x46, 0x00, 0x5B, 0x00, 0x00, 0x5B, 0x00, 0x00,
+    0x5B, 0x00, 0x00, 0x5B, 0x00, 0x00, 0x5B, 0x00, 0x00, 0x5B, 0x00, 0x26,
+    0xAD, 0x75, 0x25, 0x55, 0x54, 0xD3, 0x00, 0x00, 0xD3, 0x00, 0x00, 0xD3,
+    0x03, 0x10, 0xD3, 0x08, 0x40, 0xD3, 0x00, 0x00, 0xD3, 0x00, 0x00, 0xD3,
+    0x00, 0x00, 0xE7, 0x44, 0x41, 0xAA, 0xAA, 0xA3, 0x18, 0xCB, 0x00, 0x00,
+    0x6B, 0x00, 0x00, 0x5B, 0x00, 0x00, 0x5B, 0x00, 0x00, 0x5B, 0x48, 0x00,
+    0x5B, 0x13, 0x00, 0x5B, 0x00, 0x00, 0x5B, 0x00, 0x26, 0xAD, 0x75, 0x25,
+    0x55, 0x54, 0x0A, 0x60, 0x00, 0x00, 0xA6, 0x00, 0x00, 0x0A, 0x61, 0x20,
+    0x00, 0xAA, 0xA5, 0x00, 0x3C, 0xB3, 0x00, 0x09, 0xD6, 0x00, 0x00, 0x0A,
+    0x60, 0x00, 0x00, 0xA9, 0x44, 0x43, 0x07, 0xAA, 0xAA, 0x70, 0x18, 0xCB,
+    0x00, 0x00, 0x6B, 0x00, 0x00, 0x5B, 0x00, 0x00, 0x5B, 0x62, 0x00, 0x7E,
+    0x40, 0x04, 0xAB, 0x00, 0x00, 0x5B, 0x00, 0x00, 0x5B, 0x00, 0x26, 0xAD,
+    0x75, 0x25, 0x55, 0x54, 0x00, 0x1B, 0x60, 0x00, 0x4A, 0x10, 0x52, 0x00,
+    0x14, 0xF8, 0x00, 0x3D, 0xDC, 0x20, 0x3D, 0xC7, 0x90, 0x3D, 0xD3, 0xA5,
+    0x3D, 0xD3, 0x5A, 0x3D, 0xD3, 0x09, 0x7C, 0xD3, 0x02, 0xDE, 0xD3, 0x00,
+    0x8F, 0x41, 0x00, 0x25, 0x00, 0x1B, 0x60, 0x00, 0x4A, 0x10, 0x42, 0x44,
+    0x20, 0xDB, 0x9A, 0xA2, 0xF6, 0x00, 0xC4, 0xD3, 0x00, 0xB5, 0xD3, 0x00,
+    0xB5, 0xD3, 0x00, 0xB5, 0xD3, 0x00, 0xB5, 0x41, 0x00, 0x42, 0xF6, 0x00,
+    0x3D, 0xEC, 0x00, 0x3D, 0xC9, 0x70, 0x3D, 0xC4, 0xB2, 0x3D, 0xD3, 0x68,
+    0x3D, 0xD3, 0x2B, 0x5C, 0xD3, 0x04, 0xCD, 0xD3, 0x00, 0xBF, 0x82, 0x00,
+    0x3A, 0x00, 0x63, 0x00, 0x00, 0x92, 0x00, 0x00, 0x30, 0x00, 0xD8, 0xBC,
+    0x81, 0xF9, 0x23, 0xC4, 0xE4, 0x00, 0xB5, 0xD3, 0x00, 0xB5, 0xD3, 0x00,
+    0xB5, 0xD3, 0x00, 0xB5, 0x92, 0x00, 0x73, 0x00, 0x63, 0x00, 0x00, 0x92,
+    0x00, 0x00, 0x30, 0x00, 0x06, 0x88, 0x60, 0x01, 0xCC, 0x10, 0x52, 0x00,
+    0x14, 0xF8, 0x00, 0x3D, 0xDC, 0x20, 0x3D, 0xC7, 0x90, 0x3D, 0xD3, 0xA5,
+    0x3D, 0xD3, 0x5A, 0x3D, 0xD3, 0x09, 0x7C, 0xD3, 0x02, 0xDE, 0xD3, 0x00,
+    0x8F, 0x41, 0x00, 0x25, 0x06, 0x88, 0x60, 0x01, 0xCC, 0x10, 0x42, 0x44,
+    0x20, 0xDB, 0x9A, 0xA2, 0xF6, 0x00, 0xC4, 0xD3, 0x00, 0xB5, 0xD3, 0x00,
+    0xB5, 0xD3, 0x00, 0xB5, 0xD3, 0x00, 0xB5, 0x41, 0x00, 0x42, 0x6C, 0x00,
+    0x00, 0x0A, 0x70, 0x00, 0x00, 0x75, 0x23, 0x53, 0x00, 0xAB, 0xA9, 0xC3,
+    0x0A, 0xA1, 0x08, 0x90, 0xA7, 0x00, 0x6A, 0x0A, 0x60, 0x06, 0xA0, 0xA6,
+    0x00, 0x6A, 0x0A, 0x60, 0x06, 0xA0, 0x32, 0x00, 0x23, 0xF7, 0x00, 0x3D,
+    0xEC, 0x10, 0x3D, 0xC9, 0x80, 0x3D, 0xC3, 0xB3, 0x3D, 0xD3, 0x5A, 0x3D,
+    0xD3, 0x1A, 0x7C, 0xD3, 0x03, 0xDE, 0xD3, 0x00, 0x9F, 0x82, 0x00, 0x3D,
+    0x00, 0x25, 0x8A, 0x00, 0x39, 0x72, 0xD8, 0xBC, 0x81, 0xF9, 0x23, 0xC4,
+    0xE4, 0x00, 0xB5, 0xD3, 0x00, 0xB5, 0xD3, 0x00, 0xB5, 0xD3, 0x00, 0xB5,
+    0x92, 0x00, 0xB5, 0x00, 0x00, 0xB5, 0x00, 0x39, 0xB3, 0x00, 0x25, 0x30,
+    0x05, 0x88, 0x50, 0x03, 0x55, 0x30, 0x18, 0xCC, 0x81, 0x7C, 0x33, 0xB6,
+    0xC6, 0x00, 0x5C, 0xD4, 0x00, 0x4D, 0xE4, 0x00, 0x4E, 0xD4, 0x00, 0x4D,
+    0xA8, 0x00, 0x8A, 0x5D, 0x66, 0xC5, 0x04, 0x99, 0x30, 0x05, 0x88, 0x50,
+    0x03, 0x55, 0x30, 0x29, 0xCC, 0x82, 0x8A, 0x22, 0xA8, 0xD4, 0x00, 0x4D,
+    0xD4, 0x00, 0x4D, 0xC5, 0x00, 0x5C, 0x6C, 0x55, 0xC6, 0x04, 0x99, 0x40,
+    0x08, 0x33, 0x80, 0x03, 0xBB, 0x30, 0x02, 0x55, 0x20, 0x3B, 0xBB, 0xB2,
+    0x99, 0x00, 0x99, 0xD5, 0x00, 0x5C, 0xE4, 0x00, 0x4D, 0xE4, 0x00, 0x4D,
+    0xD5, 0x00, 0x5C, 0x99, 0x00, 0x99, 0x3B, 0xBB, 0xA2, 0x02, 0x55, 0x20,
+    0x08, 0x33, 0x80, 0x03, 0xBB, 0x30, 0x02, 0x55, 0x20, 0x3B, 0x99, 0xB3,
+    0xB7, 0x00, 0x7B, 0xD4, 0x00, 0x4D, 0xD4, 0x00, 0x4D, 0xB7, 0x00, 0x7B,
+    0x3B, 0x99, 0xB3, 0x02, 0x55, 0x20, 0x02, 0xD5, 0xD3, 0x07, 0x68, 0x60,
+    0x02, 0x55, 0x20, 0x3B, 0xBB, 0xB2, 0x99, 0x00, 0x99, 0xD5, 0x00, 0x5C,
+    0xE4, 0x00, 0x4D, 0xE4, 0x00, 0x4D, 0xD5, 0x00, 0x5C, 0x99, 0x00, 0x99,
+    0x3B, 0xBB, 0xA2, 0x02, 0x55, 0x20, 0x02, 0xD5, 0xD3, 0x07, 0x68, 0x60,
+    0x02, 0x55, 0x20, 0x3B, 0x99, 0xB3, 0xB7, 0x00, 0x7B, 0xD4, 0x00, 0x4D,
+    0xD4, 0x00, 0x4D, 0xB7, 0x00, 0x7B, 0x3B, 0x99, 0xB3, 0x02, 0x55, 0x20,
+    0x29, 0xCE, 0xDC, 0x87, 0xA3, 0xB8, 0x21, 0xC5, 0x0A, 0x60, 0x0D, 0x40,
+    0xAC, 0xA7, 0xD3, 0x0A, 0x94, 0x3D, 0x40, 0xA6, 0x00, 0xB6, 0x0A, 0x60,
+    0x06, 0xC5, 0xC9, 0x43, 0x05, 0xAA, 0xAA, 0x70, 0x4B, 0xB6, 0x9C, 0x81,
+    0xA7, 0x4B, 0xA3, 0xB3, 0xD3, 0x0A, 0xA5, 0xC5, 0xD3, 0x0A, 0xB8, 0x83,
+    0xB4, 0x1B, 0x80, 0x00, 0x89, 0x6B, 0xC6, 0x62, 0x17, 0x82, 0x49, 0x71,
+    0x00, 0x1B, 0x60, 0x00, 0x00, 0x4A, 0x10, 0x00, 0x55, 0x54, 0x20, 0x00,
+    0xEA, 0x9A, 0xC6, 0x00, 0xD3, 0x00, 0x6D, 0x00, 0xD3, 0x00, 0x5D, 0x00,
+    0xE7, 0x57, 0xB6, 0x00, 0xEA, 0xAE, 0x50, 0x00, 0xD3, 0x07, 0xB2, 0x00,
+    0xD3, 0x01, 0xB8, 0x00, 0xD3, 0x00, 0x2C, 0x40, 0x41, 0x00, 0x03, 0x30,
+    0x00, 0x7B, 0x00, 0x0B, 0x40, 0x41, 0x45, 0x2C, 0x99, 0x96, 0xF6, 0x00,
+    0x0D, 0x30, 0x00, 0xD3, 0x00, 0x0D, 0x30, 0x00, 0xD3, 0x00, 0x04, 0x10,
+    0x00, 0xFD, 0xCC, 0xA3, 0x00, 0xD5, 0x23, 0x9B, 0x00, 0xD3, 0x00, 0x4D,
+    0x00, 0xD3, 0x02, 0xAA, 0x00, 0xFD, 0xDF, 0x71, 0x00, 0xD5, 0x3B, 0x80,
+    0x00, 0xD3, 0x01, 0xC6, 0x00, 0xD3, 0x00, 0x5C, 0x10, 0x92, 0x00, 0x06,
+    0x60, 0x00, 0x28, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x12, 0x00,
+    0x00, 0xC6, 0xBC, 0x6E, 0x92, 0x22, 0xE4, 0x00, 0x0D, 0x30, 0x00, 0xD3,
+    0x00, 0x0D, 0x30, 0x00, 0x92, 0x00, 0x06, 0x30, 0x00, 0x92, 0x00, 0x03,
+    0x00, 0x00, 0x06, 0x88, 0x60, 0x00, 0x01, 0xCC, 0x10, 0x00, 0x55, 0x54,
+    0x20, 0x00, 0xEA, 0x9A, 0xC6, 0x00, 0xD3, 0x00, 0x6D, 0x00, 0xD3, 0x00,
+    0x5D, 0x00, 0xE7, 0x57, 0xB6, 0x00, 0xEA, 0xAE, 0x50, 0x00, 0xD3, 0x07,
+    0xB2, 0x00, 0xD3, 0x01, 0xB8, 0x00, 0xD3, 0x00, 0x2C, 0x40, 0x41, 0x00,
+    0x03, 0x30, 0x3A, 0x6A, 0x00, 0x8C, 0x40, 0x41, 0x45, 0x2C, 0x99, 0x96,
+    0xF6, 0x00, 0x0D, 0x30, 0x00, 0xD3, 0x00, 0x0D, 0x30, 0x00, 0xD3, 0x00,
+    0x04, 0x10, 0x00, 0x00, 0x1B, 0x60, 0x00, 0x4A, 0x10, 0x03, 0x45, 0x43,
+    0x6C, 0xAA, 0xBA, 0xD4, 0x00, 0x00, 0xC6, 0x00, 0x00, 0x4B, 0xB6, 0x20,
+    0x02, 0x59, 0xC5, 0x00, 0x00, 0x5D, 0x00, 0x00, 0x5D, 0xCA, 0x9A, 0xC5,
+    0x34, 0x55, 0x20, 0x00, 0x7B, 0x00, 0x0B, 0x40, 0x14, 0x54, 0x29, 0xA9,
+    0xA6, 0xD5, 0x00, 0x08, 0xC8, 0x30, 0x02, 0x8D, 0x50, 0x00, 0x79, 0xB9,
+    0x9B, 0x43, 0x55, 0x30, 0x01, 0xCC, 0x10, 0x06, 0x88, 0x60, 0x03, 0x45,
+    0x43, 0x6C, 0xAA, 0xBA, 0xD4, 0x00, 0x00, 0xC6, 0x00, 0x00, 0x4B, 0xB6,
+    0x20, 0x02, 0x59, 0xC5, 0x00, 0x00, 0x5D, 0x00, 0x00, 0x5D, 0xCA, 0x9A,
+    0xC5, 0x34, 0x55, 0x20, 0x08, 0xC4, 0x03, 0xA5, 0x90, 0x14, 0x54, 0x29,
+    0xA9, 0xA6, 0xD5, 0x00, 0x08, 0xC8, 0x30, 0x02, 0x8D, 0x50, 0x00, 0x79,
+    0xB9, 0x9B, 0x43, 0x55, 0x30, 0x4A, 0xCC, 0xC9, 0xC8, 0x33, 0x44, 0xD5,
+    0x00, 0x00, 0x8C, 0x61, 0x00, 0x03, 0xAC, 0xA3, 0x00, 0x02, 0x9B, 0x00,
+    0x00, 0x4D, 0x96, 0x45, 0xB9, 0x79, 0xBA, 0x51, 0x00, 0x68, 0x00, 0x00,
+    0x68, 0x00, 0x00, 0x41, 0x00, 0x6B, 0xBB, 0x5C, 0x52, 0x32, 0xAA, 0x41,
+    0x02, 0x6B, 0xB2, 0x00, 0x08, 0x98, 0x54, 0xB7, 0x7A, 0xC6, 0x00, 0x2A,
+    0x20, 0x03, 0x83, 0x00, 0x33, 0x00, 0x06, 0x88, 0x60, 0x01, 0xCC, 0x10,
+    0x03, 0x45, 0x43, 0x6C, 0xAA, 0xBA, 0xD4, 0x00, 0x00, 0xC6, 0x00, 0x00,
+    0x4B, 0xB6, 0x20, 0x02, 0x59, 0xC5, 0x00, 0x00, 0x5D, 0x00, 0x00, 0x5D,
+    0xCA, 0x9A, 0xC5, 0x34, 0x55, 0x20, 0x3A, 0x6A, 0x00, 0x8C, 0x40, 0x14,
+    0x54, 0x29, 0xA9, 0xA6, 0xD5, 0x00, 0x08, 0xC8, 0x30, 0x02, 0x8D, 0x50,
+    0x00, 0x79, 0xB9, 0x9B, 0x43, 0x55, 0x30, 0x9C, 0xDF, 0xCC, 0x82, 0x25,
+    0xD2, 0x21, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x3D, 0x00,
+    0x00, 0x03, 0xD0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
+    0x2C, 0x00, 0x00, 0x01, 0x94, 0x00, 0x00, 0x27, 0x60, 0x00, 0x02, 0x40,
+    0x00, 0x04, 0x40, 0x00, 0x86, 0x00, 0x9E, 0xDB, 0x81, 0xA7, 0x11, 0x0A,
+    0x60, 0x00, 0xA6, 0x00, 0x0A, 0x60, 0x00, 0x8A, 0x43, 0x01, 0x9B, 0x50,
+    0x06, 0x80, 0x00, 0x68, 0x00, 0x04, 0x10, 0x00, 0x95, 0xA3, 0x00, 0x04,
+    0xC8, 0x00, 0x45, 0x55, 0x55, 0x37, 0x9B, 0xE9, 0x96, 0x00, 0x3D, 0x00,
+    0x00, 0x03, 0xD0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
+    0x3D, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x01, 0x40,
+    0x00, 0x01, 0x10, 0xA4, 0x05, 0x50, 0x91, 0x4B, 0x95, 0x30, 0x6C, 0xA8,
+    0x50, 0x0A, 0x60, 0x00, 0x0A, 0x60, 0x00, 0x0A, 0x60, 0x00, 0x0A, 0x70,
+    0x00, 0x05, 0xC9, 0x60, 0x00, 0x45, 0x30, 0x9C, 0xDF, 0xCC, 0x82, 0x25,
+    0xD2, 0x21, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x08, 0xDF, 0xCC,
+    0x00, 0x15, 0xD2, 0x20, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
+    0x29, 0x00, 0x00, 0x04, 0x40, 0x00, 0x86, 0x00, 0x9E, 0xDB, 0x81, 0xA7,
+    0x11, 0x5E, 0xDB, 0x01, 0xA7, 0x10, 0x0A, 0x60, 0x00, 0x7B, 0x43, 0x00,
+    0x7A, 0x50, 0x03, 0x30, 0x22, 0x39, 0xA8, 0x84, 0x33, 0x17, 0x61, 0x92,
+    0x00, 0x29, 0xD3, 0x00, 0x3D, 0xD3, 0x00, 0x3D, 0xD3, 0x00, 0x3D, 0xD3,
+    0x00, 0x3D, 0xD3, 0x00, 0x3D, 0xD4, 0x00, 0x4D, 0xAA, 0x33, 0xA9, 0x3A,
+    0xCC, 0xA2, 0x03, 0x30, 0x22, 0x39, 0xA8, 0x84, 0x33, 0x17, 0x61, 0x92,
+    0x00, 0x73, 0xD3, 0x00, 0xB5, 0xD3, 0x00, 0xB5, 0xD3, 0x00, 0xB5, 0xD3,
+    0x00, 0xC5, 0xC7, 0x24, 0xE5, 0x5B, 0xB9, 0xA5, 0x05, 0x88, 0x50, 0x03,
+    0x55, 0x30, 0xD3, 0x00, 0x3D, 0xD3, 0x00, 0x3D, 0xD3, 0x00, 0x3D, 0xD3,
+    0x00, 0x3D, 0xD3, 0x00, 0x3D, 0xD3, 0x00, 0x3D, 0xD5, 0x00, 0x5C, 0x8C,
+    0x66, 0xC8, 0x15, 0x99, 0x50, 0x05, 0x88, 0x50, 0x03, 0x55, 0x30, 0xD3,
+    0x00, 0xB5, 0xD3, 0x00, 0xB5, 0xD3, 0x00, 0xB5, 0xD3, 0x00, 0xB5, 0xD3,
+    0x00, 0xD5, 0xB9, 0x48, 0xE5, 0x27, 0x96, 0x63, 0x08, 0x33, 0x80, 0x03,
+    0xBB, 0x30, 0x41, 0x00, 0x14, 0xD3, 0x00, 0x3D, 0xD3, 0x00, 0x3D, 0xD3,
+    0x00, 0x3D, 0xD3, 0x00, 0x3D, 0xD3, 0x00, 0x3D, 0xD4, 0x00, 0x4D, 0xC7,
+    0x00, 0x7C, 0x5C, 0xBA, 0xC4, 0x03, 0x55, 0x20, 0x08, 0x33, 0x80, 0x03,
+    0xBB, 0x30, 0x41, 0x00, 0x42, 0xD3, 0x00, 0xB5, 0xD3, 0x00, 0xB5, 0xD3,
+    0x00, 0xB5, 0xD3, 0x00, 0xB5, 0xD4, 0x01, 0xE5, 0x8C, 0x9A, 0xC5, 0x14,
+    0x53, 0x32, 0x00, 0x99, 0x50, 0x00, 0xA2, 0x90, 0x00, 0x59, 0x20, 0x92,
+    0x00, 0x29, 0xD3, 0x00, 0x3D, 0xD3, 0x00, 0x3D, 0xD3, 0x00, 0x3D, 0xD3,
+    0x00, 0x3D, 0xD3, 0x00, 0x3D, 0xD4, 0x00, 0x4D, 0xAA, 0x33, 0xA9, 0x3A,
+    0xCC, 0xA2, 0x05, 0x98, 0x00, 0x09, 0x2A, 0x00, 0x02, 0x95, 0x00, 0x92,
+    0x00, 0x73, 0xD3, 0x00, 0xB5, 0xD3, 0x00, 0xB5, 0xD3, 0x00, 0xB5, 0xD3,
+    0x00, 0xC5, 0xC7, 0x24, 0xE5, 0x5B, 0xB9, 0xA5, 0x02, 0xD5, 0xD3, 0x07,
+    0x68, 0x60, 0x41, 0x00, 0x14, 0xD3, 0x00, 0x3D, 0xD3, 0x00, 0x3D, 0xD3,
+    0x00, 0x3D, 0xD3, 0x00, 0x3D, 0xD3, 0x00, 0x3D, 0xD4, 0x00, 0x4D, 0xC7,
+    0x00, 0x7C, 0x5C, 0xBA, 0xC4, 0x03, 0x55, 0x20, 0x02, 0xD5, 0xD3, 0x07,
+    0x68, 0x60, 0x41, 0x00, 0x42, 0xD3, 0x00, 0xB5, 0xD3, 0x00, 0xB5, 0xD3,
+    0x00, 0xB5, 0xD3, 0x00, 0xB5, 0xD4, 0x01, 0xE5, 0x8C, 0x9A, 0xC5, 0x14,
+    0x53, 0x32, 0xD3, 0x00, 0x3D, 0xD3, 0x00, 0x3D, 0xD3, 0x00, 0x3D, 0xD3,
+    0x00, 0x3D, 0xD3, 0x00, 0x3D, 0xD3, 0x00, 0x3D, 0xD5, 0x00, 0x5C, 0x8C,
+    0x66, 0xC8, 0x15, 0xBC, 0x50, 0x00, 0x94, 0x00, 0x00, 0x87, 0x40, 0x00,
+    0x25, 0x30, 0xD3, 0x00, 0xB5, 0xD3, 0x00, 0xB5, 0xD3, 0x00, 0xB5, 0xD3,
+    0x00, 0xB5, 0xD3, 0x00, 0xD5, 0xB9, 0x48, 0xE5, 0x27, 0x96, 0x94, 0x00,
+    0x06, 0x71, 0x00, 0x05, 0x86, 0x00, 0x00, 0x45, 0x00, 0x4C, 0x80, 0x00,
+    0x00, 0x95, 0xA3, 0x00, 0x41, 0x00, 0x00, 0x32, 0xC3, 0x00, 0x00, 0xA4,
+    0xB4, 0x00, 0x00, 0xB3, 0xA5, 0x17, 0x10, 0xB3, 0x86, 0x3A, 0x70, 0xC2,
+    0x77, 0x66, 0xA2, 0xB1, 0x58, 0x92, 0x97, 0xA0, 0x4A, 0x90, 0x6B, 0x80,
+    0x3D, 0x30, 0x3C, 0x70, 0x14, 0x00, 0x14, 0x20, 0x00, 0x4C, 0x80, 0x00,
+    0x00, 0x95, 0xA3, 0x00, 0x41, 0x04, 0x10, 0x32, 0xB3, 0x2C, 0x50, 0x94,
+    0x94, 0x58, 0x90, 0xA2, 0x75, 0x84, 0xA2, 0xB1, 0x47, 0xA2, 0x86, 0x90,
+    0x38, 0x90, 0x5A, 0x60, 0x2B, 0x50, 0x2C, 0x30, 0x04, 0x10, 0x04, 0x10,
+    0x00, 0x4C, 0x80, 0x00, 0x09, 0x5A, 0x30, 0x33, 0x00, 0x03, 0x26, 0xB0,
+    0x02, 0xB4, 0x1B, 0x40, 0x6B, 0x00, 0x5A, 0x1B, 0x50, 0x00, 0xB9, 0xA1,
+    0x00, 0x06, 0xE4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
+    0x3D, 0x00, 0x00, 0x01, 0x40, 0x00, 0x01, 0xCC, 0x10, 0x06, 0x88, 0x60,
+    0x41, 0x00, 0x14, 0xA6, 0x00, 0x6A, 0x5B, 0x00, 0xB5, 0x2C, 0x21, 0xC2,
+    0x08, 0x77, 0x80, 0x03, 0xBB, 0x30, 0x00, 0xBC, 0x00, 0x00, 0x97, 0x00,
+    0x23, 0xB2, 0x00, 0xBC, 0x50, 0x00, 0x00, 0xA2, 0x84, 0x00, 0x03, 0x13,
+    0x10, 0x7A, 0x00, 0x1B, 0x63, 0xC2, 0x04, 0xC1, 0x07, 0x90, 0xA6, 0x00,
+    0x1C, 0x5C, 0x20, 0x00, 0x7E, 0x60, 0x00, 0x04, 0xE1, 0x00, 0x00, 0x3D,
+    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x1B, 0x60,
+    0x00, 0x4A, 0x10, 0x55, 0x55, 0x55, 0x99, 0x99, 0xBE, 0x00, 0x01, 0xB5,
+    0x00, 0x07, 0x91, 0x00, 0x5B, 0x10, 0x01, 0xB5, 0x00, 0x19, 0x70, 0x00,
+    0x5B, 0x10, 0x00, 0xEB, 0x99, 0x99, 0x55, 0x55, 0x55, 0x00, 0x7B, 0x00,
+    0x0B, 0x40, 0x55, 0x55, 0x38, 0x88, 0xC9, 0x00, 0x4B, 0x10, 0x0B, 0x60,
+    0x18, 0x80, 0x04, 0xB1, 0x00, 0xDA, 0x88, 0x55, 0x55, 0x53, 0x00, 0x48,
+    0x00, 0x00, 0x13, 0x00, 0xCC, 0xCC, 0xDE, 0x22, 0x22, 0xA9, 0x00, 0x05,
+    0xB1, 0x00, 0x2C, 0x30, 0x00, 0xA7, 0x00, 0x05, 0xA1, 0x00, 0x4C, 0x20,
+    0x00, 0xBA, 0x44, 0x44, 0xAA, 0xAA, 0xAA, 0x00, 0xA2, 0x00, 0x03, 0x10,
+    0xBB, 0xBD, 0x91, 0x13, 0xC4, 0x00, 0x98, 0x00, 0x4B, 0x20, 0x3B, 0x20,
+    0x0A, 0x93, 0x32, 0xAA, 0xAA, 0x70, 0x06, 0x88, 0x60, 0x01, 0xCC, 0x10,
+    0x55, 0x55, 0x55, 0x99, 0x99, 0xBE, 0x00, 0x01, 0xB5, 0x00, 0x07, 0x91,
+    0x00, 0x5B, 0x10, 0x01, 0xB5, 0x00, 0x19, 0x70, 0x00, 0x5B, 0x10, 0x00,
+    0xEB, 0x99, 0x99, 0x55, 0x55, 0x55, 0x3A, 0x6A, 0x00, 0x8C, 0x40, 0x55,
+    0x55, 0x38, 0x88, 0xC9, 0x00, 0x4B, 0x10, 0x0B, 0x60, 0x18, 0x80, 0x04,
+    0xB1, 0x00, 0xDA, 0x88, 0x55, 0x55, 0x53, 0x6C, 0xCA, 0xC6, 0x22, 0xD3,
+    0x00, 0xD3, 0x00, 0xD3, 0x00, 0xD3, 0x00, 0xD3, 0x00, 0xD3, 0x00, 0xD3,
+    0x00, 0x41, 0x00, 0x4A, 0xCC, 0xC9, 0xC8, 0x33, 0x44, 0xD5, 0x00, 0x00,
+    0x8C, 0x61, 0x00, 0x03, 0xAC, 0xA3, 0x00, 0x02, 0x9B, 0x00, 0x00, 0x4D,
+    0x96, 0x45, 0xB9, 0x79, 0xA9, 0x51, 0x00, 0x28, 0x00, 0x00, 0x47, 0x00,
+    0x00, 0x12, 0x00, 0x6B, 0xBB, 0x5C, 0x52, 0x32, 0xAA, 0x41, 0x02, 0x6B,
+    0xB2, 0x00, 0x08, 0x98, 0x54, 0xB7, 0x79, 0x96, 0x00, 0x36, 0x00, 0x07,
+    0x40, 0x00, 0x30, 0x00, 0x9C, 0xDF, 0xCC, 0x82, 0x25, 0xD2, 0x21, 0x00,
+    0x3D, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xD0,
+    0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x29, 0x00, 0x00,
+    0x02, 0x80, 0x00, 0x00, 0x47, 0x00, 0x00, 0x01, 0x20, 0x00, 0x04, 0x40,
+    0x00, 0x86, 0x00, 0x9E, 0xDB, 0x81, 0xA7, 0x11, 0x0A, 0x60, 0x00, 0xA6,
+    0x00, 0x0A, 0x60, 0x00, 0x8A, 0x43, 0x01, 0x8A, 0x50, 0x06, 0x30, 0x00,
+    0x92, 0x00, 0x03, 0x00, 0xB4, 0xB2, 0x03, 0xC3, 0x79, 0x67, 0x71, 0x17,
+    0x3C, 0x3D, 0x70, 0x00, 0x48, 0x6C, 0xB1, 0x00, 0x00, 0xC5, 0xC4, 0x00,
+    0x02, 0xC3, 0xA7, 0x00, 0x08, 0xA0, 0x5C, 0x00, 0x1B, 0xDA, 0xBF, 0x30,
+    0x5D, 0x44, 0x4A, 0x90, 0x89, 0x00, 0x04, 0xC2, 0x83, 0x00, 0x00, 0x93,
+    0xB4, 0x41, 0xBE, 0xDC, 0xCC, 0x8B, 0xC8, 0x22, 0x21, 0x0A, 0x60, 0x00,
+    0x00, 0xAC, 0xAA, 0xA7, 0x0A, 0x94, 0x44, 0x30, 0xA6, 0x00, 0x00, 0x0A,
+    0x60, 0x00, 0x00, 0xA9, 0x44, 0x43, 0x07, 0xAA, 0xAA, 0x70, 0xBE, 0x60,
+    0x00, 0xB5, 0xBC, 0x60, 0x00, 0xB5, 0x0A, 0x60, 0x00, 0xB5, 0x0A, 0xCA,
+    0xAA, 0xE5, 0x0A, 0x94, 0x44, 0xC5, 0x0A, 0x60, 0x00, 0xB5, 0x0A, 0x60,
+    0x00, 0xB5, 0x0A, 0x60, 0x00, 0xB5, 0x07, 0x40, 0x00, 0x83, 0xB6, 0xBD,
+    0xEC, 0x4B, 0x21, 0x7B, 0x20, 0x00, 0x06, 0xA0, 0x00, 0x00, 0x6A, 0x00,
+    0x00, 0x06, 0xA0, 0x00, 0x00, 0x6A, 0x00, 0x00, 0x06, 0xA0, 0x00, 0x03,
+    0x8B, 0x31, 0x01, 0xAA, 0xAA, 0x40, 0xB4, 0x6C, 0xCB, 0x20, 0xB4, 0xD6,
+    0x38, 0xA1, 0x07, 0xA0, 0x01, 0xD3, 0x09, 0x80, 0x00, 0xD5, 0x0A, 0x80,
+    0x00, 0xC5, 0x09, 0x80, 0x00, 0xD4, 0x05, 0xB1, 0x03, 0xD3, 0x01, 0xD9,
+    0x5B, 0x80, 0x00, 0x28, 0x96, 0x00, 0xB7, 0xC3, 0x00, 0x7B, 0xB2, 0xA7,
+    0x00, 0xC5, 0x00, 0x4C, 0x15, 0xA1, 0x00, 0x1A, 0x6A, 0x40, 0x00, 0x03,
+    0xEA, 0x00, 0x00, 0x00, 0xC6, 0x00, 0x00, 0x00, 0xB5, 0x00, 0x00, 0x00,
+    0xB5, 0x00, 0x00, 0x00, 0x83, 0x00, 0xB4, 0x6B, 0xCB, 0x30, 0xB4, 0xC5,
+    0x38, 0xA1, 0x08, 0x90, 0x00, 0xD4, 0x0A, 0x80, 0x00, 0xD5, 0x09, 0x80,
+    0x00, 0xD4, 0x06, 0xA0, 0x01, 0xD3, 0x01, 0xB3, 0x06, 0x80, 0x03, 0x9A,
+    0x3B, 0x62, 0x07, 0xAA, 0x3A, 0xA4, 0x03, 0xC3, 0x07, 0x96, 0x70, 0x71,
+    0x17, 0x00, 0x00, 0x00, 0x0A, 0x60, 0x00, 0xA6, 0x00, 0x0A, 0x60, 0x00,
+    0xA6, 0x00, 0x0A, 0x60, 0x00, 0x7B, 0x43, 0x01, 0x7A, 0x60, 0x00, 0x3D,
+    0x70, 0x00, 0x00, 0x6C, 0xB1, 0x00, 0x00, 0xC5, 0xC4, 0x00, 0x02, 0xC3,
+    0xA7, 0x00, 0x08, 0xA0, 0x5C, 0x00, 0x1B, 0xDA, 0xBF, 0x30, 0x5D, 0x44,
+    0x4A, 0x90, 0x89, 0x00, 0x04, 0xC2, 0x83, 0x00, 0x00, 0x93, 0xFD, 0xCC,
+    0xB5, 0xD5, 0x22, 0x8D, 0xD3, 0x00, 0x6C, 0xEB, 0xAA, 0x94, 0xE6, 0x45,
+    0xB8, 0xD3, 0x00, 0x5D, 0xD3, 0x00, 0x5D, 0xE6, 0x45, 0xC9, 0xAA, 0xAA,
+    0x51, 0xFD, 0xCC, 0xCC, 0xD5, 0x22, 0x22, 0xD3, 0x00, 0x00, 0xD3, 0x00,
+    0x00, 0xD3, 0x00, 0x00, 0xD3, 0x00, 0x00, 0xD3, 0x00, 0x00, 0xD3, 0x00,
+    0x00, 0x92, 0x00, 0x00, 0x00, 0xBB, 0x00, 0x01, 0xDD, 0x10, 0x05, 0xAA,
+    0x50, 0x09, 0x66, 0x90, 0x2C, 0x11, 0xC2, 0x4B, 0x00, 0xB4, 0x96, 0x00,
+    0x68, 0xC7, 0x44, 0x7C, 0xAA, 0xAA, 0xAA, 0xFD, 0xCC, 0xC4, 0xD5, 0x22,
+    0x21, 0xD3, 0x00, 0x00, 0xEB, 0xAA, 0xA3, 0xE7, 0x44, 0x41, 0xD3, 0x00,
+    0x00, 0xD3, 0x00, 0x00, 0xE7, 0x44, 0x41, 0xAA, 0xAA, 0xA3, 0xCC, 0xCC,
+    0xDE, 0x22, 0x22, 0xA9, 0x00, 0x05, 0xB1, 0x00, 0x2C, 0x30, 0x00, 0xA7,
+    0x00, 0x05, 0xA1, 0x00, 0x4C, 0x20, 0x00, 0xBA, 0x44, 0x44, 0xAA, 0xAA,
+    0xAA, 0xD3, 0x00, 0x3D, 0xD3, 0x00, 0x3D, 0xD3, 0x00, 0x3D, 0xEB, 0xAA,
+    0xBE, 0xE7, 0x44, 0x7E, 0xD3, 0x00, 0x3D, 0xD3, 0x00, 0x3D, 0xD3, 0x00,
+    0x3D, 0x92, 0x00, 0x29, 0x18, 0xCC, 0x81, 0x7C, 0x33, 0xB6, 0xC6, 0x00,
+    0x5C, 0xD4, 0xAA, 0x4D, 0xE4, 0x44, 0x4E, 0xD4, 0x00, 0x4D, 0xA8, 0x00,
+    0x8A, 0x5D, 0x66, 0xC5, 0x04, 0x99, 0x30, 0x5C, 0xED, 0xA2, 0x12, 0xC6,
+    0x10, 0x00, 0xB5, 0x00, 0x00, 0xB5, 0x00, 0x00, 0xB5, 0x00, 0x00, 0xB5,
+    0x00, 0x00, 0xB5, 0x00, 0x13, 0xC7, 0x20, 0x5A, 0xAA, 0x92, 0xD3, 0x01,
+    0x9A, 0x0D, 0x30, 0x7A, 0x20, 0xD3, 0x7A, 0x10, 0x0D, 0x7B, 0x20, 0x00,
+    0xEB, 0xB4, 0x00, 0x0E, 0x45, 0xB0, 0x00, 0xD3, 0x08, 0x91, 0x0D, 0x30,
+    0x1C, 0x50, 0x92, 0x00, 0x49, 0x00, 0x00, 0x3D, 0x60, 0x00, 0x00, 0x6B,
+    0xA1, 0x00, 0x00, 0xB4, 0xA4, 0x00, 0x02, 0xC2, 0x77, 0x00, 0x08, 0x80,
+    0x3B, 0x00, 0x1B, 0x30, 0x1B, 0x30, 0x4B, 0x00, 0x07, 0x80, 0x87, 0x00,
+    0x03, 0xC2, 0x82, 0x00, 0x00, 0x93, 0xE5, 0x00, 0x5F, 0xE7, 0x00, 0x8E,
+    0xDA, 0x00, 0xAD, 0xEA, 0x11, 0xAE, 0xE7, 0x55, 0x6E, 0xE4, 0x88, 0x4E,
+    0xE4, 0xA9, 0x4E, 0xE4, 0x98, 0x4E, 0x92, 0x44, 0x29, 0xF6, 0x00, 0x3D,
+    0xEC, 0x00, 0x3D, 0xC9, 0x70, 0x3D, 0xC4, 0xB2, 0x3D, 0xD3, 0x68, 0x3D,
+    0xD3, 0x2B, 0x5C, 0xD3, 0x04, 0xCD, 0xD3, 0x00, 0xBF, 0x82, 0x00, 0x3A,
+    0xCC, 0xCC, 0xCC, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00, 0x3A, 0xAA, 0xA3,
+    0x14, 0x44, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x44,
+    0xAA, 0xAA, 0xAA, 0x18, 0xCC, 0x81, 0x7C, 0x33, 0xB6, 0xC6, 0x00, 0x5C,
+    0xD4, 0x00, 0x4D, 0xE4, 0x00, 0x4E, 0xD4, 0x00, 0x4D, 0xA8, 0x00, 0x8A,
+    0x5D, 0x66, 0xC5, 0x04, 0x99, 0x30, 0xFD, 0xCC, 0xDF, 0xD5, 0x22, 0x5D,
+    0xD3, 0x00, 0x3D, 0xD3, 0x00, 0x3D, 0xD3, 0x00, 0x3D, 0xD3, 0x00, 0x3D,
+    0xD3, 0x00, 0x3D, 0xD3, 0x00, 0x3D, 0x92, 0x00, 0x29, 0xFD, 0xCC, 0xA4,
+    0xD5, 0x23, 0x9C, 0xD3, 0x00, 0x4E, 0xD3, 0x02, 0xAB, 0xFD, 0xCB, 0x81,
+    0xD5, 0x21, 0x00, 0xD3, 0x00, 0x00, 0xD3, 0x00, 0x00, 0x92, 0x00, 0x00,
+    0xDE, 0xCC, 0xC8, 0x7C, 0x22, 0x21, 0x08, 0x91, 0x00, 0x01, 0xA7, 0x00,
+    0x00, 0xA7, 0x00, 0x05, 0xA1, 0x00, 0x4C, 0x20, 0x00, 0xBA, 0x44, 0x44,
+    0xAA, 0xAA, 0xAA, 0x9C, 0xDF, 0xCC, 0x82, 0x25, 0xD2, 0x21, 0x00, 0x3D,
+    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xD0, 0x00,
+    0x00, 0x3D, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x29, 0x00, 0x00, 0x7A,
+    0x00, 0x1B, 0x63, 0xC2, 0x04, 0xC1, 0x07, 0x90, 0xA6, 0x00, 0x1C, 0x5C,
+    0x20, 0x00, 0x7E, 0x60, 0x00, 0x04, 0xE1, 0x00, 0x00, 0x3D, 0x00, 0x00,
+    0x03, 0xD0, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x01, 0x5B,
+    0xE9, 0x40, 0x8C, 0x7E, 0x6D, 0x3C, 0x53, 0xD0, 0x88, 0xD4, 0x3D, 0x07,
+    0x9C, 0x63, 0xD1, 0xA7, 0x4C, 0xBE, 0xBB, 0x10, 0x37, 0xE5, 0x20, 0x00,
+    0x29, 0x00, 0x00, 0x98, 0x00, 0x03, 0xB2, 0x2B, 0x30, 0x1B, 0x50, 0x04,
+    0xB2, 0x88, 0x00, 0x00, 0x8B, 0xB2, 0x00, 0x00, 0x4D, 0x80, 0x00, 0x00,
+    0xA7, 0xC3, 0x00, 0x08, 0x80, 0x5B, 0x10, 0x4B, 0x10, 0x1A, 0x70, 0x74,
+    0x00, 0x01, 0x92, 0xD3, 0x3D, 0x06, 0xAD, 0x33, 0xD0, 0x6A, 0xD3, 0x3D,
+    0x06, 0xAD, 0x43, 0xD0, 0x79, 0xA8, 0x5D, 0x3B, 0x63, 0xAD, 0xFC, 0x91,
+    0x00, 0x3D, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x29, 0x00, 0x00, 0x03,
+    0xBC, 0xB6, 0x00, 0x1A, 0x83, 0x5C, 0x20, 0x4D, 0x00, 0x09, 0x80, 0x5D,
+    0x00, 0x08, 0xA0, 0x4D, 0x00, 0x08, 0x90, 0x3D, 0x10, 0x0A, 0x60, 0x08,
+    0x60, 0x3B, 0x10, 0x26, 0xB3, 0xA9, 0x30, 0x4A, 0xA3, 0xAA, 0x70, 0x08,
+    0x44, 0x80, 0x03, 0x11, 0x30, 0x5C, 0xED, 0xA2, 0x12, 0xC6, 0x10, 0x00,
+    0xB5, 0x00, 0x00, 0xB5, 0x00, 0x00, 0xB5, 0x00, 0x00, 0xB5, 0x00, 0x00,
+    0xB5, 0x00, 0x13, 0xC7, 0x20, 0x5A, 0xAA, 0x92, 0x00, 0xA2, 0x84, 0x00,
+    0x03, 0x13, 0x10, 0x7A, 0x00, 0x1B, 0x63, 0xC2, 0x04, 0xC1, 0x07, 0x90,
+    0xA6, 0x00, 0x1C, 0x5C, 0x20, 0x00, 0x7E, 0x60, 0x00, 0x04, 0xE1, 0x00,
+    0x00, 0x3D, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00,
+    0x3C, 0x00, 0x00, 0x04, 0x80, 0x00, 0x03, 0x53, 0x23, 0x04, 0xC9, 0xAB,
+    0x70, 0xC6, 0x01, 0xE6, 0x0D, 0x40, 0x0C, 0x50, 0xD4, 0x00, 0xB5, 0x0C,
+    0x60, 0x0E, 0x50, 0x5C, 0x9A, 0xAB, 0x10, 0x35, 0x32, 0x41, 0x00, 0x3C,
+    0x00, 0x04, 0x80, 0x14, 0x54, 0x29, 0xB9, 0xA6, 0xC4, 0x00, 0x07, 0xBA,
+    0x30, 0xA9, 0x41, 0x0D, 0x40, 0x00, 0x8B, 0x99, 0x81, 0x45, 0x42, 0x00,
+    0x3C, 0x00, 0x00, 0x48, 0x00, 0x42, 0x45, 0x20, 0xDB, 0x9A, 0xA2, 0xF6,
+    0x00, 0xC5, 0xD3, 0x00, 0xB5, 0xD3, 0x00, 0xB5, 0xD3, 0x00, 0xB5, 0xD3,
+    0x00, 0xB5, 0x41, 0x00, 0xB5, 0x00, 0x00, 0xB5, 0x00, 0x00, 0xB5, 0x3C,
+    0x00, 0x48, 0x00, 0x41, 0x00, 0xD3, 0x00, 0xD3, 0x00, 0xD3, 0x00, 0xD3,
+    0x00, 0xD3, 0x00, 0x9B, 0x93, 0x14, 0x51, 0x00, 0x1B, 0x50, 0x05, 0x68,
+    0x63, 0x05, 0x30, 0x53, 0x00, 0x00, 0x00, 0xD3, 0x00, 0xA8, 0xD3, 0x00,
+    0x5C, 0xD3, 0x00, 0x3D, 0xD3, 0x00, 0x3D, 0xC5, 0x00, 0x5B, 0x8C, 0x45,
+    0xC7, 0x15, 0x99, 0x40, 0x3A, 0xCA, 0x88, 0x09, 0x92, 0x4E, 0x60, 0xD4,
+    0x00, 0xC5, 0x0D, 0x30, 0x0B, 0x50, 0xC5, 0x00, 0xD5, 0x08, 0xB4, 0x7E,
+    0x81, 0x16, 0x96, 0x39, 0x10, 0x3A, 0xCC, 0x61, 0xB8, 0x24, 0xD4, 0xD3,
+    0x00, 0xC5, 0xD3, 0x05, 0xB2, 0xD3, 0xCB, 0x61, 0xD3, 0x23, 0x98, 0xD3,
+    0x00, 0x3D, 0xD3, 0x00, 0x5D, 0xFC, 0x99, 0xC5, 0xD6, 0x55, 0x30, 0xD3,
+    0x00, 0x00, 0xD3, 0x00, 0x00, 0xB5, 0x00, 0x5B, 0x79, 0x00, 0x97, 0x3C,
+    0x11, 0xC3, 0x1A, 0x54, 0xA1, 0x04, 0xAA, 0x50, 0x01, 0xCD, 0x10, 0x00,
+    0x9A, 0x00, 0x00, 0xA6, 0x00, 0x00, 0xD4, 0x00, 0x00, 0x41, 0x00, 0x03,
+    0xCB, 0xB4, 0x09, 0x82, 0x43, 0x06, 0xB3, 0x00, 0x01, 0xAC, 0x50, 0x3A,
+    0x95, 0xC6, 0xA8, 0x00, 0x6C, 0xD4, 0x00, 0x4D, 0xC5, 0x00, 0x6C, 0x5C,
+    0x99, 0xB4, 0x02, 0x55, 0x20, 0x6B, 0xBB, 0x5D, 0x62, 0x32, 0x99, 0x52,
+    0x07, 0xC9, 0x30, 0xD4, 0x00, 0x0B, 0x94, 0x56, 0x27, 0xA9, 0x40, 0x8C,
+    0xCC, 0xE4, 0x12, 0x3B, 0x71, 0x03, 0xB5, 0x00, 0x2B, 0x50, 0x00, 0x89,
+    0x00, 0x00, 0xC5, 0x00, 0x00, 0xD4, 0x00, 0x00, 0xC5, 0x00, 0x00, 0x5C,
+    0x96, 0x30, 0x02, 0x58, 0xC3, 0x00, 0x00, 0xB4, 0x00, 0x02, 0xB2, 0xD8,
+    0xBC, 0x81, 0xF9, 0x23, 0xD4, 0xE4, 0x00, 0xB5, 0xD3, 0x00, 0xB5, 0xD3,
+    0x00, 0xB5, 0xD3, 0x00, 0xB5, 0x92, 0x00, 0xB5, 0x00, 0x00, 0xB5, 0x00,
+    0x00, 0xB5, 0x00, 0x00, 0x42, 0x28, 0xBB, 0x81, 0x7A, 0x22, 0xB6, 0xC4,
+    0x00, 0x5C, 0xD4, 0x11, 0x5D, 0xEB, 0xAA, 0xBE, 0xC4, 0x00, 0x4D, 0xA6,
+    0x00, 0x6A, 0x5C, 0x55, 0xC5, 0x04, 0x99, 0x40, 0xD3, 0x00, 0xD3, 0x00,
+    0xD3, 0x00, 0xD3, 0x00, 0xD3, 0x00, 0xC8, 0x41, 0x38, 0x93, 0xD3, 0x06,
+    0xA2, 0xD3, 0x5A, 0x20, 0xD6, 0xA2, 0x00, 0xED, 0x91, 0x00, 0xD4, 0x88,
+    0x00, 0xD3, 0x19, 0x70, 0x92, 0x00, 0x84, 0x2A, 0xA2, 0x00, 0x00, 0x2A,
+    0x60, 0x00, 0x00, 0x5C, 0x00, 0x00, 0x06, 0xE2, 0x00, 0x00, 0xBB, 0x70,
+    0x00, 0x4B, 0x5A, 0x10, 0x1B, 0x50, 0xC3, 0x04, 0xC1, 0x0A, 0x60, 0xA7,
+    0x00, 0x5C, 0x34, 0x20, 0x01, 0x42, 0xD3, 0x00, 0xB5, 0xD3, 0x00, 0xB5,
+    0xD3, 0x00, 0xB5, 0xD3, 0x00, 0xB5, 0xD3, 0x00, 0xD5, 0xF9, 0x48, 0xE5,
+    0xD9, 0x96, 0x63, 0xD3, 0x00, 0x00, 0xD3, 0x00, 0x00, 0x41, 0x00, 0x00,
+    0x5C, 0x00, 0x06, 0xA2, 0xC2, 0x00, 0x79, 0x08, 0x80, 0x09, 0x60, 0x3C,
+    0x22, 0xB2, 0x00, 0xB5, 0x78, 0x00, 0x07, 0xBA, 0x20, 0x00, 0x29, 0x20,
+    0x00, 0x4C, 0xED, 0x82, 0xA6, 0x31, 0x5B, 0x00, 0x04, 0xC3, 0x00, 0x19,
+    0xCB, 0x78, 0x92, 0x11, 0xD4, 0x00, 0x0D, 0x50, 0x00, 0x7D, 0x85, 0x11,
+    0x49, 0xD7, 0x00, 0x07, 0x90, 0x01, 0xA4, 0x29, 0xCC, 0x82, 0x8A, 0x22,
+    0xA8, 0xD4, 0x00, 0x4D, 0xD4, 0x00, 0x4D, 0xC5, 0x00, 0x5C, 0x6C, 0x55,
+    0xC6, 0x04, 0x99, 0x40, 0x9E, 0xDC, 0xED, 0x72, 0xB7, 0x2B, 0x61, 0x0A,
+    0x60, 0xB5, 0x00, 0xA6, 0x0B, 0x50, 0x0A, 0x60, 0xB5, 0x00, 0xA6, 0x0A,
+    0x82, 0x07, 0x40, 0x39, 0x30, 0x28, 0xBC, 0x92, 0x89, 0x22, 0x98, 0xC4,
+    0x00, 0x4D, 0xD3, 0x00, 0x4D, 0xD3, 0x00, 0x5C, 0xE9, 0x45, 0xC6, 0xD7,
+    0x99, 0x40, 0xD3, 0x00, 0x00, 0xD3, 0x00, 0x00, 0x41, 0x00, 0x00, 0x29,
+    0xCC, 0x68, 0xA2, 0x22, 0xD4, 0x00, 0x0D, 0x30, 0x00, 0xC4, 0x00, 0x08,
+    0xB3, 0x00, 0x16, 0xBC, 0x40, 0x01, 0x89, 0x00, 0x19, 0x50, 0x01, 0x41,
+    0x28, 0xBC, 0xEC, 0x68, 0xA3, 0x2A, 0x71, 0xD4, 0x00, 0x4C, 0x0D, 0x40,
+    0x04, 0xD0, 0xC6, 0x00, 0x5C, 0x07, 0xC5, 0x5C, 0x70, 0x04, 0x99, 0x40,
+    0x00, 0x8C, 0xFC, 0xC6, 0x12, 0xD4, 0x21, 0x00, 0xD3, 0x00, 0x00, 0xD3,
+    0x00, 0x00, 0xD3, 0x00, 0x00, 0xC8, 0x41, 0x00, 0x38, 0x93, 0xD3, 0x00,
+    0xA8, 0xD3, 0x00, 0x5C, 0xD3, 0x00, 0x3D, 0xD3, 0x00, 0x3D, 0xC5, 0x00,
+    0x5B, 0x8C, 0x45, 0xC7, 0x15, 0x99, 0x40, 0x48, 0x19, 0xCA, 0x19, 0x74,
+    0xC3, 0xA5, 0xC3, 0x5B, 0x06, 0x9D, 0x35, 0xB0, 0x6A, 0xC5, 0x5B, 0x19,
+    0x78, 0xC8, 0xC8, 0xC2, 0x15, 0xBD, 0x72, 0x00, 0x05, 0xB0, 0x00, 0x00,
+    0x5B, 0x00, 0x00, 0x02, 0x40, 0x00, 0x4D, 0x50, 0x1A, 0x51, 0x6B, 0x15,
+    0xB0, 0x00, 0xC6, 0xB4, 0x00, 0x07, 0xD9, 0x10, 0x00, 0x5E, 0x20, 0x00,
+    0x0A, 0xE6, 0x00, 0x05, 0xB5, 0xB1, 0x02, 0xB4, 0x0C, 0x40, 0x89, 0x00,
+    0x6C, 0x54, 0x20, 0x01, 0x43, 0x00, 0x5B, 0x00, 0x00, 0x05, 0xB0, 0x00,
+    0x41, 0x5B, 0x14, 0x1D, 0x35, 0xB2, 0xC5, 0xD3, 0x5B, 0x08, 0x8D, 0x35,
+    0xB0, 0x69, 0xD3, 0x5B, 0x07, 0x9C, 0x65, 0xB1, 0xB6, 0x5C, 0xBD, 0xBA,
+    0x00, 0x38, 0xC4, 0x10, 0x00, 0x5B, 0x00, 0x00, 0x05, 0xB0, 0x00, 0x78,
+    0x00, 0x2B, 0x2B, 0x50, 0x00, 0x96, 0xC3, 0x24, 0x06, 0x9D, 0x35, 0xB0,
+    0x6A, 0xC3, 0x6B, 0x07, 0x9A, 0x8A, 0xD5, 0xB5, 0x29, 0x63, 0x97, 0x00,
+    0xA2, 0x84, 0x31, 0x31, 0x5B, 0x00, 0x5B, 0x00, 0x5B, 0x00, 0x5B, 0x00,
+    0x5B, 0x00, 0x4D, 0x54, 0x05, 0x99, 0x08, 0x44, 0x80, 0x03, 0x11, 0x30,
+    0xD3, 0x00, 0xA8, 0xD3, 0x00, 0x5C, 0xD3, 0x00, 0x3D, 0xD3, 0x00, 0x3D,
+    0xC5, 0x00, 0x5B, 0x8C, 0x45, 0xC7, 0x15, 0x99, 0x40, 0x00, 0x3C, 0x00,
+    0x00, 0x48, 0x00, 0x02, 0x55, 0x20, 0x3B, 0x99, 0xB3, 0xB7, 0x00, 0x7B,
+    0xD4, 0x00, 0x4D, 0xD4, 0x00, 0x4D, 0xB7, 0x00, 0x7B, 0x3B, 0x99, 0xB3,
+    0x02, 0x55, 0x20, 0x00, 0x3C, 0x00, 0x00, 0x48, 0x00, 0x41, 0x00, 0x42,
+    0xD3, 0x00, 0x89, 0xD3, 0x00, 0x4C, 0xD3, 0x00, 0x3D, 0xD3, 0x00, 0x4D,
+    0xC6, 0x00, 0x6B, 0x5C, 0x99, 0xB4, 0x03, 0x55, 0x20, 0x00, 0x07, 0x80,
+    0x00, 0x00, 0x93, 0x00, 0x23, 0x00, 0x14, 0x08, 0x70, 0x01, 0xB3, 0xC4,
+    0x00, 0x08, 0x8D, 0x33, 0x70, 0x69, 0xD3, 0x5B, 0x06, 0xAC, 0x46, 0xC0,
+    0x88, 0x7B, 0xBB, 0xAC, 0x31, 0x43, 0x25, 0x40, 0x06, 0xB1, 0x00, 0x01,
+    0xA4, 0x00, 0x55, 0x55, 0x52, 0xEB, 0x99, 0x93, 0xD3, 0x00, 0x00, 0xD3,
+    0x00, 0x00, 0xFD, 0xCC, 0xC4, 0xD5, 0x22, 0x21, 0xD3, 0x00, 0x00, 0xD3,
+    0x00, 0x00, 0xEB, 0x99, 0x93, 0x55, 0x55, 0x52, 0x08, 0x44, 0x80, 0x03,
+    0x11, 0x30, 0xFD, 0xCC, 0xC4, 0xD5, 0x22, 0x21, 0xD3, 0x00, 0x00, 0xEB,
+    0xAA, 0xA3, 0xE7, 0x44, 0x41, 0xD3, 0x00, 0x00, 0xD3, 0x00, 0x00, 0xE7,
+    0x44, 0x41, 0xAA, 0xAA, 0xA3, 0xCC, 0xFD, 0xC4, 0x02, 0x2D, 0x52, 0x10,
+    0x00, 0xD3, 0x00, 0x00, 0x0E, 0xBA, 0x70, 0x00, 0xE7, 0x5C, 0x70, 0x0D,
+    0x30, 0x7A, 0x00, 0xD3, 0x07, 0x90, 0x0D, 0x35, 0xB6, 0x00, 0x92, 0x97,
+    0x00, 0x00, 0x1B, 0x60, 0x00, 0x4A, 0x10, 0x55, 0x55, 0x55, 0xEB, 0x99,
+    0x99, 0xD3, 0x00, 0x00, 0xD3, 0x00, 0x00, 0xD3, 0x00, 0x00, 0xD3, 0x00,
+    0x00, 0xD3, 0x00, 0x00, 0xD3, 0x00, 0x00, 0xD3, 0x00, 0x00, 0x41, 0x00,
+    0x00, 0x04, 0xBC, 0xC9, 0x4D, 0x53, 0x34, 0xB7, 0x00, 0x00, 0xEC, 0xAA,
+    0x70, 0xE7, 0x44, 0x30, 0xD5, 0x00, 0x00, 0x9B, 0x10, 0x00, 0x3C, 0xA5,
+    0x58, 0x01, 0x79, 0x97, 0x4A, 0xCC, 0xC9, 0xC8, 0x33, 0x44, 0xD5, 0x00,
+    0x00, 0x8C, 0x61, 0x00, 0x03, 0xAC, 0xA3, 0x00, 0x02, 0x9B, 0x00, 0x00,
+    0x4D, 0x96, 0x45, 0xB9, 0x79, 0xA9, 0x51, 0x5C, 0xED, 0xA2, 0x12, 0xC6,
+    0x10, 0x00, 0xB5, 0x00, 0x00, 0xB5, 0x00, 0x00, 0xB5, 0x00, 0x00, 0xB5,
+    0x00, 0x00, 0xB5, 0x00, 0x13, 0xC7, 0x20, 0x5A, 0xAA, 0x92, 0x08, 0x44,
+    0x80, 0x03, 0x11, 0x30, 0x5C, 0xED, 0xA2, 0x12, 0xC6, 0x10, 0x00, 0xB5,
+    0x00, 0x00, 0xB5, 0x00, 0x00, 0xB5, 0x00, 0x00, 0xB5, 0x00, 0x00, 0xB5,
+    0x00, 0x13, 0xC7, 0x20, 0x5A, 0xAA, 0x92, 0x00, 0x00, 0xB5, 0x00, 0x00,
+    0xB5, 0x00, 0x00, 0xB5, 0x00, 0x00, 0xB5, 0x00, 0x00, 0xB5, 0x00, 0x00,
+    0xB5, 0x00, 0x01, 0xD4, 0x85, 0x6A, 0xB2, 0x7A, 0x97, 0x10, 0x5E, 0xCE,
+    0x60, 0x00, 0x5C, 0x2B, 0x60, 0x00, 0x5B, 0x0A, 0x60, 0x00, 0x6B, 0x0A,
+    0xC8, 0x20, 0x6A, 0x0A, 0x97, 0xC2, 0x6A, 0x0A, 0x60, 0xB4, 0x79, 0x0A,
+    0x60, 0xB4, 0xA7, 0x0A, 0x97, 0xC2, 0x82, 0x07, 0xA8, 0x20, 0xD3, 0x5B,
+    0x00, 0x0D, 0x35, 0xB0, 0x00, 0xD3, 0x5B, 0x00, 0x0E, 0xBC, 0xE9, 0x50,
+    0xE7, 0x8C, 0x6C, 0x5D, 0x35, 0xB0, 0x79, 0xD3, 0x5B, 0x07, 0x9D, 0x35,
+    0xC6, 0xC5, 0x92, 0x3A, 0x95, 0x00, 0xCC, 0xFD, 0xC4, 0x02, 0x2D, 0x52,
+    0x10, 0x00, 0xD3, 0x00, 0x00, 0x0E, 0xBA, 0x70, 0x00, 0xE7, 0x5C, 0x70,
+    0x0D, 0x30, 0x7A, 0x00, 0xD3, 0x06, 0xA0, 0x0D, 0x30, 0x6A, 0x00, 0x92,
+    0x04, 0x70, 0x00, 0x1B, 0x60, 0x00, 0x04, 0xA1, 0x00, 0x41, 0x00, 0x24,
+    0x0D, 0x30, 0x1A, 0x70, 0xD3, 0x2A, 0x60, 0x0D, 0x39, 0x80, 0x00, 0xEB,
+    0x91, 0x00, 0x0E, 0xAB, 0x20, 0x00, 0xD3, 0x8A, 0x10, 0x0D, 0x31, 0xA8,
+    0x10, 0xD3, 0x01, 0xB8, 0x04, 0x10, 0x02, 0x40, 0x00, 0xB7, 0x00, 0x00,
+    0x4B, 0x00, 0x41, 0x00, 0x25, 0xD3, 0x00, 0x8F, 0xD3, 0x02, 0xCD, 0xD3,
+    0x09, 0x7C, 0xD3, 0x5A, 0x3D, 0xD3, 0xA4, 0x3D, 0xC7, 0x90, 0x3D, 0xED,
+    0x20, 0x3D, 0xF8, 0x00, 0x3D, 0x52, 0x00, 0x14, 0x08, 0x81, 0x5B, 0x00,
+    0x03, 0xBB, 0xA5, 0x00, 0x42, 0x00, 0x00, 0x41, 0x99, 0x00, 0x03, 0xC2,
+    0x3D, 0x20, 0x1A, 0x60, 0x09, 0x80, 0x4C, 0x10, 0x02, 0xC3, 0xA7, 0x00,
+    0x00, 0xA9, 0xC2, 0x00, 0x00, 0x4E, 0x70, 0x00, 0x00, 0x3D, 0x10, 0x00,
+    0x4A, 0xC6, 0x00, 0x00, 0x15, 0x31, 0x00, 0x00, 0xD3, 0x00, 0x3D, 0xD3,
+    0x00, 0x3D, 0xD3, 0x00, 0x3D, 0xD3, 0x00, 0x3D, 0xD3, 0x00, 0x3D, 0xD3,
+    0x00, 0x3D, 0xD3, 0x00, 0x3D, 0xE7, 0x44, 0x7E, 0xAA, 0xEB, 0xAA, 0x00,
+    0xD3, 0x00, 0x00, 0x92, 0x00, 0x00, 0x3D, 0x70, 0x00, 0x00, 0x6C, 0xB1,
+    0x00, 0x00, 0xC5, 0xC4, 0x00, 0x02, 0xC3, 0xA7, 0x00, 0x08, 0xA0, 0x5C,
+    0x00, 0x1B, 0xDA, 0xBF, 0x30, 0x5D, 0x44, 0x4A, 0x90, 0x89, 0x00, 0x04,
+    0xC2, 0x83, 0x00, 0x00, 0x93, 0xFD, 0xCC, 0xC6, 0xD5, 0x22, 0x21, 0xD3,
+    0x00, 0x00, 0xEB, 0xA9, 0x51, 0xE7, 0x46, 0xC9, 0xD3, 0x00, 0x5D, 0xD3,
+    0x00, 0x5D, 0xE6, 0x45, 0xC9, 0xAA, 0xA9, 0x51, 0xFD, 0xCC, 0xB5, 0xD5,
+    0x22, 0x8D, 0xD3, 0x00, 0x6C, 0xEB, 0xAA, 0x94, 0xE6, 0x45, 0xB8, 0xD3,
+    0x00, 0x5D, 0xD3, 0x00, 0x5D, 0xE6, 0x45, 0xC9, 0xAA, 0xAA, 0x51, 0xFD,
+    0xCC, 0xCC, 0xD5, 0x22, 0x22, 0xD3, 0x00, 0x00, 0xD3, 0x00, 0x00, 0xD3,
+    0x00, 0x00, 0xD3, 0x00, 0x00, 0xD3, 0x00, 0x00, 0xD3, 0x00, 0x00, 0x92,
+    0x00, 0x00, 0x00, 0xFD, 0xDF, 0x00, 0x00, 0xD5, 0x5D, 0x00, 0x00, 0xC2,
+    0x3D, 0x00, 0x02, 0xC2, 0x3D, 0x00, 0x04, 0xB1, 0x3D, 0x00, 0x06, 0x90,
+    0x3D, 0x00, 0x1B, 0x40, 0x3D, 0x00, 0x7C, 0x54, 0x7E, 0x41, 0xEB, 0xAA,
+    0xAA, 0xD5, 0xD3, 0x00, 0x00, 0xA5, 0x82, 0x00, 0x00, 0x73, 0xFD, 0xCC,
+    0xC4, 0xD5, 0x22, 0x21, 0xD3, 0x00, 0x00, 0xEB, 0xAA, 0xA3, 0xE7, 0x44,
+    0x41, 0xD3, 0x00, 0x00, 0xD3, 0x00, 0x00, 0xE7, 0x44, 0x41, 0xAA, 0xAA,
+    0xA3, 0x5B, 0x0A, 0x60, 0xB4, 0x1B, 0x3A, 0x64, 0xA1, 0x06, 0x9A, 0x7A,
+    0x30, 0x01, 0xBD, 0xBA, 0x00, 0x00, 0xBE, 0xD9, 0x00, 0x03, 0xBB, 0x9C,
+    0x10, 0x09, 0x6A, 0x78, 0x70, 0x2C, 0x1A, 0x62, 0xC2, 0x47, 0x07, 0x40,
+    0x74, 0x6B, 0xCC, 0xB5, 0x55, 0x22, 0x8D, 0x00, 0x01, 0x7B, 0x07, 0xAB,
+    0x83, 0x03, 0x46, 0xC7, 0x00, 0x00, 0x5D, 0x00, 0x00, 0x5D, 0x96, 0x46,
+    0xC8, 0x69, 0xA9, 0x40, 0xD3, 0x00, 0x6F, 0xD3, 0x00, 0xCE, 0xD3, 0x07,
+    0x9C, 0xD3, 0x2B, 0x3D, 0xD3, 0x86, 0x3D, 0xC5, 0xB1, 0x3D, 0xDC, 0x40,
+    0x3D, 0xFB, 0x00, 0x3D, 0xA3, 0x00, 0x28, 0x4B, 0x12, 0xB4, 0x19, 0xBB,
+    0x81, 0x41, 0x00, 0x25, 0xD3, 0x00, 0x8F, 0xD3, 0x02, 0xCD, 0xD3, 0x09,
+    0x7C, 0xD3, 0x5A, 0x3D, 0xD3, 0xA4, 0x3D, 0xC7, 0x90, 0x3D, 0xED, 0x20,
+    0x3D, 0xF8, 0x00, 0x3D, 0x52, 0x00, 0x14, 0xD3, 0x00, 0x8A, 0x0D, 0x30,
+    0x6A, 0x20, 0xD3, 0x7B, 0x10, 0x0D, 0x7B, 0x30, 0x00, 0xEC, 0x91, 0x00,
+    0x0D, 0x5B, 0x70, 0x00, 0xD3, 0x2C, 0x50, 0x0D, 0x30, 0x3C, 0x40, 0x92,
+    0x00, 0x48, 0x00, 0x00, 0xFD, 0xCD, 0xA0, 0x1D, 0x52, 0x8A, 0x01, 0xC2,
+    0x06, 0xA0, 0x2C, 0x20, 0x6A, 0x03, 0xB1, 0x06, 0xA0, 0x5A, 0x00, 0x6A,
+    0x08, 0x70, 0x06, 0xA6, 0xD3, 0x00, 0x6A, 0x95, 0x00, 0x04, 0x70, 0xE5,
+    0x00, 0x5F, 0xE7, 0x00, 0x8E, 0xDA, 0x00, 0xAD, 0xEA, 0x11, 0xAE, 0xE7,
+    0x55, 0x6E, 0xE4, 0x88, 0x4E, 0xE4, 0xA9, 0x4E, 0xE4, 0x98, 0x4E, 0x92,
+    0x44, 0x29, 0xD3, 0x00, 0x3D, 0xD3, 0x00, 0x3D, 0xD3, 0x00, 0x3D, 0xEB,
+    0xAA, 0xBE, 0xE7, 0x44, 0x7E, 0xD3, 0x00, 0x3D, 0xD3, 0x00, 0x3D, 0xD3,
+    0x00, 0x3D, 0x92, 0x00, 0x29, 0x18, 0xCC, 0x81, 0x7C, 0x33, 0xB6, 0xC6,
+    0x00, 0x5C, 0xD4, 0x00, 0x4D, 0xE4, 0x00, 0x4E, 0xD4, 0x00, 0x4D, 0xA8,
+    0x00, 0x8A, 0x5D, 0x66, 0xC5, 0x04, 0x99, 0x30, 0xFD, 0xCC, 0xDF, 0xD5,
+    0x22, 0x5D, 0xD3, 0x00, 0x3D, 0xD3, 0x00, 0x3D, 0xD3, 0x00, 0x3D, 0xD3,
+    0x00, 0x3D, 0xD3, 0x00, 0x3D, 0xD3, 0x00, 0x3D, 0x92, 0x00, 0x29, 0xFD,
+    0xCC, 0xA4, 0xD5, 0x23, 0x9C, 0xD3, 0x00, 0x4E, 0xD3, 0x02, 0xAB, 0xFD,
+    0xCB, 0x81, 0xD5, 0x21, 0x00, 0xD3, 0x00, 0x00, 0xD3, 0x00, 0x00, 0x92,
+    0x00, 0x00, 0x04, 0xBC, 0xC9, 0x4D, 0x63, 0x34, 0xB8, 0x00, 0x00, 0xD4,
+    0x00, 0x00, 0xE4, 0x00, 0x00, 0xD5, 0x00, 0x00, 0x9A, 0x10, 0x00, 0x3C,
+    0x95, 0x58, 0x01, 0x79, 0x97, 0x9C, 0xDF, 0xCC, 0x82, 0x25, 0xD2, 0x21,
+    0x00, 0x3D, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03,
+    0xD0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x29, 0x00,
+    0x00, 0xB7, 0x00, 0x02, 0xC3, 0x5C, 0x00, 0x08, 0x90, 0x1A, 0x60, 0x3C,
+    0x20, 0x05, 0xB1, 0x7A, 0x00, 0x00, 0xB7, 0xC3, 0x00, 0x00, 0x6D, 0x91,
+    0x00, 0x00, 0x3D, 0x30, 0x00, 0x25, 0xAA, 0x00, 0x00, 0x39, 0x71, 0x00,
+    0x00, 0x00, 0x3D, 0x00, 0x01, 0x5B, 0xE9, 0x40, 0x8C, 0x7E, 0x6D, 0x3C,
+    0x53, 0xD0, 0x88, 0xD4, 0x3D, 0x07, 0x9C, 0x63, 0xD1, 0xA7, 0x4C, 0xBE,
+    0xBB, 0x10, 0x37, 0xE5, 0x20, 0x00, 0x29, 0x00, 0x00, 0x98, 0x00, 0x03,
+    0xB2, 0x2B, 0x30, 0x1B, 0x50, 0x04, 0xB2, 0x88, 0x00, 0x00, 0x8B, 0xB2,
+    0x00, 0x00, 0x4D, 0x80, 0x00, 0x00, 0xA7, 0xC3, 0x00, 0x08, 0x80, 0x5B,
+    0x10, 0x4B, 0x10, 0x1A, 0x70, 0x74, 0x00, 0x01, 0x92, 0xD3, 0x00, 0xB5,
+    0x0D, 0x30, 0x0B, 0x50, 0xD3, 0x00, 0xB5, 0x0D, 0x30, 0x0B, 0x50, 0xD3,
+    0x00, 0xB5, 0x0D, 0x30, 0x0B, 0x50, 0xD3, 0x00, 0xB5, 0x0E, 0x74, 0x4C,
+    0x83, 0xAA, 0xAA, 0xAC, 0xA0, 0x00, 0x00, 0x5A, 0x00, 0x00, 0x03, 0x70,
+    0xD3, 0x00, 0x3D, 0xD3, 0x00, 0x3D, 0xD3, 0x00, 0x3D, 0xD4, 0x00, 0x3D,
+    0x8C, 0xAA, 0xCF, 0x14, 0x54, 0x5D, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3D,
+    0x00, 0x00, 0x29, 0xD3, 0x5B, 0x06, 0xAD, 0x35, 0xB0, 0x6A, 0xD3, 0x5B,
+    0x06, 0xAD, 0x35, 0xB0, 0x6A, 0xD3, 0x5B, 0x06, 0xAD, 0x35, 0xB0, 0x6A,
+    0xD3, 0x5B, 0x06, 0xAE, 0x78, 0xC4, 0x9A, 0xAA, 0xAA, 0xAA, 0x70, 0xD3,
+    0x5B, 0x06, 0xA0, 0xD3, 0x5B, 0x06, 0xA0, 0xD3, 0x5B, 0x06, 0xA0, 0xD3,
+    0x5B, 0x06, 0xA0, 0xD3, 0x5B, 0x06, 0xA0, 0xD3, 0x5B, 0x06, 0xA0, 0xD3,
+    0x5B, 0x06, 0xA0, 0xE7, 0x8C, 0x49, 0xB1, 0xAA, 0xAA, 0xAA, 0xD5, 0x00,
+    0x00, 0x00, 0xA5, 0x00, 0x00, 0x00, 0x73, 0xCC, 0xD3, 0x00, 0x02, 0x2D,
+    0x30, 0x00, 0x00, 0xD3, 0x00, 0x00, 0x0E, 0xB8, 0x30, 0x00, 0xE7, 0x8D,
+    0x40, 0x0D, 0x30, 0x99, 0x00, 0xD3, 0x09, 0x90, 0x0E, 0x67, 0xD4, 0x00,
+    0xAA, 0x83, 0x00, 0xD3, 0x00, 0x3D, 0xD3, 0x00, 0x3D, 0xD3, 0x00, 0x3D,
+    0xEB, 0x61, 0x3D, 0xE7, 0xA9, 0x3D, 0xD3, 0x3C, 0x3D, 0xD3, 0x3C, 0x3D,
+    0xE7, 0xA9, 0x3D, 0xAA, 0x61, 0x28, 0xD3, 0x00, 0x00, 0xD3, 0x00, 0x00,
+    0xD3, 0x00, 0x00, 0xEB, 0xA9, 0x40, 0xE7, 0x56, 0xC9, 0xD3, 0x00, 0x5D,
+    0xD3, 0x00, 0x5D, 0xE6, 0x46, 0xC8, 0xAA, 0xA9, 0x40, 0x3B, 0xCC, 0x93,
+    0x01, 0x43, 0x39, 0xC1, 0x00, 0x00, 0x1A, 0x60, 0x0A, 0xAA, 0xD9, 0x00,
+    0x44, 0x4A, 0xA0, 0x00, 0x00, 0xA8, 0x00, 0x00, 0x4D, 0x33, 0x75, 0x6C,
+    0x90, 0x28, 0xA9, 0x40, 0x00, 0xD3, 0x4C, 0xC4, 0xD3, 0xA7, 0x79, 0xD3,
+    0xC3, 0x3C, 0xEB, 0xC3, 0x3C, 0xE7, 0xC3, 0x3D, 0xD3, 0xC3, 0x3C, 0xD3,
+    0xB4, 0x4B, 0xD3, 0x89, 0x98, 0x92, 0x18, 0x81, 0x01, 0x9C, 0xCC, 0xE5,
+    0x07, 0xC4, 0x22, 0xC5, 0x09, 0x80, 0x00, 0xB5, 0x05, 0xC5, 0x10, 0xB5,
+    0x00, 0x5D, 0xDC, 0xE5, 0x00, 0x5D, 0x32, 0xC5, 0x02, 0xD6, 0x00, 0xB5,
+    0x19, 0x91, 0x00, 0xB5, 0x39, 0x10, 0x00, 0x83, 0x4A, 0xBC, 0x81, 0x24,
+    0x23, 0xC4, 0x03, 0x45, 0xC5, 0x7B, 0x76, 0xD5, 0xD4, 0x00, 0xD5, 0xC8,
+    0x38, 0xE5, 0x38, 0x95, 0x53, 0x02, 0x69, 0xBA, 0x2A, 0x96, 0x42, 0x89,
+    0x00, 0x00, 0xC6, 0x8A, 0x61, 0xEC, 0x64, 0xB9, 0xE5, 0x00, 0x5D, 0xC4,
+    0x00, 0x4D, 0x98, 0x00, 0x6B, 0x2B, 0xA9, 0xB4, 0x02, 0x55, 0x20, 0xFC,
+    0xCC, 0xB7, 0xD4, 0x22, 0x6C, 0xE7, 0x55, 0x88, 0xEA, 0x89, 0xB7, 0xD3,
+    0x00, 0x3D, 0xD6, 0x34, 0x9C, 0xAA, 0xAA, 0x72, 0xFC, 0xCC, 0xD4, 0x22,
+    0xD3, 0x00, 0xD3, 0x00, 0xD3, 0x00, 0xD3, 0x00, 0x92, 0x00, 0x00, 0xEC,
+    0xCE, 0x00, 0x1C, 0x34, 0xD0, 0x04, 0xA0, 0x3D, 0x00, 0x78, 0x03, 0xD0,
+    0x1B, 0x30, 0x3D, 0x06, 0xC3, 0x36, 0xD2, 0xEB, 0xAA, 0xAC, 0xAD, 0x30,
+    0x00, 0x6A, 0x92, 0x00, 0x04, 0x70, 0x28, 0xBC, 0x92, 0x89, 0x22, 0x89,
+    0xD8, 0x55, 0x7E, 0xEA, 0x88, 0x88, 0xC6, 0x00, 0x00, 0x6C, 0x54, 0x66,
+    0x03, 0x9A, 0x83, 0x4B, 0x1A, 0x61, 0xB4, 0x19, 0x5A, 0x67, 0x80, 0x02,
+    0xBC, 0xAB, 0x00, 0x00, 0xBE, 0xC9, 0x00, 0x05, 0xAB, 0x8B, 0x30, 0x1B,
+    0x4A, 0x65, 0xA1, 0x38, 0x07, 0x40, 0x83, 0x9B, 0xBB, 0x33, 0x22, 0x89,
+    0x03, 0x6B, 0x50, 0x69, 0xD4, 0x00, 0x07, 0x98, 0x44, 0xB7, 0x79, 0x96,
+    0x00, 0xD3, 0x03, 0xF5, 0xD3, 0x19, 0xC5, 0xD3, 0x57, 0xB5, 0xD3, 0xA3,
+    0xB5, 0xD9, 0x60, 0xB5, 0xEC, 0x10, 0xB5, 0xA4, 0x00, 0x73, 0x4B, 0x12,
+    0xB4, 0x19, 0xBB, 0x81, 0x41, 0x01, 0x52, 0xD3, 0x05, 0xF5, 0xD3, 0x2A,
+    0xB5, 0xD3, 0x76, 0xB5, 0xD5, 0xA1, 0xB5, 0xDB, 0x40, 0xB5, 0xFA, 0x00,
+    0xB5, 0x52, 0x00, 0x42, 0xD3, 0x02, 0xA6, 0xD3, 0x3A, 0x40, 0xD7, 0xA3,
+    0x00, 0xDB, 0x80, 0x00, 0xD3, 0x99, 0x10, 0xD3, 0x18, 0x91, 0x92, 0x00,
+    0x76, 0x0A, 0xDC, 0xCF, 0x0A, 0x72, 0x4D, 0x1B, 0x60, 0x3D, 0x1B, 0x50,
+    0x3D, 0x2C, 0x20, 0x3D, 0x6B, 0x00, 0x3D, 0x93, 0x00, 0x29, 0xF6, 0x00,
+    0x6F, 0xEA, 0x00, 0xAE, 0xDB, 0x11, 0xBD, 0xD8, 0x55, 0x8D, 0xD3, 0xAA,
+    0x3D, 0xD3, 0x9A, 0x3D, 0x92, 0x44, 0x29, 0xD3, 0x00, 0xB5, 0xD3, 0x00,
+    0xB5, 0xE7, 0x55, 0xC5, 0xEA, 0x88, 0xD5, 0xD3, 0x00, 0xB5, 0xD3, 0x00,
+    0xB5, 0x92, 0x00, 0x73, 0x29, 0xCC, 0x82, 0x8A, 0x22, 0xA8, 0xD4, 0x00,
+    0x4D, 0xD4, 0x00, 0x4D, 0xC5, 0x00, 0x5C, 0x6C, 0x55, 0xC6, 0x04, 0x99,
+    0x40, 0xFC, 0xCC, 0xE5, 0xD4, 0x22, 0xB5, 0xD3, 0x00, 0xB5, 0xD3, 0x00,
+    0xB5, 0xD3, 0x00, 0xB5, 0xD3, 0x00, 0xB5, 0x92, 0x00, 0x73, 0xD8, 0xBC,
+    0xA2, 0xF9, 0x22, 0xA9, 0xE4, 0x00, 0x4D, 0xD3, 0x00, 0x4D, 0xE5, 0x00,
+    0x5C, 0xFB, 0x55, 0xC7, 0xD5, 0x99, 0x50, 0xD3, 0x00, 0x00, 0xD3, 0x00,
+    0x00, 0x41, 0x00, 0x00, 0x29, 0xCB, 0x69, 0xA2, 0x22, 0xD4, 0x00, 0x0D,
+    0x40, 0x00, 0xC5, 0x00, 0x07, 0xC5, 0x45, 0x05, 0x99, 0x40, 0xCC, 0xDE,
+    0xCC, 0x82, 0x26, 0xB2, 0x21, 0x00, 0x5B, 0x00, 0x00, 0x05, 0xB0, 0x00,
+    0x00, 0x5B, 0x00, 0x00, 0x05, 0xB0, 0x00, 0x00, 0x37, 0x00, 0x00, 0xB5,
+    0x00, 0x5B, 0x79, 0x00, 0x97, 0x3C, 0x11, 0xC3, 0x1A, 0x54, 0xA1, 0x04,
+    0xBA, 0x40, 0x01, 0xCD, 0x10, 0x00, 0x98, 0x00, 0x00, 0xB4, 0x00, 0x8A,
+    0x80, 0x00, 0x54, 0x10, 0x00, 0x00, 0x5B, 0x00, 0x00, 0x05, 0xB0, 0x00,
+    0x02, 0x8C, 0x41, 0x04, 0xBB, 0xDB, 0xA0, 0xB6, 0x5B, 0x1A, 0x6D, 0x35,
+    0xB0, 0x79, 0xD3, 0x5B, 0x07, 0x9B, 0x65, 0xB1, 0xA6, 0x4B, 0xBD, 0xBA,
+    0x00, 0x28, 0xC4, 0x10, 0x00, 0x5B, 0x00, 0x00, 0x05, 0xB0, 0x00, 0x8A,
+    0x00, 0xA8, 0x2B, 0x44, 0xB2, 0x02, 0xCC, 0x20, 0x00, 0xDD, 0x00, 0x07,
+    0x88, 0x70, 0x4C, 0x11, 0xC4, 0x84, 0x00, 0x48, 0xD3, 0x00, 0xB5, 0xD3,
+    0x00, 0xB5, 0xD3, 0x00, 0xB5, 0xD3, 0x00, 0xB5, 0xD3, 0x00, 0xB5, 0xD6,
+    0x33, 0xC7, 0xAA, 0xAA, 0xBE, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x29, 0xD3,
+    0x00, 0xB5, 0xD3, 0x00, 0xB5, 0xD3, 0x00, 0xB5, 0xC8, 0x47, 0xE5, 0x28,
+    0x95, 0xB5, 0x00, 0x00, 0xB5, 0x00, 0x00, 0x73, 0xD3, 0x5B, 0x06, 0xAD,
+    0x35, 0xB0, 0x6A, 0xD3, 0x5B, 0x06, 0xAD, 0x35, 0xB0, 0x6A, 0xD3, 0x5B,
+    0x06, 0xAD, 0x57, 0xC3, 0x8A, 0xAA, 0xAA, 0xAA, 0x70, 0xD3, 0x5B, 0x06,
+    0xA0, 0xD3, 0x5B, 0x06, 0xA0, 0xD3, 0x5B, 0x06, 0xA0, 0xD3, 0x5B, 0x06,
+    0xA0, 0xD3, 0x5B, 0x06, 0xA0, 0xD5, 0x7C, 0x38, 0xB1, 0xAA, 0xAA, 0xAA,
+    0xE5, 0x00, 0x00, 0x00, 0xB5, 0x00, 0x00, 0x00, 0x73, 0xCC, 0xD3, 0x00,
+    0x02, 0x2D, 0x30, 0x00, 0x00, 0xE7, 0x53, 0x00, 0x0E, 0xA9, 0xC4, 0x00,
+    0xD3, 0x07, 0x90, 0x0D, 0x65, 0xB7, 0x00, 0xAA, 0x96, 0x00, 0xD3, 0x00,
+    0x3D, 0xD3, 0x00, 0x3D, 0xE7, 0x41, 0x3D, 0xEA, 0xB9, 0x3D, 0xD3, 0x3D,
+    0x3D, 0xD6, 0x8B, 0x3D, 0xAA, 0x82, 0x29, 0xD3, 0x00, 0x00, 0xD3, 0x00,
+    0x00, 0xE7, 0x55, 0x31, 0xEA, 0x89, 0xB8, 0xD3, 0x00, 0x4D, 0xD6, 0x34,
+    0x9B, 0xAA, 0xAA, 0x72, 0xAC, 0xB8, 0x03, 0x24, 0xC4, 0x25, 0x5A, 0x93,
+    0x88, 0xBA, 0x00, 0x09, 0x87, 0x47, 0xD2, 0x7A, 0x83, 0x00, 0xD3, 0x4B,
+    0xB4, 0xD3, 0xA6, 0x6A, 0xE7, 0xD3, 0x3C, 0xEA, 0xD3, 0x3D, 0xD3, 0xC3,
+    0x4C, 0xD3, 0x98, 0x89, 0x92, 0x28, 0x82, 0x18, 0xCC, 0xCF, 0x4C, 0x32,
+    0x4D, 0x4C, 0x10, 0x3D, 0x19, 0xBA, 0xBE, 0x03, 0xC5, 0x6D, 0x1A, 0x60,
+    0x3D, 0x38, 0x00, 0x29, 0x00, 0xB7, 0x00, 0x00, 0x4B, 0x00, 0x02, 0x45,
+    0x20, 0x3B, 0x99, 0xB4, 0xA6, 0x00, 0x5C, 0xEB, 0xAA, 0xBE, 0xD6, 0x33,
+    0x33, 0xB7, 0x00, 0x00, 0x3B, 0xA9, 0xA7, 0x01, 0x45, 0x42, 0x08, 0x44,
+    0x80, 0x03, 0x11, 0x30, 0x28, 0xBC, 0x92, 0x89, 0x22, 0x89, 0xD8, 0x55,
+    0x7E, 0xEA, 0x88, 0x88, 0xC6, 0x00, 0x00, 0x6C, 0x54, 0x66, 0x03, 0x9A,
+    0x83, 0x0A, 0x60, 0x00, 0x06, 0xDC, 0xA6, 0x00, 0x1B, 0x85, 0x63, 0x00,
+    0xAB, 0xA9, 0xC3, 0x0A, 0x90, 0x08, 0x90, 0xA7, 0x00, 0x6A, 0x0A, 0x60,
+    0x06, 0xA0, 0xA6, 0x00, 0x6A, 0x0A, 0x60, 0x06, 0xA0, 0x32, 0x00, 0x6A,
+    0x00, 0x00, 0x07, 0x90, 0x00, 0x0A, 0xB3, 0x02, 0xD3, 0x07, 0x70, 0x55,
+    0x55, 0xEA, 0x88, 0xD3, 0x00, 0xD3, 0x00, 0xD3, 0x00, 0xD3, 0x00, 0xD3,
+    0x00, 0x41, 0x00, 0x29, 0xCC, 0x70, 0x99, 0x22, 0x20, 0xD8, 0x55, 0x00,
+    0xEA, 0x88, 0x00, 0xC5, 0x00, 0x00, 0x7C, 0x54, 0x50, 0x05, 0x99, 0x40,
+    0x6B, 0xBB, 0x5C, 0x52, 0x32, 0xAA, 0x41, 0x02, 0x6B, 0xB2, 0x00, 0x08,
+    0x98, 0x54, 0xB7, 0x79, 0x96, 0x00, 0x00, 0x59, 0x00, 0x00, 0x23, 0x00,
+    0x14, 0x54, 0x00, 0x15, 0xAB, 0x00, 0x00, 0x5B, 0x00, 0x00, 0x5B, 0x00,
+    0x00, 0x5B, 0x00, 0x00, 0x5B, 0x00, 0x26, 0xAD, 0x75, 0x25, 0x55, 0x54,
+    0x08, 0x44, 0x80, 0x03, 0x11, 0x30, 0x18, 0xCB, 0x00, 0x00, 0x6B, 0x00,
+    0x00, 0x5B, 0x00, 0x00, 0x5B, 0x00, 0x00, 0x5B, 0x00, 0x01, 0x6C, 0x21,
+    0x3A, 0xAA, 0xA8, 0x00, 0x3B, 0x00, 0x14, 0x25, 0x55, 0x26, 0x9E, 0x00,
+    0x3D, 0x00, 0x3D, 0x00, 0x3D, 0x00, 0x3D, 0x00, 0x3D, 0x00, 0x3D, 0x32,
+    0x6C, 0xBB, 0xB5, 0x0A, 0xCE, 0x60, 0x00, 0x0A, 0x4B, 0x60, 0x00, 0x0A,
+    0x2A, 0x94, 0x20, 0x0A, 0x1A, 0xB9, 0xA2, 0x1B, 0x0A, 0x60, 0xB5, 0x5A,
+    0x0A, 0x85, 0xC3, 0x94, 0x07, 0xA9, 0x30, 0xD3, 0x5B, 0x00, 0x0D, 0x35,
+    0xB0, 0x00, 0xE7, 0x8C, 0x53, 0x0E, 0xAB, 0xD9, 0xC4, 0xD3, 0x5B, 0x07,
+    0x9D, 0x35, 0xC5, 0xB7, 0x92, 0x3A, 0x96, 0x00, 0x0A, 0x60, 0x00, 0x06,
+    0xDC, 0xA8, 0x10, 0x1B, 0x85, 0x63, 0x00, 0xAB, 0xA9, 0xC4, 0x0A, 0x90,
+    0x08, 0x90, 0xA7, 0x00, 0x6A, 0x0A, 0x60, 0x06, 0xA0, 0xA6, 0x00, 0x6A,
+    0x0A, 0x60, 0x06, 0xA0, 0x32, 0x00, 0x23, 0x00, 0x7B, 0x00, 0x00, 0xB4,
+    0x00, 0x41, 0x01, 0x41, 0xD3, 0x18, 0x71, 0xD3, 0x87, 0x00, 0xD8, 0x81,
+    0x00, 0xEB, 0xA3, 0x00, 0xD3, 0x6A, 0x10, 0xD3, 0x05, 0xA2, 0x41, 0x00,
+    0x42, 0x06, 0xB1, 0x00, 0x01, 0xA4, 0x00, 0x41, 0x01, 0x52, 0xD3, 0x05,
+    0xF5, 0xD3, 0x2A, 0xB5, 0xD3, 0x76, 0xB5, 0xD5, 0xA1, 0xB5, 0xDB, 0x40,
+    0xB5, 0xFA, 0x00, 0xB5, 0x52, 0x00, 0x42, 0x4B, 0x12, 0xB4, 0x19, 0xBB,
+    0x81, 0x41, 0x00, 0x14, 0xA6, 0x00, 0x6A, 0x5B, 0x00, 0xB5, 0x2C, 0x21,
+    0xC2, 0x08, 0x77, 0x80, 0x03, 0xBB, 0x30, 0x00, 0xBC, 0x00, 0x00, 0x97,
+    0x00, 0x23, 0xB2, 0x00, 0xBC, 0x50, 0x00, 0xD3, 0x00, 0xB5, 0xD3, 0x00,
+    0xB5, 0xD3, 0x00, 0xB5, 0xD3, 0x00, 0xB5, 0xD3, 0x00, 0xB5, 0xD6, 0x33,
+    0xC5, 0xAA, 0xEB, 0xA3, 0x00, 0xD3, 0x00, 0x00, 0x92, 0x00,
+};
+
+constexpr BitmapFont NotoMono12 = {NotoMono12Glyphs, 491, NotoMono12Bitmaps,
+                                12, 9, 3};
+}  // namespace fonts
@@ -0,0 +1,2924 @@
+#pragma once
+
+// Generated by fonts/font_pipeline.py from include/fonts/NotoMono18pt.h,
+// do not edit
+
+#include "fonts/bitmap_font.h"
+
+namespace fonts {
+constexpr Glyph NotoMono18Glyphs[] = {
+    {0, 0x0020, 0, 0, 11, 0, 0},
+    {0, 0x0021, 3, 13, 11, 4, 13},
+    {20, 0x0022, 7, 4, 11, 2, 13},
+    {34, 0x0023, 11, 13, 11, 0, 13},
+    {106, 0x0024, 9, 15, 11, 1, 14},
+    {174, 0x0025, 11, 13, 11, 0, 13},
+    {246, 0x0026, 10, 13, 11, 1, 13},
+    {311, 0x0027, 3, 4, 11, 4, 13},
+    {317, 0x0028, 5, 16, 11, 3, 13},
+    {357, 0x0029, 5, 16, 11, 3, 13},
+    {397, 0x002A, 9, 8, 11, 1, 14},
+    {433, 0x002B, 9, 9, 11, 1, 11},
+    {474, 0x002C, 3, 4, 11, 4, 2},
+    {480, 0x002D, 5, 2, 11, 3, 6},
+    {485, 0x002E, 2, 2, 11, 4, 2},
+    {487, 0x002F, 7, 13, 11, 2, 13},
+    {533, 0x0030, 9, 13, 11, 1, 13},
+    {592, 0x0031, 5, 13, 11, 2, 13},
+    {625, 0x0032, 9, 13, 11, 1, 13},
+    {684, 0x0033, 9, 13, 11, 1, 13},
+    {743, 0x0034, 10, 13, 11, 1, 13},
+    {808, 0x0035, 9, 13, 11, 1, 13},
+    {867, 0x0036, 9, 13, 11, 1, 13},
+    {926, 0x0037, 9, 13, 11, 1, 13},
+    {985, 0x0038, 9, 13, 11, 1, 13},
+    {1044, 0x0039, 9, 13, 11, 1, 13},
+    {1103, 0x003A, 2, 10, 11, 4, 10},
+    {1113, 0x003B, 3, 12, 11, 3, 10},
+    {1131, 0x003C, 9, 9, 11, 1, 11},
+    {1172, 0x003D, 9, 5, 11, 1, 9},
+    {1195, 0x003E, 9, 9, 11, 1, 11},
+    {1236, 0x003F, 8, 13, 11, 1, 13},
+    {1288, 0x0040, 11, 15, 11, 0, 13},
+    {1371, 0x0041, 11, 13, 11, 0, 13},
+    {1443, 0x0042, 9, 13, 11, 1, 13},
+    {1502, 0x0043, 9, 13, 11, 1, 13},
+    {1561, 0x0044, 9, 13, 11, 1, 13},
+    {1620, 0x0045, 8, 13, 11, 2, 13},
+    {1672, 0x0046, 8, 13, 11, 2, 13},
+    {1724, 0x0047, 9, 13, 11, 1, 13},
+    {1783, 0x0048, 9, 13, 11, 1, 13},
+    {1842, 0x0049, 8, 13, 11, 1, 13},
+    {1894, 0x004A, 8, 13, 11, 1, 13},
+    {1946, 0x004B, 10, 13, 11, 2, 13},
+    {2011, 0x004C, 8, 13, 11, 2, 13},
+    {2063, 0x004D, 9, 13, 11, 1, 13},
+    {2122, 0x004E, 9, 13, 11, 1, 13},
+    {2181, 0x004F, 9, 13, 11, 1, 13},
+    {2240, 0x0050, 9, 13, 11, 1, 13},
+    {2299, 0x0051, 9, 16, 11, 1, 13},
+    {2371, 0x0052, 11, 13, 11, 1, 13},
+    {2443, 0x0053, 9, 13, 11, 1, 13},
+    {2502, 0x0054, 10, 13, 11, 0, 13},
+    {2567, 0x0055, 9, 13, 11, 1, 13},
+    {2626, 0x0056, 11, 13, 11, 0, 13},
+    {2698, 0x0057, 11, 13, 11, 0, 13},
+    {2770, 0x0058, 11, 13, 11, 0, 13},
+    {2842, 0x0059, 10, 13, 11, 0, 13},
+    {2907, 0x005A, 9, 13, 11, 1, 13},
+    {2966, 0x005B, 4, 16, 11, 4, 13},
+    {2998, 0x005C, 7, 13, 11, 2, 13},
+    {3044, 0x005D, 4, 16, 11, 3, 13},
+    {3076, 0x005E, 9, 8, 11, 1, 13},
+    {3112, 0x005F, 11, 2, 11, 0, -2},
+    {3123, 0x0060, 3, 3, 11, 4, 14},
+    {3128, 0x0061, 8, 10, 11, 1, 10},
+    {3168, 0x0062, 9, 14, 11, 1, 14},
+    {3231, 0x0063, 7, 10, 11, 2, 10},
+    {3266, 0x0064, 8, 14, 11, 1, 14},
+    {3322, 0x0065, 9, 10, 11, 1, 10},
+    {3367, 0x0066, 9, 14, 11, 1, 14},
+    {3430, 0x0067, 11, 14, 11, 0, 10},
+    {3507, 0x0068, 8, 14, 11, 1, 14},
+    {3563, 0x0069, 9, 14, 11, 1, 14},
+    {3626, 0x006A, 6, 18, 11, 1, 14},
+    {3680, 0x006B, 9, 14, 11, 2, 14},
+    {3743, 0x006C, 9, 14, 11, 1, 14},
+    {3806, 0x006D, 8, 10, 11, 1, 10},
+    {3846, 0x006E, 8, 10, 11, 1, 10},
+    {3886, 0x006F, 9, 10, 11, 1, 10},
+    {3931, 0x0070, 9, 14, 11, 1, 10},
+    {3994, 0x0071, 8, 14, 11, 1, 10},
+    {4050, 0x0072, 7, 10, 11, 2, 10},
+    {4085, 0x0073, 7, 10, 11, 2, 10},
+    {4120, 0x0074, 7, 13, 11, 2, 13},
+    {4166, 0x0075, 8, 10, 11, 1, 10},
+    {4206, 0x0076, 9, 10, 11, 1, 10},
+    {4251, 0x0077, 11, 10, 11, 0, 10},
+    {4306, 0x0078, 9, 10, 11, 1, 10},
+    {4351, 0x0079, 9, 14, 11, 1, 10},
+    {4414, 0x007A, 7, 10, 11, 2, 10},
+    {4449, 0x007B, 7, 16, 11, 2, 13},
+    {4505, 0x007C, 2, 18, 11, 5, 14},
+    {4523, 0x007D, 7, 16, 11, 2, 13},
+    {4579, 0x007E, 9, 3, 11, 1, 8},
+    {4593, 0x00A0, 0, 0, 11, 0, 0},
+    {4593, 0x00A1, 3, 13, 11, 4, 10},
+    {4613, 0x00A2, 8, 13, 11, 2, 13},
+    {4665, 0x00A3, 9, 13, 11, 1, 13},
+    {4724, 0x00A4, 9, 9, 11, 1, 11},
+    {4765, 0x00A5, 10, 13, 11, 1, 13},
+    {4830, 0x00A6, 2, 18, 11, 5, 14},
+    {4848, 0x00A7, 8, 14, 11, 1, 14},
+    {4904, 0x00A8, 5, 2, 11, 3, 14},
+    {4909, 0x00A9, 11, 13, 11, 0, 13},
+    {4981, 0x00AA, 6, 6, 11, 2, 13},
+    {4999, 0x00AB, 8, 7, 11, 1, 8},
+    {5027, 0x00AC, 9, 5, 11, 1, 7},
+    {5050, 0x00AD, 5, 2, 11, 3, 6},
+    {5055, 0x00AE, 11, 13, 11, 0, 13},
+    {5127, 0x00AF, 11, 2, 11, 0, 16},
+    {5138, 0x00B0, 7, 7, 11, 2, 13},
+    {5163, 0x00B1, 9, 11, 11, 1, 11},
+    {5213, 0x00B2, 5, 7, 11, 3, 13},
+    {5231, 0x00B3, 5, 7, 11, 3, 13},
+    {5249, 0x00B4, 3, 3, 11, 4, 14},
+    {5254, 0x00B5, 8, 14, 11, 1, 10},
+    {5310, 0x00B6, 9, 16, 11, 1, 14},
+    {5382, 0x00B7, 2, 2, 11, 4, 7},
+    {5384, 0x00B8, 3, 4, 11, 4, 0},
+    {5390, 0x00B9, 4, 7, 11, 3, 13},
+    {5404, 0x00BA, 6, 6, 11, 2, 13},
+    {5422, 0x00BB, 8, 7, 11, 2, 8},
+    {5450, 0x00BC, 12, 13, 11, 0, 13},
+    {5528, 0x00BD, 11, 13, 11, 0, 13},
+    {5600, 0x00BE, 12, 13, 11, 0, 13},
+    {5678, 0x00BF, 8, 13, 11, 2, 10},
+    {5730, 0x00C0, 11, 17, 11, 0, 17},
+    {5824, 0x00C1, 11, 17, 11, 0, 17},
+    {5918, 0x00C2, 11, 17, 11, 0, 17},
+    {6012, 0x00C3, 11, 18, 11, 0, 18},
+    {6111, 0x00C4, 11, 16, 11, 0, 16},
+    {6199, 0x00C5, 11, 16, 11, 0, 16},
+    {6287, 0x00C6, 10, 13, 11, 0, 13},
+    {6352, 0x00C7, 9, 17, 11, 1, 13},
+    {6429, 0x00C8, 8, 17, 11, 2, 17},
+    {6497, 0x00C9, 8, 17, 11, 2, 17},
+    {6565, 0x00CA, 8, 17, 11, 2, 17},
+    {6633, 0x00CB, 8, 16, 11, 2, 16},
+    {6697, 0x00CC, 8, 17, 11, 1, 17},
+    {6765, 0x00CD, 8, 17, 11, 1, 17},
+    {6833, 0x00CE, 8, 17, 11, 1, 17},
+    {6901, 0x00CF, 8, 16, 11, 1, 16},
+    {6965, 0x00D0, 10, 13, 11, 0, 13},
+    {7030, 0x00D1, 9, 18, 11, 1, 18},
+    {7111, 0x00D2, 9, 17, 11, 1, 17},
+    {7188, 0x00D3, 9, 17, 11, 1, 17},
+    {7265, 0x00D4, 9, 17, 11, 1, 17},
+    {7342, 0x00D5, 9, 18, 11, 1, 18},
+    {7423, 0x00D6, 9, 16, 11, 1, 16},
+    {7495, 0x00D7, 9, 9, 11, 1, 11},
+    {7536, 0x00D8, 10, 15, 11, 1, 14},
+    {7611, 0x00D9, 9, 17, 11, 1, 17},
+    {7688, 0x00DA, 9, 17, 11, 1, 17},
+    {7765, 0x00DB, 9, 17, 11, 1, 17},
+    {7842, 0x00DC, 9, 16, 11, 1, 16},
+    {7914, 0x00DD, 10, 17, 11, 0, 17},
+    {7999, 0x00DE, 9, 13, 11, 1, 13},
+    {8058, 0x00DF, 9, 14, 11, 1, 14},
+    {8121, 0x00E0, 8, 14, 11, 1, 14},
+    {8177, 0x00E1, 8, 14, 11, 1, 14},
+    {8233, 0x00E2, 8, 14, 11, 1, 14},
+    {8289, 0x00E3, 8, 15, 11, 1, 15},
+    {8349, 0x00E4, 8, 13, 11, 1, 13},
+    {8401, 0x00E5, 8, 15, 11, 1, 15},
+    {8461, 0x00E6, 11, 10, 11, 0, 10},
+    {8516, 0x00E7, 7, 14, 11, 2, 10},
+    {8565, 0x00E8, 9, 14, 11, 1, 14},
+    {8628, 0x00E9, 9, 14, 11, 1, 14},
+    {8691, 0x00EA, 9, 14, 11, 1, 14},
+    {8754, 0x00EB, 9, 13, 11, 1, 13},
+    {8813, 0x00EC, 9, 14, 11, 1, 14},
+    {8876, 0x00ED, 9, 14, 11, 1, 14},
+    {8939, 0x00EE, 9, 14, 11, 1, 14},
+    {9002, 0x00EF, 9, 13, 11, 1, 13},
+    {9061, 0x00F0, 9, 14, 11, 1, 14},
+    {9124, 0x00F1, 8, 15, 11, 1, 15},
+    {9184, 0x00F2, 9, 14, 11, 1, 14},
+    {9247, 0x00F3, 9, 14, 11, 1, 14},
+    {9310, 0x00F4, 9, 14, 11, 1, 14},
+    {9373, 0x00F5, 9, 15, 11, 1, 15},
+    {9441, 0x00F6, 9, 13, 11, 1, 13},
+    {9500, 0x00F7, 8, 10, 11, 2, 11},
+    {9540, 0x00F8, 9, 12, 11, 1, 11},
+    {9594, 0x00F9, 8, 14, 11, 1, 14},
+    {9650, 0x00FA, 8, 14, 11, 1, 14},
+    {9706, 0x00FB, 8, 14, 11, 1, 14},
+    {9762, 0x00FC, 8, 13, 11, 1, 13},
+    {9814, 0x00FD, 9, 18, 11, 1, 14},
+    {9895, 0x00FE, 9, 18, 11, 1, 14},
+    {9976, 0x00FF, 9, 17, 11, 1, 13},
+    {10053, 0x0100, 11, 16, 11, 0, 16},
+    {10141, 0x0101, 8, 13, 11, 1, 13},
+    {10193, 0x0102, 11, 17, 11, 0, 17},
+    {10287, 0x0103, 8, 14, 11, 1, 14},
+    {10343, 0x0104, 12, 17, 11, 0, 13},
+    {10445, 0x0105, 9, 14, 11, 1, 10},
+    {10508, 0x0106, 9, 17, 11, 1, 17},
+    {10585, 0x0107, 7, 14, 11, 2, 14},
+    {10634, 0x0108, 9, 17, 11, 1, 17},
+    {10711, 0x0109, 7, 14, 11, 2, 14},
+    {10760, 0x010A, 9, 16, 11, 1, 16},
+    {10832, 0x010B, 7, 13, 11, 2, 13},
+    {10878, 0x010C, 9, 17, 11, 1, 17},
+    {10955, 0x010D, 7, 14, 11, 2, 14},
+    {11004, 0x010E, 9, 17, 11, 1, 17},
+    {11081, 0x010F, 11, 14, 11, 0, 14},
+    {11158, 0x0110, 10, 13, 11, 0, 13},
+    {11223, 0x0111, 10, 14, 11, 1, 14},
+    {11293, 0x0112, 8, 16, 11, 2, 16},
+    {11357, 0x0113, 9, 13, 11, 1, 13},
+    {11416, 0x0114, 8, 17, 11, 2, 17},
+    {11484, 0x0115, 9, 14, 11, 1, 14},
+    {11547, 0x0116, 8, 16, 11, 2, 16},
+    {11611, 0x0117, 9, 13, 11, 1, 13},
+    {11670, 0x0118, 8, 17, 11, 2, 13},
+    {11738, 0x0119, 9, 14, 11, 1, 10},
+    {11801, 0x011A, 8, 17, 11, 2, 17},
+    {11869, 0x011B, 9, 14, 11, 1, 14},
+    {11932, 0x011C, 9, 17, 11, 1, 17},
+    {12009, 0x011D, 11, 18, 11, 0, 14},
+    {12108, 0x011E, 9, 17, 11, 1, 17},
+    {12185, 0x011F, 11, 18, 11, 0, 14},
+    {12284, 0x0120, 9, 16, 11, 1, 16},
+    {12356, 0x0121, 11, 17, 11, 0, 13},
+    {12450, 0x0122, 9, 17, 11, 1, 13},
+    {12527, 0x0123, 11, 18, 11, 0, 14},
+    {12626, 0x0124, 9, 17, 11, 1, 17},
+    {12703, 0x0125, 8, 18, 11, 1, 18},
+    {12775, 0x0126, 13, 13, 11, -1, 13},
+    {12860, 0x0127, 10, 14, 11, -1, 14},
+    {12930, 0x0128, 8, 18, 11, 1, 18},
+    {13002, 0x0129, 9, 15, 11, 1, 15},
+    {13070, 0x012A, 8, 16, 11, 1, 16},
+    {13134, 0x012B, 9, 13, 11, 1, 13},
+    {13193, 0x012C, 8, 17, 11, 1, 17},
+    {13261, 0x012D, 9, 14, 11, 1, 14},
+    {13324, 0x012E, 8, 17, 11, 1, 13},
+    {13392, 0x012F, 9, 18, 11, 1, 14},
+    {13473, 0x0130, 8, 16, 11, 1, 16},
+    {13537, 0x0131, 9, 10, 11, 1, 10},
+    {13582, 0x0132, 9, 13, 11, 1, 13},
+    {13641, 0x0133, 8, 18, 11, 1, 14},
+    {13713, 0x0134, 10, 17, 11, 1, 17},
+    {13798, 0x0135, 7, 18, 11, 2, 14},
+    {13861, 0x0136, 10, 17, 11, 2, 13},
+    {13946, 0x0137, 9, 18, 11, 2, 14},
+    {14027, 0x0138, 9, 10, 11, 2, 10},
+    {14072, 0x0139, 8, 17, 11, 2, 17},
+    {14140, 0x013A, 9, 18, 11, 1, 18},
+    {14221, 0x013B, 8, 17, 11, 2, 13},
+    {14289, 0x013C, 9, 18, 11, 1, 14},
+    {14370, 0x013D, 8, 13, 11, 2, 13},
+    {14422, 0x013E, 9, 14, 11, 1, 14},
+    {14485, 0x013F, 8, 13, 11, 2, 13},
+    {14537, 0x0140, 9, 14, 11, 1, 14},
+    {14600, 0x0141, 10, 13, 11, 0, 13},
+    {14665, 0x0142, 9, 14, 11, 1, 14},
+    {14728, 0x0143, 9, 17, 11, 1, 17},
+    {14805, 0x0144, 8, 14, 11, 1, 14},
+    {14861, 0x0145, 9, 17, 11, 1, 13},
+    {14938, 0x0146, 8, 14, 11, 1, 10},
+    {14994, 0x0147, 9, 17, 11, 1, 17},
+    {15071, 0x0148, 8, 14, 11, 1, 14},
+    {15127, 0x0149, 10, 14, 11, 0, 14},
+    {15197, 0x014A, 9, 16, 11, 1, 13},
+    {15269, 0x014B, 8, 14, 11, 1, 10},
+    {15325, 0x014C, 9, 16, 11, 1, 16},
+    {15397, 0x014D, 9, 13, 11, 1, 13},
+    {15456, 0x014E, 9, 17, 11, 1, 17},
+    {15533, 0x014F, 9, 14, 11, 1, 14},
+    {15596, 0x0150, 9, 17, 11, 1, 17},
+    {15673, 0x0151, 9, 14, 11, 1, 14},
+    {15736, 0x0152, 10, 13, 11, 0, 13},
+    {15801, 0x0153, 11, 10, 11, 0, 10},
+    {15856, 0x0154, 11, 17, 11, 1, 17},
+    {15950, 0x0155, 7, 14, 11, 2, 14},
+    {15999, 0x0156, 11, 17, 11, 1, 13},
+    {16093, 0x0157, 7, 14, 11, 2, 10},
+    {16142, 0x0158, 11, 17, 11, 1, 17},
+    {16236, 0x0159, 7, 14, 11, 2, 14},
+    {16285, 0x015A, 9, 17, 11, 1, 17},
+    {16362, 0x015B, 7, 14, 11, 2, 14},
+    {16411, 0x015C, 9, 17, 11, 1, 17},
+    {16488, 0x015D, 7, 14, 11, 2, 14},
+    {16537, 0x015E, 9, 17, 11, 1, 13},
+    {16614, 0x015F, 7, 14, 11, 2, 10},
+    {16663, 0x0160, 9, 17, 11, 1, 17},
+    {16740, 0x0161, 7, 14, 11, 2, 14},
+    {16789, 0x0162, 10, 17, 11, 0, 13},
+    {16874, 0x0163, 7, 17, 11, 2, 13},
+    {16934, 0x0164, 10, 17, 11, 0, 17},
+    {17019, 0x0165, 8, 14, 11, 2, 14},
+    {17075, 0x0166, 10, 13, 11, 0, 13},
+    {17140, 0x0167, 7, 13, 11, 2, 13},
+    {17186, 0x0168, 9, 18, 11, 1, 18},
+    {17267, 0x0169, 8, 15, 11, 1, 15},
+    {17327, 0x016A, 9, 16, 11, 1, 16},
+    {17399, 0x016B, 8, 13, 11, 1, 13},
+    {17451, 0x016C, 9, 17, 11, 1, 17},
+    {17528, 0x016D, 8, 14, 11, 1, 14},
+    {17584, 0x016E, 9, 18, 11, 1, 18},
+    {17665, 0x016F, 8, 15, 11, 1, 15},
+    {17725, 0x0170, 9, 17, 11, 1, 17},
+    {17802, 0x0171, 8, 14, 11, 1, 14},
+    {17858, 0x0172, 9, 17, 11, 1, 13},
+    {17935, 0x0173, 9, 14, 11, 1, 10},
+    {17998, 0x0174, 11, 17, 11, 0, 17},
+    {18092, 0x0175, 11, 14, 11, 0, 14},
+    {18169, 0x0176, 10, 17, 11, 0, 17},
+    {18254, 0x0177, 9, 18, 11, 1, 14},
+    {18335, 0x0178, 10, 16, 11, 0, 16},
+    {18415, 0x0179, 9, 17, 11, 1, 17},
+    {18492, 0x017A, 7, 14, 11, 2, 14},
+    {18541, 0x017B, 9, 16, 11, 1, 16},
+    {18613, 0x017C, 7, 13, 11, 2, 13},
+    {18659, 0x017D, 9, 17, 11, 1, 17},
+    {18736, 0x017E, 7, 14, 11, 2, 14},
+    {18785, 0x017F, 6, 14, 11, 3, 14},
+    {18827, 0x0218, 9, 17, 11, 1, 13},
+    {18904, 0x0219, 7, 14, 11, 2, 10},
+    {18953, 0x021A, 10, 17, 11, 0, 13},
+    {19038, 0x021B, 7, 17, 11, 2, 13},
+    {19098, 0x0384, 2, 3, 11, 5, 14},
+    {19101, 0x0385, 6, 4, 11, 2, 16},
+    {19113, 0x0386, 11, 13, 11, 0, 13},
+    {19185, 0x0387, 2, 2, 11, 4, 7},
+    {19187, 0x0388, 10, 13, 11, 0, 13},
+    {19252, 0x0389, 11, 13, 11, -1, 13},
+    {19324, 0x038A, 10, 13, 11, -1, 13},
+    {19389, 0x038C, 11, 13, 11, -1, 13},
+    {19461, 0x038E, 12, 13, 11, -2, 13},
+    {19539, 0x038F, 12, 13, 11, -1, 13},
+    {19617, 0x0390, 7, 16, 11, 2, 16},
+    {19673, 0x0391, 11, 13, 11, 0, 13},
+    {19745, 0x0392, 9, 13, 11, 1, 13},
+    {19804, 0x0393, 9, 13, 11, 2, 13},
+    {19863, 0x0394, 9, 13, 11, 1, 13},
+    {19922, 0x0395, 8, 13, 11, 2, 13},
+    {19974, 0x0396, 9, 13, 11, 1, 13},
+    {20033, 0x0397, 9, 13, 11, 1, 13},
+    {20092, 0x0398, 9, 13, 11, 1, 13},
+    {20151, 0x0399, 8, 13, 11, 1, 13},
+    {20203, 0x039A, 10, 13, 11, 2, 13},
+    {20268, 0x039B, 11, 13, 11, 0, 13},
+    {20340, 0x039C, 9, 13, 11, 1, 13},
+    {20399, 0x039D, 9, 13, 11, 1, 13},
+    {20458, 0x039E, 9, 13, 11, 1, 13},
+    {20517, 0x039F, 9, 13, 11, 1, 13},
+    {20576, 0x03A0, 9, 13, 11, 1, 13},
+    {20635, 0x03A1, 9, 13, 11, 1, 13},
+    {20694, 0x03A3, 9, 13, 11, 1, 13},
+    {20753, 0x03A4, 10, 13, 11, 0, 13},
+    {20818, 0x03A5, 10, 13, 11, 0, 13},
+    {20883, 0x03A6, 10, 13, 11, 0, 13},
+    {20948, 0x03A7, 11, 13, 11, 0, 13},
+    {21020, 0x03A8, 10, 13, 11, 0, 13},
+    {21085, 0x03A9, 11, 13, 11, 0, 13},
+    {21157, 0x03AA, 8, 16, 11, 1, 16},
+    {21221, 0x03AB, 10, 16, 11, 0, 16},
+    {21301, 0x03AC, 10, 14, 11, 1, 14},
+    {21371, 0x03AD, 7, 14, 11, 2, 14},
+    {21420, 0x03AE, 8, 18, 11, 1, 14},
+    {21492, 0x03AF, 5, 14, 11, 4, 14},
+    {21527, 0x03B0, 9, 16, 11, 1, 16},
+    {21599, 0x03B1, 10, 10, 11, 1, 10},
+    {21649, 0x03B2, 9, 18, 11, 1, 14},
+    {21730, 0x03B3, 9, 14, 11, 1, 10},
+    {21793, 0x03B4, 9, 14, 11, 1, 14},
+    {21856, 0x03B5, 7, 10, 11, 2, 10},
+    {21891, 0x03B6, 8, 18, 11, 1, 14},
+    {21963, 0x03B7, 8, 14, 11, 1, 10},
+    {22019, 0x03B8, 9, 13, 11, 1, 13},
+    {22078, 0x03B9, 5, 10, 11, 4, 10},
+    {22103, 0x03BA, 9, 10, 11, 2, 10},
+    {22148, 0x03BB, 10, 14, 11, 1, 14},
+    {22218, 0x03BC, 8, 14, 11, 1, 10},
+    {22274, 0x03BD, 10, 10, 11, 0, 10},
+    {22324, 0x03BE, 7, 18, 11, 2, 14},
+    {22387, 0x03BF, 9, 10, 11, 1, 10},
+    {22432, 0x03C0, 10, 10, 11, 0, 10},
+    {22482, 0x03C1, 9, 14, 11, 1, 10},
+    {22545, 0x03C2, 7, 14, 11, 2, 10},
+    {22594, 0x03C3, 10, 10, 11, 1, 10},
+    {22644, 0x03C4, 9, 10, 11, 1, 10},
+    {22689, 0x03C5, 9, 10, 11, 1, 10},
+    {22734, 0x03C6, 10, 14, 11, 0, 10},
+    {22804, 0x03C7, 10, 14, 11, 0, 10},
+    {22874, 0x03C8, 10, 18, 11, 0, 14},
+    {22964, 0x03C9, 10, 10, 11, 0, 10},
+    {23014, 0x03CA, 6, 13, 11, 3, 13},
+    {23053, 0x03CB, 9, 13, 11, 1, 13},
+    {23112, 0x03CC, 9, 14, 11, 1, 14},
+    {23175, 0x03CD, 9, 14, 11, 1, 14},
+    {23238, 0x03CE, 10, 14, 11, 0, 14},
+    {23308, 0x0400, 8, 17, 11, 2, 17},
+    {23376, 0x0401, 8, 16, 11, 2, 16},
+    {23440, 0x0402, 10, 13, 11, 0, 13},
+    {23505, 0x0403, 9, 17, 11, 2, 17},
+    {23582, 0x0404, 9, 13, 11, 1, 13},
+    {23641, 0x0405, 9, 13, 11, 1, 13},
+    {23700, 0x0406, 8, 13, 11, 1, 13},
+    {23752, 0x0407, 8, 16, 11, 1, 16},
+    {23816, 0x0408, 8, 13, 11, 1, 13},
+    {23868, 0x0409, 11, 13, 11, 0, 13},
+    {23940, 0x040A, 10, 13, 11, 1, 13},
+    {24005, 0x040B, 10, 13, 11, 0, 13},
+    {24070, 0x040C, 10, 17, 11, 2, 17},
+    {24155, 0x040D, 9, 17, 11, 1, 17},
+    {24232, 0x040E, 11, 17, 11, 0, 17},
+    {24326, 0x040F, 9, 16, 11, 1, 13},
+    {24398, 0x0410, 11, 13, 11, 0, 13},
+    {24470, 0x0411, 9, 13, 11, 1, 13},
+    {24529, 0x0412, 9, 13, 11, 1, 13},
+    {24588, 0x0413, 9, 13, 11, 2, 13},
+    {24647, 0x0414, 11, 16, 11, 0, 13},
+    {24735, 0x0415, 8, 13, 11, 2, 13},
+    {24787, 0x0416, 12, 13, 11, -1, 13},
+    {24865, 0x0417, 9, 13, 11, 1, 13},
+    {24924, 0x0418, 9, 13, 11, 1, 13},
+    {24983, 0x0419, 9, 17, 11, 1, 17},
+    {25060, 0x041A, 10, 13, 11, 2, 13},
+    {25125, 0x041B, 10, 13, 11, 0, 13},
+    {25190, 0x041C, 9, 13, 11, 1, 13},
+    {25249, 0x041D, 9, 13, 11, 1, 13},
+    {25308, 0x041E, 9, 13, 11, 1, 13},
+    {25367, 0x041F, 9, 13, 11, 1, 13},
+    {25426, 0x0420, 9, 13, 11, 1, 13},
+    {25485, 0x0421, 9, 13, 11, 1, 13},
+    {25544, 0x0422, 10, 13, 11, 0, 13},
+    {25609, 0x0423, 11, 13, 11, 0, 13},
+    {25681, 0x0424, 10, 13, 11, 0, 13},
+    {25746, 0x0425, 11, 13, 11, 0, 13},
+    {25818, 0x0426, 10, 16, 11, 1, 13},
+    {25898, 0x0427, 9, 13, 11, 1, 13},
+    {25957, 0x0428, 10, 13, 11, 0, 13},
+    {26022, 0x0429, 11, 16, 11, 0, 13},
+    {26110, 0x042A, 10, 13, 11, 0, 13},
+    {26175, 0x042B, 9, 13, 11, 1, 13},
+    {26234, 0x042C, 9, 13, 11, 1, 13},
+    {26293, 0x042D, 10, 13, 11, 0, 13},
+    {26358, 0x042E, 9, 13, 11, 1, 13},
+    {26417, 0x042F, 11, 13, 11, -1, 13},
+    {26489, 0x0430, 8, 10, 11, 1, 10},
+    {26529, 0x0431, 9, 14, 11, 1, 14},
+    {26592, 0x0432, 9, 10, 11, 1, 10},
+    {26637, 0x0433, 6, 10, 11, 3, 10},
+    {26667, 0x0434, 10, 13, 11, 0, 10},
+    {26732, 0x0435, 9, 10, 11, 1, 10},
+    {26777, 0x0436, 12, 10, 11, -1, 10},
+    {26837, 0x0437, 7, 10, 11, 2, 10},
+    {26872, 0x0438, 8, 10, 11, 1, 10},
+    {26912, 0x0439, 8, 14, 11, 1, 14},
+    {26968, 0x043A, 9, 10, 11, 1, 10},
+    {27013, 0x043B, 9, 10, 11, 0, 10},
+    {27058, 0x043C, 9, 10, 11, 1, 10},
+    {27103, 0x043D, 8, 10, 11, 1, 10},
+    {27143, 0x043E, 9, 10, 11, 1, 10},
+    {27188, 0x043F, 8, 10, 11, 1, 10},
+    {27228, 0x0440, 9, 14, 11, 1, 10},
+    {27291, 0x0441, 7, 10, 11, 2, 10},
+    {27326, 0x0442, 10, 10, 11, 0, 10},
+    {27376, 0x0443, 9, 14, 11, 1, 10},
+    {27439, 0x0444, 10, 18, 11, 0, 14},
+    {27529, 0x0445, 9, 10, 11, 1, 10},
+    {27574, 0x0446, 9, 13, 11, 1, 10},
+    {27633, 0x0447, 8, 10, 11, 1, 10},
+    {27673, 0x0448, 10, 10, 11, 0, 10},
+    {27723, 0x0449, 11, 13, 11, 0, 10},
+    {27795, 0x044A, 10, 10, 11, 0, 10},
+    {27845, 0x044B, 9, 10, 11, 1, 10},
+    {27890, 0x044C, 9, 10, 11, 1, 10},
+    {27935, 0x044D, 7, 10, 11, 2, 10},
+    {27970, 0x044E, 9, 10, 11, 1, 10},
+    {28015, 0x044F, 9, 10, 11, 0, 10},
+    {28060, 0x0450, 9, 14, 11, 1, 14},
+    {28123, 0x0451, 9, 13, 11, 1, 13},
+    {28182, 0x0452, 10, 18, 11, -1, 14},
+    {28272, 0x0453, 6, 14, 11, 3, 14},
+    {28314, 0x0454, 8, 10, 11, 2, 10},
+    {28354, 0x0455, 7, 10, 11, 2, 10},
+    {28389, 0x0456, 9, 14, 11, 1, 14},
+    {28452, 0x0457, 9, 13, 11, 1, 13},
+    {28511, 0x0458, 6, 18, 11, 1, 14},
+    {28565, 0x0459, 11, 10, 11, 0, 10},
+    {28620, 0x045A, 10, 10, 11, 1, 10},
+    {28670, 0x045B, 10, 14, 11, -1, 14},
+    {28740, 0x045C, 9, 14, 11, 2, 14},
+    {28803, 0x045D, 8, 14, 11, 1, 14},
+    {28859, 0x045E, 9, 18, 11, 1, 14},
+    {28940, 0x045F, 8, 13, 11, 1, 10},
+};
+
+constexpr uint8_t NotoMono18Bitmaps[] = {
+    0xCF, 0x1C, 0xF0, 0xBF, 0x0A, 0xE0, 0x9D, 0x09, 0xC0, 0x8C, 0x07, 0xB0,
+    0x6A, 0x00, 0x00, 0x45, 0x0E, 0xF3, 0xBD, 0x10, 0xEF, 0x00, 0xEF, 0x0D,
+    0xE0, 0x0D, 0xE0, 0xCD, 0x00, 0xCD, 0x0A, 0xB0, 0x0A, 0xB0, 0x00, 0x07,
+    0xD0, 0x00, 0x7D, 0x00, 0x00, 0xB9, 0x00, 0x0B, 0x90, 0x00, 0x0E, 0x50,
+    0x00, 0xE5, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x9E, 0x55, 0x59,
+    0xE5, 0x50, 0x08, 0xC0, 0x00, 0x8B, 0x00, 0x00, 0xB9, 0x00, 0x0B, 0x90,
+    0x00, 0x0E, 0x60, 0x00, 0xD6, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05,
+    0x8F, 0x55, 0x58, 0xF5, 0x50, 0x07, 0xD0, 0x00, 0x7D, 0x00, 0x00, 0xA9,
+    0x00, 0x0A, 0x90, 0x00, 0x0E, 0x60, 0x00, 0xD6, 0x00, 0x00, 0x00, 0x00,
+    0xF3, 0x00, 0x00, 0x00, 0x0F, 0x30, 0x00, 0x04, 0xBE, 0xFF, 0xDB, 0x58,
+    0xFB, 0x6F, 0x77, 0xB5, 0xEB, 0x00, 0xF3, 0x00, 0x0D, 0xD1, 0x0F, 0x30,
+    0x00, 0x4E, 0xE9, 0xF3, 0x00, 0x00, 0x28, 0xCF, 0xEA, 0x30, 0x00, 0x00,
+    0xF9, 0xDF, 0x60, 0x00, 0x0F, 0x30, 0xCD, 0x00, 0x00, 0xF3, 0x0B, 0xDE,
+    0xA7, 0x6F, 0x9B, 0xF7, 0x8C, 0xEF, 0xFD, 0xA4, 0x00, 0x00, 0x0F, 0x30,
+    0x00, 0x00, 0x00, 0xF3, 0x00, 0x00, 0x2B, 0xEB, 0x20, 0x09, 0xC0, 0x0A,
+    0xA2, 0xAA, 0x01, 0xE5, 0x00, 0xE4, 0x04, 0xE0, 0x7E, 0x00, 0x0E, 0x40,
+    0x4E, 0x0D, 0x70, 0x00, 0xAA, 0x2A, 0xA5, 0xF1, 0x00, 0x02, 0xBE, 0xB2,
+    0xC9, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x30, 0x00, 0x00, 0x00, 0x09, 0xB2,
+    0xBE, 0xB2, 0x00, 0x01, 0xF5, 0xAA, 0x2A, 0xA0, 0x00, 0x7D, 0x0E, 0x40,
+    0x4E, 0x00, 0x0E, 0x70, 0xE4, 0x04, 0xE0, 0x05, 0xE1, 0x0A, 0xA2, 0xAA,
+    0x00, 0xC9, 0x00, 0x2B, 0xEB, 0x20, 0x01, 0xAE, 0xEA, 0x10, 0x00, 0x0A,
+    0xF7, 0x7F, 0xA0, 0x00, 0x0E, 0xA0, 0x0A, 0xE0, 0x00, 0x0D, 0xB0, 0x0B,
+    0xD0, 0x00, 0x08, 0xF4, 0x7F, 0x60, 0x00, 0x01, 0xDF, 0xF7, 0x00, 0x00,
+    0x06, 0xEF, 0xC0, 0x00, 0x00, 0x5F, 0x95, 0xF9, 0x0A, 0xD0, 0xCD, 0x00,
+    0x8F, 0x6D, 0xA0, 0xFA, 0x00, 0x0B, 0xFF, 0x50, 0xDD, 0x00, 0x03, 0xFF,
+    0x20, 0x7F, 0xB6, 0x8E, 0xDE, 0xC0, 0x07, 0xDF, 0xD8, 0x15, 0xF9, 0xEF,
+    0x0D, 0xE0, 0xCD, 0x0A, 0xB0, 0x00, 0x2E, 0x90, 0x1D, 0xB0, 0x08, 0xF2,
+    0x02, 0xF9, 0x00, 0x6F, 0x40, 0x0B, 0xE0, 0x00, 0xDC, 0x00, 0x0E, 0xB0,
+    0x00, 0xEB, 0x00, 0x0D, 0xC0, 0x00, 0xBE, 0x00, 0x07, 0xF4, 0x00, 0x2F,
+    0x90, 0x00, 0x9F, 0x20, 0x01, 0xDB, 0x00, 0x03, 0xE9, 0x9E, 0x20, 0x00,
+    0xBD, 0x10, 0x02, 0xF8, 0x00, 0x09, 0xF2, 0x00, 0x4F, 0x60, 0x00, 0xEB,
+    0x00, 0x0C, 0xD0, 0x00, 0xBE, 0x00, 0x0B, 0xE0, 0x00, 0xCD, 0x00, 0x0E,
+    0xB0, 0x04, 0xF7, 0x00, 0x9F, 0x20, 0x2F, 0x90, 0x0B, 0xD1, 0x09, 0xE3,
+    0x00, 0x00, 0x05, 0xF6, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x45, 0x11,
+    0xF2, 0x04, 0x49, 0xFF, 0xBF, 0xBE, 0xFB, 0x13, 0x4B, 0xFC, 0x43, 0x20,
+    0x04, 0xF7, 0xF5, 0x00, 0x01, 0xEC, 0x0B, 0xE2, 0x00, 0x2A, 0x50, 0x3B,
+    0x30, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x0F, 0x50, 0x00, 0x00, 0x00,
+    0xF5, 0x00, 0x00, 0x00, 0x0F, 0x50, 0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0xB2,
+    0x55, 0x5F, 0x85, 0x53, 0x00, 0x00, 0xF5, 0x00, 0x00, 0x00, 0x0F, 0x50,
+    0x00, 0x00, 0x00, 0xB3, 0x00, 0x00, 0x1F, 0xD5, 0xF7, 0x9E, 0x1D, 0x80,
+    0xFF, 0xFF, 0xF7, 0x77, 0x77, 0xBB, 0xBB, 0x00, 0x00, 0x0C, 0xC0, 0x00,
+    0x03, 0xF6, 0x00, 0x00, 0x9E, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x07, 0xF2,
+    0x00, 0x00, 0xDA, 0x00, 0x00, 0x4F, 0x40, 0x00, 0x0B, 0xD0, 0x00, 0x02,
+    0xF7, 0x00, 0x00, 0x8E, 0x10, 0x00, 0x0E, 0x90, 0x00, 0x06, 0xF3, 0x00,
+    0x00, 0xCC, 0x00, 0x00, 0x00, 0x01, 0x8D, 0xFD, 0x80, 0x00, 0xBF, 0x85,
+    0x8F, 0xA0, 0x5F, 0x60, 0x00, 0x6F, 0x4A, 0xE0, 0x00, 0x00, 0xFA, 0xDC,
+    0x00, 0x00, 0x0C, 0xDE, 0xA0, 0x00, 0x00, 0xAE, 0xFA, 0x00, 0x00, 0x0A,
+    0xFE, 0xA0, 0x00, 0x00, 0xAE, 0xDC, 0x00, 0x00, 0x0C, 0xDA, 0xE0, 0x00,
+    0x00, 0xFA, 0x4F, 0x60, 0x00, 0x6F, 0x50, 0xAF, 0x85, 0x8F, 0xB0, 0x00,
+    0x8D, 0xFD, 0x81, 0x00, 0x00, 0x5F, 0x90, 0x7F, 0xF9, 0x9F, 0x6E, 0x98,
+    0x60, 0xF9, 0x00, 0x0F, 0x90, 0x00, 0xF9, 0x00, 0x0F, 0x90, 0x00, 0xF9,
+    0x00, 0x0F, 0x90, 0x00, 0xF9, 0x00, 0x0F, 0x90, 0x00, 0xF9, 0x00, 0x0F,
+    0x90, 0x04, 0xAE, 0xFD, 0xA3, 0x08, 0xFD, 0x85, 0x7C, 0xF5, 0x15, 0x00,
+    0x00, 0x1D, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0D, 0xC0,
+    0x00, 0x00, 0x05, 0xF6, 0x00, 0x00, 0x03, 0xEA, 0x00, 0x00, 0x04, 0xEA,
+    0x00, 0x00, 0x05, 0xF9, 0x00, 0x00, 0x07, 0xF7, 0x00, 0x00, 0x09, 0xE5,
+    0x00, 0x00, 0x0A, 0xF8, 0x55, 0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
+    0x16, 0xBE, 0xFD, 0xA4, 0x0A, 0xFB, 0x75, 0x7D, 0xF6, 0x13, 0x00, 0x00,
+    0x1D, 0xD0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x1E, 0xB0, 0x00,
+    0x02, 0x5D, 0xD2, 0x00, 0xFF, 0xFE, 0x81, 0x00, 0x05, 0x56, 0x9E, 0xD3,
+    0x00, 0x00, 0x00, 0x1E, 0xC0, 0x00, 0x00, 0x00, 0xBE, 0x10, 0x00, 0x00,
+    0x2E, 0xCE, 0xA7, 0x56, 0x8E, 0xE4, 0x7C, 0xEF, 0xFD, 0x92, 0x00, 0x00,
+    0x00, 0x02, 0xEF, 0x00, 0x00, 0x00, 0x0B, 0xEF, 0x00, 0x00, 0x00, 0x7E,
+    0x9F, 0x00, 0x00, 0x02, 0xF7, 0x8F, 0x00, 0x00, 0x0C, 0xC0, 0x9F, 0x00,
+    0x00, 0x8E, 0x20, 0x9F, 0x00, 0x03, 0xF5, 0x00, 0x9F, 0x00, 0x1D, 0xA0,
+    0x00, 0x9F, 0x00, 0x9D, 0x10, 0x00, 0x9F, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFD, 0x55, 0x55, 0x55, 0xBF, 0x54, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00,
+    0x00, 0x00, 0x9F, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0x0A, 0xD5, 0x55, 0x55,
+    0x50, 0xBC, 0x00, 0x00, 0x00, 0x0C, 0xA0, 0x00, 0x00, 0x00, 0xD9, 0x00,
+    0x00, 0x00, 0x0E, 0xED, 0xFE, 0xC7, 0x10, 0x68, 0x65, 0x7A, 0xEE, 0x30,
+    0x00, 0x00, 0x03, 0xFB, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00,
+    0xCE, 0x10, 0x00, 0x00, 0x3F, 0x9E, 0xA7, 0x56, 0x9E, 0xD2, 0x7C, 0xEF,
+    0xEC, 0x71, 0x00, 0x00, 0x17, 0xCE, 0xFE, 0x00, 0x2D, 0xE9, 0x65, 0x70,
+    0x0C, 0xD2, 0x00, 0x00, 0x05, 0xF5, 0x00, 0x00, 0x00, 0xAE, 0x00, 0x00,
+    0x00, 0x0D, 0xC4, 0xCE, 0xEB, 0x40, 0xED, 0xD7, 0x46, 0xCF, 0x4F, 0xE2,
+    0x00, 0x01, 0xDC, 0xEB, 0x00, 0x00, 0x0A, 0xFB, 0xD0, 0x00, 0x00, 0xBE,
+    0x6F, 0x60, 0x00, 0x2E, 0xA0, 0xBF, 0x96, 0x7E, 0xE3, 0x00, 0x7D, 0xFE,
+    0xA2, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x55, 0x55, 0x55, 0xDD, 0x00,
+    0x00, 0x00, 0x3F, 0x60, 0x00, 0x00, 0x09, 0xE0, 0x00, 0x00, 0x02, 0xF7,
+    0x00, 0x00, 0x00, 0x8F, 0x10, 0x00, 0x00, 0x1E, 0x90, 0x00, 0x00, 0x07,
+    0xF2, 0x00, 0x00, 0x00, 0xEB, 0x00, 0x00, 0x00, 0x6F, 0x40, 0x00, 0x00,
+    0x0D, 0xC0, 0x00, 0x00, 0x05, 0xF6, 0x00, 0x00, 0x00, 0xCE, 0x00, 0x00,
+    0x00, 0x04, 0xAD, 0xFD, 0xA4, 0x07, 0xFC, 0x75, 0x7C, 0xF7, 0xEC, 0x00,
+    0x00, 0x0C, 0xEE, 0xA0, 0x00, 0x00, 0xBD, 0x8F, 0x50, 0x01, 0x8F, 0x60,
+    0x8F, 0xCA, 0xEC, 0x40, 0x03, 0xDF, 0xEE, 0x71, 0x04, 0xEC, 0x20, 0x6E,
+    0xC2, 0xCD, 0x10, 0x00, 0x2E, 0xBF, 0xA0, 0x00, 0x00, 0xAE, 0xDC, 0x00,
+    0x00, 0x1D, 0xD6, 0xFC, 0x65, 0x7D, 0xF4, 0x04, 0xBD, 0xFD, 0xA3, 0x00,
+    0x02, 0xAE, 0xFD, 0x70, 0x03, 0xED, 0x76, 0x9F, 0xA0, 0xAE, 0x20, 0x00,
+    0x6F, 0x5E, 0xA0, 0x00, 0x00, 0xDB, 0xFA, 0x00, 0x00, 0x0B, 0xEC, 0xD1,
+    0x00, 0x02, 0xEF, 0x5F, 0xC5, 0x47, 0xDD, 0xE0, 0x4B, 0xEF, 0xC4, 0xCD,
+    0x00, 0x00, 0x00, 0x0E, 0xA0, 0x00, 0x00, 0x05, 0xF5, 0x00, 0x00, 0x02,
+    0xDC, 0x00, 0x64, 0x58, 0xED, 0x20, 0x0E, 0xFE, 0xC7, 0x10, 0x00, 0xBB,
+    0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0x0B, 0xB0, 0xBB,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD4, 0xF7,
+    0x8E, 0x1D, 0x80, 0x00, 0x00, 0x00, 0x05, 0xC0, 0x00, 0x01, 0x6D, 0xF9,
+    0x00, 0x18, 0xEE, 0x81, 0x02, 0x9F, 0xD6, 0x10, 0x00, 0xFF, 0x90, 0x00,
+    0x00, 0x03, 0x9F, 0xD6, 0x10, 0x00, 0x00, 0x28, 0xEE, 0x81, 0x00, 0x00,
+    0x01, 0x6D, 0xF9, 0x00, 0x00, 0x00, 0x05, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xF5, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55,
+    0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xC5, 0x00, 0x00, 0x00, 0x09,
+    0xFD, 0x61, 0x00, 0x00, 0x01, 0x8E, 0xE8, 0x10, 0x00, 0x00, 0x16, 0xDF,
+    0x92, 0x00, 0x00, 0x00, 0x9F, 0xF0, 0x00, 0x16, 0xDF, 0x93, 0x01, 0x8E,
+    0xE8, 0x20, 0x09, 0xFD, 0x61, 0x00, 0x00, 0xC5, 0x00, 0x00, 0x00, 0x00,
+    0x5A, 0xDE, 0xEB, 0x50, 0xBD, 0x86, 0x6B, 0xF8, 0x10, 0x00, 0x00, 0xCE,
+    0x00, 0x00, 0x00, 0xAE, 0x00, 0x00, 0x03, 0xE9, 0x00, 0x00, 0x6E, 0xB1,
+    0x00, 0x0A, 0xF7, 0x00, 0x00, 0x6F, 0x40, 0x00, 0x00, 0x9C, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0xEE, 0x00, 0x00,
+    0x00, 0xCC, 0x00, 0x00, 0x00, 0x07, 0xCE, 0xEB, 0x40, 0x00, 0x1C, 0xD6,
+    0x33, 0x8F, 0x50, 0x0A, 0xC1, 0x00, 0x00, 0x6E, 0x23, 0xF2, 0x00, 0x00,
+    0x00, 0xC8, 0x8B, 0x00, 0x8E, 0xEC, 0x27, 0xCC, 0x70, 0x6E, 0x45, 0xF2,
+    0x4E, 0xE5, 0x0C, 0x70, 0x3F, 0x14, 0xFF, 0x40, 0xE4, 0x04, 0xF0, 0x4E,
+    0xE4, 0x0E, 0x40, 0x6F, 0x06, 0xCD, 0x60, 0xAB, 0x3C, 0xD5, 0xC7, 0xA9,
+    0x02, 0xCE, 0x74, 0xEB, 0x15, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xA0,
+    0x00, 0x00, 0x00, 0x00, 0x2D, 0xC5, 0x33, 0x59, 0x40, 0x00, 0x18, 0xCE,
+    0xED, 0x81, 0x00, 0x00, 0x00, 0x8F, 0x80, 0x00, 0x00, 0x00, 0x0D, 0xED,
+    0x00, 0x00, 0x00, 0x04, 0xF8, 0xF4, 0x00, 0x00, 0x00, 0x9F, 0x1F, 0x90,
+    0x00, 0x00, 0x0E, 0xB0, 0xBE, 0x00, 0x00, 0x05, 0xF6, 0x06, 0xF5, 0x00,
+    0x00, 0xAF, 0x10, 0x1F, 0xA0, 0x00, 0x1F, 0xC0, 0x00, 0xCF, 0x10, 0x06,
+    0xFF, 0xFF, 0xFF, 0xF6, 0x00, 0xBF, 0x77, 0x77, 0x7F, 0xB0, 0x2F, 0xA0,
+    0x00, 0x00, 0xAF, 0x27, 0xF4, 0x00, 0x00, 0x04, 0xF7, 0xCD, 0x00, 0x00,
+    0x00, 0x0D, 0xC0, 0xFF, 0xFF, 0xFE, 0xC7, 0x0F, 0xC6, 0x66, 0x8C, 0xF9,
+    0xFA, 0x00, 0x00, 0x0D, 0xEF, 0xA0, 0x00, 0x00, 0xCE, 0xFA, 0x00, 0x02,
+    0x7F, 0x6F, 0xFF, 0xFF, 0xFC, 0x30, 0xFC, 0x66, 0x69, 0xEC, 0x2F, 0xA0,
+    0x00, 0x03, 0xFA, 0xFA, 0x00, 0x00, 0x0C, 0xEF, 0xA0, 0x00, 0x00, 0xCE,
+    0xFA, 0x00, 0x00, 0x3F, 0xBF, 0xC6, 0x66, 0x8E, 0xF3, 0xFF, 0xFF, 0xFE,
+    0xB3, 0x00, 0x00, 0x29, 0xDF, 0xEC, 0x60, 0x4E, 0xFA, 0x78, 0xCA, 0x1E,
+    0xE3, 0x00, 0x00, 0x07, 0xF6, 0x00, 0x00, 0x00, 0xCF, 0x00, 0x00, 0x00,
+    0x0E, 0xC0, 0x00, 0x00, 0x00, 0xFB, 0x00, 0x00, 0x00, 0x0E, 0xC0, 0x00,
+    0x00, 0x00, 0xCE, 0x00, 0x00, 0x00, 0x08, 0xF5, 0x00, 0x00, 0x00, 0x2E,
+    0xE3, 0x00, 0x00, 0x00, 0x5F, 0xFA, 0x77, 0x9D, 0x00, 0x29, 0xDF, 0xED,
+    0x90, 0xFF, 0xFE, 0xD8, 0x20, 0x0F, 0xC6, 0x7A, 0xFE, 0x40, 0xFA, 0x00,
+    0x02, 0xDE, 0x1F, 0xA0, 0x00, 0x05, 0xF8, 0xFA, 0x00, 0x00, 0x0E, 0xCF,
+    0xA0, 0x00, 0x00, 0xCE, 0xFA, 0x00, 0x00, 0x0B, 0xFF, 0xA0, 0x00, 0x00,
+    0xCE, 0xFA, 0x00, 0x00, 0x0F, 0xBF, 0xA0, 0x00, 0x06, 0xF7, 0xFA, 0x00,
+    0x03, 0xED, 0x1F, 0xC6, 0x7B, 0xFE, 0x30, 0xFF, 0xFE, 0xC8, 0x10, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x77, 0x77, 0x77, 0xFA, 0x00, 0x00, 0x00,
+    0xFA, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFC, 0x77, 0x77, 0x77, 0xFA, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00,
+    0xFA, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0xFC, 0x77, 0x77, 0x77,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x77, 0x77, 0x77,
+    0xFA, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x77, 0x77, 0x77, 0xFA, 0x00, 0x00, 0x00,
+    0xFA, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00,
+    0xFA, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x29, 0xDF, 0xEB,
+    0x50, 0x4E, 0xE9, 0x79, 0xD7, 0x1E, 0xD2, 0x00, 0x00, 0x08, 0xF5, 0x00,
+    0x00, 0x00, 0xCE, 0x00, 0x00, 0x00, 0x0E, 0xC0, 0x00, 0xDF, 0xFF, 0xFB,
+    0x00, 0x06, 0x7C, 0xFE, 0xC0, 0x00, 0x00, 0xAF, 0xCE, 0x00, 0x00, 0x0A,
+    0xF8, 0xF4, 0x00, 0x00, 0xAF, 0x2F, 0xC1, 0x00, 0x0A, 0xF0, 0x6F, 0xE8,
+    0x78, 0xDF, 0x00, 0x4B, 0xEF, 0xDB, 0x60, 0xFA, 0x00, 0x00, 0x0A, 0xFF,
+    0xA0, 0x00, 0x00, 0xAF, 0xFA, 0x00, 0x00, 0x0A, 0xFF, 0xA0, 0x00, 0x00,
+    0xAF, 0xFA, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x77,
+    0x77, 0x7C, 0xFF, 0xA0, 0x00, 0x00, 0xAF, 0xFA, 0x00, 0x00, 0x0A, 0xFF,
+    0xA0, 0x00, 0x00, 0xAF, 0xFA, 0x00, 0x00, 0x0A, 0xFF, 0xA0, 0x00, 0x00,
+    0xAF, 0xFA, 0x00, 0x00, 0x0A, 0xF0, 0x3F, 0xFF, 0xFF, 0xF9, 0x14, 0x5C,
+    0xF5, 0x42, 0x00, 0x09, 0xF0, 0x00, 0x00, 0x09, 0xF0, 0x00, 0x00, 0x09,
+    0xF0, 0x00, 0x00, 0x09, 0xF0, 0x00, 0x00, 0x09, 0xF0, 0x00, 0x00, 0x09,
+    0xF0, 0x00, 0x00, 0x09, 0xF0, 0x00, 0x00, 0x09, 0xF0, 0x00, 0x00, 0x09,
+    0xF0, 0x00, 0x14, 0x5C, 0xF5, 0x42, 0x3F, 0xFF, 0xFF, 0xF9, 0x00, 0x00,
+    0x00, 0xAF, 0x00, 0x00, 0x00, 0xAF, 0x00, 0x00, 0x00, 0xAF, 0x00, 0x00,
+    0x00, 0xAF, 0x00, 0x00, 0x00, 0xAF, 0x00, 0x00, 0x00, 0xAF, 0x00, 0x00,
+    0x00, 0xAF, 0x00, 0x00, 0x00, 0xAF, 0x00, 0x00, 0x00, 0xAF, 0x00, 0x00,
+    0x00, 0xCE, 0x00, 0x00, 0x04, 0xFA, 0xD9, 0x77, 0xAF, 0xD2, 0xAD, 0xFF,
+    0xD8, 0x10, 0xFA, 0x00, 0x00, 0x4F, 0xB0, 0xFA, 0x00, 0x02, 0xEC, 0x10,
+    0xFA, 0x00, 0x2D, 0xC1, 0x00, 0xFA, 0x01, 0xCD, 0x10, 0x00, 0xFA, 0x0B,
+    0xD2, 0x00, 0x00, 0xFA, 0x9F, 0x20, 0x00, 0x00, 0xFE, 0xDE, 0x70, 0x00,
+    0x00, 0xFD, 0x26, 0xF3, 0x00, 0x00, 0xFA, 0x00, 0xBD, 0x10, 0x00, 0xFA,
+    0x00, 0x2E, 0xA0, 0x00, 0xFA, 0x00, 0x06, 0xF6, 0x00, 0xFA, 0x00, 0x00,
+    0xBF, 0x30, 0xFA, 0x00, 0x00, 0x2E, 0xD1, 0xFA, 0x00, 0x00, 0x00, 0xFA,
+    0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0xFA,
+    0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0xFA,
+    0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0xFA,
+    0x00, 0x00, 0x00, 0xFC, 0x77, 0x77, 0x77, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD,
+    0x00, 0x00, 0x0D, 0xFF, 0xE2, 0x00, 0x02, 0xFF, 0xFC, 0x50, 0x00, 0x6C,
+    0xFF, 0xA9, 0x00, 0x09, 0xAF, 0xFA, 0xA0, 0x00, 0xAB, 0xFF, 0xB9, 0x20,
+    0x38, 0xBF, 0xFB, 0x66, 0x07, 0x5B, 0xFF, 0xB3, 0xA0, 0xB2, 0xBF, 0xFB,
+    0x0D, 0x0D, 0x0B, 0xFF, 0xB0, 0xB5, 0xA0, 0xBF, 0xFB, 0x08, 0xD7, 0x0B,
+    0xFF, 0xB0, 0x5F, 0x40, 0xBF, 0xFB, 0x02, 0xF1, 0x0B, 0xF0, 0xFD, 0x00,
+    0x00, 0x08, 0xFF, 0xF7, 0x00, 0x00, 0x8F, 0xFC, 0xE1, 0x00, 0x08, 0xFF,
+    0x7D, 0x80, 0x00, 0x8F, 0xF7, 0x5F, 0x20, 0x08, 0xFF, 0x80, 0xBA, 0x00,
+    0x8F, 0xF8, 0x03, 0xF3, 0x08, 0xFF, 0x80, 0x0A, 0xC0, 0x8F, 0xF8, 0x00,
+    0x2F, 0x57, 0xFF, 0x80, 0x00, 0x8D, 0x7F, 0xF8, 0x00, 0x01, 0xEC, 0xFF,
+    0x80, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x0D, 0xF0, 0x01, 0x8D, 0xFD,
+    0x80, 0x00, 0xBF, 0xA7, 0xAF, 0xA0, 0x5F, 0x90, 0x00, 0x8F, 0x4A, 0xF2,
+    0x00, 0x01, 0xF9, 0xDD, 0x00, 0x00, 0x0D, 0xDE, 0xC0, 0x00, 0x00, 0xCE,
+    0xFB, 0x00, 0x00, 0x0B, 0xFE, 0xC0, 0x00, 0x00, 0xCE, 0xDD, 0x00, 0x00,
+    0x0D, 0xDA, 0xF2, 0x00, 0x02, 0xF9, 0x5F, 0x90, 0x00, 0x8F, 0x40, 0xBF,
+    0xA7, 0xAF, 0xA0, 0x01, 0x8D, 0xFD, 0x70, 0x00, 0xFF, 0xFF, 0xFD, 0xA4,
+    0x0F, 0xC6, 0x67, 0x9E, 0xF5, 0xFA, 0x00, 0x00, 0x3F, 0xDF, 0xA0, 0x00,
+    0x00, 0xCF, 0xFA, 0x00, 0x00, 0x0E, 0xDF, 0xA0, 0x01, 0x3B, 0xF6, 0xFF,
+    0xFF, 0xFF, 0xE6, 0x0F, 0xC6, 0x65, 0x30, 0x00, 0xFA, 0x00, 0x00, 0x00,
+    0x0F, 0xA0, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0x0F, 0xA0, 0x00,
+    0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x01, 0x8D, 0xFD, 0x80, 0x00,
+    0xBF, 0xA7, 0xAF, 0xA0, 0x5F, 0x90, 0x00, 0x8F, 0x4A, 0xF2, 0x00, 0x01,
+    0xF9, 0xDD, 0x00, 0x00, 0x0D, 0xDE, 0xC0, 0x00, 0x00, 0xCE, 0xFB, 0x00,
+    0x00, 0x0B, 0xFE, 0xC0, 0x00, 0x00, 0xCE, 0xDD, 0x00, 0x00, 0x0D, 0xDA,
+    0xF2, 0x00, 0x02, 0xF9, 0x5F, 0x90, 0x00, 0x8F, 0x40, 0xBF, 0xA7, 0xAF,
+    0x90, 0x01, 0x8D, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x8F, 0x50, 0x00, 0x00,
+    0x01, 0xCF, 0x70, 0x00, 0x00, 0x01, 0xA6, 0xFF, 0xFF, 0xED, 0x93, 0x00,
+    0x0F, 0xC6, 0x67, 0x9E, 0xF4, 0x00, 0xFA, 0x00, 0x00, 0x2F, 0xC0, 0x0F,
+    0xA0, 0x00, 0x00, 0xCF, 0x00, 0xFA, 0x00, 0x00, 0x0E, 0xC0, 0x0F, 0xA0,
+    0x01, 0x3B, 0xF5, 0x00, 0xFF, 0xFF, 0xFF, 0xB3, 0x00, 0x0F, 0xC6, 0x6B,
+    0xF5, 0x00, 0x00, 0xFA, 0x00, 0x1D, 0xE2, 0x00, 0x0F, 0xA0, 0x00, 0x3F,
+    0xB0, 0x00, 0xFA, 0x00, 0x00, 0x7F, 0x70, 0x0F, 0xA0, 0x00, 0x00, 0xAF,
+    0x30, 0xFA, 0x00, 0x00, 0x01, 0xDD, 0x10, 0x03, 0xAD, 0xEE, 0xDB, 0x66,
+    0xFD, 0x87, 0x8A, 0xD9, 0xDD, 0x10, 0x00, 0x00, 0x0E, 0xB0, 0x00, 0x00,
+    0x00, 0xBF, 0x40, 0x00, 0x00, 0x02, 0xDF, 0xB5, 0x10, 0x00, 0x01, 0x7D,
+    0xFE, 0xA2, 0x00, 0x00, 0x03, 0x9E, 0xF4, 0x00, 0x00, 0x00, 0x2E, 0xC0,
+    0x00, 0x00, 0x00, 0xAF, 0x10, 0x00, 0x00, 0x1E, 0xCF, 0xB8, 0x77, 0x8E,
+    0xF4, 0x9C, 0xEF, 0xFD, 0x93, 0x00, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0x47,
+    0x77, 0xCF, 0x77, 0x77, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x9F,
+    0x00, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00,
+    0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00,
+    0x9F, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x00,
+    0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0xF9,
+    0x00, 0x00, 0x0A, 0xFF, 0xA0, 0x00, 0x00, 0xAF, 0xFA, 0x00, 0x00, 0x0A,
+    0xFF, 0xA0, 0x00, 0x00, 0xAF, 0xFA, 0x00, 0x00, 0x0A, 0xFF, 0xA0, 0x00,
+    0x00, 0xAF, 0xFA, 0x00, 0x00, 0x0A, 0xFF, 0xA0, 0x00, 0x00, 0xAF, 0xFA,
+    0x00, 0x00, 0x0A, 0xFD, 0xC0, 0x00, 0x00, 0xDD, 0xAF, 0x40, 0x00, 0x5F,
+    0x92, 0xEF, 0x97, 0x9F, 0xE2, 0x03, 0xAE, 0xFE, 0xA2, 0x00, 0xCD, 0x00,
+    0x00, 0x00, 0x0E, 0xC7, 0xF4, 0x00, 0x00, 0x04, 0xF7, 0x2F, 0x90, 0x00,
+    0x00, 0x9F, 0x20, 0xBE, 0x00, 0x00, 0x0E, 0xB0, 0x06, 0xF4, 0x00, 0x04,
+    0xF6, 0x00, 0x1E, 0x90, 0x00, 0x9F, 0x10, 0x00, 0xAE, 0x00, 0x0E, 0xA0,
+    0x00, 0x04, 0xF5, 0x04, 0xF5, 0x00, 0x00, 0x0E, 0xA0, 0xAE, 0x00, 0x00,
+    0x00, 0x8E, 0x1E, 0x90, 0x00, 0x00, 0x03, 0xF7, 0xF4, 0x00, 0x00, 0x00,
+    0x0D, 0xED, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0xE8, 0x00,
+    0x00, 0x00, 0x08, 0xEC, 0xA0, 0x00, 0x00, 0x00, 0x9C, 0xBB, 0x00, 0x00,
+    0x00, 0x0B, 0xB9, 0xD0, 0x00, 0x00, 0x00, 0xC9, 0x7E, 0x00, 0x3F, 0x30,
+    0x0D, 0x75, 0xF1, 0x09, 0xD8, 0x00, 0xF6, 0x4F, 0x20, 0xE5, 0xE0, 0x1F,
+    0x42, 0xF4, 0x4D, 0x0E, 0x43, 0xF2, 0x0F, 0x5A, 0x80, 0x99, 0x4F, 0x10,
+    0xD6, 0xE2, 0x04, 0xE6, 0xE0, 0x0C, 0xAC, 0x00, 0x0E, 0xBC, 0x00, 0xAF,
+    0x70, 0x00, 0x9F, 0xA0, 0x08, 0xF2, 0x00, 0x05, 0xF9, 0x00, 0xAE, 0x20,
+    0x00, 0x00, 0x2E, 0xA1, 0xDC, 0x00, 0x00, 0x0B, 0xD1, 0x04, 0xF7, 0x00,
+    0x07, 0xF3, 0x00, 0x08, 0xF3, 0x03, 0xF7, 0x00, 0x00, 0x0C, 0xD1, 0xCC,
+    0x00, 0x00, 0x00, 0x2E, 0xDE, 0x20, 0x00, 0x00, 0x00, 0x9F, 0x90, 0x00,
+    0x00, 0x00, 0x3F, 0xBF, 0x30, 0x00, 0x00, 0x1D, 0xB0, 0xCD, 0x10, 0x00,
+    0x09, 0xE2, 0x03, 0xF9, 0x00, 0x04, 0xF5, 0x00, 0x08, 0xF4, 0x01, 0xDA,
+    0x00, 0x00, 0x0C, 0xD1, 0xAE, 0x10, 0x00, 0x00, 0x3F, 0xA0, 0x6F, 0x60,
+    0x00, 0x01, 0xEB, 0x0D, 0xD0, 0x00, 0x07, 0xF4, 0x06, 0xF4, 0x00, 0x0D,
+    0xB0, 0x00, 0xDB, 0x00, 0x6F, 0x40, 0x00, 0x6F, 0x30, 0xCB, 0x00, 0x00,
+    0x0D, 0xA4, 0xF4, 0x00, 0x00, 0x06, 0xFC, 0xB0, 0x00, 0x00, 0x00, 0xDF,
+    0x40, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00,
+    0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00,
+    0x9F, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x77, 0x77, 0x77, 0xFC,
+    0x00, 0x00, 0x00, 0x9F, 0x20, 0x00, 0x00, 0x4F, 0x70, 0x00, 0x00, 0x1D,
+    0xB0, 0x00, 0x00, 0x0A, 0xE2, 0x00, 0x00, 0x05, 0xF5, 0x00, 0x00, 0x02,
+    0xEA, 0x00, 0x00, 0x00, 0xBD, 0x10, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00,
+    0x3F, 0x90, 0x00, 0x00, 0x0C, 0xF7, 0x77, 0x77, 0x77, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xF0, 0xFF, 0xFF, 0xFB, 0x55, 0xFA, 0x00, 0xFA, 0x00, 0xFA, 0x00,
+    0xFA, 0x00, 0xFA, 0x00, 0xFA, 0x00, 0xFA, 0x00, 0xFA, 0x00, 0xFA, 0x00,
+    0xFA, 0x00, 0xFA, 0x00, 0xFA, 0x00, 0xFB, 0x55, 0xFF, 0xFF, 0xCC, 0x00,
+    0x00, 0x06, 0xF3, 0x00, 0x00, 0x0E, 0x90, 0x00, 0x00, 0x8E, 0x10, 0x00,
+    0x02, 0xF7, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x4F, 0x40, 0x00, 0x00,
+    0xDA, 0x00, 0x00, 0x07, 0xF2, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x9E,
+    0x00, 0x00, 0x03, 0xF6, 0x00, 0x00, 0x0C, 0xC0, 0xFF, 0xFF, 0x55, 0xBF,
+    0x00, 0xAF, 0x00, 0xAF, 0x00, 0xAF, 0x00, 0xAF, 0x00, 0xAF, 0x00, 0xAF,
+    0x00, 0xAF, 0x00, 0xAF, 0x00, 0xAF, 0x00, 0xAF, 0x00, 0xAF, 0x00, 0xAF,
+    0x55, 0xBF, 0xFF, 0xFF, 0x00, 0x03, 0xF3, 0x00, 0x00, 0x00, 0xBE, 0xA0,
+    0x00, 0x00, 0x3F, 0x4F, 0x30, 0x00, 0x0B, 0x90, 0x9B, 0x00, 0x04, 0xF2,
+    0x02, 0xF3, 0x00, 0xB9, 0x00, 0x0A, 0xB0, 0x4F, 0x20, 0x00, 0x2F, 0x4B,
+    0xA0, 0x00, 0x00, 0xAB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0xCF, 0x23, 0xF7, 0x07, 0xD0, 0x17, 0xCE, 0xFD, 0x81,
+    0x1D, 0x96, 0x6A, 0xF8, 0x00, 0x00, 0x00, 0xCD, 0x00, 0x00, 0x00, 0x9F,
+    0x04, 0xAD, 0xEF, 0xFF, 0x7F, 0xB5, 0x32, 0xAF, 0xEC, 0x00, 0x00, 0xAF,
+    0xEB, 0x00, 0x01, 0xEF, 0xAF, 0x74, 0x6D, 0xCF, 0x19, 0xEF, 0xC6, 0x4F,
+    0xF9, 0x00, 0x00, 0x00, 0x0F, 0x90, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00,
+    0x00, 0x0F, 0x90, 0x00, 0x00, 0x00, 0xF9, 0x6C, 0xFE, 0xA2, 0x0F, 0xDE,
+    0x76, 0x8E, 0xD1, 0xFF, 0x20, 0x00, 0x4F, 0x8F, 0xB0, 0x00, 0x00, 0xDD,
+    0xF9, 0x00, 0x00, 0x0B, 0xFF, 0x90, 0x00, 0x00, 0xBE, 0xFB, 0x00, 0x00,
+    0x0D, 0xDF, 0xF2, 0x00, 0x04, 0xF8, 0xFD, 0xE8, 0x68, 0xED, 0x1F, 0x46,
+    0xCF, 0xEA, 0x20, 0x02, 0xAE, 0xFD, 0x91, 0xDE, 0x86, 0x88, 0x8F, 0x40,
+    0x00, 0x0D, 0xD0, 0x00, 0x00, 0xFB, 0x00, 0x00, 0x0F, 0xB0, 0x00, 0x00,
+    0xDD, 0x00, 0x00, 0x09, 0xF4, 0x00, 0x00, 0x1E, 0xE8, 0x57, 0xB0, 0x2A,
+    0xEF, 0xDA, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00,
+    0x00, 0x9F, 0x00, 0x00, 0x00, 0x9F, 0x04, 0xCF, 0xD7, 0x8F, 0x2E, 0xD7,
+    0x7D, 0xDF, 0x9F, 0x20, 0x01, 0xEF, 0xDC, 0x00, 0x00, 0xBF, 0xFB, 0x00,
+    0x00, 0x9F, 0xFA, 0x00, 0x00, 0x9F, 0xDC, 0x00, 0x00, 0xBF, 0x9F, 0x20,
+    0x01, 0xEF, 0x2E, 0xD6, 0x6C, 0xDF, 0x04, 0xCF, 0xD7, 0x5F, 0x01, 0x8D,
+    0xFE, 0xA2, 0x00, 0xCE, 0x86, 0x7D, 0xE2, 0x7F, 0x30, 0x00, 0x1E, 0xAC,
+    0xC0, 0x00, 0x00, 0xBE, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC5, 0x55, 0x55,
+    0x55, 0xCD, 0x00, 0x00, 0x00, 0x07, 0xF5, 0x00, 0x00, 0x00, 0x0B, 0xF9,
+    0x66, 0x7B, 0x70, 0x07, 0xCE, 0xED, 0xA3, 0x00, 0x01, 0x9E, 0xFE, 0xB0,
+    0x00, 0x9F, 0x85, 0x76, 0x00, 0x0E, 0xA0, 0x00, 0x00, 0x00, 0xF9, 0x00,
+    0x00, 0xCD, 0xFF, 0xFF, 0xFF, 0x04, 0x44, 0xFA, 0x44, 0x40, 0x00, 0x0F,
+    0x90, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x0F, 0x90, 0x00, 0x00,
+    0x00, 0xF9, 0x00, 0x00, 0x00, 0x0F, 0x90, 0x00, 0x00, 0x00, 0xF9, 0x00,
+    0x00, 0x00, 0x0F, 0x90, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x6C,
+    0xEF, 0xFF, 0xFF, 0x20, 0x8F, 0x73, 0x37, 0xFA, 0x10, 0x0E, 0xA0, 0x00,
+    0x0A, 0xE0, 0x00, 0xEA, 0x00, 0x00, 0xAE, 0x00, 0x08, 0xF6, 0x22, 0x6F,
+    0x90, 0x00, 0x08, 0xFF, 0xEC, 0x60, 0x00, 0x00, 0xBA, 0x00, 0x00, 0x00,
+    0x00, 0x0E, 0x91, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xFD, 0x91, 0x03,
+    0xC9, 0x65, 0x55, 0x7E, 0xB0, 0xCA, 0x00, 0x00, 0x00, 0x9E, 0x0E, 0x90,
+    0x00, 0x00, 0x0B, 0xD0, 0x9F, 0x95, 0x45, 0x7C, 0xF5, 0x00, 0x7C, 0xEF,
+    0xED, 0x93, 0x00, 0xF9, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0xF9,
+    0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0xF9, 0x6D, 0xFD, 0x80, 0xFD,
+    0xE7, 0x6A, 0xF7, 0xFF, 0x30, 0x00, 0xCD, 0xFB, 0x00, 0x00, 0x9F, 0xFA,
+    0x00, 0x00, 0x9F, 0xF9, 0x00, 0x00, 0x9F, 0xF9, 0x00, 0x00, 0x9F, 0xF9,
+    0x00, 0x00, 0x9F, 0xF9, 0x00, 0x00, 0x9F, 0xF9, 0x00, 0x00, 0x9F, 0x00,
+    0x00, 0xD8, 0x00, 0x00, 0x00, 0x0D, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xF9, 0x00, 0x00, 0x02, 0x3F,
+    0x90, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x0F, 0x90, 0x00, 0x00,
+    0x00, 0xF9, 0x00, 0x00, 0x00, 0x0F, 0x90, 0x00, 0x00, 0x00, 0xF9, 0x00,
+    0x00, 0x00, 0x0F, 0x90, 0x00, 0x02, 0x23, 0xFA, 0x32, 0x10, 0xFF, 0xFF,
+    0xFF, 0xFA, 0x00, 0x00, 0xAB, 0x00, 0x00, 0xAB, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x01, 0x23, 0xAF, 0x00, 0x00, 0x9F, 0x00,
+    0x00, 0x9F, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x9F, 0x00,
+    0x00, 0x9F, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x9F, 0x00,
+    0x00, 0xBD, 0x86, 0x5A, 0xF7, 0xCE, 0xFD, 0x70, 0xF9, 0x00, 0x00, 0x00,
+    0x0F, 0x90, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x0F, 0x90, 0x00,
+    0x00, 0x00, 0xF9, 0x00, 0x06, 0xF7, 0x0F, 0x90, 0x06, 0xF6, 0x00, 0xF9,
+    0x05, 0xE5, 0x00, 0x0F, 0x84, 0xE4, 0x00, 0x00, 0xFA, 0xE7, 0x00, 0x00,
+    0x0F, 0xF9, 0xE4, 0x00, 0x00, 0xF9, 0x05, 0xE4, 0x00, 0x0F, 0x90, 0x08,
+    0xE3, 0x00, 0xF9, 0x00, 0x0A, 0xE2, 0x0F, 0x90, 0x00, 0x0C, 0xD2, 0x05,
+    0xFF, 0xF9, 0x00, 0x00, 0x02, 0x3F, 0x90, 0x00, 0x00, 0x00, 0xF9, 0x00,
+    0x00, 0x00, 0x0F, 0x90, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x0F,
+    0x90, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x0F, 0x90, 0x00, 0x00,
+    0x00, 0xF9, 0x00, 0x00, 0x00, 0x0F, 0x90, 0x00, 0x00, 0x00, 0xF9, 0x00,
+    0x00, 0x00, 0x0F, 0x90, 0x00, 0x02, 0x23, 0xFA, 0x32, 0x10, 0xFF, 0xFF,
+    0xFF, 0xFA, 0xF6, 0xCC, 0x1C, 0xE4, 0xFD, 0x8F, 0xC7, 0xEC, 0xFA, 0x1F,
+    0xB0, 0xAE, 0xF9, 0x0F, 0x90, 0x9F, 0xF9, 0x0F, 0x90, 0x9F, 0xF9, 0x0F,
+    0x90, 0x9F, 0xF9, 0x0F, 0x90, 0x9F, 0xF9, 0x0F, 0x90, 0x9F, 0xF9, 0x0F,
+    0x90, 0x9F, 0xF9, 0x0F, 0x90, 0x9F, 0xF6, 0x6D, 0xFD, 0x80, 0xFD, 0xE7,
+    0x6A, 0xF7, 0xFF, 0x30, 0x00, 0xCD, 0xFB, 0x00, 0x00, 0x9F, 0xFA, 0x00,
+    0x00, 0x9F, 0xF9, 0x00, 0x00, 0x9F, 0xF9, 0x00, 0x00, 0x9F, 0xF9, 0x00,
+    0x00, 0x9F, 0xF9, 0x00, 0x00, 0x9F, 0xF9, 0x00, 0x00, 0x9F, 0x01, 0x8D,
+    0xFD, 0x81, 0x01, 0xCE, 0x86, 0x8E, 0xC0, 0x8F, 0x40, 0x00, 0x4F, 0x7D,
+    0xD0, 0x00, 0x00, 0xDC, 0xFB, 0x00, 0x00, 0x0B, 0xEF, 0xB0, 0x00, 0x00,
+    0xBE, 0xCD, 0x00, 0x00, 0x0D, 0xC7, 0xF4, 0x00, 0x04, 0xF7, 0x0C, 0xE8,
+    0x68, 0xEC, 0x10, 0x18, 0xDF, 0xD8, 0x10, 0xF8, 0x4C, 0xEE, 0xA2, 0x0F,
+    0xDD, 0x76, 0x8E, 0xE1, 0xFF, 0x20, 0x00, 0x4F, 0x8F, 0xB0, 0x00, 0x00,
+    0xDD, 0xF9, 0x00, 0x00, 0x0B, 0xFF, 0x90, 0x00, 0x00, 0xBE, 0xFB, 0x00,
+    0x00, 0x0D, 0xDF, 0xF2, 0x00, 0x04, 0xF8, 0xFD, 0xE8, 0x68, 0xED, 0x1F,
+    0x85, 0xCF, 0xEA, 0x20, 0xF9, 0x00, 0x00, 0x00, 0x0F, 0x90, 0x00, 0x00,
+    0x00, 0xF9, 0x00, 0x00, 0x00, 0x0F, 0x90, 0x00, 0x00, 0x00, 0x03, 0xCF,
+    0xD6, 0x5F, 0x2E, 0xD7, 0x7D, 0xDF, 0x9F, 0x20, 0x01, 0xEF, 0xDC, 0x00,
+    0x00, 0xBF, 0xFB, 0x00, 0x00, 0x9F, 0xFA, 0x00, 0x00, 0x9F, 0xDC, 0x00,
+    0x00, 0xBF, 0x9F, 0x20, 0x01, 0xEF, 0x2E, 0xD6, 0x6C, 0xDF, 0x04, 0xCF,
+    0xD7, 0x8F, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00,
+    0x00, 0x9F, 0x00, 0x00, 0x00, 0x9F, 0xF5, 0x3B, 0xEE, 0xAF, 0x9D, 0x86,
+    0x78, 0xFF, 0x30, 0x00, 0x0F, 0xB0, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x0F,
+    0x90, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x0F, 0x90, 0x00, 0x00, 0xF9, 0x00,
+    0x00, 0x0F, 0x90, 0x00, 0x00, 0x18, 0xDF, 0xEC, 0x7A, 0xE7, 0x56, 0xA9,
+    0xE9, 0x00, 0x00, 0x0C, 0xE6, 0x00, 0x00, 0x2B, 0xFE, 0x82, 0x00, 0x04,
+    0xAF, 0xE4, 0x00, 0x00, 0x2D, 0xD0, 0x00, 0x00, 0xAE, 0xD8, 0x65, 0x8F,
+    0x99, 0xDF, 0xED, 0x70, 0x00, 0x35, 0x00, 0x00, 0x09, 0x90, 0x00, 0x00,
+    0xD9, 0x00, 0x0B, 0xEF, 0xFF, 0xFF, 0x44, 0xFA, 0x44, 0x40, 0x0F, 0x90,
+    0x00, 0x00, 0xF9, 0x00, 0x00, 0x0F, 0x90, 0x00, 0x00, 0xF9, 0x00, 0x00,
+    0x0F, 0x90, 0x00, 0x00, 0xEA, 0x00, 0x00, 0x0A, 0xF7, 0x56, 0x00, 0x1A,
+    0xEE, 0xC0, 0xF9, 0x00, 0x00, 0x9F, 0xF9, 0x00, 0x00, 0x9F, 0xF9, 0x00,
+    0x00, 0x9F, 0xF9, 0x00, 0x00, 0x9F, 0xF9, 0x00, 0x00, 0x9F, 0xF9, 0x00,
+    0x00, 0x9F, 0xF9, 0x00, 0x00, 0xBF, 0xDC, 0x00, 0x02, 0xEF, 0x7F, 0xA6,
+    0x7D, 0xDF, 0x08, 0xDF, 0xD6, 0x6F, 0xCC, 0x00, 0x00, 0x0C, 0xC7, 0xF2,
+    0x00, 0x02, 0xF7, 0x2F, 0x70, 0x00, 0x7F, 0x20, 0xCD, 0x00, 0x0C, 0xC0,
+    0x06, 0xF3, 0x02, 0xF7, 0x00, 0x1F, 0x80, 0x7F, 0x20, 0x00, 0xBD, 0x0C,
+    0xB0, 0x00, 0x06, 0xF4, 0xF6, 0x00, 0x00, 0x1E, 0xCF, 0x10, 0x00, 0x00,
+    0xAF, 0xB0, 0x00, 0xE7, 0x00, 0x3F, 0x40, 0x07, 0xEB, 0x90, 0x08, 0xE9,
+    0x00, 0x9B, 0x8C, 0x00, 0xD8, 0xD0, 0x0B, 0x85, 0xE0, 0x2F, 0x1F, 0x30,
+    0xD5, 0x2F, 0x17, 0xC0, 0xC7, 0x1F, 0x20, 0xE3, 0xC7, 0x08, 0xC2, 0xE0,
+    0x0B, 0x4F, 0x20, 0x3F, 0x5B, 0x00, 0x89, 0xD0, 0x00, 0xD9, 0x80, 0x06,
+    0xE8, 0x00, 0x09, 0xE5, 0x00, 0x3F, 0x40, 0x00, 0x4F, 0x30, 0x7F, 0x50,
+    0x00, 0x4F, 0x70, 0xBD, 0x10, 0x1D, 0xC0, 0x02, 0xE9, 0x08, 0xE2, 0x00,
+    0x05, 0xF6, 0xF6, 0x00, 0x00, 0x0A, 0xFA, 0x00, 0x00, 0x00, 0xCF, 0xC0,
+    0x00, 0x00, 0x8E, 0x3E, 0x80, 0x00, 0x4F, 0x60, 0x6F, 0x40, 0x1D, 0xC0,
+    0x00, 0xBD, 0x1A, 0xF2, 0x00, 0x02, 0xFA, 0xCD, 0x00, 0x00, 0x0C, 0xC7,
+    0xF3, 0x00, 0x03, 0xF7, 0x1F, 0x80, 0x00, 0x8F, 0x10, 0xAE, 0x00, 0x0D,
+    0xA0, 0x05, 0xF4, 0x03, 0xF5, 0x00, 0x0E, 0xA0, 0x8E, 0x00, 0x00, 0x8E,
+    0x1D, 0x80, 0x00, 0x02, 0xF7, 0xF3, 0x00, 0x00, 0x0C, 0xEC, 0x00, 0x00,
+    0x00, 0x6F, 0x70, 0x00, 0x00, 0x06, 0xF1, 0x00, 0x00, 0x00, 0xDA, 0x00,
+    0x00, 0x66, 0xBE, 0x20, 0x00, 0x0E, 0xFC, 0x40, 0x00, 0x00, 0xFF, 0xFF,
+    0xFF, 0xF4, 0x44, 0x44, 0xDD, 0x00, 0x00, 0x7F, 0x30, 0x00, 0x3F, 0x70,
+    0x00, 0x1D, 0xB0, 0x00, 0x09, 0xE2, 0x00, 0x05, 0xF5, 0x00, 0x02, 0xE9,
+    0x00, 0x00, 0xBE, 0x44, 0x44, 0x4F, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0x8D,
+    0xE0, 0x00, 0xAF, 0x85, 0x00, 0x0F, 0xB0, 0x00, 0x00, 0xFA, 0x00, 0x00,
+    0x0F, 0xA0, 0x00, 0x01, 0xFA, 0x00, 0x13, 0xAF, 0x60, 0x0F, 0xFD, 0x50,
+    0x00, 0x58, 0xED, 0x20, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xA0, 0x00,
+    0x00, 0xFA, 0x00, 0x00, 0x0F, 0xA0, 0x00, 0x00, 0xEB, 0x00, 0x00, 0x09,
+    0xF9, 0x50, 0x00, 0x07, 0xCE, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5,
+    0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xED,
+    0x81, 0x00, 0x05, 0x8F, 0xA0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0A, 0xF0,
+    0x00, 0x00, 0xAF, 0x00, 0x00, 0x0A, 0xF1, 0x00, 0x00, 0x6F, 0xA3, 0x10,
+    0x00, 0x5D, 0xFF, 0x00, 0x2D, 0xE8, 0x50, 0x09, 0xF3, 0x00, 0x00, 0xAF,
+    0x00, 0x00, 0x0A, 0xF0, 0x00, 0x00, 0xAF, 0x00, 0x00, 0x0B, 0xE0, 0x00,
+    0x59, 0xF9, 0x00, 0x0E, 0xC7, 0x00, 0x00, 0x4D, 0xEB, 0x40, 0x00, 0x6F,
+    0x86, 0xBF, 0xB6, 0x8F, 0x60, 0x00, 0x4B, 0xED, 0x40, 0xCE, 0x2C, 0xE2,
+    0x00, 0x07, 0xA0, 0x7B, 0x08, 0xB0, 0x9C, 0x09, 0xD0, 0xAD, 0x0B, 0xE0,
+    0xBF, 0x0C, 0xF0, 0xDF, 0x10, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x90,
+    0x00, 0x04, 0xCF, 0xFF, 0xB1, 0x4F, 0xE8, 0x57, 0x90, 0xAF, 0x30, 0x00,
+    0x00, 0xDC, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0xDC, 0x00, 0x00,
+    0x00, 0xAF, 0x30, 0x00, 0x00, 0x4F, 0xE7, 0x57, 0xB0, 0x04, 0xBF, 0xFD,
+    0xA0, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x07, 0xDF,
+    0xDA, 0x30, 0x07, 0xFA, 0x67, 0xC3, 0x00, 0xDD, 0x00, 0x00, 0x00, 0x0F,
+    0xA0, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0x0F, 0xA0, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xF0, 0x04, 0x4F, 0xB4, 0x44, 0x00, 0x00, 0xFA, 0x00,
+    0x00, 0x00, 0x1F, 0x90, 0x00, 0x00, 0x05, 0xF6, 0x00, 0x00, 0x06, 0xED,
+    0x55, 0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x04, 0x00, 0x00, 0x04,
+    0x04, 0xF8, 0xCE, 0xC8, 0xF4, 0x09, 0xF9, 0x59, 0xF8, 0x00, 0xC9, 0x00,
+    0x09, 0xC0, 0x0E, 0x50, 0x00, 0x5E, 0x00, 0xC9, 0x00, 0x09, 0xC0, 0x09,
+    0xF9, 0x59, 0xF8, 0x04, 0xF8, 0xCE, 0xC9, 0xF4, 0x04, 0x00, 0x00, 0x04,
+    0x00, 0xBE, 0x10, 0x00, 0x01, 0xEA, 0x2F, 0x70, 0x00, 0x09, 0xE1, 0x09,
+    0xE1, 0x00, 0x3F, 0x60, 0x01, 0xE9, 0x00, 0xCB, 0x00, 0x00, 0x7F, 0x27,
+    0xE2, 0x00, 0x00, 0x0D, 0xBE, 0x70, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0,
+    0x01, 0x11, 0xF9, 0x11, 0x10, 0x01, 0x11, 0xF9, 0x11, 0x10, 0x0F, 0xFF,
+    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x00,
+    0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5,
+    0xF5, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5,
+    0x01, 0x8D, 0xFE, 0xB6, 0x0B, 0xE6, 0x45, 0x96, 0x0E, 0xA0, 0x00, 0x00,
+    0x09, 0xF9, 0x30, 0x00, 0x01, 0xCF, 0xFB, 0x40, 0x0A, 0xD2, 0x4C, 0xF6,
+    0x0E, 0x90, 0x00, 0xCE, 0x0D, 0xD2, 0x00, 0x9E, 0x04, 0xEE, 0x85, 0xE8,
+    0x00, 0x17, 0xDF, 0xE2, 0x00, 0x00, 0x05, 0xEC, 0x00, 0x00, 0x00, 0x9F,
+    0x2B, 0x75, 0x47, 0xEA, 0x19, 0xDE, 0xEC, 0x70, 0xC6, 0x06, 0xCC, 0x60,
+    0x6C, 0x00, 0x3A, 0xEE, 0xEA, 0x20, 0x00, 0x4D, 0x61, 0x01, 0x6D, 0x40,
+    0x1D, 0x20, 0x00, 0x00, 0x2D, 0x17, 0x80, 0x5C, 0xEE, 0xB2, 0x87, 0xC3,
+    0x6F, 0x84, 0x48, 0x03, 0xCE, 0x0D, 0xA0, 0x00, 0x00, 0x0E, 0xE0, 0xF7,
+    0x00, 0x00, 0x00, 0xEE, 0x0C, 0x90, 0x00, 0x00, 0x0E, 0xC3, 0x6F, 0x84,
+    0x47, 0x03, 0xC8, 0x80, 0x5C, 0xEE, 0xB0, 0x87, 0x1D, 0x20, 0x00, 0x00,
+    0x2D, 0x10, 0x5D, 0x61, 0x01, 0x6D, 0x40, 0x00, 0x3A, 0xEE, 0xEA, 0x30,
+    0x00, 0x4C, 0xEE, 0xC4, 0x24, 0x11, 0x8D, 0x3A, 0xDE, 0xFF, 0xDA, 0x21,
+    0x6F, 0xE7, 0x14, 0xDF, 0x6E, 0xEB, 0x4F, 0x00, 0x89, 0x00, 0x89, 0x06,
+    0xF5, 0x06, 0xF5, 0x4F, 0x70, 0x4F, 0x70, 0xDD, 0x00, 0xDD, 0x00, 0x4F,
+    0x70, 0x4F, 0x70, 0x06, 0xF5, 0x06, 0xF5, 0x00, 0x89, 0x00, 0x89, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xF5, 0x55, 0x55, 0x55, 0x8F, 0x00, 0x00, 0x00, 0x05,
+    0xF0, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x05, 0xF0, 0xFF, 0xFF,
+    0xF7, 0x77, 0x77, 0x00, 0x3A, 0xEE, 0xEA, 0x20, 0x00, 0x4D, 0x61, 0x01,
+    0x6D, 0x40, 0x1D, 0x20, 0x00, 0x00, 0x2D, 0x17, 0x80, 0xFF, 0xEC, 0x40,
+    0x87, 0xC3, 0x0F, 0x84, 0xBE, 0x03, 0xCE, 0x00, 0xF8, 0x4B, 0xD0, 0x0E,
+    0xE0, 0x0F, 0xFF, 0xD2, 0x00, 0xEE, 0x00, 0xF6, 0x7F, 0x20, 0x0E, 0xC3,
+    0x0F, 0x60, 0xCB, 0x03, 0xC8, 0x80, 0xF6, 0x03, 0xF6, 0x87, 0x1D, 0x20,
+    0x00, 0x00, 0x2D, 0x10, 0x5D, 0x61, 0x01, 0x6D, 0x40, 0x00, 0x3A, 0xEE,
+    0xEA, 0x30, 0x00, 0x44, 0x44, 0x44, 0x44, 0x44, 0x4F, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x05, 0xDF, 0xC5, 0x05, 0xF6, 0x26, 0xF5, 0xD9, 0x00, 0x09,
+    0xCF, 0x50, 0x00, 0x5F, 0xD8, 0x00, 0x08, 0xD5, 0xF6, 0x26, 0xF5, 0x05,
+    0xDF, 0xD5, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x0F, 0x50, 0x00,
+    0x00, 0x00, 0xF5, 0x00, 0x00, 0x00, 0x0F, 0x50, 0x00, 0x6F, 0xFF, 0xFF,
+    0xFF, 0xB2, 0x55, 0x5F, 0x85, 0x53, 0x00, 0x00, 0xF5, 0x00, 0x00, 0x00,
+    0x0F, 0x50, 0x00, 0x00, 0x00, 0xB3, 0x00, 0x02, 0x55, 0x55, 0x55, 0x53,
+    0x6F, 0xFF, 0xFF, 0xFF, 0xB0, 0x7D, 0xED, 0x43, 0x31, 0x8E, 0x00, 0x07,
+    0xD0, 0x03, 0xE5, 0x04, 0xE5, 0x05, 0xD3, 0x00, 0xFF, 0xFF, 0xF0, 0x7D,
+    0xFD, 0x52, 0x21, 0x8E, 0x00, 0x19, 0xB0, 0xFF, 0xC2, 0x00, 0x19, 0xD3,
+    0x11, 0x9D, 0xCE, 0xEC, 0x30, 0x2F, 0xC7, 0xF3, 0xD7, 0x00, 0xF9, 0x00,
+    0x00, 0x9F, 0xF9, 0x00, 0x00, 0x9F, 0xF9, 0x00, 0x00, 0x9F, 0xF9, 0x00,
+    0x00, 0x9F, 0xF9, 0x00, 0x00, 0x9F, 0xF9, 0x00, 0x00, 0x9F, 0xF9, 0x00,
+    0x00, 0xBF, 0xFC, 0x00, 0x01, 0xEF, 0xFF, 0xA6, 0x7D, 0xDF, 0xFB, 0xCF,
+    0xD6, 0x5F, 0xF9, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0xF9, 0x00,
+    0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x05, 0xCE, 0xFF, 0xFF, 0xF4, 0xFF,
+    0xFF, 0x65, 0x6F, 0xBF, 0xFF, 0xF1, 0x01, 0xFE, 0xFF, 0xFF, 0x10, 0x1F,
+    0xFF, 0xFF, 0xF1, 0x01, 0xFE, 0xFF, 0xFF, 0x10, 0x1F, 0xCF, 0xFF, 0xF1,
+    0x01, 0xF7, 0xFF, 0xFF, 0x10, 0x1F, 0x09, 0xEE, 0xF1, 0x01, 0xF0, 0x00,
+    0x0F, 0x10, 0x1F, 0x00, 0x00, 0xF1, 0x01, 0xF0, 0x00, 0x0F, 0x10, 0x1F,
+    0x00, 0x00, 0xF1, 0x01, 0xF0, 0x00, 0x0F, 0x10, 0x1F, 0x00, 0x00, 0xF1,
+    0x01, 0xF0, 0x00, 0x0F, 0x10, 0x1F, 0xBB, 0xBB, 0x1C, 0x03, 0xD9, 0x06,
+    0xCE, 0xB1, 0x1A, 0xF5, 0xA7, 0xE5, 0x00, 0xF5, 0x00, 0xF5, 0x00, 0xF5,
+    0x00, 0xF5, 0x00, 0xF5, 0x19, 0xEE, 0x91, 0x9C, 0x22, 0xC9, 0xE6, 0x00,
+    0x6E, 0xE6, 0x00, 0x6E, 0x9C, 0x22, 0xC9, 0x19, 0xEE, 0x91, 0x98, 0x00,
+    0x98, 0x00, 0x5F, 0x60, 0x5F, 0x60, 0x07, 0xF4, 0x07, 0xF4, 0x00, 0xDD,
+    0x00, 0xDD, 0x07, 0xF4, 0x07, 0xF4, 0x5F, 0x60, 0x5F, 0x60, 0x98, 0x00,
+    0x98, 0x00, 0x1A, 0xF5, 0x00, 0x00, 0xAB, 0x00, 0xA7, 0xE5, 0x00, 0x02,
+    0xF4, 0x00, 0x00, 0xF5, 0x00, 0x0A, 0xB0, 0x00, 0x00, 0xF5, 0x00, 0x3F,
+    0x30, 0x00, 0x00, 0xF5, 0x00, 0xAB, 0x00, 0x00, 0x00, 0xF5, 0x03, 0xF3,
+    0x00, 0x00, 0x00, 0xF5, 0x0A, 0xA0, 0x5F, 0x50, 0x00, 0x00, 0x3F, 0x32,
+    0xCF, 0x50, 0x00, 0x00, 0xBA, 0x0C, 0x4F, 0x50, 0x00, 0x03, 0xF3, 0x89,
+    0x0F, 0x50, 0x00, 0x0B, 0xA0, 0xFF, 0xFF, 0xF1, 0x00, 0x4F, 0x20, 0x00,
+    0x0F, 0x50, 0x00, 0xBA, 0x00, 0x00, 0x0F, 0x50, 0x1A, 0xF5, 0x00, 0x0A,
+    0xB0, 0x0A, 0x7E, 0x50, 0x02, 0xF4, 0x00, 0x00, 0xF5, 0x00, 0xAB, 0x00,
+    0x00, 0x0F, 0x50, 0x3F, 0x30, 0x00, 0x00, 0xF5, 0x0A, 0xB0, 0x00, 0x00,
+    0x0F, 0x53, 0xF3, 0x00, 0x00, 0x00, 0xF5, 0xAA, 0x7D, 0xED, 0x40, 0x00,
+    0x3F, 0x33, 0x31, 0x8E, 0x00, 0x0B, 0xA0, 0x00, 0x07, 0xD0, 0x03, 0xF3,
+    0x00, 0x03, 0xE5, 0x00, 0xBA, 0x00, 0x04, 0xE5, 0x00, 0x4F, 0x20, 0x05,
+    0xD3, 0x00, 0x0B, 0xA0, 0x00, 0xFF, 0xFF, 0xF0, 0x7D, 0xFD, 0x50, 0x00,
+    0xAB, 0x00, 0x22, 0x18, 0xE0, 0x02, 0xF4, 0x00, 0x00, 0x19, 0xB0, 0x0A,
+    0xB0, 0x00, 0x0F, 0xFC, 0x20, 0x3F, 0x30, 0x00, 0x00, 0x19, 0xD0, 0xAB,
+    0x00, 0x00, 0x31, 0x19, 0xD3, 0xF3, 0x00, 0x00, 0xCE, 0xEC, 0x3A, 0xA0,
+    0x5F, 0x50, 0x00, 0x00, 0x3F, 0x32, 0xCF, 0x50, 0x00, 0x00, 0xBA, 0x0C,
+    0x4F, 0x50, 0x00, 0x03, 0xF3, 0x89, 0x0F, 0x50, 0x00, 0x0B, 0xA0, 0xFF,
+    0xFF, 0xF1, 0x00, 0x4F, 0x20, 0x00, 0x0F, 0x50, 0x00, 0xBA, 0x00, 0x00,
+    0x0F, 0x50, 0x00, 0x0C, 0xC0, 0x00, 0x00, 0x0E, 0xE0, 0x00, 0x00, 0x04,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xA0, 0x00, 0x00, 0x2F,
+    0x70, 0x00, 0x03, 0xDD, 0x10, 0x00, 0x2E, 0xC1, 0x00, 0x00, 0xBE, 0x10,
+    0x00, 0x00, 0xEA, 0x00, 0x00, 0x00, 0xEC, 0x00, 0x00, 0x01, 0x8F, 0xB6,
+    0x68, 0xDB, 0x05, 0xCE, 0xED, 0x94, 0x00, 0x00, 0xCF, 0x20, 0x00, 0x00,
+    0x00, 0x03, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x80, 0x00, 0x00, 0x00, 0x0D,
+    0xED, 0x00, 0x00, 0x00, 0x04, 0xF8, 0xF4, 0x00, 0x00, 0x00, 0x9F, 0x1F,
+    0x90, 0x00, 0x00, 0x0E, 0xB0, 0xBE, 0x00, 0x00, 0x05, 0xF6, 0x06, 0xF5,
+    0x00, 0x00, 0xAF, 0x10, 0x1F, 0xA0, 0x00, 0x1F, 0xC0, 0x00, 0xCF, 0x10,
+    0x06, 0xFF, 0xFF, 0xFF, 0xF6, 0x00, 0xBF, 0x77, 0x77, 0x7F, 0xB0, 0x2F,
+    0xA0, 0x00, 0x00, 0xAF, 0x27, 0xF4, 0x00, 0x00, 0x04, 0xF7, 0xCD, 0x00,
+    0x00, 0x00, 0x0D, 0xC0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00,
+    0x7F, 0x30, 0x00, 0x00, 0x00, 0x0D, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x8F, 0x80, 0x00, 0x00, 0x00, 0x0D, 0xED, 0x00,
+    0x00, 0x00, 0x04, 0xF8, 0xF4, 0x00, 0x00, 0x00, 0x9F, 0x1F, 0x90, 0x00,
+    0x00, 0x0E, 0xB0, 0xBE, 0x00, 0x00, 0x05, 0xF6, 0x06, 0xF5, 0x00, 0x00,
+    0xAF, 0x10, 0x1F, 0xA0, 0x00, 0x1F, 0xC0, 0x00, 0xCF, 0x10, 0x06, 0xFF,
+    0xFF, 0xFF, 0xF6, 0x00, 0xBF, 0x77, 0x77, 0x7F, 0xB0, 0x2F, 0xA0, 0x00,
+    0x00, 0xAF, 0x27, 0xF4, 0x00, 0x00, 0x04, 0xF7, 0xCD, 0x00, 0x00, 0x00,
+    0x0D, 0xC0, 0x00, 0x00, 0x9F, 0x90, 0x00, 0x00, 0x00, 0x3F, 0x9F, 0x30,
+    0x00, 0x00, 0x0C, 0x80, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x8F, 0x80, 0x00, 0x00, 0x00, 0x0D, 0xED, 0x00, 0x00, 0x00,
+    0x04, 0xF8, 0xF4, 0x00, 0x00, 0x00, 0x9F, 0x1F, 0x90, 0x00, 0x00, 0x0E,
+    0xB0, 0xBE, 0x00, 0x00, 0x05, 0xF6, 0x06, 0xF5, 0x00, 0x00, 0xAF, 0x10,
+    0x1F, 0xA0, 0x00, 0x1F, 0xC0, 0x00, 0xCF, 0x10, 0x06, 0xFF, 0xFF, 0xFF,
+    0xF6, 0x00, 0xBF, 0x77, 0x77, 0x7F, 0xB0, 0x2F, 0xA0, 0x00, 0x00, 0xAF,
+    0x27, 0xF4, 0x00, 0x00, 0x04, 0xF7, 0xCD, 0x00, 0x00, 0x00, 0x0D, 0xC0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xDD, 0x40, 0x1D, 0x00, 0x00,
+    0xA9, 0x8F, 0x99, 0xA0, 0x00, 0x0E, 0x10, 0x4D, 0xD2, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xDE,
+    0xD0, 0x00, 0x00, 0x00, 0x4F, 0x8F, 0x40, 0x00, 0x00, 0x09, 0xF1, 0xF9,
+    0x00, 0x00, 0x00, 0xEB, 0x0B, 0xE0, 0x00, 0x00, 0x5F, 0x60, 0x6F, 0x50,
+    0x00, 0x0A, 0xF1, 0x01, 0xFA, 0x00, 0x01, 0xFC, 0x00, 0x0C, 0xF1, 0x00,
+    0x6F, 0xFF, 0xFF, 0xFF, 0x60, 0x0B, 0xF7, 0x77, 0x77, 0xFB, 0x02, 0xFA,
+    0x00, 0x00, 0x0A, 0xF2, 0x7F, 0x40, 0x00, 0x00, 0x4F, 0x7C, 0xD0, 0x00,
+    0x00, 0x00, 0xDC, 0x00, 0x0C, 0x60, 0x6C, 0x00, 0x00, 0x00, 0xC6, 0x06,
+    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF8, 0x00,
+    0x00, 0x00, 0x00, 0xDE, 0xD0, 0x00, 0x00, 0x00, 0x4F, 0x8F, 0x40, 0x00,
+    0x00, 0x09, 0xF1, 0xF9, 0x00, 0x00, 0x00, 0xEB, 0x0B, 0xE0, 0x00, 0x00,
+    0x5F, 0x60, 0x6F, 0x50, 0x00, 0x0A, 0xF1, 0x01, 0xFA, 0x00, 0x01, 0xFC,
+    0x00, 0x0C, 0xF1, 0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0x60, 0x0B, 0xF7, 0x77,
+    0x77, 0xFB, 0x02, 0xFA, 0x00, 0x00, 0x0A, 0xF2, 0x7F, 0x40, 0x00, 0x00,
+    0x4F, 0x7C, 0xD0, 0x00, 0x00, 0x00, 0xDC, 0x00, 0x00, 0x5D, 0xD5, 0x00,
+    0x00, 0x00, 0x0E, 0x22, 0xE0, 0x00, 0x00, 0x00, 0xE2, 0x2E, 0x00, 0x00,
+    0x00, 0x0D, 0xFF, 0x50, 0x00, 0x00, 0x00, 0xDE, 0xD0, 0x00, 0x00, 0x00,
+    0x4F, 0x8F, 0x40, 0x00, 0x00, 0x09, 0xF1, 0xF9, 0x00, 0x00, 0x00, 0xEB,
+    0x0B, 0xE0, 0x00, 0x00, 0x5F, 0x60, 0x6F, 0x50, 0x00, 0x0A, 0xF1, 0x01,
+    0xFA, 0x00, 0x01, 0xFC, 0x00, 0x0C, 0xF1, 0x00, 0x6F, 0xFF, 0xFF, 0xFF,
+    0x60, 0x0B, 0xF7, 0x77, 0x77, 0xFB, 0x02, 0xFA, 0x00, 0x00, 0x0A, 0xF2,
+    0x7F, 0x40, 0x00, 0x00, 0x4F, 0x7C, 0xD0, 0x00, 0x00, 0x00, 0xDC, 0x00,
+    0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x5E, 0x7F, 0xC7, 0x77, 0x00, 0x9B, 0x0F,
+    0xA0, 0x00, 0x00, 0xC8, 0x0F, 0xA0, 0x00, 0x01, 0xF4, 0x0F, 0xA0, 0x00,
+    0x04, 0xF1, 0x0F, 0xFF, 0xFF, 0x08, 0xC0, 0x0F, 0xC7, 0x77, 0x0B, 0xFF,
+    0xFF, 0xA0, 0x00, 0x0E, 0x97, 0x7F, 0xA0, 0x00, 0x3F, 0x30, 0x0F, 0xA0,
+    0x00, 0x6F, 0x00, 0x0F, 0xA0, 0x00, 0xAC, 0x00, 0x0F, 0xC7, 0x77, 0xD9,
+    0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x29, 0xDF, 0xEC, 0x60, 0x4E, 0xFA, 0x78,
+    0xCA, 0x1E, 0xE3, 0x00, 0x00, 0x07, 0xF6, 0x00, 0x00, 0x00, 0xCF, 0x00,
+    0x00, 0x00, 0x0E, 0xC0, 0x00, 0x00, 0x00, 0xFB, 0x00, 0x00, 0x00, 0x0E,
+    0xC0, 0x00, 0x00, 0x00, 0xCE, 0x00, 0x00, 0x00, 0x08, 0xF5, 0x00, 0x00,
+    0x00, 0x2E, 0xE3, 0x00, 0x00, 0x00, 0x5F, 0xFA, 0x77, 0x9D, 0x00, 0x29,
+    0xDF, 0xED, 0x90, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x3D, 0x90, 0x00,
+    0x00, 0x00, 0x6C, 0x00, 0x00, 0x00, 0xEB, 0x10, 0x00, 0x00, 0xCF, 0x20,
+    0x00, 0x00, 0x3F, 0x70, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x77, 0x77, 0x77, 0xFA, 0x00, 0x00,
+    0x00, 0xFA, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFC, 0x77, 0x77, 0x77, 0xFA, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00,
+    0x00, 0xFA, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0xFC, 0x77, 0x77,
+    0x77, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x07, 0xF3,
+    0x00, 0x00, 0x0D, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFC, 0x77, 0x77, 0x77, 0xFA, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00,
+    0x00, 0xFA, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x77, 0x77,
+    0x77, 0xFA, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00,
+    0x00, 0xFA, 0x00, 0x00, 0x00, 0xFC, 0x77, 0x77, 0x77, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x00, 0x09, 0xF9, 0x00, 0x00, 0x3F, 0x9F, 0x30, 0x00, 0xC8, 0x08,
+    0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x77, 0x77,
+    0x77, 0xFA, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x77, 0x77, 0x77, 0xFA, 0x00, 0x00,
+    0x00, 0xFA, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00,
+    0x00, 0xFC, 0x77, 0x77, 0x77, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xC6, 0x06,
+    0xC0, 0x00, 0xC6, 0x06, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFC, 0x77, 0x77, 0x77, 0xFA, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00,
+    0x00, 0xFA, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x77, 0x77,
+    0x77, 0xFA, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00,
+    0x00, 0xFA, 0x00, 0x00, 0x00, 0xFC, 0x77, 0x77, 0x77, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x00, 0xCF, 0x20, 0x00, 0x00, 0x3F, 0x70, 0x00, 0x00, 0x07, 0xD0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF9, 0x14, 0x5C, 0xF5,
+    0x42, 0x00, 0x09, 0xF0, 0x00, 0x00, 0x09, 0xF0, 0x00, 0x00, 0x09, 0xF0,
+    0x00, 0x00, 0x09, 0xF0, 0x00, 0x00, 0x09, 0xF0, 0x00, 0x00, 0x09, 0xF0,
+    0x00, 0x00, 0x09, 0xF0, 0x00, 0x00, 0x09, 0xF0, 0x00, 0x00, 0x09, 0xF0,
+    0x00, 0x14, 0x5C, 0xF5, 0x42, 0x3F, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x2F,
+    0xC0, 0x00, 0x00, 0x7F, 0x30, 0x00, 0x00, 0xD7, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x3F, 0xFF, 0xFF, 0xF9, 0x14, 0x5C, 0xF5, 0x42, 0x00, 0x09, 0xF0,
+    0x00, 0x00, 0x09, 0xF0, 0x00, 0x00, 0x09, 0xF0, 0x00, 0x00, 0x09, 0xF0,
+    0x00, 0x00, 0x09, 0xF0, 0x00, 0x00, 0x09, 0xF0, 0x00, 0x00, 0x09, 0xF0,
+    0x00, 0x00, 0x09, 0xF0, 0x00, 0x00, 0x09, 0xF0, 0x00, 0x14, 0x5C, 0xF5,
+    0x42, 0x3F, 0xFF, 0xFF, 0xF9, 0x00, 0x09, 0xF9, 0x00, 0x00, 0x3F, 0x9F,
+    0x30, 0x00, 0xC8, 0x08, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
+    0xF9, 0x14, 0x5C, 0xF5, 0x42, 0x00, 0x09, 0xF0, 0x00, 0x00, 0x09, 0xF0,
+    0x00, 0x00, 0x09, 0xF0, 0x00, 0x00, 0x09, 0xF0, 0x00, 0x00, 0x09, 0xF0,
+    0x00, 0x00, 0x09, 0xF0, 0x00, 0x00, 0x09, 0xF0, 0x00, 0x00, 0x09, 0xF0,
+    0x00, 0x00, 0x09, 0xF0, 0x00, 0x14, 0x5C, 0xF5, 0x42, 0x3F, 0xFF, 0xFF,
+    0xF9, 0x00, 0xC6, 0x06, 0xC0, 0x00, 0xC6, 0x06, 0xC0, 0x00, 0x00, 0x00,
+    0x00, 0x3F, 0xFF, 0xFF, 0xF9, 0x14, 0x5C, 0xF5, 0x42, 0x00, 0x09, 0xF0,
+    0x00, 0x00, 0x09, 0xF0, 0x00, 0x00, 0x09, 0xF0, 0x00, 0x00, 0x09, 0xF0,
+    0x00, 0x00, 0x09, 0xF0, 0x00, 0x00, 0x09, 0xF0, 0x00, 0x00, 0x09, 0xF0,
+    0x00, 0x00, 0x09, 0xF0, 0x00, 0x00, 0x09, 0xF0, 0x00, 0x14, 0x5C, 0xF5,
+    0x42, 0x3F, 0xFF, 0xFF, 0xF9, 0x0F, 0xFF, 0xED, 0x82, 0x00, 0x0F, 0xC6,
+    0x7A, 0xFE, 0x40, 0x0F, 0xA0, 0x00, 0x2D, 0xE1, 0x0F, 0xA0, 0x00, 0x05,
+    0xF8, 0x0F, 0xA0, 0x00, 0x00, 0xEC, 0xFF, 0xFF, 0xFF, 0x10, 0xCE, 0x7F,
+    0xC7, 0x77, 0x00, 0xBF, 0x0F, 0xA0, 0x00, 0x00, 0xCE, 0x0F, 0xA0, 0x00,
+    0x00, 0xFB, 0x0F, 0xA0, 0x00, 0x06, 0xF7, 0x0F, 0xA0, 0x00, 0x3E, 0xD1,
+    0x0F, 0xC6, 0x7B, 0xFE, 0x30, 0x0F, 0xFF, 0xEC, 0x81, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x2D, 0xD4, 0x01, 0xD0, 0x0A, 0x98, 0xF9, 0x9A, 0x00,
+    0xE1, 0x04, 0xDD, 0x20, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
+    0x8F, 0xFF, 0x70, 0x00, 0x08, 0xFF, 0xCE, 0x10, 0x00, 0x8F, 0xF7, 0xD8,
+    0x00, 0x08, 0xFF, 0x75, 0xF2, 0x00, 0x8F, 0xF8, 0x0B, 0xA0, 0x08, 0xFF,
+    0x80, 0x3F, 0x30, 0x8F, 0xF8, 0x00, 0xAC, 0x08, 0xFF, 0x80, 0x02, 0xF5,
+    0x7F, 0xF8, 0x00, 0x08, 0xD7, 0xFF, 0x80, 0x00, 0x1E, 0xCF, 0xF8, 0x00,
+    0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0xDF, 0x00, 0x0C, 0xF2, 0x00, 0x00,
+    0x00, 0x3F, 0x70, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x8D, 0xFD, 0x80, 0x00, 0xBF, 0xA7, 0xAF, 0xA0, 0x5F, 0x90,
+    0x00, 0x8F, 0x4A, 0xF2, 0x00, 0x01, 0xF9, 0xDD, 0x00, 0x00, 0x0D, 0xDE,
+    0xC0, 0x00, 0x00, 0xCE, 0xFB, 0x00, 0x00, 0x0B, 0xFE, 0xC0, 0x00, 0x00,
+    0xCE, 0xDD, 0x00, 0x00, 0x0D, 0xDA, 0xF2, 0x00, 0x02, 0xF9, 0x5F, 0x90,
+    0x00, 0x8F, 0x40, 0xBF, 0xA7, 0xAF, 0xA0, 0x01, 0x8D, 0xFD, 0x70, 0x00,
+    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x07, 0xF3, 0x00, 0x00, 0x00, 0xD7,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x8D, 0xFD, 0x80, 0x00, 0xBF,
+    0xA7, 0xAF, 0xA0, 0x5F, 0x90, 0x00, 0x8F, 0x4A, 0xF2, 0x00, 0x01, 0xF9,
+    0xDD, 0x00, 0x00, 0x0D, 0xDE, 0xC0, 0x00, 0x00, 0xCE, 0xFB, 0x00, 0x00,
+    0x0B, 0xFE, 0xC0, 0x00, 0x00, 0xCE, 0xDD, 0x00, 0x00, 0x0D, 0xDA, 0xF2,
+    0x00, 0x02, 0xF9, 0x5F, 0x90, 0x00, 0x8F, 0x40, 0xBF, 0xA7, 0xAF, 0xA0,
+    0x01, 0x8D, 0xFD, 0x70, 0x00, 0x00, 0x09, 0xF9, 0x00, 0x00, 0x03, 0xF9,
+    0xF3, 0x00, 0x00, 0xC8, 0x08, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x8D, 0xFD, 0x80, 0x00, 0xBF, 0xA7, 0xAF, 0xA0, 0x5F, 0x90, 0x00, 0x8F,
+    0x4A, 0xF2, 0x00, 0x01, 0xF9, 0xDD, 0x00, 0x00, 0x0D, 0xDE, 0xC0, 0x00,
+    0x00, 0xCE, 0xFB, 0x00, 0x00, 0x0B, 0xFE, 0xC0, 0x00, 0x00, 0xCE, 0xDD,
+    0x00, 0x00, 0x0D, 0xDA, 0xF2, 0x00, 0x02, 0xF9, 0x5F, 0x90, 0x00, 0x8F,
+    0x40, 0xBF, 0xA7, 0xAF, 0xA0, 0x01, 0x8D, 0xFD, 0x70, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x2D, 0xD4, 0x01, 0xD0, 0x0A, 0x98, 0xF9, 0x9A, 0x00,
+    0xE1, 0x04, 0xDD, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xDF, 0xD8,
+    0x00, 0x0B, 0xFA, 0x7A, 0xFA, 0x05, 0xF9, 0x00, 0x08, 0xF4, 0xAF, 0x20,
+    0x00, 0x1F, 0x9D, 0xD0, 0x00, 0x00, 0xDD, 0xEC, 0x00, 0x00, 0x0C, 0xEF,
+    0xB0, 0x00, 0x00, 0xBF, 0xEC, 0x00, 0x00, 0x0C, 0xED, 0xD0, 0x00, 0x00,
+    0xDD, 0xAF, 0x20, 0x00, 0x2F, 0x95, 0xF9, 0x00, 0x08, 0xF4, 0x0B, 0xFA,
+    0x7A, 0xFA, 0x00, 0x18, 0xDF, 0xD7, 0x00, 0x00, 0xC6, 0x06, 0xC0, 0x00,
+    0x0C, 0x60, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xDF, 0xD8,
+    0x00, 0x0B, 0xFA, 0x7A, 0xFA, 0x05, 0xF9, 0x00, 0x08, 0xF4, 0xAF, 0x20,
+    0x00, 0x1F, 0x9D, 0xD0, 0x00, 0x00, 0xDD, 0xEC, 0x00, 0x00, 0x0C, 0xEF,
+    0xB0, 0x00, 0x00, 0xBF, 0xEC, 0x00, 0x00, 0x0C, 0xED, 0xD0, 0x00, 0x00,
+    0xDD, 0xAF, 0x20, 0x00, 0x2F, 0x95, 0xF9, 0x00, 0x08, 0xF4, 0x0B, 0xFA,
+    0x7A, 0xFA, 0x00, 0x18, 0xDF, 0xD7, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01,
+    0xD6, 0x00, 0x05, 0xD1, 0x05, 0xE5, 0x04, 0xE6, 0x00, 0x04, 0xE7, 0xE5,
+    0x00, 0x00, 0x06, 0xF7, 0x00, 0x00, 0x04, 0xE7, 0xE4, 0x00, 0x05, 0xE4,
+    0x04, 0xE5, 0x00, 0xD6, 0x00, 0x05, 0xD1, 0x01, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x20, 0x01, 0x8D, 0xFD, 0x7A, 0xD0, 0x0B, 0xFA,
+    0x7A, 0xFF, 0x50, 0x5F, 0x90, 0x00, 0xDF, 0x40, 0xAF, 0x20, 0x06, 0xCF,
+    0x90, 0xDD, 0x00, 0x1D, 0x4D, 0xD0, 0xEC, 0x00, 0x7A, 0x0C, 0xE0, 0xFB,
+    0x01, 0xE2, 0x0B, 0xF0, 0xEC, 0x09, 0x90, 0x0C, 0xE0, 0xDD, 0x3E, 0x10,
+    0x0D, 0xD0, 0xAF, 0xB7, 0x00, 0x2F, 0x90, 0x5F, 0xE1, 0x00, 0x8F, 0x40,
+    0x4F, 0xFA, 0x7A, 0xFA, 0x00, 0xCB, 0x8D, 0xFD, 0x70, 0x00, 0x22, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0C, 0xF2, 0x00, 0x00, 0x00, 0x3F, 0x70, 0x00,
+    0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00,
+    0x0A, 0xFF, 0xA0, 0x00, 0x00, 0xAF, 0xFA, 0x00, 0x00, 0x0A, 0xFF, 0xA0,
+    0x00, 0x00, 0xAF, 0xFA, 0x00, 0x00, 0x0A, 0xFF, 0xA0, 0x00, 0x00, 0xAF,
+    0xFA, 0x00, 0x00, 0x0A, 0xFF, 0xA0, 0x00, 0x00, 0xAF, 0xFA, 0x00, 0x00,
+    0x0A, 0xFD, 0xC0, 0x00, 0x00, 0xDD, 0xAF, 0x40, 0x00, 0x5F, 0x92, 0xEF,
+    0x97, 0x9F, 0xE2, 0x03, 0xAE, 0xFE, 0xA2, 0x00, 0x00, 0x00, 0x2F, 0xC0,
+    0x00, 0x00, 0x07, 0xF3, 0x00, 0x00, 0x00, 0xD7, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF9, 0x00, 0x00, 0x0A, 0xFF, 0xA0, 0x00, 0x00, 0xAF, 0xFA,
+    0x00, 0x00, 0x0A, 0xFF, 0xA0, 0x00, 0x00, 0xAF, 0xFA, 0x00, 0x00, 0x0A,
+    0xFF, 0xA0, 0x00, 0x00, 0xAF, 0xFA, 0x00, 0x00, 0x0A, 0xFF, 0xA0, 0x00,
+    0x00, 0xAF, 0xFA, 0x00, 0x00, 0x0A, 0xFD, 0xC0, 0x00, 0x00, 0xDD, 0xAF,
+    0x40, 0x00, 0x5F, 0x92, 0xEF, 0x97, 0x9F, 0xE2, 0x03, 0xAE, 0xFE, 0xA2,
+    0x00, 0x00, 0x09, 0xF9, 0x00, 0x00, 0x03, 0xF9, 0xF3, 0x00, 0x00, 0xC8,
+    0x08, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x0A, 0xFF,
+    0xA0, 0x00, 0x00, 0xAF, 0xFA, 0x00, 0x00, 0x0A, 0xFF, 0xA0, 0x00, 0x00,
+    0xAF, 0xFA, 0x00, 0x00, 0x0A, 0xFF, 0xA0, 0x00, 0x00, 0xAF, 0xFA, 0x00,
+    0x00, 0x0A, 0xFF, 0xA0, 0x00, 0x00, 0xAF, 0xFA, 0x00, 0x00, 0x0A, 0xFD,
+    0xC0, 0x00, 0x00, 0xDD, 0xAF, 0x40, 0x00, 0x5F, 0x92, 0xEF, 0x97, 0x9F,
+    0xE2, 0x03, 0xAE, 0xFE, 0xA2, 0x00, 0x00, 0xC6, 0x06, 0xC0, 0x00, 0x0C,
+    0x60, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x90, 0x00, 0x00, 0xAF,
+    0xFA, 0x00, 0x00, 0x0A, 0xFF, 0xA0, 0x00, 0x00, 0xAF, 0xFA, 0x00, 0x00,
+    0x0A, 0xFF, 0xA0, 0x00, 0x00, 0xAF, 0xFA, 0x00, 0x00, 0x0A, 0xFF, 0xA0,
+    0x00, 0x00, 0xAF, 0xFA, 0x00, 0x00, 0x0A, 0xFF, 0xA0, 0x00, 0x00, 0xAF,
+    0xDC, 0x00, 0x00, 0x0D, 0xDA, 0xF4, 0x00, 0x05, 0xF9, 0x2E, 0xF9, 0x79,
+    0xFE, 0x20, 0x3A, 0xEF, 0xEA, 0x20, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00,
+    0x00, 0x07, 0xF3, 0x00, 0x00, 0x00, 0x0D, 0x70, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x6F, 0x60, 0x00, 0x01, 0xEB, 0x0D, 0xD0, 0x00, 0x07, 0xF4,
+    0x06, 0xF4, 0x00, 0x0D, 0xB0, 0x00, 0xDB, 0x00, 0x6F, 0x40, 0x00, 0x6F,
+    0x30, 0xCB, 0x00, 0x00, 0x0D, 0xA4, 0xF4, 0x00, 0x00, 0x06, 0xFC, 0xB0,
+    0x00, 0x00, 0x00, 0xDF, 0x40, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00,
+    0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x9F,
+    0x00, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0x0F,
+    0xA0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xED, 0x93, 0x0F, 0xC6, 0x67, 0xAF,
+    0xF4, 0xFA, 0x00, 0x00, 0x4F, 0xCF, 0xA0, 0x00, 0x00, 0xCF, 0xFA, 0x00,
+    0x00, 0x0D, 0xEF, 0xA0, 0x00, 0x04, 0xFA, 0xFC, 0x66, 0x7A, 0xFD, 0x2F,
+    0xFF, 0xFE, 0xC8, 0x10, 0xFA, 0x00, 0x00, 0x00, 0x0F, 0xA0, 0x00, 0x00,
+    0x00, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x07, 0xCF, 0xED, 0x71, 0x08, 0xFA,
+    0x65, 0x9F, 0xA0, 0xEC, 0x00, 0x00, 0xAE, 0x0F, 0x90, 0x00, 0x1D, 0xC0,
+    0xF9, 0x00, 0x3D, 0xD2, 0x0F, 0x90, 0x3F, 0xA1, 0x00, 0xF9, 0x08, 0xF1,
+    0x00, 0x0F, 0x90, 0x4F, 0xC3, 0x00, 0xF9, 0x00, 0x4D, 0xF7, 0x0F, 0x90,
+    0x00, 0x19, 0xF7, 0xF9, 0x00, 0x00, 0x0C, 0xEF, 0x90, 0x00, 0x00, 0xAE,
+    0xF9, 0x0D, 0x75, 0x8F, 0x9F, 0x90, 0x9D, 0xFD, 0x91, 0x00, 0xCF, 0x20,
+    0x00, 0x00, 0x3F, 0x70, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x17, 0xCE, 0xFD, 0x81, 0x1D, 0x96, 0x6A, 0xF8, 0x00, 0x00, 0x00,
+    0xCD, 0x00, 0x00, 0x00, 0x9F, 0x04, 0xAD, 0xEF, 0xFF, 0x7F, 0xB5, 0x32,
+    0xAF, 0xEC, 0x00, 0x00, 0xAF, 0xEB, 0x00, 0x01, 0xEF, 0xAF, 0x74, 0x6D,
+    0xCF, 0x19, 0xEF, 0xC6, 0x4F, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x7F,
+    0x30, 0x00, 0x00, 0xD7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0xCE, 0xFD,
+    0x81, 0x1D, 0x96, 0x6A, 0xF8, 0x00, 0x00, 0x00, 0xCD, 0x00, 0x00, 0x00,
+    0x9F, 0x04, 0xAD, 0xEF, 0xFF, 0x7F, 0xB5, 0x32, 0xAF, 0xEC, 0x00, 0x00,
+    0xAF, 0xEB, 0x00, 0x01, 0xEF, 0xAF, 0x74, 0x6D, 0xCF, 0x19, 0xEF, 0xC6,
+    0x4F, 0x00, 0x09, 0xF9, 0x00, 0x00, 0x3F, 0x9F, 0x30, 0x00, 0xC8, 0x08,
+    0xC0, 0x00, 0x00, 0x00, 0x00, 0x17, 0xCE, 0xFD, 0x81, 0x1D, 0x96, 0x6A,
+    0xF8, 0x00, 0x00, 0x00, 0xCD, 0x00, 0x00, 0x00, 0x9F, 0x04, 0xAD, 0xEF,
+    0xFF, 0x7F, 0xB5, 0x32, 0xAF, 0xEC, 0x00, 0x00, 0xAF, 0xEB, 0x00, 0x01,
+    0xEF, 0xAF, 0x74, 0x6D, 0xCF, 0x19, 0xEF, 0xC6, 0x4F, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0xDD, 0x40, 0x1D, 0x0A, 0x98, 0xF9, 0x9A, 0x0E, 0x10, 0x4D,
+    0xD2, 0x00, 0x00, 0x00, 0x00, 0x17, 0xCE, 0xFD, 0x81, 0x1D, 0x96, 0x6A,
+    0xF8, 0x00, 0x00, 0x00, 0xCD, 0x00, 0x00, 0x00, 0x9F, 0x04, 0xAD, 0xEF,
+    0xFF, 0x7F, 0xB5, 0x32, 0xAF, 0xEC, 0x00, 0x00, 0xAF, 0xEB, 0x00, 0x01,
+    0xEF, 0xAF, 0x74, 0x6D, 0xCF, 0x19, 0xEF, 0xC6, 0x4F, 0x00, 0xC6, 0x06,
+    0xC0, 0x00, 0xC6, 0x06, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x17, 0xCE, 0xFD,
+    0x81, 0x1D, 0x96, 0x6A, 0xF8, 0x00, 0x00, 0x00, 0xCD, 0x00, 0x00, 0x00,
+    0x9F, 0x04, 0xAD, 0xEF, 0xFF, 0x7F, 0xB5, 0x32, 0xAF, 0xEC, 0x00, 0x00,
+    0xAF, 0xEB, 0x00, 0x01, 0xEF, 0xAF, 0x74, 0x6D, 0xCF, 0x19, 0xEF, 0xC6,
+    0x4F, 0x00, 0x05, 0xDD, 0x50, 0x00, 0x0E, 0x22, 0xE0, 0x00, 0x0E, 0x22,
+    0xE0, 0x00, 0x05, 0xDD, 0x50, 0x00, 0x00, 0x00, 0x00, 0x17, 0xCE, 0xFD,
+    0x81, 0x1D, 0x96, 0x6A, 0xF8, 0x00, 0x00, 0x00, 0xCD, 0x00, 0x00, 0x00,
+    0x9F, 0x04, 0xAD, 0xEF, 0xFF, 0x7F, 0xB5, 0x32, 0xAF, 0xEC, 0x00, 0x00,
+    0xAF, 0xEB, 0x00, 0x01, 0xEF, 0xAF, 0x74, 0x6D, 0xCF, 0x19, 0xEF, 0xC6,
+    0x4F, 0x18, 0xDF, 0xD4, 0x3D, 0xE8, 0x01, 0xD8, 0x6B, 0xED, 0x98, 0xF5,
+    0x00, 0x00, 0x2F, 0xD0, 0x0C, 0xB0, 0x00, 0x00, 0xFA, 0x00, 0x9E, 0x07,
+    0xCE, 0xFF, 0xFF, 0xFF, 0xF8, 0xF9, 0x42, 0xFB, 0x55, 0x55, 0xDB, 0x00,
+    0x1F, 0xB0, 0x00, 0x0E, 0xA0, 0x05, 0xFF, 0x20, 0x00, 0xAF, 0x77, 0xE6,
+    0xDD, 0x79, 0xA2, 0xBE, 0xD6, 0x03, 0xBE, 0xD6, 0x02, 0xAE, 0xFD, 0x91,
+    0xDE, 0x86, 0x88, 0x8F, 0x40, 0x00, 0x0D, 0xD0, 0x00, 0x00, 0xFB, 0x00,
+    0x00, 0x0F, 0xB0, 0x00, 0x00, 0xDD, 0x00, 0x00, 0x09, 0xF4, 0x00, 0x00,
+    0x1E, 0xE8, 0x57, 0xB0, 0x2A, 0xEF, 0xDA, 0x00, 0x01, 0xC0, 0x00, 0x00,
+    0x3D, 0x90, 0x00, 0x00, 0x6C, 0x00, 0x00, 0xEB, 0x10, 0x00, 0x0C, 0xF2,
+    0x00, 0x00, 0x00, 0x3F, 0x70, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x8D, 0xFE, 0xA2, 0x00, 0xCE, 0x86, 0x7D, 0xE2,
+    0x7F, 0x30, 0x00, 0x1E, 0xAC, 0xC0, 0x00, 0x00, 0xBE, 0xEF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xC5, 0x55, 0x55, 0x55, 0xCD, 0x00, 0x00, 0x00, 0x07, 0xF5,
+    0x00, 0x00, 0x00, 0x0B, 0xF9, 0x66, 0x7B, 0x70, 0x07, 0xCE, 0xED, 0xA3,
+    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x07, 0xF3, 0x00, 0x00, 0x00, 0xD7,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x8D, 0xFE, 0xA2, 0x00, 0xCE,
+    0x86, 0x7D, 0xE2, 0x7F, 0x30, 0x00, 0x1E, 0xAC, 0xC0, 0x00, 0x00, 0xBE,
+    0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC5, 0x55, 0x55, 0x55, 0xCD, 0x00, 0x00,
+    0x00, 0x07, 0xF5, 0x00, 0x00, 0x00, 0x0B, 0xF9, 0x66, 0x7B, 0x70, 0x07,
+    0xCE, 0xED, 0xA3, 0x00, 0x09, 0xF9, 0x00, 0x00, 0x03, 0xF9, 0xF3, 0x00,
+    0x00, 0xC8, 0x08, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x8D, 0xFE,
+    0xA2, 0x00, 0xCE, 0x86, 0x7D, 0xE2, 0x7F, 0x30, 0x00, 0x1E, 0xAC, 0xC0,
+    0x00, 0x00, 0xBE, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC5, 0x55, 0x55, 0x55,
+    0xCD, 0x00, 0x00, 0x00, 0x07, 0xF5, 0x00, 0x00, 0x00, 0x0B, 0xF9, 0x66,
+    0x7B, 0x70, 0x07, 0xCE, 0xED, 0xA3, 0x00, 0xC6, 0x06, 0xC0, 0x00, 0x0C,
+    0x60, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xDF, 0xEA, 0x20,
+    0x0C, 0xE8, 0x67, 0xDE, 0x27, 0xF3, 0x00, 0x01, 0xEA, 0xCC, 0x00, 0x00,
+    0x0B, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x55, 0x55, 0x55, 0x5C, 0xD0,
+    0x00, 0x00, 0x00, 0x7F, 0x50, 0x00, 0x00, 0x00, 0xBF, 0x96, 0x67, 0xB7,
+    0x00, 0x7C, 0xEE, 0xDA, 0x30, 0x00, 0x0C, 0xF2, 0x00, 0x00, 0x00, 0x3F,
+    0x70, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+    0xFF, 0xF9, 0x00, 0x00, 0x02, 0x3F, 0x90, 0x00, 0x00, 0x00, 0xF9, 0x00,
+    0x00, 0x00, 0x0F, 0x90, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x0F,
+    0x90, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x0F, 0x90, 0x00, 0x02,
+    0x23, 0xFA, 0x32, 0x10, 0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0x00, 0x2F, 0xC0,
+    0x00, 0x00, 0x07, 0xF3, 0x00, 0x00, 0x00, 0xD7, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x05, 0xFF, 0xF9, 0x00, 0x00, 0x02, 0x3F, 0x90, 0x00, 0x00,
+    0x00, 0xF9, 0x00, 0x00, 0x00, 0x0F, 0x90, 0x00, 0x00, 0x00, 0xF9, 0x00,
+    0x00, 0x00, 0x0F, 0x90, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x0F,
+    0x90, 0x00, 0x02, 0x23, 0xFA, 0x32, 0x10, 0xFF, 0xFF, 0xFF, 0xFA, 0x00,
+    0x09, 0xF9, 0x00, 0x00, 0x03, 0xF9, 0xF3, 0x00, 0x00, 0xC8, 0x08, 0xC0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xF9, 0x00, 0x00, 0x02, 0x3F,
+    0x90, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x0F, 0x90, 0x00, 0x00,
+    0x00, 0xF9, 0x00, 0x00, 0x00, 0x0F, 0x90, 0x00, 0x00, 0x00, 0xF9, 0x00,
+    0x00, 0x00, 0x0F, 0x90, 0x00, 0x02, 0x23, 0xFA, 0x32, 0x10, 0xFF, 0xFF,
+    0xFF, 0xFA, 0x00, 0xC6, 0x06, 0xC0, 0x00, 0x0C, 0x60, 0x6C, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0x90, 0x00, 0x00, 0x23, 0xF9, 0x00,
+    0x00, 0x00, 0x0F, 0x90, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x0F,
+    0x90, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x0F, 0x90, 0x00, 0x00,
+    0x00, 0xF9, 0x00, 0x00, 0x22, 0x3F, 0xA3, 0x21, 0x0F, 0xFF, 0xFF, 0xFF,
+    0xA0, 0x00, 0x4B, 0x20, 0x59, 0x00, 0x02, 0x8C, 0x8D, 0x40, 0x00, 0x39,
+    0xDE, 0xA0, 0x00, 0x0A, 0x81, 0x3E, 0x70, 0x00, 0x00, 0x00, 0x6E, 0x10,
+    0x2A, 0xEF, 0xD7, 0xE7, 0x2E, 0xE8, 0x68, 0xEF, 0xBA, 0xF3, 0x00, 0x03,
+    0xFD, 0xEC, 0x00, 0x00, 0x0B, 0xFF, 0xA0, 0x00, 0x00, 0xBE, 0xEC, 0x00,
+    0x00, 0x0D, 0xC9, 0xF3, 0x00, 0x03, 0xF7, 0x2D, 0xE7, 0x68, 0xEC, 0x00,
+    0x19, 0xEF, 0xD8, 0x10, 0x00, 0x00, 0x00, 0x00, 0x02, 0xDD, 0x40, 0x1D,
+    0x0A, 0x98, 0xF9, 0x9A, 0x0E, 0x10, 0x4D, 0xD2, 0x00, 0x00, 0x00, 0x00,
+    0xF6, 0x6D, 0xFD, 0x80, 0xFD, 0xE7, 0x6A, 0xF7, 0xFF, 0x30, 0x00, 0xCD,
+    0xFB, 0x00, 0x00, 0x9F, 0xFA, 0x00, 0x00, 0x9F, 0xF9, 0x00, 0x00, 0x9F,
+    0xF9, 0x00, 0x00, 0x9F, 0xF9, 0x00, 0x00, 0x9F, 0xF9, 0x00, 0x00, 0x9F,
+    0xF9, 0x00, 0x00, 0x9F, 0x00, 0x0C, 0xF2, 0x00, 0x00, 0x00, 0x3F, 0x70,
+    0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x8D,
+    0xFD, 0x81, 0x01, 0xCE, 0x86, 0x8E, 0xC0, 0x8F, 0x40, 0x00, 0x4F, 0x7D,
+    0xD0, 0x00, 0x00, 0xDC, 0xFB, 0x00, 0x00, 0x0B, 0xEF, 0xB0, 0x00, 0x00,
+    0xBE, 0xCD, 0x00, 0x00, 0x0D, 0xC7, 0xF4, 0x00, 0x04, 0xF7, 0x0C, 0xE8,
+    0x68, 0xEC, 0x10, 0x18, 0xDF, 0xD8, 0x10, 0x00, 0x00, 0x2F, 0xC0, 0x00,
+    0x00, 0x07, 0xF3, 0x00, 0x00, 0x00, 0xD7, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x8D, 0xFD, 0x81, 0x01, 0xCE, 0x86, 0x8E, 0xC0, 0x8F, 0x40,
+    0x00, 0x4F, 0x7D, 0xD0, 0x00, 0x00, 0xDC, 0xFB, 0x00, 0x00, 0x0B, 0xEF,
+    0xB0, 0x00, 0x00, 0xBE, 0xCD, 0x00, 0x00, 0x0D, 0xC7, 0xF4, 0x00, 0x04,
+    0xF7, 0x0C, 0xE8, 0x68, 0xEC, 0x10, 0x18, 0xDF, 0xD8, 0x10, 0x00, 0x09,
+    0xF9, 0x00, 0x00, 0x03, 0xF9, 0xF3, 0x00, 0x00, 0xC8, 0x08, 0xC0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x8D, 0xFD, 0x81, 0x01, 0xCE, 0x86, 0x8E,
+    0xC0, 0x8F, 0x40, 0x00, 0x4F, 0x7D, 0xD0, 0x00, 0x00, 0xDC, 0xFB, 0x00,
+    0x00, 0x0B, 0xEF, 0xB0, 0x00, 0x00, 0xBE, 0xCD, 0x00, 0x00, 0x0D, 0xC7,
+    0xF4, 0x00, 0x04, 0xF7, 0x0C, 0xE8, 0x68, 0xEC, 0x10, 0x18, 0xDF, 0xD8,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0xD4, 0x01, 0xD0, 0x0A, 0x98,
+    0xF9, 0x9A, 0x00, 0xE1, 0x04, 0xDD, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x18, 0xDF, 0xD8, 0x10, 0x1C, 0xE8, 0x68, 0xEC, 0x08, 0xF4, 0x00, 0x04,
+    0xF7, 0xDD, 0x00, 0x00, 0x0D, 0xCF, 0xB0, 0x00, 0x00, 0xBE, 0xFB, 0x00,
+    0x00, 0x0B, 0xEC, 0xD0, 0x00, 0x00, 0xDC, 0x7F, 0x40, 0x00, 0x4F, 0x70,
+    0xCE, 0x86, 0x8E, 0xC1, 0x01, 0x8D, 0xFD, 0x81, 0x00, 0x00, 0xC6, 0x06,
+    0xC0, 0x00, 0x0C, 0x60, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
+    0xDF, 0xD8, 0x10, 0x1C, 0xE8, 0x68, 0xEC, 0x08, 0xF4, 0x00, 0x04, 0xF7,
+    0xDD, 0x00, 0x00, 0x0D, 0xCF, 0xB0, 0x00, 0x00, 0xBE, 0xFB, 0x00, 0x00,
+    0x0B, 0xEC, 0xD0, 0x00, 0x00, 0xDC, 0x7F, 0x40, 0x00, 0x4F, 0x70, 0xCE,
+    0x86, 0x8E, 0xC1, 0x01, 0x8D, 0xFD, 0x81, 0x00, 0x00, 0x0B, 0xA0, 0x00,
+    0x00, 0x0D, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xA0, 0x00, 0x00, 0x0C, 0xA0, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x00, 0x19, 0xDF, 0xDA, 0xF4, 0x1D, 0xE8, 0x57,
+    0xFE, 0x18, 0xF3, 0x00, 0x7C, 0xF7, 0xDC, 0x00, 0x2E, 0x2C, 0xCF, 0xB0,
+    0x0C, 0x70, 0xAE, 0xFA, 0x07, 0xC0, 0x0B, 0xEC, 0xC2, 0xE3, 0x00, 0xDC,
+    0x7F, 0xC7, 0x00, 0x3F, 0x81, 0xEF, 0x75, 0x8E, 0xD1, 0x4F, 0xBD, 0xFD,
+    0x91, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0xCF, 0x20, 0x00, 0x00, 0x3F,
+    0x70, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x00,
+    0x00, 0x9F, 0xF9, 0x00, 0x00, 0x9F, 0xF9, 0x00, 0x00, 0x9F, 0xF9, 0x00,
+    0x00, 0x9F, 0xF9, 0x00, 0x00, 0x9F, 0xF9, 0x00, 0x00, 0x9F, 0xF9, 0x00,
+    0x00, 0xBF, 0xDC, 0x00, 0x02, 0xEF, 0x7F, 0xA6, 0x7D, 0xDF, 0x08, 0xDF,
+    0xD6, 0x6F, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x07, 0xF3, 0x00, 0x00, 0x0D,
+    0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x9F, 0xF9, 0x00,
+    0x00, 0x9F, 0xF9, 0x00, 0x00, 0x9F, 0xF9, 0x00, 0x00, 0x9F, 0xF9, 0x00,
+    0x00, 0x9F, 0xF9, 0x00, 0x00, 0x9F, 0xF9, 0x00, 0x00, 0xBF, 0xDC, 0x00,
+    0x02, 0xEF, 0x7F, 0xA6, 0x7D, 0xDF, 0x08, 0xDF, 0xD6, 0x6F, 0x00, 0x09,
+    0xF9, 0x00, 0x00, 0x3F, 0x9F, 0x30, 0x00, 0xC8, 0x08, 0xC0, 0x00, 0x00,
+    0x00, 0x00, 0xF9, 0x00, 0x00, 0x9F, 0xF9, 0x00, 0x00, 0x9F, 0xF9, 0x00,
+    0x00, 0x9F, 0xF9, 0x00, 0x00, 0x9F, 0xF9, 0x00, 0x00, 0x9F, 0xF9, 0x00,
+    0x00, 0x9F, 0xF9, 0x00, 0x00, 0xBF, 0xDC, 0x00, 0x02, 0xEF, 0x7F, 0xA6,
+    0x7D, 0xDF, 0x08, 0xDF, 0xD6, 0x6F, 0x00, 0xC6, 0x06, 0xC0, 0x00, 0xC6,
+    0x06, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x9F, 0xF9, 0x00,
+    0x00, 0x9F, 0xF9, 0x00, 0x00, 0x9F, 0xF9, 0x00, 0x00, 0x9F, 0xF9, 0x00,
+    0x00, 0x9F, 0xF9, 0x00, 0x00, 0x9F, 0xF9, 0x00, 0x00, 0xBF, 0xDC, 0x00,
+    0x02, 0xEF, 0x7F, 0xA6, 0x7D, 0xDF, 0x08, 0xDF, 0xD6, 0x6F, 0x00, 0x00,
+    0x2F, 0xC0, 0x00, 0x00, 0x07, 0xF3, 0x00, 0x00, 0x00, 0xD7, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xCD, 0x00, 0x00, 0x0C, 0xC7, 0xF3, 0x00, 0x03,
+    0xF7, 0x1F, 0x80, 0x00, 0x8F, 0x10, 0xAE, 0x00, 0x0D, 0xA0, 0x05, 0xF4,
+    0x03, 0xF5, 0x00, 0x0E, 0xA0, 0x8E, 0x00, 0x00, 0x8E, 0x1D, 0x80, 0x00,
+    0x02, 0xF7, 0xF3, 0x00, 0x00, 0x0C, 0xEC, 0x00, 0x00, 0x00, 0x6F, 0x70,
+    0x00, 0x00, 0x06, 0xF1, 0x00, 0x00, 0x00, 0xDA, 0x00, 0x00, 0x66, 0xBE,
+    0x20, 0x00, 0x0E, 0xFC, 0x40, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x0F,
+    0x90, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x0F, 0x90, 0x00, 0x00,
+    0x00, 0xF9, 0x5C, 0xFE, 0xA2, 0x0F, 0xDE, 0x76, 0x8E, 0xD1, 0xFF, 0x20,
+    0x00, 0x4F, 0x8F, 0xB0, 0x00, 0x00, 0xDD, 0xF9, 0x00, 0x00, 0x0B, 0xFF,
+    0x90, 0x00, 0x00, 0xBE, 0xFB, 0x00, 0x00, 0x0D, 0xDF, 0xF2, 0x00, 0x04,
+    0xF8, 0xFD, 0xE8, 0x68, 0xED, 0x1F, 0x85, 0xCF, 0xEA, 0x20, 0xF9, 0x00,
+    0x00, 0x00, 0x0F, 0x90, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x0F,
+    0x90, 0x00, 0x00, 0x00, 0x00, 0xC6, 0x06, 0xC0, 0x00, 0x0C, 0x60, 0x6C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xD0, 0x00, 0x00, 0xCC, 0x7F, 0x30,
+    0x00, 0x3F, 0x71, 0xF8, 0x00, 0x08, 0xF1, 0x0A, 0xE0, 0x00, 0xDA, 0x00,
+    0x5F, 0x40, 0x3F, 0x50, 0x00, 0xEA, 0x08, 0xE0, 0x00, 0x08, 0xE1, 0xD8,
+    0x00, 0x00, 0x2F, 0x7F, 0x30, 0x00, 0x00, 0xCE, 0xC0, 0x00, 0x00, 0x06,
+    0xF7, 0x00, 0x00, 0x00, 0x6F, 0x10, 0x00, 0x00, 0x0D, 0xA0, 0x00, 0x06,
+    0x6B, 0xE2, 0x00, 0x00, 0xEF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55,
+    0x55, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x08, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xDE, 0xD0, 0x00,
+    0x00, 0x00, 0x4F, 0x8F, 0x40, 0x00, 0x00, 0x09, 0xF1, 0xF9, 0x00, 0x00,
+    0x00, 0xEB, 0x0B, 0xE0, 0x00, 0x00, 0x5F, 0x60, 0x6F, 0x50, 0x00, 0x0A,
+    0xF1, 0x01, 0xFA, 0x00, 0x01, 0xFC, 0x00, 0x0C, 0xF1, 0x00, 0x6F, 0xFF,
+    0xFF, 0xFF, 0x60, 0x0B, 0xF7, 0x77, 0x77, 0xFB, 0x02, 0xFA, 0x00, 0x00,
+    0x0A, 0xF2, 0x7F, 0x40, 0x00, 0x00, 0x4F, 0x7C, 0xD0, 0x00, 0x00, 0x00,
+    0xDC, 0x00, 0x55, 0x55, 0x50, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+    0x00, 0x17, 0xCE, 0xFD, 0x81, 0x1D, 0x96, 0x6A, 0xF8, 0x00, 0x00, 0x00,
+    0xCD, 0x00, 0x00, 0x00, 0x9F, 0x04, 0xAD, 0xEF, 0xFF, 0x7F, 0xB5, 0x32,
+    0xAF, 0xEC, 0x00, 0x00, 0xAF, 0xEB, 0x00, 0x01, 0xEF, 0xAF, 0x74, 0x6D,
+    0xCF, 0x19, 0xEF, 0xC6, 0x4F, 0x00, 0x0E, 0x10, 0x1E, 0x00, 0x00, 0x00,
+    0xA9, 0x5A, 0x90, 0x00, 0x00, 0x02, 0xCE, 0xB1, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x80, 0x00, 0x00, 0x00, 0x0D, 0xED,
+    0x00, 0x00, 0x00, 0x04, 0xF8, 0xF4, 0x00, 0x00, 0x00, 0x9F, 0x1F, 0x90,
+    0x00, 0x00, 0x0E, 0xB0, 0xBE, 0x00, 0x00, 0x05, 0xF6, 0x06, 0xF5, 0x00,
+    0x00, 0xAF, 0x10, 0x1F, 0xA0, 0x00, 0x1F, 0xC0, 0x00, 0xCF, 0x10, 0x06,
+    0xFF, 0xFF, 0xFF, 0xF6, 0x00, 0xBF, 0x77, 0x77, 0x7F, 0xB0, 0x2F, 0xA0,
+    0x00, 0x00, 0xAF, 0x27, 0xF4, 0x00, 0x00, 0x04, 0xF7, 0xCD, 0x00, 0x00,
+    0x00, 0x0D, 0xC0, 0x00, 0xE1, 0x01, 0xE0, 0x00, 0xA9, 0x5A, 0x90, 0x00,
+    0x2C, 0xEB, 0x10, 0x00, 0x00, 0x00, 0x00, 0x17, 0xCE, 0xFD, 0x81, 0x1D,
+    0x96, 0x6A, 0xF8, 0x00, 0x00, 0x00, 0xCD, 0x00, 0x00, 0x00, 0x9F, 0x04,
+    0xAD, 0xEF, 0xFF, 0x7F, 0xB5, 0x32, 0xAF, 0xEC, 0x00, 0x00, 0xAF, 0xEB,
+    0x00, 0x01, 0xEF, 0xAF, 0x74, 0x6D, 0xCF, 0x19, 0xEF, 0xC6, 0x4F, 0x00,
+    0x00, 0x8F, 0x80, 0x00, 0x00, 0x00, 0x00, 0xDE, 0xD0, 0x00, 0x00, 0x00,
+    0x04, 0xF8, 0xF4, 0x00, 0x00, 0x00, 0x09, 0xF1, 0xF9, 0x00, 0x00, 0x00,
+    0x0E, 0xB0, 0xBE, 0x00, 0x00, 0x00, 0x5F, 0x60, 0x6F, 0x50, 0x00, 0x00,
+    0xAF, 0x10, 0x1F, 0xA0, 0x00, 0x01, 0xFC, 0x00, 0x0C, 0xF1, 0x00, 0x06,
+    0xFF, 0xFF, 0xFF, 0xF6, 0x00, 0x0B, 0xF7, 0x77, 0x77, 0xFB, 0x00, 0x2F,
+    0xA0, 0x00, 0x00, 0xAF, 0x20, 0x7F, 0x40, 0x00, 0x00, 0x4F, 0x70, 0xCD,
+    0x00, 0x00, 0x00, 0x0D, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x60, 0x00,
+    0x00, 0x00, 0x00, 0xC7, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x12, 0x00,
+    0x00, 0x00, 0x00, 0x1C, 0xFD, 0x17, 0xCE, 0xFD, 0x81, 0x01, 0xD9, 0x66,
+    0xAF, 0x80, 0x00, 0x00, 0x00, 0xCD, 0x00, 0x00, 0x00, 0x09, 0xF0, 0x04,
+    0xAD, 0xEF, 0xFF, 0x07, 0xFB, 0x53, 0x2A, 0xF0, 0xEC, 0x00, 0x00, 0xAF,
+    0x0E, 0xB0, 0x00, 0x1E, 0xF0, 0xAF, 0x74, 0x6D, 0xCF, 0x01, 0x9E, 0xFC,
+    0x64, 0xF0, 0x00, 0x00, 0x02, 0xC6, 0x00, 0x00, 0x00, 0xC7, 0x00, 0x00,
+    0x00, 0x0B, 0x81, 0x20, 0x00, 0x00, 0x1C, 0xFD, 0x00, 0x00, 0x02, 0xFC,
+    0x00, 0x00, 0x00, 0x7F, 0x30, 0x00, 0x00, 0x0D, 0x70, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x29, 0xDF, 0xEC, 0x60, 0x4E, 0xFA, 0x78, 0xCA, 0x1E,
+    0xE3, 0x00, 0x00, 0x07, 0xF6, 0x00, 0x00, 0x00, 0xCF, 0x00, 0x00, 0x00,
+    0x0E, 0xC0, 0x00, 0x00, 0x00, 0xFB, 0x00, 0x00, 0x00, 0x0E, 0xC0, 0x00,
+    0x00, 0x00, 0xCE, 0x00, 0x00, 0x00, 0x08, 0xF5, 0x00, 0x00, 0x00, 0x2E,
+    0xE3, 0x00, 0x00, 0x00, 0x5F, 0xFA, 0x77, 0x9D, 0x00, 0x29, 0xDF, 0xED,
+    0x90, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x07, 0xF3, 0x00, 0x00, 0xD7, 0x00,
+    0x00, 0x00, 0x00, 0x02, 0xAE, 0xFD, 0x91, 0xDE, 0x86, 0x88, 0x8F, 0x40,
+    0x00, 0x0D, 0xD0, 0x00, 0x00, 0xFB, 0x00, 0x00, 0x0F, 0xB0, 0x00, 0x00,
+    0xDD, 0x00, 0x00, 0x09, 0xF4, 0x00, 0x00, 0x1E, 0xE8, 0x57, 0xB0, 0x2A,
+    0xEF, 0xDA, 0x00, 0x00, 0x9F, 0x90, 0x00, 0x00, 0x3F, 0x9F, 0x30, 0x00,
+    0x0C, 0x80, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xDF, 0xEC,
+    0x60, 0x4E, 0xFA, 0x78, 0xCA, 0x1E, 0xE3, 0x00, 0x00, 0x07, 0xF6, 0x00,
+    0x00, 0x00, 0xCF, 0x00, 0x00, 0x00, 0x0E, 0xC0, 0x00, 0x00, 0x00, 0xFB,
+    0x00, 0x00, 0x00, 0x0E, 0xC0, 0x00, 0x00, 0x00, 0xCE, 0x00, 0x00, 0x00,
+    0x08, 0xF5, 0x00, 0x00, 0x00, 0x2E, 0xE3, 0x00, 0x00, 0x00, 0x5F, 0xFA,
+    0x77, 0x9D, 0x00, 0x29, 0xDF, 0xED, 0x90, 0x00, 0x09, 0xF9, 0x00, 0x03,
+    0xF9, 0xF3, 0x00, 0xC8, 0x08, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xAE, 0xFD,
+    0x91, 0xDE, 0x86, 0x88, 0x8F, 0x40, 0x00, 0x0D, 0xD0, 0x00, 0x00, 0xFB,
+    0x00, 0x00, 0x0F, 0xB0, 0x00, 0x00, 0xDD, 0x00, 0x00, 0x09, 0xF4, 0x00,
+    0x00, 0x1E, 0xE8, 0x57, 0xB0, 0x2A, 0xEF, 0xDA, 0x00, 0x00, 0x0C, 0x50,
+    0x00, 0x00, 0x00, 0xC5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x9D,
+    0xFE, 0xC6, 0x04, 0xEF, 0xA7, 0x8C, 0xA1, 0xEE, 0x30, 0x00, 0x00, 0x7F,
+    0x60, 0x00, 0x00, 0x0C, 0xF0, 0x00, 0x00, 0x00, 0xEC, 0x00, 0x00, 0x00,
+    0x0F, 0xB0, 0x00, 0x00, 0x00, 0xEC, 0x00, 0x00, 0x00, 0x0C, 0xE0, 0x00,
+    0x00, 0x00, 0x8F, 0x50, 0x00, 0x00, 0x02, 0xEE, 0x30, 0x00, 0x00, 0x05,
+    0xFF, 0xA7, 0x79, 0xD0, 0x02, 0x9D, 0xFE, 0xD9, 0x00, 0x00, 0xC5, 0x00,
+    0x00, 0x0C, 0x50, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xEF, 0xD9, 0x1D, 0xE8,
+    0x68, 0x88, 0xF4, 0x00, 0x00, 0xDD, 0x00, 0x00, 0x0F, 0xB0, 0x00, 0x00,
+    0xFB, 0x00, 0x00, 0x0D, 0xD0, 0x00, 0x00, 0x9F, 0x40, 0x00, 0x01, 0xEE,
+    0x85, 0x7B, 0x02, 0xAE, 0xFD, 0xA0, 0x00, 0x0C, 0x80, 0x8C, 0x00, 0x00,
+    0x3F, 0x9F, 0x30, 0x00, 0x00, 0x9F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x29, 0xDF, 0xEC, 0x60, 0x4E, 0xFA, 0x78, 0xCA, 0x1E, 0xE3, 0x00,
+    0x00, 0x07, 0xF6, 0x00, 0x00, 0x00, 0xCF, 0x00, 0x00, 0x00, 0x0E, 0xC0,
+    0x00, 0x00, 0x00, 0xFB, 0x00, 0x00, 0x00, 0x0E, 0xC0, 0x00, 0x00, 0x00,
+    0xCE, 0x00, 0x00, 0x00, 0x08, 0xF5, 0x00, 0x00, 0x00, 0x2E, 0xE3, 0x00,
+    0x00, 0x00, 0x5F, 0xFA, 0x77, 0x9D, 0x00, 0x29, 0xDF, 0xED, 0x90, 0x00,
+    0xC8, 0x08, 0xC0, 0x03, 0xF9, 0xF3, 0x00, 0x09, 0xF9, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0xAE, 0xFD, 0x91, 0xDE, 0x86, 0x88, 0x8F, 0x40, 0x00, 0x0D,
+    0xD0, 0x00, 0x00, 0xFB, 0x00, 0x00, 0x0F, 0xB0, 0x00, 0x00, 0xDD, 0x00,
+    0x00, 0x09, 0xF4, 0x00, 0x00, 0x1E, 0xE8, 0x57, 0xB0, 0x2A, 0xEF, 0xDA,
+    0x00, 0xC8, 0x08, 0xC0, 0x00, 0x03, 0xF9, 0xF3, 0x00, 0x00, 0x09, 0xF9,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xD8, 0x20, 0x0F, 0xC6,
+    0x7A, 0xFE, 0x40, 0xFA, 0x00, 0x02, 0xDE, 0x1F, 0xA0, 0x00, 0x05, 0xF8,
+    0xFA, 0x00, 0x00, 0x0E, 0xCF, 0xA0, 0x00, 0x00, 0xCE, 0xFA, 0x00, 0x00,
+    0x0B, 0xFF, 0xA0, 0x00, 0x00, 0xCE, 0xFA, 0x00, 0x00, 0x0F, 0xBF, 0xA0,
+    0x00, 0x06, 0xF7, 0xFA, 0x00, 0x03, 0xED, 0x1F, 0xC6, 0x7B, 0xFE, 0x30,
+    0xFF, 0xFE, 0xC8, 0x10, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x08, 0xD0, 0x00,
+    0x00, 0x09, 0xF0, 0xB8, 0x00, 0x00, 0x00, 0x9F, 0x0D, 0x10, 0x00, 0x00,
+    0x09, 0xF0, 0x00, 0x04, 0xCF, 0xD7, 0x8F, 0x00, 0x02, 0xED, 0x77, 0xDD,
+    0xF0, 0x00, 0x9F, 0x20, 0x01, 0xEF, 0x00, 0x0D, 0xC0, 0x00, 0x0B, 0xF0,
+    0x00, 0xFB, 0x00, 0x00, 0x9F, 0x00, 0x0F, 0xA0, 0x00, 0x09, 0xF0, 0x00,
+    0xDC, 0x00, 0x00, 0xBF, 0x00, 0x09, 0xF2, 0x00, 0x1E, 0xF0, 0x00, 0x2E,
+    0xD6, 0x6C, 0xDF, 0x00, 0x00, 0x4C, 0xFD, 0x75, 0xF0, 0x00, 0x0F, 0xFF,
+    0xED, 0x82, 0x00, 0x0F, 0xC6, 0x7A, 0xFE, 0x40, 0x0F, 0xA0, 0x00, 0x2D,
+    0xE1, 0x0F, 0xA0, 0x00, 0x05, 0xF8, 0x0F, 0xA0, 0x00, 0x00, 0xEC, 0xFF,
+    0xFF, 0xFF, 0x10, 0xCE, 0x7F, 0xC7, 0x77, 0x00, 0xBF, 0x0F, 0xA0, 0x00,
+    0x00, 0xCE, 0x0F, 0xA0, 0x00, 0x00, 0xFB, 0x0F, 0xA0, 0x00, 0x06, 0xF7,
+    0x0F, 0xA0, 0x00, 0x3E, 0xD1, 0x0F, 0xC6, 0x7B, 0xFE, 0x30, 0x0F, 0xFF,
+    0xEC, 0x81, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x9F,
+    0x00, 0x00, 0x0C, 0xFF, 0xFF, 0xF6, 0x00, 0x02, 0x22, 0xAF, 0x21, 0x03,
+    0xCF, 0xD7, 0x9F, 0x00, 0x2E, 0xD7, 0x7D, 0xDF, 0x00, 0x9F, 0x20, 0x01,
+    0xEF, 0x00, 0xDC, 0x00, 0x00, 0xBF, 0x00, 0xFB, 0x00, 0x00, 0x9F, 0x00,
+    0xFA, 0x00, 0x00, 0x9F, 0x00, 0xDC, 0x00, 0x00, 0xBF, 0x00, 0x9F, 0x20,
+    0x01, 0xEF, 0x00, 0x2E, 0xD6, 0x6C, 0xEF, 0x00, 0x04, 0xCF, 0xD8, 0x6F,
+    0x00, 0x00, 0x55, 0x55, 0x50, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x77, 0x77, 0x77, 0xFA, 0x00, 0x00,
+    0x00, 0xFA, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFC, 0x77, 0x77, 0x77, 0xFA, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00,
+    0x00, 0xFA, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0xFC, 0x77, 0x77,
+    0x77, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x55, 0x55, 0x50, 0x00, 0x0F, 0xFF,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xDF, 0xEA, 0x20, 0x0C,
+    0xE8, 0x67, 0xDE, 0x27, 0xF3, 0x00, 0x01, 0xEA, 0xCC, 0x00, 0x00, 0x0B,
+    0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x55, 0x55, 0x55, 0x5C, 0xD0, 0x00,
+    0x00, 0x00, 0x7F, 0x50, 0x00, 0x00, 0x00, 0xBF, 0x96, 0x67, 0xB7, 0x00,
+    0x7C, 0xEE, 0xDA, 0x30, 0x00, 0xE1, 0x01, 0xE0, 0x00, 0xA9, 0x5A, 0x90,
+    0x00, 0x2C, 0xEB, 0x10, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFC, 0x77, 0x77, 0x77, 0xFA, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00,
+    0xFA, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x77, 0x77, 0x77,
+    0xFA, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00,
+    0xFA, 0x00, 0x00, 0x00, 0xFC, 0x77, 0x77, 0x77, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0xE1, 0x01, 0xE0, 0x00, 0x0A, 0x95, 0xA9, 0x00, 0x00, 0x2C, 0xEB,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x8D, 0xFE, 0xA2, 0x00, 0xCE,
+    0x86, 0x7D, 0xE2, 0x7F, 0x30, 0x00, 0x1E, 0xAC, 0xC0, 0x00, 0x00, 0xBE,
+    0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC5, 0x55, 0x55, 0x55, 0xCD, 0x00, 0x00,
+    0x00, 0x07, 0xF5, 0x00, 0x00, 0x00, 0x0B, 0xF9, 0x66, 0x7B, 0x70, 0x07,
+    0xCE, 0xED, 0xA3, 0x00, 0x00, 0xC5, 0x00, 0x00, 0x00, 0xC5, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x77, 0x77, 0x77, 0xFA,
+    0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFC, 0x77, 0x77, 0x77, 0xFA, 0x00, 0x00, 0x00, 0xFA,
+    0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0xFC,
+    0x77, 0x77, 0x77, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xC5, 0x00, 0x00,
+    0x00, 0x0C, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xDF, 0xEA,
+    0x20, 0x0C, 0xE8, 0x67, 0xDE, 0x27, 0xF3, 0x00, 0x01, 0xEA, 0xCC, 0x00,
+    0x00, 0x0B, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x55, 0x55, 0x55, 0x5C,
+    0xD0, 0x00, 0x00, 0x00, 0x7F, 0x50, 0x00, 0x00, 0x00, 0xBF, 0x96, 0x67,
+    0xB7, 0x00, 0x7C, 0xEE, 0xDA, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x77,
+    0x77, 0x77, 0xFA, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0xFA, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x77, 0x77, 0x77, 0xFA, 0x00,
+    0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0xFA, 0x00,
+    0x00, 0x00, 0xFC, 0x77, 0x77, 0x77, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+    0x2C, 0x60, 0x00, 0x00, 0xC7, 0x00, 0x00, 0x00, 0xB8, 0x12, 0x00, 0x00,
+    0x1C, 0xFD, 0x01, 0x8D, 0xFE, 0xA2, 0x00, 0xCE, 0x86, 0x7D, 0xE2, 0x7F,
+    0x30, 0x00, 0x1E, 0xAC, 0xC0, 0x00, 0x00, 0xBE, 0xEF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xC5, 0x55, 0x55, 0x55, 0xCD, 0x00, 0x00, 0x00, 0x07, 0xF5, 0x00,
+    0x00, 0x00, 0x0B, 0xF9, 0x66, 0x7B, 0x70, 0x07, 0xCE, 0xED, 0xA3, 0x00,
+    0x00, 0x02, 0xC6, 0x00, 0x00, 0x00, 0xC7, 0x00, 0x00, 0x00, 0x0B, 0x81,
+    0x20, 0x00, 0x00, 0x1C, 0xFD, 0x00, 0xC8, 0x08, 0xC0, 0x00, 0x3F, 0x9F,
+    0x30, 0x00, 0x09, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFC, 0x77, 0x77, 0x77, 0xFA, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00,
+    0x00, 0xFA, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x77, 0x77,
+    0x77, 0xFA, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00,
+    0x00, 0xFA, 0x00, 0x00, 0x00, 0xFC, 0x77, 0x77, 0x77, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x00, 0xC8, 0x08, 0xC0, 0x00, 0x03, 0xF9, 0xF3, 0x00, 0x00, 0x09,
+    0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x8D, 0xFE, 0xA2, 0x00,
+    0xCE, 0x86, 0x7D, 0xE2, 0x7F, 0x30, 0x00, 0x1E, 0xAC, 0xC0, 0x00, 0x00,
+    0xBE, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC5, 0x55, 0x55, 0x55, 0xCD, 0x00,
+    0x00, 0x00, 0x07, 0xF5, 0x00, 0x00, 0x00, 0x0B, 0xF9, 0x66, 0x7B, 0x70,
+    0x07, 0xCE, 0xED, 0xA3, 0x00, 0x00, 0x9F, 0x90, 0x00, 0x00, 0x3F, 0x9F,
+    0x30, 0x00, 0x0C, 0x80, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29,
+    0xDF, 0xEB, 0x50, 0x4E, 0xE9, 0x79, 0xD7, 0x1E, 0xD2, 0x00, 0x00, 0x08,
+    0xF5, 0x00, 0x00, 0x00, 0xCE, 0x00, 0x00, 0x00, 0x0E, 0xC0, 0x00, 0xDF,
+    0xFF, 0xFB, 0x00, 0x06, 0x7C, 0xFE, 0xC0, 0x00, 0x00, 0xAF, 0xCE, 0x00,
+    0x00, 0x0A, 0xF8, 0xF4, 0x00, 0x00, 0xAF, 0x2F, 0xC1, 0x00, 0x0A, 0xF0,
+    0x6F, 0xE8, 0x78, 0xDF, 0x00, 0x4B, 0xEF, 0xDB, 0x60, 0x00, 0x00, 0x9F,
+    0x90, 0x00, 0x00, 0x00, 0x3F, 0x9F, 0x30, 0x00, 0x00, 0x0C, 0x80, 0x8C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6C, 0xEF, 0xFF, 0xFF,
+    0x20, 0x8F, 0x73, 0x37, 0xFA, 0x10, 0x0E, 0xA0, 0x00, 0x0A, 0xE0, 0x00,
+    0xEA, 0x00, 0x00, 0xAE, 0x00, 0x08, 0xF6, 0x22, 0x6F, 0x90, 0x00, 0x08,
+    0xFF, 0xEC, 0x60, 0x00, 0x00, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x91,
+    0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xFD, 0x91, 0x03, 0xC9, 0x65, 0x55,
+    0x7E, 0xB0, 0xCA, 0x00, 0x00, 0x00, 0x9E, 0x0E, 0x90, 0x00, 0x00, 0x0B,
+    0xD0, 0x9F, 0x95, 0x45, 0x7C, 0xF5, 0x00, 0x7C, 0xEF, 0xED, 0x93, 0x00,
+    0x00, 0x0E, 0x10, 0x1E, 0x00, 0x00, 0xA9, 0x5A, 0x90, 0x00, 0x02, 0xCE,
+    0xB1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xDF, 0xEB, 0x50, 0x4E,
+    0xE9, 0x79, 0xD7, 0x1E, 0xD2, 0x00, 0x00, 0x08, 0xF5, 0x00, 0x00, 0x00,
+    0xCE, 0x00, 0x00, 0x00, 0x0E, 0xC0, 0x00, 0xDF, 0xFF, 0xFB, 0x00, 0x06,
+    0x7C, 0xFE, 0xC0, 0x00, 0x00, 0xAF, 0xCE, 0x00, 0x00, 0x0A, 0xF8, 0xF4,
+    0x00, 0x00, 0xAF, 0x2F, 0xC1, 0x00, 0x0A, 0xF0, 0x6F, 0xE8, 0x78, 0xDF,
+    0x00, 0x4B, 0xEF, 0xDB, 0x60, 0x00, 0x0E, 0x10, 0x1E, 0x00, 0x00, 0x00,
+    0xA9, 0x5A, 0x90, 0x00, 0x00, 0x02, 0xCE, 0xB1, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x6C, 0xEF, 0xFF, 0xFF, 0x20, 0x8F, 0x73, 0x37,
+    0xFA, 0x10, 0x0E, 0xA0, 0x00, 0x0A, 0xE0, 0x00, 0xEA, 0x00, 0x00, 0xAE,
+    0x00, 0x08, 0xF6, 0x22, 0x6F, 0x90, 0x00, 0x08, 0xFF, 0xEC, 0x60, 0x00,
+    0x00, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x91, 0x00, 0x00, 0x00, 0x00,
+    0x9F, 0xFF, 0xFD, 0x91, 0x03, 0xC9, 0x65, 0x55, 0x7E, 0xB0, 0xCA, 0x00,
+    0x00, 0x00, 0x9E, 0x0E, 0x90, 0x00, 0x00, 0x0B, 0xD0, 0x9F, 0x95, 0x45,
+    0x7C, 0xF5, 0x00, 0x7C, 0xEF, 0xED, 0x93, 0x00, 0x00, 0x00, 0x0C, 0x50,
+    0x00, 0x00, 0x00, 0xC5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x9D,
+    0xFE, 0xB5, 0x04, 0xEE, 0x97, 0x9D, 0x71, 0xED, 0x20, 0x00, 0x00, 0x8F,
+    0x50, 0x00, 0x00, 0x0C, 0xE0, 0x00, 0x00, 0x00, 0xEC, 0x00, 0x0D, 0xFF,
+    0xFF, 0xB0, 0x00, 0x67, 0xCF, 0xEC, 0x00, 0x00, 0x0A, 0xFC, 0xE0, 0x00,
+    0x00, 0xAF, 0x8F, 0x40, 0x00, 0x0A, 0xF2, 0xFC, 0x10, 0x00, 0xAF, 0x06,
+    0xFE, 0x87, 0x8D, 0xF0, 0x04, 0xBE, 0xFD, 0xB6, 0x00, 0x00, 0x0C, 0x50,
+    0x00, 0x00, 0x00, 0x00, 0xC5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x06, 0xCE, 0xFF, 0xFF, 0xF2, 0x08, 0xF7, 0x33, 0x7F, 0xA1, 0x00,
+    0xEA, 0x00, 0x00, 0xAE, 0x00, 0x0E, 0xA0, 0x00, 0x0A, 0xE0, 0x00, 0x8F,
+    0x62, 0x26, 0xF9, 0x00, 0x00, 0x8F, 0xFE, 0xC6, 0x00, 0x00, 0x0B, 0xA0,
+    0x00, 0x00, 0x00, 0x00, 0xE9, 0x10, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF,
+    0xD9, 0x10, 0x3C, 0x96, 0x55, 0x57, 0xEB, 0x0C, 0xA0, 0x00, 0x00, 0x09,
+    0xE0, 0xE9, 0x00, 0x00, 0x00, 0xBD, 0x09, 0xF9, 0x54, 0x57, 0xCF, 0x50,
+    0x07, 0xCE, 0xFE, 0xD9, 0x30, 0x00, 0x00, 0x29, 0xDF, 0xEB, 0x50, 0x4E,
+    0xE9, 0x79, 0xD7, 0x1E, 0xD2, 0x00, 0x00, 0x08, 0xF5, 0x00, 0x00, 0x00,
+    0xCE, 0x00, 0x00, 0x00, 0x0E, 0xC0, 0x00, 0xDF, 0xFF, 0xFB, 0x00, 0x06,
+    0x7C, 0xFE, 0xC0, 0x00, 0x00, 0xAF, 0xCE, 0x00, 0x00, 0x0A, 0xF8, 0xF4,
+    0x00, 0x00, 0xAF, 0x2F, 0xC1, 0x00, 0x0A, 0xF0, 0x6F, 0xE8, 0x78, 0xDF,
+    0x00, 0x4B, 0xEF, 0xDB, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E,
+    0x00, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x00, 0x00, 0xD1, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x8A, 0x00, 0x00, 0x00, 0x00,
+    0x0E, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6C, 0xEF,
+    0xFF, 0xFF, 0x20, 0x8F, 0x73, 0x37, 0xFA, 0x10, 0x0E, 0xA0, 0x00, 0x0A,
+    0xE0, 0x00, 0xEA, 0x00, 0x00, 0xAE, 0x00, 0x08, 0xF6, 0x22, 0x6F, 0x90,
+    0x00, 0x08, 0xFF, 0xEC, 0x60, 0x00, 0x00, 0xBA, 0x00, 0x00, 0x00, 0x00,
+    0x0E, 0x91, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xFD, 0x91, 0x03, 0xC9,
+    0x65, 0x55, 0x7E, 0xB0, 0xCA, 0x00, 0x00, 0x00, 0x9E, 0x0E, 0x90, 0x00,
+    0x00, 0x0B, 0xD0, 0x9F, 0x95, 0x45, 0x7C, 0xF5, 0x00, 0x7C, 0xEF, 0xED,
+    0x93, 0x00, 0x00, 0x09, 0xF9, 0x00, 0x00, 0x03, 0xF9, 0xF3, 0x00, 0x00,
+    0xC8, 0x08, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x0A,
+    0xFF, 0xA0, 0x00, 0x00, 0xAF, 0xFA, 0x00, 0x00, 0x0A, 0xFF, 0xA0, 0x00,
+    0x00, 0xAF, 0xFA, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
+    0x77, 0x77, 0x7C, 0xFF, 0xA0, 0x00, 0x00, 0xAF, 0xFA, 0x00, 0x00, 0x0A,
+    0xFF, 0xA0, 0x00, 0x00, 0xAF, 0xFA, 0x00, 0x00, 0x0A, 0xFF, 0xA0, 0x00,
+    0x00, 0xAF, 0xFA, 0x00, 0x00, 0x0A, 0xF0, 0x00, 0x09, 0xF9, 0x00, 0x00,
+    0x3F, 0x9F, 0x30, 0x00, 0xC8, 0x08, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xF9,
+    0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0xF9,
+    0x00, 0x00, 0x00, 0xF9, 0x6D, 0xFD, 0x80, 0xFD, 0xE7, 0x6A, 0xF7, 0xFF,
+    0x30, 0x00, 0xCD, 0xFB, 0x00, 0x00, 0x9F, 0xFA, 0x00, 0x00, 0x9F, 0xF9,
+    0x00, 0x00, 0x9F, 0xF9, 0x00, 0x00, 0x9F, 0xF9, 0x00, 0x00, 0x9F, 0xF9,
+    0x00, 0x00, 0x9F, 0xF9, 0x00, 0x00, 0x9F, 0x00, 0xFA, 0x00, 0x00, 0x0A,
+    0xF0, 0x00, 0x0F, 0xA0, 0x00, 0x00, 0xAF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x31, 0x6F, 0xC6, 0x66, 0x66, 0xCF, 0x61, 0x00, 0xFA, 0x00,
+    0x00, 0x0A, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFC,
+    0x77, 0x77, 0x7C, 0xF0, 0x00, 0x0F, 0xA0, 0x00, 0x00, 0xAF, 0x00, 0x00,
+    0xFA, 0x00, 0x00, 0x0A, 0xF0, 0x00, 0x0F, 0xA0, 0x00, 0x00, 0xAF, 0x00,
+    0x00, 0xFA, 0x00, 0x00, 0x0A, 0xF0, 0x00, 0x0F, 0xA0, 0x00, 0x00, 0xAF,
+    0x00, 0x00, 0xFA, 0x00, 0x00, 0x0A, 0xF0, 0x00, 0x00, 0xF9, 0x00, 0x00,
+    0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xF4, 0x00, 0x12,
+    0xFA, 0x22, 0x21, 0x00, 0x00, 0xF9, 0x6D, 0xFD, 0x80, 0x00, 0xFD, 0xE7,
+    0x6A, 0xF8, 0x00, 0xFF, 0x20, 0x00, 0xDD, 0x00, 0xFB, 0x00, 0x00, 0x9F,
+    0x00, 0xF9, 0x00, 0x00, 0x9F, 0x00, 0xF9, 0x00, 0x00, 0x9F, 0x00, 0xF9,
+    0x00, 0x00, 0x9F, 0x00, 0xF9, 0x00, 0x00, 0x9F, 0x00, 0xF9, 0x00, 0x00,
+    0x9F, 0x00, 0xF9, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x02, 0xDD,
+    0x40, 0x1D, 0x0A, 0x98, 0xF9, 0x9A, 0x0E, 0x10, 0x4D, 0xD2, 0x00, 0x00,
+    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF9, 0x14, 0x5C, 0xF5, 0x42, 0x00, 0x09,
+    0xF0, 0x00, 0x00, 0x09, 0xF0, 0x00, 0x00, 0x09, 0xF0, 0x00, 0x00, 0x09,
+    0xF0, 0x00, 0x00, 0x09, 0xF0, 0x00, 0x00, 0x09, 0xF0, 0x00, 0x00, 0x09,
+    0xF0, 0x00, 0x00, 0x09, 0xF0, 0x00, 0x00, 0x09, 0xF0, 0x00, 0x14, 0x5C,
+    0xF5, 0x42, 0x3F, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D,
+    0xD4, 0x01, 0xD0, 0x0A, 0x98, 0xF9, 0x9A, 0x00, 0xE1, 0x04, 0xDD, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0x90, 0x00, 0x00, 0x23, 0xF9,
+    0x00, 0x00, 0x00, 0x0F, 0x90, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00,
+    0x0F, 0x90, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x0F, 0x90, 0x00,
+    0x00, 0x00, 0xF9, 0x00, 0x00, 0x22, 0x3F, 0xA3, 0x21, 0x0F, 0xFF, 0xFF,
+    0xFF, 0xA0, 0x00, 0x55, 0x55, 0x50, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
+    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF9, 0x14, 0x5C, 0xF5, 0x42, 0x00, 0x09,
+    0xF0, 0x00, 0x00, 0x09, 0xF0, 0x00, 0x00, 0x09, 0xF0, 0x00, 0x00, 0x09,
+    0xF0, 0x00, 0x00, 0x09, 0xF0, 0x00, 0x00, 0x09, 0xF0, 0x00, 0x00, 0x09,
+    0xF0, 0x00, 0x00, 0x09, 0xF0, 0x00, 0x00, 0x09, 0xF0, 0x00, 0x14, 0x5C,
+    0xF5, 0x42, 0x3F, 0xFF, 0xFF, 0xF9, 0x00, 0x55, 0x55, 0x50, 0x00, 0x0F,
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0x90, 0x00,
+    0x00, 0x23, 0xF9, 0x00, 0x00, 0x00, 0x0F, 0x90, 0x00, 0x00, 0x00, 0xF9,
+    0x00, 0x00, 0x00, 0x0F, 0x90, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00,
+    0x0F, 0x90, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x22, 0x3F, 0xA3, 0x21,
+    0x0F, 0xFF, 0xFF, 0xFF, 0xA0, 0x00, 0xE1, 0x01, 0xE0, 0x00, 0xA9, 0x5A,
+    0x90, 0x00, 0x2C, 0xEB, 0x10, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
+    0xF9, 0x14, 0x5C, 0xF5, 0x42, 0x00, 0x09, 0xF0, 0x00, 0x00, 0x09, 0xF0,
+    0x00, 0x00, 0x09, 0xF0, 0x00, 0x00, 0x09, 0xF0, 0x00, 0x00, 0x09, 0xF0,
+    0x00, 0x00, 0x09, 0xF0, 0x00, 0x00, 0x09, 0xF0, 0x00, 0x00, 0x09, 0xF0,
+    0x00, 0x00, 0x09, 0xF0, 0x00, 0x14, 0x5C, 0xF5, 0x42, 0x3F, 0xFF, 0xFF,
+    0xF9, 0x00, 0x0E, 0x10, 0x1E, 0x00, 0x00, 0xA9, 0x5A, 0x90, 0x00, 0x02,
+    0xCE, 0xB1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xF9, 0x00, 0x00,
+    0x02, 0x3F, 0x90, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x0F, 0x90,
+    0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x0F, 0x90, 0x00, 0x00, 0x00,
+    0xF9, 0x00, 0x00, 0x00, 0x0F, 0x90, 0x00, 0x02, 0x23, 0xFA, 0x32, 0x10,
+    0xFF, 0xFF, 0xFF, 0xFA, 0x3F, 0xFF, 0xFF, 0xF9, 0x14, 0x5C, 0xF5, 0x42,
+    0x00, 0x09, 0xF0, 0x00, 0x00, 0x09, 0xF0, 0x00, 0x00, 0x09, 0xF0, 0x00,
+    0x00, 0x09, 0xF0, 0x00, 0x00, 0x09, 0xF0, 0x00, 0x00, 0x09, 0xF0, 0x00,
+    0x00, 0x09, 0xF0, 0x00, 0x00, 0x09, 0xF0, 0x00, 0x00, 0x09, 0xF0, 0x00,
+    0x14, 0x5C, 0xF5, 0x42, 0x3F, 0xFF, 0xFF, 0xF9, 0x00, 0x02, 0xC6, 0x00,
+    0x00, 0x0C, 0x70, 0x00, 0x00, 0x0B, 0x81, 0x20, 0x00, 0x01, 0xCF, 0xD0,
+    0x00, 0x00, 0xD8, 0x00, 0x00, 0x00, 0x0D, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xF9, 0x00, 0x00, 0x02,
+    0x3F, 0x90, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x0F, 0x90, 0x00,
+    0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x0F, 0x90, 0x00, 0x00, 0x00, 0xF9,
+    0x00, 0x00, 0x00, 0x0F, 0x90, 0x00, 0x02, 0x23, 0xFA, 0x32, 0x10, 0xFF,
+    0xFF, 0xFF, 0xFA, 0x00, 0x02, 0xC6, 0x00, 0x00, 0x00, 0xC7, 0x00, 0x00,
+    0x00, 0x0B, 0x81, 0x20, 0x00, 0x00, 0x1C, 0xFD, 0x00, 0x00, 0x00, 0xC5,
+    0x00, 0x00, 0x00, 0xC5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
+    0xF9, 0x14, 0x5C, 0xF5, 0x42, 0x00, 0x09, 0xF0, 0x00, 0x00, 0x09, 0xF0,
+    0x00, 0x00, 0x09, 0xF0, 0x00, 0x00, 0x09, 0xF0, 0x00, 0x00, 0x09, 0xF0,
+    0x00, 0x00, 0x09, 0xF0, 0x00, 0x00, 0x09, 0xF0, 0x00, 0x00, 0x09, 0xF0,
+    0x00, 0x00, 0x09, 0xF0, 0x00, 0x14, 0x5C, 0xF5, 0x42, 0x3F, 0xFF, 0xFF,
+    0xF9, 0x05, 0xFF, 0xF9, 0x00, 0x00, 0x02, 0x3F, 0x90, 0x00, 0x00, 0x00,
+    0xF9, 0x00, 0x00, 0x00, 0x0F, 0x90, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00,
+    0x00, 0x0F, 0x90, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x0F, 0x90,
+    0x00, 0x02, 0x23, 0xFA, 0x32, 0x10, 0xFF, 0xFF, 0xFF, 0xFA, 0xFA, 0x00,
+    0x00, 0x0A, 0xFF, 0xA0, 0x00, 0x00, 0xAF, 0xFA, 0x00, 0x00, 0x0A, 0xFF,
+    0xA0, 0x00, 0x00, 0xAF, 0xFA, 0x00, 0x00, 0x0A, 0xFF, 0xA0, 0x00, 0x00,
+    0xAF, 0xFA, 0x00, 0x00, 0x0A, 0xFF, 0xA0, 0x00, 0x00, 0xAF, 0xFA, 0x00,
+    0x00, 0x0A, 0xFF, 0xA0, 0x00, 0x00, 0xAE, 0xFA, 0x00, 0x00, 0x1E, 0xCF,
+    0xA0, 0xA7, 0x7C, 0xF5, 0xFA, 0x0C, 0xEE, 0xC5, 0x00, 0x0D, 0x80, 0x00,
+    0xAB, 0x0D, 0x80, 0x00, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0F, 0x90, 0x0F, 0xFF, 0x0F, 0x90, 0x02, 0xAF, 0x0F, 0x90, 0x00,
+    0x9F, 0x0F, 0x90, 0x00, 0x9F, 0x0F, 0x90, 0x00, 0x9F, 0x0F, 0x90, 0x00,
+    0x9F, 0x0F, 0x90, 0x00, 0x9F, 0x0F, 0x90, 0x00, 0x9F, 0x0F, 0x90, 0x00,
+    0x9F, 0x0F, 0x90, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00,
+    0xAE, 0x00, 0x00, 0x76, 0xEA, 0x00, 0x00, 0xDF, 0xB2, 0x00, 0x00, 0x00,
+    0x9F, 0x90, 0x00, 0x00, 0x03, 0xF9, 0xF3, 0x00, 0x00, 0x0C, 0x80, 0x8C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0x00, 0x00, 0x00,
+    0x00, 0xAF, 0x00, 0x00, 0x00, 0x00, 0xAF, 0x00, 0x00, 0x00, 0x00, 0xAF,
+    0x00, 0x00, 0x00, 0x00, 0xAF, 0x00, 0x00, 0x00, 0x00, 0xAF, 0x00, 0x00,
+    0x00, 0x00, 0xAF, 0x00, 0x00, 0x00, 0x00, 0xAF, 0x00, 0x00, 0x00, 0x00,
+    0xAF, 0x00, 0x00, 0x00, 0x00, 0xCE, 0x00, 0x00, 0x00, 0x04, 0xFA, 0x00,
+    0xD9, 0x77, 0xAF, 0xD2, 0x00, 0xAD, 0xFF, 0xD8, 0x10, 0x00, 0x00, 0x09,
+    0xF9, 0x00, 0x03, 0xF9, 0xF3, 0x00, 0xC8, 0x08, 0xC0, 0x00, 0x00, 0x00,
+    0x1F, 0xFF, 0xFF, 0x00, 0x12, 0x3A, 0xF0, 0x00, 0x00, 0x9F, 0x00, 0x00,
+    0x09, 0xF0, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x09, 0xF0, 0x00, 0x00, 0x9F,
+    0x00, 0x00, 0x09, 0xF0, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x09, 0xF0, 0x00,
+    0x00, 0x9F, 0x00, 0x00, 0x0B, 0xD0, 0x86, 0x5A, 0xF7, 0x0C, 0xEF, 0xD7,
+    0x00, 0xFA, 0x00, 0x00, 0x4F, 0xB0, 0xFA, 0x00, 0x02, 0xEC, 0x10, 0xFA,
+    0x00, 0x2D, 0xC1, 0x00, 0xFA, 0x01, 0xCD, 0x10, 0x00, 0xFA, 0x0B, 0xD2,
+    0x00, 0x00, 0xFA, 0x9F, 0x20, 0x00, 0x00, 0xFE, 0xDE, 0x70, 0x00, 0x00,
+    0xFD, 0x26, 0xF3, 0x00, 0x00, 0xFA, 0x00, 0xBD, 0x10, 0x00, 0xFA, 0x00,
+    0x2E, 0xA0, 0x00, 0xFA, 0x00, 0x06, 0xF6, 0x00, 0xFA, 0x00, 0x00, 0xBF,
+    0x30, 0xFA, 0x00, 0x00, 0x2E, 0xD1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0xE0, 0x00, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x00, 0x00, 0x0D, 0x10,
+    0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x0F, 0x90, 0x00, 0x00, 0x00, 0xF9,
+    0x00, 0x00, 0x00, 0x0F, 0x90, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x06, 0xF7,
+    0x0F, 0x90, 0x06, 0xF6, 0x00, 0xF9, 0x05, 0xE5, 0x00, 0x0F, 0x84, 0xE4,
+    0x00, 0x00, 0xFA, 0xE7, 0x00, 0x00, 0x0F, 0xF9, 0xE4, 0x00, 0x00, 0xF9,
+    0x05, 0xE4, 0x00, 0x0F, 0x90, 0x08, 0xE3, 0x00, 0xF9, 0x00, 0x0A, 0xE2,
+    0x0F, 0x90, 0x00, 0x0C, 0xD2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E,
+    0x00, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x00, 0x00, 0xD1, 0x00, 0x00, 0xF8,
+    0x00, 0x05, 0xF7, 0x0F, 0x80, 0x04, 0xF7, 0x00, 0xF8, 0x03, 0xE7, 0x00,
+    0x0F, 0x82, 0xE7, 0x00, 0x00, 0xF8, 0xC9, 0x00, 0x00, 0x0F, 0xEE, 0xE2,
+    0x00, 0x00, 0xFB, 0x09, 0xE2, 0x00, 0x0F, 0x80, 0x0A, 0xD2, 0x00, 0xF8,
+    0x00, 0x0B, 0xD2, 0x0F, 0x80, 0x00, 0x1C, 0xD2, 0x02, 0xFC, 0x00, 0x00,
+    0x07, 0xF3, 0x00, 0x00, 0x0D, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00,
+    0xFA, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00,
+    0xFA, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00,
+    0xFA, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0xFC, 0x77, 0x77, 0x77,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x07, 0xF3,
+    0x00, 0x00, 0x00, 0xD7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF,
+    0xF9, 0x00, 0x00, 0x02, 0x3F, 0x90, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00,
+    0x00, 0x0F, 0x90, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x0F, 0x90,
+    0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x0F, 0x90, 0x00, 0x00, 0x00,
+    0xF9, 0x00, 0x00, 0x00, 0x0F, 0x90, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00,
+    0x00, 0x0F, 0x90, 0x00, 0x02, 0x23, 0xFA, 0x32, 0x10, 0xFF, 0xFF, 0xFF,
+    0xFA, 0xFA, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00,
+    0x00, 0xFA, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00,
+    0x00, 0xFA, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00,
+    0x00, 0xFA, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0xFC, 0x77, 0x77,
+    0x77, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0,
+    0x00, 0x00, 0x0A, 0x80, 0x00, 0x00, 0x0D, 0x10, 0x00, 0x05, 0xFF, 0xF9,
+    0x00, 0x00, 0x02, 0x3F, 0x90, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00,
+    0x0F, 0x90, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x0F, 0x90, 0x00,
+    0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x0F, 0x90, 0x00, 0x00, 0x00, 0xF9,
+    0x00, 0x00, 0x00, 0x0F, 0x90, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00,
+    0x0F, 0x90, 0x00, 0x02, 0x23, 0xFA, 0x32, 0x10, 0xFF, 0xFF, 0xFF, 0xFA,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0xA8,
+    0x00, 0x00, 0x00, 0x0D, 0x10, 0x00, 0xFA, 0x00, 0x08, 0xD0, 0xFA, 0x00,
+    0x0B, 0x80, 0xFA, 0x00, 0x0D, 0x10, 0xFA, 0x00, 0x00, 0x00, 0xFA, 0x00,
+    0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0xFA, 0x00,
+    0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0xFA, 0x00,
+    0x00, 0x00, 0xFC, 0x77, 0x77, 0x77, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0xFF,
+    0xF9, 0x08, 0xD0, 0x02, 0x3F, 0x90, 0xB8, 0x00, 0x00, 0xF9, 0x0D, 0x10,
+    0x00, 0x0F, 0x90, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x0F, 0x90,
+    0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x0F, 0x90, 0x00, 0x00, 0x00,
+    0xF9, 0x00, 0x00, 0x00, 0x0F, 0x90, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00,
+    0x00, 0x0F, 0x90, 0x00, 0x02, 0x23, 0xFA, 0x32, 0x10, 0xFF, 0xFF, 0xFF,
+    0xFA, 0xFA, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00,
+    0x00, 0xFA, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x0C, 0x50, 0xFA, 0x00, 0x0C,
+    0x50, 0xFA, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00,
+    0x00, 0xFA, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0xFC, 0x77, 0x77,
+    0x77, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0xFF, 0xF9, 0x00, 0x00, 0x02, 0x3F,
+    0x90, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x0F, 0x90, 0x00, 0x00,
+    0x00, 0xF9, 0x00, 0x00, 0x00, 0x0F, 0x90, 0x00, 0x00, 0x00, 0xF9, 0x0C,
+    0x50, 0x00, 0x0F, 0x90, 0xC5, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x0F,
+    0x90, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x0F, 0x90, 0x00, 0x02,
+    0x23, 0xFA, 0x32, 0x10, 0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0xFA, 0x00, 0x00,
+    0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0x00, 0x00, 0x00, 0x00, 0xFA, 0x06, 0xA0, 0x00, 0x00, 0xFC, 0xCE,
+    0x60, 0x00, 0x01, 0xFF, 0x91, 0x00, 0x00, 0x6E, 0xFA, 0x00, 0x00, 0x00,
+    0xA6, 0xFA, 0x00, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0x00, 0xFA,
+    0x00, 0x00, 0x00, 0x00, 0xFC, 0x77, 0x77, 0x77, 0x00, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x05, 0xFF, 0xF9, 0x00, 0x00, 0x02, 0x3F, 0x90, 0x00, 0x00, 0x00,
+    0xF9, 0x00, 0x00, 0x00, 0x0F, 0x90, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00,
+    0x00, 0x0F, 0x98, 0x90, 0x00, 0x00, 0xFF, 0x91, 0x00, 0x01, 0x9F, 0x90,
+    0x00, 0x00, 0xA7, 0xF9, 0x00, 0x00, 0x00, 0x0F, 0x90, 0x00, 0x00, 0x00,
+    0xF9, 0x00, 0x00, 0x00, 0x0F, 0x90, 0x00, 0x02, 0x23, 0xFA, 0x32, 0x10,
+    0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x07, 0xF3,
+    0x00, 0x00, 0x00, 0xD7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00,
+    0x00, 0x08, 0xFF, 0xF7, 0x00, 0x00, 0x8F, 0xFC, 0xE1, 0x00, 0x08, 0xFF,
+    0x7D, 0x80, 0x00, 0x8F, 0xF7, 0x5F, 0x20, 0x08, 0xFF, 0x80, 0xBA, 0x00,
+    0x8F, 0xF8, 0x03, 0xF3, 0x08, 0xFF, 0x80, 0x0A, 0xC0, 0x8F, 0xF8, 0x00,
+    0x2F, 0x57, 0xFF, 0x80, 0x00, 0x8D, 0x7F, 0xF8, 0x00, 0x01, 0xEC, 0xFF,
+    0x80, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x0D, 0xF0, 0x00, 0x00, 0x2F,
+    0xC0, 0x00, 0x00, 0x7F, 0x30, 0x00, 0x00, 0xD7, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF6, 0x6D, 0xFD, 0x80, 0xFD, 0xE7, 0x6A, 0xF7, 0xFF, 0x30, 0x00,
+    0xCD, 0xFB, 0x00, 0x00, 0x9F, 0xFA, 0x00, 0x00, 0x9F, 0xF9, 0x00, 0x00,
+    0x9F, 0xF9, 0x00, 0x00, 0x9F, 0xF9, 0x00, 0x00, 0x9F, 0xF9, 0x00, 0x00,
+    0x9F, 0xF9, 0x00, 0x00, 0x9F, 0xFD, 0x00, 0x00, 0x08, 0xFF, 0xF7, 0x00,
+    0x00, 0x8F, 0xFC, 0xE1, 0x00, 0x08, 0xFF, 0x7D, 0x80, 0x00, 0x8F, 0xF7,
+    0x5F, 0x20, 0x08, 0xFF, 0x80, 0xBA, 0x00, 0x8F, 0xF8, 0x03, 0xF3, 0x08,
+    0xFF, 0x80, 0x0A, 0xC0, 0x8F, 0xF8, 0x00, 0x2F, 0x57, 0xFF, 0x80, 0x00,
+    0x8D, 0x7F, 0xF8, 0x00, 0x01, 0xEC, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xF8,
+    0x00, 0x00, 0x0D, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00,
+    0x00, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x0D, 0x10, 0x00, 0x00, 0xF6, 0x6D,
+    0xFD, 0x80, 0xFD, 0xE7, 0x6A, 0xF7, 0xFF, 0x30, 0x00, 0xCD, 0xFB, 0x00,
+    0x00, 0x9F, 0xFA, 0x00, 0x00, 0x9F, 0xF9, 0x00, 0x00, 0x9F, 0xF9, 0x00,
+    0x00, 0x9F, 0xF9, 0x00, 0x00, 0x9F, 0xF9, 0x00, 0x00, 0x9F, 0xF9, 0x00,
+    0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x0A,
+    0x80, 0x00, 0x00, 0x0D, 0x10, 0x00, 0x00, 0xC8, 0x08, 0xC0, 0x00, 0x03,
+    0xF9, 0xF3, 0x00, 0x00, 0x09, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFD, 0x00, 0x00, 0x08, 0xFF, 0xF7, 0x00, 0x00, 0x8F, 0xFC, 0xE1, 0x00,
+    0x08, 0xFF, 0x7D, 0x80, 0x00, 0x8F, 0xF7, 0x5F, 0x20, 0x08, 0xFF, 0x80,
+    0xBA, 0x00, 0x8F, 0xF8, 0x03, 0xF3, 0x08, 0xFF, 0x80, 0x0A, 0xC0, 0x8F,
+    0xF8, 0x00, 0x2F, 0x57, 0xFF, 0x80, 0x00, 0x8D, 0x7F, 0xF8, 0x00, 0x01,
+    0xEC, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x0D, 0xF0, 0x00,
+    0xC8, 0x08, 0xC0, 0x00, 0x3F, 0x9F, 0x30, 0x00, 0x09, 0xF9, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF6, 0x6D, 0xFD, 0x80, 0xFD, 0xE7, 0x6A, 0xF7, 0xFF,
+    0x30, 0x00, 0xCD, 0xFB, 0x00, 0x00, 0x9F, 0xFA, 0x00, 0x00, 0x9F, 0xF9,
+    0x00, 0x00, 0x9F, 0xF9, 0x00, 0x00, 0x9F, 0xF9, 0x00, 0x00, 0x9F, 0xF9,
+    0x00, 0x00, 0x9F, 0xF9, 0x00, 0x00, 0x9F, 0x1F, 0xD0, 0x00, 0x00, 0x00,
+    0x5F, 0x70, 0x00, 0x00, 0x00, 0x9E, 0x10, 0x00, 0x00, 0x00, 0xD7, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF6, 0x6C, 0xFD, 0x80, 0x00, 0xFD, 0xE7, 0x6A,
+    0xF7, 0x00, 0xFF, 0x30, 0x00, 0xCD, 0x00, 0xFB, 0x00, 0x00, 0x9F, 0x00,
+    0xFA, 0x00, 0x00, 0x9F, 0x00, 0xF9, 0x00, 0x00, 0x9F, 0x00, 0xF9, 0x00,
+    0x00, 0x9F, 0x00, 0xF9, 0x00, 0x00, 0x9F, 0x00, 0xF9, 0x00, 0x00, 0x9F,
+    0x00, 0xF9, 0x00, 0x00, 0x9F, 0xFD, 0x10, 0x00, 0x08, 0xFF, 0xF8, 0x00,
+    0x00, 0x8F, 0xFC, 0xF2, 0x00, 0x08, 0xFF, 0x7C, 0xA0, 0x00, 0x8F, 0xF7,
+    0x4F, 0x40, 0x08, 0xFF, 0x80, 0xAD, 0x00, 0x8F, 0xF8, 0x02, 0xF7, 0x08,
+    0xFF, 0x80, 0x08, 0xE1, 0x7F, 0xF8, 0x00, 0x1E, 0xA7, 0xFF, 0x80, 0x00,
+    0x6F, 0x9F, 0xF8, 0x00, 0x00, 0xCF, 0xFF, 0x80, 0x00, 0x04, 0xFF, 0xF8,
+    0x00, 0x00, 0x0A, 0xF0, 0x00, 0x00, 0x00, 0x8D, 0x00, 0x00, 0x87, 0x9F,
+    0x70, 0x00, 0x0D, 0xFD, 0x70, 0xF6, 0x6D, 0xFD, 0x80, 0xFD, 0xE7, 0x6A,
+    0xF8, 0xFF, 0x30, 0x00, 0xCD, 0xFB, 0x00, 0x00, 0x9F, 0xFA, 0x00, 0x00,
+    0x9F, 0xF9, 0x00, 0x00, 0x9F, 0xF9, 0x00, 0x00, 0x9F, 0xF9, 0x00, 0x00,
+    0x9F, 0xF9, 0x00, 0x00, 0x9F, 0xF9, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00,
+    0x9F, 0x00, 0x00, 0x00, 0xAE, 0x00, 0x00, 0x76, 0xEB, 0x00, 0x00, 0xEE,
+    0xB2, 0x00, 0x55, 0x55, 0x50, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x18, 0xDF, 0xD8, 0x00, 0x0B, 0xFA, 0x7A, 0xFA, 0x05,
+    0xF9, 0x00, 0x08, 0xF4, 0xAF, 0x20, 0x00, 0x1F, 0x9D, 0xD0, 0x00, 0x00,
+    0xDD, 0xEC, 0x00, 0x00, 0x0C, 0xEF, 0xB0, 0x00, 0x00, 0xBF, 0xEC, 0x00,
+    0x00, 0x0C, 0xED, 0xD0, 0x00, 0x00, 0xDD, 0xAF, 0x20, 0x00, 0x2F, 0x95,
+    0xF9, 0x00, 0x08, 0xF4, 0x0B, 0xFA, 0x7A, 0xFA, 0x00, 0x18, 0xDF, 0xD7,
+    0x00, 0x00, 0x55, 0x55, 0x50, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x18, 0xDF, 0xD8, 0x10, 0x1C, 0xE8, 0x68, 0xEC, 0x08,
+    0xF4, 0x00, 0x04, 0xF7, 0xDD, 0x00, 0x00, 0x0D, 0xCF, 0xB0, 0x00, 0x00,
+    0xBE, 0xFB, 0x00, 0x00, 0x0B, 0xEC, 0xD0, 0x00, 0x00, 0xDC, 0x7F, 0x40,
+    0x00, 0x4F, 0x70, 0xCE, 0x86, 0x8E, 0xC1, 0x01, 0x8D, 0xFD, 0x81, 0x00,
+    0x00, 0xE1, 0x01, 0xE0, 0x00, 0x0A, 0x95, 0xA9, 0x00, 0x00, 0x2C, 0xEB,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x8D, 0xFD, 0x80, 0x00, 0xBF,
+    0xA7, 0xAF, 0xA0, 0x5F, 0x90, 0x00, 0x8F, 0x4A, 0xF2, 0x00, 0x01, 0xF9,
+    0xDD, 0x00, 0x00, 0x0D, 0xDE, 0xC0, 0x00, 0x00, 0xCE, 0xFB, 0x00, 0x00,
+    0x0B, 0xFE, 0xC0, 0x00, 0x00, 0xCE, 0xDD, 0x00, 0x00, 0x0D, 0xDA, 0xF2,
+    0x00, 0x02, 0xF9, 0x5F, 0x90, 0x00, 0x8F, 0x40, 0xBF, 0xA7, 0xAF, 0xA0,
+    0x01, 0x8D, 0xFD, 0x70, 0x00, 0x00, 0xE1, 0x01, 0xE0, 0x00, 0x0A, 0x95,
+    0xA9, 0x00, 0x00, 0x2C, 0xEB, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x8D, 0xFD, 0x81, 0x01, 0xCE, 0x86, 0x8E, 0xC0, 0x8F, 0x40, 0x00, 0x4F,
+    0x7D, 0xD0, 0x00, 0x00, 0xDC, 0xFB, 0x00, 0x00, 0x0B, 0xEF, 0xB0, 0x00,
+    0x00, 0xBE, 0xCD, 0x00, 0x00, 0x0D, 0xC7, 0xF4, 0x00, 0x04, 0xF7, 0x0C,
+    0xE8, 0x68, 0xEC, 0x10, 0x18, 0xDF, 0xD8, 0x10, 0x00, 0x2F, 0xC2, 0xFC,
+    0x00, 0x07, 0xF3, 0x7F, 0x30, 0x00, 0xD5, 0x0D, 0x50, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x8D, 0xFD, 0x80, 0x00, 0xBF, 0xA7, 0xAF, 0xA0, 0x5F,
+    0x90, 0x00, 0x8F, 0x4A, 0xF2, 0x00, 0x01, 0xF9, 0xDD, 0x00, 0x00, 0x0D,
+    0xDE, 0xC0, 0x00, 0x00, 0xCE, 0xFB, 0x00, 0x00, 0x0B, 0xFE, 0xC0, 0x00,
+    0x00, 0xCE, 0xDD, 0x00, 0x00, 0x0D, 0xDA, 0xF2, 0x00, 0x02, 0xF9, 0x5F,
+    0x90, 0x00, 0x8F, 0x40, 0xBF, 0xA7, 0xAF, 0xA0, 0x01, 0x8D, 0xFD, 0x70,
+    0x00, 0x00, 0x2F, 0xC2, 0xFC, 0x00, 0x07, 0xF3, 0x7F, 0x30, 0x00, 0xD5,
+    0x0D, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x8D, 0xFD, 0x81, 0x01,
+    0xCE, 0x86, 0x8E, 0xC0, 0x8F, 0x40, 0x00, 0x4F, 0x7D, 0xD0, 0x00, 0x00,
+    0xDC, 0xFB, 0x00, 0x00, 0x0B, 0xEF, 0xB0, 0x00, 0x00, 0xBE, 0xCD, 0x00,
+    0x00, 0x0D, 0xC7, 0xF4, 0x00, 0x04, 0xF7, 0x0C, 0xE8, 0x68, 0xEC, 0x10,
+    0x18, 0xDF, 0xD8, 0x10, 0x01, 0x9E, 0xFF, 0xFF, 0xFF, 0x0C, 0xE8, 0x8F,
+    0xC7, 0x77, 0x5F, 0x50, 0x0F, 0xA0, 0x00, 0xAE, 0x00, 0x0F, 0xA0, 0x00,
+    0xDB, 0x00, 0x0F, 0xA0, 0x00, 0xEA, 0x00, 0x0F, 0xFF, 0xFF, 0xFA, 0x00,
+    0x0F, 0xC7, 0x77, 0xEA, 0x00, 0x0F, 0xA0, 0x00, 0xDC, 0x00, 0x0F, 0xA0,
+    0x00, 0xAE, 0x00, 0x0F, 0xA0, 0x00, 0x6F, 0x50, 0x0F, 0xA0, 0x00, 0x0D,
+    0xE8, 0x8F, 0xC7, 0x77, 0x02, 0xAE, 0xFF, 0xFF, 0xFF, 0x06, 0xDE, 0x90,
+    0x4D, 0xE8, 0x03, 0xFA, 0x6E, 0x9E, 0x97, 0xF5, 0xAE, 0x00, 0x6F, 0xD0,
+    0x0B, 0xBD, 0xA0, 0x02, 0xFA, 0x00, 0x9E, 0xF9, 0x00, 0x1F, 0xFF, 0xFF,
+    0xFE, 0x90, 0x00, 0xFB, 0x55, 0x55, 0xDA, 0x00, 0x2F, 0xB0, 0x00, 0x09,
+    0xE0, 0x05, 0xFE, 0x10, 0x00, 0x3F, 0xA6, 0xE9, 0xEC, 0x79, 0x80, 0x5D,
+    0xE9, 0x03, 0xCE, 0xC5, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x07,
+    0xF3, 0x00, 0x00, 0x00, 0x00, 0xD7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xED, 0x93, 0x00, 0x0F, 0xC6, 0x67, 0x9E, 0xF4,
+    0x00, 0xFA, 0x00, 0x00, 0x2F, 0xC0, 0x0F, 0xA0, 0x00, 0x00, 0xCF, 0x00,
+    0xFA, 0x00, 0x00, 0x0E, 0xC0, 0x0F, 0xA0, 0x01, 0x3B, 0xF5, 0x00, 0xFF,
+    0xFF, 0xFF, 0xB3, 0x00, 0x0F, 0xC6, 0x6B, 0xF5, 0x00, 0x00, 0xFA, 0x00,
+    0x1D, 0xE2, 0x00, 0x0F, 0xA0, 0x00, 0x3F, 0xB0, 0x00, 0xFA, 0x00, 0x00,
+    0x7F, 0x70, 0x0F, 0xA0, 0x00, 0x00, 0xAF, 0x30, 0xFA, 0x00, 0x00, 0x01,
+    0xDD, 0x10, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x7F, 0x30, 0x00, 0x0D, 0x70,
+    0x00, 0x00, 0x00, 0x00, 0xF5, 0x3B, 0xEE, 0xAF, 0x9D, 0x86, 0x78, 0xFF,
+    0x30, 0x00, 0x0F, 0xB0, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x0F, 0x90, 0x00,
+    0x00, 0xF9, 0x00, 0x00, 0x0F, 0x90, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x0F,
+    0x90, 0x00, 0x00, 0xFF, 0xFF, 0xED, 0x93, 0x00, 0x0F, 0xC6, 0x67, 0x9E,
+    0xF4, 0x00, 0xFA, 0x00, 0x00, 0x2F, 0xC0, 0x0F, 0xA0, 0x00, 0x00, 0xCF,
+    0x00, 0xFA, 0x00, 0x00, 0x0E, 0xC0, 0x0F, 0xA0, 0x01, 0x3B, 0xF5, 0x00,
+    0xFF, 0xFF, 0xFF, 0xB3, 0x00, 0x0F, 0xC6, 0x6B, 0xF5, 0x00, 0x00, 0xFA,
+    0x00, 0x1D, 0xE2, 0x00, 0x0F, 0xA0, 0x00, 0x3F, 0xB0, 0x00, 0xFA, 0x00,
+    0x00, 0x7F, 0x70, 0x0F, 0xA0, 0x00, 0x00, 0xAF, 0x30, 0xFA, 0x00, 0x00,
+    0x01, 0xDD, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00,
+    0x00, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x00, 0x00, 0x00, 0xD1, 0x00, 0x00,
+    0x00, 0xF5, 0x3B, 0xEE, 0xAF, 0x9D, 0x86, 0x78, 0xFF, 0x30, 0x00, 0x0F,
+    0xB0, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x0F, 0x90, 0x00, 0x00, 0xF9, 0x00,
+    0x00, 0x0F, 0x90, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x0F, 0x90, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0xA8, 0x00, 0x00, 0x0D, 0x10,
+    0x00, 0x00, 0x00, 0xC8, 0x08, 0xC0, 0x00, 0x00, 0x03, 0xF9, 0xF3, 0x00,
+    0x00, 0x00, 0x09, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xED, 0x93, 0x00, 0x0F, 0xC6, 0x67, 0x9E, 0xF4, 0x00, 0xFA,
+    0x00, 0x00, 0x2F, 0xC0, 0x0F, 0xA0, 0x00, 0x00, 0xCF, 0x00, 0xFA, 0x00,
+    0x00, 0x0E, 0xC0, 0x0F, 0xA0, 0x01, 0x3B, 0xF5, 0x00, 0xFF, 0xFF, 0xFF,
+    0xB3, 0x00, 0x0F, 0xC6, 0x6B, 0xF5, 0x00, 0x00, 0xFA, 0x00, 0x1D, 0xE2,
+    0x00, 0x0F, 0xA0, 0x00, 0x3F, 0xB0, 0x00, 0xFA, 0x00, 0x00, 0x7F, 0x70,
+    0x0F, 0xA0, 0x00, 0x00, 0xAF, 0x30, 0xFA, 0x00, 0x00, 0x01, 0xDD, 0x10,
+    0x0C, 0x80, 0x8C, 0x00, 0x3F, 0x9F, 0x30, 0x00, 0x9F, 0x90, 0x00, 0x00,
+    0x00, 0x00, 0xF5, 0x3B, 0xEE, 0xAF, 0x9D, 0x86, 0x78, 0xFF, 0x30, 0x00,
+    0x0F, 0xB0, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x0F, 0x90, 0x00, 0x00, 0xF9,
+    0x00, 0x00, 0x0F, 0x90, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x0F, 0x90, 0x00,
+    0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x07, 0xF3, 0x00, 0x00, 0x00,
+    0xD7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xAD, 0xEE, 0xDB, 0x66,
+    0xFD, 0x87, 0x8A, 0xD9, 0xDD, 0x10, 0x00, 0x00, 0x0E, 0xB0, 0x00, 0x00,
+    0x00, 0xBF, 0x40, 0x00, 0x00, 0x02, 0xDF, 0xB5, 0x10, 0x00, 0x01, 0x7D,
+    0xFE, 0xA2, 0x00, 0x00, 0x03, 0x9E, 0xF4, 0x00, 0x00, 0x00, 0x2E, 0xC0,
+    0x00, 0x00, 0x00, 0xAF, 0x10, 0x00, 0x00, 0x1E, 0xCF, 0xB8, 0x77, 0x8E,
+    0xF4, 0x9C, 0xEF, 0xFD, 0x93, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x7F,
+    0x30, 0x00, 0x0D, 0x70, 0x00, 0x00, 0x00, 0x00, 0x18, 0xDF, 0xEC, 0x7A,
+    0xE7, 0x56, 0xA9, 0xE9, 0x00, 0x00, 0x0C, 0xE6, 0x00, 0x00, 0x2B, 0xFE,
+    0x82, 0x00, 0x04, 0xAF, 0xE4, 0x00, 0x00, 0x2D, 0xD0, 0x00, 0x00, 0xAE,
+    0xD8, 0x65, 0x8F, 0x99, 0xDF, 0xED, 0x70, 0x00, 0x09, 0xF9, 0x00, 0x00,
+    0x03, 0xF9, 0xF3, 0x00, 0x00, 0xC8, 0x08, 0xC0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xAD, 0xEE, 0xDB, 0x66, 0xFD, 0x87, 0x8A, 0xD9, 0xDD, 0x10,
+    0x00, 0x00, 0x0E, 0xB0, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x02,
+    0xDF, 0xB5, 0x10, 0x00, 0x01, 0x7D, 0xFE, 0xA2, 0x00, 0x00, 0x03, 0x9E,
+    0xF4, 0x00, 0x00, 0x00, 0x2E, 0xC0, 0x00, 0x00, 0x00, 0xAF, 0x10, 0x00,
+    0x00, 0x1E, 0xCF, 0xB8, 0x77, 0x8E, 0xF4, 0x9C, 0xEF, 0xFD, 0x93, 0x00,
+    0x00, 0x9F, 0x90, 0x00, 0x3F, 0x9F, 0x30, 0x0C, 0x80, 0x8C, 0x00, 0x00,
+    0x00, 0x00, 0x18, 0xDF, 0xEC, 0x7A, 0xE7, 0x56, 0xA9, 0xE9, 0x00, 0x00,
+    0x0C, 0xE6, 0x00, 0x00, 0x2B, 0xFE, 0x82, 0x00, 0x04, 0xAF, 0xE4, 0x00,
+    0x00, 0x2D, 0xD0, 0x00, 0x00, 0xAE, 0xD8, 0x65, 0x8F, 0x99, 0xDF, 0xED,
+    0x70, 0x03, 0xAD, 0xEE, 0xDB, 0x66, 0xFD, 0x87, 0x8A, 0xD9, 0xDD, 0x10,
+    0x00, 0x00, 0x0E, 0xB0, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x02,
+    0xDF, 0xB5, 0x10, 0x00, 0x01, 0x7D, 0xFE, 0xA2, 0x00, 0x00, 0x03, 0x9E,
+    0xF4, 0x00, 0x00, 0x00, 0x2E, 0xC0, 0x00, 0x00, 0x00, 0xAF, 0x10, 0x00,
+    0x00, 0x1E, 0xCF, 0xB8, 0x77, 0x8E, 0xF4, 0x9C, 0xEF, 0xFD, 0x93, 0x00,
+    0x00, 0x1C, 0x00, 0x00, 0x00, 0x03, 0xD9, 0x00, 0x00, 0x00, 0x06, 0xC0,
+    0x00, 0x00, 0x0E, 0xB1, 0x00, 0x00, 0x18, 0xDF, 0xEC, 0x7A, 0xE7, 0x56,
+    0xA9, 0xE9, 0x00, 0x00, 0x0C, 0xE6, 0x00, 0x00, 0x2B, 0xFE, 0x82, 0x00,
+    0x04, 0xAF, 0xE4, 0x00, 0x00, 0x2D, 0xD0, 0x00, 0x00, 0xAE, 0xD8, 0x65,
+    0x8F, 0x99, 0xDF, 0xED, 0x70, 0x00, 0x1C, 0x00, 0x00, 0x03, 0xD9, 0x00,
+    0x00, 0x06, 0xC0, 0x00, 0x0E, 0xB1, 0x00, 0x00, 0xC8, 0x08, 0xC0, 0x00,
+    0x03, 0xF9, 0xF3, 0x00, 0x00, 0x09, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xAD, 0xEE, 0xDB, 0x66, 0xFD, 0x87, 0x8A, 0xD9, 0xDD, 0x10,
+    0x00, 0x00, 0x0E, 0xB0, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x02,
+    0xDF, 0xB5, 0x10, 0x00, 0x01, 0x7D, 0xFE, 0xA2, 0x00, 0x00, 0x03, 0x9E,
+    0xF4, 0x00, 0x00, 0x00, 0x2E, 0xC0, 0x00, 0x00, 0x00, 0xAF, 0x10, 0x00,
+    0x00, 0x1E, 0xCF, 0xB8, 0x77, 0x8E, 0xF4, 0x9C, 0xEF, 0xFD, 0x93, 0x00,
+    0x0C, 0x80, 0x8C, 0x00, 0x3F, 0x9F, 0x30, 0x00, 0x9F, 0x90, 0x00, 0x00,
+    0x00, 0x00, 0x18, 0xDF, 0xEC, 0x7A, 0xE7, 0x56, 0xA9, 0xE9, 0x00, 0x00,
+    0x0C, 0xE6, 0x00, 0x00, 0x2B, 0xFE, 0x82, 0x00, 0x04, 0xAF, 0xE4, 0x00,
+    0x00, 0x2D, 0xD0, 0x00, 0x00, 0xAE, 0xD8, 0x65, 0x8F, 0x99, 0xDF, 0xED,
+    0x70, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0x47, 0x77, 0xCF, 0x77, 0x77, 0x00,
+    0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x9F,
+    0x00, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00,
+    0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00,
+    0x9F, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x00,
+    0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00,
+    0x00, 0x3D, 0x90, 0x00, 0x00, 0x00, 0x06, 0xC0, 0x00, 0x00, 0x00, 0xEB,
+    0x10, 0x00, 0x00, 0x35, 0x00, 0x00, 0x09, 0x90, 0x00, 0x00, 0xD9, 0x00,
+    0x0B, 0xEF, 0xFF, 0xFF, 0x44, 0xFA, 0x44, 0x40, 0x0F, 0x90, 0x00, 0x00,
+    0xF9, 0x00, 0x00, 0x0F, 0x90, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x0F, 0x90,
+    0x00, 0x00, 0xEA, 0x00, 0x00, 0x0A, 0xF7, 0x56, 0x00, 0x1A, 0xEE, 0xC0,
+    0x00, 0x1C, 0x00, 0x00, 0x03, 0xD9, 0x00, 0x00, 0x06, 0xC0, 0x00, 0x0E,
+    0xB1, 0x00, 0x00, 0x0C, 0x80, 0x8C, 0x00, 0x00, 0x03, 0xF9, 0xF3, 0x00,
+    0x00, 0x00, 0x9F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x47, 0x77, 0xCF, 0x77, 0x77, 0x00, 0x00, 0x9F, 0x00,
+    0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00,
+    0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x9F,
+    0x00, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00,
+    0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00,
+    0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8D, 0x00, 0x35, 0x00, 0xB8, 0x00,
+    0x99, 0x00, 0xD1, 0x00, 0xD9, 0x00, 0x00, 0xBE, 0xFF, 0xFF, 0xF0, 0x44,
+    0xFA, 0x44, 0x40, 0x00, 0xF9, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00,
+    0xF9, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00,
+    0xEA, 0x00, 0x00, 0x00, 0xAF, 0x75, 0x60, 0x00, 0x1A, 0xEE, 0xC0, 0x9F,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x47, 0x77, 0xCF, 0x77, 0x77, 0x00, 0x00, 0x9F,
+    0x00, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00,
+    0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x66,
+    0xCF, 0x66, 0x60, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x00,
+    0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00,
+    0x00, 0x9F, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x09, 0x90, 0x00, 0x00,
+    0xD9, 0x00, 0x0B, 0xEF, 0xFF, 0xFF, 0x44, 0xFA, 0x44, 0x40, 0x0F, 0x90,
+    0x00, 0x3F, 0xFF, 0xFF, 0x01, 0x4F, 0xA4, 0x40, 0x00, 0xF9, 0x00, 0x00,
+    0x0F, 0x90, 0x00, 0x00, 0xEB, 0x00, 0x00, 0x09, 0xF7, 0x56, 0x00, 0x1A,
+    0xEE, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0xD4, 0x01, 0xD0, 0x0A,
+    0x98, 0xF9, 0x9A, 0x00, 0xE1, 0x04, 0xDD, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x0F, 0x90, 0x00, 0x00, 0xAF, 0xFA, 0x00, 0x00, 0x0A, 0xFF, 0xA0, 0x00,
+    0x00, 0xAF, 0xFA, 0x00, 0x00, 0x0A, 0xFF, 0xA0, 0x00, 0x00, 0xAF, 0xFA,
+    0x00, 0x00, 0x0A, 0xFF, 0xA0, 0x00, 0x00, 0xAF, 0xFA, 0x00, 0x00, 0x0A,
+    0xFF, 0xA0, 0x00, 0x00, 0xAF, 0xDC, 0x00, 0x00, 0x0D, 0xDA, 0xF4, 0x00,
+    0x05, 0xF9, 0x2E, 0xF9, 0x79, 0xFE, 0x20, 0x3A, 0xEF, 0xEA, 0x20, 0x00,
+    0x00, 0x00, 0x00, 0x02, 0xDD, 0x40, 0x1D, 0x0A, 0x98, 0xF9, 0x9A, 0x0E,
+    0x10, 0x4D, 0xD2, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x9F, 0xF9,
+    0x00, 0x00, 0x9F, 0xF9, 0x00, 0x00, 0x9F, 0xF9, 0x00, 0x00, 0x9F, 0xF9,
+    0x00, 0x00, 0x9F, 0xF9, 0x00, 0x00, 0x9F, 0xF9, 0x00, 0x00, 0xBF, 0xDC,
+    0x00, 0x02, 0xEF, 0x7F, 0xA6, 0x7D, 0xDF, 0x08, 0xDF, 0xD6, 0x6F, 0x00,
+    0x55, 0x55, 0x50, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0F, 0x90, 0x00, 0x00, 0xAF, 0xFA, 0x00, 0x00, 0x0A, 0xFF, 0xA0, 0x00,
+    0x00, 0xAF, 0xFA, 0x00, 0x00, 0x0A, 0xFF, 0xA0, 0x00, 0x00, 0xAF, 0xFA,
+    0x00, 0x00, 0x0A, 0xFF, 0xA0, 0x00, 0x00, 0xAF, 0xFA, 0x00, 0x00, 0x0A,
+    0xFF, 0xA0, 0x00, 0x00, 0xAF, 0xDC, 0x00, 0x00, 0x0D, 0xDA, 0xF4, 0x00,
+    0x05, 0xF9, 0x2E, 0xF9, 0x79, 0xFE, 0x20, 0x3A, 0xEF, 0xEA, 0x20, 0x00,
+    0x55, 0x55, 0x50, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xF9,
+    0x00, 0x00, 0x9F, 0xF9, 0x00, 0x00, 0x9F, 0xF9, 0x00, 0x00, 0x9F, 0xF9,
+    0x00, 0x00, 0x9F, 0xF9, 0x00, 0x00, 0x9F, 0xF9, 0x00, 0x00, 0x9F, 0xF9,
+    0x00, 0x00, 0xBF, 0xDC, 0x00, 0x02, 0xEF, 0x7F, 0xA6, 0x7D, 0xDF, 0x08,
+    0xDF, 0xD6, 0x6F, 0x00, 0xE1, 0x01, 0xE0, 0x00, 0x0A, 0x95, 0xA9, 0x00,
+    0x00, 0x2C, 0xEB, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00,
+    0x0A, 0xFF, 0xA0, 0x00, 0x00, 0xAF, 0xFA, 0x00, 0x00, 0x0A, 0xFF, 0xA0,
+    0x00, 0x00, 0xAF, 0xFA, 0x00, 0x00, 0x0A, 0xFF, 0xA0, 0x00, 0x00, 0xAF,
+    0xFA, 0x00, 0x00, 0x0A, 0xFF, 0xA0, 0x00, 0x00, 0xAF, 0xFA, 0x00, 0x00,
+    0x0A, 0xFD, 0xC0, 0x00, 0x00, 0xDD, 0xAF, 0x40, 0x00, 0x5F, 0x92, 0xEF,
+    0x97, 0x9F, 0xE2, 0x03, 0xAE, 0xFE, 0xA2, 0x00, 0x00, 0xE1, 0x01, 0xE0,
+    0x00, 0xA9, 0x5A, 0x90, 0x00, 0x2C, 0xEB, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0xF9, 0x00, 0x00, 0x9F, 0xF9, 0x00, 0x00, 0x9F, 0xF9, 0x00, 0x00, 0x9F,
+    0xF9, 0x00, 0x00, 0x9F, 0xF9, 0x00, 0x00, 0x9F, 0xF9, 0x00, 0x00, 0x9F,
+    0xF9, 0x00, 0x00, 0xBF, 0xDC, 0x00, 0x02, 0xEF, 0x7F, 0xA6, 0x7D, 0xDF,
+    0x08, 0xDF, 0xD6, 0x6F, 0x00, 0x05, 0xDD, 0x50, 0x00, 0x00, 0xE2, 0x2E,
+    0x00, 0x00, 0x0E, 0x22, 0xE0, 0x00, 0x00, 0x5D, 0xD5, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0F, 0x90, 0x00, 0x00, 0xAF, 0xFA, 0x00, 0x00, 0x0A, 0xFF,
+    0xA0, 0x00, 0x00, 0xAF, 0xFA, 0x00, 0x00, 0x0A, 0xFF, 0xA0, 0x00, 0x00,
+    0xAF, 0xFA, 0x00, 0x00, 0x0A, 0xFF, 0xA0, 0x00, 0x00, 0xAF, 0xFA, 0x00,
+    0x00, 0x0A, 0xFF, 0xA0, 0x00, 0x00, 0xAF, 0xDC, 0x00, 0x00, 0x0D, 0xDA,
+    0xF4, 0x00, 0x05, 0xF9, 0x2E, 0xF9, 0x79, 0xFE, 0x20, 0x3A, 0xEF, 0xEA,
+    0x20, 0x00, 0x5D, 0xD5, 0x00, 0x00, 0xE2, 0x2E, 0x00, 0x00, 0xE2, 0x2E,
+    0x00, 0x00, 0x5D, 0xD5, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00,
+    0x9F, 0xF9, 0x00, 0x00, 0x9F, 0xF9, 0x00, 0x00, 0x9F, 0xF9, 0x00, 0x00,
+    0x9F, 0xF9, 0x00, 0x00, 0x9F, 0xF9, 0x00, 0x00, 0x9F, 0xF9, 0x00, 0x00,
+    0xBF, 0xDC, 0x00, 0x02, 0xEF, 0x7F, 0xA6, 0x7D, 0xDF, 0x08, 0xDF, 0xD6,
+    0x6F, 0x00, 0x2F, 0xC2, 0xFC, 0x00, 0x07, 0xF3, 0x7F, 0x30, 0x00, 0xD5,
+    0x0D, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x0A, 0xFF,
+    0xA0, 0x00, 0x00, 0xAF, 0xFA, 0x00, 0x00, 0x0A, 0xFF, 0xA0, 0x00, 0x00,
+    0xAF, 0xFA, 0x00, 0x00, 0x0A, 0xFF, 0xA0, 0x00, 0x00, 0xAF, 0xFA, 0x00,
+    0x00, 0x0A, 0xFF, 0xA0, 0x00, 0x00, 0xAF, 0xFA, 0x00, 0x00, 0x0A, 0xFD,
+    0xC0, 0x00, 0x00, 0xDD, 0xAF, 0x40, 0x00, 0x5F, 0x92, 0xEF, 0x97, 0x9F,
+    0xE2, 0x03, 0xAE, 0xFE, 0xA2, 0x00, 0x00, 0x2F, 0xC2, 0xFC, 0x00, 0x7F,
+    0x37, 0xF3, 0x00, 0xD5, 0x0D, 0x50, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x00,
+    0x00, 0x9F, 0xF9, 0x00, 0x00, 0x9F, 0xF9, 0x00, 0x00, 0x9F, 0xF9, 0x00,
+    0x00, 0x9F, 0xF9, 0x00, 0x00, 0x9F, 0xF9, 0x00, 0x00, 0x9F, 0xF9, 0x00,
+    0x00, 0xBF, 0xDC, 0x00, 0x02, 0xEF, 0x7F, 0xA6, 0x7D, 0xDF, 0x08, 0xDF,
+    0xD6, 0x6F, 0xF9, 0x00, 0x00, 0x0A, 0xFF, 0xA0, 0x00, 0x00, 0xAF, 0xFA,
+    0x00, 0x00, 0x0A, 0xFF, 0xA0, 0x00, 0x00, 0xAF, 0xFA, 0x00, 0x00, 0x0A,
+    0xFF, 0xA0, 0x00, 0x00, 0xAF, 0xFA, 0x00, 0x00, 0x0A, 0xFF, 0xA0, 0x00,
+    0x00, 0xAF, 0xFA, 0x00, 0x00, 0x0A, 0xFD, 0xC0, 0x00, 0x00, 0xDD, 0xAF,
+    0x40, 0x00, 0x5F, 0x92, 0xEF, 0x97, 0x9F, 0xE2, 0x03, 0xAE, 0xFE, 0xA2,
+    0x00, 0x00, 0x2C, 0x60, 0x00, 0x00, 0x0C, 0x70, 0x00, 0x00, 0x00, 0xB8,
+    0x12, 0x00, 0x00, 0x01, 0xCF, 0xD0, 0x00, 0xF9, 0x00, 0x00, 0x9F, 0x0F,
+    0x90, 0x00, 0x09, 0xF0, 0xF9, 0x00, 0x00, 0x9F, 0x0F, 0x90, 0x00, 0x09,
+    0xF0, 0xF9, 0x00, 0x00, 0x9F, 0x0F, 0x90, 0x00, 0x09, 0xF0, 0xF9, 0x00,
+    0x00, 0xBF, 0x0D, 0xC0, 0x00, 0x2E, 0xF0, 0x7F, 0xA6, 0x7D, 0xDF, 0x00,
+    0x8D, 0xFD, 0x66, 0xF0, 0x00, 0x00, 0x02, 0xC6, 0x00, 0x00, 0x00, 0xC7,
+    0x00, 0x00, 0x00, 0x0B, 0x81, 0x20, 0x00, 0x00, 0x1C, 0xFD, 0x00, 0x00,
+    0x9F, 0x90, 0x00, 0x00, 0x00, 0x3F, 0x9F, 0x30, 0x00, 0x00, 0x0C, 0x80,
+    0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE8, 0x00, 0x00, 0x00,
+    0x08, 0xEC, 0xA0, 0x00, 0x00, 0x00, 0x9C, 0xBB, 0x00, 0x00, 0x00, 0x0B,
+    0xB9, 0xD0, 0x00, 0x00, 0x00, 0xC9, 0x7E, 0x00, 0x3F, 0x30, 0x0D, 0x75,
+    0xF1, 0x09, 0xD8, 0x00, 0xF6, 0x4F, 0x20, 0xE5, 0xE0, 0x1F, 0x42, 0xF4,
+    0x4D, 0x0E, 0x43, 0xF2, 0x0F, 0x5A, 0x80, 0x99, 0x4F, 0x10, 0xD6, 0xE2,
+    0x04, 0xE6, 0xE0, 0x0C, 0xAC, 0x00, 0x0E, 0xBC, 0x00, 0xAF, 0x70, 0x00,
+    0x9F, 0xA0, 0x08, 0xF2, 0x00, 0x05, 0xF9, 0x00, 0x00, 0x00, 0x9F, 0x90,
+    0x00, 0x00, 0x00, 0x3F, 0x9F, 0x30, 0x00, 0x00, 0x0C, 0x80, 0x8C, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE7, 0x00, 0x3F, 0x40, 0x07, 0xEB,
+    0x90, 0x08, 0xE9, 0x00, 0x9B, 0x8C, 0x00, 0xD8, 0xD0, 0x0B, 0x85, 0xE0,
+    0x2F, 0x1F, 0x30, 0xD5, 0x2F, 0x17, 0xC0, 0xC7, 0x1F, 0x20, 0xE3, 0xC7,
+    0x08, 0xC2, 0xE0, 0x0B, 0x4F, 0x20, 0x3F, 0x5B, 0x00, 0x89, 0xD0, 0x00,
+    0xD9, 0x80, 0x06, 0xE8, 0x00, 0x09, 0xE5, 0x00, 0x3F, 0x40, 0x00, 0x4F,
+    0x30, 0x00, 0x00, 0x9F, 0x90, 0x00, 0x00, 0x03, 0xF9, 0xF3, 0x00, 0x00,
+    0x0C, 0x80, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x60, 0x00,
+    0x01, 0xEB, 0x0D, 0xD0, 0x00, 0x07, 0xF4, 0x06, 0xF4, 0x00, 0x0D, 0xB0,
+    0x00, 0xDB, 0x00, 0x6F, 0x40, 0x00, 0x6F, 0x30, 0xCB, 0x00, 0x00, 0x0D,
+    0xA4, 0xF4, 0x00, 0x00, 0x06, 0xFC, 0xB0, 0x00, 0x00, 0x00, 0xDF, 0x40,
+    0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00,
+    0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x9F,
+    0x00, 0x00, 0x00, 0x09, 0xF9, 0x00, 0x00, 0x03, 0xF9, 0xF3, 0x00, 0x00,
+    0xC8, 0x08, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCD, 0x00, 0x00, 0x0C,
+    0xC7, 0xF3, 0x00, 0x03, 0xF7, 0x1F, 0x80, 0x00, 0x8F, 0x10, 0xAE, 0x00,
+    0x0D, 0xA0, 0x05, 0xF4, 0x03, 0xF5, 0x00, 0x0E, 0xA0, 0x8E, 0x00, 0x00,
+    0x8E, 0x1D, 0x80, 0x00, 0x02, 0xF7, 0xF3, 0x00, 0x00, 0x0C, 0xEC, 0x00,
+    0x00, 0x00, 0x6F, 0x70, 0x00, 0x00, 0x06, 0xF1, 0x00, 0x00, 0x00, 0xDA,
+    0x00, 0x00, 0x66, 0xBE, 0x20, 0x00, 0x0E, 0xFC, 0x40, 0x00, 0x00, 0x00,
+    0x0C, 0x60, 0x6C, 0x00, 0x00, 0x0C, 0x60, 0x6C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x6F, 0x60, 0x00, 0x01, 0xEB, 0x0D, 0xD0, 0x00, 0x07, 0xF4,
+    0x06, 0xF4, 0x00, 0x0D, 0xB0, 0x00, 0xDB, 0x00, 0x6F, 0x40, 0x00, 0x6F,
+    0x30, 0xCB, 0x00, 0x00, 0x0D, 0xA4, 0xF4, 0x00, 0x00, 0x06, 0xFC, 0xB0,
+    0x00, 0x00, 0x00, 0xDF, 0x40, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00,
+    0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x9F,
+    0x00, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00,
+    0x00, 0x07, 0xF3, 0x00, 0x00, 0x00, 0xD7, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x77, 0x77, 0x77, 0xFC, 0x00, 0x00,
+    0x00, 0x9F, 0x20, 0x00, 0x00, 0x4F, 0x70, 0x00, 0x00, 0x1D, 0xB0, 0x00,
+    0x00, 0x0A, 0xE2, 0x00, 0x00, 0x05, 0xF5, 0x00, 0x00, 0x02, 0xEA, 0x00,
+    0x00, 0x00, 0xBD, 0x10, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x3F, 0x90,
+    0x00, 0x00, 0x0C, 0xF7, 0x77, 0x77, 0x77, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
+    0x00, 0x02, 0xFC, 0x00, 0x00, 0x7F, 0x30, 0x00, 0x0D, 0x70, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x44, 0x44, 0xDD, 0x00, 0x00, 0x7F,
+    0x30, 0x00, 0x3F, 0x70, 0x00, 0x1D, 0xB0, 0x00, 0x09, 0xE2, 0x00, 0x05,
+    0xF5, 0x00, 0x02, 0xE9, 0x00, 0x00, 0xBE, 0x44, 0x44, 0x4F, 0xFF, 0xFF,
+    0xFF, 0x00, 0x00, 0xC5, 0x00, 0x00, 0x00, 0x0C, 0x50, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x77, 0x77, 0x77, 0x7F, 0xC0,
+    0x00, 0x00, 0x09, 0xF2, 0x00, 0x00, 0x04, 0xF7, 0x00, 0x00, 0x01, 0xDB,
+    0x00, 0x00, 0x00, 0xAE, 0x20, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x2E,
+    0xA0, 0x00, 0x00, 0x0B, 0xD1, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x03,
+    0xF9, 0x00, 0x00, 0x00, 0xCF, 0x77, 0x77, 0x77, 0x7F, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x00, 0x0C, 0x50, 0x00, 0x00, 0xC5, 0x00, 0x00, 0x00, 0x00, 0x0F,
+    0xFF, 0xFF, 0xFF, 0x44, 0x44, 0x4D, 0xD0, 0x00, 0x07, 0xF3, 0x00, 0x03,
+    0xF7, 0x00, 0x01, 0xDB, 0x00, 0x00, 0x9E, 0x20, 0x00, 0x5F, 0x50, 0x00,
+    0x2E, 0x90, 0x00, 0x0B, 0xE4, 0x44, 0x44, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
+    0xC8, 0x08, 0xC0, 0x00, 0x03, 0xF9, 0xF3, 0x00, 0x00, 0x09, 0xF9, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x77, 0x77,
+    0x77, 0xFC, 0x00, 0x00, 0x00, 0x9F, 0x20, 0x00, 0x00, 0x4F, 0x70, 0x00,
+    0x00, 0x1D, 0xB0, 0x00, 0x00, 0x0A, 0xE2, 0x00, 0x00, 0x05, 0xF5, 0x00,
+    0x00, 0x02, 0xEA, 0x00, 0x00, 0x00, 0xBD, 0x10, 0x00, 0x00, 0x7F, 0x40,
+    0x00, 0x00, 0x3F, 0x90, 0x00, 0x00, 0x0C, 0xF7, 0x77, 0x77, 0x77, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xF0, 0x0C, 0x80, 0x8C, 0x00, 0x3F, 0x9F, 0x30, 0x00,
+    0x9F, 0x90, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x44, 0x44,
+    0xDD, 0x00, 0x00, 0x7F, 0x30, 0x00, 0x3F, 0x70, 0x00, 0x1D, 0xB0, 0x00,
+    0x09, 0xE2, 0x00, 0x05, 0xF5, 0x00, 0x02, 0xE9, 0x00, 0x00, 0xBE, 0x44,
+    0x44, 0x4F, 0xFF, 0xFF, 0xFF, 0x19, 0xEF, 0xEB, 0x9F, 0x85, 0x76, 0xDB,
+    0x00, 0x00, 0xF9, 0x00, 0x00, 0xF9, 0x00, 0x00, 0xF9, 0x00, 0x00, 0xF9,
+    0x00, 0x00, 0xF9, 0x00, 0x00, 0xF9, 0x00, 0x00, 0xF9, 0x00, 0x00, 0xF9,
+    0x00, 0x00, 0xF9, 0x00, 0x00, 0xF9, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x03,
+    0xAD, 0xEE, 0xDB, 0x66, 0xFD, 0x87, 0x8A, 0xD9, 0xDD, 0x10, 0x00, 0x00,
+    0x0E, 0xB0, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x02, 0xDF, 0xB5,
+    0x10, 0x00, 0x01, 0x7D, 0xFE, 0xA2, 0x00, 0x00, 0x03, 0x9E, 0xF4, 0x00,
+    0x00, 0x00, 0x2E, 0xC0, 0x00, 0x00, 0x00, 0xAF, 0x10, 0x00, 0x00, 0x1E,
+    0xCF, 0xB8, 0x77, 0x8E, 0xF4, 0x9C, 0xEF, 0xFD, 0x93, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x00,
+    0x00, 0xD1, 0x00, 0x00, 0x18, 0xDF, 0xEC, 0x7A, 0xE7, 0x56, 0xA9, 0xE9,
+    0x00, 0x00, 0x0C, 0xE6, 0x00, 0x00, 0x2B, 0xFE, 0x82, 0x00, 0x04, 0xAF,
+    0xE4, 0x00, 0x00, 0x2D, 0xD0, 0x00, 0x00, 0xAE, 0xD8, 0x65, 0x8F, 0x99,
+    0xDF, 0xED, 0x70, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0xA8,
+    0x00, 0x00, 0x0D, 0x10, 0x00, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0x47, 0x77,
+    0xCF, 0x77, 0x77, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x00,
+    0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00,
+    0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x9F,
+    0x00, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00,
+    0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xA8, 0x00,
+    0x00, 0x00, 0x00, 0xD1, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x09, 0x90,
+    0x00, 0x00, 0xD9, 0x00, 0x0B, 0xEF, 0xFF, 0xFF, 0x44, 0xFA, 0x44, 0x40,
+    0x0F, 0x90, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x0F, 0x90, 0x00, 0x00, 0xF9,
+    0x00, 0x00, 0x0F, 0x90, 0x00, 0x00, 0xEA, 0x00, 0x00, 0x0A, 0xF7, 0x56,
+    0x00, 0x1A, 0xEE, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00,
+    0xA8, 0x00, 0x00, 0x0D, 0x10, 0x00, 0xAE, 0xC9, 0xE3, 0x00, 0x2F, 0xB0,
+    0x00, 0x8E, 0x20, 0xC6, 0xD3, 0x6C, 0xC6, 0x00, 0x6C, 0x0A, 0xE0, 0x8F,
+    0x80, 0x00, 0x00, 0xC9, 0x0D, 0xED, 0x00, 0x00, 0x0E, 0x34, 0xF8, 0xF4,
+    0x00, 0x00, 0x00, 0x9F, 0x1F, 0x90, 0x00, 0x00, 0x0E, 0xB0, 0xBE, 0x00,
+    0x00, 0x05, 0xF6, 0x06, 0xF5, 0x00, 0x00, 0xAF, 0x10, 0x1F, 0xA0, 0x00,
+    0x1F, 0xC0, 0x00, 0xCF, 0x10, 0x06, 0xFF, 0xFF, 0xFF, 0xF6, 0x00, 0xBF,
+    0x77, 0x77, 0x7F, 0xB0, 0x2F, 0xA0, 0x00, 0x00, 0xAF, 0x27, 0xF4, 0x00,
+    0x00, 0x04, 0xF7, 0xCD, 0x00, 0x00, 0x00, 0x0D, 0xC0, 0xBB, 0xBB, 0xAE,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xC9, 0xFC, 0x77, 0x77, 0x77, 0xE3, 0xFA, 0x00,
+    0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFC, 0x77, 0x77, 0x77, 0x00, 0xFA,
+    0x00, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00,
+    0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x77, 0x77, 0x77, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xAE, 0xFA, 0x00, 0x00, 0x0A, 0xFC, 0x9F, 0xA0,
+    0x00, 0x00, 0xAF, 0xE3, 0xFA, 0x00, 0x00, 0x0A, 0xF0, 0x0F, 0xA0, 0x00,
+    0x00, 0xAF, 0x00, 0xFA, 0x00, 0x00, 0x0A, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x00, 0xFC, 0x77, 0x77, 0x7C, 0xF0, 0x0F, 0xA0, 0x00, 0x00, 0xAF,
+    0x00, 0xFA, 0x00, 0x00, 0x0A, 0xF0, 0x0F, 0xA0, 0x00, 0x00, 0xAF, 0x00,
+    0xFA, 0x00, 0x00, 0x0A, 0xF0, 0x0F, 0xA0, 0x00, 0x00, 0xAF, 0x00, 0xFA,
+    0x00, 0x00, 0x0A, 0xF0, 0xAE, 0x3F, 0xFF, 0xFF, 0xF9, 0xC9, 0x14, 0x5C,
+    0xF5, 0x42, 0xE3, 0x00, 0x09, 0xF0, 0x00, 0x00, 0x00, 0x09, 0xF0, 0x00,
+    0x00, 0x00, 0x09, 0xF0, 0x00, 0x00, 0x00, 0x09, 0xF0, 0x00, 0x00, 0x00,
+    0x09, 0xF0, 0x00, 0x00, 0x00, 0x09, 0xF0, 0x00, 0x00, 0x00, 0x09, 0xF0,
+    0x00, 0x00, 0x00, 0x09, 0xF0, 0x00, 0x00, 0x00, 0x09, 0xF0, 0x00, 0x00,
+    0x14, 0x5C, 0xF5, 0x42, 0x00, 0x3F, 0xFF, 0xFF, 0xF9, 0xAE, 0x01, 0x8D,
+    0xFD, 0x80, 0x0C, 0x90, 0xBF, 0xA7, 0xAF, 0xA0, 0xE3, 0x5F, 0x90, 0x00,
+    0x8F, 0x40, 0x0A, 0xF2, 0x00, 0x01, 0xF9, 0x00, 0xDD, 0x00, 0x00, 0x0D,
+    0xD0, 0x0E, 0xC0, 0x00, 0x00, 0xCE, 0x00, 0xFB, 0x00, 0x00, 0x0B, 0xF0,
+    0x0E, 0xC0, 0x00, 0x00, 0xCE, 0x00, 0xDD, 0x00, 0x00, 0x0D, 0xD0, 0x0A,
+    0xF2, 0x00, 0x02, 0xF9, 0x00, 0x5F, 0x90, 0x00, 0x8F, 0x40, 0x00, 0xBF,
+    0xA7, 0xAF, 0xA0, 0x00, 0x01, 0x8D, 0xFD, 0x70, 0x00, 0xAE, 0x6F, 0x60,
+    0x00, 0x01, 0xEB, 0xC9, 0x0D, 0xD0, 0x00, 0x07, 0xF4, 0xE3, 0x06, 0xF4,
+    0x00, 0x0D, 0xB0, 0x00, 0x00, 0xDB, 0x00, 0x6F, 0x40, 0x00, 0x00, 0x6F,
+    0x30, 0xCB, 0x00, 0x00, 0x00, 0x0D, 0xA4, 0xF4, 0x00, 0x00, 0x00, 0x06,
+    0xFC, 0xB0, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x9F, 0x00, 0x00, 0xAE, 0x01, 0x8D, 0xFD, 0x81, 0x00, 0xC9, 0x0B, 0xFA,
+    0x7A, 0xFB, 0x00, 0xE3, 0x5F, 0x70, 0x00, 0x7F, 0x50, 0x00, 0xBF, 0x10,
+    0x00, 0x1F, 0xB0, 0x00, 0xEC, 0x00, 0x00, 0x0C, 0xE0, 0x00, 0xFB, 0x00,
+    0x00, 0x0B, 0xF0, 0x00, 0xEC, 0x00, 0x00, 0x0C, 0xE0, 0x00, 0xCD, 0x00,
+    0x00, 0x0D, 0xC0, 0x00, 0x8F, 0x20, 0x00, 0x2F, 0x80, 0x00, 0x2F, 0x70,
+    0x00, 0x7F, 0x20, 0x00, 0x06, 0xE1, 0x01, 0xE6, 0x00, 0x01, 0x77, 0xCC,
+    0x0C, 0xC7, 0x71, 0x01, 0xFF, 0xFF, 0x0F, 0xFF, 0xF2, 0x00, 0x2F, 0xB0,
+    0x00, 0x08, 0xE2, 0x00, 0xC6, 0xD3, 0x6C, 0x0C, 0x60, 0x06, 0xC0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x0F, 0x90,
+    0x00, 0x00, 0xF9, 0x00, 0x00, 0x0F, 0x90, 0x00, 0x00, 0xF9, 0x00, 0x00,
+    0x0F, 0x90, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x0E, 0xA0, 0x00, 0x00, 0xAF,
+    0x85, 0x70, 0x01, 0xAE, 0xFD, 0x00, 0x00, 0x8F, 0x80, 0x00, 0x00, 0x00,
+    0x0D, 0xED, 0x00, 0x00, 0x00, 0x04, 0xF8, 0xF4, 0x00, 0x00, 0x00, 0x9F,
+    0x1F, 0x90, 0x00, 0x00, 0x0E, 0xB0, 0xBE, 0x00, 0x00, 0x05, 0xF6, 0x06,
+    0xF5, 0x00, 0x00, 0xAF, 0x10, 0x1F, 0xA0, 0x00, 0x1F, 0xC0, 0x00, 0xCF,
+    0x10, 0x06, 0xFF, 0xFF, 0xFF, 0xF6, 0x00, 0xBF, 0x77, 0x77, 0x7F, 0xB0,
+    0x2F, 0xA0, 0x00, 0x00, 0xAF, 0x27, 0xF4, 0x00, 0x00, 0x04, 0xF7, 0xCD,
+    0x00, 0x00, 0x00, 0x0D, 0xC0, 0xFF, 0xFF, 0xFE, 0xC7, 0x0F, 0xC6, 0x66,
+    0x8C, 0xF9, 0xFA, 0x00, 0x00, 0x0D, 0xEF, 0xA0, 0x00, 0x00, 0xCE, 0xFA,
+    0x00, 0x02, 0x7F, 0x6F, 0xFF, 0xFF, 0xFC, 0x30, 0xFC, 0x66, 0x69, 0xEC,
+    0x2F, 0xA0, 0x00, 0x03, 0xFA, 0xFA, 0x00, 0x00, 0x0C, 0xEF, 0xA0, 0x00,
+    0x00, 0xCE, 0xFA, 0x00, 0x00, 0x3F, 0xBF, 0xC6, 0x66, 0x8E, 0xF3, 0xFF,
+    0xFF, 0xFE, 0xB3, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0x77, 0x77,
+    0x77, 0xFA, 0x00, 0x00, 0x00, 0x0F, 0xA0, 0x00, 0x00, 0x00, 0xFA, 0x00,
+    0x00, 0x00, 0x0F, 0xA0, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0x0F,
+    0xA0, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0x0F, 0xA0, 0x00, 0x00,
+    0x00, 0xFA, 0x00, 0x00, 0x00, 0x0F, 0xA0, 0x00, 0x00, 0x00, 0xFA, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x07, 0xF7, 0x00, 0x00, 0x00, 0xCE, 0xC0, 0x00,
+    0x00, 0x1F, 0x9F, 0x20, 0x00, 0x06, 0xF2, 0xF6, 0x00, 0x00, 0xBC, 0x0C,
+    0xB0, 0x00, 0x1F, 0x80, 0x8F, 0x10, 0x05, 0xF3, 0x03, 0xF5, 0x00, 0xAD,
+    0x00, 0x0D, 0xA0, 0x0E, 0x80, 0x00, 0x8E, 0x04, 0xF3, 0x00, 0x03, 0xF4,
+    0x9D, 0x00, 0x00, 0x0D, 0x8D, 0xC7, 0x77, 0x77, 0xCD, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x77, 0x77, 0x77, 0xFA, 0x00,
+    0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFC, 0x77, 0x77, 0x77, 0xFA, 0x00, 0x00, 0x00, 0xFA, 0x00,
+    0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0xFC, 0x77,
+    0x77, 0x77, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x77,
+    0x77, 0x77, 0xFC, 0x00, 0x00, 0x00, 0x9F, 0x20, 0x00, 0x00, 0x4F, 0x70,
+    0x00, 0x00, 0x1D, 0xB0, 0x00, 0x00, 0x0A, 0xE2, 0x00, 0x00, 0x05, 0xF5,
+    0x00, 0x00, 0x02, 0xEA, 0x00, 0x00, 0x00, 0xBD, 0x10, 0x00, 0x00, 0x7F,
+    0x40, 0x00, 0x00, 0x3F, 0x90, 0x00, 0x00, 0x0C, 0xF7, 0x77, 0x77, 0x77,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFA, 0x00, 0x00, 0x0A, 0xFF, 0xA0, 0x00,
+    0x00, 0xAF, 0xFA, 0x00, 0x00, 0x0A, 0xFF, 0xA0, 0x00, 0x00, 0xAF, 0xFA,
+    0x00, 0x00, 0x0A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x77, 0x77, 0x7C,
+    0xFF, 0xA0, 0x00, 0x00, 0xAF, 0xFA, 0x00, 0x00, 0x0A, 0xFF, 0xA0, 0x00,
+    0x00, 0xAF, 0xFA, 0x00, 0x00, 0x0A, 0xFF, 0xA0, 0x00, 0x00, 0xAF, 0xFA,
+    0x00, 0x00, 0x0A, 0xF0, 0x01, 0x8D, 0xFD, 0x80, 0x00, 0xBF, 0xA7, 0xAF,
+    0xA0, 0x5F, 0x90, 0x00, 0x8F, 0x4A, 0xF2, 0x00, 0x01, 0xF9, 0xDD, 0x00,
+    0x00, 0x0D, 0xDE, 0xC0, 0xFF, 0xF0, 0xCE, 0xFB, 0x06, 0x66, 0x0B, 0xFE,
+    0xC0, 0x00, 0x00, 0xCE, 0xDD, 0x00, 0x00, 0x0D, 0xDA, 0xF2, 0x00, 0x02,
+    0xF9, 0x5F, 0x90, 0x00, 0x8F, 0x40, 0xBF, 0xA7, 0xAF, 0xA0, 0x01, 0x8D,
+    0xFD, 0x70, 0x00, 0x3F, 0xFF, 0xFF, 0xF9, 0x14, 0x5C, 0xF5, 0x42, 0x00,
+    0x09, 0xF0, 0x00, 0x00, 0x09, 0xF0, 0x00, 0x00, 0x09, 0xF0, 0x00, 0x00,
+    0x09, 0xF0, 0x00, 0x00, 0x09, 0xF0, 0x00, 0x00, 0x09, 0xF0, 0x00, 0x00,
+    0x09, 0xF0, 0x00, 0x00, 0x09, 0xF0, 0x00, 0x00, 0x09, 0xF0, 0x00, 0x14,
+    0x5C, 0xF5, 0x42, 0x3F, 0xFF, 0xFF, 0xF9, 0xFA, 0x00, 0x00, 0x4F, 0xB0,
+    0xFA, 0x00, 0x02, 0xEC, 0x10, 0xFA, 0x00, 0x2D, 0xC1, 0x00, 0xFA, 0x01,
+    0xCD, 0x10, 0x00, 0xFA, 0x0B, 0xD2, 0x00, 0x00, 0xFA, 0x9F, 0x20, 0x00,
+    0x00, 0xFE, 0xDE, 0x70, 0x00, 0x00, 0xFD, 0x26, 0xF3, 0x00, 0x00, 0xFA,
+    0x00, 0xBD, 0x10, 0x00, 0xFA, 0x00, 0x2E, 0xA0, 0x00, 0xFA, 0x00, 0x06,
+    0xF6, 0x00, 0xFA, 0x00, 0x00, 0xBF, 0x30, 0xFA, 0x00, 0x00, 0x2E, 0xD1,
+    0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x0D, 0xED, 0x00, 0x00, 0x00,
+    0x03, 0xF6, 0xF4, 0x00, 0x00, 0x00, 0x8E, 0x0C, 0x90, 0x00, 0x00, 0x0E,
+    0xA0, 0x6E, 0x00, 0x00, 0x04, 0xF4, 0x01, 0xF5, 0x00, 0x00, 0xAD, 0x00,
+    0x0B, 0xA0, 0x00, 0x1E, 0x80, 0x00, 0x7F, 0x10, 0x06, 0xF2, 0x00, 0x02,
+    0xF6, 0x00, 0xBC, 0x00, 0x00, 0x0C, 0xB0, 0x2F, 0x60, 0x00, 0x00, 0x8F,
+    0x27, 0xF1, 0x00, 0x00, 0x03, 0xF7, 0xCA, 0x00, 0x00, 0x00, 0x0E, 0xC0,
+    0xFD, 0x00, 0x00, 0x0D, 0xFF, 0xE2, 0x00, 0x02, 0xFF, 0xFC, 0x50, 0x00,
+    0x6C, 0xFF, 0xA9, 0x00, 0x09, 0xAF, 0xFA, 0xA0, 0x00, 0xAB, 0xFF, 0xB9,
+    0x20, 0x38, 0xBF, 0xFB, 0x66, 0x07, 0x5B, 0xFF, 0xB3, 0xA0, 0xB2, 0xBF,
+    0xFB, 0x0D, 0x0D, 0x0B, 0xFF, 0xB0, 0xB5, 0xA0, 0xBF, 0xFB, 0x08, 0xD7,
+    0x0B, 0xFF, 0xB0, 0x5F, 0x40, 0xBF, 0xFB, 0x02, 0xF1, 0x0B, 0xF0, 0xFD,
+    0x00, 0x00, 0x08, 0xFF, 0xF7, 0x00, 0x00, 0x8F, 0xFC, 0xE1, 0x00, 0x08,
+    0xFF, 0x7D, 0x80, 0x00, 0x8F, 0xF7, 0x5F, 0x20, 0x08, 0xFF, 0x80, 0xBA,
+    0x00, 0x8F, 0xF8, 0x03, 0xF3, 0x08, 0xFF, 0x80, 0x0A, 0xC0, 0x8F, 0xF8,
+    0x00, 0x2F, 0x57, 0xFF, 0x80, 0x00, 0x8D, 0x7F, 0xF8, 0x00, 0x01, 0xEC,
+    0xFF, 0x80, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x0D, 0xF0, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xF7, 0x77, 0x77, 0x77, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+    0xF0, 0x07, 0x77, 0x77, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+    0x77, 0x77, 0x77, 0x77, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0x8D, 0xFD,
+    0x80, 0x00, 0xBF, 0xA7, 0xAF, 0xA0, 0x5F, 0x90, 0x00, 0x8F, 0x4A, 0xF2,
+    0x00, 0x01, 0xF9, 0xDD, 0x00, 0x00, 0x0D, 0xDE, 0xC0, 0x00, 0x00, 0xCE,
+    0xFB, 0x00, 0x00, 0x0B, 0xFE, 0xC0, 0x00, 0x00, 0xCE, 0xDD, 0x00, 0x00,
+    0x0D, 0xDA, 0xF2, 0x00, 0x02, 0xF9, 0x5F, 0x90, 0x00, 0x8F, 0x40, 0xBF,
+    0xA7, 0xAF, 0xA0, 0x01, 0x8D, 0xFD, 0x70, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xC7, 0x77, 0x77, 0xCF, 0xFA, 0x00, 0x00, 0x0A, 0xFF, 0xA0, 0x00,
+    0x00, 0xAF, 0xFA, 0x00, 0x00, 0x0A, 0xFF, 0xA0, 0x00, 0x00, 0xAF, 0xFA,
+    0x00, 0x00, 0x0A, 0xFF, 0xA0, 0x00, 0x00, 0xAF, 0xFA, 0x00, 0x00, 0x0A,
+    0xFF, 0xA0, 0x00, 0x00, 0xAF, 0xFA, 0x00, 0x00, 0x0A, 0xFF, 0xA0, 0x00,
+    0x00, 0xAF, 0xFA, 0x00, 0x00, 0x0A, 0xF0, 0xFF, 0xFF, 0xFD, 0xA4, 0x0F,
+    0xC6, 0x67, 0x9E, 0xF5, 0xFA, 0x00, 0x00, 0x3F, 0xDF, 0xA0, 0x00, 0x00,
+    0xCF, 0xFA, 0x00, 0x00, 0x0E, 0xDF, 0xA0, 0x01, 0x3B, 0xF6, 0xFF, 0xFF,
+    0xFF, 0xE6, 0x0F, 0xC6, 0x65, 0x30, 0x00, 0xFA, 0x00, 0x00, 0x00, 0x0F,
+    0xA0, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0x0F, 0xA0, 0x00, 0x00,
+    0x00, 0xFA, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0xFF, 0xFF, 0x7A, 0xF8,
+    0x77, 0x77, 0x73, 0x1D, 0xC1, 0x00, 0x00, 0x00, 0x2E, 0xA0, 0x00, 0x00,
+    0x00, 0x4F, 0x80, 0x00, 0x00, 0x00, 0x6F, 0x50, 0x00, 0x00, 0x05, 0xF6,
+    0x00, 0x00, 0x02, 0xEA, 0x00, 0x00, 0x00, 0xBD, 0x10, 0x00, 0x00, 0x7F,
+    0x40, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x0D, 0xF7, 0x77, 0x77, 0x77,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0x47, 0x77,
+    0xCF, 0x77, 0x77, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x00,
+    0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00,
+    0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x9F,
+    0x00, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00,
+    0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x6F, 0x60,
+    0x00, 0x01, 0xEB, 0x0D, 0xD0, 0x00, 0x07, 0xF4, 0x06, 0xF4, 0x00, 0x0D,
+    0xB0, 0x00, 0xDB, 0x00, 0x6F, 0x40, 0x00, 0x6F, 0x30, 0xCB, 0x00, 0x00,
+    0x0D, 0xA4, 0xF4, 0x00, 0x00, 0x06, 0xFC, 0xB0, 0x00, 0x00, 0x00, 0xDF,
+    0x40, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00,
+    0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00,
+    0x9F, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x00,
+    0x00, 0x03, 0xBE, 0xFF, 0xFC, 0x40, 0x2E, 0xE8, 0xCF, 0x7D, 0xF2, 0xAF,
+    0x30, 0x9F, 0x02, 0xFA, 0xEC, 0x00, 0x9F, 0x00, 0xBD, 0xFA, 0x00, 0x9F,
+    0x00, 0xAE, 0xDC, 0x00, 0x9F, 0x00, 0xCD, 0x9F, 0x30, 0x9F, 0x02, 0xF9,
+    0x2E, 0xE8, 0xCF, 0x7D, 0xE2, 0x02, 0xAE, 0xFF, 0xFC, 0x30, 0x00, 0x00,
+    0x9F, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0xAE, 0x20, 0x00, 0x00,
+    0x2E, 0xA1, 0xDC, 0x00, 0x00, 0x0B, 0xD1, 0x04, 0xF7, 0x00, 0x07, 0xF3,
+    0x00, 0x08, 0xF3, 0x03, 0xF7, 0x00, 0x00, 0x0C, 0xD1, 0xCC, 0x00, 0x00,
+    0x00, 0x2E, 0xDE, 0x20, 0x00, 0x00, 0x00, 0x9F, 0x90, 0x00, 0x00, 0x00,
+    0x3F, 0xBF, 0x30, 0x00, 0x00, 0x1D, 0xB0, 0xCD, 0x10, 0x00, 0x09, 0xE2,
+    0x03, 0xF9, 0x00, 0x04, 0xF5, 0x00, 0x08, 0xF4, 0x01, 0xDA, 0x00, 0x00,
+    0x0C, 0xD1, 0xAE, 0x10, 0x00, 0x00, 0x3F, 0xA0, 0xFA, 0x00, 0xAF, 0x00,
+    0xAF, 0xFA, 0x00, 0xAF, 0x00, 0xAF, 0xFA, 0x00, 0xAF, 0x00, 0xAF, 0xFA,
+    0x00, 0xAF, 0x00, 0xAF, 0xFA, 0x00, 0xAF, 0x00, 0xAF, 0xEB, 0x00, 0xAF,
+    0x00, 0xBE, 0xAE, 0x10, 0xAF, 0x01, 0xEB, 0x4F, 0xD7, 0xCF, 0x7C, 0xF4,
+    0x04, 0xBE, 0xFF, 0xFC, 0x50, 0x00, 0x00, 0xAF, 0x00, 0x00, 0x00, 0x00,
+    0xAF, 0x00, 0x00, 0x00, 0x00, 0xAF, 0x00, 0x00, 0x00, 0x00, 0xAF, 0x00,
+    0x00, 0x00, 0x18, 0xDF, 0xD8, 0x10, 0x00, 0x0B, 0xFA, 0x7A, 0xFB, 0x00,
+    0x05, 0xF7, 0x00, 0x07, 0xF5, 0x00, 0xBF, 0x10, 0x00, 0x1F, 0xB0, 0x0E,
+    0xC0, 0x00, 0x00, 0xCE, 0x00, 0xFB, 0x00, 0x00, 0x0B, 0xF0, 0x0E, 0xC0,
+    0x00, 0x00, 0xCE, 0x00, 0xCD, 0x00, 0x00, 0x0D, 0xC0, 0x08, 0xF2, 0x00,
+    0x02, 0xF8, 0x00, 0x2F, 0x70, 0x00, 0x7F, 0x20, 0x00, 0x6E, 0x10, 0x1E,
+    0x60, 0x01, 0x77, 0xCC, 0x0C, 0xC7, 0x71, 0x1F, 0xFF, 0xF0, 0xFF, 0xFF,
+    0x20, 0x00, 0xC6, 0x06, 0xC0, 0x00, 0xC6, 0x06, 0xC0, 0x00, 0x00, 0x00,
+    0x00, 0x3F, 0xFF, 0xFF, 0xF9, 0x14, 0x5C, 0xF5, 0x42, 0x00, 0x09, 0xF0,
+    0x00, 0x00, 0x09, 0xF0, 0x00, 0x00, 0x09, 0xF0, 0x00, 0x00, 0x09, 0xF0,
+    0x00, 0x00, 0x09, 0xF0, 0x00, 0x00, 0x09, 0xF0, 0x00, 0x00, 0x09, 0xF0,
+    0x00, 0x00, 0x09, 0xF0, 0x00, 0x00, 0x09, 0xF0, 0x00, 0x14, 0x5C, 0xF5,
+    0x42, 0x3F, 0xFF, 0xFF, 0xF9, 0x00, 0x0C, 0x60, 0x6C, 0x00, 0x00, 0x0C,
+    0x60, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x60, 0x00, 0x01,
+    0xEB, 0x0D, 0xD0, 0x00, 0x07, 0xF4, 0x06, 0xF4, 0x00, 0x0D, 0xB0, 0x00,
+    0xDB, 0x00, 0x6F, 0x40, 0x00, 0x6F, 0x30, 0xCB, 0x00, 0x00, 0x0D, 0xA4,
+    0xF4, 0x00, 0x00, 0x06, 0xFC, 0xB0, 0x00, 0x00, 0x00, 0xDF, 0x40, 0x00,
+    0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00,
+    0x9F, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x00,
+    0x00, 0x00, 0x00, 0xAE, 0x00, 0x00, 0x00, 0x00, 0xC9, 0x00, 0x00, 0x00,
+    0x00, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xBE, 0xE8,
+    0x1E, 0x50, 0x2E, 0xD7, 0x7D, 0xCF, 0x20, 0x9F, 0x20, 0x01, 0xEF, 0x10,
+    0xDC, 0x00, 0x00, 0xBF, 0x00, 0xFB, 0x00, 0x00, 0x9F, 0x00, 0xFA, 0x00,
+    0x00, 0x9F, 0x00, 0xDC, 0x00, 0x00, 0xBF, 0x00, 0x9F, 0x20, 0x01, 0xEF,
+    0x00, 0x3F, 0xD6, 0x6C, 0xCF, 0x71, 0x04, 0xCF, 0xD7, 0x1C, 0xE3, 0x00,
+    0x00, 0xAE, 0x00, 0x00, 0x0C, 0x90, 0x00, 0x00, 0xE3, 0x00, 0x00, 0x00,
+    0x00, 0x18, 0xDF, 0xEC, 0x7A, 0xF8, 0x56, 0x9A, 0xEA, 0x00, 0x00, 0x0B,
+    0xD3, 0x00, 0x00, 0x1B, 0xFF, 0xF0, 0x06, 0xF9, 0x55, 0x00, 0xEB, 0x00,
+    0x00, 0x0E, 0xB0, 0x00, 0x00, 0x9F, 0x96, 0x68, 0xD0, 0x7D, 0xEE, 0xC8,
+    0x00, 0x00, 0xAE, 0x00, 0x00, 0x00, 0xC9, 0x00, 0x00, 0x00, 0xE3, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF6, 0x6D, 0xFD, 0x80, 0xFD, 0xE7, 0x6A, 0xF8,
+    0xFF, 0x30, 0x00, 0xCD, 0xFB, 0x00, 0x00, 0x9F, 0xFA, 0x00, 0x00, 0x9F,
+    0xF9, 0x00, 0x00, 0x9F, 0xF9, 0x00, 0x00, 0x9F, 0xF9, 0x00, 0x00, 0x9F,
+    0xF9, 0x00, 0x00, 0x9F, 0xF9, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x9F,
+    0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x9F,
+    0x0A, 0xE0, 0x00, 0xC9, 0x00, 0x0E, 0x30, 0x00, 0x00, 0x00, 0xF9, 0x00,
+    0x0F, 0x90, 0x00, 0xF9, 0x00, 0x0F, 0x90, 0x00, 0xF9, 0x00, 0x0F, 0x90,
+    0x00, 0xF9, 0x00, 0x0E, 0xA0, 0x00, 0xAF, 0x85, 0x71, 0xAE, 0xFD, 0x00,
+    0x00, 0x2F, 0xB0, 0x00, 0x00, 0x08, 0xE2, 0x00, 0x00, 0xC6, 0xD3, 0x6C,
+    0x00, 0x0C, 0x60, 0x06, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF9, 0x00, 0x00, 0xAF, 0x4F, 0x90, 0x00, 0x03, 0xF8, 0xF9,
+    0x00, 0x00, 0x0D, 0xCF, 0x90, 0x00, 0x00, 0xAE, 0xF9, 0x00, 0x00, 0x09,
+    0xFF, 0x90, 0x00, 0x00, 0xAE, 0xEB, 0x00, 0x00, 0x0D, 0xCA, 0xF2, 0x00,
+    0x04, 0xF8, 0x3E, 0xE7, 0x58, 0xED, 0x10, 0x3A, 0xEF, 0xD9, 0x20, 0x03,
+    0xBE, 0xE8, 0x1E, 0x50, 0x2E, 0xD7, 0x7D, 0xCF, 0x20, 0x9F, 0x20, 0x01,
+    0xEF, 0x10, 0xDC, 0x00, 0x00, 0xBF, 0x00, 0xFB, 0x00, 0x00, 0x9F, 0x00,
+    0xFA, 0x00, 0x00, 0x9F, 0x00, 0xDC, 0x00, 0x00, 0xBF, 0x00, 0x9F, 0x20,
+    0x01, 0xEF, 0x00, 0x3F, 0xD6, 0x6C, 0xCF, 0x71, 0x04, 0xCF, 0xD7, 0x1C,
+    0xE3, 0x04, 0xBE, 0xEC, 0x40, 0x04, 0xFC, 0x66, 0xCF, 0x60, 0xBE, 0x10,
+    0x01, 0xDD, 0x0E, 0xA0, 0x00, 0x0B, 0xF0, 0xF9, 0x00, 0x00, 0xDC, 0x0F,
+    0x90, 0x02, 0x9E, 0x40, 0xF9, 0x0F, 0xFC, 0x30, 0x0F, 0x90, 0x56, 0x9F,
+    0x91, 0xF9, 0x00, 0x00, 0x3F, 0x8F, 0x90, 0x00, 0x00, 0xBD, 0xF9, 0x00,
+    0x00, 0x0A, 0xFF, 0x90, 0x00, 0x01, 0xEC, 0xFF, 0xA7, 0x57, 0xDF, 0x4F,
+    0xCB, 0xEF, 0xDA, 0x30, 0xF9, 0x00, 0x00, 0x00, 0x0F, 0x90, 0x00, 0x00,
+    0x00, 0xF9, 0x00, 0x00, 0x00, 0x0F, 0x90, 0x00, 0x00, 0x00, 0xCD, 0x00,
+    0x00, 0x0C, 0xC7, 0xF3, 0x00, 0x02, 0xF7, 0x1F, 0x90, 0x00, 0x8F, 0x20,
+    0xAE, 0x00, 0x0D, 0xB0, 0x05, 0xF4, 0x03, 0xF5, 0x00, 0x0E, 0xA0, 0x8E,
+    0x10, 0x00, 0x8E, 0x0D, 0xA0, 0x00, 0x03, 0xF7, 0xF4, 0x00, 0x00, 0x0C,
+    0xEE, 0x00, 0x00, 0x00, 0x6F, 0x80, 0x00, 0x00, 0x06, 0xF4, 0x00, 0x00,
+    0x00, 0xAE, 0x00, 0x00, 0x00, 0x0D, 0xC0, 0x00, 0x00, 0x00, 0xFA, 0x00,
+    0x00, 0x00, 0x2A, 0xEE, 0xC7, 0x10, 0x0B, 0xE6, 0x69, 0xF4, 0x00, 0xE9,
+    0x00, 0x01, 0x00, 0x0B, 0xD1, 0x00, 0x00, 0x00, 0x2E, 0xE5, 0x00, 0x00,
+    0x00, 0x5F, 0xFA, 0x10, 0x03, 0xCE, 0x97, 0xEC, 0x13, 0xEB, 0x10, 0x05,
+    0xF7, 0xBE, 0x10, 0x00, 0x0D, 0xDE, 0xB0, 0x00, 0x00, 0xAF, 0xEB, 0x00,
+    0x00, 0x0C, 0xDB, 0xF2, 0x00, 0x03, 0xF9, 0x3E, 0xE7, 0x58, 0xEE, 0x20,
+    0x2A, 0xEF, 0xD9, 0x20, 0x18, 0xDF, 0xEC, 0x7A, 0xF8, 0x56, 0x9A, 0xEA,
+    0x00, 0x00, 0x0B, 0xD3, 0x00, 0x00, 0x1B, 0xFF, 0xF0, 0x06, 0xF9, 0x55,
+    0x00, 0xEB, 0x00, 0x00, 0x0E, 0xB0, 0x00, 0x00, 0x9F, 0x96, 0x68, 0xD0,
+    0x7D, 0xEE, 0xC8, 0x7F, 0xFF, 0xFF, 0xFF, 0x25, 0x55, 0x48, 0xF9, 0x00,
+    0x00, 0x8F, 0x60, 0x00, 0x0B, 0xE4, 0x00, 0x00, 0xBE, 0x30, 0x00, 0x08,
+    0xF4, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x9F, 0x20, 0x00, 0x00, 0xDC,
+    0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0xEB, 0x00, 0x00, 0x00, 0xAE,
+    0x20, 0x00, 0x00, 0x3E, 0xE8, 0x41, 0x00, 0x02, 0x9D, 0xFF, 0xB3, 0x00,
+    0x00, 0x16, 0xED, 0x00, 0x00, 0x00, 0x9E, 0x00, 0x00, 0x00, 0xCB, 0x00,
+    0x00, 0x04, 0xF4, 0xF6, 0x6D, 0xFD, 0x80, 0xFD, 0xE7, 0x6A, 0xF8, 0xFF,
+    0x30, 0x00, 0xCD, 0xFB, 0x00, 0x00, 0x9F, 0xFA, 0x00, 0x00, 0x9F, 0xF9,
+    0x00, 0x00, 0x9F, 0xF9, 0x00, 0x00, 0x9F, 0xF9, 0x00, 0x00, 0x9F, 0xF9,
+    0x00, 0x00, 0x9F, 0xF9, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x9F, 0x00,
+    0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x9F, 0x01,
+    0x8D, 0xFD, 0x80, 0x00, 0xCE, 0x85, 0x8F, 0xA0, 0x5F, 0x50, 0x00, 0x6F,
+    0x4A, 0xE0, 0x00, 0x01, 0xEA, 0xDB, 0x00, 0x00, 0x0C, 0xDE, 0xA2, 0x22,
+    0x22, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xA0, 0x00, 0x00, 0xAE, 0xDB,
+    0x00, 0x00, 0x0C, 0xDA, 0xE0, 0x00, 0x00, 0xEA, 0x4F, 0x50, 0x00, 0x6F,
+    0x50, 0xBE, 0x85, 0x8F, 0xB0, 0x00, 0x8D, 0xFD, 0x81, 0x00, 0xF9, 0x00,
+    0x0F, 0x90, 0x00, 0xF9, 0x00, 0x0F, 0x90, 0x00, 0xF9, 0x00, 0x0F, 0x90,
+    0x00, 0xF9, 0x00, 0x0E, 0xA0, 0x00, 0xAF, 0x85, 0x71, 0xAE, 0xFD, 0xF8,
+    0x00, 0x05, 0xF7, 0x0F, 0x80, 0x04, 0xF7, 0x00, 0xF8, 0x03, 0xE7, 0x00,
+    0x0F, 0x82, 0xE7, 0x00, 0x00, 0xF8, 0xC9, 0x00, 0x00, 0x0F, 0xEE, 0xE2,
+    0x00, 0x00, 0xFB, 0x09, 0xE2, 0x00, 0x0F, 0x80, 0x0A, 0xD2, 0x00, 0xF8,
+    0x00, 0x0B, 0xD2, 0x0F, 0x80, 0x00, 0x1C, 0xD2, 0x09, 0xEC, 0x30, 0x00,
+    0x00, 0x04, 0x6D, 0xC0, 0x00, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x00,
+    0x00, 0xE9, 0x00, 0x00, 0x00, 0x00, 0xCE, 0x00, 0x00, 0x00, 0x04, 0xFF,
+    0x40, 0x00, 0x00, 0x0A, 0xBD, 0x80, 0x00, 0x00, 0x2F, 0x69, 0xD0, 0x00,
+    0x00, 0x9F, 0x15, 0xF3, 0x00, 0x01, 0xE9, 0x01, 0xF8, 0x00, 0x07, 0xF3,
+    0x00, 0xBD, 0x00, 0x0D, 0xB0, 0x00, 0x6F, 0x20, 0x5F, 0x50, 0x00, 0x2F,
+    0xB3, 0xCD, 0x00, 0x00, 0x08, 0xE8, 0xF9, 0x00, 0x00, 0x9F, 0xF9, 0x00,
+    0x00, 0x9F, 0xF9, 0x00, 0x00, 0x9F, 0xF9, 0x00, 0x00, 0x9F, 0xF9, 0x00,
+    0x00, 0x9F, 0xF9, 0x00, 0x00, 0x9F, 0xF9, 0x00, 0x00, 0xBF, 0xFC, 0x00,
+    0x01, 0xEF, 0xFF, 0xA6, 0x7D, 0xDF, 0xFB, 0xCE, 0xD7, 0x6F, 0xF9, 0x00,
+    0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0xF9, 0x00,
+    0x00, 0x00, 0x1F, 0x90, 0x00, 0x00, 0x9F, 0x0A, 0xE1, 0x00, 0x00, 0xAE,
+    0x05, 0xF5, 0x00, 0x00, 0xBC, 0x00, 0xEB, 0x00, 0x00, 0xDA, 0x00, 0x8F,
+    0x20, 0x01, 0xF6, 0x00, 0x2F, 0x70, 0x07, 0xE1, 0x00, 0x0C, 0xC0, 0x0E,
+    0x80, 0x00, 0x06, 0xF3, 0x8D, 0x10, 0x00, 0x01, 0xEB, 0xE3, 0x00, 0x00,
+    0x00, 0xAF, 0x40, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x58, 0xEB, 0x75, 0x07,
+    0xF4, 0x00, 0x00, 0xEA, 0x00, 0x00, 0x0E, 0xA0, 0x00, 0x00, 0x9F, 0x61,
+    0x00, 0x00, 0xAF, 0xFF, 0xF0, 0xAE, 0x74, 0x22, 0x7F, 0x30, 0x00, 0x0D,
+    0xC0, 0x00, 0x00, 0xEA, 0x00, 0x00, 0x0C, 0xE1, 0x00, 0x00, 0x6F, 0xD6,
+    0x20, 0x00, 0x7E, 0xFF, 0xD4, 0x00, 0x04, 0x8F, 0xD0, 0x00, 0x00, 0x9E,
+    0x00, 0x00, 0x0C, 0xB0, 0x00, 0x05, 0xF3, 0x01, 0x8D, 0xFD, 0x81, 0x01,
+    0xCE, 0x86, 0x8E, 0xC0, 0x8F, 0x40, 0x00, 0x4F, 0x7D, 0xD0, 0x00, 0x00,
+    0xDC, 0xFB, 0x00, 0x00, 0x0B, 0xEF, 0xB0, 0x00, 0x00, 0xBE, 0xCD, 0x00,
+    0x00, 0x0D, 0xC7, 0xF4, 0x00, 0x04, 0xF7, 0x0C, 0xE8, 0x68, 0xEC, 0x10,
+    0x18, 0xDF, 0xD8, 0x10, 0x9F, 0xFF, 0xFF, 0xFF, 0xFD, 0x55, 0xFB, 0x55,
+    0xBF, 0x54, 0x00, 0xF9, 0x00, 0x9F, 0x00, 0x00, 0xF9, 0x00, 0x9F, 0x00,
+    0x00, 0xF9, 0x00, 0x9F, 0x00, 0x00, 0xF9, 0x00, 0x9F, 0x00, 0x00, 0xF9,
+    0x00, 0x9F, 0x00, 0x00, 0xF9, 0x00, 0x9F, 0x00, 0x00, 0xF9, 0x00, 0x7F,
+    0x74, 0x00, 0xF9, 0x00, 0x1C, 0xF7, 0x01, 0x8D, 0xFD, 0x91, 0x01, 0xCE,
+    0x86, 0x8E, 0xC1, 0x8F, 0x30, 0x00, 0x4F, 0x8D, 0xB0, 0x00, 0x00, 0xDC,
+    0xF9, 0x00, 0x00, 0x0B, 0xEF, 0x90, 0x00, 0x00, 0xBE, 0xF9, 0x00, 0x00,
+    0x0D, 0xCF, 0xA0, 0x00, 0x04, 0xF8, 0xFF, 0xB7, 0x58, 0xED, 0x1F, 0xA9,
+    0xDF, 0xD8, 0x10, 0xF9, 0x00, 0x00, 0x00, 0x0F, 0x90, 0x00, 0x00, 0x00,
+    0xF9, 0x00, 0x00, 0x00, 0x0F, 0x90, 0x00, 0x00, 0x00, 0x02, 0x9E, 0xFD,
+    0x91, 0xDE, 0x85, 0x88, 0x8F, 0x50, 0x00, 0x0C, 0xD0, 0x00, 0x00, 0xEB,
+    0x00, 0x00, 0x0F, 0xA0, 0x00, 0x00, 0xDB, 0x00, 0x00, 0x0A, 0xE1, 0x00,
+    0x00, 0x3E, 0xD7, 0x20, 0x00, 0x3B, 0xFF, 0xB2, 0x00, 0x01, 0x6E, 0xC0,
+    0x00, 0x00, 0x9E, 0x00, 0x00, 0x0C, 0xB0, 0x00, 0x05, 0xF3, 0x01, 0x7C,
+    0xEF, 0xFF, 0xFC, 0x1C, 0xF9, 0x65, 0xEC, 0x54, 0x7F, 0x40, 0x00, 0x5F,
+    0x40, 0xCD, 0x00, 0x00, 0x0E, 0xA0, 0xEA, 0x00, 0x00, 0x0B, 0xE0, 0xFB,
+    0x00, 0x00, 0x0A, 0xF0, 0xDD, 0x00, 0x00, 0x0C, 0xD0, 0x8F, 0x50, 0x00,
+    0x3F, 0x80, 0x1D, 0xF8, 0x68, 0xED, 0x10, 0x01, 0x9E, 0xFD, 0x91, 0x00,
+    0x7F, 0xFF, 0xFF, 0xFF, 0x44, 0x55, 0xFB, 0x55, 0x51, 0x00, 0x0F, 0x90,
+    0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x0F, 0x90, 0x00, 0x00, 0x00,
+    0xF9, 0x00, 0x00, 0x00, 0x0F, 0x90, 0x00, 0x00, 0x00, 0xEB, 0x00, 0x00,
+    0x00, 0x0A, 0xF8, 0x57, 0x00, 0x00, 0x1A, 0xEF, 0xC0, 0xF9, 0x00, 0x00,
+    0xAF, 0x4F, 0x90, 0x00, 0x03, 0xF8, 0xF9, 0x00, 0x00, 0x0D, 0xCF, 0x90,
+    0x00, 0x00, 0xAE, 0xF9, 0x00, 0x00, 0x09, 0xFF, 0x90, 0x00, 0x00, 0xAE,
+    0xEB, 0x00, 0x00, 0x0D, 0xCA, 0xF2, 0x00, 0x04, 0xF8, 0x3E, 0xE7, 0x58,
+    0xED, 0x10, 0x3A, 0xEF, 0xD9, 0x20, 0x08, 0x70, 0x2B, 0xED, 0x50, 0x2F,
+    0x80, 0xAE, 0x6A, 0xF3, 0x9E, 0x10, 0xEA, 0x00, 0xD9, 0xDB, 0x00, 0xF9,
+    0x00, 0xAD, 0xE9, 0x00, 0xF8, 0x00, 0x9E, 0xF9, 0x00, 0xF8, 0x00, 0xAE,
+    0xDB, 0x00, 0xF8, 0x00, 0xCC, 0x9F, 0x30, 0xF8, 0x05, 0xF7, 0x2E, 0xE7,
+    0xFB, 0x9F, 0xC0, 0x02, 0xAE, 0xFF, 0xD8, 0x10, 0x00, 0x00, 0xF8, 0x00,
+    0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
+    0x00, 0xF8, 0x00, 0x00, 0x0E, 0xE4, 0x00, 0x00, 0xDB, 0x06, 0xDD, 0x00,
+    0x07, 0xF2, 0x00, 0x5F, 0x50, 0x2E, 0x80, 0x00, 0x0D, 0xB0, 0xAD, 0x10,
+    0x00, 0x08, 0xF6, 0xF5, 0x00, 0x00, 0x02, 0xFF, 0xB0, 0x00, 0x00, 0x00,
+    0xBF, 0x30, 0x00, 0x00, 0x02, 0xEF, 0x50, 0x00, 0x00, 0x0A, 0xEE, 0xB0,
+    0x00, 0x00, 0x4F, 0x68, 0xF2, 0x00, 0x00, 0xDC, 0x02, 0xF8, 0x00, 0x07,
+    0xF3, 0x00, 0xBE, 0x10, 0x2F, 0x90, 0x00, 0x4F, 0xA5, 0xBE, 0x10, 0x00,
+    0x08, 0xEE, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
+    0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00,
+    0xF8, 0x09, 0xF5, 0xF8, 0x00, 0xF8, 0x03, 0xF8, 0xF8, 0x00, 0xF8, 0x00,
+    0xDC, 0xF8, 0x00, 0xF8, 0x00, 0xAD, 0xF8, 0x00, 0xF8, 0x00, 0x9F, 0xF9,
+    0x00, 0xF8, 0x00, 0xAE, 0xDC, 0x00, 0xF8, 0x00, 0xCC, 0xAF, 0x30, 0xF8,
+    0x05, 0xF7, 0x3F, 0xE7, 0xFB, 0x9F, 0xD1, 0x03, 0xBE, 0xFF, 0xD8, 0x10,
+    0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00,
+    0xF8, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0x60, 0x00, 0x07,
+    0xF1, 0x6F, 0x10, 0x00, 0x01, 0xF6, 0xBC, 0x00, 0x00, 0x00, 0xDB, 0xDA,
+    0x00, 0x00, 0x00, 0xAD, 0xF9, 0x00, 0xF8, 0x00, 0x9F, 0xF9, 0x00, 0xF8,
+    0x00, 0x9F, 0xEA, 0x00, 0xF9, 0x00, 0xAE, 0xCC, 0x02, 0xFB, 0x00, 0xDB,
+    0x7F, 0x7B, 0xCF, 0x89, 0xF6, 0x0A, 0xFC, 0x26, 0xEE, 0x90, 0xC6, 0x06,
+    0xC0, 0xC6, 0x06, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x90, 0x00, 0x0F, 0x90,
+    0x00, 0x0F, 0x90, 0x00, 0x0F, 0x90, 0x00, 0x0F, 0x90, 0x00, 0x0F, 0x90,
+    0x00, 0x0F, 0x90, 0x00, 0x0E, 0xA0, 0x00, 0x0A, 0xF8, 0x57, 0x01, 0xAE,
+    0xFD, 0x00, 0xC6, 0x06, 0xC0, 0x00, 0x0C, 0x60, 0x6C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0F, 0x90, 0x00, 0x0A, 0xF4, 0xF9, 0x00, 0x00, 0x3F, 0x8F,
+    0x90, 0x00, 0x00, 0xDC, 0xF9, 0x00, 0x00, 0x0A, 0xEF, 0x90, 0x00, 0x00,
+    0x9F, 0xF9, 0x00, 0x00, 0x0A, 0xEE, 0xB0, 0x00, 0x00, 0xDC, 0xAF, 0x20,
+    0x00, 0x4F, 0x83, 0xEE, 0x75, 0x8E, 0xD1, 0x03, 0xAE, 0xFD, 0x92, 0x00,
+    0x00, 0x00, 0xAE, 0x00, 0x00, 0x00, 0x0C, 0x90, 0x00, 0x00, 0x00, 0xE3,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x8D, 0xFD, 0x81, 0x01, 0xCE,
+    0x86, 0x8E, 0xC0, 0x8F, 0x40, 0x00, 0x4F, 0x7D, 0xD0, 0x00, 0x00, 0xDC,
+    0xFB, 0x00, 0x00, 0x0B, 0xEF, 0xB0, 0x00, 0x00, 0xBE, 0xCD, 0x00, 0x00,
+    0x0D, 0xC7, 0xF4, 0x00, 0x04, 0xF7, 0x0C, 0xE8, 0x68, 0xEC, 0x10, 0x18,
+    0xDF, 0xD8, 0x10, 0x00, 0x00, 0xAE, 0x00, 0x00, 0x00, 0x0C, 0x90, 0x00,
+    0x00, 0x00, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00,
+    0xAF, 0x4F, 0x90, 0x00, 0x03, 0xF8, 0xF9, 0x00, 0x00, 0x0D, 0xCF, 0x90,
+    0x00, 0x00, 0xAE, 0xF9, 0x00, 0x00, 0x09, 0xFF, 0x90, 0x00, 0x00, 0xAE,
+    0xEB, 0x00, 0x00, 0x0D, 0xCA, 0xF2, 0x00, 0x04, 0xF8, 0x3E, 0xE7, 0x58,
+    0xED, 0x10, 0x3A, 0xEF, 0xD9, 0x20, 0x00, 0x00, 0x0A, 0xE0, 0x00, 0x00,
+    0x00, 0x0C, 0x90, 0x00, 0x00, 0x00, 0x0E, 0x30, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1F, 0x60, 0x00, 0x07, 0xF1, 0x6F, 0x10, 0x00, 0x01, 0xF6,
+    0xBC, 0x00, 0x00, 0x00, 0xDB, 0xDA, 0x00, 0x00, 0x00, 0xAD, 0xF9, 0x00,
+    0xF8, 0x00, 0x9F, 0xF9, 0x00, 0xF8, 0x00, 0x9F, 0xEA, 0x00, 0xF9, 0x00,
+    0xAE, 0xCC, 0x02, 0xFB, 0x00, 0xDB, 0x7F, 0x7B, 0xCF, 0x89, 0xF6, 0x0A,
+    0xFC, 0x26, 0xEE, 0x90, 0x00, 0xCF, 0x20, 0x00, 0x00, 0x3F, 0x70, 0x00,
+    0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFC, 0x77, 0x77, 0x77, 0xFA, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00,
+    0xFA, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x77, 0x77, 0x77,
+    0xFA, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00,
+    0xFA, 0x00, 0x00, 0x00, 0xFC, 0x77, 0x77, 0x77, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0xC6, 0x06, 0xC0, 0x00, 0xC6, 0x06, 0xC0, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x77, 0x77, 0x77, 0xFA, 0x00, 0x00, 0x00,
+    0xFA, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFC, 0x77, 0x77, 0x77, 0xFA, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00,
+    0xFA, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0xFC, 0x77, 0x77, 0x77,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x77, 0x7F, 0xC7,
+    0x77, 0x00, 0x00, 0x0F, 0xA0, 0x00, 0x00, 0x00, 0x0F, 0xA0, 0x00, 0x00,
+    0x00, 0x0F, 0xA0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x81, 0x00, 0x0F,
+    0xC7, 0x7A, 0xF8, 0x00, 0x0F, 0xA0, 0x00, 0xCD, 0x00, 0x0F, 0xA0, 0x00,
+    0xAF, 0x00, 0x0F, 0xA0, 0x00, 0xAF, 0x00, 0x0F, 0xA0, 0x00, 0xCD, 0x00,
+    0x0F, 0xA0, 0x89, 0xF8, 0x00, 0x0F, 0xA0, 0xEE, 0x91, 0x00, 0x00, 0x2F,
+    0xC0, 0x00, 0x00, 0x07, 0xF3, 0x00, 0x00, 0x00, 0xD7, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0x77, 0x77, 0x77,
+    0xFA, 0x00, 0x00, 0x00, 0x0F, 0xA0, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00,
+    0x00, 0x0F, 0xA0, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0x0F, 0xA0,
+    0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0x0F, 0xA0, 0x00, 0x00, 0x00,
+    0xFA, 0x00, 0x00, 0x00, 0x0F, 0xA0, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x29, 0xDF, 0xEC, 0x60, 0x4E, 0xFA, 0x78, 0xCA, 0x1E,
+    0xE2, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0xCE, 0x00, 0x00, 0x00,
+    0x0E, 0xFF, 0xFF, 0xFF, 0x00, 0xFD, 0x77, 0x77, 0x70, 0x0E, 0xD0, 0x00,
+    0x00, 0x00, 0xCF, 0x10, 0x00, 0x00, 0x08, 0xF6, 0x00, 0x00, 0x00, 0x2E,
+    0xE3, 0x00, 0x00, 0x00, 0x5F, 0xFA, 0x77, 0x9C, 0x00, 0x29, 0xDF, 0xED,
+    0x90, 0x03, 0xAD, 0xEE, 0xDB, 0x66, 0xFD, 0x87, 0x8A, 0xD9, 0xDD, 0x10,
+    0x00, 0x00, 0x0E, 0xB0, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x02,
+    0xDF, 0xB5, 0x10, 0x00, 0x01, 0x7D, 0xFE, 0xA2, 0x00, 0x00, 0x03, 0x9E,
+    0xF4, 0x00, 0x00, 0x00, 0x2E, 0xC0, 0x00, 0x00, 0x00, 0xAF, 0x10, 0x00,
+    0x00, 0x1E, 0xCF, 0xB8, 0x77, 0x8E, 0xF4, 0x9C, 0xEF, 0xFD, 0x93, 0x00,
+    0x3F, 0xFF, 0xFF, 0xF9, 0x14, 0x5C, 0xF5, 0x42, 0x00, 0x09, 0xF0, 0x00,
+    0x00, 0x09, 0xF0, 0x00, 0x00, 0x09, 0xF0, 0x00, 0x00, 0x09, 0xF0, 0x00,
+    0x00, 0x09, 0xF0, 0x00, 0x00, 0x09, 0xF0, 0x00, 0x00, 0x09, 0xF0, 0x00,
+    0x00, 0x09, 0xF0, 0x00, 0x00, 0x09, 0xF0, 0x00, 0x14, 0x5C, 0xF5, 0x42,
+    0x3F, 0xFF, 0xFF, 0xF9, 0x00, 0xC6, 0x06, 0xC0, 0x00, 0xC6, 0x06, 0xC0,
+    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF9, 0x14, 0x5C, 0xF5, 0x42,
+    0x00, 0x09, 0xF0, 0x00, 0x00, 0x09, 0xF0, 0x00, 0x00, 0x09, 0xF0, 0x00,
+    0x00, 0x09, 0xF0, 0x00, 0x00, 0x09, 0xF0, 0x00, 0x00, 0x09, 0xF0, 0x00,
+    0x00, 0x09, 0xF0, 0x00, 0x00, 0x09, 0xF0, 0x00, 0x00, 0x09, 0xF0, 0x00,
+    0x14, 0x5C, 0xF5, 0x42, 0x3F, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0xAF,
+    0x00, 0x00, 0x00, 0xAF, 0x00, 0x00, 0x00, 0xAF, 0x00, 0x00, 0x00, 0xAF,
+    0x00, 0x00, 0x00, 0xAF, 0x00, 0x00, 0x00, 0xAF, 0x00, 0x00, 0x00, 0xAF,
+    0x00, 0x00, 0x00, 0xAF, 0x00, 0x00, 0x00, 0xAF, 0x00, 0x00, 0x00, 0xCE,
+    0x00, 0x00, 0x04, 0xFA, 0xD9, 0x77, 0xAF, 0xD2, 0xAD, 0xFF, 0xD8, 0x10,
+    0x0F, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0xFD, 0x77, 0xFA, 0x00, 0x00, 0x0F,
+    0xA0, 0x0F, 0xA0, 0x00, 0x01, 0xFA, 0x00, 0xFA, 0x00, 0x00, 0x1F, 0x90,
+    0x0F, 0xA0, 0x00, 0x01, 0xF9, 0x00, 0xFF, 0xEC, 0x50, 0x1F, 0x80, 0x0F,
+    0xC8, 0xCF, 0x52, 0xF7, 0x00, 0xFA, 0x00, 0xDC, 0x2F, 0x70, 0x0F, 0xA0,
+    0x09, 0xE3, 0xF6, 0x00, 0xFA, 0x00, 0x9E, 0x4F, 0x40, 0x0F, 0xA0, 0x0D,
+    0xCA, 0xF2, 0x00, 0xFC, 0x7C, 0xF5, 0xE9, 0x00, 0x0F, 0xFE, 0xC5, 0x00,
+    0xFA, 0x00, 0xFA, 0x00, 0x00, 0xFA, 0x00, 0xFA, 0x00, 0x00, 0xFA, 0x00,
+    0xFA, 0x00, 0x00, 0xFA, 0x00, 0xFA, 0x00, 0x00, 0xFA, 0x00, 0xFA, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF, 0xEC, 0x50, 0xFC, 0x77, 0xFC, 0x8C, 0xF5, 0xFA,
+    0x00, 0xFA, 0x00, 0xDC, 0xFA, 0x00, 0xFA, 0x00, 0x9F, 0xFA, 0x00, 0xFA,
+    0x00, 0x9E, 0xFA, 0x00, 0xFA, 0x00, 0xDC, 0xFA, 0x00, 0xFC, 0x7C, 0xF5,
+    0xFA, 0x00, 0xFF, 0xEC, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x77, 0x7F,
+    0xC7, 0x77, 0x00, 0x00, 0x0F, 0xA0, 0x00, 0x00, 0x00, 0x0F, 0xA0, 0x00,
+    0x00, 0x00, 0x0F, 0xA0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x81, 0x00,
+    0x0F, 0xC7, 0x7B, 0xF8, 0x00, 0x0F, 0xA0, 0x00, 0xDD, 0x00, 0x0F, 0xA0,
+    0x00, 0xAF, 0x00, 0x0F, 0xA0, 0x00, 0xAF, 0x00, 0x0F, 0xA0, 0x00, 0xAF,
+    0x00, 0x0F, 0xA0, 0x00, 0xAF, 0x00, 0x0F, 0xA0, 0x00, 0xAF, 0x00, 0x00,
+    0x2F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x30, 0x00, 0x00, 0x00, 0xD7, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x2D, 0xB0, 0xFA,
+    0x00, 0x01, 0xDC, 0x10, 0xFA, 0x00, 0x1C, 0xD1, 0x00, 0xFA, 0x00, 0xBD,
+    0x20, 0x00, 0xFA, 0x0A, 0xE2, 0x00, 0x00, 0xFA, 0x9E, 0x30, 0x00, 0x00,
+    0xFC, 0xFB, 0x00, 0x00, 0x00, 0xFA, 0x6F, 0x80, 0x00, 0x00, 0xFA, 0x08,
+    0xF6, 0x00, 0x00, 0xFA, 0x00, 0xAF, 0x40, 0x00, 0xFA, 0x00, 0x1C, 0xE2,
+    0x00, 0xFA, 0x00, 0x01, 0xDD, 0x10, 0xFA, 0x00, 0x00, 0x2E, 0xC1, 0x00,
+    0x0C, 0xF2, 0x00, 0x00, 0x00, 0x3F, 0x70, 0x00, 0x00, 0x00, 0x7D, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0D, 0xFF, 0x80, 0x00,
+    0x07, 0xFF, 0xF8, 0x00, 0x01, 0xEC, 0xFF, 0x80, 0x00, 0x8D, 0x7F, 0xF8,
+    0x00, 0x2F, 0x47, 0xFF, 0x80, 0x0A, 0xB0, 0x8F, 0xF8, 0x03, 0xF3, 0x08,
+    0xFF, 0x80, 0xBA, 0x00, 0x8F, 0xF7, 0x5F, 0x20, 0x08, 0xFF, 0x7D, 0x80,
+    0x00, 0x8F, 0xFC, 0xE1, 0x00, 0x08, 0xFF, 0xF7, 0x00, 0x00, 0x8F, 0xFD,
+    0x00, 0x00, 0x08, 0xF0, 0x00, 0xE9, 0x00, 0x0A, 0xD0, 0x00, 0x09, 0xE5,
+    0x36, 0xF8, 0x00, 0x00, 0x19, 0xDF, 0xD8, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xBE, 0x10, 0x00, 0x00, 0x1E, 0xB4, 0xF8, 0x00, 0x00, 0x07,
+    0xF4, 0x0C, 0xE1, 0x00, 0x00, 0xDC, 0x00, 0x4F, 0x70, 0x00, 0x6F, 0x40,
+    0x00, 0xCE, 0x00, 0x0D, 0xC0, 0x00, 0x05, 0xF6, 0x05, 0xF5, 0x00, 0x00,
+    0x0C, 0xD0, 0xCC, 0x00, 0x00, 0x00, 0x5F, 0x9F, 0x50, 0x00, 0x00, 0x00,
+    0xDF, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xF6, 0x00, 0x00, 0x00, 0x00, 0xCE,
+    0x00, 0x00, 0x00, 0xA7, 0xBF, 0x50, 0x00, 0x00, 0x0D, 0xFD, 0x50, 0x00,
+    0x00, 0x00, 0xFA, 0x00, 0x00, 0x0A, 0xFF, 0xA0, 0x00, 0x00, 0xAF, 0xFA,
+    0x00, 0x00, 0x0A, 0xFF, 0xA0, 0x00, 0x00, 0xAF, 0xFA, 0x00, 0x00, 0x0A,
+    0xFF, 0xA0, 0x00, 0x00, 0xAF, 0xFA, 0x00, 0x00, 0x0A, 0xFF, 0xA0, 0x00,
+    0x00, 0xAF, 0xFA, 0x00, 0x00, 0x0A, 0xFF, 0xA0, 0x00, 0x00, 0xAF, 0xFA,
+    0x00, 0x00, 0x0A, 0xFF, 0xC7, 0x77, 0x77, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xF0, 0x00, 0xFA, 0x00, 0x00, 0x00, 0x0F, 0xA0, 0x00, 0x00, 0x00, 0xFA,
+    0x00, 0x00, 0x00, 0x00, 0x8F, 0x80, 0x00, 0x00, 0x00, 0x0D, 0xED, 0x00,
+    0x00, 0x00, 0x04, 0xF8, 0xF4, 0x00, 0x00, 0x00, 0x9F, 0x1F, 0x90, 0x00,
+    0x00, 0x0E, 0xB0, 0xBE, 0x00, 0x00, 0x05, 0xF6, 0x06, 0xF5, 0x00, 0x00,
+    0xAF, 0x10, 0x1F, 0xA0, 0x00, 0x1F, 0xC0, 0x00, 0xCF, 0x10, 0x06, 0xFF,
+    0xFF, 0xFF, 0xF6, 0x00, 0xBF, 0x77, 0x77, 0x7F, 0xB0, 0x2F, 0xA0, 0x00,
+    0x00, 0xAF, 0x27, 0xF4, 0x00, 0x00, 0x04, 0xF7, 0xCD, 0x00, 0x00, 0x00,
+    0x0D, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xC7, 0x77, 0x77, 0x72, 0xFA,
+    0x00, 0x00, 0x00, 0x0F, 0xA0, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00,
+    0x0F, 0xFF, 0xFF, 0xDA, 0x30, 0xFC, 0x77, 0x79, 0xEF, 0x4F, 0xA0, 0x00,
+    0x03, 0xFB, 0xFA, 0x00, 0x00, 0x0C, 0xEF, 0xA0, 0x00, 0x00, 0xCE, 0xFA,
+    0x00, 0x00, 0x3F, 0xBF, 0xC6, 0x66, 0x9E, 0xF3, 0xFF, 0xFF, 0xFE, 0xA3,
+    0x00, 0xFF, 0xFF, 0xFE, 0xC7, 0x0F, 0xC6, 0x66, 0x8C, 0xF9, 0xFA, 0x00,
+    0x00, 0x0D, 0xEF, 0xA0, 0x00, 0x00, 0xCE, 0xFA, 0x00, 0x02, 0x7F, 0x6F,
+    0xFF, 0xFF, 0xFC, 0x30, 0xFC, 0x66, 0x69, 0xEC, 0x2F, 0xA0, 0x00, 0x03,
+    0xFA, 0xFA, 0x00, 0x00, 0x0C, 0xEF, 0xA0, 0x00, 0x00, 0xCE, 0xFA, 0x00,
+    0x00, 0x3F, 0xBF, 0xC6, 0x66, 0x8E, 0xF3, 0xFF, 0xFF, 0xFE, 0xB3, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0x77, 0x77, 0x77, 0xFA, 0x00, 0x00,
+    0x00, 0x0F, 0xA0, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0x0F, 0xA0,
+    0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0x0F, 0xA0, 0x00, 0x00, 0x00,
+    0xFA, 0x00, 0x00, 0x00, 0x0F, 0xA0, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00,
+    0x00, 0x0F, 0xA0, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFC, 0x77, 0xCF, 0x00, 0x00, 0x0F,
+    0x80, 0x0A, 0xF0, 0x00, 0x00, 0xF7, 0x00, 0xAF, 0x00, 0x00, 0x2F, 0x60,
+    0x0A, 0xF0, 0x00, 0x03, 0xF4, 0x00, 0xAF, 0x00, 0x00, 0x5F, 0x30, 0x0A,
+    0xF0, 0x00, 0x07, 0xF0, 0x00, 0xAF, 0x00, 0x00, 0xBC, 0x00, 0x0A, 0xF0,
+    0x00, 0x1F, 0x80, 0x00, 0xAF, 0x00, 0x07, 0xF2, 0x00, 0x0A, 0xF0, 0x07,
+    0xEC, 0x77, 0x77, 0xCF, 0x77, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
+    0x00, 0x00, 0x00, 0x8F, 0xF8, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x80, 0x00,
+    0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x77, 0x77, 0x77, 0xFA,
+    0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFC, 0x77, 0x77, 0x77, 0xFA, 0x00, 0x00, 0x00, 0xFA,
+    0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0xFC,
+    0x77, 0x77, 0x77, 0xFF, 0xFF, 0xFF, 0xFF, 0x1E, 0x80, 0x0F, 0xA0, 0x08,
+    0xE1, 0x09, 0xE0, 0x0F, 0xA0, 0x1E, 0x70, 0x02, 0xF6, 0x0F, 0xA0, 0x8E,
+    0x10, 0x00, 0xAC, 0x0F, 0xA1, 0xE7, 0x00, 0x00, 0x4F, 0x3F, 0xA7, 0xE1,
+    0x00, 0x00, 0x0C, 0xAF, 0xAE, 0x70, 0x00, 0x00, 0x09, 0xEF, 0xEF, 0x30,
+    0x00, 0x00, 0x0E, 0x8F, 0xAD, 0xA0, 0x00, 0x00, 0x6F, 0x2F, 0xA6, 0xF2,
+    0x00, 0x00, 0xCB, 0x0F, 0xA1, 0xE9, 0x00, 0x03, 0xF5, 0x0F, 0xA0, 0x8F,
+    0x10, 0x09, 0xE0, 0x0F, 0xA0, 0x1F, 0x80, 0x1F, 0x80, 0x0F, 0xA0, 0x09,
+    0xE1, 0x16, 0xBE, 0xFE, 0xB5, 0x0A, 0xFB, 0x86, 0x7D, 0xF8, 0x13, 0x00,
+    0x00, 0x1D, 0xE0, 0x00, 0x00, 0x00, 0xDD, 0x00, 0x00, 0x14, 0xBE, 0x40,
+    0x0F, 0xFF, 0xF9, 0x10, 0x00, 0x66, 0x7A, 0xFB, 0x10, 0x00, 0x00, 0x04,
+    0xFA, 0x00, 0x00, 0x00, 0x0C, 0xE0, 0x00, 0x00, 0x00, 0xDE, 0x10, 0x00,
+    0x00, 0x4F, 0xAF, 0xB8, 0x67, 0xAF, 0xD2, 0x7C, 0xEF, 0xEC, 0x81, 0x00,
+    0xF8, 0x00, 0x00, 0x0D, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x01,
+    0xEC, 0xFF, 0x80, 0x00, 0x8D, 0x7F, 0xF8, 0x00, 0x2F, 0x47, 0xFF, 0x80,
+    0x0A, 0xB0, 0x8F, 0xF8, 0x03, 0xF3, 0x08, 0xFF, 0x80, 0xBA, 0x00, 0x8F,
+    0xF7, 0x5F, 0x20, 0x08, 0xFF, 0x7D, 0x80, 0x00, 0x8F, 0xFC, 0xE1, 0x00,
+    0x08, 0xFF, 0xF7, 0x00, 0x00, 0x8F, 0xFD, 0x00, 0x00, 0x08, 0xF0, 0x0E,
+    0x90, 0x00, 0xAD, 0x00, 0x9E, 0x53, 0x6F, 0x80, 0x01, 0x9D, 0xFD, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0D, 0xFF, 0x80, 0x00,
+    0x07, 0xFF, 0xF8, 0x00, 0x01, 0xEC, 0xFF, 0x80, 0x00, 0x8D, 0x7F, 0xF8,
+    0x00, 0x2F, 0x47, 0xFF, 0x80, 0x0A, 0xB0, 0x8F, 0xF8, 0x03, 0xF3, 0x08,
+    0xFF, 0x80, 0xBA, 0x00, 0x8F, 0xF7, 0x5F, 0x20, 0x08, 0xFF, 0x7D, 0x80,
+    0x00, 0x8F, 0xFC, 0xE1, 0x00, 0x08, 0xFF, 0xF7, 0x00, 0x00, 0x8F, 0xFD,
+    0x00, 0x00, 0x08, 0xF0, 0xFA, 0x00, 0x00, 0x2D, 0xB0, 0xFA, 0x00, 0x01,
+    0xDC, 0x10, 0xFA, 0x00, 0x1C, 0xD1, 0x00, 0xFA, 0x00, 0xBD, 0x20, 0x00,
+    0xFA, 0x0A, 0xE2, 0x00, 0x00, 0xFA, 0x9E, 0x30, 0x00, 0x00, 0xFC, 0xFB,
+    0x00, 0x00, 0x00, 0xFA, 0x6F, 0x80, 0x00, 0x00, 0xFA, 0x08, 0xF6, 0x00,
+    0x00, 0xFA, 0x00, 0xAF, 0x40, 0x00, 0xFA, 0x00, 0x1C, 0xE2, 0x00, 0xFA,
+    0x00, 0x01, 0xDD, 0x10, 0xFA, 0x00, 0x00, 0x2E, 0xC1, 0x00, 0x0F, 0xFF,
+    0xFF, 0xFF, 0x00, 0x1F, 0xC7, 0x77, 0xCF, 0x00, 0x1F, 0x90, 0x00, 0xAF,
+    0x00, 0x2F, 0x70, 0x00, 0xAF, 0x00, 0x3F, 0x60, 0x00, 0xAF, 0x00, 0x4F,
+    0x50, 0x00, 0xAF, 0x00, 0x5F, 0x30, 0x00, 0xAF, 0x00, 0x6F, 0x10, 0x00,
+    0xAF, 0x00, 0x8E, 0x00, 0x00, 0xAF, 0x00, 0xBC, 0x00, 0x00, 0xAF, 0x02,
+    0xF8, 0x00, 0x00, 0xAF, 0x7C, 0xE2, 0x00, 0x00, 0xAF, 0xDD, 0x40, 0x00,
+    0x00, 0xAF, 0xFD, 0x00, 0x00, 0x0D, 0xFF, 0xE2, 0x00, 0x02, 0xFF, 0xFC,
+    0x50, 0x00, 0x6C, 0xFF, 0xA9, 0x00, 0x09, 0xAF, 0xFA, 0xA0, 0x00, 0xAB,
+    0xFF, 0xB9, 0x20, 0x38, 0xBF, 0xFB, 0x66, 0x07, 0x5B, 0xFF, 0xB3, 0xA0,
+    0xB2, 0xBF, 0xFB, 0x0D, 0x0D, 0x0B, 0xFF, 0xB0, 0xB5, 0xA0, 0xBF, 0xFB,
+    0x08, 0xD7, 0x0B, 0xFF, 0xB0, 0x5F, 0x40, 0xBF, 0xFB, 0x02, 0xF1, 0x0B,
+    0xF0, 0xFA, 0x00, 0x00, 0x0A, 0xFF, 0xA0, 0x00, 0x00, 0xAF, 0xFA, 0x00,
+    0x00, 0x0A, 0xFF, 0xA0, 0x00, 0x00, 0xAF, 0xFA, 0x00, 0x00, 0x0A, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x77, 0x77, 0x7C, 0xFF, 0xA0, 0x00, 0x00,
+    0xAF, 0xFA, 0x00, 0x00, 0x0A, 0xFF, 0xA0, 0x00, 0x00, 0xAF, 0xFA, 0x00,
+    0x00, 0x0A, 0xFF, 0xA0, 0x00, 0x00, 0xAF, 0xFA, 0x00, 0x00, 0x0A, 0xF0,
+    0x01, 0x8D, 0xFD, 0x80, 0x00, 0xBF, 0xA7, 0xAF, 0xA0, 0x5F, 0x90, 0x00,
+    0x8F, 0x4A, 0xF2, 0x00, 0x01, 0xF9, 0xDD, 0x00, 0x00, 0x0D, 0xDE, 0xC0,
+    0x00, 0x00, 0xCE, 0xFB, 0x00, 0x00, 0x0B, 0xFE, 0xC0, 0x00, 0x00, 0xCE,
+    0xDD, 0x00, 0x00, 0x0D, 0xDA, 0xF2, 0x00, 0x02, 0xF9, 0x5F, 0x90, 0x00,
+    0x8F, 0x40, 0xBF, 0xA7, 0xAF, 0xA0, 0x01, 0x8D, 0xFD, 0x70, 0x00, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0x77, 0x77, 0xCF, 0xFA, 0x00, 0x00, 0x0A,
+    0xFF, 0xA0, 0x00, 0x00, 0xAF, 0xFA, 0x00, 0x00, 0x0A, 0xFF, 0xA0, 0x00,
+    0x00, 0xAF, 0xFA, 0x00, 0x00, 0x0A, 0xFF, 0xA0, 0x00, 0x00, 0xAF, 0xFA,
+    0x00, 0x00, 0x0A, 0xFF, 0xA0, 0x00, 0x00, 0xAF, 0xFA, 0x00, 0x00, 0x0A,
+    0xFF, 0xA0, 0x00, 0x00, 0xAF, 0xFA, 0x00, 0x00, 0x0A, 0xF0, 0xFF, 0xFF,
+    0xFD, 0xA4, 0x0F, 0xC6, 0x67, 0x9E, 0xF5, 0xFA, 0x00, 0x00, 0x3F, 0xDF,
+    0xA0, 0x00, 0x00, 0xCF, 0xFA, 0x00, 0x00, 0x0E, 0xDF, 0xA0, 0x01, 0x3B,
+    0xF6, 0xFF, 0xFF, 0xFF, 0xE6, 0x0F, 0xC6, 0x65, 0x30, 0x00, 0xFA, 0x00,
+    0x00, 0x00, 0x0F, 0xA0, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0x0F,
+    0xA0, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xDF,
+    0xEC, 0x60, 0x4E, 0xFA, 0x78, 0xCA, 0x1E, 0xE3, 0x00, 0x00, 0x07, 0xF6,
+    0x00, 0x00, 0x00, 0xCF, 0x00, 0x00, 0x00, 0x0E, 0xC0, 0x00, 0x00, 0x00,
+    0xFB, 0x00, 0x00, 0x00, 0x0E, 0xC0, 0x00, 0x00, 0x00, 0xCE, 0x00, 0x00,
+    0x00, 0x08, 0xF5, 0x00, 0x00, 0x00, 0x2E, 0xE3, 0x00, 0x00, 0x00, 0x5F,
+    0xFA, 0x77, 0x9D, 0x00, 0x29, 0xDF, 0xED, 0x90, 0x9F, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x47, 0x77, 0xCF, 0x77, 0x77, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00,
+    0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x9F,
+    0x00, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00,
+    0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00,
+    0x9F, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x00,
+    0x00, 0xBE, 0x10, 0x00, 0x00, 0x1E, 0xB4, 0xF8, 0x00, 0x00, 0x07, 0xF4,
+    0x0C, 0xE1, 0x00, 0x00, 0xDC, 0x00, 0x4F, 0x70, 0x00, 0x6F, 0x40, 0x00,
+    0xCE, 0x00, 0x0D, 0xC0, 0x00, 0x05, 0xF6, 0x05, 0xF5, 0x00, 0x00, 0x0C,
+    0xD0, 0xCC, 0x00, 0x00, 0x00, 0x5F, 0x9F, 0x50, 0x00, 0x00, 0x00, 0xDF,
+    0xD0, 0x00, 0x00, 0x00, 0x07, 0xF6, 0x00, 0x00, 0x00, 0x00, 0xCE, 0x00,
+    0x00, 0x00, 0xA7, 0xBF, 0x50, 0x00, 0x00, 0x0D, 0xFD, 0x50, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x03,
+    0xBE, 0xFF, 0xFC, 0x40, 0x2E, 0xE8, 0xCF, 0x7D, 0xF2, 0xAF, 0x30, 0x9F,
+    0x02, 0xFA, 0xEC, 0x00, 0x9F, 0x00, 0xBD, 0xFA, 0x00, 0x9F, 0x00, 0xAE,
+    0xDC, 0x00, 0x9F, 0x00, 0xCD, 0x9F, 0x30, 0x9F, 0x02, 0xF9, 0x2E, 0xE8,
+    0xCF, 0x7D, 0xE2, 0x02, 0xAE, 0xFF, 0xFC, 0x30, 0x00, 0x00, 0x9F, 0x00,
+    0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0xAE, 0x20, 0x00, 0x00, 0x2E, 0xA1,
+    0xDC, 0x00, 0x00, 0x0B, 0xD1, 0x04, 0xF7, 0x00, 0x07, 0xF3, 0x00, 0x08,
+    0xF3, 0x03, 0xF7, 0x00, 0x00, 0x0C, 0xD1, 0xCC, 0x00, 0x00, 0x00, 0x2E,
+    0xDE, 0x20, 0x00, 0x00, 0x00, 0x9F, 0x90, 0x00, 0x00, 0x00, 0x3F, 0xBF,
+    0x30, 0x00, 0x00, 0x1D, 0xB0, 0xCD, 0x10, 0x00, 0x09, 0xE2, 0x03, 0xF9,
+    0x00, 0x04, 0xF5, 0x00, 0x08, 0xF4, 0x01, 0xDA, 0x00, 0x00, 0x0C, 0xD1,
+    0xAE, 0x10, 0x00, 0x00, 0x3F, 0xA0, 0xFA, 0x00, 0x00, 0xAF, 0x00, 0xFA,
+    0x00, 0x00, 0xAF, 0x00, 0xFA, 0x00, 0x00, 0xAF, 0x00, 0xFA, 0x00, 0x00,
+    0xAF, 0x00, 0xFA, 0x00, 0x00, 0xAF, 0x00, 0xFA, 0x00, 0x00, 0xAF, 0x00,
+    0xFA, 0x00, 0x00, 0xAF, 0x00, 0xFA, 0x00, 0x00, 0xAF, 0x00, 0xFA, 0x00,
+    0x00, 0xAF, 0x00, 0xFA, 0x00, 0x00, 0xAF, 0x00, 0xFA, 0x00, 0x00, 0xAF,
+    0x00, 0xFC, 0x77, 0x77, 0xCF, 0x77, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00,
+    0x00, 0x8F, 0xFA, 0x00, 0x00, 0x0A, 0xFF, 0xA0, 0x00, 0x00, 0xAF, 0xFA,
+    0x00, 0x00, 0x0A, 0xFF, 0xA0, 0x00, 0x00, 0xAF, 0xFA, 0x00, 0x00, 0x0A,
+    0xFE, 0xC0, 0x00, 0x00, 0xAF, 0x9F, 0xB7, 0x8A, 0xEF, 0xF1, 0x8D, 0xFE,
+    0xB7, 0xBF, 0x00, 0x00, 0x00, 0x0A, 0xF0, 0x00, 0x00, 0x00, 0xAF, 0x00,
+    0x00, 0x00, 0x0A, 0xF0, 0x00, 0x00, 0x00, 0xAF, 0x00, 0x00, 0x00, 0x0A,
+    0xF0, 0xFA, 0x00, 0xFA, 0x00, 0xAF, 0xFA, 0x00, 0xFA, 0x00, 0xAF, 0xFA,
+    0x00, 0xFA, 0x00, 0xAF, 0xFA, 0x00, 0xFA, 0x00, 0xAF, 0xFA, 0x00, 0xFA,
+    0x00, 0xAF, 0xFA, 0x00, 0xFA, 0x00, 0xAF, 0xFA, 0x00, 0xFA, 0x00, 0xAF,
+    0xFA, 0x00, 0xFA, 0x00, 0xAF, 0xFA, 0x00, 0xFA, 0x00, 0xAF, 0xFA, 0x00,
+    0xFA, 0x00, 0xAF, 0xFA, 0x00, 0xFA, 0x00, 0xAF, 0xFC, 0x77, 0xFC, 0x77,
+    0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0xFA, 0x00, 0xAF, 0x0F,
+    0xA0, 0x0F, 0xA0, 0x0A, 0xF0, 0xFA, 0x00, 0xFA, 0x00, 0xAF, 0x0F, 0xA0,
+    0x0F, 0xA0, 0x0A, 0xF0, 0xFA, 0x00, 0xFA, 0x00, 0xAF, 0x0F, 0xA0, 0x0F,
+    0xA0, 0x0A, 0xF0, 0xFA, 0x00, 0xFA, 0x00, 0xAF, 0x0F, 0xA0, 0x0F, 0xA0,
+    0x0A, 0xF0, 0xFA, 0x00, 0xFA, 0x00, 0xAF, 0x0F, 0xA0, 0x0F, 0xA0, 0x0A,
+    0xF0, 0xFA, 0x00, 0xFA, 0x00, 0xAF, 0x0F, 0xC7, 0x7F, 0xC7, 0x7C, 0xF7,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x00,
+    0x00, 0x00, 0x00, 0x08, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF,
+    0xA0, 0x00, 0x00, 0x77, 0x7F, 0xA0, 0x00, 0x00, 0x00, 0x0F, 0xA0, 0x00,
+    0x00, 0x00, 0x0F, 0xA0, 0x00, 0x00, 0x00, 0x0F, 0xA0, 0x00, 0x00, 0x00,
+    0x0F, 0xFF, 0xDA, 0x20, 0x00, 0x0F, 0xC7, 0x9E, 0xE3, 0x00, 0x0F, 0xA0,
+    0x03, 0xFB, 0x00, 0x0F, 0xA0, 0x00, 0xCE, 0x00, 0x0F, 0xA0, 0x00, 0xCE,
+    0x00, 0x0F, 0xA0, 0x03, 0xFB, 0x00, 0x0F, 0xC6, 0x8E, 0xF3, 0x00, 0x0F,
+    0xFF, 0xEA, 0x30, 0xFA, 0x00, 0x00, 0x08, 0xFF, 0xA0, 0x00, 0x00, 0x8F,
+    0xFA, 0x00, 0x00, 0x08, 0xFF, 0xA0, 0x00, 0x00, 0x8F, 0xFA, 0x00, 0x00,
+    0x08, 0xFF, 0xFE, 0xC5, 0x00, 0x8F, 0xFC, 0x8C, 0xF5, 0x08, 0xFF, 0xA0,
+    0x0D, 0xC0, 0x8F, 0xFA, 0x00, 0x9E, 0x08, 0xFF, 0xA0, 0x09, 0xE0, 0x8F,
+    0xFA, 0x00, 0xDC, 0x08, 0xFF, 0xC7, 0xCF, 0x50, 0x8F, 0xFF, 0xEC, 0x50,
+    0x08, 0xF0, 0xFA, 0x00, 0x00, 0x00, 0x0F, 0xA0, 0x00, 0x00, 0x00, 0xFA,
+    0x00, 0x00, 0x00, 0x0F, 0xA0, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00,
+    0x0F, 0xFF, 0xFE, 0xC8, 0x20, 0xFC, 0x77, 0x8A, 0xFE, 0x3F, 0xA0, 0x00,
+    0x04, 0xFB, 0xFA, 0x00, 0x00, 0x0C, 0xEF, 0xA0, 0x00, 0x00, 0xDE, 0xFA,
+    0x00, 0x00, 0x4F, 0xBF, 0xC6, 0x67, 0xAF, 0xE3, 0xFF, 0xFF, 0xFD, 0x92,
+    0x00, 0x07, 0xCE, 0xFD, 0x92, 0x00, 0x0B, 0xC8, 0x7A, 0xFE, 0x40, 0x00,
+    0x00, 0x00, 0x2D, 0xE2, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00,
+    0x00, 0xDC, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x07, 0x77, 0x77, 0xDF,
+    0x00, 0x00, 0x00, 0x00, 0xDE, 0x00, 0x00, 0x00, 0x01, 0xFB, 0x00, 0x00,
+    0x00, 0x06, 0xF7, 0x00, 0x00, 0x00, 0x3E, 0xE1, 0x0C, 0x97, 0x7A, 0xFE,
+    0x40, 0x09, 0xDE, 0xFD, 0x92, 0x00, 0xFA, 0x00, 0x7E, 0xE7, 0x0F, 0xA0,
+    0x4F, 0xAA, 0xF3, 0xFA, 0x09, 0xD0, 0x0D, 0x9F, 0xA0, 0xCA, 0x00, 0xAC,
+    0xFA, 0x0E, 0x90, 0x09, 0xEF, 0xFF, 0xF8, 0x00, 0x8F, 0xFC, 0x7F, 0x80,
+    0x08, 0xFF, 0xA0, 0xE8, 0x00, 0x8F, 0xFA, 0x0D, 0x90, 0x09, 0xEF, 0xA0,
+    0xBA, 0x00, 0xAC, 0xFA, 0x08, 0xD0, 0x0D, 0x9F, 0xA0, 0x3F, 0xAA, 0xF3,
+    0xFA, 0x00, 0x6E, 0xE7, 0x00, 0x00, 0x04, 0xAD, 0xFF, 0xFF, 0xF0, 0x05,
+    0xFE, 0x97, 0x66, 0xCF, 0x00, 0xDE, 0x20, 0x00, 0x0A, 0xF0, 0x0F, 0xC0,
+    0x00, 0x00, 0xAF, 0x00, 0xCE, 0x10, 0x00, 0x0A, 0xF0, 0x05, 0xFC, 0x41,
+    0x00, 0xAF, 0x00, 0x04, 0xCF, 0xFF, 0xFF, 0xF0, 0x00, 0x07, 0xFB, 0x66,
+    0xCF, 0x00, 0x03, 0xFD, 0x10, 0x0A, 0xF0, 0x00, 0xCF, 0x30, 0x00, 0xAF,
+    0x00, 0x8F, 0x70, 0x00, 0x0A, 0xF0, 0x3F, 0xB0, 0x00, 0x00, 0xAF, 0x1D,
+    0xE2, 0x00, 0x00, 0x0A, 0xF0, 0x17, 0xCE, 0xFD, 0x81, 0x1D, 0x96, 0x6A,
+    0xF8, 0x00, 0x00, 0x00, 0xCD, 0x00, 0x00, 0x00, 0x9F, 0x04, 0xAD, 0xEF,
+    0xFF, 0x7F, 0xB5, 0x32, 0xAF, 0xEC, 0x00, 0x00, 0xAF, 0xEB, 0x00, 0x01,
+    0xEF, 0xAF, 0x74, 0x6D, 0xCF, 0x19, 0xEF, 0xC6, 0x4F, 0x00, 0x00, 0x47,
+    0x9C, 0xA0, 0x08, 0xEF, 0xFC, 0xA6, 0x09, 0xF9, 0x30, 0x00, 0x03, 0xF8,
+    0x00, 0x00, 0x00, 0x9F, 0x10, 0x00, 0x00, 0x0C, 0xC3, 0xBE, 0xEB, 0x40,
+    0xED, 0xEA, 0x67, 0xDF, 0x3F, 0xF5, 0x00, 0x02, 0xFB, 0xFA, 0x00, 0x00,
+    0x0B, 0xED, 0xB0, 0x00, 0x00, 0xAF, 0xAE, 0x00, 0x00, 0x0C, 0xD5, 0xF6,
+    0x00, 0x02, 0xF9, 0x0B, 0xF8, 0x57, 0xED, 0x10, 0x08, 0xDF, 0xD9, 0x10,
+    0xFF, 0xFF, 0xFE, 0xD9, 0x1F, 0xB5, 0x55, 0x58, 0xFB, 0xF9, 0x00, 0x00,
+    0x09, 0xEF, 0x90, 0x00, 0x13, 0xDA, 0xFF, 0xFF, 0xFF, 0xE7, 0x0F, 0xB5,
+    0x55, 0x69, 0xF6, 0xF9, 0x00, 0x00, 0x0A, 0xEF, 0x90, 0x00, 0x00, 0xBE,
+    0xFB, 0x55, 0x56, 0xAF, 0x9F, 0xFF, 0xFF, 0xEC, 0x70, 0xFF, 0xFF, 0xFF,
+    0xFB, 0x55, 0x55, 0xF9, 0x00, 0x00, 0xF9, 0x00, 0x00, 0xF9, 0x00, 0x00,
+    0xF9, 0x00, 0x00, 0xF9, 0x00, 0x00, 0xF9, 0x00, 0x00, 0xF9, 0x00, 0x00,
+    0xF9, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0x84, 0x4A,
+    0xF0, 0x00, 0x2F, 0x40, 0x09, 0xF0, 0x00, 0x5F, 0x20, 0x09, 0xF0, 0x00,
+    0x7E, 0x00, 0x09, 0xF0, 0x00, 0xBB, 0x00, 0x09, 0xF0, 0x01, 0xF6, 0x00,
+    0x09, 0xF0, 0x07, 0xE1, 0x00, 0x09, 0xF0, 0x5D, 0xB5, 0x55, 0x5B, 0xF5,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x8F, 0xF9, 0x00,
+    0x00, 0x00, 0x8F, 0xF9, 0x00, 0x00, 0x00, 0x8F, 0x01, 0x8D, 0xFE, 0xA2,
+    0x00, 0xCE, 0x86, 0x7D, 0xE2, 0x7F, 0x30, 0x00, 0x1E, 0xAC, 0xC0, 0x00,
+    0x00, 0xBE, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC5, 0x55, 0x55, 0x55, 0xCD,
+    0x00, 0x00, 0x00, 0x07, 0xF5, 0x00, 0x00, 0x00, 0x0B, 0xF9, 0x66, 0x7B,
+    0x70, 0x07, 0xCE, 0xED, 0xA3, 0x1E, 0xA0, 0x0F, 0x90, 0x0A, 0xD1, 0x06,
+    0xF3, 0x0F, 0x90, 0x5F, 0x40, 0x00, 0xCB, 0x0F, 0x91, 0xD9, 0x00, 0x00,
+    0x4F, 0x4F, 0x98, 0xE1, 0x00, 0x00, 0x0A, 0xCF, 0xCF, 0x50, 0x00, 0x00,
+    0x0C, 0xBF, 0xBE, 0x70, 0x00, 0x00, 0x5F, 0x3F, 0x97, 0xE2, 0x00, 0x00,
+    0xDB, 0x0F, 0x90, 0xDB, 0x00, 0x07, 0xF3, 0x0F, 0x90, 0x5F, 0x50, 0x1E,
+    0xB0, 0x0F, 0x90, 0x0B, 0xD1, 0x7C, 0xEF, 0xD9, 0x19, 0xA6, 0x58, 0xFB,
+    0x00, 0x00, 0x09, 0xE0, 0x00, 0x13, 0xDB, 0x00, 0xFF, 0xFC, 0x10, 0x05,
+    0x69, 0xF8, 0x00, 0x00, 0x0A, 0xE0, 0x00, 0x00, 0xAE, 0xD8, 0x66, 0x9F,
+    0x99, 0xDE, 0xEC, 0x70, 0xF8, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x0A, 0xEF,
+    0xF8, 0x00, 0x4E, 0x9F, 0xF8, 0x00, 0xC7, 0x8F, 0xF8, 0x06, 0xD0, 0x8F,
+    0xF8, 0x1D, 0x50, 0x8F, 0xF8, 0x7C, 0x00, 0x8F, 0xF9, 0xE3, 0x00, 0x8F,
+    0xFE, 0xA0, 0x00, 0x8F, 0xFF, 0x20, 0x00, 0x8F, 0x0E, 0x90, 0x00, 0xAD,
+    0x09, 0xE5, 0x36, 0xF8, 0x01, 0x9D, 0xFD, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0xF8, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x0A, 0xEF, 0xF8, 0x00, 0x4E, 0x9F,
+    0xF8, 0x00, 0xC7, 0x8F, 0xF8, 0x06, 0xD0, 0x8F, 0xF8, 0x1D, 0x50, 0x8F,
+    0xF8, 0x7C, 0x00, 0x8F, 0xF9, 0xE3, 0x00, 0x8F, 0xFE, 0xA0, 0x00, 0x8F,
+    0xFF, 0x20, 0x00, 0x8F, 0xF9, 0x00, 0x00, 0x7F, 0x6F, 0x90, 0x00, 0x9E,
+    0x40, 0xF9, 0x01, 0xBD, 0x20, 0x0F, 0x91, 0xCB, 0x10, 0x00, 0xFB, 0xD9,
+    0x00, 0x00, 0x0F, 0xAB, 0xD2, 0x00, 0x00, 0xF9, 0x0B, 0xE3, 0x00, 0x0F,
+    0x90, 0x0A, 0xE4, 0x00, 0xF9, 0x00, 0x09, 0xF5, 0x0F, 0x90, 0x00, 0x08,
+    0xF7, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xB5, 0x55, 0xBF, 0x01, 0xF9,
+    0x00, 0x09, 0xF0, 0x2F, 0x90, 0x00, 0x9F, 0x03, 0xF8, 0x00, 0x09, 0xF0,
+    0x4F, 0x70, 0x00, 0x9F, 0x06, 0xF4, 0x00, 0x09, 0xF0, 0x9E, 0x10, 0x00,
+    0x9F, 0x4E, 0x80, 0x00, 0x09, 0xFF, 0xB1, 0x00, 0x00, 0x9F, 0xFE, 0x10,
+    0x00, 0x0E, 0xFF, 0xF5, 0x00, 0x05, 0xFF, 0xFC, 0xA0, 0x00, 0xAC, 0xFF,
+    0x9E, 0x10, 0x0E, 0x9F, 0xF8, 0xB5, 0x05, 0xB8, 0xFF, 0x86, 0xA0, 0xA6,
+    0x8F, 0xF8, 0x1E, 0x1E, 0x18, 0xFF, 0x80, 0xB7, 0xC0, 0x8F, 0xF8, 0x07,
+    0xE7, 0x08, 0xFF, 0x80, 0x2F, 0x20, 0x8F, 0xF9, 0x00, 0x00, 0x9F, 0xF9,
+    0x00, 0x00, 0x9F, 0xF9, 0x00, 0x00, 0x9F, 0xF9, 0x00, 0x00, 0x9F, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFB, 0x55, 0x55, 0xBF, 0xF9, 0x00, 0x00, 0x9F, 0xF9,
+    0x00, 0x00, 0x9F, 0xF9, 0x00, 0x00, 0x9F, 0xF9, 0x00, 0x00, 0x9F, 0x01,
+    0x8D, 0xFD, 0x81, 0x01, 0xCE, 0x86, 0x8E, 0xC0, 0x8F, 0x40, 0x00, 0x4F,
+    0x7D, 0xD0, 0x00, 0x00, 0xDC, 0xFB, 0x00, 0x00, 0x0B, 0xEF, 0xB0, 0x00,
+    0x00, 0xBE, 0xCD, 0x00, 0x00, 0x0D, 0xC7, 0xF4, 0x00, 0x04, 0xF7, 0x0C,
+    0xE8, 0x68, 0xEC, 0x10, 0x18, 0xDF, 0xD8, 0x10, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFB, 0x55, 0x55, 0xBF, 0xF9, 0x00, 0x00, 0x9F, 0xF9, 0x00, 0x00, 0x9F,
+    0xF9, 0x00, 0x00, 0x9F, 0xF9, 0x00, 0x00, 0x9F, 0xF9, 0x00, 0x00, 0x9F,
+    0xF9, 0x00, 0x00, 0x9F, 0xF9, 0x00, 0x00, 0x9F, 0xF9, 0x00, 0x00, 0x9F,
+    0xF8, 0x4C, 0xEE, 0xA2, 0x0F, 0xDD, 0x76, 0x8E, 0xE1, 0xFF, 0x20, 0x00,
+    0x4F, 0x8F, 0xB0, 0x00, 0x00, 0xDD, 0xF9, 0x00, 0x00, 0x0B, 0xFF, 0x90,
+    0x00, 0x00, 0xBE, 0xFB, 0x00, 0x00, 0x0D, 0xDF, 0xF2, 0x00, 0x04, 0xF8,
+    0xFD, 0xE8, 0x68, 0xED, 0x1F, 0x85, 0xCF, 0xEA, 0x20, 0xF9, 0x00, 0x00,
+    0x00, 0x0F, 0x90, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x0F, 0x90,
+    0x00, 0x00, 0x00, 0x02, 0xAE, 0xFD, 0x91, 0xDE, 0x86, 0x88, 0x8F, 0x40,
+    0x00, 0x0D, 0xD0, 0x00, 0x00, 0xFB, 0x00, 0x00, 0x0F, 0xB0, 0x00, 0x00,
+    0xDD, 0x00, 0x00, 0x09, 0xF4, 0x00, 0x00, 0x1E, 0xE8, 0x57, 0xB0, 0x2A,
+    0xEF, 0xDA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0xFB, 0x55, 0x55,
+    0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x00,
+    0xF9, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x00,
+    0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00,
+    0x00, 0xF9, 0x00, 0x00, 0xCD, 0x00, 0x00, 0x0C, 0xC7, 0xF3, 0x00, 0x03,
+    0xF7, 0x1F, 0x80, 0x00, 0x8F, 0x10, 0xAE, 0x00, 0x0D, 0xA0, 0x05, 0xF4,
+    0x03, 0xF5, 0x00, 0x0E, 0xA0, 0x8E, 0x00, 0x00, 0x8E, 0x1D, 0x80, 0x00,
+    0x02, 0xF7, 0xF3, 0x00, 0x00, 0x0C, 0xEC, 0x00, 0x00, 0x00, 0x6F, 0x70,
+    0x00, 0x00, 0x06, 0xF1, 0x00, 0x00, 0x00, 0xDA, 0x00, 0x00, 0x66, 0xBE,
+    0x20, 0x00, 0x0E, 0xFC, 0x40, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
+    0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00,
+    0xF8, 0x00, 0x00, 0x02, 0x9E, 0xFF, 0xC7, 0x10, 0x2E, 0xE7, 0xFB, 0x9F,
+    0xC1, 0x9F, 0x30, 0xF8, 0x04, 0xF8, 0xDB, 0x00, 0xF8, 0x00, 0xCD, 0xF9,
+    0x00, 0xF8, 0x00, 0x9F, 0xF9, 0x00, 0xF8, 0x00, 0x9F, 0xDB, 0x00, 0xF8,
+    0x00, 0xCD, 0x9F, 0x30, 0xF8, 0x04, 0xF8, 0x1E, 0xE7, 0xFB, 0x9F, 0xD1,
+    0x02, 0x9E, 0xFF, 0xD8, 0x10, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00,
+    0xF8, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00,
+    0x00, 0x7F, 0x50, 0x00, 0x4F, 0x70, 0xBD, 0x10, 0x1D, 0xC0, 0x02, 0xE9,
+    0x08, 0xE2, 0x00, 0x05, 0xF6, 0xF6, 0x00, 0x00, 0x0A, 0xFA, 0x00, 0x00,
+    0x00, 0xCF, 0xC0, 0x00, 0x00, 0x8E, 0x3E, 0x80, 0x00, 0x4F, 0x60, 0x6F,
+    0x40, 0x1D, 0xC0, 0x00, 0xBD, 0x1A, 0xF2, 0x00, 0x02, 0xFA, 0xF9, 0x00,
+    0x00, 0x9F, 0x0F, 0x90, 0x00, 0x09, 0xF0, 0xF9, 0x00, 0x00, 0x9F, 0x0F,
+    0x90, 0x00, 0x09, 0xF0, 0xF9, 0x00, 0x00, 0x9F, 0x0F, 0x90, 0x00, 0x09,
+    0xF0, 0xF9, 0x00, 0x00, 0x9F, 0x0F, 0x90, 0x00, 0x09, 0xF0, 0xFB, 0x55,
+    0x55, 0xBF, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x09, 0xF0,
+    0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x09, 0xF0, 0xF9, 0x00, 0x00,
+    0x9F, 0xF9, 0x00, 0x00, 0x9F, 0xF9, 0x00, 0x00, 0x9F, 0xF9, 0x00, 0x00,
+    0x9F, 0xEA, 0x00, 0x00, 0xAF, 0x9F, 0x85, 0x7D, 0xFF, 0x19, 0xEE, 0xC6,
+    0x9F, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00,
+    0x9F, 0xF8, 0x00, 0xF8, 0x00, 0x8F, 0xF8, 0x00, 0xF8, 0x00, 0x8F, 0xF8,
+    0x00, 0xF8, 0x00, 0x8F, 0xF8, 0x00, 0xF8, 0x00, 0x8F, 0xF8, 0x00, 0xF8,
+    0x00, 0x8F, 0xF8, 0x00, 0xF8, 0x00, 0x8F, 0xF8, 0x00, 0xF8, 0x00, 0x8F,
+    0xF8, 0x00, 0xF8, 0x00, 0x8F, 0xFB, 0x55, 0xFB, 0x55, 0xBF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xF8, 0x00, 0x8F, 0x0F, 0x80, 0x0F, 0x80,
+    0x08, 0xF0, 0xF8, 0x00, 0xF8, 0x00, 0x8F, 0x0F, 0x80, 0x0F, 0x80, 0x08,
+    0xF0, 0xF8, 0x00, 0xF8, 0x00, 0x8F, 0x0F, 0x80, 0x0F, 0x80, 0x08, 0xF0,
+    0xF8, 0x00, 0xF8, 0x00, 0x8F, 0x0F, 0x80, 0x0F, 0x80, 0x08, 0xF0, 0xFB,
+    0x55, 0xFB, 0x55, 0xBF, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00,
+    0x00, 0x08, 0xF0, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x55, 0x5F, 0x90, 0x00,
+    0x00, 0x00, 0x0F, 0x90, 0x00, 0x00, 0x00, 0x0F, 0x90, 0x00, 0x00, 0x00,
+    0x0F, 0xFF, 0xED, 0x70, 0x00, 0x0F, 0xB5, 0x69, 0xF9, 0x00, 0x0F, 0x90,
+    0x00, 0xAE, 0x00, 0x0F, 0x90, 0x00, 0xAD, 0x00, 0x0F, 0xB5, 0x69, 0xF8,
+    0x00, 0x0F, 0xFF, 0xED, 0x70, 0xF8, 0x00, 0x00, 0x08, 0xFF, 0x80, 0x00,
+    0x00, 0x8F, 0xF8, 0x00, 0x00, 0x08, 0xFF, 0x80, 0x00, 0x00, 0x8F, 0xFF,
+    0xFD, 0x91, 0x08, 0xFF, 0xB5, 0x8F, 0xA0, 0x8F, 0xF8, 0x00, 0xAE, 0x08,
+    0xFF, 0x80, 0x0A, 0xE0, 0x8F, 0xFB, 0x58, 0xF9, 0x08, 0xFF, 0xFF, 0xD8,
+    0x10, 0x8F, 0xF9, 0x00, 0x00, 0x00, 0x0F, 0x90, 0x00, 0x00, 0x00, 0xF9,
+    0x00, 0x00, 0x00, 0x0F, 0x90, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0xC7,
+    0x0F, 0xB5, 0x55, 0x6A, 0xF9, 0xF9, 0x00, 0x00, 0x0A, 0xEF, 0x90, 0x00,
+    0x00, 0xBE, 0xFB, 0x55, 0x56, 0xAF, 0x8F, 0xFF, 0xFF, 0xEC, 0x70, 0x9D,
+    0xFE, 0xA2, 0x09, 0x85, 0x8E, 0xE1, 0x00, 0x00, 0x3F, 0x90, 0x00, 0x00,
+    0xCD, 0x0F, 0xFF, 0xFF, 0xF0, 0x55, 0x55, 0xCF, 0x00, 0x00, 0x0D, 0xD0,
+    0x00, 0x04, 0xF8, 0xB7, 0x58, 0xED, 0x1A, 0xDF, 0xE9, 0x20, 0xF8, 0x00,
+    0x7D, 0xE7, 0x0F, 0x80, 0x5F, 0x88, 0xF4, 0xF8, 0x0B, 0xC0, 0x0C, 0xAF,
+    0x80, 0xE9, 0x00, 0xAD, 0xFF, 0xFF, 0x90, 0x09, 0xFF, 0xB5, 0xF9, 0x00,
+    0x9F, 0xF8, 0x0D, 0xA0, 0x0A, 0xEF, 0x80, 0xAC, 0x00, 0xCB, 0xF8, 0x05,
+    0xF8, 0x8F, 0x5F, 0x80, 0x07, 0xEE, 0x80, 0x00, 0x7D, 0xFF, 0xFF, 0xF0,
+    0x8F, 0x95, 0x55, 0xBF, 0x0E, 0xB0, 0x00, 0x09, 0xF0, 0xEA, 0x00, 0x00,
+    0x9F, 0x0A, 0xF5, 0x10, 0x09, 0xF0, 0x1A, 0xFF, 0xFF, 0xFF, 0x00, 0x1E,
+    0xA5, 0x5B, 0xF0, 0x09, 0xE1, 0x00, 0x9F, 0x04, 0xF6, 0x00, 0x09, 0xF1,
+    0xDC, 0x00, 0x00, 0x9F, 0x00, 0x0C, 0xF2, 0x00, 0x00, 0x00, 0x3F, 0x70,
+    0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x8D,
+    0xFE, 0xA2, 0x00, 0xCE, 0x86, 0x7D, 0xE2, 0x7F, 0x30, 0x00, 0x1E, 0xAC,
+    0xC0, 0x00, 0x00, 0xBE, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC5, 0x55, 0x55,
+    0x55, 0xCD, 0x00, 0x00, 0x00, 0x07, 0xF5, 0x00, 0x00, 0x00, 0x0B, 0xF9,
+    0x66, 0x7B, 0x70, 0x07, 0xCE, 0xED, 0xA3, 0x00, 0xC6, 0x06, 0xC0, 0x00,
+    0x0C, 0x60, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xDF, 0xEA,
+    0x20, 0x0C, 0xE8, 0x67, 0xDE, 0x27, 0xF3, 0x00, 0x01, 0xEA, 0xCC, 0x00,
+    0x00, 0x0B, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x55, 0x55, 0x55, 0x5C,
+    0xD0, 0x00, 0x00, 0x00, 0x7F, 0x50, 0x00, 0x00, 0x00, 0xBF, 0x96, 0x67,
+    0xB7, 0x00, 0x7C, 0xEE, 0xDA, 0x30, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x00,
+    0xF9, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xE0, 0x00, 0x12, 0xFA, 0x22,
+    0x20, 0x00, 0x00, 0xF9, 0x6D, 0xFD, 0x80, 0x00, 0xFD, 0xE7, 0x6A, 0xF7,
+    0x00, 0xFF, 0x20, 0x00, 0xDD, 0x00, 0xFB, 0x00, 0x00, 0x9F, 0x00, 0xF9,
+    0x00, 0x00, 0x9F, 0x00, 0xF9, 0x00, 0x00, 0x9F, 0x00, 0xF9, 0x00, 0x00,
+    0x9F, 0x00, 0xF9, 0x00, 0x00, 0x9F, 0x00, 0xF9, 0x00, 0x00, 0x9F, 0x00,
+    0xF9, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00,
+    0x00, 0x9E, 0x00, 0x00, 0x00, 0x21, 0xDB, 0x00, 0x00, 0x00, 0xEE, 0xB2,
+    0x00, 0x2F, 0xC0, 0x00, 0x7F, 0x30, 0x00, 0xD7, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFB, 0x55, 0x55, 0xF9, 0x00, 0x00, 0xF9, 0x00, 0x00,
+    0xF9, 0x00, 0x00, 0xF9, 0x00, 0x00, 0xF9, 0x00, 0x00, 0xF9, 0x00, 0x00,
+    0xF9, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x02, 0x9D, 0xFE, 0xA1, 0x1D, 0xE8,
+    0x67, 0xA0, 0x8F, 0x30, 0x00, 0x00, 0xDC, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0xFF, 0x00, 0xFC, 0x55, 0x55, 0x00, 0xDD, 0x00, 0x00, 0x00, 0x9F, 0x40,
+    0x00, 0x00, 0x1E, 0xE8, 0x57, 0xB0, 0x02, 0x9E, 0xFD, 0xA0, 0x18, 0xDF,
+    0xEC, 0x7A, 0xE7, 0x56, 0xA9, 0xE9, 0x00, 0x00, 0x0C, 0xE6, 0x00, 0x00,
+    0x2B, 0xFE, 0x82, 0x00, 0x04, 0xAF, 0xE4, 0x00, 0x00, 0x2D, 0xD0, 0x00,
+    0x00, 0xAE, 0xD8, 0x65, 0x8F, 0x99, 0xDF, 0xED, 0x70, 0x00, 0x00, 0xD8,
+    0x00, 0x00, 0x00, 0x0D, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0xFF, 0xF9, 0x00, 0x00, 0x02, 0x3F, 0x90, 0x00,
+    0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x0F, 0x90, 0x00, 0x00, 0x00, 0xF9,
+    0x00, 0x00, 0x00, 0x0F, 0x90, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00,
+    0x0F, 0x90, 0x00, 0x02, 0x23, 0xFA, 0x32, 0x10, 0xFF, 0xFF, 0xFF, 0xFA,
+    0x00, 0xC6, 0x06, 0xC0, 0x00, 0x0C, 0x60, 0x6C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x5F, 0xFF, 0x90, 0x00, 0x00, 0x23, 0xF9, 0x00, 0x00, 0x00,
+    0x0F, 0x90, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x0F, 0x90, 0x00,
+    0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x0F, 0x90, 0x00, 0x00, 0x00, 0xF9,
+    0x00, 0x00, 0x22, 0x3F, 0xA3, 0x21, 0x0F, 0xFF, 0xFF, 0xFF, 0xA0, 0x00,
+    0x00, 0xAB, 0x00, 0x00, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
+    0xFF, 0xFF, 0x01, 0x23, 0xAF, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x9F, 0x00,
+    0x00, 0x9F, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x9F, 0x00,
+    0x00, 0x9F, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x9F, 0x00, 0x00, 0xBD, 0x86,
+    0x5A, 0xF7, 0xCE, 0xFD, 0x70, 0x00, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x0F,
+    0x85, 0xF9, 0x00, 0x00, 0x00, 0xF4, 0x0F, 0x90, 0x00, 0x00, 0x0F, 0x30,
+    0xF9, 0x00, 0x00, 0x01, 0xF3, 0x0F, 0xFE, 0xD8, 0x10, 0x2F, 0x20, 0xFB,
+    0x69, 0xF9, 0x03, 0xF0, 0x0F, 0x90, 0x0A, 0xE0, 0x6D, 0x00, 0xF9, 0x00,
+    0xAD, 0x3C, 0x90, 0x0F, 0xB6, 0x9F, 0x8F, 0xD2, 0x00, 0xFF, 0xEC, 0x70,
+    0xF8, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00,
+    0xF8, 0x00, 0x00, 0xF8, 0x00, 0xF9, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFD,
+    0x81, 0xFB, 0x55, 0xFA, 0x58, 0xF9, 0xF8, 0x00, 0xF8, 0x00, 0xAE, 0xF8,
+    0x00, 0xF8, 0x00, 0xAD, 0xF8, 0x00, 0xFB, 0x69, 0xF8, 0xF8, 0x00, 0xFF,
+    0xEC, 0x70, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00,
+    0x6F, 0xFF, 0xFF, 0xF4, 0x00, 0x12, 0xFA, 0x22, 0x21, 0x00, 0x00, 0xF9,
+    0x6D, 0xFD, 0x80, 0x00, 0xFD, 0xE7, 0x6A, 0xF8, 0x00, 0xFF, 0x20, 0x00,
+    0xDD, 0x00, 0xFB, 0x00, 0x00, 0x9F, 0x00, 0xF9, 0x00, 0x00, 0x9F, 0x00,
+    0xF9, 0x00, 0x00, 0x9F, 0x00, 0xF9, 0x00, 0x00, 0x9F, 0x00, 0xF9, 0x00,
+    0x00, 0x9F, 0x00, 0xF9, 0x00, 0x00, 0x9F, 0x00, 0xF9, 0x00, 0x00, 0x9F,
+    0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x30, 0x00, 0x00, 0x0D, 0x70,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x05, 0xF7, 0x0F, 0x80,
+    0x04, 0xF7, 0x00, 0xF8, 0x03, 0xE7, 0x00, 0x0F, 0x82, 0xE7, 0x00, 0x00,
+    0xF8, 0xC9, 0x00, 0x00, 0x0F, 0xEE, 0xE2, 0x00, 0x00, 0xFB, 0x09, 0xE2,
+    0x00, 0x0F, 0x80, 0x0A, 0xD2, 0x00, 0xF8, 0x00, 0x0B, 0xD2, 0x0F, 0x80,
+    0x00, 0x1C, 0xD2, 0x00, 0xCF, 0x20, 0x00, 0x00, 0x3F, 0x70, 0x00, 0x00,
+    0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x02, 0xFF, 0xF8,
+    0x00, 0x0A, 0xEF, 0xF8, 0x00, 0x4E, 0x9F, 0xF8, 0x00, 0xC7, 0x8F, 0xF8,
+    0x06, 0xD0, 0x8F, 0xF8, 0x1D, 0x50, 0x8F, 0xF8, 0x7C, 0x00, 0x8F, 0xF9,
+    0xE3, 0x00, 0x8F, 0xFE, 0xA0, 0x00, 0x8F, 0xFF, 0x20, 0x00, 0x8F, 0x0E,
+    0x90, 0x00, 0xAD, 0x00, 0x9E, 0x53, 0x6F, 0x80, 0x01, 0x9D, 0xFD, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xCD, 0x00, 0x00, 0x0C, 0xC7, 0xF3, 0x00,
+    0x03, 0xF7, 0x1F, 0x80, 0x00, 0x8F, 0x10, 0xAE, 0x00, 0x0D, 0xA0, 0x05,
+    0xF4, 0x03, 0xF5, 0x00, 0x0E, 0xA0, 0x8E, 0x00, 0x00, 0x8E, 0x1D, 0x80,
+    0x00, 0x02, 0xF7, 0xF3, 0x00, 0x00, 0x0C, 0xEC, 0x00, 0x00, 0x00, 0x6F,
+    0x70, 0x00, 0x00, 0x06, 0xF1, 0x00, 0x00, 0x00, 0xDA, 0x00, 0x00, 0x66,
+    0xBE, 0x20, 0x00, 0x0E, 0xFC, 0x40, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x9F,
+    0xF9, 0x00, 0x00, 0x9F, 0xF9, 0x00, 0x00, 0x9F, 0xF9, 0x00, 0x00, 0x9F,
+    0xF9, 0x00, 0x00, 0x9F, 0xF9, 0x00, 0x00, 0x9F, 0xF9, 0x00, 0x00, 0x9F,
+    0xF9, 0x00, 0x00, 0x9F, 0xFB, 0x55, 0x55, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x0F, 0x90, 0x00, 0x00, 0x0F, 0x90, 0x00, 0x00, 0x0F, 0x90, 0x00,
+};
+
+constexpr BitmapFont NotoMono18 = {NotoMono18Glyphs, 491, NotoMono18Bitmaps,
+                                18, 14, 4};
+}  // namespace fonts
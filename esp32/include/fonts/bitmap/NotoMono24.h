@@ -0,0 +1,5002 @@
+#pragma once
+
+// Generated by fonts/font_pipeline.py from include/fonts/NotoMono18pt.h,
+// do not edit
+
+#include "fonts/bitmap_font.h"
+
+namespace fonts {
+constexpr Glyph NotoMono24Glyphs[] = {
+    {0, 0x0020, 0, 0, 15, 0, 0},
+    {0, 0x0021, 4, 18, 15, 5, 17},
+    {36, 0x0022, 10, 6, 15, 3, 17},
+    {66, 0x0023, 15, 18, 15, 0, 17},
+    {201, 0x0024, 12, 20, 15, 1, 19},
+    {321, 0x0025, 15, 18, 15, 0, 17},
+    {456, 0x0026, 14, 18, 15, 1, 17},
+    {582, 0x0027, 4, 6, 15, 5, 17},
+    {594, 0x0028, 7, 22, 15, 4, 17},
+    {671, 0x0029, 7, 22, 15, 4, 17},
+    {748, 0x002A, 12, 11, 15, 1, 19},
+    {814, 0x002B, 12, 12, 15, 1, 15},
+    {886, 0x002C, 4, 6, 15, 5, 3},
+    {898, 0x002D, 7, 3, 15, 4, 8},
+    {909, 0x002E, 3, 3, 15, 5, 3},
+    {914, 0x002F, 10, 18, 15, 3, 17},
+    {1004, 0x0030, 12, 18, 15, 1, 17},
+    {1112, 0x0031, 7, 18, 15, 3, 17},
+    {1175, 0x0032, 12, 18, 15, 1, 17},
+    {1283, 0x0033, 12, 18, 15, 1, 17},
+    {1391, 0x0034, 14, 18, 15, 1, 17},
+    {1517, 0x0035, 12, 18, 15, 1, 17},
+    {1625, 0x0036, 12, 18, 15, 1, 17},
+    {1733, 0x0037, 12, 18, 15, 1, 17},
+    {1841, 0x0038, 12, 18, 15, 1, 17},
+    {1949, 0x0039, 12, 18, 15, 1, 17},
+    {2057, 0x003A, 3, 14, 15, 5, 13},
+    {2078, 0x003B, 4, 16, 15, 4, 13},
+    {2110, 0x003C, 12, 12, 15, 1, 15},
+    {2182, 0x003D, 12, 7, 15, 1, 12},
+    {2224, 0x003E, 12, 12, 15, 1, 15},
+    {2296, 0x003F, 11, 18, 15, 1, 17},
+    {2395, 0x0040, 15, 20, 15, 0, 17},
+    {2545, 0x0041, 15, 18, 15, 0, 17},
+    {2680, 0x0042, 12, 18, 15, 1, 17},
+    {2788, 0x0043, 12, 18, 15, 1, 17},
+    {2896, 0x0044, 12, 18, 15, 1, 17},
+    {3004, 0x0045, 11, 18, 15, 3, 17},
+    {3103, 0x0046, 11, 18, 15, 3, 17},
+    {3202, 0x0047, 12, 18, 15, 1, 17},
+    {3310, 0x0048, 12, 18, 15, 1, 17},
+    {3418, 0x0049, 11, 18, 15, 1, 17},
+    {3517, 0x004A, 11, 18, 15, 1, 17},
+    {3616, 0x004B, 14, 18, 15, 3, 17},
+    {3742, 0x004C, 11, 18, 15, 3, 17},
+    {3841, 0x004D, 12, 18, 15, 1, 17},
+    {3949, 0x004E, 12, 18, 15, 1, 17},
+    {4057, 0x004F, 12, 18, 15, 1, 17},
+    {4165, 0x0050, 12, 18, 15, 1, 17},
+    {4273, 0x0051, 12, 22, 15, 1, 17},
+    {4405, 0x0052, 15, 18, 15, 1, 17},
+    {4540, 0x0053, 12, 18, 15, 1, 17},
+    {4648, 0x0054, 14, 18, 15, 0, 17},
+    {4774, 0x0055, 12, 18, 15, 1, 17},
+    {4882, 0x0056, 15, 18, 15, 0, 17},
+    {5017, 0x0057, 15, 18, 15, 0, 17},
+    {5152, 0x0058, 15, 18, 15, 0, 17},
+    {5287, 0x0059, 14, 18, 15, 0, 17},
+    {5413, 0x005A, 12, 18, 15, 1, 17},
+    {5521, 0x005B, 6, 22, 15, 5, 17},
+    {5587, 0x005C, 10, 18, 15, 3, 17},
+    {5677, 0x005D, 6, 22, 15, 4, 17},
+    {5743, 0x005E, 12, 11, 15, 1, 17},
+    {5809, 0x005F, 15, 3, 15, 0, -3},
+    {5832, 0x0060, 4, 4, 15, 5, 19},
+    {5840, 0x0061, 11, 14, 15, 1, 13},
+    {5917, 0x0062, 12, 19, 15, 1, 19},
+    {6031, 0x0063, 10, 14, 15, 3, 13},
+    {6101, 0x0064, 11, 19, 15, 1, 19},
+    {6206, 0x0065, 12, 14, 15, 1, 13},
+    {6290, 0x0066, 12, 19, 15, 1, 19},
+    {6404, 0x0067, 15, 19, 15, 0, 13},
+    {6547, 0x0068, 11, 19, 15, 1, 19},
+    {6652, 0x0069, 12, 19, 15, 1, 19},
+    {6766, 0x006A, 8, 24, 15, 1, 19},
+    {6862, 0x006B, 12, 19, 15, 3, 19},
+    {6976, 0x006C, 12, 19, 15, 1, 19},
+    {7090, 0x006D, 11, 14, 15, 1, 13},
+    {7167, 0x006E, 11, 14, 15, 1, 13},
+    {7244, 0x006F, 12, 14, 15, 1, 13},
+    {7328, 0x0070, 12, 19, 15, 1, 13},
+    {7442, 0x0071, 11, 19, 15, 1, 13},
+    {7547, 0x0072, 10, 14, 15, 3, 13},
+    {7617, 0x0073, 10, 14, 15, 3, 13},
+    {7687, 0x0074, 10, 18, 15, 3, 17},
+    {7777, 0x0075, 11, 14, 15, 1, 13},
+    {7854, 0x0076, 12, 14, 15, 1, 13},
+    {7938, 0x0077, 15, 14, 15, 0, 13},
+    {8043, 0x0078, 12, 14, 15, 1, 13},
+    {8127, 0x0079, 12, 19, 15, 1, 13},
+    {8241, 0x007A, 10, 14, 15, 3, 13},
+    {8311, 0x007B, 10, 22, 15, 3, 17},
+    {8421, 0x007C, 3, 24, 15, 7, 19},
+    {8457, 0x007D, 10, 22, 15, 3, 17},
+    {8567, 0x007E, 12, 4, 15, 1, 11},
+    {8591, 0x00A0, 0, 0, 15, 0, 0},
+    {8591, 0x00A1, 4, 18, 15, 5, 13},
+    {8627, 0x00A2, 11, 18, 15, 3, 17},
+    {8726, 0x00A3, 12, 18, 15, 1, 17},
+    {8834, 0x00A4, 12, 12, 15, 1, 15},
+    {8906, 0x00A5, 14, 18, 15, 1, 17},
+    {9032, 0x00A6, 3, 24, 15, 7, 19},
+    {9068, 0x00A7, 11, 19, 15, 1, 19},
+    {9173, 0x00A8, 7, 3, 15, 4, 19},
+    {9184, 0x00A9, 15, 18, 15, 0, 17},
+    {9319, 0x00AA, 8, 8, 15, 3, 17},
+    {9351, 0x00AB, 11, 10, 15, 1, 11},
+    {9406, 0x00AC, 12, 7, 15, 1, 9},
+    {9448, 0x00AD, 7, 3, 15, 4, 8},
+    {9459, 0x00AE, 15, 18, 15, 0, 17},
+    {9594, 0x00AF, 15, 3, 15, 0, 21},
+    {9617, 0x00B0, 10, 10, 15, 3, 17},
+    {9667, 0x00B1, 12, 15, 15, 1, 15},
+    {9757, 0x00B2, 7, 10, 15, 4, 17},
+    {9792, 0x00B3, 7, 10, 15, 4, 17},
+    {9827, 0x00B4, 4, 4, 15, 5, 19},
+    {9835, 0x00B5, 11, 19, 15, 1, 13},
+    {9940, 0x00B6, 12, 22, 15, 1, 19},
+    {10072, 0x00B7, 3, 3, 15, 5, 9},
+    {10077, 0x00B8, 4, 6, 15, 5, 0},
+    {10089, 0x00B9, 6, 10, 15, 4, 17},
+    {10119, 0x00BA, 8, 8, 15, 3, 17},
+    {10151, 0x00BB, 11, 10, 15, 3, 11},
+    {10206, 0x00BC, 16, 18, 15, 0, 17},
+    {10350, 0x00BD, 15, 18, 15, 0, 17},
+    {10485, 0x00BE, 16, 18, 15, 0, 17},
+    {10629, 0x00BF, 11, 18, 15, 3, 13},
+    {10728, 0x00C0, 15, 23, 15, 0, 23},
+    {10901, 0x00C1, 15, 23, 15, 0, 23},
+    {11074, 0x00C2, 15, 23, 15, 0, 23},
+    {11247, 0x00C3, 15, 24, 15, 0, 24},
+    {11427, 0x00C4, 15, 22, 15, 0, 21},
+    {11592, 0x00C5, 15, 22, 15, 0, 21},
+    {11757, 0x00C6, 14, 18, 15, 0, 17},
+    {11883, 0x00C7, 12, 23, 15, 1, 17},
+    {12021, 0x00C8, 11, 23, 15, 3, 23},
+    {12148, 0x00C9, 11, 23, 15, 3, 23},
+    {12275, 0x00CA, 11, 23, 15, 3, 23},
+    {12402, 0x00CB, 11, 22, 15, 3, 21},
+    {12523, 0x00CC, 11, 23, 15, 1, 23},
+    {12650, 0x00CD, 11, 23, 15, 1, 23},
+    {12777, 0x00CE, 11, 23, 15, 1, 23},
+    {12904, 0x00CF, 11, 22, 15, 1, 21},
+    {13025, 0x00D0, 14, 18, 15, 0, 17},
+    {13151, 0x00D1, 12, 24, 15, 1, 24},
+    {13295, 0x00D2, 12, 23, 15, 1, 23},
+    {13433, 0x00D3, 12, 23, 15, 1, 23},
+    {13571, 0x00D4, 12, 23, 15, 1, 23},
+    {13709, 0x00D5, 12, 24, 15, 1, 24},
+    {13853, 0x00D6, 12, 22, 15, 1, 21},
+    {13985, 0x00D7, 12, 12, 15, 1, 15},
+    {14057, 0x00D8, 14, 20, 15, 1, 19},
+    {14197, 0x00D9, 12, 23, 15, 1, 23},
+    {14335, 0x00DA, 12, 23, 15, 1, 23},
+    {14473, 0x00DB, 12, 23, 15, 1, 23},
+    {14611, 0x00DC, 12, 22, 15, 1, 21},
+    {14743, 0x00DD, 14, 23, 15, 0, 23},
+    {14904, 0x00DE, 12, 18, 15, 1, 17},
+    {15012, 0x00DF, 12, 19, 15, 1, 19},
+    {15126, 0x00E0, 11, 19, 15, 1, 19},
+    {15231, 0x00E1, 11, 19, 15, 1, 19},
+    {15336, 0x00E2, 11, 19, 15, 1, 19},
+    {15441, 0x00E3, 11, 20, 15, 1, 20},
+    {15551, 0x00E4, 11, 18, 15, 1, 17},
+    {15650, 0x00E5, 11, 20, 15, 1, 20},
+    {15760, 0x00E6, 15, 14, 15, 0, 13},
+    {15865, 0x00E7, 10, 19, 15, 3, 13},
+    {15960, 0x00E8, 12, 19, 15, 1, 19},
+    {16074, 0x00E9, 12, 19, 15, 1, 19},
+    {16188, 0x00EA, 12, 19, 15, 1, 19},
+    {16302, 0x00EB, 12, 18, 15, 1, 17},
+    {16410, 0x00EC, 12, 19, 15, 1, 19},
+    {16524, 0x00ED, 12, 19, 15, 1, 19},
+    {16638, 0x00EE, 12, 19, 15, 1, 19},
+    {16752, 0x00EF, 12, 18, 15, 1, 17},
+    {16860, 0x00F0, 12, 19, 15, 1, 19},
+    {16974, 0x00F1, 11, 20, 15, 1, 20},
+    {17084, 0x00F2, 12, 19, 15, 1, 19},
+    {17198, 0x00F3, 12, 19, 15, 1, 19},
+    {17312, 0x00F4, 12, 19, 15, 1, 19},
+    {17426, 0x00F5, 12, 20, 15, 1, 20},
+    {17546, 0x00F6, 12, 18, 15, 1, 17},
+    {17654, 0x00F7, 11, 14, 15, 3, 15},
+    {17731, 0x00F8, 12, 16, 15, 1, 15},
+    {17827, 0x00F9, 11, 19, 15, 1, 19},
+    {17932, 0x00FA, 11, 19, 15, 1, 19},
+    {18037, 0x00FB, 11, 19, 15, 1, 19},
+    {18142, 0x00FC, 11, 18, 15, 1, 17},
+    {18241, 0x00FD, 12, 24, 15, 1, 19},
+    {18385, 0x00FE, 12, 24, 15, 1, 19},
+    {18529, 0x00FF, 12, 23, 15, 1, 17},
+    {18667, 0x0100, 15, 22, 15, 0, 21},
+    {18832, 0x0101, 11, 18, 15, 1, 17},
+    {18931, 0x0102, 15, 23, 15, 0, 23},
+    {19104, 0x0103, 11, 19, 15, 1, 19},
+    {19209, 0x0104, 16, 23, 15, 0, 17},
+    {19393, 0x0105, 12, 19, 15, 1, 13},
+    {19507, 0x0106, 12, 23, 15, 1, 23},
+    {19645, 0x0107, 10, 19, 15, 3, 19},
+    {19740, 0x0108, 12, 23, 15, 1, 23},
+    {19878, 0x0109, 10, 19, 15, 3, 19},
+    {19973, 0x010A, 12, 22, 15, 1, 21},
+    {20105, 0x010B, 10, 18, 15, 3, 17},
+    {20195, 0x010C, 12, 23, 15, 1, 23},
+    {20333, 0x010D, 10, 19, 15, 3, 19},
+    {20428, 0x010E, 12, 23, 15, 1, 23},
+    {20566, 0x010F, 15, 19, 15, 0, 19},
+    {20709, 0x0110, 14, 18, 15, 0, 17},
+    {20835, 0x0111, 14, 19, 15, 1, 19},
+    {20968, 0x0112, 11, 22, 15, 3, 21},
+    {21089, 0x0113, 12, 18, 15, 1, 17},
+    {21197, 0x0114, 11, 23, 15, 3, 23},
+    {21324, 0x0115, 12, 19, 15, 1, 19},
+    {21438, 0x0116, 11, 22, 15, 3, 21},
+    {21559, 0x0117, 12, 18, 15, 1, 17},
+    {21667, 0x0118, 11, 23, 15, 3, 17},
+    {21794, 0x0119, 12, 19, 15, 1, 13},
+    {21908, 0x011A, 11, 23, 15, 3, 23},
+    {22035, 0x011B, 12, 19, 15, 1, 19},
+    {22149, 0x011C, 12, 23, 15, 1, 23},
+    {22287, 0x011D, 15, 24, 15, 0, 19},
+    {22467, 0x011E, 12, 23, 15, 1, 23},
+    {22605, 0x011F, 15, 24, 15, 0, 19},
+    {22785, 0x0120, 12, 22, 15, 1, 21},
+    {22917, 0x0121, 15, 23, 15, 0, 17},
+    {23090, 0x0122, 12, 23, 15, 1, 17},
+    {23228, 0x0123, 15, 24, 15, 0, 19},
+    {23408, 0x0124, 12, 23, 15, 1, 23},
+    {23546, 0x0125, 11, 24, 15, 1, 24},
+    {23678, 0x0126, 18, 18, 15, -1, 17},
+    {23840, 0x0127, 14, 19, 15, -1, 19},
+    {23973, 0x0128, 11, 24, 15, 1, 24},
+    {24105, 0x0129, 12, 20, 15, 1, 20},
+    {24225, 0x012A, 11, 22, 15, 1, 21},
+    {24346, 0x012B, 12, 18, 15, 1, 17},
+    {24454, 0x012C, 11, 23, 15, 1, 23},
+    {24581, 0x012D, 12, 19, 15, 1, 19},
+    {24695, 0x012E, 11, 23, 15, 1, 17},
+    {24822, 0x012F, 12, 24, 15, 1, 19},
+    {24966, 0x0130, 11, 22, 15, 1, 21},
+    {25087, 0x0131, 12, 14, 15, 1, 13},
+    {25171, 0x0132, 12, 18, 15, 1, 17},
+    {25279, 0x0133, 11, 24, 15, 1, 19},
+    {25411, 0x0134, 14, 23, 15, 1, 23},
+    {25572, 0x0135, 10, 24, 15, 3, 19},
+    {25692, 0x0136, 14, 23, 15, 3, 17},
+    {25853, 0x0137, 12, 24, 15, 3, 19},
+    {25997, 0x0138, 12, 14, 15, 3, 13},
+    {26081, 0x0139, 11, 23, 15, 3, 23},
+    {26208, 0x013A, 12, 24, 15, 1, 24},
+    {26352, 0x013B, 11, 23, 15, 3, 17},
+    {26479, 0x013C, 12, 24, 15, 1, 19},
+    {26623, 0x013D, 11, 18, 15, 3, 17},
+    {26722, 0x013E, 12, 19, 15, 1, 19},
+    {26836, 0x013F, 11, 18, 15, 3, 17},
+    {26935, 0x0140, 12, 19, 15, 1, 19},
+    {27049, 0x0141, 14, 18, 15, 0, 17},
+    {27175, 0x0142, 12, 19, 15, 1, 19},
+    {27289, 0x0143, 12, 23, 15, 1, 23},
+    {27427, 0x0144, 11, 19, 15, 1, 19},
+    {27532, 0x0145, 12, 23, 15, 1, 17},
+    {27670, 0x0146, 11, 19, 15, 1, 13},
+    {27775, 0x0147, 12, 23, 15, 1, 23},
+    {27913, 0x0148, 11, 19, 15, 1, 19},
+    {28018, 0x0149, 14, 19, 15, 0, 19},
+    {28151, 0x014A, 12, 22, 15, 1, 17},
+    {28283, 0x014B, 11, 19, 15, 1, 13},
+    {28388, 0x014C, 12, 22, 15, 1, 21},
+    {28520, 0x014D, 12, 18, 15, 1, 17},
+    {28628, 0x014E, 12, 23, 15, 1, 23},
+    {28766, 0x014F, 12, 19, 15, 1, 19},
+    {28880, 0x0150, 12, 23, 15, 1, 23},
+    {29018, 0x0151, 12, 19, 15, 1, 19},
+    {29132, 0x0152, 14, 18, 15, 0, 17},
+    {29258, 0x0153, 15, 14, 15, 0, 13},
+    {29363, 0x0154, 15, 23, 15, 1, 23},
+    {29536, 0x0155, 10, 19, 15, 3, 19},
+    {29631, 0x0156, 15, 23, 15, 1, 17},
+    {29804, 0x0157, 10, 19, 15, 3, 13},
+    {29899, 0x0158, 15, 23, 15, 1, 23},
+    {30072, 0x0159, 10, 19, 15, 3, 19},
+    {30167, 0x015A, 12, 23, 15, 1, 23},
+    {30305, 0x015B, 10, 19, 15, 3, 19},
+    {30400, 0x015C, 12, 23, 15, 1, 23},
+    {30538, 0x015D, 10, 19, 15, 3, 19},
+    {30633, 0x015E, 12, 23, 15, 1, 17},
+    {30771, 0x015F, 10, 19, 15, 3, 13},
+    {30866, 0x0160, 12, 23, 15, 1, 23},
+    {31004, 0x0161, 10, 19, 15, 3, 19},
+    {31099, 0x0162, 14, 23, 15, 0, 17},
+    {31260, 0x0163, 10, 23, 15, 3, 17},
+    {31375, 0x0164, 14, 23, 15, 0, 23},
+    {31536, 0x0165, 11, 19, 15, 3, 19},
+    {31641, 0x0166, 14, 18, 15, 0, 17},
+    {31767, 0x0167, 10, 18, 15, 3, 17},
+    {31857, 0x0168, 12, 24, 15, 1, 24},
+    {32001, 0x0169, 11, 20, 15, 1, 20},
+    {32111, 0x016A, 12, 22, 15, 1, 21},
+    {32243, 0x016B, 11, 18, 15, 1, 17},
+    {32342, 0x016C, 12, 23, 15, 1, 23},
+    {32480, 0x016D, 11, 19, 15, 1, 19},
+    {32585, 0x016E, 12, 24, 15, 1, 24},
+    {32729, 0x016F, 11, 20, 15, 1, 20},
+    {32839, 0x0170, 12, 23, 15, 1, 23},
+    {32977, 0x0171, 11, 19, 15, 1, 19},
+    {33082, 0x0172, 12, 23, 15, 1, 17},
+    {33220, 0x0173, 12, 19, 15, 1, 13},
+    {33334, 0x0174, 15, 23, 15, 0, 23},
+    {33507, 0x0175, 15, 19, 15, 0, 19},
+    {33650, 0x0176, 14, 23, 15, 0, 23},
+    {33811, 0x0177, 12, 24, 15, 1, 19},
+    {33955, 0x0178, 14, 22, 15, 0, 21},
+    {34109, 0x0179, 12, 23, 15, 1, 23},
+    {34247, 0x017A, 10, 19, 15, 3, 19},
+    {34342, 0x017B, 12, 22, 15, 1, 21},
+    {34474, 0x017C, 10, 18, 15, 3, 17},
+    {34564, 0x017D, 12, 23, 15, 1, 23},
+    {34702, 0x017E, 10, 19, 15, 3, 19},
+    {34797, 0x017F, 8, 19, 15, 4, 19},
+    {34873, 0x0218, 12, 23, 15, 1, 17},
+    {35011, 0x0219, 10, 19, 15, 3, 13},
+    {35106, 0x021A, 14, 23, 15, 0, 17},
+    {35267, 0x021B, 10, 23, 15, 3, 17},
+    {35382, 0x0384, 3, 4, 15, 7, 19},
+    {35388, 0x0385, 8, 6, 15, 3, 21},
+    {35412, 0x0386, 15, 18, 15, 0, 17},
+    {35547, 0x0387, 3, 3, 15, 5, 9},
+    {35552, 0x0388, 14, 18, 15, 0, 17},
+    {35678, 0x0389, 15, 18, 15, -1, 17},
+    {35813, 0x038A, 14, 18, 15, -1, 17},
+    {35939, 0x038C, 15, 18, 15, -1, 17},
+    {36074, 0x038E, 16, 18, 15, -3, 17},
+    {36218, 0x038F, 16, 18, 15, -1, 17},
+    {36362, 0x0390, 10, 22, 15, 3, 21},
+    {36472, 0x0391, 15, 18, 15, 0, 17},
+    {36607, 0x0392, 12, 18, 15, 1, 17},
+    {36715, 0x0393, 12, 18, 15, 3, 17},
+    {36823, 0x0394, 12, 18, 15, 1, 17},
+    {36931, 0x0395, 11, 18, 15, 3, 17},
+    {37030, 0x0396, 12, 18, 15, 1, 17},
+    {37138, 0x0397, 12, 18, 15, 1, 17},
+    {37246, 0x0398, 12, 18, 15, 1, 17},
+    {37354, 0x0399, 11, 18, 15, 1, 17},
+    {37453, 0x039A, 14, 18, 15, 3, 17},
+    {37579, 0x039B, 15, 18, 15, 0, 17},
+    {37714, 0x039C, 12, 18, 15, 1, 17},
+    {37822, 0x039D, 12, 18, 15, 1, 17},
+    {37930, 0x039E, 12, 18, 15, 1, 17},
+    {38038, 0x039F, 12, 18, 15, 1, 17},
+    {38146, 0x03A0, 12, 18, 15, 1, 17},
+    {38254, 0x03A1, 12, 18, 15, 1, 17},
+    {38362, 0x03A3, 12, 18, 15, 1, 17},
+    {38470, 0x03A4, 14, 18, 15, 0, 17},
+    {38596, 0x03A5, 14, 18, 15, 0, 17},
+    {38722, 0x03A6, 14, 18, 15, 0, 17},
+    {38848, 0x03A7, 15, 18, 15, 0, 17},
+    {38983, 0x03A8, 14, 18, 15, 0, 17},
+    {39109, 0x03A9, 15, 18, 15, 0, 17},
+    {39244, 0x03AA, 11, 22, 15, 1, 21},
+    {39365, 0x03AB, 14, 22, 15, 0, 21},
+    {39519, 0x03AC, 14, 19, 15, 1, 19},
+    {39652, 0x03AD, 10, 19, 15, 3, 19},
+    {39747, 0x03AE, 11, 24, 15, 1, 19},
+    {39879, 0x03AF, 7, 19, 15, 5, 19},
+    {39946, 0x03B0, 12, 22, 15, 1, 21},
+    {40078, 0x03B1, 14, 14, 15, 1, 13},
+    {40176, 0x03B2, 12, 24, 15, 1, 19},
+    {40320, 0x03B3, 12, 19, 15, 1, 13},
+    {40434, 0x03B4, 12, 19, 15, 1, 19},
+    {40548, 0x03B5, 10, 14, 15, 3, 13},
+    {40618, 0x03B6, 11, 24, 15, 1, 19},
+    {40750, 0x03B7, 11, 19, 15, 1, 13},
+    {40855, 0x03B8, 12, 18, 15, 1, 17},
+    {40963, 0x03B9, 7, 14, 15, 5, 13},
+    {41012, 0x03BA, 12, 14, 15, 3, 13},
+    {41096, 0x03BB, 14, 19, 15, 1, 19},
+    {41229, 0x03BC, 11, 19, 15, 1, 13},
+    {41334, 0x03BD, 14, 14, 15, 0, 13},
+    {41432, 0x03BE, 10, 24, 15, 3, 19},
+    {41552, 0x03BF, 12, 14, 15, 1, 13},
+    {41636, 0x03C0, 14, 14, 15, 0, 13},
+    {41734, 0x03C1, 12, 19, 15, 1, 13},
+    {41848, 0x03C2, 10, 19, 15, 3, 13},
+    {41943, 0x03C3, 14, 14, 15, 1, 13},
+    {42041, 0x03C4, 12, 14, 15, 1, 13},
+    {42125, 0x03C5, 12, 14, 15, 1, 13},
+    {42209, 0x03C6, 14, 19, 15, 0, 13},
+    {42342, 0x03C7, 14, 19, 15, 0, 13},
+    {42475, 0x03C8, 14, 24, 15, 0, 19},
+    {42643, 0x03C9, 14, 14, 15, 0, 13},
+    {42741, 0x03CA, 8, 18, 15, 4, 17},
+    {42813, 0x03CB, 12, 18, 15, 1, 17},
+    {42921, 0x03CC, 12, 19, 15, 1, 19},
+    {43035, 0x03CD, 12, 19, 15, 1, 19},
+    {43149, 0x03CE, 14, 19, 15, 0, 19},
+    {43282, 0x0400, 11, 23, 15, 3, 23},
+    {43409, 0x0401, 11, 22, 15, 3, 21},
+    {43530, 0x0402, 14, 18, 15, 0, 17},
+    {43656, 0x0403, 12, 23, 15, 3, 23},
+    {43794, 0x0404, 12, 18, 15, 1, 17},
+    {43902, 0x0405, 12, 18, 15, 1, 17},
+    {44010, 0x0406, 11, 18, 15, 1, 17},
+    {44109, 0x0407, 11, 22, 15, 1, 21},
+    {44230, 0x0408, 11, 18, 15, 1, 17},
+    {44329, 0x0409, 15, 18, 15, 0, 17},
+    {44464, 0x040A, 14, 18, 15, 1, 17},
+    {44590, 0x040B, 14, 18, 15, 0, 17},
+    {44716, 0x040C, 14, 23, 15, 3, 23},
+    {44877, 0x040D, 12, 23, 15, 1, 23},
+    {45015, 0x040E, 15, 23, 15, 0, 23},
+    {45188, 0x040F, 12, 22, 15, 1, 17},
+    {45320, 0x0410, 15, 18, 15, 0, 17},
+    {45455, 0x0411, 12, 18, 15, 1, 17},
+    {45563, 0x0412, 12, 18, 15, 1, 17},
+    {45671, 0x0413, 12, 18, 15, 3, 17},
+    {45779, 0x0414, 15, 22, 15, 0, 17},
+    {45944, 0x0415, 11, 18, 15, 3, 17},
+    {46043, 0x0416, 16, 18, 15, -1, 17},
+    {46187, 0x0417, 12, 18, 15, 1, 17},
+    {46295, 0x0418, 12, 18, 15, 1, 17},
+    {46403, 0x0419, 12, 23, 15, 1, 23},
+    {46541, 0x041A, 14, 18, 15, 3, 17},
+    {46667, 0x041B, 14, 18, 15, 0, 17},
+    {46793, 0x041C, 12, 18, 15, 1, 17},
+    {46901, 0x041D, 12, 18, 15, 1, 17},
+    {47009, 0x041E, 12, 18, 15, 1, 17},
+    {47117, 0x041F, 12, 18, 15, 1, 17},
+    {47225, 0x0420, 12, 18, 15, 1, 17},
+    {47333, 0x0421, 12, 18, 15, 1, 17},
+    {47441, 0x0422, 14, 18, 15, 0, 17},
+    {47567, 0x0423, 15, 18, 15, 0, 17},
+    {47702, 0x0424, 14, 18, 15, 0, 17},
+    {47828, 0x0425, 15, 18, 15, 0, 17},
+    {47963, 0x0426, 14, 22, 15, 1, 17},
+    {48117, 0x0427, 12, 18, 15, 1, 17},
+    {48225, 0x0428, 14, 18, 15, 0, 17},
+    {48351, 0x0429, 15, 22, 15, 0, 17},
+    {48516, 0x042A, 14, 18, 15, 0, 17},
+    {48642, 0x042B, 12, 18, 15, 1, 17},
+    {48750, 0x042C, 12, 18, 15, 1, 17},
+    {48858, 0x042D, 14, 18, 15, 0, 17},
+    {48984, 0x042E, 12, 18, 15, 1, 17},
+    {49092, 0x042F, 15, 18, 15, -1, 17},
+    {49227, 0x0430, 11, 14, 15, 1, 13},
+    {49304, 0x0431, 12, 19, 15, 1, 19},
+    {49418, 0x0432, 12, 14, 15, 1, 13},
+    {49502, 0x0433, 8, 14, 15, 4, 13},
+    {49558, 0x0434, 14, 18, 15, 0, 13},
+    {49684, 0x0435, 12, 14, 15, 1, 13},
+    {49768, 0x0436, 16, 14, 15, -1, 13},
+    {49880, 0x0437, 10, 14, 15, 3, 13},
+    {49950, 0x0438, 11, 14, 15, 1, 13},
+    {50027, 0x0439, 11, 19, 15, 1, 19},
+    {50132, 0x043A, 12, 14, 15, 1, 13},
+    {50216, 0x043B, 12, 14, 15, 0, 13},
+    {50300, 0x043C, 12, 14, 15, 1, 13},
+    {50384, 0x043D, 11, 14, 15, 1, 13},
+    {50461, 0x043E, 12, 14, 15, 1, 13},
+    {50545, 0x043F, 11, 14, 15, 1, 13},
+    {50622, 0x0440, 12, 19, 15, 1, 13},
+    {50736, 0x0441, 10, 14, 15, 3, 13},
+    {50806, 0x0442, 14, 14, 15, 0, 13},
+    {50904, 0x0443, 12, 19, 15, 1, 13},
+    {51018, 0x0444, 14, 24, 15, 0, 19},
+    {51186, 0x0445, 12, 14, 15, 1, 13},
+    {51270, 0x0446, 12, 18, 15, 1, 13},
+    {51378, 0x0447, 11, 14, 15, 1, 13},
+    {51455, 0x0448, 14, 14, 15, 0, 13},
+    {51553, 0x0449, 15, 18, 15, 0, 13},
+    {51688, 0x044A, 14, 14, 15, 0, 13},
+    {51786, 0x044B, 12, 14, 15, 1, 13},
+    {51870, 0x044C, 12, 14, 15, 1, 13},
+    {51954, 0x044D, 10, 14, 15, 3, 13},
+    {52024, 0x044E, 12, 14, 15, 1, 13},
+    {52108, 0x044F, 12, 14, 15, 0, 13},
+    {52192, 0x0450, 12, 19, 15, 1, 19},
+    {52306, 0x0451, 12, 18, 15, 1, 17},
+    {52414, 0x0452, 14, 24, 15, -1, 19},
+    {52582, 0x0453, 8, 19, 15, 4, 19},
+    {52658, 0x0454, 11, 14, 15, 3, 13},
+    {52735, 0x0455, 10, 14, 15, 3, 13},
+    {52805, 0x0456, 12, 19, 15, 1, 19},
+    {52919, 0x0457, 12, 18, 15, 1, 17},
+    {53027, 0x0458, 8, 24, 15, 1, 19},
+    {53123, 0x0459, 15, 14, 15, 0, 13},
+    {53228, 0x045A, 14, 14, 15, 1, 13},
+    {53326, 0x045B, 14, 19, 15, -1, 19},
+    {53459, 0x045C, 12, 19, 15, 3, 19},
+    {53573, 0x045D, 11, 19, 15, 1, 19},
+    {53678, 0x045E, 12, 24, 15, 1, 19},
+    {53822, 0x045F, 11, 18, 15, 1, 13},
+};
+
+constexpr uint8_t NotoMono24Bitmaps[] = {
+    0xCE, 0xA1, 0xCE, 0xA1, 0xBE, 0xA0, 0xBD, 0xA0, 0xAD, 0x90, 0xAC, 0x90,
+    0x9C, 0x90, 0x9B, 0x80, 0x8A, 0x80, 0x7A, 0x70, 0x79, 0x70, 0x69, 0x70,
+    0x00, 0x00, 0x23, 0x20, 0x78, 0x61, 0xEF, 0xB3, 0xBD, 0x91, 0x44, 0x30,
+    0xEF, 0xA0, 0x0A, 0xFF, 0x00, 0xEE, 0xA0, 0x09, 0xEE, 0x00, 0xDD, 0x90,
+    0x08, 0xDE, 0x00, 0xCC, 0x90, 0x08, 0xCD, 0x00, 0xAB, 0x80, 0x07, 0xBB,
+    0x00, 0x34, 0x30, 0x02, 0x44, 0x00, 0x00, 0x00, 0x7B, 0x90, 0x00, 0x27,
+    0xD4, 0x00, 0x00, 0x09, 0xA7, 0x00, 0x03, 0x9A, 0x30, 0x00, 0x00, 0xC9,
+    0x50, 0x00, 0x4C, 0x83, 0x00, 0x00, 0x0E, 0x83, 0x00, 0x05, 0xE5, 0x20,
+    0x0A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0x59, 0xBE, 0xA8, 0x88,
+    0xAC, 0xE8, 0x85, 0x02, 0x59, 0xD7, 0x33, 0x37, 0xAD, 0x33, 0x20, 0x03,
+    0x8C, 0x40, 0x00, 0x69, 0xB0, 0x00, 0x00, 0x4B, 0x93, 0x00, 0x07, 0xA9,
+    0x00, 0x00, 0x04, 0xD7, 0x20, 0x00, 0x8B, 0x70, 0x00, 0x55, 0x8E, 0x96,
+    0x55, 0x5B, 0xC9, 0x52, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x50,
+    0x57, 0xAF, 0x55, 0x55, 0x8D, 0xC5, 0x52, 0x02, 0x6A, 0xD2, 0x22, 0x27,
+    0xB9, 0x22, 0x10, 0x06, 0x9C, 0x00, 0x00, 0x8A, 0x80, 0x00, 0x00, 0x7A,
+    0x90, 0x00, 0x0A, 0xA6, 0x00, 0x00, 0x09, 0xB6, 0x00, 0x00, 0xD9, 0x40,
+    0x00, 0x00, 0x34, 0x20, 0x00, 0x04, 0x31, 0x00, 0x00, 0x00, 0x00, 0x0A,
+    0xB3, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xB3, 0x00, 0x00, 0x01, 0x24, 0x5C,
+    0xC7, 0x44, 0x32, 0x03, 0x6B, 0xEF, 0xFF, 0xDC, 0x95, 0x8D, 0xEB, 0x6C,
+    0xC7, 0x7A, 0x95, 0xCC, 0x94, 0x2B, 0xC5, 0x23, 0x32, 0xEC, 0x80, 0x0A,
+    0xB3, 0x00, 0x00, 0xDD, 0x91, 0x0A, 0xB3, 0x00, 0x00, 0x4B, 0xEE, 0x9D,
+    0xB3, 0x00, 0x00, 0x14, 0x7A, 0xBE, 0xEB, 0x74, 0x10, 0x01, 0x25, 0x8D,
+    0xED, 0xB8, 0x52, 0x00, 0x00, 0x0A, 0xD9, 0xDE, 0xC6, 0x00, 0x00, 0x0A,
+    0xB3, 0x08, 0xCD, 0x00, 0x00, 0x0A, 0xB3, 0x08, 0xCD, 0x54, 0x32, 0x2B,
+    0xC5, 0x4A, 0xCB, 0xEC, 0x97, 0x6C, 0xD9, 0xBE, 0xC7, 0x8A, 0xCE, 0xFF,
+    0xED, 0xA6, 0x20, 0x33, 0x45, 0x5C, 0xC7, 0x32, 0x10, 0x00, 0x00, 0x0A,
+    0xB3, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xB3, 0x00, 0x00, 0x28, 0xCE, 0xB5,
+    0x10, 0x06, 0xAC, 0x00, 0x08, 0x99, 0x6A, 0x85, 0x01, 0x9B, 0x70, 0x00,
+    0xC9, 0x61, 0x8A, 0x80, 0x3A, 0xB4, 0x00, 0x0E, 0x73, 0x04, 0xB9, 0x07,
+    0xB9, 0x00, 0x00, 0xE7, 0x30, 0x4B, 0x90, 0xD9, 0x50, 0x00, 0x0B, 0x96,
+    0x18, 0xA9, 0x3E, 0x72, 0x00, 0x00, 0x79, 0x96, 0xA8, 0x77, 0xD5, 0x10,
+    0x00, 0x02, 0x8C, 0xEB, 0x55, 0xC9, 0x30, 0x00, 0x00, 0x00, 0x00, 0x02,
+    0x7F, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0xD2, 0x68, 0xA7, 0x31,
+    0x00, 0x00, 0x08, 0xB9, 0x59, 0xBA, 0xB6, 0x30, 0x00, 0x01, 0xAB, 0x5A,
+    0xA7, 0x2A, 0xA7, 0x00, 0x00, 0x7B, 0x90, 0xE7, 0x30, 0x4B, 0x90, 0x00,
+    0x0B, 0xA6, 0x0E, 0x73, 0x04, 0xB9, 0x00, 0x12, 0xE8, 0x30, 0xD8, 0x41,
+    0x6B, 0x90, 0x02, 0x5E, 0x61, 0x0A, 0xA7, 0x2A, 0xA7, 0x00, 0x4C, 0x93,
+    0x00, 0x28, 0xCE, 0xB5, 0x10, 0x01, 0x43, 0x10, 0x01, 0x34, 0x54, 0x20,
+    0x01, 0x4A, 0xEE, 0xDA, 0x10, 0x00, 0x00, 0x05, 0x9D, 0x99, 0xBD, 0x72,
+    0x00, 0x00, 0x08, 0xCD, 0x55, 0x7D, 0xC4, 0x00, 0x00, 0x09, 0xDA, 0x00,
+    0x3A, 0xE5, 0x00, 0x00, 0x09, 0xDB, 0x00, 0x4B, 0xD4, 0x00, 0x00, 0x06,
+    0xBE, 0x34, 0x8E, 0x83, 0x00, 0x00, 0x04, 0x8E, 0x79, 0xBC, 0x41, 0x00,
+    0x00, 0x00, 0x5D, 0xFF, 0xC7, 0x00, 0x00, 0x00, 0x04, 0x9E, 0xFD, 0x80,
+    0x00, 0x00, 0x00, 0x39, 0xCB, 0x9C, 0xB6, 0x05, 0x89, 0x00, 0x8C, 0xC6,
+    0x4A, 0xCB, 0x28, 0xCC, 0x00, 0xCD, 0x90, 0x05, 0xAF, 0x6B, 0xCA, 0x00,
+    0xFC, 0x70, 0x00, 0x4B, 0xFF, 0xC5, 0x00, 0xDD, 0x80, 0x00, 0x25, 0xFF,
+    0xB3, 0x00, 0xBD, 0xA4, 0x22, 0x47, 0xEF, 0xC5, 0x00, 0x7C, 0xEB, 0x67,
+    0xAE, 0xDE, 0xDC, 0x00, 0x05, 0x9D, 0xFE, 0xB8, 0x13, 0x8F, 0x93, 0x02,
+    0x34, 0x55, 0x43, 0x01, 0x35, 0x31, 0xEF, 0xA0, 0xEE, 0xA0, 0xDD, 0x90,
+    0xCC, 0x90, 0xAB, 0x80, 0x34, 0x30, 0x00, 0x12, 0xEB, 0x60, 0x04, 0xAC,
+    0x62, 0x02, 0x7E, 0x83, 0x00, 0x6B, 0xF2, 0x10, 0x2A, 0xD9, 0x00, 0x05,
+    0xCC, 0x50, 0x00, 0x8C, 0xB2, 0x00, 0x0B, 0xD9, 0x00, 0x00, 0xDC, 0x80,
+    0x00, 0x0E, 0xC7, 0x00, 0x00, 0xEC, 0x70, 0x00, 0x0E, 0xC7, 0x00, 0x00,
+    0xDC, 0x80, 0x00, 0x0C, 0xD9, 0x00, 0x00, 0xAD, 0xA1, 0x00, 0x07, 0xCB,
+    0x40, 0x00, 0x2A, 0xD9, 0x00, 0x01, 0x7B, 0xD1, 0x00, 0x04, 0x9E, 0x52,
+    0x00, 0x15, 0xDB, 0x40, 0x00, 0x13, 0xEA, 0x60, 0x00, 0x15, 0x32, 0x9C,
+    0xA2, 0x00, 0x03, 0x9B, 0xA1, 0x00, 0x06, 0xAE, 0x41, 0x00, 0x26, 0xF8,
+    0x30, 0x00, 0x39, 0xF6, 0x10, 0x02, 0x5F, 0x83, 0x00, 0x13, 0xFA, 0x50,
+    0x00, 0x0E, 0xC7, 0x00, 0x00, 0xCD, 0x90, 0x00, 0x0B, 0xD9, 0x00, 0x00,
+    0xBD, 0xA0, 0x00, 0x0B, 0xDA, 0x00, 0x00, 0xCD, 0x90, 0x00, 0x0D, 0xC8,
+    0x00, 0x01, 0xEB, 0x60, 0x01, 0x4F, 0x94, 0x00, 0x39, 0xF6, 0x10, 0x15,
+    0xDB, 0x40, 0x03, 0x8E, 0x62, 0x00, 0x7C, 0xD1, 0x00, 0x9C, 0xA3, 0x00,
+    0x03, 0x43, 0x10, 0x00, 0x00, 0x00, 0x5C, 0xC6, 0x00, 0x00, 0x00, 0x00,
+    0x3B, 0xC5, 0x00, 0x00, 0x11, 0x10, 0x2B, 0xB4, 0x01, 0x11, 0x44, 0x31,
+    0x1A, 0xB2, 0x03, 0x44, 0x9D, 0xFF, 0xBE, 0xEB, 0xEF, 0xEB, 0x46, 0x78,
+    0xBE, 0xEC, 0x87, 0x65, 0x12, 0x34, 0xCC, 0xCD, 0x43, 0x21, 0x00, 0x14,
+    0xF9, 0x9F, 0x52, 0x00, 0x01, 0x5E, 0xC4, 0x4B, 0xE6, 0x20, 0x01, 0x5B,
+    0x72, 0x26, 0xC6, 0x20, 0x01, 0x37, 0x31, 0x12, 0x84, 0x10, 0x00, 0x00,
+    0x04, 0x52, 0x00, 0x00, 0x00, 0x00, 0x08, 0x94, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0xC5, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xC5, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0xC5, 0x00, 0x00, 0x48, 0xAA, 0xAD, 0xEC, 0xAA, 0x97, 0x59, 0xCC,
+    0xCE, 0xED, 0xCC, 0xA8, 0x24, 0x55, 0x5C, 0xD8, 0x55, 0x43, 0x00, 0x00,
+    0x0A, 0xC5, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xC5, 0x00, 0x00, 0x00, 0x00,
+    0x09, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x07, 0x83, 0x00, 0x00, 0x1A, 0xED,
+    0x3B, 0xD9, 0x6C, 0xC5, 0x9D, 0xA1, 0xDA, 0x60, 0x43, 0x20, 0xFF, 0xFF,
+    0xFF, 0xAA, 0xAA, 0xAA, 0xA7, 0x55, 0x55, 0x55, 0x30, 0xBB, 0x8B, 0xB8,
+    0x88, 0x50, 0x00, 0x00, 0x00, 0x4C, 0xC4, 0x00, 0x00, 0x01, 0x6E, 0x83,
+    0x00, 0x00, 0x03, 0x8F, 0x41, 0x00, 0x00, 0x06, 0xBE, 0x00, 0x00, 0x00,
+    0x1A, 0xC8, 0x00, 0x00, 0x00, 0x5B, 0xB4, 0x00, 0x00, 0x00, 0x9C, 0x91,
+    0x00, 0x00, 0x00, 0xDB, 0x70, 0x00, 0x00, 0x14, 0xF8, 0x30, 0x00, 0x00,
+    0x39, 0xE5, 0x10, 0x00, 0x00, 0x4C, 0xB4, 0x00, 0x00, 0x01, 0x6F, 0x72,
+    0x00, 0x00, 0x05, 0xAE, 0x10, 0x00, 0x00, 0x08, 0xCB, 0x00, 0x00, 0x00,
+    0x2A, 0xC7, 0x00, 0x00, 0x00, 0x6C, 0xB3, 0x00, 0x00, 0x00, 0xCC, 0x80,
+    0x00, 0x00, 0x00, 0x44, 0x30, 0x00, 0x00, 0x00, 0x00, 0x38, 0xDE, 0xED,
+    0x83, 0x00, 0x05, 0x9C, 0xA9, 0x9A, 0xC9, 0x50, 0x29, 0xCC, 0x54, 0x46,
+    0xCC, 0x81, 0x5C, 0xC6, 0x00, 0x00, 0x6C, 0xB4, 0xAD, 0xA0, 0x00, 0x00,
+    0x0A, 0xDA, 0xCC, 0x80, 0x00, 0x00, 0x09, 0xCC, 0xDC, 0x70, 0x00, 0x00,
+    0x08, 0xCD, 0xEC, 0x70, 0x00, 0x00, 0x07, 0xCE, 0xFC, 0x70, 0x00, 0x00,
+    0x07, 0xCF, 0xEC, 0x70, 0x00, 0x00, 0x07, 0xCE, 0xEC, 0x70, 0x00, 0x00,
+    0x07, 0xCE, 0xDC, 0x80, 0x00, 0x00, 0x08, 0xCD, 0xAD, 0xA0, 0x00, 0x00,
+    0x0A, 0xDA, 0x6C, 0xB4, 0x00, 0x00, 0x4B, 0xC6, 0x3A, 0xC9, 0x32, 0x23,
+    0x9C, 0xA3, 0x07, 0xCF, 0x86, 0x68, 0xFC, 0x70, 0x00, 0x38, 0xDE, 0xED,
+    0x83, 0x00, 0x00, 0x13, 0x45, 0x54, 0x31, 0x00, 0x00, 0x25, 0xFB, 0x60,
+    0x37, 0xCF, 0xB6, 0x38, 0xBC, 0xFB, 0x69, 0xDC, 0x6E, 0xB6, 0x86, 0x40,
+    0xFB, 0x63, 0x21, 0x0F, 0xB6, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x0F, 0xB6,
+    0x00, 0x00, 0xFB, 0x60, 0x00, 0x0F, 0xB6, 0x00, 0x00, 0xFB, 0x60, 0x00,
+    0x0F, 0xB6, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x0F, 0xB6, 0x00, 0x00, 0xFB,
+    0x60, 0x00, 0x0F, 0xB6, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x05, 0x42, 0x03,
+    0x6A, 0xEE, 0xED, 0xA6, 0x20, 0x59, 0xCC, 0xA9, 0x99, 0xCB, 0x83, 0x6A,
+    0xB8, 0x54, 0x44, 0x9C, 0xC8, 0x14, 0x30, 0x00, 0x00, 0x19, 0xDD, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x08, 0xCD, 0x00,
+    0x00, 0x00, 0x00, 0x2A, 0xCA, 0x00, 0x00, 0x00, 0x00, 0x5C, 0xC6, 0x00,
+    0x00, 0x00, 0x13, 0xEB, 0x70, 0x00, 0x00, 0x02, 0x5B, 0xC6, 0x20, 0x00,
+    0x00, 0x26, 0x9C, 0x72, 0x00, 0x00, 0x00, 0x5B, 0xD9, 0x00, 0x00, 0x00,
+    0x27, 0xF9, 0x50, 0x00, 0x00, 0x04, 0x8C, 0x84, 0x20, 0x00, 0x00, 0x38,
+    0xBC, 0x53, 0x22, 0x22, 0x22, 0xAD, 0xD8, 0x55, 0x55, 0x55, 0x55, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15,
+    0x8B, 0xEE, 0xED, 0xA6, 0x20, 0x7A, 0xCB, 0x99, 0x99, 0xCB, 0x94, 0x79,
+    0xA7, 0x54, 0x44, 0x9D, 0xC8, 0x12, 0x20, 0x00, 0x00, 0x19, 0xDD, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0xCE, 0x00, 0x00, 0x00, 0x00, 0x19, 0xDC, 0x00,
+    0x00, 0x00, 0x12, 0x5B, 0xC8, 0x00, 0x00, 0x01, 0x35, 0xDD, 0x92, 0x00,
+    0x5F, 0xFF, 0xFE, 0x83, 0x00, 0x00, 0x38, 0x89, 0xAB, 0xCA, 0x62, 0x00,
+    0x13, 0x34, 0x56, 0xAC, 0xB6, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xDC, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0xCE, 0x10, 0x00, 0x00, 0x00, 0x19, 0xDD, 0x54,
+    0x32, 0x22, 0x23, 0x6B, 0xD9, 0xEC, 0x97, 0x56, 0x78, 0xEE, 0xB4, 0x7A,
+    0xCE, 0xFF, 0xED, 0x95, 0x20, 0x23, 0x45, 0x55, 0x54, 0x32, 0x10, 0x00,
+    0x00, 0x00, 0x12, 0xEF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x38, 0xEF, 0xA0,
+    0x00, 0x00, 0x00, 0x02, 0x6C, 0xDE, 0xA0, 0x00, 0x00, 0x00, 0x04, 0x9E,
+    0x9D, 0xA0, 0x00, 0x00, 0x00, 0x2B, 0xC7, 0x8D, 0xA0, 0x00, 0x00, 0x00,
+    0x9B, 0x93, 0x9D, 0xA0, 0x00, 0x00, 0x13, 0xDA, 0x60, 0x9D, 0xA0, 0x00,
+    0x00, 0x38, 0xE6, 0x10, 0x9D, 0xA0, 0x00, 0x02, 0x7F, 0x52, 0x00, 0x9D,
+    0xA0, 0x00, 0x07, 0xAB, 0x21, 0x00, 0x9D, 0xA0, 0x00, 0x4A, 0xB7, 0x00,
+    0x00, 0x9D, 0xA0, 0x00, 0x9C, 0x91, 0x00, 0x00, 0x9D, 0xA0, 0x00, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD4, 0x88, 0x88, 0x88, 0x88, 0xCE, 0xD8,
+    0x72, 0x33, 0x33, 0x33, 0x33, 0xAD, 0xB3, 0x31, 0x00, 0x00, 0x00, 0x00,
+    0x9D, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9D, 0xA0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x34, 0x30, 0x00, 0x8D, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0x9C,
+    0xC8, 0x88, 0x88, 0x88, 0x60, 0xAC, 0xA3, 0x33, 0x33, 0x33, 0x20, 0xBB,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0xCB, 0x70, 0x00, 0x00, 0x00, 0x00, 0xDA,
+    0x60, 0x00, 0x00, 0x00, 0x00, 0xEC, 0x94, 0x55, 0x44, 0x21, 0x00, 0xEE,
+    0xED, 0xFE, 0xDC, 0x73, 0x10, 0x67, 0x76, 0x56, 0x8A, 0xEE, 0xA3, 0x22,
+    0x22, 0x22, 0x33, 0x7C, 0xC8, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xDC, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x08, 0xCE, 0x10,
+    0x00, 0x00, 0x00, 0x2A, 0xDB, 0x54, 0x32, 0x22, 0x23, 0x7C, 0xC7, 0xEB,
+    0x97, 0x56, 0x79, 0xED, 0x92, 0x7A, 0xCE, 0xFE, 0xEC, 0x73, 0x10, 0x23,
+    0x45, 0x55, 0x54, 0x21, 0x00, 0x00, 0x01, 0x7A, 0xDE, 0xFE, 0x90, 0x01,
+    0x49, 0xCB, 0xA9, 0x99, 0x60, 0x04, 0x8D, 0xA8, 0x54, 0x44, 0x30, 0x08,
+    0xDD, 0x21, 0x00, 0x00, 0x00, 0x5C, 0xC5, 0x00, 0x00, 0x00, 0x00, 0x8D,
+    0xA2, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x91, 0x45, 0x55, 0x42, 0x10, 0xDC,
+    0x94, 0xCE, 0xEE, 0xB6, 0x30, 0xEE, 0xDD, 0x75, 0x56, 0xCE, 0xB4, 0xFE,
+    0xB6, 0x22, 0x22, 0x4B, 0xC9, 0xFD, 0x91, 0x00, 0x00, 0x08, 0xCD, 0xEC,
+    0x70, 0x00, 0x00, 0x07, 0xBF, 0xBC, 0x80, 0x00, 0x00, 0x07, 0xCE, 0x7C,
+    0xB4, 0x00, 0x00, 0x19, 0xDC, 0x4A, 0xC9, 0x32, 0x22, 0x6B, 0xC8, 0x07,
+    0xCF, 0x97, 0x67, 0xEE, 0xA3, 0x00, 0x37, 0xDE, 0xEE, 0xA5, 0x20, 0x00,
+    0x12, 0x45, 0x55, 0x32, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88,
+    0x88, 0x88, 0x88, 0x8C, 0xDD, 0x33, 0x33, 0x33, 0x33, 0x4A, 0xCA, 0x00,
+    0x00, 0x00, 0x00, 0x3B, 0xC6, 0x00, 0x00, 0x00, 0x00, 0x9C, 0x90, 0x00,
+    0x00, 0x00, 0x01, 0xDB, 0x60, 0x00, 0x00, 0x00, 0x14, 0xF8, 0x40, 0x00,
+    0x00, 0x00, 0x38, 0xF6, 0x10, 0x00, 0x00, 0x01, 0x5E, 0x93, 0x00, 0x00,
+    0x00, 0x03, 0x8F, 0x52, 0x00, 0x00, 0x00, 0x06, 0xBE, 0x21, 0x00, 0x00,
+    0x00, 0x09, 0xDB, 0x00, 0x00, 0x00, 0x00, 0x6C, 0xB4, 0x00, 0x00, 0x00,
+    0x00, 0xAC, 0x91, 0x00, 0x00, 0x00, 0x12, 0xDB, 0x70, 0x00, 0x00, 0x00,
+    0x25, 0xF9, 0x40, 0x00, 0x00, 0x00, 0x4C, 0xE5, 0x00, 0x00, 0x00, 0x00,
+    0x14, 0x52, 0x00, 0x00, 0x00, 0x03, 0x6A, 0xDE, 0xED, 0xA6, 0x30, 0x59,
+    0xBB, 0x99, 0x99, 0xBB, 0x94, 0x9C, 0xC8, 0x44, 0x44, 0x8C, 0xC9, 0xEC,
+    0x80, 0x00, 0x00, 0x08, 0xCE, 0xEB, 0x70, 0x00, 0x00, 0x07, 0xCD, 0xAC,
+    0xA3, 0x00, 0x00, 0x5B, 0xC8, 0x5A, 0xB8, 0x43, 0x45, 0x9B, 0x94, 0x06,
+    0xAF, 0xCA, 0xBE, 0xC7, 0x30, 0x02, 0x6D, 0xFE, 0xEE, 0x73, 0x00, 0x28,
+    0xBC, 0x65, 0x69, 0xB9, 0x61, 0x6B, 0xC8, 0x11, 0x24, 0xAC, 0xA5, 0xCD,
+    0x91, 0x00, 0x00, 0x2A, 0xDB, 0xFB, 0x60, 0x00, 0x00, 0x07, 0xBE, 0xEC,
+    0x80, 0x00, 0x00, 0x08, 0xCD, 0xBC, 0xA4, 0x22, 0x22, 0x5B, 0xCA, 0x6C,
+    0xEC, 0x66, 0x67, 0xDE, 0xB4, 0x03, 0x6B, 0xDE, 0xED, 0xA5, 0x20, 0x01,
+    0x24, 0x45, 0x54, 0x32, 0x10, 0x02, 0x5A, 0xEE, 0xED, 0x73, 0x00, 0x27,
+    0xBC, 0x99, 0x9A, 0xC9, 0x50, 0x5B, 0xD9, 0x54, 0x56, 0xCC, 0x92, 0xAD,
+    0xA2, 0x00, 0x00, 0x6C, 0xC5, 0xEC, 0x70, 0x00, 0x00, 0x09, 0xCB, 0xEB,
+    0x70, 0x00, 0x00, 0x08, 0xCD, 0xEC, 0x70, 0x00, 0x00, 0x18, 0xDE, 0xCD,
+    0x91, 0x00, 0x00, 0x2A, 0xEF, 0x5C, 0xEC, 0x55, 0x57, 0xDD, 0xEE, 0x25,
+    0x9B, 0xBB, 0xBA, 0x7A, 0xDD, 0x02, 0x47, 0x9A, 0x98, 0x39, 0xCC, 0x00,
+    0x00, 0x00, 0x00, 0x0A, 0xDA, 0x00, 0x00, 0x00, 0x00, 0x5C, 0xC5, 0x00,
+    0x00, 0x00, 0x01, 0xAC, 0x92, 0x01, 0x21, 0x22, 0x46, 0xDA, 0x60, 0x04,
+    0x54, 0x57, 0xAE, 0xD6, 0x10, 0x09, 0xEF, 0xED, 0xA7, 0x10, 0x00, 0x03,
+    0x55, 0x54, 0x32, 0x00, 0x00, 0xBB, 0x8B, 0xB8, 0x88, 0x50, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x3B, 0xB8, 0xBB,
+    0x74, 0x42, 0x07, 0xBB, 0x08, 0xBB, 0x05, 0x87, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x54,
+    0x1A, 0xED, 0x4B, 0xC7, 0x7C, 0xB3, 0xAC, 0x91, 0xDA, 0x60, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x7C, 0x00, 0x00, 0x00, 0x24, 0x9A, 0xBA, 0x00, 0x00,
+    0x34, 0x69, 0xBB, 0x96, 0x00, 0x01, 0x8C, 0xEE, 0x84, 0x10, 0x27, 0xBF,
+    0xD8, 0x41, 0x00, 0x00, 0xBC, 0xCB, 0x43, 0x10, 0x00, 0x00, 0xBC, 0xCB,
+    0x43, 0x10, 0x00, 0x00, 0x37, 0xBF, 0xD8, 0x41, 0x00, 0x00, 0x00, 0x12,
+    0x8C, 0xEE, 0x84, 0x10, 0x00, 0x01, 0x34, 0x69, 0xBB, 0x96, 0x00, 0x00,
+    0x00, 0x24, 0x9A, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x03, 0x7C, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xC7, 0x30, 0x00, 0x00, 0x00, 0x00, 0xAB, 0xA9,
+    0x42, 0x00, 0x00, 0x00, 0x69, 0xBB, 0x96, 0x43, 0x00, 0x00, 0x01, 0x48,
+    0xEE, 0xC8, 0x10, 0x00, 0x00, 0x00, 0x14, 0x8D, 0xFB, 0x72, 0x00, 0x00,
+    0x01, 0x34, 0xBC, 0xCB, 0x00, 0x00, 0x01, 0x34, 0xBC, 0xCB, 0x00, 0x00,
+    0x14, 0x8D, 0xFB, 0x73, 0x01, 0x48, 0xEE, 0xC8, 0x21, 0x00, 0x69, 0xBB,
+    0x96, 0x43, 0x10, 0x00, 0xAB, 0xA9, 0x42, 0x00, 0x00, 0x00, 0xC7, 0x30,
+    0x00, 0x00, 0x00, 0x00, 0x58, 0xBD, 0xEE, 0xDB, 0x52, 0x09, 0xBB, 0xA9,
+    0x99, 0xBC, 0x73, 0x78, 0x75, 0x44, 0x57, 0xEB, 0x61, 0x00, 0x00, 0x00,
+    0x0C, 0xD9, 0x00, 0x00, 0x00, 0x00, 0xAD, 0x90, 0x00, 0x00, 0x01, 0x2D,
+    0xC7, 0x00, 0x00, 0x01, 0x37, 0xD9, 0x40, 0x00, 0x00, 0x49, 0xEB, 0x40,
+    0x00, 0x00, 0xAD, 0xC7, 0x00, 0x00, 0x01, 0x4D, 0x96, 0x20, 0x00, 0x00,
+    0x27, 0xE6, 0x20, 0x00, 0x00, 0x03, 0x9C, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x33, 0x10, 0x00, 0x00, 0x00, 0x27, 0x72,
+    0x00, 0x00, 0x00, 0x05, 0xEE, 0x50, 0x00, 0x00, 0x00, 0x4C, 0xC4, 0x00,
+    0x00, 0x00, 0x01, 0x44, 0x10, 0x00, 0x00, 0x00, 0x00, 0x7B, 0xDE, 0xEC,
+    0x84, 0x00, 0x00, 0x03, 0x8B, 0x97, 0x77, 0x8A, 0xB4, 0x10, 0x03, 0x7C,
+    0x95, 0x32, 0x24, 0x8C, 0x83, 0x00, 0x7B, 0xC1, 0x00, 0x00, 0x02, 0x6E,
+    0x61, 0x3B, 0xB2, 0x00, 0x00, 0x00, 0x00, 0xC9, 0x57, 0xA8, 0x10, 0x47,
+    0x9A, 0x96, 0x18, 0xA7, 0xA9, 0x60, 0x27, 0xAB, 0xBC, 0x92, 0x6A, 0x8C,
+    0x85, 0x06, 0xBA, 0x45, 0xCB, 0x24, 0xB9, 0xE8, 0x30, 0xC9, 0x40, 0x3B,
+    0xA1, 0x4B, 0xAE, 0x83, 0x0E, 0x83, 0x04, 0xBA, 0x14, 0xB9, 0xF7, 0x30,
+    0xE8, 0x30, 0x5C, 0xA0, 0x5A, 0x9E, 0x83, 0x0E, 0x83, 0x06, 0xCA, 0x06,
+    0xA8, 0xD8, 0x40, 0xAA, 0x83, 0xCD, 0xA5, 0xC9, 0x5B, 0x95, 0x05, 0x9B,
+    0xB9, 0x88, 0xBB, 0x62, 0x9A, 0x70, 0x16, 0x89, 0x53, 0x59, 0x83, 0x05,
+    0xBA, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xCA, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x48, 0xC8, 0x53, 0x22, 0x34, 0x62, 0x10, 0x01, 0x49,
+    0xB9, 0x77, 0x77, 0x89, 0x31, 0x00, 0x00, 0x18, 0xBD, 0xEE, 0xDB, 0x81,
+    0x00, 0x00, 0x00, 0x05, 0xAF, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C,
+    0xFC, 0x40, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xDC, 0xE6, 0x10, 0x00, 0x00,
+    0x00, 0x04, 0xBD, 0x8F, 0x83, 0x00, 0x00, 0x00, 0x00, 0x9D, 0xA1, 0xFB,
+    0x60, 0x00, 0x00, 0x00, 0x0C, 0xC8, 0x0C, 0xC8, 0x00, 0x00, 0x00, 0x12,
+    0xEB, 0x60, 0x9D, 0xA2, 0x00, 0x00, 0x02, 0x5F, 0x94, 0x06, 0xCC, 0x50,
+    0x00, 0x00, 0x3A, 0xF6, 0x10, 0x1A, 0xDA, 0x00, 0x00, 0x05, 0xDD, 0x50,
+    0x00, 0x9D, 0xD1, 0x00, 0x02, 0x7F, 0xD8, 0x55, 0x5A, 0xDF, 0x31, 0x00,
+    0x49, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0x20, 0x07, 0xCF, 0x77, 0x77, 0x77,
+    0x9F, 0xB4, 0x01, 0x9D, 0xC2, 0x22, 0x22, 0x25, 0xCE, 0x51, 0x3B, 0xD8,
+    0x00, 0x00, 0x00, 0x38, 0xF7, 0x27, 0xCB, 0x40, 0x00, 0x00, 0x01, 0x4F,
+    0xA5, 0xCD, 0x90, 0x00, 0x00, 0x00, 0x00, 0xDD, 0x84, 0x43, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x43, 0xFF, 0xFF, 0xFF, 0xFE, 0xC8, 0x40, 0xFE, 0xC9,
+    0x99, 0x9A, 0xCC, 0xA6, 0xFC, 0x94, 0x44, 0x45, 0x8C, 0xDB, 0xFB, 0x60,
+    0x00, 0x00, 0x09, 0xEE, 0xFB, 0x60, 0x00, 0x00, 0x08, 0xDE, 0xFB, 0x60,
+    0x00, 0x01, 0x5B, 0xC9, 0xFD, 0x95, 0x55, 0x56, 0x9A, 0x94, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xC6, 0x20, 0xFD, 0xA6, 0x66, 0x79, 0xED, 0x92, 0xFC, 0x82,
+    0x22, 0x23, 0x6B, 0xC8, 0xFB, 0x60, 0x00, 0x00, 0x2A, 0xDC, 0xFB, 0x60,
+    0x00, 0x00, 0x08, 0xDE, 0xFB, 0x60, 0x00, 0x00, 0x08, 0xDE, 0xFB, 0x60,
+    0x00, 0x00, 0x2A, 0xDC, 0xFC, 0x82, 0x22, 0x23, 0x7C, 0xD8, 0xFD, 0xA6,
+    0x66, 0x78, 0xEE, 0xB3, 0xFF, 0xFF, 0xFF, 0xFE, 0xB6, 0x20, 0x55, 0x55,
+    0x55, 0x55, 0x42, 0x10, 0x00, 0x12, 0x9C, 0xEF, 0xEC, 0xA6, 0x02, 0x5A,
+    0xDB, 0xAA, 0xAB, 0xB8, 0x05, 0x9E, 0xB8, 0x65, 0x57, 0x77, 0x1A, 0xEE,
+    0x31, 0x00, 0x00, 0x00, 0x7C, 0xC6, 0x00, 0x00, 0x00, 0x00, 0xAD, 0xB2,
+    0x00, 0x00, 0x00, 0x00, 0xCD, 0x90, 0x00, 0x00, 0x00, 0x00, 0xED, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0xFC, 0x70, 0x00, 0x00, 0x00, 0x00, 0xED, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0xDD, 0x90, 0x00, 0x00, 0x00, 0x00, 0xCE, 0xA0,
+    0x00, 0x00, 0x00, 0x00, 0x8D, 0xC5, 0x00, 0x00, 0x00, 0x00, 0x4B, 0xDB,
+    0x21, 0x00, 0x00, 0x00, 0x18, 0xCE, 0x74, 0x32, 0x23, 0x34, 0x03, 0x8F,
+    0xFC, 0x97, 0x78, 0xAD, 0x00, 0x12, 0x9C, 0xEF, 0xED, 0xC9, 0x00, 0x01,
+    0x34, 0x55, 0x54, 0x43, 0xFF, 0xFF, 0xED, 0xB8, 0x21, 0x00, 0xFE, 0xC9,
+    0x9A, 0xBD, 0xA5, 0x20, 0xFC, 0x94, 0x46, 0x8A, 0xE9, 0x50, 0xFB, 0x60,
+    0x00, 0x12, 0xDE, 0xA1, 0xFB, 0x60, 0x00, 0x00, 0x5C, 0xD8, 0xFB, 0x60,
+    0x00, 0x00, 0x2A, 0xDA, 0xFB, 0x60, 0x00, 0x00, 0x09, 0xDD, 0xFB, 0x60,
+    0x00, 0x00, 0x08, 0xDE, 0xFB, 0x60, 0x00, 0x00, 0x08, 0xCF, 0xFB, 0x60,
+    0x00, 0x00, 0x08, 0xDE, 0xFB, 0x60, 0x00, 0x00, 0x09, 0xDD, 0xFB, 0x60,
+    0x00, 0x00, 0x0A, 0xEB, 0xFB, 0x60, 0x00, 0x00, 0x6C, 0xC7, 0xFB, 0x60,
+    0x00, 0x12, 0xBD, 0xA3, 0xFC, 0x82, 0x23, 0x57, 0xEB, 0x71, 0xFD, 0xA6,
+    0x79, 0xCF, 0xE7, 0x20, 0xFF, 0xFF, 0xED, 0xB8, 0x10, 0x00, 0x55, 0x55,
+    0x54, 0x43, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0xEC, 0x99,
+    0x99, 0x99, 0x96, 0xFC, 0x94, 0x44, 0x44, 0x44, 0x3F, 0xB6, 0x00, 0x00,
+    0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x0F, 0xB6, 0x00, 0x00, 0x00,
+    0x00, 0xFD, 0x95, 0x55, 0x55, 0x55, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA,
+    0xFD, 0xA7, 0x77, 0x77, 0x77, 0x4F, 0xC8, 0x22, 0x22, 0x22, 0x21, 0xFB,
+    0x60, 0x00, 0x00, 0x00, 0x0F, 0xB6, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60,
+    0x00, 0x00, 0x00, 0x0F, 0xB6, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x82, 0x22,
+    0x22, 0x22, 0x1F, 0xDA, 0x77, 0x77, 0x77, 0x74, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xA5, 0x55, 0x55, 0x55, 0x55, 0x53, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xAF, 0xEC, 0x99, 0x99, 0x99, 0x96, 0xFC, 0x94, 0x44, 0x44, 0x44, 0x3F,
+    0xB6, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x0F, 0xB6,
+    0x00, 0x00, 0x00, 0x00, 0xFD, 0x95, 0x55, 0x55, 0x55, 0x3F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFA, 0xFD, 0xA7, 0x77, 0x77, 0x77, 0x4F, 0xC8, 0x22, 0x22,
+    0x22, 0x21, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x0F, 0xB6, 0x00, 0x00, 0x00,
+    0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x0F, 0xB6, 0x00, 0x00, 0x00, 0x00,
+    0xFB, 0x60, 0x00, 0x00, 0x00, 0x0F, 0xB6, 0x00, 0x00, 0x00, 0x00, 0xFB,
+    0x60, 0x00, 0x00, 0x00, 0x05, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12,
+    0x9C, 0xEF, 0xEC, 0x95, 0x02, 0x5A, 0xDB, 0xAA, 0xAC, 0xA6, 0x05, 0xAE,
+    0xA7, 0x65, 0x68, 0x85, 0x1A, 0xED, 0x21, 0x00, 0x00, 0x00, 0x8D, 0xC5,
+    0x00, 0x00, 0x00, 0x00, 0xAD, 0xA2, 0x00, 0x00, 0x00, 0x00, 0xDD, 0x90,
+    0x00, 0x14, 0x55, 0x55, 0xED, 0x80, 0x00, 0x4D, 0xFF, 0xFF, 0xFC, 0x70,
+    0x00, 0x26, 0x7A, 0xDF, 0xED, 0x80, 0x00, 0x12, 0x28, 0xCF, 0xDD, 0x80,
+    0x00, 0x00, 0x06, 0xBF, 0xCD, 0x90, 0x00, 0x00, 0x06, 0xBF, 0x8D, 0xB4,
+    0x00, 0x00, 0x06, 0xBF, 0x4B, 0xD9, 0x10, 0x00, 0x06, 0xBF, 0x18, 0xCD,
+    0x54, 0x32, 0x38, 0xCF, 0x04, 0x9F, 0xEA, 0x87, 0x8C, 0xEF, 0x00, 0x14,
+    0xBD, 0xEF, 0xDB, 0x96, 0x00, 0x01, 0x44, 0x55, 0x44, 0x32, 0xFB, 0x60,
+    0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60,
+    0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60,
+    0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFD, 0x95,
+    0x55, 0x55, 0x59, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xA7,
+    0x77, 0x77, 0x7A, 0xDF, 0xFC, 0x82, 0x22, 0x22, 0x28, 0xCF, 0xFB, 0x60,
+    0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60,
+    0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60,
+    0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60,
+    0x00, 0x00, 0x06, 0xBF, 0x54, 0x20, 0x00, 0x00, 0x02, 0x45, 0x3B, 0xFF,
+    0xFF, 0xFF, 0xFB, 0x62, 0x68, 0x8D, 0xED, 0x98, 0x53, 0x02, 0x33, 0xBE,
+    0xB4, 0x32, 0x10, 0x00, 0x09, 0xDA, 0x00, 0x00, 0x00, 0x00, 0x9D, 0xA0,
+    0x00, 0x00, 0x00, 0x09, 0xDA, 0x00, 0x00, 0x00, 0x00, 0x9D, 0xA0, 0x00,
+    0x00, 0x00, 0x09, 0xDA, 0x00, 0x00, 0x00, 0x00, 0x9D, 0xA0, 0x00, 0x00,
+    0x00, 0x09, 0xDA, 0x00, 0x00, 0x00, 0x00, 0x9D, 0xA0, 0x00, 0x00, 0x00,
+    0x09, 0xDA, 0x00, 0x00, 0x00, 0x00, 0x9D, 0xA0, 0x00, 0x00, 0x00, 0x09,
+    0xDA, 0x00, 0x00, 0x01, 0x12, 0xAD, 0xB2, 0x11, 0x01, 0x34, 0x5C, 0xEC,
+    0x54, 0x31, 0x3B, 0xFF, 0xFF, 0xFF, 0xFB, 0x61, 0x45, 0x55, 0x55, 0x55,
+    0x42, 0x00, 0x00, 0x00, 0x00, 0xAD, 0xA0, 0x00, 0x00, 0x00, 0x0A, 0xDA,
+    0x00, 0x00, 0x00, 0x00, 0xAD, 0xA0, 0x00, 0x00, 0x00, 0x0A, 0xDA, 0x00,
+    0x00, 0x00, 0x00, 0xAD, 0xA0, 0x00, 0x00, 0x00, 0x0A, 0xDA, 0x00, 0x00,
+    0x00, 0x00, 0xAD, 0xA0, 0x00, 0x00, 0x00, 0x0A, 0xDA, 0x00, 0x00, 0x00,
+    0x00, 0xAD, 0xA0, 0x00, 0x00, 0x00, 0x0A, 0xDA, 0x00, 0x00, 0x00, 0x00,
+    0xAD, 0xA0, 0x00, 0x00, 0x00, 0x0A, 0xDA, 0x00, 0x00, 0x00, 0x00, 0xCD,
+    0x90, 0x00, 0x00, 0x01, 0x3E, 0xC8, 0x43, 0x32, 0x23, 0x58, 0xEA, 0x5D,
+    0xA8, 0x77, 0x9C, 0xFD, 0x61, 0xAC, 0xEF, 0xFD, 0xB8, 0x10, 0x03, 0x45,
+    0x55, 0x44, 0x30, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x4B, 0xDB, 0x00, 0xFB,
+    0x60, 0x00, 0x12, 0xBC, 0xA4, 0x00, 0xFB, 0x60, 0x00, 0x26, 0xDA, 0x60,
+    0x00, 0xFB, 0x60, 0x01, 0x5D, 0xC5, 0x10, 0x00, 0xFB, 0x60, 0x18, 0xCD,
+    0x10, 0x00, 0x00, 0xFB, 0x60, 0x8B, 0xA5, 0x00, 0x00, 0x00, 0xFB, 0x73,
+    0xCA, 0x71, 0x00, 0x00, 0x00, 0xFB, 0x99, 0xF6, 0x10, 0x00, 0x00, 0x00,
+    0xFE, 0xDD, 0xEA, 0x50, 0x00, 0x00, 0x00, 0xFE, 0xB6, 0x9B, 0x92, 0x00,
+    0x00, 0x00, 0xFD, 0x81, 0x4A, 0xB7, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x07,
+    0xCD, 0x10, 0x00, 0x00, 0xFB, 0x60, 0x01, 0x6E, 0xA3, 0x00, 0x00, 0xFB,
+    0x60, 0x00, 0x39, 0xD7, 0x30, 0x00, 0xFB, 0x60, 0x00, 0x14, 0xEB, 0x61,
+    0x00, 0xFB, 0x60, 0x00, 0x00, 0xBD, 0xB3, 0x00, 0xFB, 0x60, 0x00, 0x00,
+    0x2A, 0xED, 0x10, 0x54, 0x20, 0x00, 0x00, 0x13, 0x54, 0x00, 0xFB, 0x60,
+    0x00, 0x00, 0x00, 0x0F, 0xB6, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00,
+    0x00, 0x00, 0x0F, 0xB6, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00,
+    0x00, 0x0F, 0xB6, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00,
+    0x0F, 0xB6, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x0F,
+    0xB6, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x0F, 0xB6,
+    0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x0F, 0xB6, 0x00,
+    0x00, 0x00, 0x00, 0xFC, 0x82, 0x22, 0x22, 0x22, 0x1F, 0xDA, 0x77, 0x77,
+    0x77, 0x74, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA5, 0x55, 0x55, 0x55, 0x55,
+    0x53, 0xFD, 0x80, 0x00, 0x00, 0x09, 0xEF, 0xFE, 0xA1, 0x00, 0x00, 0x2A,
+    0xFF, 0xFE, 0xA3, 0x00, 0x00, 0x4A, 0xEF, 0xFD, 0xA5, 0x00, 0x00, 0x6A,
+    0xDF, 0xFC, 0xA9, 0x00, 0x00, 0x9A, 0xCF, 0xFC, 0xAA, 0x00, 0x00, 0xAA,
+    0xCF, 0xFC, 0xAA, 0x10, 0x01, 0xAA, 0xCF, 0xFC, 0xA9, 0x21, 0x13, 0x8A,
+    0xCF, 0xFC, 0x96, 0x62, 0x27, 0x59, 0xCF, 0xFC, 0x84, 0x83, 0x39, 0x38,
+    0xCF, 0xFC, 0x82, 0xB4, 0x4B, 0x18, 0xCF, 0xFC, 0x70, 0xD4, 0x4D, 0x07,
+    0xCF, 0xFC, 0x70, 0xB7, 0x7A, 0x07, 0xCF, 0xFC, 0x70, 0x9A, 0xA8, 0x07,
+    0xCF, 0xFC, 0x70, 0x7B, 0xB6, 0x07, 0xCF, 0xFC, 0x70, 0x5C, 0xB4, 0x07,
+    0xCF, 0xFC, 0x70, 0x2B, 0xA1, 0x07, 0xCF, 0x54, 0x20, 0x14, 0x30, 0x02,
+    0x45, 0xFE, 0x90, 0x00, 0x00, 0x05, 0xAF, 0xFF, 0xB5, 0x00, 0x00, 0x05,
+    0xAF, 0xFE, 0xC9, 0x00, 0x00, 0x05, 0xAF, 0xFD, 0xDE, 0x10, 0x00, 0x05,
+    0xAF, 0xFA, 0x9D, 0x83, 0x00, 0x05, 0xAF, 0xFA, 0x77, 0xD5, 0x10, 0x05,
+    0xAF, 0xFA, 0x63, 0xE8, 0x30, 0x05, 0xAF, 0xFA, 0x50, 0xBA, 0x70, 0x05,
+    0xAF, 0xFA, 0x50, 0x3B, 0xB3, 0x05, 0xAF, 0xFA, 0x50, 0x18, 0xB9, 0x05,
+    0xAF, 0xFA, 0x50, 0x05, 0x9D, 0x26, 0xAF, 0xFA, 0x50, 0x01, 0x6F, 0x56,
+    0xAF, 0xFA, 0x50, 0x00, 0x38, 0xD9, 0xAF, 0xFA, 0x50, 0x00, 0x13, 0xEC,
+    0xCF, 0xFA, 0x50, 0x00, 0x01, 0xCD, 0xEF, 0xFA, 0x50, 0x00, 0x00, 0x7C,
+    0xFF, 0xFA, 0x50, 0x00, 0x00, 0x09, 0xEF, 0x53, 0x20, 0x00, 0x00, 0x03,
+    0x55, 0x00, 0x38, 0xDE, 0xED, 0x83, 0x00, 0x05, 0x9D, 0xBA, 0xAB, 0xD9,
+    0x40, 0x29, 0xDD, 0x75, 0x57, 0xDC, 0x81, 0x5C, 0xD9, 0x00, 0x00, 0x8D,
+    0xB4, 0xAD, 0xB2, 0x00, 0x00, 0x1A, 0xD9, 0xCD, 0x91, 0x00, 0x00, 0x09,
+    0xDC, 0xDD, 0x80, 0x00, 0x00, 0x08, 0xDD, 0xED, 0x80, 0x00, 0x00, 0x08,
+    0xDE, 0xFC, 0x70, 0x00, 0x00, 0x07, 0xCF, 0xFD, 0x80, 0x00, 0x00, 0x08,
+    0xCE, 0xED, 0x80, 0x00, 0x00, 0x08, 0xDE, 0xDD, 0x90, 0x00, 0x00, 0x09,
+    0xDD, 0xAD, 0xB2, 0x00, 0x00, 0x2B, 0xD9, 0x7C, 0xC6, 0x00, 0x00, 0x6C,
+    0xC6, 0x3A, 0xDB, 0x33, 0x33, 0xBC, 0xA3, 0x07, 0xCF, 0xA8, 0x8A, 0xFB,
+    0x60, 0x00, 0x38, 0xDE, 0xED, 0x73, 0x00, 0x00, 0x13, 0x45, 0x54, 0x21,
+    0x00, 0xFF, 0xFF, 0xFF, 0xED, 0xA6, 0x20, 0xFE, 0xC9, 0x99, 0xAB, 0xDC,
+    0x93, 0xFC, 0x94, 0x44, 0x56, 0xAD, 0xC8, 0xFB, 0x60, 0x00, 0x00, 0x3B,
+    0xED, 0xFB, 0x60, 0x00, 0x00, 0x08, 0xDF, 0xFB, 0x60, 0x00, 0x00, 0x09,
+    0xDD, 0xFB, 0x60, 0x00, 0x11, 0x4B, 0xDB, 0xFB, 0x60, 0x01, 0x23, 0xBE,
+    0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0x40, 0xFE, 0xC9, 0x99, 0x87, 0x53,
+    0x10, 0xFC, 0x94, 0x44, 0x32, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00,
+    0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00,
+    0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00,
+    0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x00, 0x54, 0x20, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x38, 0xDE, 0xED, 0x83, 0x00, 0x05, 0x9D, 0xBA, 0xAB, 0xD9,
+    0x40, 0x29, 0xDD, 0x75, 0x57, 0xDC, 0x81, 0x5C, 0xD9, 0x00, 0x00, 0x8D,
+    0xB4, 0xAD, 0xB2, 0x00, 0x00, 0x1A, 0xD9, 0xCD, 0x91, 0x00, 0x00, 0x09,
+    0xDC, 0xDD, 0x80, 0x00, 0x00, 0x08, 0xDD, 0xED, 0x80, 0x00, 0x00, 0x08,
+    0xDE, 0xFC, 0x70, 0x00, 0x00, 0x07, 0xCF, 0xFD, 0x80, 0x00, 0x00, 0x08,
+    0xCE, 0xED, 0x80, 0x00, 0x00, 0x08, 0xDD, 0xDD, 0x90, 0x00, 0x00, 0x09,
+    0xDD, 0xAD, 0xB2, 0x00, 0x00, 0x2B, 0xD9, 0x7C, 0xC6, 0x00, 0x00, 0x6C,
+    0xC6, 0x3A, 0xDB, 0x33, 0x33, 0xBC, 0xA3, 0x07, 0xCF, 0xA8, 0x8A, 0xFB,
+    0x60, 0x00, 0x38, 0xDE, 0xFF, 0xC4, 0x00, 0x00, 0x13, 0x45, 0x7B, 0xE7,
+    0x20, 0x00, 0x00, 0x00, 0x26, 0xEA, 0x72, 0x00, 0x00, 0x00, 0x01, 0xCE,
+    0xC7, 0x00, 0x00, 0x00, 0x00, 0x17, 0x96, 0x00, 0x00, 0x00, 0x00, 0x02,
+    0x32, 0xFF, 0xFF, 0xFF, 0xED, 0x95, 0x20, 0x00, 0x0F, 0xEC, 0x99, 0x9A,
+    0xAD, 0xB8, 0x30, 0x00, 0xFC, 0x94, 0x44, 0x56, 0xAD, 0xC7, 0x00, 0x0F,
+    0xB6, 0x00, 0x00, 0x02, 0xBE, 0xC0, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x08,
+    0xDF, 0x00, 0x0F, 0xB6, 0x00, 0x00, 0x00, 0x9D, 0xD0, 0x00, 0xFB, 0x60,
+    0x00, 0x11, 0x4B, 0xDA, 0x00, 0x0F, 0xB6, 0x00, 0x12, 0x3B, 0xEB, 0x50,
+    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xB6, 0x20, 0x00, 0x0F, 0xEC, 0x99, 0xBD,
+    0xF7, 0x31, 0x00, 0x00, 0xFC, 0x94, 0x46, 0xAE, 0x83, 0x00, 0x00, 0x0F,
+    0xB6, 0x00, 0x15, 0xDE, 0x61, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x13, 0xFC,
+    0x70, 0x00, 0x0F, 0xB6, 0x00, 0x00, 0x19, 0xCB, 0x50, 0x00, 0xFB, 0x60,
+    0x00, 0x00, 0x4A, 0xC9, 0x10, 0x0F, 0xB6, 0x00, 0x00, 0x00, 0x7C, 0xF3,
+    0x10, 0xFB, 0x60, 0x00, 0x00, 0x01, 0x5D, 0xD5, 0x05, 0x42, 0x00, 0x00,
+    0x00, 0x02, 0x44, 0x20, 0x02, 0x5A, 0xDE, 0xEE, 0xDB, 0x96, 0x49, 0xBC,
+    0xAA, 0xAA, 0xBC, 0xB8, 0x8C, 0xC9, 0x65, 0x55, 0x68, 0x86, 0xDD, 0x91,
+    0x00, 0x00, 0x00, 0x00, 0xEC, 0x70, 0x00, 0x00, 0x00, 0x00, 0xCD, 0xA3,
+    0x00, 0x00, 0x00, 0x00, 0x8C, 0xC7, 0x42, 0x10, 0x00, 0x00, 0x2A, 0xEF,
+    0xB7, 0x41, 0x00, 0x00, 0x01, 0x37, 0xDE, 0xFE, 0xA5, 0x20, 0x00, 0x12,
+    0x46, 0x8B, 0xDB, 0x83, 0x00, 0x00, 0x01, 0x36, 0xAD, 0xC7, 0x00, 0x00,
+    0x00, 0x00, 0x2A, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xCF, 0x00, 0x00,
+    0x00, 0x00, 0x19, 0xDD, 0x54, 0x33, 0x22, 0x23, 0x5B, 0xC9, 0xFC, 0xA8,
+    0x77, 0x78, 0xEE, 0xB4, 0x9B, 0xDE, 0xFF, 0xED, 0x95, 0x20, 0x34, 0x45,
+    0x55, 0x54, 0x32, 0x10, 0x9D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x68,
+    0x99, 0x9C, 0xEF, 0x99, 0x99, 0x93, 0x34, 0x44, 0x49, 0xCF, 0x54, 0x44,
+    0x41, 0x00, 0x00, 0x06, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x06, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x06, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
+    0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x06, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x06, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x45, 0x00, 0x00, 0x00, 0xFB, 0x60,
+    0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60,
+    0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60,
+    0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60,
+    0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60,
+    0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFC, 0x70,
+    0x00, 0x00, 0x07, 0xCF, 0xFC, 0x70, 0x00, 0x00, 0x07, 0xCF, 0xDD, 0x80,
+    0x00, 0x00, 0x08, 0xDD, 0xBD, 0xA3, 0x00, 0x00, 0x3A, 0xDB, 0x7C, 0xC8,
+    0x33, 0x33, 0x8C, 0xC7, 0x2A, 0xEF, 0x98, 0x89, 0xFE, 0xA2, 0x02, 0x5A,
+    0xEE, 0xEE, 0xA5, 0x10, 0x01, 0x23, 0x55, 0x55, 0x32, 0x00, 0xCD, 0x90,
+    0x00, 0x00, 0x00, 0x00, 0xED, 0x89, 0xDA, 0x20, 0x00, 0x00, 0x01, 0x3F,
+    0xB6, 0x5C, 0xC5, 0x00, 0x00, 0x00, 0x26, 0xF8, 0x32, 0xAD, 0x90, 0x00,
+    0x00, 0x03, 0x9F, 0x61, 0x07, 0xCE, 0x00, 0x00, 0x00, 0x5E, 0xB4, 0x00,
+    0x5A, 0xF3, 0x10, 0x00, 0x27, 0xF8, 0x30, 0x03, 0x8F, 0x62, 0x00, 0x04,
+    0x9F, 0x41, 0x00, 0x15, 0xE9, 0x30, 0x00, 0x6B, 0xF1, 0x00, 0x00, 0x3A,
+    0xE5, 0x00, 0x09, 0xDA, 0x00, 0x00, 0x02, 0x6F, 0x72, 0x03, 0xBC, 0x60,
+    0x00, 0x00, 0x13, 0xF9, 0x40, 0x6C, 0xB3, 0x00, 0x00, 0x00, 0x0E, 0xB6,
+    0x0A, 0xC9, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xA1, 0xEB, 0x60, 0x00, 0x00,
+    0x00, 0x05, 0xBB, 0x5F, 0x84, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xDA, 0xE6,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x8D, 0xED, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0x05, 0xAF, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x53, 0x10, 0x00,
+    0x00, 0xEA, 0x50, 0x00, 0x00, 0x00, 0x00, 0x8C, 0x9D, 0xB6, 0x00, 0x00,
+    0x00, 0x00, 0x09, 0xC9, 0xCB, 0x70, 0x00, 0x00, 0x00, 0x00, 0xAB, 0x8B,
+    0xB8, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xB7, 0x9C, 0x90, 0x00, 0x00, 0x00,
+    0x00, 0xCA, 0x68, 0xC9, 0x00, 0x15, 0xA2, 0x10, 0x0D, 0xA5, 0x7C, 0xA0,
+    0x03, 0x8E, 0x52, 0x00, 0xE9, 0x55, 0xCA, 0x10, 0x6A, 0xD8, 0x30, 0x0F,
+    0x94, 0x4B, 0xB2, 0x09, 0xB5, 0xE5, 0x01, 0xF8, 0x33, 0xBB, 0x33, 0xA9,
+    0x2E, 0x63, 0x2F, 0x72, 0x1A, 0xB4, 0x69, 0x70, 0xC8, 0x53, 0xF6, 0x10,
+    0xAB, 0x5A, 0x85, 0x09, 0x98, 0x4F, 0x50, 0x09, 0xB6, 0xE6, 0x20, 0x4B,
+    0xB6, 0xE5, 0x00, 0x8B, 0x9D, 0x51, 0x02, 0xAC, 0x9D, 0x40, 0x07, 0xBC,
+    0xA3, 0x00, 0x08, 0xCC, 0xC4, 0x00, 0x7C, 0xF7, 0x20, 0x00, 0x6B, 0xFA,
+    0x30, 0x05, 0xAF, 0x21, 0x00, 0x03, 0x8F, 0x93, 0x00, 0x23, 0x51, 0x00,
+    0x00, 0x13, 0x53, 0x10, 0xAD, 0xA2, 0x00, 0x00, 0x00, 0x12, 0xEB, 0x64,
+    0xAC, 0x80, 0x00, 0x00, 0x03, 0x8D, 0x73, 0x17, 0xBD, 0x31, 0x00, 0x01,
+    0x6C, 0xA4, 0x00, 0x27, 0xF7, 0x20, 0x00, 0x49, 0xF3, 0x10, 0x00, 0x38,
+    0xF7, 0x20, 0x3B, 0xC7, 0x00, 0x00, 0x01, 0x3D, 0xB6, 0x19, 0xB9, 0x30,
+    0x00, 0x00, 0x00, 0x9C, 0xA5, 0xDA, 0x60, 0x00, 0x00, 0x00, 0x02, 0xAE,
+    0xDE, 0x61, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0x93, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0x9D, 0xDD, 0x61, 0x00, 0x00, 0x00, 0x00, 0x6B, 0xC8, 0xE9,
+    0x40, 0x00, 0x00, 0x00, 0x1D, 0xB7, 0x0C, 0xC9, 0x10, 0x00, 0x00, 0x39,
+    0xE6, 0x10, 0x3B, 0xD9, 0x00, 0x00, 0x26, 0xD8, 0x30, 0x01, 0x7B, 0xD3,
+    0x10, 0x05, 0x9D, 0x41, 0x00, 0x03, 0x8E, 0x73, 0x01, 0x9C, 0xA0, 0x00,
+    0x00, 0x04, 0xCD, 0x51, 0xAC, 0xA1, 0x00, 0x00, 0x00, 0x13, 0xFB, 0x73,
+    0x43, 0x00, 0x00, 0x00, 0x00, 0x15, 0x42, 0x6C, 0xC6, 0x00, 0x00, 0x01,
+    0x5E, 0xB4, 0x2A, 0xDA, 0x00, 0x00, 0x03, 0x8F, 0x62, 0x07, 0xBD, 0x21,
+    0x00, 0x06, 0xBE, 0x31, 0x04, 0x9F, 0x41, 0x00, 0x09, 0xDB, 0x00, 0x00,
+    0x4D, 0xB4, 0x00, 0x6C, 0xB4, 0x00, 0x00, 0x38, 0xE6, 0x10, 0xAC, 0x91,
+    0x00, 0x00, 0x14, 0xE8, 0x41, 0xDA, 0x60, 0x00, 0x00, 0x00, 0xDB, 0x84,
+    0xF8, 0x30, 0x00, 0x00, 0x00, 0x6C, 0xEC, 0xB4, 0x00, 0x00, 0x00, 0x00,
+    0x2A, 0xEE, 0x62, 0x00, 0x00, 0x00, 0x00, 0x08, 0xDF, 0x31, 0x00, 0x00,
+    0x00, 0x00, 0x06, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
+    0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x06, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x45, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x99, 0x99, 0x99, 0x99, 0xAD,
+    0xED, 0x44, 0x44, 0x44, 0x44, 0x8C, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x9D,
+    0xB2, 0x00, 0x00, 0x00, 0x14, 0xF9, 0x40, 0x00, 0x00, 0x00, 0x4A, 0xC6,
+    0x10, 0x00, 0x00, 0x03, 0x7E, 0x83, 0x00, 0x00, 0x00, 0x07, 0xBE, 0x21,
+    0x00, 0x00, 0x00, 0x5C, 0xC5, 0x00, 0x00, 0x00, 0x01, 0xBB, 0x82, 0x00,
+    0x00, 0x00, 0x25, 0xE9, 0x50, 0x00, 0x00, 0x00, 0x4B, 0xD5, 0x10, 0x00,
+    0x00, 0x05, 0xAF, 0x41, 0x00, 0x00, 0x00, 0x29, 0xCB, 0x10, 0x00, 0x00,
+    0x00, 0x6C, 0xC8, 0x22, 0x22, 0x22, 0x22, 0xCE, 0xC7, 0x77, 0x77, 0x77,
+    0x77, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0xFF, 0xFF, 0xF5, 0xFD, 0xB8, 0x83, 0xFC, 0x83, 0x31, 0xFC, 0x70,
+    0x00, 0xFC, 0x70, 0x00, 0xFC, 0x70, 0x00, 0xFC, 0x70, 0x00, 0xFC, 0x70,
+    0x00, 0xFC, 0x70, 0x00, 0xFC, 0x70, 0x00, 0xFC, 0x70, 0x00, 0xFC, 0x70,
+    0x00, 0xFC, 0x70, 0x00, 0xFC, 0x70, 0x00, 0xFC, 0x70, 0x00, 0xFC, 0x70,
+    0x00, 0xFC, 0x70, 0x00, 0xFC, 0x70, 0x00, 0xFC, 0x72, 0x21, 0xFD, 0x95,
+    0x52, 0xFF, 0xFF, 0xF5, 0x55, 0x55, 0x52, 0xCC, 0x80, 0x00, 0x00, 0x00,
+    0x8C, 0xA2, 0x00, 0x00, 0x00, 0x4B, 0xB5, 0x00, 0x00, 0x00, 0x09, 0xC9,
+    0x00, 0x00, 0x00, 0x05, 0xAE, 0x10, 0x00, 0x00, 0x03, 0x8F, 0x52, 0x00,
+    0x00, 0x01, 0x5D, 0x93, 0x00, 0x00, 0x00, 0x4B, 0xD4, 0x00, 0x00, 0x00,
+    0x14, 0xF8, 0x30, 0x00, 0x00, 0x12, 0xEA, 0x60, 0x00, 0x00, 0x00, 0xBC,
+    0x81, 0x00, 0x00, 0x00, 0x7C, 0xB2, 0x00, 0x00, 0x00, 0x1A, 0xC8, 0x00,
+    0x00, 0x00, 0x08, 0xBC, 0x00, 0x00, 0x00, 0x05, 0xAE, 0x21, 0x00, 0x00,
+    0x02, 0x7F, 0x62, 0x00, 0x00, 0x00, 0x4C, 0xC4, 0x00, 0x00, 0x00, 0x14,
+    0x41, 0xFF, 0xFF, 0xF5, 0x88, 0xAD, 0xF5, 0x33, 0x6B, 0xF5, 0x00, 0x3A,
+    0xF5, 0x00, 0x3A, 0xF5, 0x00, 0x3A, 0xF5, 0x00, 0x3A, 0xF5, 0x00, 0x3A,
+    0xF5, 0x00, 0x3A, 0xF5, 0x00, 0x3A, 0xF5, 0x00, 0x3A, 0xF5, 0x00, 0x3A,
+    0xF5, 0x00, 0x3A, 0xF5, 0x00, 0x3A, 0xF5, 0x00, 0x3A, 0xF5, 0x00, 0x3A,
+    0xF5, 0x00, 0x3A, 0xF5, 0x00, 0x3A, 0xF5, 0x22, 0x5A, 0xF5, 0x55, 0x7B,
+    0xF5, 0xFF, 0xFF, 0xF5, 0x55, 0x55, 0x52, 0x00, 0x00, 0x3B, 0xB3, 0x00,
+    0x00, 0x00, 0x00, 0x8C, 0xC8, 0x00, 0x00, 0x00, 0x01, 0xCB, 0xBC, 0x10,
+    0x00, 0x00, 0x13, 0xF7, 0x7F, 0x31, 0x00, 0x00, 0x4B, 0x93, 0x39, 0xB4,
+    0x00, 0x02, 0x6E, 0x41, 0x14, 0xD6, 0x10, 0x04, 0x8D, 0x10, 0x01, 0xD8,
+    0x40, 0x07, 0xB9, 0x00, 0x00, 0xAA, 0x70, 0x4B, 0xB2, 0x00, 0x00, 0x2B,
+    0xB4, 0x9B, 0x81, 0x00, 0x00, 0x18, 0xB9, 0x87, 0x40, 0x00, 0x00, 0x04,
+    0x77, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA7, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x75, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20,
+    0xCE, 0xA2, 0x6C, 0xC5, 0x29, 0xB9, 0x05, 0x9D, 0x15, 0x8C, 0xEE, 0xED,
+    0x83, 0x01, 0x8B, 0xA9, 0x99, 0xBD, 0x84, 0x16, 0x86, 0x44, 0x57, 0xEB,
+    0x70, 0x00, 0x00, 0x00, 0x0C, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x9D, 0xA0,
+    0x24, 0x78, 0x99, 0xAD, 0xEA, 0x26, 0x9A, 0xAA, 0xAA, 0xDE, 0xA7, 0xCE,
+    0xB5, 0x43, 0x2A, 0xDA, 0xED, 0x80, 0x00, 0x00, 0xAD, 0xAE, 0xC8, 0x00,
+    0x00, 0x1D, 0xEA, 0xDC, 0x92, 0x12, 0x35, 0xDE, 0xAA, 0xDC, 0x74, 0x69,
+    0xDC, 0xEA, 0x17, 0xBE, 0xFD, 0xA6, 0x4B, 0xA0, 0x24, 0x55, 0x43, 0x21,
+    0x43, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00,
+    0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00,
+    0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x74, 0x89, 0xA9, 0x73,
+    0x10, 0xFC, 0x98, 0xBB, 0xCC, 0xB8, 0x40, 0xFE, 0xDE, 0x76, 0x68, 0xEE,
+    0x91, 0xFF, 0xA2, 0x00, 0x00, 0x4B, 0xD8, 0xFD, 0x81, 0x00, 0x00, 0x19,
+    0xDB, 0xFC, 0x70, 0x00, 0x00, 0x08, 0xCD, 0xFB, 0x60, 0x00, 0x00, 0x07,
+    0xCF, 0xFB, 0x60, 0x00, 0x00, 0x07, 0xCE, 0xFC, 0x70, 0x00, 0x00, 0x08,
+    0xCD, 0xFD, 0x81, 0x00, 0x00, 0x19, 0xDB, 0xFF, 0xB2, 0x00, 0x00, 0x4B,
+    0xD8, 0xFE, 0xDE, 0x86, 0x68, 0xEE, 0x91, 0xFA, 0x78, 0xBB, 0xCC, 0xB8,
+    0x40, 0xA5, 0x34, 0x89, 0xA9, 0x73, 0x10, 0x01, 0x4A, 0xEE, 0xED, 0x93,
+    0x17, 0xBD, 0xA9, 0x9A, 0x93, 0x4B, 0xDB, 0x54, 0x45, 0x62, 0x8D, 0xB4,
+    0x00, 0x00, 0x00, 0xDD, 0x90, 0x00, 0x00, 0x00, 0xEC, 0x80, 0x00, 0x00,
+    0x00, 0xFC, 0x70, 0x00, 0x00, 0x00, 0xFC, 0x70, 0x00, 0x00, 0x00, 0xDD,
+    0x80, 0x00, 0x00, 0x00, 0xAD, 0xA3, 0x00, 0x00, 0x00, 0x6C, 0xC7, 0x32,
+    0x22, 0x41, 0x1A, 0xEE, 0x86, 0x67, 0xB4, 0x01, 0x4A, 0xEE, 0xED, 0xA3,
+    0x00, 0x13, 0x55, 0x54, 0x31, 0x00, 0x00, 0x00, 0x00, 0x9D, 0xA0, 0x00,
+    0x00, 0x00, 0x09, 0xDA, 0x00, 0x00, 0x00, 0x00, 0x9D, 0xA0, 0x00, 0x00,
+    0x00, 0x09, 0xDA, 0x00, 0x00, 0x00, 0x00, 0x9D, 0xA0, 0x24, 0x8A, 0x97,
+    0x49, 0xDA, 0x15, 0x9C, 0xCB, 0xA9, 0xAD, 0xA2, 0xAE, 0xD7, 0x79, 0xDD,
+    0xEA, 0x9D, 0xB2, 0x00, 0x01, 0xEF, 0xAC, 0xD9, 0x10, 0x00, 0x0C, 0xEA,
+    0xEC, 0x80, 0x00, 0x00, 0xAD, 0xAF, 0xC7, 0x00, 0x00, 0x09, 0xDA, 0xFC,
+    0x70, 0x00, 0x00, 0x9D, 0xAE, 0xC8, 0x00, 0x00, 0x0A, 0xDA, 0xCD, 0x91,
+    0x00, 0x00, 0xCE, 0xA9, 0xDB, 0x20, 0x00, 0x1E, 0xFA, 0x2A, 0xED, 0x66,
+    0x8C, 0xDE, 0xA1, 0x59, 0xCC, 0xBA, 0x98, 0xDA, 0x02, 0x48, 0xA9, 0x74,
+    0x48, 0x70, 0x00, 0x38, 0xDE, 0xEE, 0xA5, 0x10, 0x05, 0x9C, 0xA9, 0x99,
+    0xCB, 0x71, 0x39, 0xCB, 0x54, 0x45, 0x9C, 0xB5, 0x7C, 0xB3, 0x00, 0x00,
+    0x1A, 0xDA, 0xCC, 0x80, 0x00, 0x00, 0x07, 0xCE, 0xEE, 0xDA, 0xAA, 0xAA,
+    0xAC, 0xEF, 0xEE, 0xDC, 0xCC, 0xCC, 0xCC, 0xCC, 0xFD, 0xA5, 0x55, 0x55,
+    0x55, 0x55, 0xCD, 0x90, 0x00, 0x00, 0x00, 0x00, 0x9C, 0xB3, 0x00, 0x00,
+    0x00, 0x00, 0x5B, 0xC8, 0x32, 0x22, 0x23, 0x32, 0x07, 0xCF, 0x97, 0x66,
+    0x7A, 0xA7, 0x00, 0x27, 0xCE, 0xEE, 0xDB, 0x73, 0x00, 0x12, 0x45, 0x55,
+    0x44, 0x21, 0x00, 0x00, 0x17, 0xBE, 0xFE, 0xDB, 0x00, 0x00, 0x7B, 0xCA,
+    0x89, 0x87, 0x00, 0x00, 0xBD, 0xB5, 0x44, 0x44, 0x00, 0x00, 0xEB, 0x70,
+    0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x89, 0x9A, 0xFE, 0xCA,
+    0xAA, 0x70, 0x9A, 0xBB, 0xFE, 0xDB, 0xBB, 0x80, 0x44, 0x44, 0xFC, 0x84,
+    0x44, 0x30, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60,
+    0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60,
+    0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60,
+    0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60,
+    0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60,
+    0x00, 0x00, 0x00, 0x00, 0xA7, 0x40, 0x00, 0x00, 0x00, 0x26, 0xCD, 0xEF,
+    0xFF, 0xFF, 0xF6, 0x10, 0x48, 0xC9, 0x87, 0x7A, 0xDE, 0xC6, 0x20, 0x07,
+    0xBD, 0x53, 0x22, 0x5B, 0xDB, 0x10, 0x00, 0x9D, 0xA0, 0x00, 0x00, 0x7B,
+    0xE0, 0x00, 0x09, 0xDA, 0x00, 0x00, 0x07, 0xBE, 0x00, 0x00, 0x7B, 0xD4,
+    0x21, 0x14, 0xAC, 0xA0, 0x00, 0x04, 0x8D, 0x97, 0x66, 0x8B, 0xA6, 0x00,
+    0x00, 0x03, 0x8F, 0xFF, 0xEC, 0x84, 0x00, 0x00, 0x00, 0x4B, 0xA4, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0xD9, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x4C, 0xB7, 0x55, 0x55, 0x43, 0x00, 0x00, 0x03, 0x9F, 0xFF, 0xFF, 0xEC,
+    0x91, 0x00, 0x39, 0xB9, 0x65, 0x55, 0x57, 0xAE, 0xB4, 0x09, 0xA8, 0x32,
+    0x22, 0x22, 0x25, 0xAD, 0x40, 0xDB, 0x70, 0x00, 0x00, 0x00, 0x3A, 0xE5,
+    0x0E, 0xB6, 0x00, 0x00, 0x00, 0x04, 0xBD, 0x40, 0x9D, 0xD9, 0x54, 0x45,
+    0x7A, 0xDF, 0x52, 0x03, 0x7A, 0xBB, 0xBB, 0xBB, 0xA9, 0x72, 0x10, 0x03,
+    0x68, 0xAA, 0xAA, 0x87, 0x52, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00,
+    0x0F, 0xB6, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x0F,
+    0xB6, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x0F, 0xB7,
+    0x49, 0x99, 0x95, 0x20, 0xFC, 0xA9, 0xBB, 0xCC, 0xA5, 0x2F, 0xED, 0xE7,
+    0x67, 0xAF, 0xA5, 0xFF, 0xB3, 0x00, 0x00, 0xCD, 0x9F, 0xD9, 0x10, 0x00,
+    0x0A, 0xD9, 0xFC, 0x70, 0x00, 0x00, 0x9D, 0xAF, 0xB6, 0x00, 0x00, 0x09,
+    0xDA, 0xFB, 0x60, 0x00, 0x00, 0x9D, 0xAF, 0xB6, 0x00, 0x00, 0x09, 0xDA,
+    0xFB, 0x60, 0x00, 0x00, 0x9D, 0xAF, 0xB6, 0x00, 0x00, 0x09, 0xDA, 0xFB,
+    0x60, 0x00, 0x00, 0x9D, 0xAF, 0xB6, 0x00, 0x00, 0x09, 0xDA, 0xA7, 0x40,
+    0x00, 0x00, 0x69, 0x70, 0x00, 0x00, 0x09, 0xB8, 0x00, 0x00, 0x00, 0x00,
+    0x09, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x06, 0x75, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x6A,
+    0xAA, 0x96, 0x00, 0x00, 0x02, 0x6B, 0xBE, 0xD9, 0x00, 0x00, 0x00, 0x12,
+    0x3B, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0xD9, 0x00, 0x00, 0x01, 0x22, 0x3B, 0xDA, 0x32, 0x21, 0x07, 0xBB,
+    0xBE, 0xED, 0xBB, 0xA7, 0x07, 0xAA, 0xAA, 0xAA, 0xAA, 0x97, 0x00, 0x00,
+    0x07, 0xAB, 0x00, 0x00, 0x07, 0xAB, 0x00, 0x00, 0x04, 0x77, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xAA, 0xAA, 0xAA, 0x07, 0xBB,
+    0xBD, 0xEF, 0x01, 0x22, 0x38, 0xCF, 0x00, 0x00, 0x06, 0xBF, 0x00, 0x00,
+    0x06, 0xBF, 0x00, 0x00, 0x06, 0xBF, 0x00, 0x00, 0x06, 0xBF, 0x00, 0x00,
+    0x06, 0xBF, 0x00, 0x00, 0x06, 0xBF, 0x00, 0x00, 0x06, 0xBF, 0x00, 0x00,
+    0x06, 0xBF, 0x00, 0x00, 0x06, 0xBF, 0x00, 0x00, 0x06, 0xBF, 0x00, 0x00,
+    0x06, 0xBF, 0x00, 0x00, 0x06, 0xBF, 0x00, 0x00, 0x08, 0xCD, 0x64, 0x44,
+    0x6B, 0xC9, 0xA9, 0x98, 0xBC, 0xA5, 0xCD, 0xEF, 0xD9, 0x50, 0xFB, 0x60,
+    0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60,
+    0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60,
+    0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x14, 0xA6, 0x30, 0xFB, 0x60,
+    0x01, 0x49, 0xC7, 0x30, 0xFB, 0x60, 0x04, 0x9F, 0x62, 0x00, 0xFB, 0x60,
+    0x5B, 0xB5, 0x00, 0x00, 0xFB, 0x63, 0xB8, 0x52, 0x00, 0x00, 0xFB, 0x88,
+    0xC5, 0x20, 0x00, 0x00, 0xFC, 0xBE, 0x72, 0x00, 0x00, 0x00, 0xFF, 0xD9,
+    0xE8, 0x30, 0x00, 0x00, 0xFC, 0x83, 0x8A, 0x82, 0x00, 0x00, 0xFB, 0x60,
+    0x49, 0xB7, 0x10, 0x00, 0xFB, 0x60, 0x05, 0xAE, 0x31, 0x00, 0xFB, 0x60,
+    0x00, 0x3A, 0xE6, 0x20, 0xFB, 0x60, 0x00, 0x14, 0xCB, 0x71, 0xA7, 0x40,
+    0x00, 0x00, 0x89, 0x61, 0x03, 0x8F, 0xFF, 0xD9, 0x00, 0x00, 0x01, 0x36,
+    0x7C, 0xD9, 0x00, 0x00, 0x00, 0x11, 0x2B, 0xD9, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0xD9, 0x00, 0x00, 0x01, 0x22, 0x3B, 0xDA, 0x32, 0x21, 0x07, 0xBB,
+    0xBE, 0xED, 0xBB, 0xA7, 0x07, 0xAA, 0xAA, 0xAA, 0xAA, 0x97, 0xF9, 0x8C,
+    0xC5, 0x5C, 0xE7, 0x3F, 0xCA, 0xAE, 0xA9, 0x9E, 0xB6, 0xFD, 0xA6, 0xFD,
+    0x95, 0xCC, 0x8F, 0xC7, 0x1F, 0xD8, 0x0A, 0xD9, 0xFB, 0x60, 0xFB, 0x60,
+    0x9D, 0xAF, 0xB6, 0x0F, 0xB6, 0x09, 0xDA, 0xFB, 0x60, 0xFB, 0x60, 0x9D,
+    0xAF, 0xB6, 0x0F, 0xB6, 0x09, 0xDA, 0xFB, 0x60, 0xFB, 0x60, 0x9D, 0xAF,
+    0xB6, 0x0F, 0xB6, 0x09, 0xDA, 0xFB, 0x60, 0xFB, 0x60, 0x9D, 0xAF, 0xB6,
+    0x0F, 0xB6, 0x09, 0xDA, 0xFB, 0x60, 0xFB, 0x60, 0x9D, 0xA5, 0x42, 0x05,
+    0x42, 0x03, 0x43, 0xF9, 0x66, 0xDE, 0xED, 0x83, 0x0F, 0xCB, 0xB9, 0x99,
+    0xBD, 0x73, 0xFE, 0xCA, 0x54, 0x57, 0xEB, 0x6F, 0xFB, 0x30, 0x00, 0x0C,
+    0xD9, 0xFD, 0x80, 0x00, 0x00, 0x9D, 0xAF, 0xC7, 0x00, 0x00, 0x09, 0xDA,
+    0xFB, 0x60, 0x00, 0x00, 0x9D, 0xAF, 0xB6, 0x00, 0x00, 0x09, 0xDA, 0xFB,
+    0x60, 0x00, 0x00, 0x9D, 0xAF, 0xB6, 0x00, 0x00, 0x09, 0xDA, 0xFB, 0x60,
+    0x00, 0x00, 0x9D, 0xAF, 0xB6, 0x00, 0x00, 0x09, 0xDA, 0xFB, 0x60, 0x00,
+    0x00, 0x9D, 0xA5, 0x42, 0x00, 0x00, 0x03, 0x43, 0x01, 0x38, 0xDE, 0xED,
+    0x83, 0x00, 0x06, 0xAC, 0xA9, 0x9A, 0xC9, 0x50, 0x3A, 0xCB, 0x54, 0x45,
+    0xBC, 0x93, 0x8D, 0xB4, 0x00, 0x00, 0x4B, 0xC7, 0xDD, 0x80, 0x00, 0x00,
+    0x09, 0xDC, 0xEC, 0x80, 0x00, 0x00, 0x08, 0xCE, 0xFC, 0x70, 0x00, 0x00,
+    0x07, 0xCE, 0xFC, 0x70, 0x00, 0x00, 0x07, 0xCE, 0xCD, 0x90, 0x00, 0x00,
+    0x09, 0xDC, 0x9C, 0xA3, 0x00, 0x00, 0x3A, 0xD9, 0x5B, 0xC8, 0x32, 0x23,
+    0x8C, 0xB5, 0x08, 0xDE, 0x86, 0x68, 0xED, 0x81, 0x01, 0x38, 0xDE, 0xED,
+    0x83, 0x10, 0x00, 0x13, 0x45, 0x54, 0x31, 0x00, 0xFA, 0x64, 0xCE, 0xEE,
+    0xA5, 0x10, 0xFC, 0xBA, 0x99, 0x9A, 0xDB, 0x71, 0xFE, 0xCA, 0x54, 0x45,
+    0xBD, 0xB4, 0xFF, 0xA2, 0x00, 0x00, 0x4B, 0xD8, 0xFC, 0x70, 0x00, 0x00,
+    0x08, 0xDD, 0xFC, 0x70, 0x00, 0x00, 0x08, 0xCE, 0xFB, 0x60, 0x00, 0x00,
+    0x07, 0xCF, 0xFB, 0x60, 0x00, 0x00, 0x07, 0xCE, 0xFC, 0x70, 0x00, 0x00,
+    0x09, 0xDD, 0xFE, 0x91, 0x00, 0x00, 0x3A, 0xDA, 0xFE, 0xB6, 0x32, 0x23,
+    0x7C, 0xC6, 0xFE, 0xDE, 0x86, 0x68, 0xEE, 0x91, 0xFB, 0x75, 0xCE, 0xEE,
+    0xA4, 0x10, 0xFB, 0x62, 0x45, 0x55, 0x31, 0x00, 0xFB, 0x60, 0x00, 0x00,
+    0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00,
+    0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x00, 0xA7, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x6C, 0xFE, 0xB6, 0x5C, 0xA1, 0x8B, 0xD9, 0x99, 0xBA,
+    0xDA, 0x4B, 0xDA, 0x44, 0x69, 0xDE, 0xA9, 0xDB, 0x20, 0x00, 0x1E, 0xFA,
+    0xDC, 0x80, 0x00, 0x00, 0xBE, 0xAE, 0xC7, 0x00, 0x00, 0x0A, 0xDA, 0xFC,
+    0x70, 0x00, 0x00, 0x9D, 0xAF, 0xC7, 0x00, 0x00, 0x09, 0xDA, 0xDC, 0x80,
+    0x00, 0x00, 0xBE, 0xAB, 0xDA, 0x20, 0x00, 0x1D, 0xEA, 0x7C, 0xC6, 0x22,
+    0x35, 0xEF, 0xA2, 0xAE, 0xD6, 0x68, 0xCD, 0xEA, 0x02, 0x6C, 0xFE, 0xB7,
+    0x8D, 0xA0, 0x12, 0x45, 0x54, 0x29, 0xDA, 0x00, 0x00, 0x00, 0x00, 0x9D,
+    0xA0, 0x00, 0x00, 0x00, 0x09, 0xDA, 0x00, 0x00, 0x00, 0x00, 0x9D, 0xA0,
+    0x00, 0x00, 0x00, 0x09, 0xDA, 0x00, 0x00, 0x00, 0x00, 0x69, 0x70, 0xF8,
+    0x43, 0xBD, 0xEE, 0xA3, 0xFA, 0x8A, 0x99, 0x9A, 0x93, 0xFC, 0xAA, 0x54,
+    0x45, 0x52, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0xFD, 0x80, 0x00, 0x00, 0x00,
+    0xFC, 0x70, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0xFB, 0x60,
+    0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00,
+    0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0xFB,
+    0x60, 0x00, 0x00, 0x00, 0x54, 0x20, 0x00, 0x00, 0x00, 0x16, 0xAD, 0xFE,
+    0xDC, 0x72, 0x7A, 0xB9, 0x89, 0x9B, 0x83, 0xCC, 0xA5, 0x44, 0x57, 0x62,
+    0xEB, 0x60, 0x00, 0x00, 0x00, 0xCD, 0xB6, 0x00, 0x00, 0x00, 0x5A, 0xCC,
+    0x97, 0x41, 0x00, 0x16, 0x9B, 0xCB, 0x96, 0x10, 0x00, 0x14, 0xAD, 0xFE,
+    0x41, 0x00, 0x00, 0x01, 0x5D, 0xD4, 0x00, 0x00, 0x00, 0x4B, 0xE5, 0x43,
+    0x32, 0x22, 0x6B, 0xC4, 0xDA, 0x86, 0x57, 0xAF, 0x93, 0x9C, 0xEF, 0xED,
+    0xB7, 0x00, 0x34, 0x55, 0x54, 0x42, 0x00, 0x00, 0x13, 0x52, 0x00, 0x00,
+    0x00, 0x27, 0x83, 0x00, 0x00, 0x00, 0x4B, 0x93, 0x00, 0x00, 0x00, 0x4D,
+    0x93, 0x00, 0x00, 0xBD, 0xEF, 0xFF, 0xFF, 0xF5, 0x67, 0xAF, 0xC9, 0x88,
+    0x83, 0x33, 0x7F, 0xA5, 0x33, 0x31, 0x00, 0x5F, 0x93, 0x00, 0x00, 0x00,
+    0x5F, 0x93, 0x00, 0x00, 0x00, 0x5F, 0x93, 0x00, 0x00, 0x00, 0x5F, 0x93,
+    0x00, 0x00, 0x00, 0x5F, 0x93, 0x00, 0x00, 0x00, 0x5F, 0x93, 0x00, 0x00,
+    0x00, 0x5E, 0xA3, 0x00, 0x00, 0x00, 0x4D, 0xC5, 0x22, 0x21, 0x00, 0x3A,
+    0xFA, 0x75, 0x62, 0x00, 0x01, 0xAD, 0xEE, 0xC4, 0x00, 0x00, 0x34, 0x55,
+    0x41, 0xFB, 0x60, 0x00, 0x00, 0x9D, 0xAF, 0xB6, 0x00, 0x00, 0x09, 0xDA,
+    0xFB, 0x60, 0x00, 0x00, 0x9D, 0xAF, 0xB6, 0x00, 0x00, 0x09, 0xDA, 0xFB,
+    0x60, 0x00, 0x00, 0x9D, 0xAF, 0xB6, 0x00, 0x00, 0x09, 0xDA, 0xFB, 0x60,
+    0x00, 0x00, 0x9D, 0xAF, 0xB6, 0x00, 0x00, 0x09, 0xDA, 0xFB, 0x60, 0x00,
+    0x00, 0xBE, 0xAD, 0xC8, 0x00, 0x00, 0x1D, 0xEA, 0xBC, 0xA3, 0x22, 0x36,
+    0xEF, 0xA7, 0xCD, 0xA6, 0x79, 0xDD, 0xEA, 0x05, 0x9D, 0xFD, 0xB6, 0x6C,
+    0xA0, 0x23, 0x45, 0x44, 0x22, 0x43, 0xCC, 0x80, 0x00, 0x00, 0x08, 0xCC,
+    0x9C, 0xA2, 0x00, 0x00, 0x2A, 0xC9, 0x5C, 0xB4, 0x00, 0x00, 0x4B, 0xC6,
+    0x2B, 0xC7, 0x00, 0x00, 0x7C, 0xB2, 0x08, 0xCD, 0x00, 0x00, 0xCC, 0x80,
+    0x05, 0xAE, 0x21, 0x01, 0xEA, 0x60, 0x03, 0x8F, 0x41, 0x14, 0xF8, 0x30,
+    0x01, 0x6F, 0x83, 0x27, 0xF6, 0x10, 0x00, 0x4B, 0xD4, 0x4C, 0xB4, 0x00,
+    0x00, 0x27, 0xE6, 0x6E, 0x83, 0x00, 0x00, 0x14, 0xF9, 0x9F, 0x41, 0x00,
+    0x00, 0x01, 0xED, 0xDF, 0x10, 0x00, 0x00, 0x00, 0xAD, 0xEB, 0x00, 0x00,
+    0x00, 0x00, 0x34, 0x54, 0x00, 0x00, 0xE9, 0x50, 0x02, 0x7F, 0x41, 0x00,
+    0x7B, 0x9C, 0xA6, 0x00, 0x49, 0xE7, 0x20, 0x08, 0xB8, 0xAA, 0x70, 0x06,
+    0xAC, 0xA3, 0x00, 0xAA, 0x68, 0xA8, 0x00, 0x9B, 0x8D, 0x40, 0x0B, 0x95,
+    0x5B, 0x90, 0x2B, 0xA1, 0xF7, 0x20, 0xD8, 0x33, 0xBA, 0x06, 0xA8, 0x0D,
+    0x84, 0x0E, 0x72, 0x1A, 0xA1, 0x9A, 0x70, 0xA9, 0x61, 0xF6, 0x10, 0x9A,
+    0x3C, 0x95, 0x08, 0xA9, 0x2E, 0x50, 0x08, 0x94, 0xF6, 0x20, 0x3B, 0xB5,
+    0xB4, 0x00, 0x69, 0x7D, 0x51, 0x01, 0xAC, 0x89, 0x30, 0x05, 0x9B, 0xB4,
+    0x00, 0x08, 0xCB, 0x72, 0x00, 0x48, 0xE8, 0x30, 0x00, 0x6B, 0xE5, 0x20,
+    0x02, 0x7F, 0x41, 0x00, 0x03, 0x8F, 0x31, 0x00, 0x12, 0x51, 0x00, 0x00,
+    0x13, 0x51, 0x00, 0x7C, 0xC5, 0x00, 0x00, 0x4B, 0xC7, 0x29, 0xCB, 0x10,
+    0x00, 0xAC, 0x93, 0x05, 0xAE, 0x31, 0x13, 0xEA, 0x60, 0x01, 0x6E, 0x93,
+    0x38, 0xE6, 0x10, 0x00, 0x25, 0xF9, 0x9F, 0x62, 0x00, 0x00, 0x12, 0xCC,
+    0xCC, 0x21, 0x00, 0x00, 0x00, 0xBD, 0xEB, 0x00, 0x00, 0x00, 0x00, 0xCE,
+    0xEC, 0x00, 0x00, 0x00, 0x38, 0xE7, 0x7E, 0x83, 0x00, 0x02, 0x6D, 0x94,
+    0x49, 0xD6, 0x20, 0x05, 0x9E, 0x41, 0x14, 0xE9, 0x50, 0x19, 0xDC, 0x00,
+    0x00, 0xBD, 0x91, 0xAD, 0xB2, 0x00, 0x00, 0x2B, 0xDA, 0x34, 0x41, 0x00,
+    0x00, 0x14, 0x43, 0xCC, 0x80, 0x00, 0x00, 0x08, 0xCC, 0x8C, 0xA2, 0x00,
+    0x00, 0x2A, 0xC8, 0x5C, 0xC5, 0x00, 0x00, 0x4B, 0xC5, 0x1A, 0xD8, 0x00,
+    0x00, 0x8C, 0xA1, 0x07, 0xBE, 0x00, 0x00, 0xDB, 0x70, 0x04, 0x9F, 0x31,
+    0x12, 0xE9, 0x40, 0x02, 0x7F, 0x62, 0x25, 0xF7, 0x20, 0x00, 0x5E, 0xA3,
+    0x38, 0xE5, 0x00, 0x00, 0x38, 0xE5, 0x5D, 0x83, 0x00, 0x00, 0x14, 0xF8,
+    0x8E, 0x52, 0x00, 0x00, 0x12, 0xEB, 0xBE, 0x21, 0x00, 0x00, 0x00, 0xCD,
+    0xDC, 0x00, 0x00, 0x00, 0x00, 0x6C, 0xC7, 0x00, 0x00, 0x00, 0x00, 0x6C,
+    0xB3, 0x00, 0x00, 0x00, 0x00, 0x9C, 0x91, 0x00, 0x00, 0x00, 0x00, 0xDB,
+    0x60, 0x00, 0x00, 0x66, 0x7B, 0xE6, 0x10, 0x00, 0x00, 0xBB, 0xCC, 0x73,
+    0x00, 0x00, 0x00, 0x99, 0x98, 0x31, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xF5, 0x88, 0x88, 0x88, 0xAE, 0xD4, 0x33, 0x33, 0x34, 0x8E, 0x93,
+    0x00, 0x00, 0x05, 0xAF, 0x31, 0x00, 0x00, 0x3B, 0xC7, 0x00, 0x00, 0x00,
+    0xAB, 0x92, 0x00, 0x00, 0x14, 0xDA, 0x50, 0x00, 0x00, 0x39, 0xE6, 0x10,
+    0x00, 0x03, 0x8F, 0x52, 0x00, 0x00, 0x18, 0xBB, 0x21, 0x00, 0x00, 0x5B,
+    0xC8, 0x11, 0x11, 0x10, 0xBD, 0xB4, 0x44, 0x44, 0x41, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xF5, 0x55, 0x55, 0x55, 0x55, 0x52, 0x00, 0x00, 0x16, 0xAD, 0xE5,
+    0x00, 0x00, 0x7B, 0xCA, 0x83, 0x00, 0x00, 0xCD, 0xB6, 0x41, 0x00, 0x00,
+    0xFC, 0x70, 0x00, 0x00, 0x00, 0xFC, 0x70, 0x00, 0x00, 0x00, 0xFC, 0x70,
+    0x00, 0x00, 0x00, 0xFC, 0x70, 0x00, 0x00, 0x01, 0xFB, 0x60, 0x00, 0x12,
+    0x5A, 0xF9, 0x40, 0x00, 0xAB, 0xBC, 0x84, 0x10, 0x00, 0xCC, 0xDD, 0x83,
+    0x00, 0x00, 0x57, 0xAE, 0xD6, 0x10, 0x00, 0x00, 0x13, 0xFB, 0x60, 0x00,
+    0x00, 0x01, 0xFB, 0x60, 0x00, 0x00, 0x00, 0xFC, 0x70, 0x00, 0x00, 0x00,
+    0xFC, 0x70, 0x00, 0x00, 0x00, 0xFC, 0x70, 0x00, 0x00, 0x00, 0xEC, 0x70,
+    0x00, 0x00, 0x00, 0xDC, 0x93, 0x21, 0x00, 0x00, 0x9D, 0xD9, 0x52, 0x00,
+    0x00, 0x05, 0x9C, 0xE5, 0x00, 0x00, 0x02, 0x34, 0x52, 0xF8, 0x3F, 0x83,
+    0xF8, 0x3F, 0x83, 0xF8, 0x3F, 0x83, 0xF8, 0x3F, 0x83, 0xF8, 0x3F, 0x83,
+    0xF8, 0x3F, 0x83, 0xF8, 0x3F, 0x83, 0xF8, 0x3F, 0x83, 0xF8, 0x3F, 0x83,
+    0xF8, 0x3F, 0x83, 0xF8, 0x3F, 0x83, 0xF8, 0x3F, 0x83, 0xED, 0xB8, 0x10,
+    0x00, 0x00, 0x89, 0xBD, 0x72, 0x00, 0x00, 0x45, 0x8D, 0xC4, 0x00, 0x00,
+    0x00, 0x4B, 0xF5, 0x00, 0x00, 0x00, 0x3A, 0xF5, 0x00, 0x00, 0x00, 0x3A,
+    0xF5, 0x00, 0x00, 0x00, 0x3A, 0xF5, 0x00, 0x00, 0x00, 0x3A, 0xF6, 0x10,
+    0x00, 0x00, 0x26, 0xFC, 0x73, 0x10, 0x00, 0x12, 0x8B, 0xCB, 0xA3, 0x00,
+    0x01, 0x8B, 0xDD, 0xC4, 0x00, 0x12, 0xDD, 0xC8, 0x52, 0x00, 0x39, 0xF7,
+    0x20, 0x00, 0x00, 0x39, 0xF6, 0x10, 0x00, 0x00, 0x3A, 0xF5, 0x00, 0x00,
+    0x00, 0x3A, 0xF5, 0x00, 0x00, 0x00, 0x3A, 0xF5, 0x00, 0x00, 0x00, 0x4B,
+    0xE5, 0x00, 0x00, 0x23, 0x6C, 0xD4, 0x00, 0x00, 0x58, 0xBF, 0x93, 0x00,
+    0x00, 0xED, 0xB7, 0x00, 0x00, 0x00, 0x54, 0x42, 0x00, 0x00, 0x00, 0x4A,
+    0xDE, 0xB6, 0x30, 0x00, 0x26, 0xBA, 0x99, 0xBB, 0xA8, 0x45, 0x8C, 0xC8,
+    0x54, 0x8A, 0xBB, 0x99, 0xAB, 0x62, 0x00, 0x03, 0x6B, 0xED, 0xA4, 0xCD,
+    0xA2, 0xCD, 0xA2, 0x89, 0x61, 0x00, 0x00, 0x79, 0x70, 0x79, 0x70, 0x8A,
+    0x70, 0x8A, 0x80, 0x9B, 0x80, 0x9B, 0x80, 0xAC, 0x90, 0xAC, 0x90, 0xBD,
+    0x90, 0xBD, 0xA0, 0xCE, 0xA0, 0xCE, 0xA0, 0xDE, 0xA1, 0x45, 0x30, 0x00,
+    0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x0F, 0xB6, 0x00, 0x00, 0x01, 0x24,
+    0xFC, 0x95, 0x41, 0x00, 0x37, 0xCF, 0xFF, 0xFB, 0x40, 0x4B, 0xFE, 0x86,
+    0x67, 0x93, 0x08, 0xDC, 0x73, 0x22, 0x23, 0x10, 0xBD, 0xA2, 0x00, 0x00,
+    0x00, 0x0D, 0xC8, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x70, 0x00, 0x00, 0x00,
+    0x0E, 0xC8, 0x00, 0x00, 0x00, 0x00, 0xCD, 0x91, 0x00, 0x00, 0x00, 0x0A,
+    0xDB, 0x30, 0x00, 0x00, 0x00, 0x4B, 0xEE, 0x76, 0x67, 0xB4, 0x01, 0x59,
+    0xCC, 0xCC, 0xBA, 0x30, 0x02, 0x48, 0xFD, 0xB9, 0x72, 0x00, 0x00, 0x0F,
+    0xB6, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x05, 0x42,
+    0x00, 0x00, 0x00, 0x00, 0x7B, 0xDF, 0xDB, 0x83, 0x00, 0x25, 0xCB, 0xA9,
+    0x9A, 0x93, 0x00, 0x39, 0xE9, 0x64, 0x57, 0x62, 0x00, 0x4D, 0xD4, 0x00,
+    0x00, 0x00, 0x00, 0x5F, 0xA3, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xA3, 0x00,
+    0x00, 0x00, 0x00, 0x5F, 0xA3, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xA3, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x00, 0x77, 0xAF, 0xC9, 0x88,
+    0x83, 0x00, 0x22, 0x7F, 0xB5, 0x33, 0x31, 0x00, 0x00, 0x5F, 0xA3, 0x00,
+    0x00, 0x00, 0x00, 0x5F, 0x93, 0x00, 0x00, 0x00, 0x02, 0x7F, 0x72, 0x00,
+    0x00, 0x00, 0x26, 0xAE, 0x63, 0x22, 0x22, 0x22, 0x6B, 0xED, 0x55, 0x55,
+    0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x03, 0x30, 0x00, 0x00, 0x03, 0x30, 0x38, 0x96, 0x89, 0x98,
+    0x69, 0x83, 0x3A, 0xCB, 0xBB, 0xBB, 0xBC, 0x93, 0x06, 0xBF, 0x97, 0x79,
+    0xFB, 0x60, 0x08, 0xB9, 0x00, 0x00, 0x9B, 0x80, 0x09, 0xB7, 0x00, 0x00,
+    0x7B, 0x90, 0x09, 0xB7, 0x00, 0x00, 0x7B, 0x90, 0x08, 0xB9, 0x00, 0x00,
+    0x9B, 0x80, 0x06, 0xBF, 0x97, 0x79, 0xFB, 0x60, 0x39, 0xCB, 0xBB, 0xBB,
+    0xBC, 0x93, 0x38, 0x96, 0x89, 0x98, 0x69, 0x83, 0x03, 0x30, 0x00, 0x00,
+    0x03, 0x30, 0xBD, 0x91, 0x00, 0x00, 0x01, 0x5E, 0xA3, 0x5B, 0xB5, 0x00,
+    0x00, 0x04, 0x9E, 0x41, 0x29, 0xCA, 0x00, 0x00, 0x18, 0xBB, 0x10, 0x06,
+    0xBE, 0x10, 0x00, 0x3B, 0xC6, 0x00, 0x01, 0x5E, 0x93, 0x00, 0xCC, 0x70,
+    0x00, 0x00, 0x39, 0xD5, 0x25, 0xE8, 0x30, 0x00, 0x00, 0x25, 0xE8, 0x69,
+    0xC5, 0x10, 0x00, 0x00, 0x00, 0xDC, 0xCE, 0x72, 0x00, 0x00, 0x0A, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x04, 0x66, 0x6C, 0xEB, 0x66, 0x66, 0x00,
+    0x01, 0x11, 0x1A, 0xD9, 0x11, 0x11, 0x00, 0x01, 0x11, 0x1A, 0xD9, 0x11,
+    0x11, 0x00, 0x0A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0x55, 0x5C,
+    0xEB, 0x55, 0x55, 0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0A, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x03, 0x43, 0x00, 0x00, 0x00, 0xF8, 0x3F, 0x83, 0xF8,
+    0x3F, 0x83, 0xF8, 0x3F, 0x83, 0xF8, 0x3F, 0x83, 0xF8, 0x35, 0x31, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x1F, 0x83, 0xF8, 0x3F, 0x83, 0xF8,
+    0x3F, 0x83, 0xF8, 0x3F, 0x83, 0xF8, 0x3F, 0x83, 0x01, 0x38, 0xDE, 0xEE,
+    0xB8, 0x40, 0x59, 0xC8, 0x88, 0x8A, 0x74, 0x08, 0xCC, 0x43, 0x34, 0x65,
+    0x30, 0xAD, 0xA0, 0x00, 0x00, 0x00, 0x06, 0xBF, 0x95, 0x20, 0x00, 0x00,
+    0x27, 0xDD, 0xCA, 0x73, 0x10, 0x02, 0x7D, 0xBB, 0xBB, 0x84, 0x10, 0x6B,
+    0xD2, 0x37, 0xCF, 0x94, 0x0A, 0xD9, 0x00, 0x00, 0xCD, 0x90, 0x9D, 0xC1,
+    0x00, 0x0A, 0xD9, 0x07, 0xBE, 0x64, 0x22, 0xBC, 0x80, 0x37, 0xEE, 0xA7,
+    0x5E, 0xA5, 0x00, 0x01, 0x7B, 0xEF, 0xE6, 0x10, 0x00, 0x02, 0x46, 0x8E,
+    0xA6, 0x00, 0x00, 0x00, 0x13, 0xDD, 0x80, 0x00, 0x00, 0x00, 0x09, 0xDA,
+    0x28, 0xA7, 0x54, 0x57, 0xEB, 0x71, 0x7A, 0xBB, 0xBB, 0xB9, 0x52, 0x14,
+    0x79, 0xAA, 0x98, 0x52, 0x00, 0xC8, 0x40, 0x6A, 0x8C, 0x84, 0x06, 0xA8,
+    0x85, 0x30, 0x47, 0x50, 0x00, 0x13, 0xAC, 0xEE, 0xEB, 0x72, 0x00, 0x00,
+    0x25, 0xA7, 0x65, 0x55, 0x68, 0xA3, 0x10, 0x05, 0x8A, 0x42, 0x00, 0x13,
+    0x6A, 0x73, 0x01, 0x9A, 0x20, 0x00, 0x00, 0x01, 0x2D, 0x51, 0x78, 0x50,
+    0x59, 0xDE, 0xEC, 0x82, 0x88, 0x5A, 0x64, 0x4C, 0xA9, 0x78, 0x86, 0x14,
+    0x87, 0xD5, 0x48, 0xD8, 0x43, 0x34, 0x30, 0x29, 0x8E, 0x54, 0xDA, 0x30,
+    0x00, 0x00, 0x00, 0x99, 0xE5, 0x5F, 0x72, 0x00, 0x00, 0x00, 0x0A, 0xAE,
+    0x54, 0xD8, 0x30, 0x00, 0x00, 0x00, 0x99, 0xD5, 0x4A, 0xB5, 0x21, 0x12,
+    0x20, 0x19, 0x9C, 0x64, 0x6F, 0xA6, 0x44, 0x65, 0x03, 0x98, 0x88, 0x50,
+    0x5A, 0xDE, 0xEC, 0x70, 0x88, 0x53, 0x98, 0x22, 0x34, 0x55, 0x43, 0x2C,
+    0x62, 0x17, 0x96, 0x21, 0x00, 0x01, 0x36, 0xA4, 0x10, 0x37, 0xD6, 0x31,
+    0x01, 0x48, 0xD4, 0x10, 0x00, 0x13, 0xAC, 0xEE, 0xEB, 0x73, 0x00, 0x00,
+    0x00, 0x13, 0x45, 0x55, 0x42, 0x10, 0x00, 0x49, 0xDE, 0xED, 0x94, 0x35,
+    0x66, 0x58, 0xAA, 0x25, 0x65, 0x59, 0xCE, 0x38, 0xBD, 0xEF, 0xFF, 0xDB,
+    0x82, 0x14, 0x9F, 0xEA, 0x61, 0x38, 0xCF, 0xBA, 0x85, 0x69, 0xCF, 0x6B,
+    0xEE, 0xB6, 0x7F, 0x00, 0x38, 0x93, 0x00, 0x89, 0x60, 0x37, 0xD6, 0x21,
+    0x4D, 0x84, 0x16, 0xAC, 0x32, 0x49, 0xC6, 0x24, 0xBC, 0x70, 0x37, 0xF7,
+    0x20, 0xDD, 0x90, 0x09, 0xDD, 0x00, 0x07, 0xCB, 0x50, 0x59, 0xE5, 0x20,
+    0x39, 0xBA, 0x22, 0x6C, 0xA4, 0x10, 0x49, 0xF5, 0x22, 0x6F, 0x83, 0x00,
+    0x38, 0x93, 0x00, 0x89, 0x60, 0x01, 0x33, 0x10, 0x03, 0x32, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x88, 0x88, 0x88, 0x8A, 0xCF, 0x33, 0x33,
+    0x33, 0x33, 0x36, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x03, 0x8F, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x03, 0x8F, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x5A, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA, 0xAA, 0xA7, 0x55,
+    0x55, 0x55, 0x30, 0x00, 0x13, 0xAC, 0xEE, 0xEB, 0x72, 0x00, 0x00, 0x25,
+    0xA7, 0x65, 0x55, 0x68, 0xA3, 0x10, 0x05, 0x8A, 0x42, 0x00, 0x13, 0x6A,
+    0x73, 0x01, 0x9A, 0x20, 0x00, 0x00, 0x01, 0x2D, 0x51, 0x78, 0x50, 0xFF,
+    0xFE, 0xC7, 0x30, 0x88, 0x5A, 0x63, 0x0F, 0xC9, 0x7B, 0xB7, 0x04, 0x87,
+    0xD5, 0x10, 0xFA, 0x64, 0xBC, 0x90, 0x29, 0x8E, 0x50, 0x0F, 0xA6, 0x4B,
+    0xC8, 0x00, 0x99, 0xE5, 0x00, 0xFF, 0xFF, 0xD6, 0x10, 0x0A, 0xAE, 0x50,
+    0x0F, 0xB9, 0x9E, 0x61, 0x00, 0x99, 0xD5, 0x10, 0xF9, 0x64, 0xE8, 0x40,
+    0x19, 0x9C, 0x62, 0x0F, 0x94, 0x0C, 0xC7, 0x03, 0x98, 0x88, 0x50, 0xF9,
+    0x40, 0x3B, 0xC6, 0x88, 0x53, 0x98, 0x25, 0x31, 0x01, 0x44, 0x4C, 0x62,
+    0x17, 0x96, 0x21, 0x00, 0x01, 0x36, 0xA4, 0x10, 0x37, 0xD6, 0x31, 0x01,
+    0x48, 0xD4, 0x10, 0x00, 0x13, 0xAC, 0xEE, 0xEB, 0x73, 0x00, 0x00, 0x00,
+    0x13, 0x45, 0x55, 0x42, 0x10, 0x00, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x2B, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xB7, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0x70, 0x03, 0x8D, 0xFD, 0xA5, 0x00, 0x39, 0xA8,
+    0x68, 0x9B, 0x31, 0x8B, 0xA4, 0x13, 0x7D, 0x72, 0xDA, 0x60, 0x00, 0x39,
+    0xC4, 0xF8, 0x40, 0x00, 0x25, 0xF5, 0xD9, 0x50, 0x00, 0x27, 0xD4, 0xAA,
+    0x82, 0x12, 0x5A, 0xA3, 0x5B, 0xC6, 0x25, 0x9F, 0x52, 0x03, 0x8D, 0xFD,
+    0xA5, 0x00, 0x01, 0x34, 0x54, 0x32, 0x00, 0x00, 0x00, 0x04, 0x52, 0x00,
+    0x00, 0x00, 0x00, 0x08, 0x94, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xC5, 0x00,
+    0x00, 0x00, 0x00, 0x0A, 0xC5, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xC5, 0x00,
+    0x00, 0x48, 0xAA, 0xAD, 0xEC, 0xAA, 0x97, 0x59, 0xCC, 0xCE, 0xED, 0xCC,
+    0xA8, 0x24, 0x55, 0x5C, 0xD8, 0x55, 0x43, 0x00, 0x00, 0x0A, 0xC5, 0x00,
+    0x00, 0x00, 0x00, 0x0A, 0xC5, 0x00, 0x00, 0x00, 0x00, 0x09, 0xA4, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0x83, 0x00, 0x00, 0x24, 0x55, 0x55, 0x55, 0x55,
+    0x43, 0x59, 0xCC, 0xCC, 0xCC, 0xCC, 0xA8, 0x48, 0xAA, 0xAA, 0xAA, 0xAA,
+    0x97, 0x7B, 0xDE, 0xD7, 0x34, 0x56, 0x59, 0xA7, 0x22, 0x10, 0x7B, 0x90,
+    0x00, 0x07, 0xB9, 0x00, 0x13, 0xE8, 0x30, 0x25, 0xA8, 0x41, 0x25, 0x8A,
+    0x31, 0x05, 0xAA, 0x30, 0x00, 0xFF, 0xFF, 0xFF, 0xA5, 0x55, 0x55, 0x53,
+    0x7B, 0xDF, 0xD7, 0x34, 0x56, 0x59, 0xA7, 0x11, 0x11, 0x8B, 0x90, 0x00,
+    0x19, 0xA7, 0x0A, 0xFF, 0xC5, 0x10, 0x35, 0x6A, 0x96, 0x11, 0x11, 0x9C,
+    0x93, 0x21, 0x19, 0xC9, 0xCD, 0xEE, 0xC6, 0x24, 0x45, 0x54, 0x21, 0x2A,
+    0xEC, 0x5C, 0xC6, 0x9B, 0x92, 0xD9, 0x50, 0xFB, 0x60, 0x00, 0x00, 0x9D,
+    0xAF, 0xB6, 0x00, 0x00, 0x09, 0xDA, 0xFB, 0x60, 0x00, 0x00, 0x9D, 0xAF,
+    0xB6, 0x00, 0x00, 0x09, 0xDA, 0xFB, 0x60, 0x00, 0x00, 0x9D, 0xAF, 0xB6,
+    0x00, 0x00, 0x09, 0xDA, 0xFB, 0x60, 0x00, 0x00, 0x9D, 0xAF, 0xB6, 0x00,
+    0x00, 0x09, 0xDA, 0xFB, 0x60, 0x00, 0x00, 0xBE, 0xAF, 0xD8, 0x00, 0x00,
+    0x1D, 0xEA, 0xFE, 0xA3, 0x22, 0x35, 0xEF, 0xAF, 0xFD, 0xA6, 0x79, 0xDD,
+    0xEA, 0xFC, 0xBC, 0xFE, 0xB6, 0x5C, 0xAF, 0xB8, 0x45, 0x54, 0x22, 0x43,
+    0xFB, 0x60, 0x00, 0x00, 0x00, 0x0F, 0xB6, 0x00, 0x00, 0x00, 0x00, 0xFB,
+    0x60, 0x00, 0x00, 0x00, 0x0F, 0xB6, 0x00, 0x00, 0x00, 0x00, 0xA7, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x7C, 0xEF, 0xFF, 0xFF, 0xFF, 0x39, 0xCE,
+    0xFF, 0xD9, 0x89, 0xBF, 0x6C, 0xFF, 0xFF, 0xB4, 0x34, 0x8F, 0xBE, 0xFF,
+    0xFF, 0xA1, 0x01, 0x6F, 0xEF, 0xFF, 0xFF, 0xA1, 0x01, 0x6F, 0xFF, 0xFF,
+    0xFF, 0xA1, 0x01, 0x6F, 0xFF, 0xFF, 0xFF, 0xA1, 0x01, 0x6F, 0xEF, 0xFF,
+    0xFF, 0xA1, 0x01, 0x6F, 0xCE, 0xFF, 0xFF, 0xA1, 0x01, 0x6F, 0x9D, 0xFF,
+    0xFF, 0xA1, 0x01, 0x6F, 0x5A, 0xEF, 0xFF, 0xA1, 0x01, 0x6F, 0x06, 0xBE,
+    0xEF, 0xA1, 0x01, 0x6F, 0x00, 0x00, 0x0A, 0xA1, 0x01, 0x6F, 0x00, 0x00,
+    0x0A, 0xA1, 0x01, 0x6F, 0x00, 0x00, 0x0A, 0xA1, 0x01, 0x6F, 0x00, 0x00,
+    0x0A, 0xA1, 0x01, 0x6F, 0x00, 0x00, 0x0A, 0xA1, 0x01, 0x6F, 0x00, 0x00,
+    0x0A, 0xA1, 0x01, 0x6F, 0x00, 0x00, 0x0A, 0xA1, 0x01, 0x6F, 0x00, 0x00,
+    0x0A, 0xA1, 0x01, 0x6F, 0x00, 0x00, 0x0A, 0xA1, 0x01, 0x6F, 0x00, 0x00,
+    0x03, 0x30, 0x00, 0x25, 0xBB, 0x8B, 0xB8, 0x88, 0x50, 0x18, 0x80, 0x39,
+    0xA6, 0x28, 0xAA, 0x04, 0x8C, 0xEC, 0x81, 0x54, 0x30, 0x17, 0xBF, 0x52,
+    0x78, 0xAE, 0x52, 0x75, 0x8E, 0x52, 0x00, 0x5F, 0x52, 0x00, 0x5F, 0x52,
+    0x00, 0x5F, 0x52, 0x00, 0x5F, 0x52, 0x00, 0x5F, 0x52, 0x00, 0x5F, 0x52,
+    0x00, 0x25, 0x21, 0x16, 0xBE, 0xEB, 0x61, 0x79, 0x96, 0x69, 0x96, 0xBA,
+    0x71, 0x17, 0xAB, 0xE8, 0x40, 0x04, 0x8E, 0xE8, 0x40, 0x04, 0x8E, 0xBA,
+    0x71, 0x17, 0xAB, 0x69, 0x96, 0x69, 0x96, 0x16, 0xBE, 0xEB, 0x61, 0x98,
+    0x50, 0x06, 0x98, 0x00, 0x06, 0xAA, 0x40, 0x48, 0xD4, 0x10, 0x39, 0xB9,
+    0x12, 0x6C, 0x94, 0x10, 0x5A, 0xF4, 0x12, 0x7F, 0x73, 0x00, 0x4D, 0xD4,
+    0x00, 0xDD, 0x90, 0x38, 0xE7, 0x22, 0x5E, 0x95, 0x27, 0xAC, 0x32, 0x4A,
+    0xC6, 0x25, 0xBC, 0x60, 0x38, 0xF6, 0x20, 0x98, 0x50, 0x06, 0x98, 0x00,
+    0x03, 0x32, 0x00, 0x23, 0x30, 0x00, 0x17, 0xBF, 0x52, 0x00, 0x00, 0x3A,
+    0xB4, 0x00, 0x78, 0xAE, 0x52, 0x00, 0x01, 0x5D, 0x62, 0x00, 0x75, 0x8E,
+    0x52, 0x00, 0x03, 0x8E, 0x21, 0x00, 0x00, 0x5F, 0x52, 0x00, 0x07, 0xAB,
+    0x00, 0x00, 0x00, 0x5F, 0x52, 0x00, 0x3B, 0xB3, 0x00, 0x00, 0x00, 0x5F,
+    0x52, 0x00, 0x8B, 0x81, 0x00, 0x00, 0x00, 0x5F, 0x52, 0x01, 0xC9, 0x50,
+    0x00, 0x00, 0x00, 0x5F, 0x52, 0x13, 0xF7, 0x20, 0x00, 0x00, 0x00, 0x5F,
+    0x52, 0x3A, 0xA3, 0x25, 0xF8, 0x30, 0x00, 0x25, 0x22, 0x6D, 0x53, 0x4A,
+    0xF8, 0x30, 0x00, 0x00, 0x04, 0x8D, 0x24, 0x7A, 0xF8, 0x30, 0x00, 0x00,
+    0x07, 0xBA, 0x08, 0x94, 0xF8, 0x30, 0x00, 0x00, 0x3B, 0xB3, 0x89, 0x60,
+    0xF8, 0x30, 0x00, 0x00, 0x8B, 0x81, 0xDD, 0xCA, 0xFD, 0x80, 0x00, 0x01,
+    0xC9, 0x50, 0xAA, 0xAA, 0xFD, 0x80, 0x00, 0x14, 0xF7, 0x20, 0x00, 0x00,
+    0xF8, 0x30, 0x00, 0x4B, 0xA3, 0x00, 0x00, 0x00, 0xF8, 0x30, 0x00, 0x14,
+    0x31, 0x00, 0x00, 0x00, 0x53, 0x10, 0x17, 0xBF, 0x52, 0x00, 0x07, 0xAB,
+    0x00, 0x07, 0x8A, 0xE5, 0x20, 0x02, 0x9B, 0x60, 0x00, 0x75, 0x8E, 0x52,
+    0x00, 0x5B, 0xA2, 0x00, 0x00, 0x05, 0xF5, 0x20, 0x0A, 0xB7, 0x00, 0x00,
+    0x00, 0x5F, 0x52, 0x13, 0xF7, 0x20, 0x00, 0x00, 0x05, 0xF5, 0x23, 0x8C,
+    0x51, 0x00, 0x00, 0x00, 0x5F, 0x52, 0x5C, 0x83, 0x00, 0x00, 0x00, 0x05,
+    0xF5, 0x37, 0xF3, 0x10, 0x00, 0x00, 0x00, 0x5F, 0x59, 0xAA, 0x7B, 0xDE,
+    0xD7, 0x30, 0x02, 0x54, 0xAB, 0x54, 0x56, 0x59, 0xA7, 0x00, 0x00, 0x6B,
+    0xA2, 0x22, 0x10, 0x7B, 0x90, 0x00, 0x0B, 0xA7, 0x00, 0x00, 0x07, 0xB9,
+    0x00, 0x13, 0xF7, 0x20, 0x00, 0x13, 0xE8, 0x30, 0x03, 0x8C, 0x41, 0x00,
+    0x25, 0xA8, 0x41, 0x01, 0x5C, 0x72, 0x00, 0x25, 0x8A, 0x31, 0x00, 0x27,
+    0xF2, 0x10, 0x05, 0xAA, 0x30, 0x00, 0x07, 0xBA, 0x00, 0x00, 0xFF, 0xFF,
+    0xFF, 0xA0, 0x24, 0x30, 0x00, 0x05, 0x55, 0x55, 0x53, 0x7B, 0xDF, 0xD7,
+    0x30, 0x00, 0x3A, 0xB4, 0x00, 0x45, 0x65, 0x9A, 0x70, 0x01, 0x5D, 0x62,
+    0x00, 0x11, 0x11, 0x8B, 0x90, 0x03, 0x8E, 0x21, 0x00, 0x00, 0x01, 0x9A,
+    0x70, 0x07, 0xAB, 0x00, 0x00, 0x0A, 0xFF, 0xC5, 0x10, 0x3B, 0xB3, 0x00,
+    0x00, 0x03, 0x56, 0xA9, 0x60, 0x8B, 0x81, 0x00, 0x00, 0x11, 0x11, 0x9C,
+    0x91, 0xC9, 0x50, 0x00, 0x00, 0x32, 0x11, 0x9C, 0xA3, 0xF7, 0x20, 0x00,
+    0x00, 0xCD, 0xEE, 0xC6, 0x6A, 0xA3, 0x25, 0xF8, 0x30, 0x44, 0x55, 0x43,
+    0x7D, 0x53, 0x4A, 0xF8, 0x30, 0x00, 0x00, 0x04, 0x8D, 0x24, 0x7A, 0xF8,
+    0x30, 0x00, 0x00, 0x07, 0xBA, 0x08, 0x94, 0xF8, 0x30, 0x00, 0x00, 0x3B,
+    0xB3, 0x89, 0x60, 0xF8, 0x30, 0x00, 0x00, 0x8B, 0x81, 0xDD, 0xCA, 0xFD,
+    0x80, 0x00, 0x01, 0xC9, 0x50, 0xAA, 0xAA, 0xFD, 0x80, 0x00, 0x14, 0xF7,
+    0x20, 0x00, 0x00, 0xF8, 0x30, 0x00, 0x4B, 0xA3, 0x00, 0x00, 0x00, 0xF8,
+    0x30, 0x00, 0x14, 0x31, 0x00, 0x00, 0x00, 0x53, 0x10, 0x00, 0x00, 0xCC,
+    0x80, 0x00, 0x00, 0x00, 0x0D, 0xD9, 0x00, 0x00, 0x00, 0x00, 0xBB, 0x70,
+    0x00, 0x00, 0x00, 0x04, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0x74, 0x00, 0x00, 0x00, 0x01, 0xDA, 0x60, 0x00, 0x00,
+    0x01, 0x2F, 0xA5, 0x00, 0x00, 0x02, 0x6D, 0xD5, 0x10, 0x00, 0x02, 0x7B,
+    0xD5, 0x20, 0x00, 0x00, 0x5B, 0xC9, 0x10, 0x00, 0x00, 0x0B, 0xDA, 0x10,
+    0x00, 0x00, 0x00, 0xEB, 0x60, 0x00, 0x00, 0x00, 0x0E, 0xC7, 0x00, 0x00,
+    0x00, 0x00, 0xCC, 0xA4, 0x22, 0x23, 0x44, 0x38, 0xDE, 0xB6, 0x66, 0x8D,
+    0xC7, 0x04, 0x8C, 0xEE, 0xED, 0x95, 0x20, 0x13, 0x45, 0x55, 0x43, 0x21,
+    0x00, 0x00, 0x08, 0xDF, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0xF5,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x02, 0x6C, 0x93, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0x7D, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x47, 0xA6, 0x20, 0x00, 0x00, 0x00, 0x00, 0x06,
+    0xBF, 0xA3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9E, 0xED, 0x50, 0x00, 0x00,
+    0x00, 0x00, 0x4B, 0xD8, 0xF8, 0x30, 0x00, 0x00, 0x00, 0x07, 0xCB, 0x4F,
+    0xA5, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x91, 0xDC, 0x70, 0x00, 0x00, 0x00,
+    0x0E, 0xC7, 0x0B, 0xDA, 0x00, 0x00, 0x00, 0x25, 0xF9, 0x40, 0x6C, 0xC5,
+    0x00, 0x00, 0x03, 0x8F, 0x72, 0x03, 0xBD, 0x90, 0x00, 0x00, 0x4C, 0xE5,
+    0x10, 0x19, 0xDC, 0x00, 0x00, 0x15, 0xFC, 0x40, 0x00, 0x8D, 0xF1, 0x00,
+    0x04, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0x62, 0x00, 0x6B, 0xF9, 0x99, 0x99,
+    0x9B, 0xFA, 0x30, 0x18, 0xDD, 0x44, 0x44, 0x44, 0x7D, 0xD5, 0x02, 0xAD,
+    0xA0, 0x00, 0x00, 0x03, 0xAF, 0x61, 0x7C, 0xB4, 0x00, 0x00, 0x00, 0x14,
+    0xFA, 0x5B, 0xD9, 0x10, 0x00, 0x00, 0x00, 0x1E, 0xC7, 0x88, 0x60, 0x00,
+    0x00, 0x00, 0x00, 0x98, 0x50, 0x00, 0x00, 0x00, 0x12, 0xFD, 0x80, 0x00,
+    0x00, 0x00, 0x00, 0x02, 0x5F, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39,
+    0xC6, 0x20, 0x00, 0x00, 0x00, 0x00, 0x04, 0xD7, 0x20, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0xA6, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0xA3, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x9E, 0xED, 0x50, 0x00, 0x00, 0x00, 0x00, 0x4B, 0xD8, 0xF8, 0x30, 0x00,
+    0x00, 0x00, 0x07, 0xCB, 0x4F, 0xA5, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x91,
+    0xDC, 0x70, 0x00, 0x00, 0x00, 0x0E, 0xC7, 0x0B, 0xDA, 0x00, 0x00, 0x00,
+    0x25, 0xF9, 0x40, 0x6C, 0xC5, 0x00, 0x00, 0x03, 0x8F, 0x72, 0x03, 0xBD,
+    0x90, 0x00, 0x00, 0x4C, 0xE5, 0x10, 0x19, 0xDC, 0x00, 0x00, 0x15, 0xFC,
+    0x40, 0x00, 0x8D, 0xF1, 0x00, 0x04, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0x62,
+    0x00, 0x6B, 0xF9, 0x99, 0x99, 0x9B, 0xFA, 0x30, 0x18, 0xDD, 0x44, 0x44,
+    0x44, 0x7D, 0xD5, 0x02, 0xAD, 0xA0, 0x00, 0x00, 0x03, 0xAF, 0x61, 0x7C,
+    0xB4, 0x00, 0x00, 0x00, 0x14, 0xFA, 0x5B, 0xD9, 0x10, 0x00, 0x00, 0x00,
+    0x1E, 0xC7, 0x88, 0x60, 0x00, 0x00, 0x00, 0x00, 0x98, 0x50, 0x00, 0x00,
+    0x06, 0xBF, 0x93, 0x00, 0x00, 0x00, 0x00, 0x02, 0x9C, 0xBD, 0x61, 0x00,
+    0x00, 0x00, 0x00, 0x6A, 0xA6, 0xD8, 0x40, 0x00, 0x00, 0x00, 0x0C, 0x95,
+    0x08, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x47, 0xA6, 0x20, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0xA3,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x9E, 0xED, 0x50, 0x00, 0x00, 0x00, 0x00,
+    0x4B, 0xD8, 0xF8, 0x30, 0x00, 0x00, 0x00, 0x07, 0xCB, 0x4F, 0xA5, 0x00,
+    0x00, 0x00, 0x00, 0xBC, 0x91, 0xDC, 0x70, 0x00, 0x00, 0x00, 0x0E, 0xC7,
+    0x0B, 0xDA, 0x00, 0x00, 0x00, 0x25, 0xF9, 0x40, 0x6C, 0xC5, 0x00, 0x00,
+    0x03, 0x8F, 0x72, 0x03, 0xBD, 0x90, 0x00, 0x00, 0x4C, 0xE5, 0x10, 0x19,
+    0xDC, 0x00, 0x00, 0x15, 0xFC, 0x40, 0x00, 0x8D, 0xF1, 0x00, 0x04, 0x9F,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x62, 0x00, 0x6B, 0xF9, 0x99, 0x99, 0x9B, 0xFA,
+    0x30, 0x18, 0xDD, 0x44, 0x44, 0x44, 0x7D, 0xD5, 0x02, 0xAD, 0xA0, 0x00,
+    0x00, 0x03, 0xAF, 0x61, 0x7C, 0xB4, 0x00, 0x00, 0x00, 0x14, 0xFA, 0x5B,
+    0xD9, 0x10, 0x00, 0x00, 0x00, 0x1E, 0xC7, 0x88, 0x60, 0x00, 0x00, 0x00,
+    0x00, 0x98, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x28, 0x97, 0x30, 0x03, 0x90, 0x00, 0x00, 0x25, 0xBB, 0xA8, 0x33, 0x6C,
+    0x00, 0x00, 0x03, 0xA9, 0x9B, 0xF9, 0x99, 0xA0, 0x00, 0x00, 0x5E, 0x10,
+    0x14, 0xDD, 0x92, 0x00, 0x00, 0x02, 0x50, 0x00, 0x14, 0x43, 0x10, 0x00,
+    0x00, 0x00, 0x02, 0x35, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5A, 0xF8,
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x09, 0xEE, 0xD5, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0xAD, 0xAE, 0x72, 0x00, 0x00, 0x00, 0x00, 0x5C, 0xC6, 0xF9, 0x40,
+    0x00, 0x00, 0x00, 0x09, 0xDA, 0x1F, 0xB6, 0x00, 0x00, 0x00, 0x00, 0xEC,
+    0x70, 0xBD, 0xA0, 0x00, 0x00, 0x01, 0x3F, 0xA5, 0x07, 0xCB, 0x30, 0x00,
+    0x00, 0x27, 0xF8, 0x30, 0x4B, 0xC7, 0x00, 0x00, 0x03, 0xAF, 0x61, 0x01,
+    0xAD, 0xA0, 0x00, 0x01, 0x5F, 0xC4, 0x00, 0x08, 0xDF, 0x10, 0x00, 0x38,
+    0xFE, 0xBA, 0xAA, 0xDE, 0xF4, 0x10, 0x05, 0xAF, 0xCC, 0xCC, 0xCC, 0xDF,
+    0x83, 0x00, 0x7C, 0xF7, 0x77, 0x77, 0x79, 0xFB, 0x40, 0x2A, 0xDA, 0x00,
+    0x00, 0x00, 0x3A, 0xF6, 0x15, 0xCC, 0x60, 0x00, 0x00, 0x02, 0x6F, 0x83,
+    0x9C, 0xA3, 0x00, 0x00, 0x00, 0x13, 0xEB, 0x6C, 0xD9, 0x00, 0x00, 0x00,
+    0x00, 0x0D, 0xD8, 0x00, 0x00, 0xC8, 0x40, 0x6A, 0x80, 0x00, 0x00, 0x00,
+    0x0C, 0x84, 0x06, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x85, 0x30, 0x47, 0x50,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+    0xAF, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFC, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x1A, 0xDC, 0xE6, 0x10, 0x00, 0x00, 0x00, 0x04, 0xBD, 0x8F,
+    0x83, 0x00, 0x00, 0x00, 0x00, 0x9D, 0xA1, 0xFB, 0x60, 0x00, 0x00, 0x00,
+    0x0C, 0xC8, 0x0C, 0xC8, 0x00, 0x00, 0x00, 0x12, 0xEB, 0x60, 0x9D, 0xA2,
+    0x00, 0x00, 0x02, 0x5F, 0x94, 0x06, 0xCC, 0x50, 0x00, 0x00, 0x3A, 0xF6,
+    0x10, 0x1A, 0xDA, 0x00, 0x00, 0x05, 0xDD, 0x50, 0x00, 0x9D, 0xD1, 0x00,
+    0x02, 0x7F, 0xD8, 0x55, 0x5A, 0xDF, 0x31, 0x00, 0x49, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xF6, 0x20, 0x07, 0xCF, 0x77, 0x77, 0x77, 0x9F, 0xB4, 0x01, 0x9D,
+    0xC2, 0x22, 0x22, 0x25, 0xCE, 0x51, 0x3B, 0xD8, 0x00, 0x00, 0x00, 0x38,
+    0xF7, 0x27, 0xCB, 0x40, 0x00, 0x00, 0x01, 0x4F, 0xA5, 0xCD, 0x90, 0x00,
+    0x00, 0x00, 0x00, 0xDD, 0x84, 0x43, 0x00, 0x00, 0x00, 0x00, 0x04, 0x43,
+    0x00, 0x00, 0x03, 0x8D, 0xD8, 0x30, 0x00, 0x00, 0x00, 0x00, 0x79, 0x66,
+    0x97, 0x00, 0x00, 0x00, 0x00, 0x09, 0xA2, 0x2A, 0x90, 0x00, 0x00, 0x00,
+    0x00, 0x9A, 0x22, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x09, 0xEF, 0xF8, 0x30,
+    0x00, 0x00, 0x00, 0x00, 0x9E, 0xFE, 0x61, 0x00, 0x00, 0x00, 0x00, 0x1A,
+    0xDC, 0xE6, 0x10, 0x00, 0x00, 0x00, 0x04, 0xBD, 0x8F, 0x83, 0x00, 0x00,
+    0x00, 0x00, 0x9D, 0xA1, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x0C, 0xC8, 0x0C,
+    0xC8, 0x00, 0x00, 0x00, 0x12, 0xEB, 0x60, 0x9D, 0xA2, 0x00, 0x00, 0x02,
+    0x5F, 0x94, 0x06, 0xCC, 0x50, 0x00, 0x00, 0x3A, 0xF6, 0x10, 0x1A, 0xDA,
+    0x00, 0x00, 0x05, 0xDD, 0x50, 0x00, 0x9D, 0xD1, 0x00, 0x02, 0x7F, 0xD8,
+    0x55, 0x5A, 0xDF, 0x31, 0x00, 0x49, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0x20,
+    0x07, 0xCF, 0x77, 0x77, 0x77, 0x9F, 0xB4, 0x01, 0x9D, 0xC2, 0x22, 0x22,
+    0x25, 0xCE, 0x51, 0x3B, 0xD8, 0x00, 0x00, 0x00, 0x38, 0xF7, 0x27, 0xCB,
+    0x40, 0x00, 0x00, 0x01, 0x4F, 0xA5, 0xCD, 0x90, 0x00, 0x00, 0x00, 0x00,
+    0xDD, 0x84, 0x43, 0x00, 0x00, 0x00, 0x00, 0x04, 0x43, 0x00, 0x12, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xF5, 0x00, 0x14, 0xFB, 0xBF, 0xDB, 0x99, 0x93, 0x00,
+    0x26, 0xD7, 0x8F, 0xB7, 0x44, 0x41, 0x00, 0x39, 0xB4, 0x5F, 0xA3, 0x00,
+    0x00, 0x00, 0x4C, 0x83, 0x5F, 0xA3, 0x00, 0x00, 0x00, 0x5E, 0x52, 0x5F,
+    0xA3, 0x00, 0x00, 0x01, 0x6F, 0x31, 0x5F, 0xB7, 0x55, 0x52, 0x03, 0x8F,
+    0x10, 0x5F, 0xFF, 0xFF, 0xF5, 0x05, 0x9C, 0x00, 0x5F, 0xC8, 0x77, 0x72,
+    0x07, 0xBE, 0xAA, 0xCF, 0xA5, 0x22, 0x21, 0x08, 0xCD, 0xCC, 0xDF, 0xA3,
+    0x00, 0x00, 0x0A, 0xD9, 0x77, 0x9F, 0xA3, 0x00, 0x00, 0x3B, 0xB3, 0x00,
+    0x5F, 0xA3, 0x00, 0x00, 0x5C, 0xA1, 0x00, 0x5F, 0xA3, 0x00, 0x00, 0x8C,
+    0x90, 0x00, 0x5F, 0xA5, 0x22, 0x21, 0xAB, 0x80, 0x00, 0x5F, 0xC8, 0x77,
+    0x72, 0xDB, 0x60, 0x00, 0x5F, 0xFF, 0xFF, 0xF5, 0x44, 0x20, 0x00, 0x25,
+    0x55, 0x55, 0x52, 0x00, 0x12, 0x9C, 0xEF, 0xEC, 0xA6, 0x02, 0x5A, 0xDB,
+    0xAA, 0xAB, 0xB8, 0x05, 0x9E, 0xB8, 0x65, 0x57, 0x77, 0x1A, 0xEE, 0x31,
+    0x00, 0x00, 0x00, 0x7C, 0xC6, 0x00, 0x00, 0x00, 0x00, 0xAD, 0xB2, 0x00,
+    0x00, 0x00, 0x00, 0xCD, 0x90, 0x00, 0x00, 0x00, 0x00, 0xED, 0x80, 0x00,
+    0x00, 0x00, 0x00, 0xFC, 0x70, 0x00, 0x00, 0x00, 0x00, 0xED, 0x80, 0x00,
+    0x00, 0x00, 0x00, 0xDD, 0x90, 0x00, 0x00, 0x00, 0x00, 0xCE, 0xA0, 0x00,
+    0x00, 0x00, 0x00, 0x8D, 0xC5, 0x00, 0x00, 0x00, 0x00, 0x4B, 0xDB, 0x21,
+    0x00, 0x00, 0x00, 0x18, 0xCE, 0x74, 0x32, 0x23, 0x34, 0x03, 0x8F, 0xFC,
+    0x97, 0x78, 0xAD, 0x00, 0x12, 0x9C, 0xEF, 0xED, 0xC9, 0x00, 0x01, 0x35,
+    0x8D, 0x54, 0x43, 0x00, 0x00, 0x01, 0x5C, 0x31, 0x00, 0x00, 0x00, 0x02,
+    0x7D, 0x93, 0x00, 0x00, 0x00, 0x00, 0x26, 0xC4, 0x00, 0x00, 0x00, 0x06,
+    0x99, 0x52, 0x00, 0x00, 0x00, 0x06, 0x97, 0x10, 0x00, 0x00, 0x4C, 0xF6,
+    0x10, 0x00, 0x00, 0x02, 0x6F, 0x83, 0x00, 0x00, 0x00, 0x12, 0xCA, 0x60,
+    0x00, 0x00, 0x00, 0x07, 0xB9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xA7, 0xFE, 0xDC, 0xCC, 0xCC, 0xCC, 0x8F,
+    0xDA, 0x77, 0x77, 0x77, 0x74, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x0F, 0xB6,
+    0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x0F, 0xB6, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0xEC, 0x99, 0x99,
+    0x99, 0x96, 0xFC, 0x94, 0x44, 0x44, 0x44, 0x3F, 0xB6, 0x00, 0x00, 0x00,
+    0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x0F, 0xB6, 0x00, 0x00, 0x00, 0x00,
+    0xFB, 0x60, 0x00, 0x00, 0x00, 0x0F, 0xB6, 0x00, 0x00, 0x00, 0x00, 0xFD,
+    0xA7, 0x77, 0x77, 0x77, 0x4F, 0xED, 0xCC, 0xCC, 0xCC, 0xC8, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0x70, 0x00, 0x00, 0x2A, 0xEC, 0x00, 0x00, 0x00, 0x05,
+    0xCC, 0x60, 0x00, 0x00, 0x00, 0x9B, 0x92, 0x00, 0x00, 0x00, 0x0D, 0x95,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xA7, 0xFE, 0xDC, 0xCC, 0xCC, 0xCC, 0x8F, 0xDA, 0x77, 0x77, 0x77, 0x74,
+    0xFB, 0x60, 0x00, 0x00, 0x00, 0x0F, 0xB6, 0x00, 0x00, 0x00, 0x00, 0xFB,
+    0x60, 0x00, 0x00, 0x00, 0x0F, 0xB6, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xAF, 0xEC, 0x99, 0x99, 0x99, 0x96, 0xFC, 0x94, 0x44,
+    0x44, 0x44, 0x3F, 0xB6, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00,
+    0x00, 0x0F, 0xB6, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00,
+    0x0F, 0xB6, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xA7, 0x77, 0x77, 0x77, 0x4F,
+    0xED, 0xCC, 0xCC, 0xCC, 0xC8, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x70, 0x00,
+    0x00, 0x9D, 0xD9, 0x00, 0x00, 0x01, 0x2D, 0xCC, 0xD2, 0x10, 0x00, 0x26,
+    0xC8, 0x8D, 0x62, 0x00, 0x04, 0xC8, 0x33, 0x8C, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xA7, 0xFE, 0xDC, 0xCC, 0xCC,
+    0xCC, 0x8F, 0xDA, 0x77, 0x77, 0x77, 0x74, 0xFB, 0x60, 0x00, 0x00, 0x00,
+    0x0F, 0xB6, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x0F,
+    0xB6, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0xEC,
+    0x99, 0x99, 0x99, 0x96, 0xFC, 0x94, 0x44, 0x44, 0x44, 0x3F, 0xB6, 0x00,
+    0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x0F, 0xB6, 0x00, 0x00,
+    0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x0F, 0xB6, 0x00, 0x00, 0x00,
+    0x00, 0xFD, 0xA7, 0x77, 0x77, 0x77, 0x4F, 0xED, 0xCC, 0xCC, 0xCC, 0xC8,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x70, 0x00, 0x4C, 0x62, 0x26, 0xC4, 0x00,
+    0x04, 0xC6, 0x22, 0x6C, 0x40, 0x00, 0x38, 0x41, 0x14, 0x83, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0xEC, 0x99,
+    0x99, 0x99, 0x96, 0xFC, 0x94, 0x44, 0x44, 0x44, 0x3F, 0xB6, 0x00, 0x00,
+    0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x0F, 0xB6, 0x00, 0x00, 0x00,
+    0x00, 0xFD, 0x95, 0x55, 0x55, 0x55, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA,
+    0xFD, 0xA7, 0x77, 0x77, 0x77, 0x4F, 0xC8, 0x22, 0x22, 0x22, 0x21, 0xFB,
+    0x60, 0x00, 0x00, 0x00, 0x0F, 0xB6, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60,
+    0x00, 0x00, 0x00, 0x0F, 0xB6, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x82, 0x22,
+    0x22, 0x22, 0x1F, 0xDA, 0x77, 0x77, 0x77, 0x74, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xA5, 0x55, 0x55, 0x55, 0x55, 0x53, 0x00, 0x4C, 0xF6, 0x10, 0x00,
+    0x00, 0x02, 0x6F, 0x83, 0x00, 0x00, 0x00, 0x12, 0xCA, 0x60, 0x00, 0x00,
+    0x00, 0x07, 0xB9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x7A,
+    0xAA, 0xAA, 0xAA, 0x74, 0x28, 0xBC, 0xEF, 0xEC, 0xB8, 0x41, 0x34, 0x5C,
+    0xEC, 0x54, 0x31, 0x00, 0x00, 0x9D, 0xA0, 0x00, 0x00, 0x00, 0x09, 0xDA,
+    0x00, 0x00, 0x00, 0x00, 0x9D, 0xA0, 0x00, 0x00, 0x00, 0x09, 0xDA, 0x00,
+    0x00, 0x00, 0x00, 0x9D, 0xA0, 0x00, 0x00, 0x00, 0x09, 0xDA, 0x00, 0x00,
+    0x00, 0x00, 0x9D, 0xA0, 0x00, 0x00, 0x00, 0x09, 0xDA, 0x00, 0x00, 0x00,
+    0x00, 0x9D, 0xA0, 0x00, 0x00, 0x00, 0x09, 0xDA, 0x00, 0x00, 0x00, 0x00,
+    0x9D, 0xA0, 0x00, 0x00, 0x00, 0x09, 0xDA, 0x00, 0x00, 0x13, 0x45, 0xCE,
+    0xC5, 0x43, 0x12, 0x8B, 0xCE, 0xFE, 0xCB, 0x84, 0x27, 0xAA, 0xAA, 0xAA,
+    0xA7, 0x40, 0x00, 0x00, 0x01, 0x6F, 0xC4, 0x00, 0x00, 0x00, 0x48, 0xF6,
+    0x20, 0x00, 0x00, 0x06, 0xAC, 0x21, 0x00, 0x00, 0x00, 0x9B, 0x70, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x7A, 0xAA, 0xAA, 0xAA, 0x74, 0x28,
+    0xBC, 0xEF, 0xEC, 0xB8, 0x41, 0x34, 0x5C, 0xEC, 0x54, 0x31, 0x00, 0x00,
+    0x9D, 0xA0, 0x00, 0x00, 0x00, 0x09, 0xDA, 0x00, 0x00, 0x00, 0x00, 0x9D,
+    0xA0, 0x00, 0x00, 0x00, 0x09, 0xDA, 0x00, 0x00, 0x00, 0x00, 0x9D, 0xA0,
+    0x00, 0x00, 0x00, 0x09, 0xDA, 0x00, 0x00, 0x00, 0x00, 0x9D, 0xA0, 0x00,
+    0x00, 0x00, 0x09, 0xDA, 0x00, 0x00, 0x00, 0x00, 0x9D, 0xA0, 0x00, 0x00,
+    0x00, 0x09, 0xDA, 0x00, 0x00, 0x00, 0x00, 0x9D, 0xA0, 0x00, 0x00, 0x00,
+    0x09, 0xDA, 0x00, 0x00, 0x13, 0x45, 0xCE, 0xC5, 0x43, 0x12, 0x8B, 0xCE,
+    0xFE, 0xCB, 0x84, 0x27, 0xAA, 0xAA, 0xAA, 0xA7, 0x40, 0x00, 0x00, 0x9D,
+    0xD9, 0x00, 0x00, 0x01, 0x2D, 0xCC, 0xD2, 0x10, 0x00, 0x26, 0xC8, 0x8D,
+    0x62, 0x00, 0x04, 0xC8, 0x33, 0x8C, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x7A, 0xAA, 0xAA, 0xAA, 0x74, 0x28, 0xBC, 0xEF, 0xEC, 0xB8, 0x41,
+    0x34, 0x5C, 0xEC, 0x54, 0x31, 0x00, 0x00, 0x9D, 0xA0, 0x00, 0x00, 0x00,
+    0x09, 0xDA, 0x00, 0x00, 0x00, 0x00, 0x9D, 0xA0, 0x00, 0x00, 0x00, 0x09,
+    0xDA, 0x00, 0x00, 0x00, 0x00, 0x9D, 0xA0, 0x00, 0x00, 0x00, 0x09, 0xDA,
+    0x00, 0x00, 0x00, 0x00, 0x9D, 0xA0, 0x00, 0x00, 0x00, 0x09, 0xDA, 0x00,
+    0x00, 0x00, 0x00, 0x9D, 0xA0, 0x00, 0x00, 0x00, 0x09, 0xDA, 0x00, 0x00,
+    0x00, 0x00, 0x9D, 0xA0, 0x00, 0x00, 0x00, 0x09, 0xDA, 0x00, 0x00, 0x13,
+    0x45, 0xCE, 0xC5, 0x43, 0x12, 0x8B, 0xCE, 0xFE, 0xCB, 0x84, 0x27, 0xAA,
+    0xAA, 0xAA, 0xA7, 0x40, 0x00, 0x4C, 0x62, 0x26, 0xC4, 0x00, 0x04, 0xC6,
+    0x22, 0x6C, 0x40, 0x00, 0x38, 0x41, 0x14, 0x83, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x3B, 0xFF, 0xFF, 0xFF, 0xFB, 0x62, 0x68, 0x8D, 0xED, 0x98,
+    0x53, 0x02, 0x33, 0xBE, 0xB4, 0x32, 0x10, 0x00, 0x09, 0xDA, 0x00, 0x00,
+    0x00, 0x00, 0x9D, 0xA0, 0x00, 0x00, 0x00, 0x09, 0xDA, 0x00, 0x00, 0x00,
+    0x00, 0x9D, 0xA0, 0x00, 0x00, 0x00, 0x09, 0xDA, 0x00, 0x00, 0x00, 0x00,
+    0x9D, 0xA0, 0x00, 0x00, 0x00, 0x09, 0xDA, 0x00, 0x00, 0x00, 0x00, 0x9D,
+    0xA0, 0x00, 0x00, 0x00, 0x09, 0xDA, 0x00, 0x00, 0x00, 0x00, 0x9D, 0xA0,
+    0x00, 0x00, 0x00, 0x09, 0xDA, 0x00, 0x00, 0x01, 0x12, 0xAD, 0xB2, 0x11,
+    0x01, 0x34, 0x5C, 0xEC, 0x54, 0x31, 0x3B, 0xFF, 0xFF, 0xFF, 0xFB, 0x61,
+    0x45, 0x55, 0x55, 0x55, 0x42, 0x0A, 0xFF, 0xFF, 0xED, 0x84, 0x10, 0x00,
+    0x0A, 0xED, 0x99, 0xAB, 0xDB, 0x72, 0x00, 0x0A, 0xEB, 0x44, 0x56, 0xAD,
+    0xC7, 0x00, 0x0A, 0xDA, 0x00, 0x00, 0x2A, 0xEE, 0x10, 0x0A, 0xDA, 0x00,
+    0x00, 0x03, 0x8F, 0x83, 0x0A, 0xDA, 0x00, 0x00, 0x01, 0x6F, 0xA3, 0x5C,
+    0xEB, 0x55, 0x55, 0x00, 0x5E, 0xD4, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x4C,
+    0xE5, 0x7C, 0xEC, 0x77, 0x77, 0x00, 0x4B, 0xF5, 0x2B, 0xDA, 0x22, 0x22,
+    0x00, 0x4C, 0xE5, 0x0A, 0xDA, 0x00, 0x00, 0x00, 0x4D, 0xD4, 0x0A, 0xDA,
+    0x00, 0x00, 0x00, 0x5F, 0xB4, 0x0A, 0xDA, 0x00, 0x00, 0x04, 0x9F, 0x72,
+    0x0A, 0xDA, 0x00, 0x00, 0x28, 0xCE, 0x31, 0x0A, 0xDA, 0x22, 0x34, 0x7C,
+    0xDA, 0x10, 0x0A, 0xEC, 0x67, 0x8B, 0xFE, 0xA3, 0x00, 0x0A, 0xFF, 0xFE,
+    0xDC, 0x83, 0x10, 0x00, 0x03, 0x55, 0x55, 0x44, 0x31, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x48, 0x95, 0x20, 0x16, 0x60, 0x03,
+    0x7B, 0xB9, 0x63, 0x49, 0x80, 0x07, 0xA9, 0x8D, 0xD9, 0x9A, 0x70, 0x09,
+    0x91, 0x03, 0x7D, 0xD6, 0x20, 0x03, 0x30, 0x01, 0x24, 0x42, 0x10, 0x55,
+    0x30, 0x00, 0x00, 0x02, 0x35, 0xFE, 0x90, 0x00, 0x00, 0x05, 0xAF, 0xFF,
+    0xC7, 0x00, 0x00, 0x05, 0xAF, 0xFE, 0xDC, 0x10, 0x00, 0x05, 0xAF, 0xFC,
+    0xBE, 0x41, 0x00, 0x05, 0xAF, 0xFA, 0x9D, 0x83, 0x00, 0x05, 0xAF, 0xFA,
+    0x65, 0xF6, 0x10, 0x05, 0xAF, 0xFA, 0x62, 0xC9, 0x50, 0x05, 0xAF, 0xFA,
+    0x50, 0x9B, 0x81, 0x05, 0xAF, 0xFA, 0x50, 0x3B, 0xB3, 0x05, 0xAF, 0xFA,
+    0x50, 0x07, 0xAC, 0x05, 0xAF, 0xFA, 0x50, 0x03, 0x8E, 0x36, 0xAF, 0xFA,
+    0x50, 0x01, 0x5D, 0x87, 0xAF, 0xFA, 0x50, 0x00, 0x38, 0xD9, 0xAF, 0xFA,
+    0x50, 0x00, 0x01, 0xED, 0xDF, 0xFA, 0x50, 0x00, 0x00, 0x9D, 0xEF, 0xFA,
+    0x50, 0x00, 0x00, 0x5B, 0xFF, 0xFA, 0x50, 0x00, 0x00, 0x09, 0xEF, 0x00,
+    0x00, 0xCE, 0xA2, 0x00, 0x00, 0x00, 0x00, 0x6C, 0xC5, 0x00, 0x00, 0x00,
+    0x00, 0x29, 0xB9, 0x00, 0x00, 0x00, 0x00, 0x05, 0x9D, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x99, 0x99, 0x52, 0x00, 0x03,
+    0x6A, 0xCC, 0xCC, 0xA6, 0x20, 0x07, 0xCF, 0xA8, 0x8A, 0xFC, 0x70, 0x5C,
+    0xD9, 0x00, 0x00, 0x8D, 0xB4, 0x8D, 0xB4, 0x00, 0x00, 0x4B, 0xD8, 0xBD,
+    0xA1, 0x00, 0x00, 0x1A, 0xDA, 0xDD, 0x90, 0x00, 0x00, 0x09, 0xDD, 0xED,
+    0x80, 0x00, 0x00, 0x08, 0xDE, 0xFC, 0x80, 0x00, 0x00, 0x08, 0xCF, 0xFC,
+    0x80, 0x00, 0x00, 0x08, 0xCF, 0xED, 0x80, 0x00, 0x00, 0x08, 0xDE, 0xDD,
+    0x90, 0x00, 0x00, 0x09, 0xDD, 0xBD, 0xA1, 0x00, 0x00, 0x1A, 0xDA, 0x8D,
+    0xB4, 0x00, 0x00, 0x4B, 0xD8, 0x5C, 0xD9, 0x00, 0x00, 0x8D, 0xB4, 0x07,
+    0xCF, 0xA8, 0x8A, 0xFB, 0x60, 0x03, 0x6A, 0xCC, 0xCC, 0xA6, 0x20, 0x00,
+    0x25, 0x99, 0x99, 0x52, 0x00, 0x00, 0x00, 0x01, 0x6F, 0xC4, 0x00, 0x00,
+    0x00, 0x04, 0x8F, 0x62, 0x00, 0x00, 0x00, 0x06, 0xAC, 0x21, 0x00, 0x00,
+    0x00, 0x09, 0xB7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x25, 0x99, 0x99, 0x52, 0x00, 0x03, 0x6A, 0xCC, 0xCC, 0xA6, 0x20, 0x07,
+    0xCF, 0xA8, 0x8A, 0xFC, 0x70, 0x5C, 0xD9, 0x00, 0x00, 0x8D, 0xB4, 0x8D,
+    0xB4, 0x00, 0x00, 0x4B, 0xD8, 0xBD, 0xA1, 0x00, 0x00, 0x1A, 0xDA, 0xDD,
+    0x90, 0x00, 0x00, 0x09, 0xDD, 0xED, 0x80, 0x00, 0x00, 0x08, 0xDE, 0xFC,
+    0x80, 0x00, 0x00, 0x08, 0xCF, 0xFC, 0x80, 0x00, 0x00, 0x08, 0xCF, 0xED,
+    0x80, 0x00, 0x00, 0x08, 0xDE, 0xDD, 0x90, 0x00, 0x00, 0x09, 0xDD, 0xBD,
+    0xA1, 0x00, 0x00, 0x1A, 0xDA, 0x8D, 0xB4, 0x00, 0x00, 0x4B, 0xD8, 0x5C,
+    0xD9, 0x00, 0x00, 0x8D, 0xB4, 0x07, 0xCF, 0xA8, 0x8A, 0xFB, 0x60, 0x03,
+    0x6A, 0xCC, 0xCC, 0xA6, 0x20, 0x00, 0x25, 0x99, 0x99, 0x52, 0x00, 0x00,
+    0x00, 0x9D, 0xD9, 0x00, 0x00, 0x00, 0x12, 0xDC, 0xCD, 0x21, 0x00, 0x00,
+    0x26, 0xC8, 0x8D, 0x62, 0x00, 0x00, 0x4C, 0x83, 0x38, 0xC4, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x99, 0x99, 0x52, 0x00, 0x03,
+    0x6A, 0xCC, 0xCC, 0xA6, 0x20, 0x07, 0xCF, 0xA8, 0x8A, 0xFC, 0x70, 0x5C,
+    0xD9, 0x00, 0x00, 0x8D, 0xB4, 0x8D, 0xB4, 0x00, 0x00, 0x4B, 0xD8, 0xBD,
+    0xA1, 0x00, 0x00, 0x1A, 0xDA, 0xDD, 0x90, 0x00, 0x00, 0x09, 0xDD, 0xED,
+    0x80, 0x00, 0x00, 0x08, 0xDE, 0xFC, 0x80, 0x00, 0x00, 0x08, 0xCF, 0xFC,
+    0x80, 0x00, 0x00, 0x08, 0xCF, 0xED, 0x80, 0x00, 0x00, 0x08, 0xDE, 0xDD,
+    0x90, 0x00, 0x00, 0x09, 0xDD, 0xBD, 0xA1, 0x00, 0x00, 0x1A, 0xDA, 0x8D,
+    0xB4, 0x00, 0x00, 0x4B, 0xD8, 0x5C, 0xD9, 0x00, 0x00, 0x8D, 0xB4, 0x07,
+    0xCF, 0xA8, 0x8A, 0xFB, 0x60, 0x03, 0x6A, 0xCC, 0xCC, 0xA6, 0x20, 0x00,
+    0x25, 0x99, 0x99, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x48, 0x95, 0x20, 0x16, 0x60, 0x03, 0x7B, 0xB9, 0x63, 0x49, 0x80, 0x07,
+    0xA9, 0x8D, 0xD9, 0x9A, 0x70, 0x09, 0x91, 0x03, 0x7D, 0xD6, 0x20, 0x03,
+    0x30, 0x01, 0x24, 0x42, 0x10, 0x00, 0x13, 0x45, 0x54, 0x31, 0x00, 0x00,
+    0x38, 0xDE, 0xED, 0x83, 0x00, 0x07, 0xCF, 0xA8, 0x8A, 0xFC, 0x70, 0x3A,
+    0xDB, 0x33, 0x33, 0xAC, 0xA3, 0x7C, 0xC6, 0x00, 0x00, 0x6C, 0xC6, 0xAD,
+    0xB2, 0x00, 0x00, 0x1A, 0xD9, 0xDD, 0x90, 0x00, 0x00, 0x09, 0xDD, 0xED,
+    0x80, 0x00, 0x00, 0x08, 0xDE, 0xFC, 0x80, 0x00, 0x00, 0x08, 0xCE, 0xFC,
+    0x70, 0x00, 0x00, 0x07, 0xCF, 0xED, 0x80, 0x00, 0x00, 0x08, 0xDE, 0xDD,
+    0x80, 0x00, 0x00, 0x08, 0xDD, 0xCD, 0x91, 0x00, 0x00, 0x19, 0xDB, 0xAD,
+    0xB2, 0x00, 0x00, 0x2B, 0xD9, 0x5C, 0xD9, 0x00, 0x00, 0x8D, 0xB4, 0x29,
+    0xDD, 0x75, 0x57, 0xDC, 0x81, 0x05, 0x9D, 0xBA, 0xAB, 0xC9, 0x40, 0x00,
+    0x38, 0xDE, 0xED, 0x73, 0x00, 0x00, 0x4C, 0x62, 0x26, 0xC4, 0x00, 0x00,
+    0x4C, 0x62, 0x26, 0xC4, 0x00, 0x00, 0x38, 0x41, 0x14, 0x83, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xDE, 0xED, 0x83, 0x00, 0x05,
+    0x9D, 0xBA, 0xAB, 0xD9, 0x40, 0x29, 0xDD, 0x75, 0x57, 0xDC, 0x81, 0x5C,
+    0xD9, 0x00, 0x00, 0x8D, 0xB4, 0xAD, 0xB2, 0x00, 0x00, 0x1A, 0xD9, 0xCD,
+    0x91, 0x00, 0x00, 0x09, 0xDC, 0xDD, 0x80, 0x00, 0x00, 0x08, 0xDD, 0xED,
+    0x80, 0x00, 0x00, 0x08, 0xDE, 0xFC, 0x70, 0x00, 0x00, 0x07, 0xCF, 0xFD,
+    0x80, 0x00, 0x00, 0x08, 0xCE, 0xED, 0x80, 0x00, 0x00, 0x08, 0xDE, 0xDD,
+    0x90, 0x00, 0x00, 0x09, 0xDD, 0xAD, 0xB2, 0x00, 0x00, 0x2B, 0xD9, 0x7C,
+    0xC6, 0x00, 0x00, 0x6C, 0xC6, 0x3A, 0xDB, 0x33, 0x33, 0xBC, 0xA3, 0x07,
+    0xCF, 0xA8, 0x8A, 0xFB, 0x60, 0x00, 0x38, 0xDE, 0xED, 0x73, 0x00, 0x00,
+    0x13, 0x45, 0x54, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
+    0x74, 0x00, 0x00, 0x37, 0x61, 0x07, 0xA9, 0x21, 0x01, 0x8A, 0x71, 0x04,
+    0x8E, 0x52, 0x14, 0xE9, 0x40, 0x00, 0x14, 0xE9, 0x9E, 0x52, 0x00, 0x00,
+    0x01, 0x9B, 0xB9, 0x21, 0x00, 0x00, 0x01, 0x9B, 0xB9, 0x10, 0x00, 0x00,
+    0x14, 0xE9, 0x9E, 0x41, 0x00, 0x03, 0x8E, 0x41, 0x14, 0xE8, 0x40, 0x07,
+    0xA8, 0x10, 0x01, 0x8A, 0x71, 0x06, 0x74, 0x00, 0x00, 0x37, 0x61, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x12, 0x00,
+    0x00, 0x25, 0x99, 0x98, 0x56, 0x89, 0x00, 0x03, 0x6A, 0xCC, 0xCC, 0xAB,
+    0xBA, 0x00, 0x07, 0xCF, 0xA8, 0x8A, 0xFF, 0xC5, 0x00, 0x5C, 0xD9, 0x00,
+    0x00, 0xDE, 0xB4, 0x00, 0x8D, 0xB4, 0x00, 0x14, 0xCE, 0xC8, 0x00, 0xBD,
+    0xA1, 0x00, 0x38, 0x9C, 0xDB, 0x00, 0xDD, 0x90, 0x00, 0x5D, 0x4A, 0xDD,
+    0x00, 0xED, 0x80, 0x05, 0x8A, 0x08, 0xDE, 0x00, 0xFC, 0x80, 0x18, 0xA5,
+    0x08, 0xCF, 0x00, 0xFC, 0x80, 0x49, 0x92, 0x08, 0xCF, 0x00, 0xED, 0x80,
+    0x99, 0x60, 0x08, 0xDE, 0x00, 0xDD, 0x93, 0xE5, 0x10, 0x09, 0xDD, 0x00,
+    0xBD, 0xC8, 0x93, 0x00, 0x1A, 0xDA, 0x00, 0x8D, 0xEC, 0x52, 0x00, 0x4B,
+    0xD8, 0x00, 0x5C, 0xFE, 0x10, 0x00, 0x8D, 0xB4, 0x00, 0x4B, 0xFF, 0xA8,
+    0x8A, 0xFB, 0x60, 0x00, 0x9B, 0xCA, 0xCC, 0xCC, 0xA6, 0x20, 0x00, 0x98,
+    0x75, 0x99, 0x99, 0x52, 0x00, 0x00, 0x22, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xCE, 0xA2, 0x00, 0x00, 0x00, 0x00, 0x6C, 0xC5, 0x00,
+    0x00, 0x00, 0x00, 0x29, 0xB9, 0x00, 0x00, 0x00, 0x00, 0x05, 0x9D, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA7, 0x40, 0x00, 0x00, 0x04,
+    0x8A, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06,
+    0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06,
+    0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06,
+    0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06,
+    0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06,
+    0xBF, 0xFC, 0x70, 0x00, 0x00, 0x07, 0xCF, 0xEC, 0x80, 0x00, 0x00, 0x08,
+    0xDE, 0xCD, 0x91, 0x00, 0x00, 0x29, 0xDC, 0xAD, 0xB4, 0x00, 0x00, 0x5C,
+    0xD9, 0x2A, 0xEF, 0x98, 0x89, 0xFE, 0xA2, 0x15, 0x8C, 0xCC, 0xCC, 0xB8,
+    0x41, 0x01, 0x37, 0x9A, 0xA9, 0x63, 0x10, 0x00, 0x00, 0x01, 0x6F, 0xC4,
+    0x00, 0x00, 0x00, 0x04, 0x8F, 0x62, 0x00, 0x00, 0x00, 0x06, 0xAC, 0x21,
+    0x00, 0x00, 0x00, 0x09, 0xB7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xA7, 0x40, 0x00, 0x00, 0x04, 0x8A, 0xFB, 0x60, 0x00, 0x00, 0x06,
+    0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06,
+    0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06,
+    0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06,
+    0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06,
+    0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFC, 0x70, 0x00, 0x00, 0x07,
+    0xCF, 0xEC, 0x80, 0x00, 0x00, 0x08, 0xDE, 0xCD, 0x91, 0x00, 0x00, 0x29,
+    0xDC, 0xAD, 0xB4, 0x00, 0x00, 0x5C, 0xD9, 0x2A, 0xEF, 0x98, 0x89, 0xFE,
+    0xA2, 0x15, 0x8C, 0xCC, 0xCC, 0xB8, 0x41, 0x01, 0x37, 0x9A, 0xA9, 0x63,
+    0x10, 0x00, 0x00, 0x9D, 0xD9, 0x00, 0x00, 0x00, 0x12, 0xDC, 0xCD, 0x21,
+    0x00, 0x00, 0x26, 0xC8, 0x8D, 0x62, 0x00, 0x00, 0x4C, 0x83, 0x38, 0xC4,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA7, 0x40, 0x00, 0x00, 0x04,
+    0x8A, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06,
+    0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06,
+    0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06,
+    0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06,
+    0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06,
+    0xBF, 0xFC, 0x70, 0x00, 0x00, 0x07, 0xCF, 0xEC, 0x80, 0x00, 0x00, 0x08,
+    0xDE, 0xCD, 0x91, 0x00, 0x00, 0x29, 0xDC, 0xAD, 0xB4, 0x00, 0x00, 0x5C,
+    0xD9, 0x2A, 0xEF, 0x98, 0x89, 0xFE, 0xA2, 0x15, 0x8C, 0xCC, 0xCC, 0xB8,
+    0x41, 0x01, 0x37, 0x9A, 0xA9, 0x63, 0x10, 0x00, 0x4C, 0x62, 0x26, 0xC4,
+    0x00, 0x00, 0x4C, 0x62, 0x26, 0xC4, 0x00, 0x00, 0x38, 0x41, 0x14, 0x83,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x06,
+    0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06,
+    0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06,
+    0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06,
+    0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06,
+    0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFC, 0x70, 0x00, 0x00, 0x07,
+    0xCF, 0xFC, 0x70, 0x00, 0x00, 0x07, 0xCF, 0xDD, 0x80, 0x00, 0x00, 0x08,
+    0xDD, 0xBD, 0xA3, 0x00, 0x00, 0x3A, 0xDB, 0x7C, 0xC8, 0x33, 0x33, 0x8C,
+    0xC7, 0x2A, 0xEF, 0x98, 0x89, 0xFE, 0xA2, 0x02, 0x5A, 0xEE, 0xEE, 0xA5,
+    0x10, 0x01, 0x23, 0x55, 0x55, 0x32, 0x00, 0x00, 0x00, 0x00, 0x12, 0xFD,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x25, 0xF9, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0x39, 0xC6, 0x20, 0x00, 0x00, 0x00, 0x00, 0x4D, 0x72, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x84, 0x00, 0x00, 0x00, 0x49,
+    0x72, 0x4B, 0xC8, 0x00, 0x00, 0x02, 0x7E, 0x93, 0x09, 0xDD, 0x00, 0x00,
+    0x05, 0xAF, 0x41, 0x04, 0x9F, 0x41, 0x00, 0x09, 0xDB, 0x00, 0x01, 0x6E,
+    0x93, 0x00, 0x4B, 0xC6, 0x00, 0x00, 0x4B, 0xD5, 0x10, 0x8C, 0xA3, 0x00,
+    0x00, 0x26, 0xF7, 0x20, 0xCC, 0x80, 0x00, 0x00, 0x00, 0xDB, 0x84, 0xF8,
+    0x30, 0x00, 0x00, 0x00, 0x8C, 0xCA, 0xD5, 0x10, 0x00, 0x00, 0x00, 0x4B,
+    0xED, 0x93, 0x00, 0x00, 0x00, 0x00, 0x09, 0xEF, 0x41, 0x00, 0x00, 0x00,
+    0x00, 0x06, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x06, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x06, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x8A, 0x00, 0x00, 0x00,
+    0xFB, 0x60, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x00,
+    0xFD, 0x95, 0x55, 0x54, 0x32, 0x10, 0xFF, 0xFF, 0xFF, 0xED, 0x95, 0x20,
+    0xFD, 0xA6, 0x67, 0x8A, 0xFF, 0xB4, 0xFC, 0x82, 0x22, 0x33, 0x7C, 0xD9,
+    0xFB, 0x60, 0x00, 0x00, 0x2A, 0xED, 0xFB, 0x60, 0x00, 0x00, 0x08, 0xDF,
+    0xFB, 0x60, 0x00, 0x00, 0x08, 0xDE, 0xFB, 0x60, 0x00, 0x00, 0x3A, 0xDB,
+    0xFC, 0x82, 0x22, 0x33, 0x8C, 0xC7, 0xFD, 0xA6, 0x67, 0x8A, 0xFE, 0x92,
+    0xFF, 0xFF, 0xFE, 0xEC, 0x83, 0x10, 0xFD, 0x95, 0x55, 0x54, 0x31, 0x00,
+    0xFB, 0x60, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x00,
+    0xFB, 0x60, 0x00, 0x00, 0x00, 0x00, 0x54, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x05, 0x9C, 0xFE, 0xED, 0x73, 0x00, 0x5A, 0xCB, 0x99, 0x9A, 0xC9, 0x50,
+    0xAD, 0xC7, 0x44, 0x46, 0xDC, 0x80, 0xEC, 0x80, 0x00, 0x00, 0xAD, 0xA0,
+    0xFB, 0x60, 0x00, 0x01, 0xDC, 0x80, 0xFB, 0x60, 0x01, 0x49, 0xD8, 0x30,
+    0xFB, 0x60, 0x15, 0x9C, 0x94, 0x10, 0xFB, 0x60, 0x3B, 0xDA, 0x10, 0x00,
+    0xFB, 0x60, 0x8D, 0xA1, 0x00, 0x00, 0xFB, 0x60, 0x5C, 0xD8, 0x21, 0x00,
+    0xFB, 0x60, 0x28, 0xCD, 0x74, 0x20, 0xFB, 0x60, 0x03, 0x7D, 0xFA, 0x50,
+    0xFB, 0x60, 0x00, 0x01, 0x9D, 0xC7, 0xFB, 0x60, 0x00, 0x00, 0x39, 0xCC,
+    0xFB, 0x60, 0x00, 0x00, 0x07, 0xCE, 0xFB, 0x60, 0x00, 0x00, 0x07, 0xBE,
+    0xFB, 0x60, 0xD9, 0x75, 0x8D, 0xD9, 0xFB, 0x60, 0xAB, 0xBC, 0xBB, 0x84,
+    0xA7, 0x40, 0x68, 0x9A, 0x97, 0x41, 0x00, 0x4C, 0xF6, 0x10, 0x00, 0x00,
+    0x02, 0x6F, 0x83, 0x00, 0x00, 0x00, 0x12, 0xCA, 0x60, 0x00, 0x00, 0x00,
+    0x07, 0xB9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x36, 0x89,
+    0xA9, 0x95, 0x20, 0x16, 0xAB, 0xBC, 0xCC, 0xA6, 0x21, 0x9C, 0x96, 0x67,
+    0xAF, 0xB6, 0x00, 0x00, 0x00, 0x00, 0xCD, 0x90, 0x00, 0x00, 0x00, 0x0A,
+    0xDA, 0x01, 0x23, 0x44, 0x55, 0xBE, 0xA0, 0x36, 0xAD, 0xDE, 0xFF, 0xFA,
+    0x7C, 0xEB, 0x54, 0x32, 0xAD, 0xAB, 0xDA, 0x42, 0x11, 0x1A, 0xDA, 0xED,
+    0x80, 0x00, 0x00, 0xCE, 0xAE, 0xC7, 0x00, 0x00, 0x1E, 0xFA, 0xAD, 0xC7,
+    0x46, 0x9D, 0xCE, 0xA4, 0x9B, 0xBB, 0xBA, 0x87, 0xCA, 0x14, 0x79, 0xA9,
+    0x74, 0x38, 0x70, 0x00, 0x00, 0x01, 0x6F, 0xC4, 0x00, 0x00, 0x00, 0x48,
+    0xF6, 0x20, 0x00, 0x00, 0x06, 0xAC, 0x21, 0x00, 0x00, 0x00, 0x9B, 0x70,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x36, 0x89, 0xA9, 0x95, 0x20,
+    0x16, 0xAB, 0xBC, 0xCC, 0xA6, 0x21, 0x9C, 0x96, 0x67, 0xAF, 0xB6, 0x00,
+    0x00, 0x00, 0x00, 0xCD, 0x90, 0x00, 0x00, 0x00, 0x0A, 0xDA, 0x01, 0x23,
+    0x44, 0x55, 0xBE, 0xA0, 0x36, 0xAD, 0xDE, 0xFF, 0xFA, 0x7C, 0xEB, 0x54,
+    0x32, 0xAD, 0xAB, 0xDA, 0x42, 0x11, 0x1A, 0xDA, 0xED, 0x80, 0x00, 0x00,
+    0xCE, 0xAE, 0xC7, 0x00, 0x00, 0x1E, 0xFA, 0xAD, 0xC7, 0x46, 0x9D, 0xCE,
+    0xA4, 0x9B, 0xBB, 0xBA, 0x87, 0xCA, 0x14, 0x79, 0xA9, 0x74, 0x38, 0x70,
+    0x00, 0x00, 0x9D, 0xD9, 0x00, 0x00, 0x01, 0x2D, 0xCC, 0xD2, 0x10, 0x00,
+    0x26, 0xC8, 0x8D, 0x62, 0x00, 0x04, 0xC8, 0x33, 0x8C, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x36, 0x89, 0xA9, 0x95, 0x20, 0x16, 0xAB, 0xBC,
+    0xCC, 0xA6, 0x21, 0x9C, 0x96, 0x67, 0xAF, 0xB6, 0x00, 0x00, 0x00, 0x00,
+    0xCD, 0x90, 0x00, 0x00, 0x00, 0x0A, 0xDA, 0x01, 0x23, 0x44, 0x55, 0xBE,
+    0xA0, 0x36, 0xAD, 0xDE, 0xFF, 0xFA, 0x7C, 0xEB, 0x54, 0x32, 0xAD, 0xAB,
+    0xDA, 0x42, 0x11, 0x1A, 0xDA, 0xED, 0x80, 0x00, 0x00, 0xCE, 0xAE, 0xC7,
+    0x00, 0x00, 0x1E, 0xFA, 0xAD, 0xC7, 0x46, 0x9D, 0xCE, 0xA4, 0x9B, 0xBB,
+    0xBA, 0x87, 0xCA, 0x14, 0x79, 0xA9, 0x74, 0x38, 0x70, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x14, 0x89, 0x52, 0x01, 0x66, 0x03, 0x7B, 0xB9, 0x63,
+    0x49, 0x80, 0x7A, 0x98, 0xDD, 0x99, 0xA7, 0x09, 0x91, 0x03, 0x7D, 0xD6,
+    0x20, 0x33, 0x00, 0x12, 0x44, 0x21, 0x02, 0x34, 0x55, 0x54, 0x31, 0x01,
+    0x58, 0xCE, 0xEE, 0xD8, 0x30, 0x19, 0xC9, 0x66, 0x7A, 0xFB, 0x60, 0x34,
+    0x32, 0x22, 0x3D, 0xC8, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x90, 0x00, 0x00,
+    0x00, 0x09, 0xDA, 0x03, 0x6A, 0xDD, 0xEF, 0xFF, 0xA4, 0x9B, 0xA8, 0x76,
+    0x6B, 0xEA, 0x9C, 0xC7, 0x32, 0x21, 0xAD, 0xAE, 0xD8, 0x00, 0x00, 0x0A,
+    0xDA, 0xEC, 0x70, 0x00, 0x01, 0xEF, 0xAB, 0xDB, 0x53, 0x46, 0x9D, 0xEA,
+    0x7B, 0xC9, 0x88, 0x9B, 0xAD, 0xA1, 0x7B, 0xEF, 0xDA, 0x64, 0xBA, 0x00,
+    0x4C, 0x62, 0x26, 0xC4, 0x00, 0x04, 0xC6, 0x22, 0x6C, 0x40, 0x00, 0x38,
+    0x41, 0x14, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x8C, 0xEE,
+    0xED, 0x83, 0x01, 0x8B, 0xA9, 0x99, 0xBD, 0x84, 0x16, 0x86, 0x44, 0x57,
+    0xEB, 0x70, 0x00, 0x00, 0x00, 0x0C, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x9D,
+    0xA0, 0x24, 0x78, 0x99, 0xAD, 0xEA, 0x26, 0x9A, 0xAA, 0xAA, 0xDE, 0xA7,
+    0xCE, 0xB5, 0x43, 0x2A, 0xDA, 0xED, 0x80, 0x00, 0x00, 0xAD, 0xAE, 0xC8,
+    0x00, 0x00, 0x1D, 0xEA, 0xDC, 0x92, 0x12, 0x35, 0xDE, 0xAA, 0xDC, 0x74,
+    0x69, 0xDC, 0xEA, 0x17, 0xBE, 0xFD, 0xA6, 0x4B, 0xA0, 0x24, 0x55, 0x43,
+    0x21, 0x43, 0x00, 0x00, 0x5B, 0xDD, 0x52, 0x00, 0x00, 0x0B, 0x76, 0x6B,
+    0x40, 0x00, 0x00, 0xE6, 0x22, 0xE5, 0x00, 0x00, 0x0E, 0x62, 0x2E, 0x50,
+    0x00, 0x00, 0x5B, 0xDD, 0x52, 0x00, 0x00, 0x02, 0x44, 0x42, 0x10, 0x02,
+    0x34, 0x55, 0x54, 0x31, 0x01, 0x58, 0xCE, 0xEE, 0xD8, 0x30, 0x19, 0xC9,
+    0x66, 0x7A, 0xFB, 0x60, 0x34, 0x32, 0x22, 0x3D, 0xC8, 0x00, 0x00, 0x00,
+    0x00, 0xBD, 0x90, 0x00, 0x00, 0x00, 0x09, 0xDA, 0x03, 0x6A, 0xDD, 0xEF,
+    0xFF, 0xA4, 0x9B, 0xA8, 0x76, 0x6B, 0xEA, 0x9C, 0xC7, 0x32, 0x21, 0xAD,
+    0xAE, 0xD8, 0x00, 0x00, 0x0A, 0xDA, 0xEC, 0x70, 0x00, 0x01, 0xEF, 0xAB,
+    0xDB, 0x53, 0x46, 0x9D, 0xEA, 0x7B, 0xC9, 0x88, 0x9B, 0xAD, 0xA1, 0x7B,
+    0xEF, 0xDA, 0x64, 0xBA, 0x16, 0xAD, 0xFD, 0xA4, 0x39, 0xDE, 0x83, 0x01,
+    0x8B, 0x99, 0xBB, 0xBA, 0xAA, 0xAD, 0x72, 0x16, 0x75, 0x47, 0xAF, 0xD9,
+    0x65, 0xE9, 0x50, 0x00, 0x00, 0x16, 0xFD, 0x50, 0x0C, 0xB7, 0x00, 0x00,
+    0x00, 0x5F, 0xA3, 0x00, 0x9C, 0x90, 0x36, 0x89, 0xAC, 0xFD, 0xBA, 0xAD,
+    0xEA, 0x37, 0xAB, 0xBB, 0xCF, 0xEC, 0xCC, 0xCC, 0x88, 0xDD, 0x94, 0x37,
+    0xFB, 0x75, 0x55, 0x53, 0xDC, 0x70, 0x01, 0x6F, 0xB4, 0x00, 0x00, 0x0E,
+    0xC7, 0x00, 0x27, 0xFD, 0x51, 0x00, 0x00, 0xDC, 0x82, 0x26, 0x9C, 0xE8,
+    0x42, 0x33, 0x2A, 0xDC, 0x77, 0xCC, 0x6D, 0xDB, 0x79, 0xA7, 0x28, 0xCE,
+    0xD8, 0x40, 0x38, 0xCE, 0xD8, 0x41, 0x34, 0x54, 0x31, 0x01, 0x34, 0x54,
+    0x31, 0x01, 0x4A, 0xEE, 0xED, 0x93, 0x17, 0xBD, 0xA9, 0x9A, 0x93, 0x4B,
+    0xDB, 0x54, 0x45, 0x62, 0x8D, 0xB4, 0x00, 0x00, 0x00, 0xDD, 0x90, 0x00,
+    0x00, 0x00, 0xEC, 0x80, 0x00, 0x00, 0x00, 0xFC, 0x70, 0x00, 0x00, 0x00,
+    0xFC, 0x70, 0x00, 0x00, 0x00, 0xDD, 0x80, 0x00, 0x00, 0x00, 0xAD, 0xA3,
+    0x00, 0x00, 0x00, 0x6C, 0xC7, 0x32, 0x22, 0x41, 0x1A, 0xEE, 0x86, 0x67,
+    0xB4, 0x01, 0x4A, 0xEE, 0xED, 0xA3, 0x00, 0x13, 0x6A, 0xA5, 0x31, 0x00,
+    0x00, 0x29, 0x93, 0x00, 0x00, 0x00, 0x3A, 0xB9, 0x00, 0x00, 0x00, 0x04,
+    0x8C, 0x00, 0x00, 0x00, 0xA9, 0x85, 0x00, 0x00, 0x00, 0xA8, 0x51, 0x00,
+    0x00, 0x00, 0xCE, 0xA2, 0x00, 0x00, 0x00, 0x00, 0x6C, 0xC5, 0x00, 0x00,
+    0x00, 0x00, 0x29, 0xB9, 0x00, 0x00, 0x00, 0x00, 0x05, 0x9D, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x99, 0xA9, 0x63, 0x10,
+    0x03, 0x6A, 0xBB, 0xCB, 0xB8, 0x41, 0x08, 0xCE, 0x86, 0x67, 0xDE, 0xA2,
+    0x7C, 0xB3, 0x00, 0x00, 0x1A, 0xDA, 0xAC, 0x91, 0x00, 0x00, 0x08, 0xCC,
+    0xDD, 0xA5, 0x55, 0x55, 0x5A, 0xDE, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFD, 0xA5, 0x55, 0x55, 0x55, 0x55, 0xDD, 0x92, 0x22, 0x22, 0x22, 0x22,
+    0xBD, 0xA2, 0x00, 0x00, 0x00, 0x00, 0x7C, 0xC5, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0xCF, 0x97, 0x66, 0x7A, 0xA7, 0x03, 0x69, 0xBB, 0xCC, 0xBA, 0x84,
+    0x00, 0x24, 0x89, 0xAA, 0x97, 0x52, 0x00, 0x00, 0x01, 0x6F, 0xC4, 0x00,
+    0x00, 0x00, 0x04, 0x8F, 0x62, 0x00, 0x00, 0x00, 0x06, 0xAC, 0x21, 0x00,
+    0x00, 0x00, 0x09, 0xB7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x25, 0x99, 0xA9, 0x63, 0x10, 0x03, 0x6A, 0xBB, 0xCB, 0xB8, 0x41,
+    0x08, 0xCE, 0x86, 0x67, 0xDE, 0xA2, 0x7C, 0xB3, 0x00, 0x00, 0x1A, 0xDA,
+    0xAC, 0x91, 0x00, 0x00, 0x08, 0xCC, 0xDD, 0xA5, 0x55, 0x55, 0x5A, 0xDE,
+    0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xA5, 0x55, 0x55, 0x55, 0x55,
+    0xDD, 0x92, 0x22, 0x22, 0x22, 0x22, 0xBD, 0xA2, 0x00, 0x00, 0x00, 0x00,
+    0x7C, 0xC5, 0x00, 0x00, 0x00, 0x00, 0x07, 0xCF, 0x97, 0x66, 0x7A, 0xA7,
+    0x03, 0x69, 0xBB, 0xCC, 0xBA, 0x84, 0x00, 0x24, 0x89, 0xAA, 0x97, 0x52,
+    0x00, 0x00, 0x9D, 0xD9, 0x00, 0x00, 0x00, 0x12, 0xDC, 0xCD, 0x21, 0x00,
+    0x00, 0x26, 0xC8, 0x8D, 0x62, 0x00, 0x00, 0x4C, 0x83, 0x38, 0xC4, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x99, 0xA9, 0x63, 0x10,
+    0x03, 0x6A, 0xBB, 0xCB, 0xB8, 0x41, 0x08, 0xCE, 0x86, 0x67, 0xDE, 0xA2,
+    0x7C, 0xB3, 0x00, 0x00, 0x1A, 0xDA, 0xAC, 0x91, 0x00, 0x00, 0x08, 0xCC,
+    0xDD, 0xA5, 0x55, 0x55, 0x5A, 0xDE, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFD, 0xA5, 0x55, 0x55, 0x55, 0x55, 0xDD, 0x92, 0x22, 0x22, 0x22, 0x22,
+    0xBD, 0xA2, 0x00, 0x00, 0x00, 0x00, 0x7C, 0xC5, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0xCF, 0x97, 0x66, 0x7A, 0xA7, 0x03, 0x69, 0xBB, 0xCC, 0xBA, 0x84,
+    0x00, 0x24, 0x89, 0xAA, 0x97, 0x52, 0x00, 0x4C, 0x62, 0x26, 0xC4, 0x00,
+    0x00, 0x4C, 0x62, 0x26, 0xC4, 0x00, 0x00, 0x38, 0x41, 0x14, 0x83, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xDE, 0xEE, 0xA5, 0x10,
+    0x05, 0x9C, 0xA9, 0x99, 0xCB, 0x71, 0x39, 0xCB, 0x54, 0x45, 0x9C, 0xB5,
+    0x7C, 0xB3, 0x00, 0x00, 0x1A, 0xDA, 0xCC, 0x80, 0x00, 0x00, 0x07, 0xCE,
+    0xEE, 0xDA, 0xAA, 0xAA, 0xAC, 0xEF, 0xEE, 0xDC, 0xCC, 0xCC, 0xCC, 0xCC,
+    0xFD, 0xA5, 0x55, 0x55, 0x55, 0x55, 0xCD, 0x90, 0x00, 0x00, 0x00, 0x00,
+    0x9C, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x5B, 0xC8, 0x32, 0x22, 0x23, 0x32,
+    0x07, 0xCF, 0x97, 0x66, 0x7A, 0xA7, 0x00, 0x27, 0xCE, 0xEE, 0xDB, 0x73,
+    0x00, 0x12, 0x45, 0x55, 0x44, 0x21, 0x00, 0x00, 0xCE, 0xA2, 0x00, 0x00,
+    0x00, 0x00, 0x6C, 0xC5, 0x00, 0x00, 0x00, 0x00, 0x29, 0xB9, 0x00, 0x00,
+    0x00, 0x00, 0x05, 0x9D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x6A, 0xAA, 0x96, 0x00, 0x00, 0x02, 0x6B, 0xBE, 0xD9, 0x00, 0x00,
+    0x00, 0x12, 0x3B, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00,
+    0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00,
+    0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00,
+    0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00,
+    0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00, 0x01, 0x22, 0x3B, 0xDA, 0x32, 0x21,
+    0x07, 0xBB, 0xBE, 0xED, 0xBB, 0xA7, 0x07, 0xAA, 0xAA, 0xAA, 0xAA, 0x97,
+    0x00, 0x00, 0x01, 0x6F, 0xC4, 0x00, 0x00, 0x00, 0x04, 0x8F, 0x62, 0x00,
+    0x00, 0x00, 0x06, 0xAC, 0x21, 0x00, 0x00, 0x00, 0x09, 0xB7, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x6A, 0xAA, 0x96, 0x00, 0x00,
+    0x02, 0x6B, 0xBE, 0xD9, 0x00, 0x00, 0x00, 0x12, 0x3B, 0xD9, 0x00, 0x00,
+    0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00,
+    0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00,
+    0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00,
+    0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00,
+    0x01, 0x22, 0x3B, 0xDA, 0x32, 0x21, 0x07, 0xBB, 0xBE, 0xED, 0xBB, 0xA7,
+    0x07, 0xAA, 0xAA, 0xAA, 0xAA, 0x97, 0x00, 0x00, 0x9D, 0xD9, 0x00, 0x00,
+    0x00, 0x12, 0xDC, 0xCD, 0x21, 0x00, 0x00, 0x26, 0xC8, 0x8D, 0x62, 0x00,
+    0x00, 0x4C, 0x83, 0x38, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x6A, 0xAA, 0x96, 0x00, 0x00, 0x02, 0x6B, 0xBE, 0xD9, 0x00, 0x00,
+    0x00, 0x12, 0x3B, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00,
+    0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00,
+    0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00,
+    0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00,
+    0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00, 0x01, 0x22, 0x3B, 0xDA, 0x32, 0x21,
+    0x07, 0xBB, 0xBE, 0xED, 0xBB, 0xA7, 0x07, 0xAA, 0xAA, 0xAA, 0xAA, 0x97,
+    0x00, 0x4C, 0x62, 0x26, 0xC4, 0x00, 0x00, 0x4C, 0x62, 0x26, 0xC4, 0x00,
+    0x00, 0x38, 0x41, 0x14, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x9F, 0xFF, 0xD9, 0x00, 0x00, 0x01, 0x36, 0x7C, 0xD9, 0x00, 0x00,
+    0x00, 0x11, 0x2B, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00,
+    0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00,
+    0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00,
+    0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00,
+    0x00, 0x11, 0x1A, 0xD9, 0x11, 0x10, 0x01, 0x22, 0x3B, 0xDA, 0x32, 0x21,
+    0x0A, 0xFF, 0xFF, 0xFF, 0xFF, 0xDA, 0x03, 0x55, 0x55, 0x55, 0x55, 0x43,
+    0x00, 0x14, 0xB5, 0x10, 0x58, 0x60, 0x00, 0x12, 0x99, 0x85, 0xA7, 0x40,
+    0x00, 0x12, 0x8B, 0xCA, 0xC6, 0x20, 0x00, 0x13, 0x9C, 0xDE, 0xA3, 0x00,
+    0x00, 0x3A, 0x83, 0x13, 0xE9, 0x50, 0x00, 0x13, 0x31, 0x01, 0x9B, 0x81,
+    0x01, 0x23, 0x55, 0x54, 0x7C, 0xA3, 0x02, 0x5A, 0xEE, 0xED, 0x7C, 0xB7,
+    0x2A, 0xEE, 0x86, 0x68, 0xEF, 0xEB, 0x7C, 0xC7, 0x32, 0x23, 0x7C, 0xED,
+    0xBD, 0xA2, 0x00, 0x00, 0x2A, 0xEE, 0xEC, 0x80, 0x00, 0x00, 0x08, 0xCF,
+    0xFC, 0x70, 0x00, 0x00, 0x07, 0xCE, 0xEC, 0x70, 0x00, 0x00, 0x08, 0xCD,
+    0xCD, 0x91, 0x00, 0x00, 0x19, 0xCA, 0x9D, 0xB3, 0x00, 0x00, 0x3B, 0xC7,
+    0x29, 0xEE, 0x76, 0x68, 0xED, 0x80, 0x14, 0x7B, 0xCC, 0xCB, 0xA7, 0x30,
+    0x01, 0x36, 0x9A, 0x99, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x14, 0x89, 0x52, 0x01, 0x66, 0x03, 0x7B, 0xB9, 0x63, 0x49, 0x80, 0x7A,
+    0x98, 0xDD, 0x99, 0xA7, 0x09, 0x91, 0x03, 0x7D, 0xD6, 0x20, 0x33, 0x00,
+    0x12, 0x44, 0x21, 0x53, 0x22, 0x45, 0x54, 0x31, 0x0F, 0x96, 0x6D, 0xEE,
+    0xD8, 0x30, 0xFD, 0xDE, 0x76, 0x7A, 0xFA, 0x5F, 0xEC, 0x62, 0x22, 0x3D,
+    0xC7, 0xFE, 0xA2, 0x00, 0x00, 0xBD, 0x9F, 0xD8, 0x00, 0x00, 0x09, 0xDA,
+    0xFB, 0x60, 0x00, 0x00, 0x9D, 0xAF, 0xB6, 0x00, 0x00, 0x09, 0xDA, 0xFB,
+    0x60, 0x00, 0x00, 0x9D, 0xAF, 0xB6, 0x00, 0x00, 0x09, 0xDA, 0xFB, 0x60,
+    0x00, 0x00, 0x9D, 0xAF, 0xB6, 0x00, 0x00, 0x09, 0xDA, 0xFB, 0x60, 0x00,
+    0x00, 0x9D, 0xAF, 0xB6, 0x00, 0x00, 0x09, 0xDA, 0x00, 0x00, 0xCE, 0xA2,
+    0x00, 0x00, 0x00, 0x00, 0x6C, 0xC5, 0x00, 0x00, 0x00, 0x00, 0x29, 0xB9,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0x9D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x26, 0x99, 0x99, 0x52, 0x00, 0x03, 0x7A, 0xBC, 0xCB,
+    0xA6, 0x30, 0x19, 0xDE, 0x86, 0x68, 0xED, 0x80, 0x8D, 0xB4, 0x00, 0x00,
+    0x4B, 0xC7, 0xBD, 0x91, 0x00, 0x00, 0x19, 0xDB, 0xDC, 0x80, 0x00, 0x00,
+    0x08, 0xCD, 0xFC, 0x70, 0x00, 0x00, 0x07, 0xCE, 0xFC, 0x70, 0x00, 0x00,
+    0x07, 0xCE, 0xDC, 0x80, 0x00, 0x00, 0x08, 0xCD, 0xBD, 0x91, 0x00, 0x00,
+    0x19, 0xDB, 0x7C, 0xB4, 0x00, 0x00, 0x4B, 0xC7, 0x08, 0xDE, 0x86, 0x68,
+    0xED, 0x81, 0x03, 0x6A, 0xCC, 0xCB, 0xA7, 0x30, 0x00, 0x25, 0x99, 0x99,
+    0x62, 0x00, 0x00, 0x00, 0x01, 0x6F, 0xC4, 0x00, 0x00, 0x00, 0x04, 0x8F,
+    0x62, 0x00, 0x00, 0x00, 0x06, 0xAC, 0x21, 0x00, 0x00, 0x00, 0x09, 0xB7,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x99, 0x99,
+    0x52, 0x00, 0x03, 0x7A, 0xBC, 0xCB, 0xA6, 0x30, 0x19, 0xDE, 0x86, 0x68,
+    0xED, 0x80, 0x8D, 0xB4, 0x00, 0x00, 0x4B, 0xC7, 0xBD, 0x91, 0x00, 0x00,
+    0x19, 0xDB, 0xDC, 0x80, 0x00, 0x00, 0x08, 0xCD, 0xFC, 0x70, 0x00, 0x00,
+    0x07, 0xCE, 0xFC, 0x70, 0x00, 0x00, 0x07, 0xCE, 0xDC, 0x80, 0x00, 0x00,
+    0x08, 0xCD, 0xBD, 0x91, 0x00, 0x00, 0x19, 0xDB, 0x7C, 0xB4, 0x00, 0x00,
+    0x4B, 0xC7, 0x08, 0xDE, 0x86, 0x68, 0xED, 0x81, 0x03, 0x6A, 0xCC, 0xCB,
+    0xA7, 0x30, 0x00, 0x25, 0x99, 0x99, 0x62, 0x00, 0x00, 0x00, 0x9D, 0xD9,
+    0x00, 0x00, 0x00, 0x12, 0xDC, 0xCD, 0x21, 0x00, 0x00, 0x26, 0xC8, 0x8D,
+    0x62, 0x00, 0x00, 0x4C, 0x83, 0x38, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x26, 0x99, 0x99, 0x52, 0x00, 0x03, 0x7A, 0xBC, 0xCB,
+    0xA6, 0x30, 0x19, 0xDE, 0x86, 0x68, 0xED, 0x80, 0x8D, 0xB4, 0x00, 0x00,
+    0x4B, 0xC7, 0xBD, 0x91, 0x00, 0x00, 0x19, 0xDB, 0xDC, 0x80, 0x00, 0x00,
+    0x08, 0xCD, 0xFC, 0x70, 0x00, 0x00, 0x07, 0xCE, 0xFC, 0x70, 0x00, 0x00,
+    0x07, 0xCE, 0xDC, 0x80, 0x00, 0x00, 0x08, 0xCD, 0xBD, 0x91, 0x00, 0x00,
+    0x19, 0xDB, 0x7C, 0xB4, 0x00, 0x00, 0x4B, 0xC7, 0x08, 0xDE, 0x86, 0x68,
+    0xED, 0x81, 0x03, 0x6A, 0xCC, 0xCB, 0xA7, 0x30, 0x00, 0x25, 0x99, 0x99,
+    0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x48, 0x95, 0x20,
+    0x16, 0x60, 0x03, 0x7B, 0xB9, 0x63, 0x49, 0x80, 0x07, 0xA9, 0x8D, 0xD9,
+    0x9A, 0x70, 0x09, 0x91, 0x03, 0x7D, 0xD6, 0x20, 0x03, 0x30, 0x01, 0x24,
+    0x42, 0x10, 0x00, 0x13, 0x45, 0x54, 0x31, 0x00, 0x01, 0x38, 0xDE, 0xED,
+    0x83, 0x00, 0x19, 0xDE, 0x86, 0x68, 0xED, 0x80, 0x5B, 0xC7, 0x32, 0x23,
+    0x8C, 0xB5, 0x9D, 0xA3, 0x00, 0x00, 0x3A, 0xC9, 0xDD, 0x80, 0x00, 0x00,
+    0x09, 0xDC, 0xFC, 0x70, 0x00, 0x00, 0x07, 0xCE, 0xFC, 0x70, 0x00, 0x00,
+    0x07, 0xCE, 0xEC, 0x80, 0x00, 0x00, 0x08, 0xCE, 0xCD, 0x90, 0x00, 0x00,
+    0x09, 0xDC, 0x7C, 0xB4, 0x00, 0x00, 0x4B, 0xC7, 0x3A, 0xCB, 0x54, 0x45,
+    0xBC, 0xA3, 0x06, 0xAC, 0xA9, 0x9A, 0xCA, 0x60, 0x01, 0x38, 0xDE, 0xED,
+    0x83, 0x10, 0x00, 0x4C, 0x62, 0x26, 0xC4, 0x00, 0x00, 0x4C, 0x62, 0x26,
+    0xC4, 0x00, 0x00, 0x38, 0x41, 0x14, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x38, 0xDE, 0xED, 0x83, 0x00, 0x06, 0xAC, 0xA9, 0x9A,
+    0xC9, 0x50, 0x3A, 0xCB, 0x54, 0x45, 0xBC, 0x93, 0x8D, 0xB4, 0x00, 0x00,
+    0x4B, 0xC7, 0xDD, 0x80, 0x00, 0x00, 0x09, 0xDC, 0xEC, 0x80, 0x00, 0x00,
+    0x08, 0xCE, 0xFC, 0x70, 0x00, 0x00, 0x07, 0xCE, 0xFC, 0x70, 0x00, 0x00,
+    0x07, 0xCE, 0xCD, 0x90, 0x00, 0x00, 0x09, 0xDC, 0x9C, 0xA3, 0x00, 0x00,
+    0x3A, 0xD9, 0x5B, 0xC8, 0x32, 0x23, 0x8C, 0xB5, 0x08, 0xDE, 0x86, 0x68,
+    0xED, 0x81, 0x01, 0x38, 0xDE, 0xED, 0x83, 0x10, 0x00, 0x13, 0x45, 0x54,
+    0x31, 0x00, 0x00, 0x00, 0xBA, 0x60, 0x00, 0x00, 0x00, 0x0C, 0xB7, 0x00,
+    0x00, 0x00, 0x00, 0x88, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xA7, 0xCC,
+    0xCC, 0xCC, 0xCC, 0xCC, 0x85, 0x55, 0x55, 0x55, 0x55, 0x53, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43,
+    0x20, 0x00, 0x00, 0x00, 0x0C, 0xA7, 0x00, 0x00, 0x00, 0x00, 0xCB, 0x70,
+    0x00, 0x00, 0x00, 0x04, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+    0x30, 0x00, 0x26, 0x99, 0x99, 0x7A, 0x93, 0x03, 0x7A, 0xBC, 0xBB, 0xCE,
+    0xB3, 0x19, 0xDE, 0x86, 0x67, 0xFE, 0x91, 0x8D, 0xB3, 0x00, 0x27, 0xCE,
+    0xC7, 0xBD, 0x91, 0x01, 0x5C, 0x6B, 0xCB, 0xDC, 0x80, 0x04, 0x8C, 0x28,
+    0xCD, 0xFC, 0x70, 0x08, 0xA7, 0x07, 0xCE, 0xFC, 0x70, 0x7A, 0x80, 0x07,
+    0xCE, 0xDC, 0x81, 0xC8, 0x40, 0x08, 0xCD, 0xBC, 0xB5, 0xC5, 0x10, 0x19,
+    0xDB, 0x7C, 0xEC, 0x72, 0x00, 0x3B, 0xD8, 0x19, 0xEF, 0x76, 0x68, 0xED,
+    0x91, 0x3B, 0xEC, 0xBB, 0xCB, 0xA7, 0x30, 0x39, 0xA7, 0x99, 0xA9, 0x62,
+    0x00, 0x04, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4C, 0xF6, 0x10, 0x00,
+    0x00, 0x02, 0x6F, 0x83, 0x00, 0x00, 0x00, 0x12, 0xCA, 0x60, 0x00, 0x00,
+    0x00, 0x07, 0xB9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x74,
+    0x00, 0x00, 0x06, 0x97, 0xFB, 0x60, 0x00, 0x00, 0x9D, 0xAF, 0xB6, 0x00,
+    0x00, 0x09, 0xDA, 0xFB, 0x60, 0x00, 0x00, 0x9D, 0xAF, 0xB6, 0x00, 0x00,
+    0x09, 0xDA, 0xFB, 0x60, 0x00, 0x00, 0x9D, 0xAF, 0xB6, 0x00, 0x00, 0x09,
+    0xDA, 0xFB, 0x60, 0x00, 0x00, 0x9D, 0xAF, 0xB6, 0x00, 0x00, 0x0A, 0xDA,
+    0xEC, 0x70, 0x00, 0x01, 0xCE, 0xAD, 0xC8, 0x00, 0x01, 0x2E, 0xFA, 0x7C,
+    0xDA, 0x67, 0x9D, 0xDE, 0xA3, 0x8B, 0xCC, 0xBA, 0x88, 0xDA, 0x03, 0x69,
+    0xA9, 0x74, 0x48, 0x70, 0x00, 0x00, 0x2A, 0xEC, 0x00, 0x00, 0x00, 0x05,
+    0xCC, 0x60, 0x00, 0x00, 0x00, 0x9B, 0x92, 0x00, 0x00, 0x00, 0x0D, 0x95,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x74, 0x00, 0x00, 0x06,
+    0x97, 0xFB, 0x60, 0x00, 0x00, 0x9D, 0xAF, 0xB6, 0x00, 0x00, 0x09, 0xDA,
+    0xFB, 0x60, 0x00, 0x00, 0x9D, 0xAF, 0xB6, 0x00, 0x00, 0x09, 0xDA, 0xFB,
+    0x60, 0x00, 0x00, 0x9D, 0xAF, 0xB6, 0x00, 0x00, 0x09, 0xDA, 0xFB, 0x60,
+    0x00, 0x00, 0x9D, 0xAF, 0xB6, 0x00, 0x00, 0x0A, 0xDA, 0xEC, 0x70, 0x00,
+    0x01, 0xCE, 0xAD, 0xC8, 0x00, 0x01, 0x2E, 0xFA, 0x7C, 0xDA, 0x67, 0x9D,
+    0xDE, 0xA3, 0x8B, 0xCC, 0xBA, 0x88, 0xDA, 0x03, 0x69, 0xA9, 0x74, 0x48,
+    0x70, 0x00, 0x00, 0x9D, 0xD9, 0x00, 0x00, 0x01, 0x2D, 0xCC, 0xD2, 0x10,
+    0x00, 0x26, 0xC8, 0x8D, 0x62, 0x00, 0x04, 0xC8, 0x33, 0x8C, 0x40, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0A, 0x74, 0x00, 0x00, 0x06, 0x97, 0xFB, 0x60,
+    0x00, 0x00, 0x9D, 0xAF, 0xB6, 0x00, 0x00, 0x09, 0xDA, 0xFB, 0x60, 0x00,
+    0x00, 0x9D, 0xAF, 0xB6, 0x00, 0x00, 0x09, 0xDA, 0xFB, 0x60, 0x00, 0x00,
+    0x9D, 0xAF, 0xB6, 0x00, 0x00, 0x09, 0xDA, 0xFB, 0x60, 0x00, 0x00, 0x9D,
+    0xAF, 0xB6, 0x00, 0x00, 0x0A, 0xDA, 0xEC, 0x70, 0x00, 0x01, 0xCE, 0xAD,
+    0xC8, 0x00, 0x01, 0x2E, 0xFA, 0x7C, 0xDA, 0x67, 0x9D, 0xDE, 0xA3, 0x8B,
+    0xCC, 0xBA, 0x88, 0xDA, 0x03, 0x69, 0xA9, 0x74, 0x48, 0x70, 0x00, 0x4C,
+    0x62, 0x26, 0xC4, 0x00, 0x04, 0xC6, 0x22, 0x6C, 0x40, 0x00, 0x38, 0x41,
+    0x14, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00,
+    0x9D, 0xAF, 0xB6, 0x00, 0x00, 0x09, 0xDA, 0xFB, 0x60, 0x00, 0x00, 0x9D,
+    0xAF, 0xB6, 0x00, 0x00, 0x09, 0xDA, 0xFB, 0x60, 0x00, 0x00, 0x9D, 0xAF,
+    0xB6, 0x00, 0x00, 0x09, 0xDA, 0xFB, 0x60, 0x00, 0x00, 0x9D, 0xAF, 0xB6,
+    0x00, 0x00, 0x09, 0xDA, 0xFB, 0x60, 0x00, 0x00, 0xBE, 0xAD, 0xC8, 0x00,
+    0x00, 0x1D, 0xEA, 0xBC, 0xA3, 0x22, 0x36, 0xEF, 0xA7, 0xCD, 0xA6, 0x79,
+    0xDD, 0xEA, 0x05, 0x9D, 0xFD, 0xB6, 0x6C, 0xA0, 0x23, 0x45, 0x44, 0x22,
+    0x43, 0x00, 0x00, 0x01, 0x6F, 0xC4, 0x00, 0x00, 0x00, 0x04, 0x8F, 0x62,
+    0x00, 0x00, 0x00, 0x06, 0xAC, 0x21, 0x00, 0x00, 0x00, 0x09, 0xB7, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x60, 0x00, 0x00, 0x06,
+    0x88, 0xAC, 0x91, 0x00, 0x00, 0x19, 0xCA, 0x7C, 0xB3, 0x00, 0x00, 0x3B,
+    0xC7, 0x1A, 0xD8, 0x00, 0x00, 0x8C, 0xA1, 0x08, 0xCC, 0x00, 0x00, 0xBC,
+    0x80, 0x06, 0xAE, 0x10, 0x01, 0xEA, 0x60, 0x03, 0x8F, 0x41, 0x13, 0xF8,
+    0x30, 0x00, 0x5E, 0xA3, 0x38, 0xE5, 0x00, 0x00, 0x3A, 0xD4, 0x4C, 0xA3,
+    0x00, 0x00, 0x26, 0xE7, 0x6E, 0x72, 0x00, 0x00, 0x12, 0xFA, 0xAF, 0x31,
+    0x00, 0x00, 0x00, 0xCD, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xD8, 0x00,
+    0x00, 0x00, 0x00, 0x6C, 0xC5, 0x00, 0x00, 0x00, 0x00, 0x6C, 0xA1, 0x00,
+    0x00, 0x00, 0x00, 0xDB, 0x60, 0x00, 0x00, 0x44, 0x58, 0xE8, 0x30, 0x00,
+    0x00, 0x88, 0xAB, 0xB5, 0x10, 0x00, 0x00, 0xEE, 0xEC, 0x41, 0x00, 0x00,
+    0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00,
+    0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00,
+    0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x73, 0x89, 0xA9, 0x73,
+    0x10, 0xFC, 0x98, 0xBB, 0xCC, 0xB8, 0x40, 0xFE, 0xDE, 0x76, 0x68, 0xEE,
+    0x91, 0xFF, 0xA2, 0x00, 0x00, 0x4B, 0xD8, 0xFD, 0x81, 0x00, 0x00, 0x19,
+    0xDB, 0xFC, 0x70, 0x00, 0x00, 0x08, 0xCD, 0xFB, 0x60, 0x00, 0x00, 0x07,
+    0xCF, 0xFB, 0x60, 0x00, 0x00, 0x07, 0xCE, 0xFC, 0x70, 0x00, 0x00, 0x08,
+    0xCD, 0xFD, 0x81, 0x00, 0x00, 0x19, 0xDB, 0xFF, 0xB2, 0x00, 0x00, 0x4B,
+    0xD8, 0xFE, 0xDE, 0x86, 0x68, 0xEE, 0x91, 0xFC, 0x98, 0xBB, 0xCC, 0xB8,
+    0x40, 0xFB, 0x74, 0x89, 0xA9, 0x73, 0x10, 0xFB, 0x60, 0x00, 0x00, 0x00,
+    0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00,
+    0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x4C, 0x62, 0x26, 0xC4, 0x00, 0x00, 0x4C, 0x62, 0x26, 0xC4,
+    0x00, 0x00, 0x38, 0x41, 0x14, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xCC, 0x80, 0x00, 0x00, 0x08, 0xCC, 0x8C, 0xA2, 0x00, 0x00, 0x2A,
+    0xC8, 0x5C, 0xC5, 0x00, 0x00, 0x4B, 0xC5, 0x1A, 0xD8, 0x00, 0x00, 0x8C,
+    0xA1, 0x07, 0xBE, 0x00, 0x00, 0xDB, 0x70, 0x04, 0x9F, 0x31, 0x12, 0xE9,
+    0x40, 0x02, 0x7F, 0x62, 0x25, 0xF7, 0x20, 0x00, 0x5E, 0xA3, 0x38, 0xE5,
+    0x00, 0x00, 0x38, 0xE5, 0x5D, 0x83, 0x00, 0x00, 0x14, 0xF8, 0x8E, 0x52,
+    0x00, 0x00, 0x12, 0xEB, 0xBE, 0x21, 0x00, 0x00, 0x00, 0xCD, 0xDC, 0x00,
+    0x00, 0x00, 0x00, 0x6C, 0xC7, 0x00, 0x00, 0x00, 0x00, 0x6C, 0xB3, 0x00,
+    0x00, 0x00, 0x00, 0x9C, 0x91, 0x00, 0x00, 0x00, 0x00, 0xDB, 0x60, 0x00,
+    0x00, 0x66, 0x7B, 0xE6, 0x10, 0x00, 0x00, 0xBB, 0xCC, 0x73, 0x00, 0x00,
+    0x00, 0x99, 0x98, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55,
+    0x30, 0x00, 0x00, 0x00, 0x0C, 0xCC, 0xCC, 0xC8, 0x00, 0x00, 0x00, 0x00,
+    0xAA, 0xAA, 0xAA, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0xAF, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C,
+    0xFC, 0x40, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xDC, 0xE6, 0x10, 0x00, 0x00,
+    0x00, 0x04, 0xBD, 0x8F, 0x83, 0x00, 0x00, 0x00, 0x00, 0x9D, 0xA1, 0xFB,
+    0x60, 0x00, 0x00, 0x00, 0x0C, 0xC8, 0x0C, 0xC8, 0x00, 0x00, 0x00, 0x12,
+    0xEB, 0x60, 0x9D, 0xA2, 0x00, 0x00, 0x02, 0x5F, 0x94, 0x06, 0xCC, 0x50,
+    0x00, 0x00, 0x3A, 0xF6, 0x10, 0x1A, 0xDA, 0x00, 0x00, 0x05, 0xDD, 0x50,
+    0x00, 0x9D, 0xD1, 0x00, 0x02, 0x7F, 0xD8, 0x55, 0x5A, 0xDF, 0x31, 0x00,
+    0x49, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0x20, 0x07, 0xCF, 0x77, 0x77, 0x77,
+    0x9F, 0xB4, 0x01, 0x9D, 0xC2, 0x22, 0x22, 0x25, 0xCE, 0x51, 0x3B, 0xD8,
+    0x00, 0x00, 0x00, 0x38, 0xF7, 0x27, 0xCB, 0x40, 0x00, 0x00, 0x01, 0x4F,
+    0xA5, 0xCD, 0x90, 0x00, 0x00, 0x00, 0x00, 0xDD, 0x84, 0x43, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x43, 0x00, 0x25, 0x55, 0x55, 0x52, 0x00, 0x04, 0xCC,
+    0xCC, 0xCC, 0x40, 0x00, 0x3A, 0xAA, 0xAA, 0xA3, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x15, 0x8C, 0xEE, 0xED, 0x83, 0x01, 0x8B, 0xA9, 0x99, 0xBD,
+    0x84, 0x16, 0x86, 0x44, 0x57, 0xEB, 0x70, 0x00, 0x00, 0x00, 0x0C, 0xD9,
+    0x00, 0x00, 0x00, 0x00, 0x9D, 0xA0, 0x24, 0x78, 0x99, 0xAD, 0xEA, 0x26,
+    0x9A, 0xAA, 0xAA, 0xDE, 0xA7, 0xCE, 0xB5, 0x43, 0x2A, 0xDA, 0xED, 0x80,
+    0x00, 0x00, 0xAD, 0xAE, 0xC8, 0x00, 0x00, 0x1D, 0xEA, 0xDC, 0x92, 0x12,
+    0x35, 0xDE, 0xAA, 0xDC, 0x74, 0x69, 0xDC, 0xEA, 0x17, 0xBE, 0xFD, 0xA6,
+    0x4B, 0xA0, 0x24, 0x55, 0x43, 0x21, 0x43, 0x00, 0x00, 0xE5, 0x00, 0x19,
+    0x90, 0x00, 0x00, 0x00, 0x0B, 0x85, 0x37, 0xA7, 0x00, 0x00, 0x00, 0x00,
+    0x79, 0x98, 0xB8, 0x40, 0x00, 0x00, 0x00, 0x02, 0x8C, 0xEB, 0x41, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47,
+    0xA6, 0x20, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0xA3, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x9E, 0xED, 0x50, 0x00, 0x00, 0x00, 0x00, 0x4B, 0xD8, 0xF8,
+    0x30, 0x00, 0x00, 0x00, 0x07, 0xCB, 0x4F, 0xA5, 0x00, 0x00, 0x00, 0x00,
+    0xBC, 0x91, 0xDC, 0x70, 0x00, 0x00, 0x00, 0x0E, 0xC7, 0x0B, 0xDA, 0x00,
+    0x00, 0x00, 0x25, 0xF9, 0x40, 0x6C, 0xC5, 0x00, 0x00, 0x03, 0x8F, 0x72,
+    0x03, 0xBD, 0x90, 0x00, 0x00, 0x4C, 0xE5, 0x10, 0x19, 0xDC, 0x00, 0x00,
+    0x15, 0xFC, 0x40, 0x00, 0x8D, 0xF1, 0x00, 0x04, 0x9F, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x62, 0x00, 0x6B, 0xF9, 0x99, 0x99, 0x9B, 0xFA, 0x30, 0x18, 0xDD,
+    0x44, 0x44, 0x44, 0x7D, 0xD5, 0x02, 0xAD, 0xA0, 0x00, 0x00, 0x03, 0xAF,
+    0x61, 0x7C, 0xB4, 0x00, 0x00, 0x00, 0x14, 0xFA, 0x5B, 0xD9, 0x10, 0x00,
+    0x00, 0x00, 0x1E, 0xC7, 0x88, 0x60, 0x00, 0x00, 0x00, 0x00, 0x98, 0x50,
+    0x00, 0x5E, 0x10, 0x01, 0xE5, 0x00, 0x04, 0xB6, 0x45, 0x7B, 0x40, 0x00,
+    0x27, 0xA9, 0x9B, 0x72, 0x00, 0x01, 0x2C, 0xDD, 0xB1, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x36, 0x89, 0xA9, 0x95, 0x20, 0x16, 0xAB, 0xBC,
+    0xCC, 0xA6, 0x21, 0x9C, 0x96, 0x67, 0xAF, 0xB6, 0x00, 0x00, 0x00, 0x00,
+    0xCD, 0x90, 0x00, 0x00, 0x00, 0x0A, 0xDA, 0x01, 0x23, 0x44, 0x55, 0xBE,
+    0xA0, 0x36, 0xAD, 0xDE, 0xFF, 0xFA, 0x7C, 0xEB, 0x54, 0x32, 0xAD, 0xAB,
+    0xDA, 0x42, 0x11, 0x1A, 0xDA, 0xED, 0x80, 0x00, 0x00, 0xCE, 0xAE, 0xC7,
+    0x00, 0x00, 0x1E, 0xFA, 0xAD, 0xC7, 0x46, 0x9D, 0xCE, 0xA4, 0x9B, 0xBB,
+    0xBA, 0x87, 0xCA, 0x14, 0x79, 0xA9, 0x74, 0x38, 0x70, 0x00, 0x00, 0x05,
+    0xAF, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xCF, 0xC4, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1A, 0xDC, 0xE6, 0x10, 0x00, 0x00, 0x00, 0x00, 0x4B,
+    0xD8, 0xF8, 0x30, 0x00, 0x00, 0x00, 0x00, 0x9D, 0xA1, 0xFB, 0x60, 0x00,
+    0x00, 0x00, 0x00, 0xCC, 0x80, 0xCC, 0x80, 0x00, 0x00, 0x00, 0x12, 0xEB,
+    0x60, 0x9D, 0xA2, 0x00, 0x00, 0x00, 0x25, 0xF9, 0x40, 0x6C, 0xC5, 0x00,
+    0x00, 0x00, 0x3A, 0xF6, 0x10, 0x1A, 0xDA, 0x00, 0x00, 0x00, 0x5D, 0xD5,
+    0x00, 0x09, 0xDD, 0x10, 0x00, 0x02, 0x7F, 0xD8, 0x55, 0x5A, 0xDF, 0x31,
+    0x00, 0x04, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0x62, 0x00, 0x07, 0xCF, 0x77,
+    0x77, 0x77, 0x9F, 0xB4, 0x00, 0x19, 0xDC, 0x22, 0x22, 0x22, 0x5C, 0xE5,
+    0x10, 0x3B, 0xD8, 0x00, 0x00, 0x00, 0x38, 0xF7, 0x20, 0x7C, 0xB4, 0x00,
+    0x00, 0x00, 0x14, 0xFA, 0x50, 0xCD, 0x90, 0x00, 0x00, 0x00, 0x00, 0xDD,
+    0x80, 0x44, 0x30, 0x00, 0x00, 0x00, 0x12, 0xDA, 0x60, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x26, 0xB6, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4C, 0x72,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4B, 0x83, 0x22, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x25, 0xBA, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x89,
+    0x99, 0x15, 0x8C, 0xEE, 0xED, 0x83, 0x00, 0x18, 0xBA, 0x99, 0x9B, 0xD8,
+    0x40, 0x16, 0x86, 0x44, 0x57, 0xEB, 0x70, 0x00, 0x00, 0x00, 0x00, 0xCD,
+    0x90, 0x00, 0x00, 0x00, 0x00, 0x9D, 0xA0, 0x02, 0x47, 0x89, 0x9A, 0xDE,
+    0xA0, 0x26, 0x9A, 0xAA, 0xAA, 0xDE, 0xA0, 0x7C, 0xEB, 0x54, 0x32, 0xAD,
+    0xA0, 0xED, 0x80, 0x00, 0x00, 0xAD, 0xA0, 0xEC, 0x80, 0x00, 0x01, 0xDE,
+    0xA0, 0xDC, 0x92, 0x12, 0x35, 0xDE, 0xA0, 0xAD, 0xC7, 0x46, 0x9D, 0xCE,
+    0xA0, 0x17, 0xBE, 0xFD, 0xA6, 0x4B, 0xA0, 0x02, 0x45, 0x54, 0x43, 0xA9,
+    0x60, 0x00, 0x00, 0x00, 0x26, 0xB6, 0x30, 0x00, 0x00, 0x00, 0x4C, 0x72,
+    0x00, 0x00, 0x00, 0x00, 0x4B, 0x83, 0x22, 0x00, 0x00, 0x00, 0x25, 0xBA,
+    0xA9, 0x00, 0x00, 0x00, 0x01, 0x89, 0x99, 0x00, 0x00, 0x00, 0x12, 0xFD,
+    0x80, 0x00, 0x00, 0x00, 0x25, 0xF9, 0x40, 0x00, 0x00, 0x00, 0x39, 0xC6,
+    0x20, 0x00, 0x00, 0x00, 0x4D, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x68, 0x9A, 0x98, 0x74, 0x01, 0x36, 0xBC, 0xCC, 0xCC,
+    0xA7, 0x02, 0x7E, 0xFB, 0x97, 0x8B, 0xBA, 0x1A, 0xEE, 0x31, 0x00, 0x00,
+    0x00, 0x5B, 0xD9, 0x10, 0x00, 0x00, 0x00, 0x9D, 0xB4, 0x00, 0x00, 0x00,
+    0x00, 0xCE, 0xA0, 0x00, 0x00, 0x00, 0x00, 0xED, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0xFD, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0xED, 0x80, 0x00, 0x00, 0x00, 0x00, 0xCE, 0xA0, 0x00, 0x00, 0x00,
+    0x00, 0x9D, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x6C, 0xD8, 0x10, 0x00, 0x00,
+    0x00, 0x2A, 0xEE, 0x31, 0x00, 0x00, 0x00, 0x03, 0x8F, 0xFC, 0x97, 0x78,
+    0xAD, 0x01, 0x37, 0xBC, 0xCC, 0xCC, 0xBA, 0x00, 0x12, 0x68, 0x9A, 0x99,
+    0x86, 0x00, 0x00, 0x01, 0x6F, 0xC4, 0x00, 0x00, 0x04, 0x8F, 0x62, 0x00,
+    0x00, 0x06, 0xAC, 0x21, 0x00, 0x00, 0x09, 0xB7, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x36, 0x9A, 0x99, 0x62, 0x04, 0x7B, 0xCC, 0xCB, 0x93,
+    0x19, 0xEE, 0x86, 0x68, 0x83, 0x8D, 0xB4, 0x00, 0x00, 0x00, 0xBD, 0x91,
+    0x00, 0x00, 0x00, 0xDD, 0x80, 0x00, 0x00, 0x00, 0xFC, 0x70, 0x00, 0x00,
+    0x00, 0xFC, 0x70, 0x00, 0x00, 0x00, 0xDC, 0x80, 0x00, 0x00, 0x00, 0xBD,
+    0x91, 0x00, 0x00, 0x00, 0x9D, 0xB4, 0x00, 0x00, 0x00, 0x1A, 0xEE, 0x86,
+    0x67, 0xB4, 0x04, 0x8B, 0xCC, 0xBB, 0xA3, 0x01, 0x36, 0x9A, 0x99, 0x62,
+    0x00, 0x00, 0x06, 0xBF, 0x93, 0x00, 0x00, 0x00, 0x29, 0xCB, 0xD6, 0x10,
+    0x00, 0x00, 0x6A, 0xA6, 0xD8, 0x40, 0x00, 0x00, 0xC9, 0x50, 0x8B, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x68, 0x9A, 0x98, 0x74,
+    0x01, 0x36, 0xBC, 0xCC, 0xCC, 0xA7, 0x02, 0x7E, 0xFB, 0x97, 0x8B, 0xBA,
+    0x1A, 0xEE, 0x31, 0x00, 0x00, 0x00, 0x5B, 0xD9, 0x10, 0x00, 0x00, 0x00,
+    0x9D, 0xB4, 0x00, 0x00, 0x00, 0x00, 0xCE, 0xA0, 0x00, 0x00, 0x00, 0x00,
+    0xED, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0xFD, 0x80, 0x00, 0x00, 0x00, 0x00, 0xED, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0xCE, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x9D, 0xB4, 0x00, 0x00, 0x00, 0x00,
+    0x6C, 0xD8, 0x10, 0x00, 0x00, 0x00, 0x2A, 0xEE, 0x31, 0x00, 0x00, 0x00,
+    0x03, 0x8F, 0xFC, 0x97, 0x78, 0xAD, 0x01, 0x37, 0xBC, 0xCC, 0xCC, 0xBA,
+    0x00, 0x12, 0x68, 0x9A, 0x99, 0x86, 0x00, 0x00, 0x9D, 0xD9, 0x00, 0x00,
+    0x12, 0xDC, 0xCD, 0x21, 0x00, 0x26, 0xC8, 0x8D, 0x62, 0x00, 0x4C, 0x83,
+    0x38, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x36, 0x9A, 0x99, 0x62,
+    0x04, 0x7B, 0xCC, 0xCB, 0x93, 0x19, 0xEE, 0x86, 0x68, 0x83, 0x8D, 0xB4,
+    0x00, 0x00, 0x00, 0xBD, 0x91, 0x00, 0x00, 0x00, 0xDD, 0x80, 0x00, 0x00,
+    0x00, 0xFC, 0x70, 0x00, 0x00, 0x00, 0xFC, 0x70, 0x00, 0x00, 0x00, 0xDC,
+    0x80, 0x00, 0x00, 0x00, 0xBD, 0x91, 0x00, 0x00, 0x00, 0x9D, 0xB4, 0x00,
+    0x00, 0x00, 0x1A, 0xEE, 0x86, 0x67, 0xB4, 0x04, 0x8B, 0xCC, 0xBB, 0xA3,
+    0x01, 0x36, 0x9A, 0x99, 0x62, 0x00, 0x00, 0x00, 0x4C, 0x52, 0x00, 0x00,
+    0x00, 0x00, 0x4C, 0x52, 0x00, 0x00, 0x00, 0x00, 0x38, 0x41, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x9C, 0xEF, 0xEC, 0xA6, 0x02,
+    0x5A, 0xDB, 0xAA, 0xAB, 0xB8, 0x05, 0x9E, 0xB8, 0x65, 0x57, 0x77, 0x1A,
+    0xEE, 0x31, 0x00, 0x00, 0x00, 0x7C, 0xC6, 0x00, 0x00, 0x00, 0x00, 0xAD,
+    0xB2, 0x00, 0x00, 0x00, 0x00, 0xCD, 0x90, 0x00, 0x00, 0x00, 0x00, 0xED,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x70, 0x00, 0x00, 0x00, 0x00, 0xED,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0xDD, 0x90, 0x00, 0x00, 0x00, 0x00, 0xCE,
+    0xA0, 0x00, 0x00, 0x00, 0x00, 0x8D, 0xC5, 0x00, 0x00, 0x00, 0x00, 0x4B,
+    0xDB, 0x21, 0x00, 0x00, 0x00, 0x18, 0xCE, 0x74, 0x32, 0x23, 0x34, 0x03,
+    0x8F, 0xFC, 0x97, 0x78, 0xAD, 0x00, 0x12, 0x9C, 0xEF, 0xED, 0xC9, 0x00,
+    0x01, 0x34, 0x55, 0x54, 0x43, 0x00, 0x00, 0x08, 0xA5, 0x00, 0x00, 0x00,
+    0x08, 0xA5, 0x00, 0x00, 0x00, 0x06, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x4A, 0xEE, 0xED, 0x93, 0x17, 0xBD, 0xA9, 0x9A, 0x93, 0x4B,
+    0xDB, 0x54, 0x45, 0x62, 0x8D, 0xB4, 0x00, 0x00, 0x00, 0xDD, 0x90, 0x00,
+    0x00, 0x00, 0xEC, 0x80, 0x00, 0x00, 0x00, 0xFC, 0x70, 0x00, 0x00, 0x00,
+    0xFC, 0x70, 0x00, 0x00, 0x00, 0xDD, 0x80, 0x00, 0x00, 0x00, 0xAD, 0xA3,
+    0x00, 0x00, 0x00, 0x6C, 0xC7, 0x32, 0x22, 0x41, 0x1A, 0xEE, 0x86, 0x67,
+    0xB4, 0x01, 0x4A, 0xEE, 0xED, 0xA3, 0x00, 0x13, 0x55, 0x54, 0x31, 0x00,
+    0x00, 0xC9, 0x50, 0x8B, 0x80, 0x00, 0x00, 0x6A, 0xA6, 0xD8, 0x40, 0x00,
+    0x00, 0x29, 0xCB, 0xD6, 0x10, 0x00, 0x00, 0x06, 0xBF, 0x93, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x68, 0x9A, 0x98, 0x74, 0x01,
+    0x36, 0xBC, 0xCC, 0xCC, 0xA7, 0x02, 0x7E, 0xFB, 0x97, 0x8B, 0xBA, 0x1A,
+    0xEE, 0x31, 0x00, 0x00, 0x00, 0x5B, 0xD9, 0x10, 0x00, 0x00, 0x00, 0x9D,
+    0xB4, 0x00, 0x00, 0x00, 0x00, 0xCE, 0xA0, 0x00, 0x00, 0x00, 0x00, 0xED,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFD,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0xED, 0x80, 0x00, 0x00, 0x00, 0x00, 0xCE,
+    0xA0, 0x00, 0x00, 0x00, 0x00, 0x9D, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x6C,
+    0xD8, 0x10, 0x00, 0x00, 0x00, 0x2A, 0xEE, 0x31, 0x00, 0x00, 0x00, 0x03,
+    0x8F, 0xFC, 0x97, 0x78, 0xAD, 0x01, 0x37, 0xBC, 0xCC, 0xCC, 0xBA, 0x00,
+    0x12, 0x68, 0x9A, 0x99, 0x86, 0x00, 0x4C, 0x83, 0x38, 0xC4, 0x00, 0x26,
+    0xC8, 0x8D, 0x62, 0x00, 0x12, 0xDC, 0xCD, 0x21, 0x00, 0x00, 0x9D, 0xD9,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x36, 0x9A, 0x99, 0x62, 0x04,
+    0x7B, 0xCC, 0xCB, 0x93, 0x19, 0xEE, 0x86, 0x68, 0x83, 0x8D, 0xB4, 0x00,
+    0x00, 0x00, 0xBD, 0x91, 0x00, 0x00, 0x00, 0xDD, 0x80, 0x00, 0x00, 0x00,
+    0xFC, 0x70, 0x00, 0x00, 0x00, 0xFC, 0x70, 0x00, 0x00, 0x00, 0xDC, 0x80,
+    0x00, 0x00, 0x00, 0xBD, 0x91, 0x00, 0x00, 0x00, 0x9D, 0xB4, 0x00, 0x00,
+    0x00, 0x1A, 0xEE, 0x86, 0x67, 0xB4, 0x04, 0x8B, 0xCC, 0xBB, 0xA3, 0x01,
+    0x36, 0x9A, 0x99, 0x62, 0x00, 0x4C, 0x83, 0x38, 0xC4, 0x00, 0x00, 0x26,
+    0xC8, 0x8D, 0x62, 0x00, 0x00, 0x12, 0xDC, 0xCD, 0x21, 0x00, 0x00, 0x00,
+    0x9D, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA,
+    0xA9, 0x86, 0x10, 0x00, 0xFE, 0xDC, 0xCC, 0xBB, 0x63, 0x10, 0xFD, 0xA6,
+    0x79, 0xBF, 0xE7, 0x20, 0xFB, 0x60, 0x00, 0x12, 0xDE, 0xA1, 0xFB, 0x60,
+    0x00, 0x01, 0x8C, 0xC5, 0xFB, 0x60, 0x00, 0x00, 0x3B, 0xD9, 0xFB, 0x60,
+    0x00, 0x00, 0x0A, 0xDC, 0xFB, 0x60, 0x00, 0x00, 0x08, 0xDE, 0xFB, 0x60,
+    0x00, 0x00, 0x08, 0xDF, 0xFB, 0x60, 0x00, 0x00, 0x08, 0xDE, 0xFB, 0x60,
+    0x00, 0x00, 0x08, 0xDE, 0xFB, 0x60, 0x00, 0x00, 0x0A, 0xEB, 0xFB, 0x60,
+    0x00, 0x00, 0x4B, 0xD8, 0xFB, 0x60, 0x00, 0x01, 0x9D, 0xB5, 0xFB, 0x60,
+    0x00, 0x13, 0xEE, 0x91, 0xFD, 0xA6, 0x79, 0xCF, 0xE7, 0x20, 0xFE, 0xDC,
+    0xCC, 0xBA, 0x52, 0x10, 0xAA, 0xAA, 0x98, 0x75, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x9D, 0xA0, 0x8C, 0x90, 0x00, 0x00, 0x00, 0x09, 0xDA, 0x0A,
+    0xA6, 0x00, 0x00, 0x00, 0x00, 0x9D, 0xA0, 0xC8, 0x40, 0x00, 0x00, 0x00,
+    0x09, 0xDA, 0x0D, 0x51, 0x00, 0x00, 0x00, 0x00, 0x9D, 0xA0, 0x00, 0x00,
+    0x24, 0x8A, 0x97, 0x49, 0xDA, 0x00, 0x00, 0x15, 0x9C, 0xCB, 0xA9, 0xAD,
+    0xA0, 0x00, 0x02, 0xAE, 0xD7, 0x79, 0xDD, 0xEA, 0x00, 0x00, 0x9D, 0xB2,
+    0x00, 0x01, 0xEF, 0xA0, 0x00, 0x0C, 0xD9, 0x10, 0x00, 0x0C, 0xEA, 0x00,
+    0x00, 0xEC, 0x80, 0x00, 0x00, 0xAD, 0xA0, 0x00, 0x0F, 0xC7, 0x00, 0x00,
+    0x09, 0xDA, 0x00, 0x00, 0xFC, 0x70, 0x00, 0x00, 0x9D, 0xA0, 0x00, 0x0E,
+    0xC8, 0x00, 0x00, 0x0A, 0xDA, 0x00, 0x00, 0xCD, 0x91, 0x00, 0x00, 0xCE,
+    0xA0, 0x00, 0x09, 0xDB, 0x20, 0x00, 0x1E, 0xFA, 0x00, 0x00, 0x2A, 0xED,
+    0x66, 0x8C, 0xDE, 0xA0, 0x00, 0x01, 0x59, 0xCC, 0xBA, 0x98, 0xDA, 0x00,
+    0x00, 0x02, 0x48, 0xA9, 0x74, 0x48, 0x70, 0x00, 0x00, 0x0A, 0xFF, 0xFF,
+    0xED, 0x84, 0x10, 0x00, 0x0A, 0xED, 0x99, 0xAB, 0xDB, 0x72, 0x00, 0x0A,
+    0xEB, 0x44, 0x56, 0xAD, 0xC7, 0x00, 0x0A, 0xDA, 0x00, 0x00, 0x2A, 0xEE,
+    0x10, 0x0A, 0xDA, 0x00, 0x00, 0x03, 0x8F, 0x83, 0x0A, 0xDA, 0x00, 0x00,
+    0x01, 0x6F, 0xA3, 0x5C, 0xEB, 0x55, 0x55, 0x00, 0x5E, 0xD4, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x10, 0x4C, 0xE5, 0x7C, 0xEC, 0x77, 0x77, 0x00, 0x4B, 0xF5,
+    0x2B, 0xDA, 0x22, 0x22, 0x00, 0x4C, 0xE5, 0x0A, 0xDA, 0x00, 0x00, 0x00,
+    0x4D, 0xD4, 0x0A, 0xDA, 0x00, 0x00, 0x00, 0x5F, 0xB4, 0x0A, 0xDA, 0x00,
+    0x00, 0x04, 0x9F, 0x72, 0x0A, 0xDA, 0x00, 0x00, 0x28, 0xCE, 0x31, 0x0A,
+    0xDA, 0x22, 0x34, 0x7C, 0xDA, 0x10, 0x0A, 0xEC, 0x67, 0x8B, 0xFE, 0xA3,
+    0x00, 0x0A, 0xFF, 0xFE, 0xDC, 0x83, 0x10, 0x00, 0x03, 0x55, 0x55, 0x44,
+    0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9D, 0xA0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x9D, 0xA0, 0x00, 0x00, 0x00, 0x45, 0x55, 0xBE, 0xC5, 0x21,
+    0x00, 0x00, 0xCE, 0xFF, 0xFF, 0xFF, 0x62, 0x00, 0x00, 0x22, 0x22, 0xAD,
+    0xB2, 0x10, 0x01, 0x48, 0xAA, 0x85, 0x9D, 0xA1, 0x00, 0x15, 0x9C, 0xCB,
+    0xA9, 0xAD, 0xA0, 0x00, 0x2A, 0xED, 0x77, 0x9D, 0xDE, 0xA0, 0x00, 0x9D,
+    0xB2, 0x00, 0x01, 0xEF, 0xA0, 0x00, 0xCD, 0x91, 0x00, 0x00, 0xCE, 0xA0,
+    0x00, 0xEC, 0x80, 0x00, 0x00, 0xAD, 0xA0, 0x00, 0xFC, 0x70, 0x00, 0x00,
+    0x9D, 0xA0, 0x00, 0xFC, 0x70, 0x00, 0x00, 0x9D, 0xA0, 0x00, 0xEC, 0x80,
+    0x00, 0x00, 0xAD, 0xA0, 0x00, 0xCD, 0x91, 0x00, 0x00, 0xCE, 0xA0, 0x00,
+    0x9D, 0xB2, 0x00, 0x01, 0xEF, 0xA0, 0x00, 0x2A, 0xED, 0x66, 0x8C, 0xEF,
+    0xA0, 0x00, 0x15, 0x9C, 0xCB, 0xA9, 0x9D, 0xA0, 0x00, 0x02, 0x48, 0xA9,
+    0x85, 0x48, 0x70, 0x00, 0x00, 0x25, 0x55, 0x55, 0x52, 0x00, 0x04, 0xCC,
+    0xCC, 0xCC, 0x40, 0x00, 0x3A, 0xAA, 0xAA, 0xA3, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0xEC, 0x99, 0x99, 0x99,
+    0x96, 0xFC, 0x94, 0x44, 0x44, 0x44, 0x3F, 0xB6, 0x00, 0x00, 0x00, 0x00,
+    0xFB, 0x60, 0x00, 0x00, 0x00, 0x0F, 0xB6, 0x00, 0x00, 0x00, 0x00, 0xFD,
+    0x95, 0x55, 0x55, 0x55, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0xFD, 0xA7,
+    0x77, 0x77, 0x77, 0x4F, 0xC8, 0x22, 0x22, 0x22, 0x21, 0xFB, 0x60, 0x00,
+    0x00, 0x00, 0x0F, 0xB6, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00,
+    0x00, 0x0F, 0xB6, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x82, 0x22, 0x22, 0x22,
+    0x1F, 0xDA, 0x77, 0x77, 0x77, 0x74, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA5,
+    0x55, 0x55, 0x55, 0x55, 0x53, 0x00, 0x25, 0x55, 0x55, 0x52, 0x00, 0x00,
+    0x4C, 0xCC, 0xCC, 0xC4, 0x00, 0x00, 0x3A, 0xAA, 0xAA, 0xA3, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xDE, 0xEE, 0xA5, 0x10, 0x05,
+    0x9C, 0xA9, 0x99, 0xCB, 0x71, 0x39, 0xCB, 0x54, 0x45, 0x9C, 0xB5, 0x7C,
+    0xB3, 0x00, 0x00, 0x1A, 0xDA, 0xCC, 0x80, 0x00, 0x00, 0x07, 0xCE, 0xEE,
+    0xDA, 0xAA, 0xAA, 0xAC, 0xEF, 0xEE, 0xDC, 0xCC, 0xCC, 0xCC, 0xCC, 0xFD,
+    0xA5, 0x55, 0x55, 0x55, 0x55, 0xCD, 0x90, 0x00, 0x00, 0x00, 0x00, 0x9C,
+    0xB3, 0x00, 0x00, 0x00, 0x00, 0x5B, 0xC8, 0x32, 0x22, 0x23, 0x32, 0x07,
+    0xCF, 0x97, 0x66, 0x7A, 0xA7, 0x00, 0x27, 0xCE, 0xEE, 0xDB, 0x73, 0x00,
+    0x12, 0x45, 0x55, 0x44, 0x21, 0x00, 0x5E, 0x10, 0x01, 0xE5, 0x00, 0x04,
+    0xB6, 0x45, 0x7B, 0x40, 0x00, 0x27, 0xA9, 0x9B, 0x72, 0x00, 0x01, 0x2C,
+    0xDD, 0xB1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xA7, 0xFE, 0xDC, 0xCC, 0xCC, 0xCC, 0x8F, 0xDA, 0x77, 0x77, 0x77,
+    0x74, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x0F, 0xB6, 0x00, 0x00, 0x00, 0x00,
+    0xFB, 0x60, 0x00, 0x00, 0x00, 0x0F, 0xB6, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0xEC, 0x99, 0x99, 0x99, 0x96, 0xFC, 0x94,
+    0x44, 0x44, 0x44, 0x3F, 0xB6, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00,
+    0x00, 0x00, 0x0F, 0xB6, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00,
+    0x00, 0x0F, 0xB6, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xA7, 0x77, 0x77, 0x77,
+    0x4F, 0xED, 0xCC, 0xCC, 0xCC, 0xC8, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x70,
+    0x00, 0x5E, 0x10, 0x01, 0xE5, 0x00, 0x00, 0x4B, 0x64, 0x57, 0xB4, 0x00,
+    0x00, 0x27, 0xA9, 0x9B, 0x72, 0x00, 0x00, 0x12, 0xCD, 0xDB, 0x10, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x99, 0xA9, 0x63, 0x10,
+    0x03, 0x6A, 0xBB, 0xCB, 0xB8, 0x41, 0x08, 0xCE, 0x86, 0x67, 0xDE, 0xA2,
+    0x7C, 0xB3, 0x00, 0x00, 0x1A, 0xDA, 0xAC, 0x91, 0x00, 0x00, 0x08, 0xCC,
+    0xDD, 0xA5, 0x55, 0x55, 0x5A, 0xDE, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFD, 0xA5, 0x55, 0x55, 0x55, 0x55, 0xDD, 0x92, 0x22, 0x22, 0x22, 0x22,
+    0xBD, 0xA2, 0x00, 0x00, 0x00, 0x00, 0x7C, 0xC5, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0xCF, 0x97, 0x66, 0x7A, 0xA7, 0x03, 0x69, 0xBB, 0xCC, 0xBA, 0x84,
+    0x00, 0x24, 0x89, 0xAA, 0x97, 0x52, 0x00, 0x00, 0x08, 0xA5, 0x00, 0x00,
+    0x00, 0x00, 0x8A, 0x50, 0x00, 0x00, 0x00, 0x06, 0x74, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0xEC, 0x99,
+    0x99, 0x99, 0x96, 0xFC, 0x94, 0x44, 0x44, 0x44, 0x3F, 0xB6, 0x00, 0x00,
+    0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x0F, 0xB6, 0x00, 0x00, 0x00,
+    0x00, 0xFD, 0x95, 0x55, 0x55, 0x55, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA,
+    0xFD, 0xA7, 0x77, 0x77, 0x77, 0x4F, 0xC8, 0x22, 0x22, 0x22, 0x21, 0xFB,
+    0x60, 0x00, 0x00, 0x00, 0x0F, 0xB6, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60,
+    0x00, 0x00, 0x00, 0x0F, 0xB6, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x82, 0x22,
+    0x22, 0x22, 0x1F, 0xDA, 0x77, 0x77, 0x77, 0x74, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xA5, 0x55, 0x55, 0x55, 0x55, 0x53, 0x00, 0x00, 0x08, 0xA5, 0x00,
+    0x00, 0x00, 0x00, 0x08, 0xA5, 0x00, 0x00, 0x00, 0x00, 0x06, 0x74, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xDE, 0xEE, 0xA5,
+    0x10, 0x05, 0x9C, 0xA9, 0x99, 0xCB, 0x71, 0x39, 0xCB, 0x54, 0x45, 0x9C,
+    0xB5, 0x7C, 0xB3, 0x00, 0x00, 0x1A, 0xDA, 0xCC, 0x80, 0x00, 0x00, 0x07,
+    0xCE, 0xEE, 0xDA, 0xAA, 0xAA, 0xAC, 0xEF, 0xEE, 0xDC, 0xCC, 0xCC, 0xCC,
+    0xCC, 0xFD, 0xA5, 0x55, 0x55, 0x55, 0x55, 0xCD, 0x90, 0x00, 0x00, 0x00,
+    0x00, 0x9C, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x5B, 0xC8, 0x32, 0x22, 0x23,
+    0x32, 0x07, 0xCF, 0x97, 0x66, 0x7A, 0xA7, 0x00, 0x27, 0xCE, 0xEE, 0xDB,
+    0x73, 0x00, 0x12, 0x45, 0x55, 0x44, 0x21, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xAF, 0xEC, 0x99, 0x99, 0x99, 0x96, 0xFC, 0x94, 0x44, 0x44, 0x44, 0x3F,
+    0xB6, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x0F, 0xB6,
+    0x00, 0x00, 0x00, 0x00, 0xFD, 0x95, 0x55, 0x55, 0x55, 0x3F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFA, 0xFD, 0xA7, 0x77, 0x77, 0x77, 0x4F, 0xC8, 0x22, 0x22,
+    0x22, 0x21, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x0F, 0xB6, 0x00, 0x00, 0x00,
+    0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x0F, 0xB6, 0x00, 0x00, 0x00, 0x00,
+    0xFC, 0x82, 0x22, 0x22, 0x22, 0x1F, 0xDA, 0x77, 0x77, 0x77, 0x74, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xA5, 0x55, 0x55, 0x69, 0xD9, 0x63, 0x00, 0x00,
+    0x04, 0x7B, 0x41, 0x00, 0x00, 0x00, 0x8A, 0x70, 0x00, 0x00, 0x00, 0x07,
+    0xA8, 0x12, 0x10, 0x00, 0x00, 0x37, 0xBA, 0xA6, 0x00, 0x00, 0x01, 0x38,
+    0xA9, 0x60, 0x00, 0x38, 0xDE, 0xEE, 0xA5, 0x10, 0x05, 0x9C, 0xA9, 0x99,
+    0xCB, 0x71, 0x39, 0xCB, 0x54, 0x45, 0x9C, 0xB5, 0x7C, 0xB3, 0x00, 0x00,
+    0x1A, 0xDA, 0xCC, 0x80, 0x00, 0x00, 0x07, 0xCE, 0xEE, 0xDA, 0xAA, 0xAA,
+    0xAC, 0xEF, 0xEE, 0xDC, 0xCC, 0xCC, 0xCC, 0xCC, 0xFD, 0xA5, 0x55, 0x55,
+    0x55, 0x55, 0xCD, 0x90, 0x00, 0x00, 0x00, 0x00, 0x9C, 0xB3, 0x00, 0x00,
+    0x00, 0x00, 0x5B, 0xC8, 0x32, 0x22, 0x23, 0x32, 0x07, 0xCF, 0x97, 0x66,
+    0x7A, 0xA7, 0x00, 0x27, 0xCE, 0xEE, 0xDB, 0x73, 0x00, 0x12, 0x45, 0x56,
+    0xD9, 0x51, 0x00, 0x00, 0x00, 0x26, 0xB6, 0x30, 0x00, 0x00, 0x00, 0x4C,
+    0x72, 0x00, 0x00, 0x00, 0x00, 0x4B, 0x83, 0x22, 0x00, 0x00, 0x00, 0x25,
+    0xBA, 0xA9, 0x00, 0x00, 0x00, 0x01, 0x89, 0x99, 0x00, 0x4C, 0x83, 0x38,
+    0xC4, 0x00, 0x02, 0x6C, 0x88, 0xD6, 0x20, 0x00, 0x12, 0xDC, 0xCD, 0x21,
+    0x00, 0x00, 0x09, 0xDD, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xA7, 0xFE, 0xDC, 0xCC, 0xCC, 0xCC, 0x8F, 0xDA,
+    0x77, 0x77, 0x77, 0x74, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x0F, 0xB6, 0x00,
+    0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x0F, 0xB6, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0xEC, 0x99, 0x99, 0x99,
+    0x96, 0xFC, 0x94, 0x44, 0x44, 0x44, 0x3F, 0xB6, 0x00, 0x00, 0x00, 0x00,
+    0xFB, 0x60, 0x00, 0x00, 0x00, 0x0F, 0xB6, 0x00, 0x00, 0x00, 0x00, 0xFB,
+    0x60, 0x00, 0x00, 0x00, 0x0F, 0xB6, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xA7,
+    0x77, 0x77, 0x77, 0x4F, 0xED, 0xCC, 0xCC, 0xCC, 0xC8, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0x70, 0x00, 0x4C, 0x83, 0x38, 0xC4, 0x00, 0x00, 0x26, 0xC8,
+    0x8D, 0x62, 0x00, 0x00, 0x12, 0xDC, 0xCD, 0x21, 0x00, 0x00, 0x00, 0x9D,
+    0xD9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x99,
+    0xA9, 0x63, 0x10, 0x03, 0x6A, 0xBB, 0xCB, 0xB8, 0x41, 0x08, 0xCE, 0x86,
+    0x67, 0xDE, 0xA2, 0x7C, 0xB3, 0x00, 0x00, 0x1A, 0xDA, 0xAC, 0x91, 0x00,
+    0x00, 0x08, 0xCC, 0xDD, 0xA5, 0x55, 0x55, 0x5A, 0xDE, 0xEF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFD, 0xA5, 0x55, 0x55, 0x55, 0x55, 0xDD, 0x92, 0x22,
+    0x22, 0x22, 0x22, 0xBD, 0xA2, 0x00, 0x00, 0x00, 0x00, 0x7C, 0xC5, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0xCF, 0x97, 0x66, 0x7A, 0xA7, 0x03, 0x69, 0xBB,
+    0xCC, 0xBA, 0x84, 0x00, 0x24, 0x89, 0xAA, 0x97, 0x52, 0x00, 0x00, 0x06,
+    0xBF, 0x93, 0x00, 0x00, 0x00, 0x29, 0xCB, 0xD6, 0x10, 0x00, 0x00, 0x6A,
+    0xA6, 0xD8, 0x40, 0x00, 0x00, 0xC9, 0x50, 0x8B, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x12, 0x68, 0x9A, 0x98, 0x63, 0x01, 0x36, 0xBC,
+    0xCC, 0xCC, 0xA5, 0x03, 0x8E, 0xEB, 0x87, 0x9C, 0xB7, 0x1A, 0xED, 0x21,
+    0x00, 0x00, 0x00, 0x6C, 0xC8, 0x10, 0x00, 0x00, 0x00, 0x9D, 0xB3, 0x00,
+    0x00, 0x00, 0x00, 0xCD, 0xA0, 0x00, 0x00, 0x00, 0x00, 0xED, 0x80, 0x00,
+    0x4D, 0xFF, 0xFF, 0xFD, 0x80, 0x00, 0x38, 0x9C, 0xEF, 0xFC, 0x80, 0x00,
+    0x14, 0x49, 0xCF, 0xED, 0x80, 0x00, 0x00, 0x06, 0xBF, 0xCD, 0x90, 0x00,
+    0x00, 0x06, 0xBF, 0xAD, 0xB2, 0x00, 0x00, 0x06, 0xBF, 0x6C, 0xC7, 0x00,
+    0x00, 0x06, 0xBF, 0x2A, 0xEC, 0x10, 0x00, 0x06, 0xBF, 0x04, 0x9F, 0xEA,
+    0x87, 0x8C, 0xEF, 0x01, 0x48, 0xCC, 0xCC, 0xCC, 0xB9, 0x00, 0x13, 0x79,
+    0xAA, 0x98, 0x64, 0x00, 0x00, 0x06, 0xBF, 0x93, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x9C, 0xBD, 0x61, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xA6, 0xD8, 0x40,
+    0x00, 0x00, 0x00, 0x0C, 0x95, 0x08, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x48, 0x9A, 0xAA, 0xAA, 0xAA, 0x41,
+    0x02, 0x59, 0xAA, 0xBB, 0xCE, 0xED, 0xA4, 0x10, 0x5A, 0xF7, 0x53, 0x37,
+    0xCD, 0xA1, 0x00, 0x09, 0xDA, 0x00, 0x00, 0x07, 0xBE, 0x00, 0x00, 0x9D,
+    0xA0, 0x00, 0x00, 0x7B, 0xE0, 0x00, 0x08, 0xCB, 0x21, 0x11, 0x28, 0xCC,
+    0x00, 0x00, 0x6B, 0xF6, 0x42, 0x26, 0xCD, 0x90, 0x00, 0x00, 0x38, 0xFF,
+    0xFE, 0xC8, 0x40, 0x00, 0x00, 0x03, 0xAC, 0x75, 0x54, 0x31, 0x00, 0x00,
+    0x00, 0x4C, 0xA3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xE9, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x39, 0xFF, 0xFF, 0xFE, 0xC9, 0x10, 0x02, 0x68,
+    0x99, 0x88, 0x88, 0x9A, 0xD7, 0x20, 0x6A, 0xA6, 0x43, 0x33, 0x34, 0x7C,
+    0xC4, 0x0C, 0xB7, 0x00, 0x00, 0x00, 0x03, 0x9E, 0x50, 0xEB, 0x60, 0x00,
+    0x00, 0x00, 0x4B, 0xD4, 0x0B, 0xCB, 0x63, 0x33, 0x35, 0x7A, 0xE8, 0x30,
+    0x6A, 0xBA, 0x88, 0x88, 0x9A, 0xBB, 0x31, 0x00, 0x59, 0xCE, 0xFF, 0xED,
+    0xA7, 0x30, 0x00, 0x00, 0x00, 0xE5, 0x00, 0x19, 0x90, 0x00, 0x00, 0xB8,
+    0x53, 0x7A, 0x70, 0x00, 0x00, 0x79, 0x98, 0xB8, 0x40, 0x00, 0x00, 0x28,
+    0xCE, 0xB4, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x68,
+    0x9A, 0x98, 0x63, 0x01, 0x36, 0xBC, 0xCC, 0xCC, 0xA5, 0x03, 0x8E, 0xEB,
+    0x87, 0x9C, 0xB7, 0x1A, 0xED, 0x21, 0x00, 0x00, 0x00, 0x6C, 0xC8, 0x10,
+    0x00, 0x00, 0x00, 0x9D, 0xB3, 0x00, 0x00, 0x00, 0x00, 0xCD, 0xA0, 0x00,
+    0x00, 0x00, 0x00, 0xED, 0x80, 0x00, 0x4D, 0xFF, 0xFF, 0xFD, 0x80, 0x00,
+    0x38, 0x9C, 0xEF, 0xFC, 0x80, 0x00, 0x14, 0x49, 0xCF, 0xED, 0x80, 0x00,
+    0x00, 0x06, 0xBF, 0xCD, 0x90, 0x00, 0x00, 0x06, 0xBF, 0xAD, 0xB2, 0x00,
+    0x00, 0x06, 0xBF, 0x6C, 0xC7, 0x00, 0x00, 0x06, 0xBF, 0x2A, 0xEC, 0x10,
+    0x00, 0x06, 0xBF, 0x04, 0x9F, 0xEA, 0x87, 0x8C, 0xEF, 0x01, 0x48, 0xCC,
+    0xCC, 0xCC, 0xB9, 0x00, 0x13, 0x79, 0xAA, 0x98, 0x64, 0x00, 0x00, 0xE5,
+    0x00, 0x19, 0x90, 0x00, 0x00, 0x00, 0x0B, 0x85, 0x37, 0xA7, 0x00, 0x00,
+    0x00, 0x00, 0x79, 0x98, 0xB8, 0x40, 0x00, 0x00, 0x00, 0x02, 0x8C, 0xEB,
+    0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x48, 0x9A, 0xAA, 0xAA, 0xAA, 0x41, 0x02, 0x59, 0xAA, 0xBB, 0xCE, 0xED,
+    0xA4, 0x10, 0x5A, 0xF7, 0x53, 0x37, 0xCD, 0xA1, 0x00, 0x09, 0xDA, 0x00,
+    0x00, 0x07, 0xBE, 0x00, 0x00, 0x9D, 0xA0, 0x00, 0x00, 0x7B, 0xE0, 0x00,
+    0x08, 0xCB, 0x21, 0x11, 0x28, 0xCC, 0x00, 0x00, 0x6B, 0xF6, 0x42, 0x26,
+    0xCD, 0x90, 0x00, 0x00, 0x38, 0xFF, 0xFE, 0xC8, 0x40, 0x00, 0x00, 0x03,
+    0xAC, 0x75, 0x54, 0x31, 0x00, 0x00, 0x00, 0x4C, 0xA3, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x05, 0xE9, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xFF,
+    0xFF, 0xFE, 0xC9, 0x10, 0x02, 0x68, 0x99, 0x88, 0x88, 0x9A, 0xD7, 0x20,
+    0x6A, 0xA6, 0x43, 0x33, 0x34, 0x7C, 0xC4, 0x0C, 0xB7, 0x00, 0x00, 0x00,
+    0x03, 0x9E, 0x50, 0xEB, 0x60, 0x00, 0x00, 0x00, 0x4B, 0xD4, 0x0B, 0xCB,
+    0x63, 0x33, 0x35, 0x7A, 0xE8, 0x30, 0x6A, 0xBA, 0x88, 0x88, 0x9A, 0xBB,
+    0x31, 0x00, 0x59, 0xCE, 0xFF, 0xED, 0xA7, 0x30, 0x00, 0x00, 0x00, 0x00,
+    0x4C, 0x52, 0x00, 0x00, 0x00, 0x00, 0x4C, 0x52, 0x00, 0x00, 0x00, 0x00,
+    0x38, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x9C,
+    0xEF, 0xEC, 0x95, 0x02, 0x5A, 0xDB, 0xAA, 0xAC, 0xA6, 0x05, 0xAE, 0xA7,
+    0x65, 0x68, 0x85, 0x1A, 0xED, 0x21, 0x00, 0x00, 0x00, 0x8D, 0xC5, 0x00,
+    0x00, 0x00, 0x00, 0xAD, 0xA2, 0x00, 0x00, 0x00, 0x00, 0xDD, 0x90, 0x00,
+    0x14, 0x55, 0x55, 0xED, 0x80, 0x00, 0x4D, 0xFF, 0xFF, 0xFC, 0x70, 0x00,
+    0x26, 0x7A, 0xDF, 0xED, 0x80, 0x00, 0x12, 0x28, 0xCF, 0xDD, 0x80, 0x00,
+    0x00, 0x06, 0xBF, 0xCD, 0x90, 0x00, 0x00, 0x06, 0xBF, 0x8D, 0xB4, 0x00,
+    0x00, 0x06, 0xBF, 0x4B, 0xD9, 0x10, 0x00, 0x06, 0xBF, 0x18, 0xCD, 0x54,
+    0x32, 0x38, 0xCF, 0x04, 0x9F, 0xEA, 0x87, 0x8C, 0xEF, 0x00, 0x14, 0xBD,
+    0xEF, 0xDB, 0x96, 0x00, 0x01, 0x44, 0x55, 0x44, 0x32, 0x00, 0x00, 0x00,
+    0x4C, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xC5, 0x20, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x38, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x26, 0xCD, 0xEF, 0xFF, 0xFF, 0xF6, 0x10, 0x48,
+    0xC9, 0x87, 0x7A, 0xDE, 0xC6, 0x20, 0x07, 0xBD, 0x53, 0x22, 0x5B, 0xDB,
+    0x10, 0x00, 0x9D, 0xA0, 0x00, 0x00, 0x7B, 0xE0, 0x00, 0x09, 0xDA, 0x00,
+    0x00, 0x07, 0xBE, 0x00, 0x00, 0x7B, 0xD4, 0x21, 0x14, 0xAC, 0xA0, 0x00,
+    0x04, 0x8D, 0x97, 0x66, 0x8B, 0xA6, 0x00, 0x00, 0x03, 0x8F, 0xFF, 0xEC,
+    0x84, 0x00, 0x00, 0x00, 0x4B, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+    0xD9, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4C, 0xB7, 0x55, 0x55, 0x43,
+    0x00, 0x00, 0x03, 0x9F, 0xFF, 0xFF, 0xEC, 0x91, 0x00, 0x39, 0xB9, 0x65,
+    0x55, 0x57, 0xAE, 0xB4, 0x09, 0xA8, 0x32, 0x22, 0x22, 0x25, 0xAD, 0x40,
+    0xDB, 0x70, 0x00, 0x00, 0x00, 0x3A, 0xE5, 0x0E, 0xB6, 0x00, 0x00, 0x00,
+    0x04, 0xBD, 0x40, 0x9D, 0xD9, 0x54, 0x45, 0x7A, 0xDF, 0x52, 0x03, 0x7A,
+    0xBB, 0xBB, 0xBB, 0xA9, 0x72, 0x10, 0x03, 0x68, 0xAA, 0xAA, 0x87, 0x52,
+    0x00, 0x00, 0x00, 0x12, 0x9C, 0xEF, 0xEC, 0x95, 0x02, 0x5A, 0xDB, 0xAA,
+    0xAC, 0xA6, 0x05, 0xAE, 0xA7, 0x65, 0x68, 0x85, 0x1A, 0xED, 0x21, 0x00,
+    0x00, 0x00, 0x8D, 0xC5, 0x00, 0x00, 0x00, 0x00, 0xAD, 0xA2, 0x00, 0x00,
+    0x00, 0x00, 0xDD, 0x90, 0x00, 0x14, 0x55, 0x55, 0xED, 0x80, 0x00, 0x4D,
+    0xFF, 0xFF, 0xFC, 0x70, 0x00, 0x26, 0x7A, 0xDF, 0xED, 0x80, 0x00, 0x12,
+    0x28, 0xCF, 0xDD, 0x80, 0x00, 0x00, 0x06, 0xBF, 0xCD, 0x90, 0x00, 0x00,
+    0x06, 0xBF, 0x8D, 0xB4, 0x00, 0x00, 0x06, 0xBF, 0x4B, 0xD9, 0x10, 0x00,
+    0x06, 0xBF, 0x18, 0xCD, 0x54, 0x32, 0x38, 0xCF, 0x04, 0x9F, 0xEA, 0x87,
+    0x8C, 0xEF, 0x00, 0x14, 0xBD, 0xEF, 0xDB, 0x96, 0x00, 0x01, 0x44, 0x55,
+    0x44, 0x32, 0x00, 0x00, 0x02, 0x35, 0x00, 0x00, 0x00, 0x00, 0x05, 0x9E,
+    0x00, 0x00, 0x00, 0x00, 0x06, 0x98, 0x00, 0x00, 0x00, 0x00, 0x08, 0x93,
+    0x00, 0x00, 0x00, 0x00, 0x06, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0xD4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x6B, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x3A, 0x93, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xE7, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x48,
+    0x9A, 0xAA, 0xAA, 0xAA, 0x41, 0x02, 0x59, 0xAA, 0xBB, 0xCE, 0xED, 0xA4,
+    0x10, 0x5A, 0xF7, 0x53, 0x37, 0xCD, 0xA1, 0x00, 0x09, 0xDA, 0x00, 0x00,
+    0x07, 0xBE, 0x00, 0x00, 0x9D, 0xA0, 0x00, 0x00, 0x7B, 0xE0, 0x00, 0x08,
+    0xCB, 0x21, 0x11, 0x28, 0xCC, 0x00, 0x00, 0x6B, 0xF6, 0x42, 0x26, 0xCD,
+    0x90, 0x00, 0x00, 0x38, 0xFF, 0xFE, 0xC8, 0x40, 0x00, 0x00, 0x03, 0xAC,
+    0x75, 0x54, 0x31, 0x00, 0x00, 0x00, 0x4C, 0xA3, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x05, 0xE9, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xFF, 0xFF,
+    0xFE, 0xC9, 0x10, 0x02, 0x68, 0x99, 0x88, 0x88, 0x9A, 0xD7, 0x20, 0x6A,
+    0xA6, 0x43, 0x33, 0x34, 0x7C, 0xC4, 0x0C, 0xB7, 0x00, 0x00, 0x00, 0x03,
+    0x9E, 0x50, 0xEB, 0x60, 0x00, 0x00, 0x00, 0x4B, 0xD4, 0x0B, 0xCB, 0x63,
+    0x33, 0x35, 0x7A, 0xE8, 0x30, 0x6A, 0xBA, 0x88, 0x88, 0x9A, 0xBB, 0x31,
+    0x00, 0x59, 0xCE, 0xFF, 0xED, 0xA7, 0x30, 0x00, 0x00, 0x00, 0x9D, 0xD9,
+    0x00, 0x00, 0x00, 0x12, 0xDC, 0xCD, 0x21, 0x00, 0x00, 0x26, 0xC8, 0x8D,
+    0x62, 0x00, 0x00, 0x4C, 0x83, 0x38, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xA8, 0x40, 0x00, 0x00, 0x04, 0x8A, 0xFB, 0x60, 0x00, 0x00,
+    0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00,
+    0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00,
+    0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFE, 0xC9, 0x99, 0x99, 0x9C, 0xEF, 0xFC, 0x94, 0x44, 0x44,
+    0x49, 0xCF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00,
+    0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00,
+    0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00,
+    0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xA8, 0x40, 0x00, 0x00,
+    0x04, 0x8A, 0x00, 0x00, 0x9D, 0xD9, 0x00, 0x00, 0x01, 0x2D, 0xCC, 0xD2,
+    0x10, 0x00, 0x26, 0xC8, 0x8D, 0x62, 0x00, 0x04, 0xC8, 0x33, 0x8C, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x74, 0x00, 0x00, 0x00, 0x00, 0xFB,
+    0x60, 0x00, 0x00, 0x00, 0x0F, 0xB6, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60,
+    0x00, 0x00, 0x00, 0x0F, 0xB6, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x72, 0x45,
+    0x54, 0x31, 0x0F, 0xB8, 0x6D, 0xEE, 0xD8, 0x30, 0xFE, 0xDE, 0x76, 0x7A,
+    0xFA, 0x5F, 0xFC, 0x62, 0x22, 0x3D, 0xC7, 0xFE, 0xA2, 0x00, 0x00, 0xBD,
+    0x9F, 0xD8, 0x00, 0x00, 0x09, 0xDA, 0xFB, 0x60, 0x00, 0x00, 0x9D, 0xAF,
+    0xB6, 0x00, 0x00, 0x09, 0xDA, 0xFB, 0x60, 0x00, 0x00, 0x9D, 0xAF, 0xB6,
+    0x00, 0x00, 0x09, 0xDA, 0xFB, 0x60, 0x00, 0x00, 0x9D, 0xAF, 0xB6, 0x00,
+    0x00, 0x09, 0xDA, 0xFB, 0x60, 0x00, 0x00, 0x9D, 0xAF, 0xB6, 0x00, 0x00,
+    0x09, 0xDA, 0x00, 0x5F, 0xA3, 0x00, 0x00, 0x00, 0xAD, 0xA0, 0x00, 0x00,
+    0x5F, 0xA3, 0x00, 0x00, 0x00, 0xAD, 0xA0, 0x00, 0x14, 0x8F, 0xB7, 0x55,
+    0x55, 0x55, 0xBE, 0xC5, 0x10, 0x3B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x31, 0x14, 0x9F, 0xC8, 0x66, 0x66, 0x66, 0xCE, 0xC6, 0x10, 0x01,
+    0x6F, 0xA5, 0x22, 0x22, 0x22, 0xAD, 0xB2, 0x00, 0x00, 0x5F, 0xB7, 0x55,
+    0x55, 0x55, 0xBE, 0xA0, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xA0, 0x00, 0x00, 0x5F, 0xC8, 0x77, 0x77, 0x77, 0xCE, 0xA0, 0x00, 0x00,
+    0x5F, 0xA5, 0x22, 0x22, 0x22, 0xAD, 0xA0, 0x00, 0x00, 0x5F, 0xA3, 0x00,
+    0x00, 0x00, 0xAD, 0xA0, 0x00, 0x00, 0x5F, 0xA3, 0x00, 0x00, 0x00, 0xAD,
+    0xA0, 0x00, 0x00, 0x5F, 0xA3, 0x00, 0x00, 0x00, 0xAD, 0xA0, 0x00, 0x00,
+    0x5F, 0xA3, 0x00, 0x00, 0x00, 0xAD, 0xA0, 0x00, 0x00, 0x5F, 0xA3, 0x00,
+    0x00, 0x00, 0xAD, 0xA0, 0x00, 0x00, 0x5F, 0xA3, 0x00, 0x00, 0x00, 0xAD,
+    0xA0, 0x00, 0x00, 0x5F, 0xA3, 0x00, 0x00, 0x00, 0xAD, 0xA0, 0x00, 0x00,
+    0x25, 0x31, 0x00, 0x00, 0x00, 0x34, 0x30, 0x00, 0x00, 0x5F, 0x93, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x5F, 0x93, 0x00, 0x00, 0x00, 0x00, 0x24, 0x8F,
+    0xB7, 0x55, 0x53, 0x10, 0x00, 0x6C, 0xFF, 0xFF, 0xFF, 0xF8, 0x30, 0x00,
+    0x12, 0x7F, 0xA5, 0x22, 0x21, 0x00, 0x00, 0x01, 0x6F, 0x96, 0x69, 0xB9,
+    0x85, 0x00, 0x00, 0x5F, 0xA9, 0x9B, 0xCC, 0xCA, 0x31, 0x00, 0x5F, 0xDD,
+    0xB7, 0x69, 0xCF, 0x83, 0x00, 0x5F, 0xF6, 0x10, 0x00, 0x4D, 0xD4, 0x00,
+    0x5F, 0xC4, 0x00, 0x00, 0x4B, 0xE5, 0x00, 0x5F, 0xB4, 0x00, 0x00, 0x39,
+    0xF5, 0x00, 0x5F, 0x93, 0x00, 0x00, 0x39, 0xF5, 0x00, 0x5F, 0x93, 0x00,
+    0x00, 0x39, 0xF5, 0x00, 0x5F, 0x93, 0x00, 0x00, 0x39, 0xF5, 0x00, 0x5F,
+    0x93, 0x00, 0x00, 0x39, 0xF5, 0x00, 0x5F, 0x93, 0x00, 0x00, 0x39, 0xF5,
+    0x00, 0x5F, 0x93, 0x00, 0x00, 0x39, 0xF5, 0x00, 0x5F, 0x93, 0x00, 0x00,
+    0x39, 0xF5, 0x00, 0x3A, 0x62, 0x00, 0x00, 0x26, 0xA3, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x14, 0x89, 0x52, 0x01, 0x66, 0x03, 0x7B, 0xB9, 0x63,
+    0x49, 0x80, 0x7A, 0x98, 0xDD, 0x99, 0xA7, 0x09, 0x91, 0x03, 0x7D, 0xD6,
+    0x20, 0x33, 0x00, 0x12, 0x44, 0x21, 0x14, 0x55, 0x55, 0x55, 0x54, 0x23,
+    0xBF, 0xFF, 0xFF, 0xFF, 0xB6, 0x13, 0x45, 0xCE, 0xC5, 0x43, 0x10, 0x11,
+    0x2A, 0xDB, 0x21, 0x10, 0x00, 0x00, 0x9D, 0xA0, 0x00, 0x00, 0x00, 0x09,
+    0xDA, 0x00, 0x00, 0x00, 0x00, 0x9D, 0xA0, 0x00, 0x00, 0x00, 0x09, 0xDA,
+    0x00, 0x00, 0x00, 0x00, 0x9D, 0xA0, 0x00, 0x00, 0x00, 0x09, 0xDA, 0x00,
+    0x00, 0x00, 0x00, 0x9D, 0xA0, 0x00, 0x00, 0x00, 0x09, 0xDA, 0x00, 0x00,
+    0x00, 0x00, 0x9D, 0xA0, 0x00, 0x00, 0x00, 0x09, 0xDA, 0x00, 0x00, 0x00,
+    0x00, 0x9D, 0xA0, 0x00, 0x00, 0x23, 0x3B, 0xEB, 0x43, 0x21, 0x26, 0x88,
+    0xDE, 0xD9, 0x85, 0x33, 0xBF, 0xFF, 0xFF, 0xFF, 0xB6, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x48, 0x95, 0x20, 0x16, 0x60, 0x03, 0x7B, 0xB9,
+    0x63, 0x49, 0x80, 0x07, 0xA9, 0x8D, 0xD9, 0x9A, 0x70, 0x09, 0x91, 0x03,
+    0x7D, 0xD6, 0x20, 0x03, 0x30, 0x01, 0x24, 0x42, 0x10, 0x01, 0x35, 0x55,
+    0x43, 0x00, 0x00, 0x04, 0x9F, 0xFF, 0xD9, 0x00, 0x00, 0x00, 0x12, 0x3B,
+    0xD9, 0x00, 0x00, 0x00, 0x01, 0x1A, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x0A,
+    0xD9, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x0A,
+    0xD9, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x0A,
+    0xD9, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x0A,
+    0xD9, 0x00, 0x00, 0x01, 0x12, 0x2B, 0xDA, 0x22, 0x11, 0x04, 0x67, 0x7C,
+    0xEC, 0x77, 0x64, 0x0A, 0xFF, 0xFF, 0xFF, 0xFF, 0xDA, 0x00, 0x25, 0x55,
+    0x55, 0x52, 0x00, 0x04, 0xCC, 0xCC, 0xCC, 0x40, 0x00, 0x3A, 0xAA, 0xAA,
+    0xA3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0xFF, 0xFF, 0xFF, 0xFB,
+    0x62, 0x68, 0x8D, 0xED, 0x98, 0x53, 0x02, 0x33, 0xBE, 0xB4, 0x32, 0x10,
+    0x00, 0x09, 0xDA, 0x00, 0x00, 0x00, 0x00, 0x9D, 0xA0, 0x00, 0x00, 0x00,
+    0x09, 0xDA, 0x00, 0x00, 0x00, 0x00, 0x9D, 0xA0, 0x00, 0x00, 0x00, 0x09,
+    0xDA, 0x00, 0x00, 0x00, 0x00, 0x9D, 0xA0, 0x00, 0x00, 0x00, 0x09, 0xDA,
+    0x00, 0x00, 0x00, 0x00, 0x9D, 0xA0, 0x00, 0x00, 0x00, 0x09, 0xDA, 0x00,
+    0x00, 0x00, 0x00, 0x9D, 0xA0, 0x00, 0x00, 0x00, 0x09, 0xDA, 0x00, 0x00,
+    0x01, 0x12, 0xAD, 0xB2, 0x11, 0x01, 0x34, 0x5C, 0xEC, 0x54, 0x31, 0x3B,
+    0xFF, 0xFF, 0xFF, 0xFB, 0x61, 0x45, 0x55, 0x55, 0x55, 0x42, 0x00, 0x25,
+    0x55, 0x55, 0x52, 0x00, 0x00, 0x4C, 0xCC, 0xCC, 0xC4, 0x00, 0x00, 0x3A,
+    0xAA, 0xAA, 0xA3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x9F,
+    0xFF, 0xD9, 0x00, 0x00, 0x01, 0x36, 0x7C, 0xD9, 0x00, 0x00, 0x00, 0x11,
+    0x2B, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00, 0x00, 0x11,
+    0x1A, 0xD9, 0x11, 0x10, 0x01, 0x22, 0x3B, 0xDA, 0x32, 0x21, 0x0A, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xDA, 0x03, 0x55, 0x55, 0x55, 0x55, 0x43, 0x00, 0x5E,
+    0x10, 0x01, 0xE5, 0x00, 0x04, 0xB6, 0x45, 0x7B, 0x40, 0x00, 0x27, 0xA9,
+    0x9B, 0x72, 0x00, 0x01, 0x2C, 0xDD, 0xB1, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0x7A, 0xAA, 0xAA, 0xAA, 0x74, 0x28, 0xBC, 0xEF, 0xEC, 0xB8,
+    0x41, 0x34, 0x5C, 0xEC, 0x54, 0x31, 0x00, 0x00, 0x9D, 0xA0, 0x00, 0x00,
+    0x00, 0x09, 0xDA, 0x00, 0x00, 0x00, 0x00, 0x9D, 0xA0, 0x00, 0x00, 0x00,
+    0x09, 0xDA, 0x00, 0x00, 0x00, 0x00, 0x9D, 0xA0, 0x00, 0x00, 0x00, 0x09,
+    0xDA, 0x00, 0x00, 0x00, 0x00, 0x9D, 0xA0, 0x00, 0x00, 0x00, 0x09, 0xDA,
+    0x00, 0x00, 0x00, 0x00, 0x9D, 0xA0, 0x00, 0x00, 0x00, 0x09, 0xDA, 0x00,
+    0x00, 0x00, 0x00, 0x9D, 0xA0, 0x00, 0x00, 0x00, 0x09, 0xDA, 0x00, 0x00,
+    0x13, 0x45, 0xCE, 0xC5, 0x43, 0x12, 0x8B, 0xCE, 0xFE, 0xCB, 0x84, 0x27,
+    0xAA, 0xAA, 0xAA, 0xA7, 0x40, 0x00, 0x00, 0xE5, 0x00, 0x19, 0x90, 0x00,
+    0x00, 0xB8, 0x53, 0x7A, 0x70, 0x00, 0x00, 0x79, 0x98, 0xB8, 0x40, 0x00,
+    0x00, 0x28, 0xCE, 0xB4, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+    0x6A, 0xAA, 0x96, 0x00, 0x00, 0x02, 0x6B, 0xBE, 0xD9, 0x00, 0x00, 0x00,
+    0x12, 0x3B, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00, 0x00,
+    0x00, 0x0A, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00, 0x00,
+    0x00, 0x0A, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00, 0x00,
+    0x00, 0x0A, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00, 0x00,
+    0x00, 0x0A, 0xD9, 0x00, 0x00, 0x01, 0x22, 0x3B, 0xDA, 0x32, 0x21, 0x07,
+    0xBB, 0xBE, 0xED, 0xBB, 0xA7, 0x07, 0xAA, 0xAA, 0xAA, 0xAA, 0x97, 0x3B,
+    0xFF, 0xFF, 0xFF, 0xFB, 0x62, 0x68, 0x8D, 0xED, 0x98, 0x53, 0x02, 0x33,
+    0xBE, 0xB4, 0x32, 0x10, 0x00, 0x09, 0xDA, 0x00, 0x00, 0x00, 0x00, 0x9D,
+    0xA0, 0x00, 0x00, 0x00, 0x09, 0xDA, 0x00, 0x00, 0x00, 0x00, 0x9D, 0xA0,
+    0x00, 0x00, 0x00, 0x09, 0xDA, 0x00, 0x00, 0x00, 0x00, 0x9D, 0xA0, 0x00,
+    0x00, 0x00, 0x09, 0xDA, 0x00, 0x00, 0x00, 0x00, 0x9D, 0xA0, 0x00, 0x00,
+    0x00, 0x09, 0xDA, 0x00, 0x00, 0x00, 0x00, 0x9D, 0xA0, 0x00, 0x00, 0x00,
+    0x09, 0xDA, 0x00, 0x00, 0x01, 0x12, 0xAD, 0xB2, 0x11, 0x01, 0x34, 0x5C,
+    0xEC, 0x54, 0x31, 0x3B, 0xFF, 0xFF, 0xFF, 0xFB, 0x61, 0x45, 0x57, 0xBC,
+    0x95, 0x42, 0x00, 0x00, 0x69, 0x94, 0x00, 0x00, 0x00, 0x0C, 0x95, 0x00,
+    0x00, 0x00, 0x00, 0xB9, 0x61, 0x21, 0x00, 0x00, 0x05, 0x9B, 0xA9, 0x30,
+    0x00, 0x00, 0x16, 0x9A, 0x93, 0x00, 0x00, 0x00, 0x09, 0xB8, 0x00, 0x00,
+    0x00, 0x00, 0x09, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x06, 0x75, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x6A, 0xAA, 0x96, 0x00, 0x00, 0x02, 0x6B, 0xBE, 0xD9, 0x00, 0x00,
+    0x00, 0x12, 0x3B, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00,
+    0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00,
+    0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00,
+    0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00,
+    0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00, 0x01, 0x22, 0x3B, 0xDA, 0x32, 0x21,
+    0x07, 0xBB, 0xBE, 0xED, 0xBB, 0xA7, 0x07, 0xAA, 0xBD, 0xDC, 0xAA, 0x97,
+    0x00, 0x00, 0x29, 0xA6, 0x00, 0x00, 0x00, 0x00, 0xC9, 0x50, 0x00, 0x00,
+    0x00, 0x00, 0xB9, 0x51, 0x10, 0x00, 0x00, 0x00, 0x89, 0x86, 0x62, 0x00,
+    0x00, 0x00, 0x19, 0xDF, 0xD4, 0x00, 0x00, 0x00, 0x08, 0xA5, 0x00, 0x00,
+    0x00, 0x00, 0x8A, 0x50, 0x00, 0x00, 0x00, 0x06, 0x74, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x3B, 0xFF, 0xFF, 0xFF, 0xFB, 0x62, 0x68, 0x8D,
+    0xED, 0x98, 0x53, 0x02, 0x33, 0xBE, 0xB4, 0x32, 0x10, 0x00, 0x09, 0xDA,
+    0x00, 0x00, 0x00, 0x00, 0x9D, 0xA0, 0x00, 0x00, 0x00, 0x09, 0xDA, 0x00,
+    0x00, 0x00, 0x00, 0x9D, 0xA0, 0x00, 0x00, 0x00, 0x09, 0xDA, 0x00, 0x00,
+    0x00, 0x00, 0x9D, 0xA0, 0x00, 0x00, 0x00, 0x09, 0xDA, 0x00, 0x00, 0x00,
+    0x00, 0x9D, 0xA0, 0x00, 0x00, 0x00, 0x09, 0xDA, 0x00, 0x00, 0x00, 0x00,
+    0x9D, 0xA0, 0x00, 0x00, 0x00, 0x09, 0xDA, 0x00, 0x00, 0x01, 0x12, 0xAD,
+    0xB2, 0x11, 0x01, 0x34, 0x5C, 0xEC, 0x54, 0x31, 0x3B, 0xFF, 0xFF, 0xFF,
+    0xFB, 0x61, 0x45, 0x55, 0x55, 0x55, 0x42, 0x04, 0x9F, 0xFF, 0xD9, 0x00,
+    0x00, 0x01, 0x36, 0x7C, 0xD9, 0x00, 0x00, 0x00, 0x11, 0x2B, 0xD9, 0x00,
+    0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00,
+    0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00,
+    0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00,
+    0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00, 0x00, 0x11, 0x1A, 0xD9, 0x11,
+    0x10, 0x01, 0x22, 0x3B, 0xDA, 0x32, 0x21, 0x0A, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xDA, 0x03, 0x55, 0x55, 0x55, 0x55, 0x43, 0xFB, 0x60, 0x00, 0x00, 0x06,
+    0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06,
+    0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06,
+    0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06,
+    0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06,
+    0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06,
+    0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x07,
+    0xCE, 0xFB, 0x60, 0x00, 0x00, 0x08, 0xCC, 0xFB, 0x60, 0x33, 0x22, 0x4B,
+    0xD9, 0xFB, 0x60, 0xA8, 0x77, 0xCE, 0xC5, 0xFB, 0x60, 0xCD, 0xEE, 0xC7,
+    0x30, 0x54, 0x20, 0x44, 0x55, 0x42, 0x10, 0x09, 0xB8, 0x00, 0x00, 0xAB,
+    0x70, 0x9B, 0x80, 0x00, 0x0A, 0xB7, 0x06, 0x75, 0x00, 0x00, 0x77, 0x50,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79,
+    0x60, 0x03, 0xAA, 0xA7, 0x0A, 0xD9, 0x00, 0x4B, 0xDE, 0xA0, 0xAD, 0x90,
+    0x01, 0x2A, 0xDA, 0x0A, 0xD9, 0x00, 0x00, 0x9D, 0xA0, 0xAD, 0x90, 0x00,
+    0x09, 0xDA, 0x0A, 0xD9, 0x00, 0x00, 0x9D, 0xA0, 0xAD, 0x90, 0x00, 0x09,
+    0xDA, 0x0A, 0xD9, 0x00, 0x00, 0x9D, 0xA0, 0xAD, 0x90, 0x00, 0x09, 0xDA,
+    0x0A, 0xD9, 0x00, 0x00, 0x9D, 0xA0, 0xAD, 0x90, 0x00, 0x09, 0xDA, 0x0A,
+    0xD9, 0x00, 0x00, 0x9D, 0xA0, 0xAD, 0x90, 0x00, 0x09, 0xDA, 0x07, 0x96,
+    0x00, 0x00, 0x9D, 0xA0, 0x00, 0x00, 0x00, 0x09, 0xDA, 0x00, 0x00, 0x00,
+    0x00, 0xAC, 0x90, 0x00, 0x00, 0x35, 0x4D, 0xC7, 0x00, 0x00, 0x06, 0x99,
+    0xD9, 0x50, 0x00, 0x00, 0x8D, 0xFB, 0x51, 0x00, 0x00, 0x00, 0x00, 0x9D,
+    0xD9, 0x00, 0x00, 0x00, 0x00, 0x12, 0xDC, 0xCD, 0x21, 0x00, 0x00, 0x00,
+    0x26, 0xC8, 0x8D, 0x62, 0x00, 0x00, 0x00, 0x4C, 0x83, 0x38, 0xC4, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x70,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xAD, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xAD, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAD, 0xA0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xAD, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAD, 0xA0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xAD, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAD,
+    0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAD, 0xA0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xAD, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAD, 0xA0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xAD, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0xA0,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0xDD, 0x80, 0x00, 0x00, 0x00, 0x00, 0x14,
+    0xFC, 0x70, 0x00, 0xDA, 0x87, 0x79, 0xCF, 0xD6, 0x10, 0x00, 0xBC, 0xCC,
+    0xCC, 0xCB, 0x52, 0x00, 0x00, 0x78, 0x9A, 0xA9, 0x86, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x9D, 0xD9, 0x00, 0x00, 0x12, 0xDC, 0xCD, 0x21, 0x00, 0x26,
+    0xC8, 0x8D, 0x62, 0x00, 0x4C, 0x83, 0x38, 0xC4, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x07, 0xAA, 0xAA, 0xAA, 0x00, 0x07, 0xBB, 0xBD, 0xEF, 0x00, 0x01,
+    0x22, 0x38, 0xCF, 0x00, 0x00, 0x00, 0x06, 0xBF, 0x00, 0x00, 0x00, 0x06,
+    0xBF, 0x00, 0x00, 0x00, 0x06, 0xBF, 0x00, 0x00, 0x00, 0x06, 0xBF, 0x00,
+    0x00, 0x00, 0x06, 0xBF, 0x00, 0x00, 0x00, 0x06, 0xBF, 0x00, 0x00, 0x00,
+    0x06, 0xBF, 0x00, 0x00, 0x00, 0x06, 0xBF, 0x00, 0x00, 0x00, 0x06, 0xBF,
+    0x00, 0x00, 0x00, 0x06, 0xBF, 0x00, 0x00, 0x00, 0x06, 0xBF, 0x00, 0x00,
+    0x00, 0x06, 0xBF, 0x00, 0x00, 0x00, 0x08, 0xCD, 0x00, 0x64, 0x44, 0x6B,
+    0xC9, 0x00, 0xA9, 0x98, 0xBC, 0xA5, 0x00, 0xCD, 0xEF, 0xD9, 0x50, 0x00,
+    0xFB, 0x60, 0x00, 0x00, 0x4B, 0xDB, 0x00, 0xFB, 0x60, 0x00, 0x12, 0xBC,
+    0xA4, 0x00, 0xFB, 0x60, 0x00, 0x26, 0xDA, 0x60, 0x00, 0xFB, 0x60, 0x01,
+    0x5D, 0xC5, 0x10, 0x00, 0xFB, 0x60, 0x18, 0xCD, 0x10, 0x00, 0x00, 0xFB,
+    0x60, 0x8B, 0xA5, 0x00, 0x00, 0x00, 0xFB, 0x73, 0xCA, 0x71, 0x00, 0x00,
+    0x00, 0xFB, 0x99, 0xF6, 0x10, 0x00, 0x00, 0x00, 0xFE, 0xDD, 0xEA, 0x50,
+    0x00, 0x00, 0x00, 0xFE, 0xB6, 0x9B, 0x92, 0x00, 0x00, 0x00, 0xFD, 0x81,
+    0x4A, 0xB7, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x07, 0xCD, 0x10, 0x00, 0x00,
+    0xFB, 0x60, 0x01, 0x6E, 0xA3, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x39, 0xD7,
+    0x30, 0x00, 0xFB, 0x60, 0x00, 0x14, 0xEB, 0x61, 0x00, 0xFB, 0x60, 0x00,
+    0x00, 0xBD, 0xB3, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x2A, 0xED, 0x10, 0x54,
+    0x20, 0x00, 0x00, 0x13, 0x54, 0x00, 0x00, 0x00, 0x24, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x7B, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA8, 0x50,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xC6, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x93, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x00, 0xFB,
+    0x60, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x00, 0xFB,
+    0x60, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x00, 0xFB,
+    0x60, 0x00, 0x14, 0xA6, 0x30, 0xFB, 0x60, 0x01, 0x49, 0xC7, 0x30, 0xFB,
+    0x60, 0x04, 0x9F, 0x62, 0x00, 0xFB, 0x60, 0x5B, 0xB5, 0x00, 0x00, 0xFB,
+    0x63, 0xB8, 0x52, 0x00, 0x00, 0xFB, 0x88, 0xC5, 0x20, 0x00, 0x00, 0xFC,
+    0xBE, 0x72, 0x00, 0x00, 0x00, 0xFF, 0xD9, 0xE8, 0x30, 0x00, 0x00, 0xFC,
+    0x83, 0x8A, 0x82, 0x00, 0x00, 0xFB, 0x60, 0x49, 0xB7, 0x10, 0x00, 0xFB,
+    0x60, 0x05, 0xAE, 0x31, 0x00, 0xFB, 0x60, 0x00, 0x3A, 0xE6, 0x20, 0xFB,
+    0x60, 0x00, 0x14, 0xCB, 0x71, 0xA7, 0x40, 0x00, 0x00, 0x89, 0x61, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7B, 0x90, 0x00, 0x00, 0x00,
+    0x00, 0x99, 0x70, 0x00, 0x00, 0x00, 0x00, 0xB7, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0xD5, 0x10, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x25, 0xFA, 0x50, 0xFB,
+    0x60, 0x02, 0x5B, 0xA5, 0x20, 0xFB, 0x60, 0x15, 0x9C, 0x52, 0x00, 0xFB,
+    0x60, 0x3A, 0xC7, 0x00, 0x00, 0xFA, 0x62, 0xE9, 0x50, 0x00, 0x00, 0xFA,
+    0x89, 0xA5, 0x20, 0x00, 0x00, 0xFB, 0xBD, 0xA4, 0x10, 0x00, 0x00, 0xFE,
+    0xEE, 0xE6, 0x20, 0x00, 0x00, 0xFC, 0x70, 0x9C, 0xA2, 0x00, 0x00, 0xFB,
+    0x60, 0x38, 0xBA, 0x10, 0x00, 0xFB, 0x60, 0x04, 0x9D, 0x62, 0x00, 0xFB,
+    0x60, 0x00, 0x4B, 0xD6, 0x10, 0xFB, 0x60, 0x00, 0x01, 0xCD, 0x92, 0x54,
+    0x20, 0x00, 0x00, 0x44, 0x31, 0x01, 0x6F, 0xC4, 0x00, 0x00, 0x00, 0x48,
+    0xF6, 0x20, 0x00, 0x00, 0x06, 0xAC, 0x21, 0x00, 0x00, 0x00, 0x9B, 0x70,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x84, 0x00, 0x00,
+    0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x0F, 0xB6, 0x00, 0x00, 0x00,
+    0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x0F, 0xB6, 0x00, 0x00, 0x00, 0x00,
+    0xFB, 0x60, 0x00, 0x00, 0x00, 0x0F, 0xB6, 0x00, 0x00, 0x00, 0x00, 0xFB,
+    0x60, 0x00, 0x00, 0x00, 0x0F, 0xB6, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60,
+    0x00, 0x00, 0x00, 0x0F, 0xB6, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00,
+    0x00, 0x00, 0x0F, 0xB6, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00,
+    0x00, 0x0F, 0xB6, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xA7, 0x77, 0x77, 0x77,
+    0x4F, 0xED, 0xCC, 0xCC, 0xCC, 0xC8, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x70,
+    0x00, 0x00, 0x01, 0x6F, 0xC4, 0x00, 0x00, 0x00, 0x04, 0x8F, 0x62, 0x00,
+    0x00, 0x00, 0x06, 0xAC, 0x21, 0x00, 0x00, 0x00, 0x09, 0xB7, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x6A, 0xAA, 0x96, 0x00, 0x00,
+    0x02, 0x6B, 0xBE, 0xD9, 0x00, 0x00, 0x00, 0x12, 0x3B, 0xD9, 0x00, 0x00,
+    0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00,
+    0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00,
+    0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00,
+    0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00,
+    0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00,
+    0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00,
+    0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00, 0x01, 0x12, 0x2B, 0xDA, 0x22, 0x11,
+    0x04, 0x67, 0x7C, 0xEC, 0x77, 0x64, 0x0A, 0xFF, 0xFF, 0xFF, 0xFF, 0xDA,
+    0xFB, 0x60, 0x00, 0x00, 0x00, 0x0F, 0xB6, 0x00, 0x00, 0x00, 0x00, 0xFB,
+    0x60, 0x00, 0x00, 0x00, 0x0F, 0xB6, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60,
+    0x00, 0x00, 0x00, 0x0F, 0xB6, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00,
+    0x00, 0x00, 0x0F, 0xB6, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00,
+    0x00, 0x0F, 0xB6, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00,
+    0x0F, 0xB6, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x0F,
+    0xB6, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x82, 0x22, 0x22, 0x22, 0x1F, 0xDA,
+    0x77, 0x77, 0x77, 0x74, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA5, 0x55, 0x55,
+    0x55, 0x55, 0x53, 0x00, 0x00, 0x24, 0x30, 0x00, 0x00, 0x00, 0x07, 0xB9,
+    0x00, 0x00, 0x00, 0x00, 0xA8, 0x50, 0x00, 0x00, 0x00, 0x0C, 0x62, 0x00,
+    0x00, 0x00, 0x00, 0x93, 0x00, 0x00, 0x00, 0x03, 0x8F, 0xFF, 0xD9, 0x00,
+    0x00, 0x01, 0x36, 0x7C, 0xD9, 0x00, 0x00, 0x00, 0x11, 0x2B, 0xD9, 0x00,
+    0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00,
+    0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00,
+    0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00,
+    0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00,
+    0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00,
+    0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00,
+    0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00, 0x01, 0x22, 0x3B, 0xDA, 0x32,
+    0x21, 0x07, 0xBB, 0xBE, 0xED, 0xBB, 0xA7, 0x07, 0xAA, 0xAA, 0xAA, 0xAA,
+    0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x9E, 0x00,
+    0x00, 0x00, 0x00, 0x06, 0x9A, 0x00, 0x00, 0x00, 0x00, 0x07, 0x96, 0x00,
+    0x00, 0x00, 0x00, 0x09, 0x91, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x38, 0xD4,
+    0x0F, 0xB6, 0x00, 0x03, 0xAA, 0x30, 0xFB, 0x60, 0x00, 0x4C, 0x52, 0x0F,
+    0xB6, 0x00, 0x04, 0xD1, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x0F, 0xB6,
+    0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x0F, 0xB6, 0x00,
+    0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x0F, 0xB6, 0x00, 0x00,
+    0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x0F, 0xB6, 0x00, 0x00, 0x00,
+    0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x0F, 0xB6, 0x00, 0x00, 0x00, 0x00,
+    0xFC, 0x82, 0x22, 0x22, 0x22, 0x1F, 0xDA, 0x77, 0x77, 0x77, 0x74, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xA5, 0x55, 0x55, 0x55, 0x55, 0x53, 0x03, 0x8F,
+    0xFF, 0xD9, 0x06, 0xAD, 0x01, 0x36, 0x7C, 0xD9, 0x07, 0xAA, 0x00, 0x11,
+    0x2B, 0xD9, 0x08, 0xA5, 0x00, 0x00, 0x0A, 0xD9, 0x09, 0x91, 0x00, 0x00,
+    0x0A, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00, 0x01, 0x22,
+    0x3B, 0xDA, 0x32, 0x21, 0x07, 0xBB, 0xBE, 0xED, 0xBB, 0xA7, 0x07, 0xAA,
+    0xAA, 0xAA, 0xAA, 0x97, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x0F, 0xB6, 0x00,
+    0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x0F, 0xB6, 0x00, 0x00,
+    0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x0F, 0xB6, 0x00, 0x03, 0x84,
+    0x10, 0xFB, 0x60, 0x00, 0x4C, 0x52, 0x0F, 0xB6, 0x00, 0x04, 0xC5, 0x20,
+    0xFB, 0x60, 0x00, 0x00, 0x00, 0x0F, 0xB6, 0x00, 0x00, 0x00, 0x00, 0xFB,
+    0x60, 0x00, 0x00, 0x00, 0x0F, 0xB6, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60,
+    0x00, 0x00, 0x00, 0x0F, 0xB6, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x82, 0x22,
+    0x22, 0x22, 0x1F, 0xDA, 0x77, 0x77, 0x77, 0x74, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xA5, 0x55, 0x55, 0x55, 0x55, 0x53, 0x03, 0x8F, 0xFF, 0xD9, 0x00,
+    0x00, 0x01, 0x36, 0x7C, 0xD9, 0x00, 0x00, 0x00, 0x11, 0x2B, 0xD9, 0x00,
+    0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00,
+    0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00,
+    0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD9, 0x08,
+    0xA5, 0x00, 0x00, 0x0A, 0xD9, 0x08, 0xA5, 0x00, 0x00, 0x0A, 0xD9, 0x06,
+    0x74, 0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00,
+    0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00,
+    0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00, 0x01, 0x22, 0x3B, 0xDA, 0x32,
+    0x21, 0x07, 0xBB, 0xBE, 0xED, 0xBB, 0xA7, 0x07, 0xAA, 0xAA, 0xAA, 0xAA,
+    0x97, 0x00, 0x5F, 0xA3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xA3, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x5F, 0xA3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F,
+    0xA3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xA3, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x5F, 0xA3, 0x14, 0x72, 0x00, 0x00, 0x00, 0x5F, 0xA6, 0x58, 0x93,
+    0x00, 0x00, 0x00, 0x5F, 0xCC, 0xDE, 0x62, 0x00, 0x00, 0x01, 0x6F, 0xFB,
+    0x71, 0x00, 0x00, 0x00, 0x48, 0xBF, 0xC6, 0x20, 0x00, 0x00, 0x00, 0x7A,
+    0xDF, 0xA3, 0x00, 0x00, 0x00, 0x00, 0xA7, 0x9F, 0xA3, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x5F, 0xA3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xA3, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x5F, 0xA5, 0x22, 0x22, 0x22, 0x21, 0x00, 0x5F,
+    0xC8, 0x77, 0x77, 0x77, 0x72, 0x00, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5,
+    0x00, 0x25, 0x55, 0x55, 0x55, 0x55, 0x52, 0x03, 0x8F, 0xFF, 0xD9, 0x00,
+    0x00, 0x01, 0x36, 0x7C, 0xD9, 0x00, 0x00, 0x00, 0x11, 0x2B, 0xD9, 0x00,
+    0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00,
+    0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD9, 0x33,
+    0x20, 0x00, 0x00, 0x0A, 0xD9, 0x89, 0x60, 0x00, 0x00, 0x0A, 0xFF, 0x93,
+    0x00, 0x00, 0x00, 0x6C, 0xEB, 0x31, 0x00, 0x00, 0x14, 0x8D, 0xD9, 0x00,
+    0x00, 0x00, 0x3A, 0x7C, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00,
+    0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00,
+    0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00, 0x01, 0x22, 0x3B, 0xDA, 0x32,
+    0x21, 0x07, 0xBB, 0xBE, 0xED, 0xBB, 0xA7, 0x07, 0xAA, 0xAA, 0xAA, 0xAA,
+    0x97, 0x00, 0x00, 0x01, 0x6F, 0xC4, 0x00, 0x00, 0x00, 0x04, 0x8F, 0x62,
+    0x00, 0x00, 0x00, 0x06, 0xAC, 0x21, 0x00, 0x00, 0x00, 0x09, 0xB7, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA9, 0x60, 0x00, 0x00, 0x03,
+    0x7A, 0xFE, 0xA3, 0x00, 0x00, 0x05, 0xAF, 0xFF, 0xC7, 0x00, 0x00, 0x05,
+    0xAF, 0xFD, 0xDE, 0x10, 0x00, 0x05, 0xAF, 0xFB, 0xAD, 0x62, 0x00, 0x05,
+    0xAF, 0xFA, 0x8A, 0xA4, 0x00, 0x05, 0xAF, 0xFA, 0x65, 0xF6, 0x10, 0x05,
+    0xAF, 0xFA, 0x50, 0xBA, 0x70, 0x05, 0xAF, 0xFA, 0x50, 0x6B, 0xA2, 0x05,
+    0xAF, 0xFA, 0x50, 0x2A, 0xB6, 0x05, 0xAF, 0xFA, 0x50, 0x07, 0xAC, 0x05,
+    0xAF, 0xFA, 0x50, 0x01, 0x6F, 0x56, 0xAF, 0xFA, 0x50, 0x00, 0x4A, 0xA8,
+    0xAF, 0xFA, 0x50, 0x00, 0x26, 0xDA, 0xBF, 0xFA, 0x50, 0x00, 0x01, 0xED,
+    0xDF, 0xFA, 0x50, 0x00, 0x00, 0x7C, 0xFF, 0xFA, 0x50, 0x00, 0x00, 0x3A,
+    0xEF, 0xA7, 0x30, 0x00, 0x00, 0x06, 0x9A, 0x00, 0x00, 0x01, 0x6F, 0xC4,
+    0x00, 0x00, 0x00, 0x48, 0xF6, 0x20, 0x00, 0x00, 0x06, 0xAC, 0x21, 0x00,
+    0x00, 0x00, 0x9B, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x64,
+    0x48, 0x99, 0x95, 0x20, 0xFA, 0x89, 0xBB, 0xCC, 0xA5, 0x2F, 0xDD, 0xE7,
+    0x67, 0xAF, 0xA5, 0xFF, 0xB3, 0x00, 0x00, 0xCD, 0x9F, 0xD9, 0x10, 0x00,
+    0x0A, 0xD9, 0xFC, 0x70, 0x00, 0x00, 0x9D, 0xAF, 0xB6, 0x00, 0x00, 0x09,
+    0xDA, 0xFB, 0x60, 0x00, 0x00, 0x9D, 0xAF, 0xB6, 0x00, 0x00, 0x09, 0xDA,
+    0xFB, 0x60, 0x00, 0x00, 0x9D, 0xAF, 0xB6, 0x00, 0x00, 0x09, 0xDA, 0xFB,
+    0x60, 0x00, 0x00, 0x9D, 0xAF, 0xB6, 0x00, 0x00, 0x09, 0xDA, 0xA7, 0x40,
+    0x00, 0x00, 0x69, 0x70, 0xFE, 0x90, 0x00, 0x00, 0x05, 0xAF, 0xFF, 0xB5,
+    0x00, 0x00, 0x05, 0xAF, 0xFE, 0xC9, 0x00, 0x00, 0x05, 0xAF, 0xFD, 0xDE,
+    0x10, 0x00, 0x05, 0xAF, 0xFA, 0x9D, 0x83, 0x00, 0x05, 0xAF, 0xFA, 0x77,
+    0xD5, 0x10, 0x05, 0xAF, 0xFA, 0x63, 0xE8, 0x30, 0x05, 0xAF, 0xFA, 0x50,
+    0xBA, 0x70, 0x05, 0xAF, 0xFA, 0x50, 0x3B, 0xB3, 0x05, 0xAF, 0xFA, 0x50,
+    0x18, 0xB9, 0x05, 0xAF, 0xFA, 0x50, 0x05, 0x9D, 0x26, 0xAF, 0xFA, 0x50,
+    0x01, 0x6F, 0x56, 0xAF, 0xFA, 0x50, 0x00, 0x38, 0xD9, 0xAF, 0xFA, 0x50,
+    0x00, 0x13, 0xEC, 0xCF, 0xFA, 0x50, 0x00, 0x01, 0xCD, 0xEF, 0xFA, 0x50,
+    0x00, 0x00, 0x7C, 0xFF, 0xFA, 0x50, 0x00, 0x00, 0x09, 0xEF, 0x53, 0x20,
+    0x00, 0x00, 0x03, 0x55, 0x00, 0x00, 0x24, 0x30, 0x00, 0x00, 0x00, 0x00,
+    0x7B, 0x90, 0x00, 0x00, 0x00, 0x00, 0xA8, 0x50, 0x00, 0x00, 0x00, 0x00,
+    0xC6, 0x20, 0x00, 0x00, 0x00, 0x00, 0x93, 0x00, 0x00, 0x00, 0xF9, 0x66,
+    0xDE, 0xED, 0x83, 0x0F, 0xCB, 0xB9, 0x99, 0xBD, 0x73, 0xFE, 0xCA, 0x54,
+    0x57, 0xEB, 0x6F, 0xFB, 0x30, 0x00, 0x0C, 0xD9, 0xFD, 0x80, 0x00, 0x00,
+    0x9D, 0xAF, 0xC7, 0x00, 0x00, 0x09, 0xDA, 0xFB, 0x60, 0x00, 0x00, 0x9D,
+    0xAF, 0xB6, 0x00, 0x00, 0x09, 0xDA, 0xFB, 0x60, 0x00, 0x00, 0x9D, 0xAF,
+    0xB6, 0x00, 0x00, 0x09, 0xDA, 0xFB, 0x60, 0x00, 0x00, 0x9D, 0xAF, 0xB6,
+    0x00, 0x00, 0x09, 0xDA, 0xFB, 0x60, 0x00, 0x00, 0x9D, 0xA5, 0x42, 0x00,
+    0x00, 0x03, 0x43, 0x00, 0x00, 0x24, 0x30, 0x00, 0x00, 0x00, 0x07, 0xB9,
+    0x00, 0x00, 0x00, 0x00, 0xA8, 0x50, 0x00, 0x00, 0x00, 0x0C, 0x62, 0x00,
+    0x00, 0x00, 0x00, 0x93, 0x00, 0x00, 0x00, 0x00, 0x4C, 0x83, 0x38, 0xC4,
+    0x00, 0x00, 0x26, 0xC8, 0x8D, 0x62, 0x00, 0x00, 0x12, 0xDC, 0xCD, 0x21,
+    0x00, 0x00, 0x00, 0x9D, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xA9, 0x60, 0x00, 0x00, 0x03, 0x7A, 0xFE, 0xA3, 0x00, 0x00, 0x05,
+    0xAF, 0xFF, 0xC7, 0x00, 0x00, 0x05, 0xAF, 0xFD, 0xDE, 0x10, 0x00, 0x05,
+    0xAF, 0xFB, 0xAD, 0x62, 0x00, 0x05, 0xAF, 0xFA, 0x8A, 0xA4, 0x00, 0x05,
+    0xAF, 0xFA, 0x65, 0xF6, 0x10, 0x05, 0xAF, 0xFA, 0x50, 0xBA, 0x70, 0x05,
+    0xAF, 0xFA, 0x50, 0x6B, 0xA2, 0x05, 0xAF, 0xFA, 0x50, 0x2A, 0xB6, 0x05,
+    0xAF, 0xFA, 0x50, 0x07, 0xAC, 0x05, 0xAF, 0xFA, 0x50, 0x01, 0x6F, 0x56,
+    0xAF, 0xFA, 0x50, 0x00, 0x4A, 0xA8, 0xAF, 0xFA, 0x50, 0x00, 0x26, 0xDA,
+    0xBF, 0xFA, 0x50, 0x00, 0x01, 0xED, 0xDF, 0xFA, 0x50, 0x00, 0x00, 0x7C,
+    0xFF, 0xFA, 0x50, 0x00, 0x00, 0x3A, 0xEF, 0xA7, 0x30, 0x00, 0x00, 0x06,
+    0x9A, 0x00, 0x4C, 0x83, 0x38, 0xC4, 0x00, 0x02, 0x6C, 0x88, 0xD6, 0x20,
+    0x00, 0x12, 0xDC, 0xCD, 0x21, 0x00, 0x00, 0x09, 0xDD, 0x90, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0A, 0x64, 0x48, 0x99, 0x95, 0x20, 0xFA, 0x89,
+    0xBB, 0xCC, 0xA5, 0x2F, 0xDD, 0xE7, 0x67, 0xAF, 0xA5, 0xFF, 0xB3, 0x00,
+    0x00, 0xCD, 0x9F, 0xD9, 0x10, 0x00, 0x0A, 0xD9, 0xFC, 0x70, 0x00, 0x00,
+    0x9D, 0xAF, 0xB6, 0x00, 0x00, 0x09, 0xDA, 0xFB, 0x60, 0x00, 0x00, 0x9D,
+    0xAF, 0xB6, 0x00, 0x00, 0x09, 0xDA, 0xFB, 0x60, 0x00, 0x00, 0x9D, 0xAF,
+    0xB6, 0x00, 0x00, 0x09, 0xDA, 0xFB, 0x60, 0x00, 0x00, 0x9D, 0xAF, 0xB6,
+    0x00, 0x00, 0x09, 0xDA, 0xA7, 0x40, 0x00, 0x00, 0x69, 0x70, 0x1A, 0xED,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x6C, 0xB5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9C, 0xA1, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xD9, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x5A, 0x44,
+    0x58, 0xA9, 0x75, 0x00, 0x00, 0x5F, 0x88, 0x9B, 0xCC, 0xBA, 0x31, 0x00,
+    0x5F, 0xDD, 0xC7, 0x69, 0xCF, 0x72, 0x00, 0x5F, 0xF7, 0x20, 0x00, 0x4C,
+    0xD4, 0x00, 0x5F, 0xD5, 0x10, 0x00, 0x3A, 0xE5, 0x00, 0x5F, 0xB4, 0x00,
+    0x00, 0x39, 0xF5, 0x00, 0x5F, 0xA3, 0x00, 0x00, 0x39, 0xF5, 0x00, 0x5F,
+    0x93, 0x00, 0x00, 0x39, 0xF5, 0x00, 0x5F, 0x93, 0x00, 0x00, 0x39, 0xF5,
+    0x00, 0x5F, 0x93, 0x00, 0x00, 0x39, 0xF5, 0x00, 0x5F, 0x93, 0x00, 0x00,
+    0x39, 0xF5, 0x00, 0x5F, 0x93, 0x00, 0x00, 0x39, 0xF5, 0x00, 0x5F, 0x93,
+    0x00, 0x00, 0x39, 0xF5, 0x00, 0x3A, 0x62, 0x00, 0x00, 0x26, 0xA3, 0xFE,
+    0x91, 0x00, 0x00, 0x05, 0xAF, 0xFF, 0xB5, 0x00, 0x00, 0x05, 0xAF, 0xFE,
+    0xDA, 0x10, 0x00, 0x05, 0xAF, 0xFD, 0xDF, 0x21, 0x00, 0x05, 0xAF, 0xF9,
+    0x9C, 0xA3, 0x00, 0x05, 0xAF, 0xFA, 0x77, 0xD6, 0x20, 0x05, 0xAF, 0xFA,
+    0x63, 0xD9, 0x50, 0x05, 0xAF, 0xFA, 0x50, 0xAC, 0x90, 0x05, 0xAF, 0xFA,
+    0x50, 0x2A, 0xC7, 0x05, 0xAF, 0xFA, 0x50, 0x17, 0xBC, 0x15, 0xAF, 0xFA,
+    0x50, 0x04, 0x8E, 0x46, 0xAF, 0xFA, 0x50, 0x01, 0x5E, 0xA8, 0x9F, 0xFA,
+    0x50, 0x00, 0x26, 0xFB, 0xBF, 0xFA, 0x50, 0x00, 0x12, 0xDD, 0xEF, 0xFA,
+    0x50, 0x00, 0x00, 0x9D, 0xFF, 0xFA, 0x50, 0x00, 0x00, 0x4B, 0xFF, 0xFA,
+    0x50, 0x00, 0x00, 0x07, 0xCF, 0x53, 0x20, 0x00, 0x00, 0x06, 0xAD, 0x00,
+    0x00, 0x02, 0x32, 0x38, 0xBB, 0x00, 0x00, 0x06, 0x87, 0x9D, 0xC7, 0x00,
+    0x00, 0x09, 0xEF, 0xD9, 0x50, 0x00, 0x00, 0x03, 0x55, 0x43, 0x20, 0xF9,
+    0x66, 0xDE, 0xED, 0x83, 0x0F, 0xCB, 0xB9, 0x99, 0xBD, 0x84, 0xFE, 0xCA,
+    0x54, 0x57, 0xEB, 0x6F, 0xFB, 0x30, 0x00, 0x0C, 0xD9, 0xFD, 0x80, 0x00,
+    0x00, 0x9D, 0xAF, 0xC7, 0x00, 0x00, 0x09, 0xDA, 0xFB, 0x60, 0x00, 0x00,
+    0x9D, 0xAF, 0xB6, 0x00, 0x00, 0x09, 0xDA, 0xFB, 0x60, 0x00, 0x00, 0x9D,
+    0xAF, 0xB6, 0x00, 0x00, 0x09, 0xDA, 0xFB, 0x60, 0x00, 0x00, 0x9D, 0xAF,
+    0xB6, 0x00, 0x00, 0x09, 0xDA, 0xFB, 0x60, 0x00, 0x00, 0x9D, 0xA5, 0x42,
+    0x00, 0x00, 0x09, 0xDA, 0x00, 0x00, 0x00, 0x00, 0x9D, 0xA0, 0x00, 0x00,
+    0x00, 0x0A, 0xD9, 0x00, 0x00, 0x04, 0x76, 0xEC, 0x70, 0x00, 0x00, 0x8B,
+    0xCC, 0x73, 0x00, 0x00, 0x06, 0x9A, 0x73, 0x10, 0x00, 0x25, 0x55, 0x55,
+    0x52, 0x00, 0x00, 0x4C, 0xCC, 0xCC, 0xC4, 0x00, 0x00, 0x3A, 0xAA, 0xAA,
+    0xA3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xDE, 0xED,
+    0x83, 0x00, 0x05, 0x9D, 0xBA, 0xAB, 0xD9, 0x40, 0x29, 0xDD, 0x75, 0x57,
+    0xDC, 0x81, 0x5C, 0xD9, 0x00, 0x00, 0x8D, 0xB4, 0xAD, 0xB2, 0x00, 0x00,
+    0x1A, 0xD9, 0xCD, 0x91, 0x00, 0x00, 0x09, 0xDC, 0xDD, 0x80, 0x00, 0x00,
+    0x08, 0xDD, 0xED, 0x80, 0x00, 0x00, 0x08, 0xDE, 0xFC, 0x70, 0x00, 0x00,
+    0x07, 0xCF, 0xFD, 0x80, 0x00, 0x00, 0x08, 0xCE, 0xED, 0x80, 0x00, 0x00,
+    0x08, 0xDE, 0xDD, 0x90, 0x00, 0x00, 0x09, 0xDD, 0xAD, 0xB2, 0x00, 0x00,
+    0x2B, 0xD9, 0x7C, 0xC6, 0x00, 0x00, 0x6C, 0xC6, 0x3A, 0xDB, 0x33, 0x33,
+    0xBC, 0xA3, 0x07, 0xCF, 0xA8, 0x8A, 0xFB, 0x60, 0x00, 0x38, 0xDE, 0xED,
+    0x73, 0x00, 0x00, 0x13, 0x45, 0x54, 0x21, 0x00, 0x00, 0x25, 0x55, 0x55,
+    0x52, 0x00, 0x00, 0x4C, 0xCC, 0xCC, 0xC4, 0x00, 0x00, 0x3A, 0xAA, 0xAA,
+    0xA3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x38, 0xDE, 0xED,
+    0x83, 0x00, 0x06, 0xAC, 0xA9, 0x9A, 0xC9, 0x50, 0x3A, 0xCB, 0x54, 0x45,
+    0xBC, 0x93, 0x8D, 0xB4, 0x00, 0x00, 0x4B, 0xC7, 0xDD, 0x80, 0x00, 0x00,
+    0x09, 0xDC, 0xEC, 0x80, 0x00, 0x00, 0x08, 0xCE, 0xFC, 0x70, 0x00, 0x00,
+    0x07, 0xCE, 0xFC, 0x70, 0x00, 0x00, 0x07, 0xCE, 0xCD, 0x90, 0x00, 0x00,
+    0x09, 0xDC, 0x9C, 0xA3, 0x00, 0x00, 0x3A, 0xD9, 0x5B, 0xC8, 0x32, 0x23,
+    0x8C, 0xB5, 0x08, 0xDE, 0x86, 0x68, 0xED, 0x81, 0x01, 0x38, 0xDE, 0xED,
+    0x83, 0x10, 0x00, 0x13, 0x45, 0x54, 0x31, 0x00, 0x00, 0x5E, 0x10, 0x01,
+    0xE5, 0x00, 0x00, 0x4B, 0x64, 0x57, 0xB4, 0x00, 0x00, 0x27, 0xA9, 0x9B,
+    0x72, 0x00, 0x00, 0x12, 0xCD, 0xDB, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x25, 0x99, 0x99, 0x52, 0x00, 0x03, 0x6A, 0xCC, 0xCC,
+    0xA6, 0x20, 0x07, 0xCF, 0xA8, 0x8A, 0xFC, 0x70, 0x5C, 0xD9, 0x00, 0x00,
+    0x8D, 0xB4, 0x8D, 0xB4, 0x00, 0x00, 0x4B, 0xD8, 0xBD, 0xA1, 0x00, 0x00,
+    0x1A, 0xDA, 0xDD, 0x90, 0x00, 0x00, 0x09, 0xDD, 0xED, 0x80, 0x00, 0x00,
+    0x08, 0xDE, 0xFC, 0x80, 0x00, 0x00, 0x08, 0xCF, 0xFC, 0x80, 0x00, 0x00,
+    0x08, 0xCF, 0xED, 0x80, 0x00, 0x00, 0x08, 0xDE, 0xDD, 0x90, 0x00, 0x00,
+    0x09, 0xDD, 0xBD, 0xA1, 0x00, 0x00, 0x1A, 0xDA, 0x8D, 0xB4, 0x00, 0x00,
+    0x4B, 0xD8, 0x5C, 0xD9, 0x00, 0x00, 0x8D, 0xB4, 0x07, 0xCF, 0xA8, 0x8A,
+    0xFB, 0x60, 0x03, 0x6A, 0xCC, 0xCC, 0xA6, 0x20, 0x00, 0x25, 0x99, 0x99,
+    0x52, 0x00, 0x00, 0x5E, 0x10, 0x01, 0xE5, 0x00, 0x00, 0x4B, 0x64, 0x57,
+    0xB4, 0x00, 0x00, 0x27, 0xA9, 0x9B, 0x72, 0x00, 0x00, 0x12, 0xCD, 0xDB,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x99, 0x99,
+    0x52, 0x00, 0x03, 0x7A, 0xBC, 0xCB, 0xA6, 0x30, 0x19, 0xDE, 0x86, 0x68,
+    0xED, 0x80, 0x8D, 0xB4, 0x00, 0x00, 0x4B, 0xC7, 0xBD, 0x91, 0x00, 0x00,
+    0x19, 0xDB, 0xDC, 0x80, 0x00, 0x00, 0x08, 0xCD, 0xFC, 0x70, 0x00, 0x00,
+    0x07, 0xCE, 0xFC, 0x70, 0x00, 0x00, 0x07, 0xCE, 0xDC, 0x80, 0x00, 0x00,
+    0x08, 0xCD, 0xBD, 0x91, 0x00, 0x00, 0x19, 0xDB, 0x7C, 0xB4, 0x00, 0x00,
+    0x4B, 0xC7, 0x08, 0xDE, 0x86, 0x68, 0xED, 0x81, 0x03, 0x6A, 0xCC, 0xCB,
+    0xA7, 0x30, 0x00, 0x25, 0x99, 0x99, 0x62, 0x00, 0x00, 0x12, 0xFD, 0x82,
+    0xFD, 0x80, 0x00, 0x25, 0xF9, 0x65, 0xF9, 0x40, 0x00, 0x39, 0xB5, 0x49,
+    0xB5, 0x10, 0x00, 0x4D, 0x52, 0x4D, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x25, 0x99, 0x99, 0x52, 0x00, 0x03, 0x6A, 0xCC, 0xCC,
+    0xA6, 0x20, 0x07, 0xCF, 0xA8, 0x8A, 0xFC, 0x70, 0x5C, 0xD9, 0x00, 0x00,
+    0x8D, 0xB4, 0x8D, 0xB4, 0x00, 0x00, 0x4B, 0xD8, 0xBD, 0xA1, 0x00, 0x00,
+    0x1A, 0xDA, 0xDD, 0x90, 0x00, 0x00, 0x09, 0xDD, 0xED, 0x80, 0x00, 0x00,
+    0x08, 0xDE, 0xFC, 0x80, 0x00, 0x00, 0x08, 0xCF, 0xFC, 0x80, 0x00, 0x00,
+    0x08, 0xCF, 0xED, 0x80, 0x00, 0x00, 0x08, 0xDE, 0xDD, 0x90, 0x00, 0x00,
+    0x09, 0xDD, 0xBD, 0xA1, 0x00, 0x00, 0x1A, 0xDA, 0x8D, 0xB4, 0x00, 0x00,
+    0x4B, 0xD8, 0x5C, 0xD9, 0x00, 0x00, 0x8D, 0xB4, 0x07, 0xCF, 0xA8, 0x8A,
+    0xFB, 0x60, 0x03, 0x6A, 0xCC, 0xCC, 0xA6, 0x20, 0x00, 0x25, 0x99, 0x99,
+    0x52, 0x00, 0x00, 0x12, 0xFD, 0x82, 0xFD, 0x80, 0x00, 0x25, 0xF9, 0x65,
+    0xF9, 0x40, 0x00, 0x39, 0xB5, 0x49, 0xB5, 0x10, 0x00, 0x4D, 0x52, 0x4D,
+    0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x99, 0x99,
+    0x52, 0x00, 0x03, 0x7A, 0xBC, 0xCB, 0xA6, 0x30, 0x19, 0xDE, 0x86, 0x68,
+    0xED, 0x80, 0x8D, 0xB4, 0x00, 0x00, 0x4B, 0xC7, 0xBD, 0x91, 0x00, 0x00,
+    0x19, 0xDB, 0xDC, 0x80, 0x00, 0x00, 0x08, 0xCD, 0xFC, 0x70, 0x00, 0x00,
+    0x07, 0xCE, 0xFC, 0x70, 0x00, 0x00, 0x07, 0xCE, 0xDC, 0x80, 0x00, 0x00,
+    0x08, 0xCD, 0xBD, 0x91, 0x00, 0x00, 0x19, 0xDB, 0x7C, 0xB4, 0x00, 0x00,
+    0x4B, 0xC7, 0x08, 0xDE, 0x86, 0x68, 0xED, 0x81, 0x03, 0x6A, 0xCC, 0xCB,
+    0xA7, 0x30, 0x00, 0x25, 0x99, 0x99, 0x62, 0x00, 0x01, 0x49, 0xEF, 0xFF,
+    0xFF, 0xFF, 0xF5, 0x06, 0xAD, 0xAA, 0xCF, 0xDB, 0x99, 0x93, 0x29, 0xCB,
+    0x55, 0x9F, 0xB7, 0x44, 0x41, 0x5C, 0xC5, 0x00, 0x5F, 0xA3, 0x00, 0x00,
+    0xAD, 0xA0, 0x00, 0x5F, 0xA3, 0x00, 0x00, 0xCC, 0x80, 0x00, 0x5F, 0xA3,
+    0x00, 0x00, 0xEC, 0x70, 0x00, 0x5F, 0xB7, 0x55, 0x52, 0xEC, 0x70, 0x00,
+    0x5F, 0xFF, 0xFF, 0xF5, 0xFB, 0x60, 0x00, 0x5F, 0xC8, 0x77, 0x72, 0xFC,
+    0x70, 0x00, 0x5F, 0xA5, 0x22, 0x21, 0xEC, 0x70, 0x00, 0x5F, 0xA3, 0x00,
+    0x00, 0xDC, 0x80, 0x00, 0x5F, 0xA3, 0x00, 0x00, 0xAD, 0xA0, 0x00, 0x5F,
+    0xA3, 0x00, 0x00, 0x7C, 0xB4, 0x00, 0x5F, 0xA3, 0x00, 0x00, 0x4B, 0xC8,
+    0x33, 0x7F, 0xA5, 0x22, 0x21, 0x09, 0xDE, 0x88, 0xAF, 0xC8, 0x77, 0x72,
+    0x01, 0x4A, 0xEF, 0xFF, 0xFF, 0xFF, 0xF5, 0x00, 0x13, 0x55, 0x55, 0x55,
+    0x55, 0x52, 0x04, 0x8D, 0xEB, 0x60, 0x4A, 0xDE, 0x83, 0x02, 0x9C, 0xB9,
+    0xBA, 0x6B, 0xAA, 0xAD, 0x72, 0x6C, 0xC7, 0x49, 0xBB, 0xE9, 0x65, 0xE9,
+    0x5A, 0xC9, 0x00, 0x49, 0xFD, 0x40, 0x0B, 0xB8, 0xDB, 0x70, 0x01, 0x6F,
+    0xA3, 0x00, 0x9C, 0x9E, 0xB6, 0x00, 0x16, 0xFD, 0xBA, 0xAD, 0xEA, 0xFB,
+    0x60, 0x00, 0x5F, 0xEC, 0xCC, 0xCC, 0x8E, 0xB6, 0x00, 0x05, 0xFB, 0x75,
+    0x55, 0x53, 0xDB, 0x70, 0x01, 0x6F, 0xB4, 0x00, 0x00, 0x0A, 0xC8, 0x00,
+    0x38, 0xFD, 0x50, 0x00, 0x00, 0x7C, 0xB4, 0x26, 0xAD, 0xE8, 0x42, 0x33,
+    0x23, 0xBD, 0xA6, 0xBC, 0x9E, 0xCA, 0x79, 0x86, 0x03, 0x8D, 0xEB, 0x60,
+    0x39, 0xDE, 0xC7, 0x30, 0x13, 0x45, 0x42, 0x01, 0x34, 0x54, 0x21, 0x00,
+    0x00, 0x01, 0x6F, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xF6, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x06, 0xAC, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x9B, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0xAA, 0xAA, 0xA9, 0x96, 0x31, 0x00, 0x00, 0xFE, 0xDC, 0xCC, 0xCC,
+    0xB8, 0x51, 0x00, 0x0F, 0xDA, 0x66, 0x68, 0x9E, 0xFB, 0x40, 0x00, 0xFB,
+    0x60, 0x00, 0x00, 0x2B, 0xEC, 0x00, 0x0F, 0xB6, 0x00, 0x00, 0x01, 0x9D,
+    0xE0, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x08, 0xDE, 0x00, 0x0F, 0xB6, 0x00,
+    0x00, 0x00, 0x9D, 0xC0, 0x00, 0xFB, 0x60, 0x01, 0x23, 0xBE, 0xB5, 0x00,
+    0x0F, 0xEC, 0xAA, 0xAB, 0xBB, 0x85, 0x20, 0x00, 0xFE, 0xDC, 0xCD, 0xEF,
+    0x94, 0x10, 0x00, 0x0F, 0xDA, 0x66, 0x9C, 0xF5, 0x20, 0x00, 0x00, 0xFB,
+    0x60, 0x01, 0x5D, 0xE6, 0x10, 0x00, 0x0F, 0xB6, 0x00, 0x02, 0x7E, 0xA5,
+    0x00, 0x00, 0xFB, 0x60, 0x00, 0x12, 0xCC, 0x92, 0x00, 0x0F, 0xB6, 0x00,
+    0x00, 0x07, 0xCC, 0x70, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x07, 0xCF, 0x31,
+    0x0F, 0xB6, 0x00, 0x00, 0x00, 0x37, 0xE9, 0x30, 0xA8, 0x40, 0x00, 0x00,
+    0x00, 0x39, 0x83, 0x00, 0x00, 0x00, 0x2A, 0xEC, 0x00, 0x00, 0x00, 0x5C,
+    0xC6, 0x00, 0x00, 0x00, 0x9B, 0x92, 0x00, 0x00, 0x00, 0xD9, 0x50, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xA6, 0x32, 0x79, 0xA9, 0x72, 0xF9, 0x66,
+    0xAB, 0xCC, 0xA3, 0xFB, 0xAD, 0x86, 0x67, 0x83, 0xFF, 0xB3, 0x00, 0x00,
+    0x00, 0xFD, 0x91, 0x00, 0x00, 0x00, 0xFC, 0x70, 0x00, 0x00, 0x00, 0xFB,
+    0x60, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00,
+    0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00,
+    0xFB, 0x60, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0xA7, 0x40,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xED, 0x95, 0x20, 0x00, 0x0F, 0xEC,
+    0x99, 0x9A, 0xAD, 0xB8, 0x30, 0x00, 0xFC, 0x94, 0x44, 0x56, 0xAD, 0xC7,
+    0x00, 0x0F, 0xB6, 0x00, 0x00, 0x02, 0xBE, 0xC0, 0x00, 0xFB, 0x60, 0x00,
+    0x00, 0x08, 0xDF, 0x00, 0x0F, 0xB6, 0x00, 0x00, 0x00, 0x9D, 0xD0, 0x00,
+    0xFB, 0x60, 0x00, 0x11, 0x4B, 0xDA, 0x00, 0x0F, 0xB6, 0x00, 0x12, 0x3B,
+    0xEB, 0x50, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xB6, 0x20, 0x00, 0x0F, 0xEC,
+    0x99, 0xBD, 0xF7, 0x31, 0x00, 0x00, 0xFC, 0x94, 0x46, 0xAE, 0x83, 0x00,
+    0x00, 0x0F, 0xB6, 0x00, 0x15, 0xDE, 0x61, 0x00, 0x00, 0xFB, 0x60, 0x00,
+    0x13, 0xFC, 0x70, 0x00, 0x0F, 0xB6, 0x00, 0x00, 0x19, 0xCB, 0x50, 0x00,
+    0xFB, 0x60, 0x00, 0x00, 0x4A, 0xC9, 0x10, 0x0F, 0xB6, 0x00, 0x00, 0x00,
+    0x7C, 0xF3, 0x10, 0xFB, 0x60, 0x00, 0x00, 0x01, 0x5D, 0xD5, 0x05, 0x42,
+    0x00, 0x00, 0x00, 0x02, 0x44, 0x20, 0x00, 0x00, 0x02, 0x35, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x59, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
+    0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0x30, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x06, 0x61, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x43, 0xBD, 0xEE,
+    0xA3, 0xFA, 0x8A, 0x99, 0x9A, 0x93, 0xFC, 0xAA, 0x54, 0x45, 0x52, 0xFF,
+    0xB3, 0x00, 0x00, 0x00, 0xFD, 0x80, 0x00, 0x00, 0x00, 0xFC, 0x70, 0x00,
+    0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00,
+    0xFB, 0x60, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0xFB, 0x60,
+    0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00,
+    0x00, 0x54, 0x20, 0x00, 0x00, 0x00, 0x24, 0x30, 0x00, 0x00, 0x00, 0x7B,
+    0x90, 0x00, 0x00, 0x00, 0xA8, 0x50, 0x00, 0x00, 0x00, 0xC6, 0x20, 0x00,
+    0x00, 0x00, 0x93, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4C, 0x83, 0x38, 0xC4,
+    0x00, 0x00, 0x00, 0x02, 0x6C, 0x88, 0xD6, 0x20, 0x00, 0x00, 0x00, 0x12,
+    0xDC, 0xCD, 0x21, 0x00, 0x00, 0x00, 0x00, 0x09, 0xDD, 0x90, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xAA, 0xAA, 0xA9,
+    0x96, 0x31, 0x00, 0x00, 0xFE, 0xDC, 0xCC, 0xCC, 0xB8, 0x51, 0x00, 0x0F,
+    0xDA, 0x66, 0x68, 0x9E, 0xFB, 0x40, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x2B,
+    0xEC, 0x00, 0x0F, 0xB6, 0x00, 0x00, 0x01, 0x9D, 0xE0, 0x00, 0xFB, 0x60,
+    0x00, 0x00, 0x08, 0xDE, 0x00, 0x0F, 0xB6, 0x00, 0x00, 0x00, 0x9D, 0xC0,
+    0x00, 0xFB, 0x60, 0x01, 0x23, 0xBE, 0xB5, 0x00, 0x0F, 0xEC, 0xAA, 0xAB,
+    0xBB, 0x85, 0x20, 0x00, 0xFE, 0xDC, 0xCD, 0xEF, 0x94, 0x10, 0x00, 0x0F,
+    0xDA, 0x66, 0x9C, 0xF5, 0x20, 0x00, 0x00, 0xFB, 0x60, 0x01, 0x5D, 0xE6,
+    0x10, 0x00, 0x0F, 0xB6, 0x00, 0x02, 0x7E, 0xA5, 0x00, 0x00, 0xFB, 0x60,
+    0x00, 0x12, 0xCC, 0x92, 0x00, 0x0F, 0xB6, 0x00, 0x00, 0x07, 0xCC, 0x70,
+    0x00, 0xFB, 0x60, 0x00, 0x00, 0x07, 0xCF, 0x31, 0x0F, 0xB6, 0x00, 0x00,
+    0x00, 0x37, 0xE9, 0x30, 0xA8, 0x40, 0x00, 0x00, 0x00, 0x39, 0x83, 0x00,
+    0x08, 0xB8, 0x05, 0x9C, 0x00, 0x04, 0x8C, 0x6A, 0xA6, 0x00, 0x01, 0x6D,
+    0xBC, 0x92, 0x00, 0x00, 0x39, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xA6, 0x32, 0x79, 0xA9, 0x72, 0xF9, 0x66, 0xAB, 0xCC, 0xA3, 0xFB,
+    0xAD, 0x86, 0x67, 0x83, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0xFD, 0x91, 0x00,
+    0x00, 0x00, 0xFC, 0x70, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00,
+    0xFB, 0x60, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0xFB, 0x60,
+    0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00,
+    0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0xA7, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x6F, 0xC4, 0x00, 0x00, 0x00, 0x04, 0x8F, 0x62, 0x00, 0x00,
+    0x00, 0x06, 0xAC, 0x21, 0x00, 0x00, 0x00, 0x09, 0xB7, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x46, 0x99, 0xA9, 0x98, 0x64, 0x25,
+    0x8B, 0xBC, 0xCC, 0xCC, 0xA7, 0x6C, 0xED, 0x87, 0x78, 0xAC, 0xC9, 0xDD,
+    0x91, 0x00, 0x00, 0x00, 0x00, 0xEC, 0x80, 0x00, 0x00, 0x00, 0x00, 0xDC,
+    0x81, 0x00, 0x00, 0x00, 0x00, 0xBD, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x2A,
+    0xEF, 0xB7, 0x41, 0x00, 0x00, 0x14, 0x7A, 0xCC, 0xBA, 0x63, 0x10, 0x00,
+    0x25, 0x9A, 0xCD, 0xB8, 0x51, 0x00, 0x00, 0x02, 0x59, 0xEF, 0xB4, 0x00,
+    0x00, 0x00, 0x00, 0x2A, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x18, 0xCE, 0x00,
+    0x00, 0x00, 0x00, 0x08, 0xCE, 0x10, 0x00, 0x00, 0x00, 0x19, 0xDC, 0xFC,
+    0xA8, 0x77, 0x78, 0xEE, 0xB4, 0xBB, 0xCC, 0xCC, 0xCC, 0xB8, 0x51, 0x67,
+    0x99, 0xAA, 0x99, 0x63, 0x10, 0x00, 0x00, 0x2A, 0xEC, 0x00, 0x00, 0x00,
+    0x5C, 0xC6, 0x00, 0x00, 0x00, 0x9B, 0x92, 0x00, 0x00, 0x00, 0xD9, 0x50,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x69, 0xA9, 0x98, 0x52, 0x48,
+    0xAB, 0xBB, 0xBB, 0x83, 0xAD, 0xC7, 0x56, 0x8A, 0x93, 0xEB, 0x60, 0x00,
+    0x00, 0x00, 0xCD, 0xA4, 0x00, 0x00, 0x00, 0x8C, 0xC9, 0x53, 0x21, 0x00,
+    0x28, 0xDF, 0xEA, 0x62, 0x00, 0x00, 0x14, 0xAD, 0xFE, 0x41, 0x00, 0x01,
+    0x35, 0x9D, 0xA3, 0x00, 0x00, 0x01, 0x5C, 0xD4, 0x00, 0x00, 0x00, 0x3A,
+    0xE5, 0xDA, 0x86, 0x57, 0xAF, 0x93, 0xAB, 0xCC, 0xBB, 0xBA, 0x31, 0x68,
+    0x9A, 0xA9, 0x75, 0x00, 0x00, 0x00, 0x9D, 0xD9, 0x00, 0x00, 0x00, 0x12,
+    0xDC, 0xCD, 0x21, 0x00, 0x00, 0x26, 0xC8, 0x8D, 0x62, 0x00, 0x00, 0x4C,
+    0x83, 0x38, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x46,
+    0x99, 0xA9, 0x98, 0x64, 0x25, 0x8B, 0xBC, 0xCC, 0xCC, 0xA7, 0x6C, 0xED,
+    0x87, 0x78, 0xAC, 0xC9, 0xDD, 0x91, 0x00, 0x00, 0x00, 0x00, 0xEC, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0xDC, 0x81, 0x00, 0x00, 0x00, 0x00, 0xBD, 0xB4,
+    0x00, 0x00, 0x00, 0x00, 0x2A, 0xEF, 0xB7, 0x41, 0x00, 0x00, 0x14, 0x7A,
+    0xCC, 0xBA, 0x63, 0x10, 0x00, 0x25, 0x9A, 0xCD, 0xB8, 0x51, 0x00, 0x00,
+    0x02, 0x59, 0xEF, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xDC, 0x00, 0x00,
+    0x00, 0x00, 0x18, 0xCE, 0x00, 0x00, 0x00, 0x00, 0x08, 0xCE, 0x10, 0x00,
+    0x00, 0x00, 0x19, 0xDC, 0xFC, 0xA8, 0x77, 0x78, 0xEE, 0xB4, 0xBB, 0xCC,
+    0xCC, 0xCC, 0xB8, 0x51, 0x67, 0x99, 0xAA, 0x99, 0x63, 0x10, 0x00, 0x39,
+    0xFB, 0x60, 0x00, 0x01, 0x6D, 0xBC, 0x92, 0x00, 0x04, 0x8C, 0x6A, 0xA6,
+    0x00, 0x08, 0xB8, 0x05, 0x9C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+    0x69, 0xA9, 0x98, 0x52, 0x48, 0xAB, 0xBB, 0xBB, 0x83, 0xAD, 0xC7, 0x56,
+    0x8A, 0x93, 0xEB, 0x60, 0x00, 0x00, 0x00, 0xCD, 0xA4, 0x00, 0x00, 0x00,
+    0x8C, 0xC9, 0x53, 0x21, 0x00, 0x28, 0xDF, 0xEA, 0x62, 0x00, 0x00, 0x14,
+    0xAD, 0xFE, 0x41, 0x00, 0x01, 0x35, 0x9D, 0xA3, 0x00, 0x00, 0x01, 0x5C,
+    0xD4, 0x00, 0x00, 0x00, 0x3A, 0xE5, 0xDA, 0x86, 0x57, 0xAF, 0x93, 0xAB,
+    0xCC, 0xBB, 0xBA, 0x31, 0x68, 0x9A, 0xA9, 0x75, 0x00, 0x02, 0x5A, 0xDE,
+    0xEE, 0xDB, 0x96, 0x49, 0xBC, 0xAA, 0xAA, 0xBC, 0xB8, 0x8C, 0xC9, 0x65,
+    0x55, 0x68, 0x86, 0xDD, 0x91, 0x00, 0x00, 0x00, 0x00, 0xEC, 0x70, 0x00,
+    0x00, 0x00, 0x00, 0xCD, 0xA3, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xC7, 0x42,
+    0x10, 0x00, 0x00, 0x2A, 0xEF, 0xB7, 0x41, 0x00, 0x00, 0x01, 0x37, 0xDE,
+    0xFE, 0xA5, 0x20, 0x00, 0x12, 0x46, 0x8B, 0xDB, 0x83, 0x00, 0x00, 0x01,
+    0x36, 0xAD, 0xC7, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xDC, 0x00, 0x00, 0x00,
+    0x00, 0x07, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x19, 0xDD, 0x54, 0x33, 0x22,
+    0x23, 0x5B, 0xC9, 0xFC, 0xA8, 0x77, 0x78, 0xEE, 0xB4, 0x9B, 0xDE, 0xFF,
+    0xED, 0x95, 0x20, 0x34, 0x45, 0x6A, 0xA4, 0x32, 0x10, 0x00, 0x00, 0x29,
+    0x93, 0x00, 0x00, 0x00, 0x00, 0x3A, 0xB9, 0x00, 0x00, 0x00, 0x00, 0x04,
+    0x8C, 0x00, 0x00, 0x00, 0x00, 0xA9, 0x85, 0x00, 0x00, 0x00, 0x00, 0xA8,
+    0x51, 0x00, 0x00, 0x16, 0xAD, 0xFE, 0xDC, 0x72, 0x7A, 0xB9, 0x89, 0x9B,
+    0x83, 0xCC, 0xA5, 0x44, 0x57, 0x62, 0xEB, 0x60, 0x00, 0x00, 0x00, 0xCD,
+    0xB6, 0x00, 0x00, 0x00, 0x5A, 0xCC, 0x97, 0x41, 0x00, 0x16, 0x9B, 0xCB,
+    0x96, 0x10, 0x00, 0x14, 0xAD, 0xFE, 0x41, 0x00, 0x00, 0x01, 0x5D, 0xD4,
+    0x00, 0x00, 0x00, 0x4B, 0xE5, 0x43, 0x32, 0x22, 0x6B, 0xC4, 0xDA, 0x86,
+    0x57, 0xAF, 0x93, 0x9C, 0xEF, 0xED, 0xB7, 0x00, 0x34, 0x56, 0xD7, 0x42,
+    0x00, 0x00, 0x12, 0xC6, 0x20, 0x00, 0x00, 0x13, 0xDA, 0x60, 0x00, 0x00,
+    0x00, 0x6A, 0x80, 0x00, 0x00, 0x3A, 0x96, 0x30, 0x00, 0x00, 0x3A, 0x73,
+    0x10, 0x00, 0x00, 0x4C, 0x83, 0x38, 0xC4, 0x00, 0x00, 0x26, 0xC8, 0x8D,
+    0x62, 0x00, 0x00, 0x12, 0xDC, 0xCD, 0x21, 0x00, 0x00, 0x00, 0x9D, 0xD9,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x46, 0x99, 0xA9,
+    0x98, 0x64, 0x25, 0x8B, 0xBC, 0xCC, 0xCC, 0xA7, 0x6C, 0xED, 0x87, 0x78,
+    0xAC, 0xC9, 0xDD, 0x91, 0x00, 0x00, 0x00, 0x00, 0xEC, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0xDC, 0x81, 0x00, 0x00, 0x00, 0x00, 0xBD, 0xB4, 0x00, 0x00,
+    0x00, 0x00, 0x2A, 0xEF, 0xB7, 0x41, 0x00, 0x00, 0x14, 0x7A, 0xCC, 0xBA,
+    0x63, 0x10, 0x00, 0x25, 0x9A, 0xCD, 0xB8, 0x51, 0x00, 0x00, 0x02, 0x59,
+    0xEF, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xDC, 0x00, 0x00, 0x00, 0x00,
+    0x18, 0xCE, 0x00, 0x00, 0x00, 0x00, 0x08, 0xCE, 0x10, 0x00, 0x00, 0x00,
+    0x19, 0xDC, 0xFC, 0xA8, 0x77, 0x78, 0xEE, 0xB4, 0xBB, 0xCC, 0xCC, 0xCC,
+    0xB8, 0x51, 0x67, 0x99, 0xAA, 0x99, 0x63, 0x10, 0x08, 0xB8, 0x05, 0x9C,
+    0x00, 0x04, 0x8C, 0x6A, 0xA6, 0x00, 0x01, 0x6D, 0xBC, 0x92, 0x00, 0x00,
+    0x39, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x69, 0xA9,
+    0x98, 0x52, 0x48, 0xAB, 0xBB, 0xBB, 0x83, 0xAD, 0xC7, 0x56, 0x8A, 0x93,
+    0xEB, 0x60, 0x00, 0x00, 0x00, 0xCD, 0xA4, 0x00, 0x00, 0x00, 0x8C, 0xC9,
+    0x53, 0x21, 0x00, 0x28, 0xDF, 0xEA, 0x62, 0x00, 0x00, 0x14, 0xAD, 0xFE,
+    0x41, 0x00, 0x01, 0x35, 0x9D, 0xA3, 0x00, 0x00, 0x01, 0x5C, 0xD4, 0x00,
+    0x00, 0x00, 0x3A, 0xE5, 0xDA, 0x86, 0x57, 0xAF, 0x93, 0xAB, 0xCC, 0xBB,
+    0xBA, 0x31, 0x68, 0x9A, 0xA9, 0x75, 0x00, 0x9D, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xF5, 0x68, 0x99, 0x9C, 0xEF, 0x99, 0x99, 0x93, 0x34, 0x44, 0x49,
+    0xCF, 0x54, 0x44, 0x41, 0x00, 0x00, 0x06, 0xBF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x06, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x06, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x06, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x06, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
+    0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x06, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x7D, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x5C, 0x31, 0x00, 0x00, 0x00, 0x00, 0x02, 0x7D,
+    0x93, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0xC4, 0x00, 0x00, 0x00, 0x00,
+    0x06, 0x99, 0x52, 0x00, 0x00, 0x00, 0x00, 0x06, 0x97, 0x10, 0x00, 0x00,
+    0x00, 0x13, 0x52, 0x00, 0x00, 0x00, 0x27, 0x83, 0x00, 0x00, 0x00, 0x4B,
+    0x93, 0x00, 0x00, 0x00, 0x4D, 0x93, 0x00, 0x00, 0xBD, 0xEF, 0xFF, 0xFF,
+    0xF5, 0x67, 0xAF, 0xC9, 0x88, 0x83, 0x33, 0x7F, 0xA5, 0x33, 0x31, 0x00,
+    0x5F, 0x93, 0x00, 0x00, 0x00, 0x5F, 0x93, 0x00, 0x00, 0x00, 0x5F, 0x93,
+    0x00, 0x00, 0x00, 0x5F, 0x93, 0x00, 0x00, 0x00, 0x5F, 0x93, 0x00, 0x00,
+    0x00, 0x5F, 0x93, 0x00, 0x00, 0x00, 0x5E, 0xA3, 0x00, 0x00, 0x00, 0x4D,
+    0xC5, 0x22, 0x21, 0x00, 0x3A, 0xFA, 0x75, 0x62, 0x00, 0x01, 0xAD, 0xEE,
+    0xC4, 0x00, 0x00, 0x4A, 0xA5, 0x41, 0x00, 0x00, 0x29, 0x93, 0x00, 0x00,
+    0x00, 0x3A, 0xB9, 0x00, 0x00, 0x00, 0x04, 0x8C, 0x00, 0x00, 0x00, 0xA9,
+    0x85, 0x00, 0x00, 0x00, 0xA8, 0x51, 0x00, 0x00, 0x00, 0xC9, 0x50, 0x8B,
+    0x80, 0x00, 0x00, 0x00, 0x6A, 0xA6, 0xD8, 0x40, 0x00, 0x00, 0x00, 0x29,
+    0xCB, 0xD6, 0x10, 0x00, 0x00, 0x00, 0x06, 0xBF, 0x93, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xA3, 0x8B, 0xCC, 0xCD, 0xEF, 0xCC, 0xCC, 0xC4, 0x46, 0x77, 0x7A, 0xDF,
+    0x77, 0x77, 0x72, 0x00, 0x00, 0x06, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x06, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x06, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
+    0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x06, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x06, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x06, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x8A, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x8C, 0x90, 0x01, 0x23, 0x10, 0x0A, 0xA6, 0x00,
+    0x25, 0x62, 0x00, 0xC8, 0x40, 0x03, 0x99, 0x30, 0x0D, 0x51, 0x00, 0x4D,
+    0x93, 0x00, 0x00, 0x07, 0x9B, 0xED, 0xBA, 0xAA, 0x30, 0x8A, 0xCF, 0xDC,
+    0xBB, 0xB4, 0x04, 0x48, 0xFA, 0x64, 0x44, 0x10, 0x00, 0x5F, 0x93, 0x00,
+    0x00, 0x00, 0x05, 0xF9, 0x30, 0x00, 0x00, 0x00, 0x5F, 0x93, 0x00, 0x00,
+    0x00, 0x05, 0xF9, 0x30, 0x00, 0x00, 0x00, 0x5F, 0x93, 0x00, 0x00, 0x00,
+    0x05, 0xF9, 0x30, 0x00, 0x00, 0x00, 0x5F, 0x93, 0x00, 0x00, 0x00, 0x05,
+    0xEA, 0x30, 0x00, 0x00, 0x00, 0x3A, 0xFA, 0x75, 0x62, 0x00, 0x01, 0x4C,
+    0xCC, 0xBA, 0x30, 0x00, 0x01, 0x78, 0x9A, 0x83, 0x00, 0x9D, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xF5, 0x68, 0x99, 0x9C, 0xEF, 0x99, 0x99, 0x93, 0x34,
+    0x44, 0x49, 0xCF, 0x54, 0x44, 0x41, 0x00, 0x00, 0x06, 0xBF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x06, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x06, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0x00, 0x39, 0x9B, 0xDF, 0x99, 0x99, 0x00, 0x00, 0x14, 0x49, 0xCF, 0x44,
+    0x44, 0x00, 0x00, 0x00, 0x06, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
+    0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x06, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x06, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x45,
+    0x00, 0x00, 0x00, 0x00, 0x13, 0x52, 0x00, 0x00, 0x00, 0x27, 0x83, 0x00,
+    0x00, 0x00, 0x4B, 0x93, 0x00, 0x00, 0x00, 0x4D, 0x93, 0x00, 0x00, 0xBD,
+    0xEF, 0xFF, 0xFF, 0xF5, 0x67, 0xAF, 0xC9, 0x88, 0x83, 0x33, 0x7F, 0xA5,
+    0x33, 0x31, 0x00, 0x5F, 0x93, 0x00, 0x00, 0x3B, 0xFF, 0xFF, 0xFF, 0x00,
+    0x26, 0xAF, 0xC9, 0x77, 0x00, 0x12, 0x7F, 0xA5, 0x22, 0x00, 0x00, 0x5F,
+    0x93, 0x00, 0x00, 0x00, 0x5F, 0x93, 0x00, 0x00, 0x00, 0x5E, 0xA3, 0x00,
+    0x00, 0x00, 0x4C, 0xC6, 0x22, 0x21, 0x00, 0x39, 0xFA, 0x75, 0x62, 0x00,
+    0x01, 0xAD, 0xEE, 0xC4, 0x00, 0x00, 0x34, 0x55, 0x41, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x48, 0x95, 0x20, 0x16, 0x60, 0x03, 0x7B, 0xB9,
+    0x63, 0x49, 0x80, 0x07, 0xA9, 0x8D, 0xD9, 0x9A, 0x70, 0x09, 0x91, 0x03,
+    0x7D, 0xD6, 0x20, 0x03, 0x30, 0x01, 0x24, 0x42, 0x10, 0x54, 0x20, 0x00,
+    0x00, 0x02, 0x45, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00,
+    0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00,
+    0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00,
+    0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00,
+    0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00,
+    0x00, 0x06, 0xBF, 0xFC, 0x70, 0x00, 0x00, 0x07, 0xCF, 0xEC, 0x70, 0x00,
+    0x00, 0x07, 0xCE, 0xDD, 0x80, 0x00, 0x00, 0x08, 0xDD, 0xAD, 0xB4, 0x00,
+    0x00, 0x5C, 0xD9, 0x5B, 0xDB, 0x65, 0x56, 0xBD, 0xB4, 0x28, 0xBD, 0xBA,
+    0xAB, 0xDB, 0x71, 0x02, 0x5A, 0xEE, 0xEE, 0xA5, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x14, 0x89, 0x52, 0x01, 0x66, 0x03, 0x7B, 0xB9, 0x63,
+    0x49, 0x80, 0x7A, 0x98, 0xDD, 0x99, 0xA7, 0x09, 0x91, 0x03, 0x7D, 0xD6,
+    0x20, 0x33, 0x00, 0x12, 0x44, 0x21, 0x54, 0x20, 0x00, 0x00, 0x34, 0x3F,
+    0xB6, 0x00, 0x00, 0x09, 0xDA, 0xFB, 0x60, 0x00, 0x00, 0x9D, 0xAF, 0xB6,
+    0x00, 0x00, 0x09, 0xDA, 0xFB, 0x60, 0x00, 0x00, 0x9D, 0xAF, 0xB6, 0x00,
+    0x00, 0x09, 0xDA, 0xFB, 0x60, 0x00, 0x00, 0x9D, 0xAF, 0xB6, 0x00, 0x00,
+    0x09, 0xDA, 0xFB, 0x60, 0x00, 0x00, 0xAD, 0xAF, 0xB6, 0x00, 0x00, 0x0B,
+    0xEA, 0xDC, 0x80, 0x00, 0x12, 0xEF, 0xA9, 0xCC, 0x74, 0x46, 0x9D, 0xEA,
+    0x5A, 0xCB, 0x99, 0xAB, 0xAD, 0xA0, 0x59, 0xDF, 0xDB, 0x66, 0xCA, 0x00,
+    0x25, 0x55, 0x55, 0x52, 0x00, 0x00, 0x4C, 0xCC, 0xCC, 0xC4, 0x00, 0x00,
+    0x3A, 0xAA, 0xAA, 0xA3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB,
+    0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB,
+    0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB,
+    0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB,
+    0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB,
+    0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFC,
+    0x70, 0x00, 0x00, 0x07, 0xCF, 0xFC, 0x70, 0x00, 0x00, 0x07, 0xCF, 0xDD,
+    0x80, 0x00, 0x00, 0x08, 0xDD, 0xBD, 0xA3, 0x00, 0x00, 0x3A, 0xDB, 0x7C,
+    0xC8, 0x33, 0x33, 0x8C, 0xC7, 0x2A, 0xEF, 0x98, 0x89, 0xFE, 0xA2, 0x02,
+    0x5A, 0xEE, 0xEE, 0xA5, 0x10, 0x01, 0x23, 0x55, 0x55, 0x32, 0x00, 0x00,
+    0x25, 0x55, 0x55, 0x52, 0x00, 0x04, 0xCC, 0xCC, 0xCC, 0x40, 0x00, 0x3A,
+    0xAA, 0xAA, 0xA3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00,
+    0x00, 0x9D, 0xAF, 0xB6, 0x00, 0x00, 0x09, 0xDA, 0xFB, 0x60, 0x00, 0x00,
+    0x9D, 0xAF, 0xB6, 0x00, 0x00, 0x09, 0xDA, 0xFB, 0x60, 0x00, 0x00, 0x9D,
+    0xAF, 0xB6, 0x00, 0x00, 0x09, 0xDA, 0xFB, 0x60, 0x00, 0x00, 0x9D, 0xAF,
+    0xB6, 0x00, 0x00, 0x09, 0xDA, 0xFB, 0x60, 0x00, 0x00, 0xBE, 0xAD, 0xC8,
+    0x00, 0x00, 0x1D, 0xEA, 0xBC, 0xA3, 0x22, 0x36, 0xEF, 0xA7, 0xCD, 0xA6,
+    0x79, 0xDD, 0xEA, 0x05, 0x9D, 0xFD, 0xB6, 0x6C, 0xA0, 0x23, 0x45, 0x44,
+    0x22, 0x43, 0x00, 0x5E, 0x10, 0x01, 0xE5, 0x00, 0x00, 0x4B, 0x64, 0x57,
+    0xB4, 0x00, 0x00, 0x27, 0xA9, 0x9B, 0x72, 0x00, 0x00, 0x12, 0xCD, 0xDB,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA7, 0x40, 0x00, 0x00,
+    0x04, 0x8A, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00,
+    0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00,
+    0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00,
+    0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00,
+    0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00,
+    0x06, 0xBF, 0xFC, 0x70, 0x00, 0x00, 0x07, 0xCF, 0xEC, 0x80, 0x00, 0x00,
+    0x08, 0xDE, 0xCD, 0x91, 0x00, 0x00, 0x29, 0xDC, 0xAD, 0xB4, 0x00, 0x00,
+    0x5C, 0xD9, 0x2A, 0xEF, 0x98, 0x89, 0xFE, 0xA2, 0x15, 0x8C, 0xCC, 0xCC,
+    0xB8, 0x41, 0x01, 0x37, 0x9A, 0xA9, 0x63, 0x10, 0x00, 0x5E, 0x10, 0x01,
+    0xE5, 0x00, 0x04, 0xB6, 0x45, 0x7B, 0x40, 0x00, 0x27, 0xA9, 0x9B, 0x72,
+    0x00, 0x01, 0x2C, 0xDD, 0xB1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A,
+    0x74, 0x00, 0x00, 0x06, 0x97, 0xFB, 0x60, 0x00, 0x00, 0x9D, 0xAF, 0xB6,
+    0x00, 0x00, 0x09, 0xDA, 0xFB, 0x60, 0x00, 0x00, 0x9D, 0xAF, 0xB6, 0x00,
+    0x00, 0x09, 0xDA, 0xFB, 0x60, 0x00, 0x00, 0x9D, 0xAF, 0xB6, 0x00, 0x00,
+    0x09, 0xDA, 0xFB, 0x60, 0x00, 0x00, 0x9D, 0xAF, 0xB6, 0x00, 0x00, 0x0A,
+    0xDA, 0xEC, 0x70, 0x00, 0x01, 0xCE, 0xAD, 0xC8, 0x00, 0x01, 0x2E, 0xFA,
+    0x7C, 0xDA, 0x67, 0x9D, 0xDE, 0xA3, 0x8B, 0xCC, 0xBA, 0x88, 0xDA, 0x03,
+    0x69, 0xA9, 0x74, 0x48, 0x70, 0x00, 0x00, 0x5B, 0xDD, 0x52, 0x00, 0x00,
+    0x00, 0xB7, 0x66, 0xB4, 0x00, 0x00, 0x00, 0xE6, 0x22, 0xE5, 0x00, 0x00,
+    0x00, 0xE6, 0x22, 0xE5, 0x00, 0x00, 0x00, 0x5B, 0xDD, 0x52, 0x00, 0x00,
+    0x00, 0x24, 0x44, 0x21, 0x00, 0x54, 0x20, 0x00, 0x00, 0x02, 0x45, 0xFB,
+    0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB,
+    0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB,
+    0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB,
+    0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB,
+    0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFC,
+    0x70, 0x00, 0x00, 0x07, 0xCF, 0xEC, 0x70, 0x00, 0x00, 0x07, 0xCE, 0xDD,
+    0x80, 0x00, 0x00, 0x08, 0xDD, 0xAD, 0xB4, 0x00, 0x00, 0x5C, 0xD9, 0x5B,
+    0xDB, 0x65, 0x56, 0xBD, 0xB4, 0x28, 0xBD, 0xBA, 0xAB, 0xDB, 0x71, 0x02,
+    0x5A, 0xEE, 0xEE, 0xA5, 0x10, 0x00, 0x25, 0xDD, 0xA5, 0x00, 0x00, 0x04,
+    0xB6, 0x67, 0xB0, 0x00, 0x00, 0x5E, 0x22, 0x6E, 0x00, 0x00, 0x05, 0xE2,
+    0x26, 0xE0, 0x00, 0x00, 0x25, 0xDD, 0xA5, 0x00, 0x00, 0x01, 0x24, 0x43,
+    0x20, 0x00, 0x54, 0x20, 0x00, 0x00, 0x34, 0x3F, 0xB6, 0x00, 0x00, 0x09,
+    0xDA, 0xFB, 0x60, 0x00, 0x00, 0x9D, 0xAF, 0xB6, 0x00, 0x00, 0x09, 0xDA,
+    0xFB, 0x60, 0x00, 0x00, 0x9D, 0xAF, 0xB6, 0x00, 0x00, 0x09, 0xDA, 0xFB,
+    0x60, 0x00, 0x00, 0x9D, 0xAF, 0xB6, 0x00, 0x00, 0x09, 0xDA, 0xFB, 0x60,
+    0x00, 0x00, 0xAD, 0xAF, 0xB6, 0x00, 0x00, 0x0B, 0xEA, 0xDC, 0x80, 0x00,
+    0x12, 0xEF, 0xA9, 0xCC, 0x74, 0x46, 0x9D, 0xEA, 0x5A, 0xCB, 0x99, 0xAB,
+    0xAD, 0xA0, 0x59, 0xDF, 0xDB, 0x66, 0xCA, 0x00, 0x12, 0xFD, 0x82, 0xFD,
+    0x80, 0x00, 0x25, 0xF9, 0x65, 0xF9, 0x40, 0x00, 0x39, 0xB5, 0x49, 0xB5,
+    0x10, 0x00, 0x4D, 0x52, 0x4D, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xA7, 0x40, 0x00, 0x00, 0x04, 0x8A, 0xFB, 0x60, 0x00, 0x00, 0x06,
+    0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06,
+    0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06,
+    0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06,
+    0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06,
+    0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFC, 0x70, 0x00, 0x00, 0x07,
+    0xCF, 0xEC, 0x80, 0x00, 0x00, 0x08, 0xDE, 0xCD, 0x91, 0x00, 0x00, 0x29,
+    0xDC, 0xAD, 0xB4, 0x00, 0x00, 0x5C, 0xD9, 0x2A, 0xEF, 0x98, 0x89, 0xFE,
+    0xA2, 0x15, 0x8C, 0xCC, 0xCC, 0xB8, 0x41, 0x01, 0x37, 0x9A, 0xA9, 0x63,
+    0x10, 0x00, 0x12, 0xFD, 0x82, 0xFD, 0x80, 0x02, 0x5F, 0x96, 0x5F, 0x94,
+    0x00, 0x39, 0xB5, 0x49, 0xB5, 0x10, 0x04, 0xD5, 0x24, 0xD5, 0x20, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0A, 0x74, 0x00, 0x00, 0x06, 0x97, 0xFB, 0x60,
+    0x00, 0x00, 0x9D, 0xAF, 0xB6, 0x00, 0x00, 0x09, 0xDA, 0xFB, 0x60, 0x00,
+    0x00, 0x9D, 0xAF, 0xB6, 0x00, 0x00, 0x09, 0xDA, 0xFB, 0x60, 0x00, 0x00,
+    0x9D, 0xAF, 0xB6, 0x00, 0x00, 0x09, 0xDA, 0xFB, 0x60, 0x00, 0x00, 0x9D,
+    0xAF, 0xB6, 0x00, 0x00, 0x0A, 0xDA, 0xEC, 0x70, 0x00, 0x01, 0xCE, 0xAD,
+    0xC8, 0x00, 0x01, 0x2E, 0xFA, 0x7C, 0xDA, 0x67, 0x9D, 0xDE, 0xA3, 0x8B,
+    0xCC, 0xBA, 0x88, 0xDA, 0x03, 0x69, 0xA9, 0x74, 0x48, 0x70, 0xFB, 0x60,
+    0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60,
+    0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60,
+    0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60,
+    0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60,
+    0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFC, 0x70,
+    0x00, 0x00, 0x07, 0xCF, 0xFC, 0x70, 0x00, 0x00, 0x07, 0xCF, 0xDD, 0x80,
+    0x00, 0x00, 0x08, 0xDD, 0xBD, 0xA3, 0x00, 0x00, 0x3A, 0xDB, 0x7C, 0xC8,
+    0x33, 0x33, 0x8C, 0xC7, 0x2A, 0xEF, 0x98, 0x89, 0xFE, 0xA2, 0x02, 0x5A,
+    0xEE, 0xEE, 0xA5, 0x10, 0x01, 0x23, 0x6B, 0xC9, 0x32, 0x00, 0x00, 0x00,
+    0x69, 0x94, 0x00, 0x00, 0x00, 0x00, 0xC9, 0x50, 0x00, 0x00, 0x00, 0x00,
+    0xB9, 0x61, 0x21, 0x00, 0x00, 0x00, 0x59, 0xBA, 0x93, 0x00, 0x00, 0x00,
+    0x16, 0x9A, 0x93, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x9D, 0xA0, 0xFB, 0x60,
+    0x00, 0x00, 0x9D, 0xA0, 0xFB, 0x60, 0x00, 0x00, 0x9D, 0xA0, 0xFB, 0x60,
+    0x00, 0x00, 0x9D, 0xA0, 0xFB, 0x60, 0x00, 0x00, 0x9D, 0xA0, 0xFB, 0x60,
+    0x00, 0x00, 0x9D, 0xA0, 0xFB, 0x60, 0x00, 0x00, 0x9D, 0xA0, 0xFB, 0x60,
+    0x00, 0x00, 0x9D, 0xA0, 0xFB, 0x60, 0x00, 0x00, 0xBE, 0xA0, 0xDC, 0x80,
+    0x00, 0x01, 0xDE, 0xA0, 0xBC, 0xA3, 0x22, 0x36, 0xEF, 0xA0, 0x7C, 0xDA,
+    0x67, 0x9D, 0xDE, 0xA0, 0x05, 0x9D, 0xFD, 0xB6, 0x6C, 0xA0, 0x02, 0x34,
+    0x54, 0x44, 0xAA, 0x60, 0x00, 0x00, 0x00, 0x26, 0xB6, 0x30, 0x00, 0x00,
+    0x00, 0x4C, 0x72, 0x00, 0x00, 0x00, 0x00, 0x4B, 0x83, 0x22, 0x00, 0x00,
+    0x00, 0x25, 0xBA, 0xA9, 0x00, 0x00, 0x00, 0x01, 0x89, 0x99, 0x00, 0x00,
+    0x06, 0xBF, 0x93, 0x00, 0x00, 0x00, 0x00, 0x02, 0x9C, 0xBD, 0x61, 0x00,
+    0x00, 0x00, 0x00, 0x6A, 0xA6, 0xD8, 0x40, 0x00, 0x00, 0x00, 0x0C, 0x95,
+    0x08, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+    0x74, 0x00, 0x00, 0x00, 0x00, 0x05, 0x86, 0xEA, 0x60, 0x00, 0x00, 0x00,
+    0x00, 0x8C, 0x9C, 0xB7, 0x00, 0x00, 0x00, 0x00, 0x09, 0xB8, 0xBB, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0xBB, 0x7A, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x0C,
+    0xA6, 0x8C, 0x90, 0x01, 0x25, 0x10, 0x00, 0xDA, 0x67, 0xCA, 0x00, 0x27,
+    0xF3, 0x10, 0x0D, 0x95, 0x5C, 0xA1, 0x06, 0xAD, 0x83, 0x00, 0xF9, 0x44,
+    0xBB, 0x20, 0x8B, 0x8C, 0x40, 0x1F, 0x83, 0x3B, 0xB3, 0x29, 0xA4, 0xE6,
+    0x22, 0xF7, 0x22, 0xBB, 0x44, 0xA9, 0x0E, 0x74, 0x3F, 0x61, 0x0A, 0xB5,
+    0xA8, 0x50, 0x99, 0x84, 0xF5, 0x00, 0x9B, 0x6D, 0x73, 0x06, 0xAA, 0x5E,
+    0x50, 0x09, 0xB8, 0xD6, 0x10, 0x3A, 0xC7, 0xD4, 0x00, 0x8B, 0xAC, 0x40,
+    0x00, 0x9D, 0xBC, 0x40, 0x07, 0xCF, 0x72, 0x00, 0x06, 0xBF, 0xA3, 0x00,
+    0x6B, 0xF3, 0x10, 0x00, 0x49, 0xF9, 0x30, 0x04, 0x7A, 0x10, 0x00, 0x02,
+    0x5A, 0x62, 0x00, 0x00, 0x00, 0x06, 0xBF, 0x93, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x9C, 0xBD, 0x61, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xA6, 0xD8, 0x40,
+    0x00, 0x00, 0x00, 0x0C, 0x95, 0x08, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x09, 0x63, 0x00, 0x15, 0xA3, 0x10, 0x05, 0x86,
+    0xDA, 0x50, 0x03, 0x8F, 0x62, 0x00, 0x8B, 0x8B, 0xA6, 0x00, 0x5A, 0xE9,
+    0x30, 0x09, 0xA7, 0x8A, 0x80, 0x09, 0xB8, 0xD4, 0x00, 0xB9, 0x56, 0xB9,
+    0x02, 0xAA, 0x3E, 0x61, 0x0D, 0x84, 0x4B, 0x90, 0x4A, 0x91, 0xE7, 0x30,
+    0xE7, 0x32, 0xBA, 0x17, 0xA8, 0x0C, 0x95, 0x1F, 0x61, 0x09, 0xA3, 0xC9,
+    0x50, 0x8A, 0x92, 0xE5, 0x00, 0x89, 0x4E, 0x73, 0x04, 0xBA, 0x4C, 0x40,
+    0x07, 0x96, 0xE6, 0x10, 0x2A, 0xC6, 0xA3, 0x00, 0x69, 0x9D, 0x40, 0x00,
+    0x9C, 0x98, 0x30, 0x04, 0x8E, 0x83, 0x00, 0x06, 0xBE, 0x52, 0x00, 0x27,
+    0xF5, 0x20, 0x00, 0x49, 0xF4, 0x10, 0x01, 0x5A, 0x21, 0x00, 0x02, 0x5A,
+    0x21, 0x00, 0x00, 0x00, 0x06, 0xBF, 0x93, 0x00, 0x00, 0x00, 0x00, 0x29,
+    0xCB, 0xD6, 0x10, 0x00, 0x00, 0x00, 0x6A, 0xA6, 0xD8, 0x40, 0x00, 0x00,
+    0x00, 0xC9, 0x50, 0x8B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x48, 0x84, 0x00, 0x00, 0x00, 0x49, 0x72, 0x4B, 0xC8, 0x00, 0x00,
+    0x02, 0x7E, 0x93, 0x09, 0xDD, 0x00, 0x00, 0x05, 0xAF, 0x41, 0x04, 0x9F,
+    0x41, 0x00, 0x09, 0xDB, 0x00, 0x01, 0x6E, 0x93, 0x00, 0x4B, 0xC6, 0x00,
+    0x00, 0x4B, 0xD5, 0x10, 0x8C, 0xA3, 0x00, 0x00, 0x26, 0xF7, 0x20, 0xCC,
+    0x80, 0x00, 0x00, 0x00, 0xDB, 0x84, 0xF8, 0x30, 0x00, 0x00, 0x00, 0x8C,
+    0xCA, 0xD5, 0x10, 0x00, 0x00, 0x00, 0x4B, 0xED, 0x93, 0x00, 0x00, 0x00,
+    0x00, 0x09, 0xEF, 0x41, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x06, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x06, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x8A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9D, 0xD9, 0x00,
+    0x00, 0x00, 0x12, 0xDC, 0xCD, 0x21, 0x00, 0x00, 0x26, 0xC8, 0x8D, 0x62,
+    0x00, 0x00, 0x4C, 0x83, 0x38, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x88, 0x60, 0x00, 0x00, 0x06, 0x88, 0xAC, 0x91, 0x00, 0x00, 0x19,
+    0xCA, 0x7C, 0xB3, 0x00, 0x00, 0x3B, 0xC7, 0x1A, 0xD8, 0x00, 0x00, 0x8C,
+    0xA1, 0x08, 0xCC, 0x00, 0x00, 0xBC, 0x80, 0x06, 0xAE, 0x10, 0x01, 0xEA,
+    0x60, 0x03, 0x8F, 0x41, 0x13, 0xF8, 0x30, 0x00, 0x5E, 0xA3, 0x38, 0xE5,
+    0x00, 0x00, 0x3A, 0xD4, 0x4C, 0xA3, 0x00, 0x00, 0x26, 0xE7, 0x6E, 0x72,
+    0x00, 0x00, 0x12, 0xFA, 0xAF, 0x31, 0x00, 0x00, 0x00, 0xCD, 0xDC, 0x00,
+    0x00, 0x00, 0x00, 0x8C, 0xD8, 0x00, 0x00, 0x00, 0x00, 0x6C, 0xC5, 0x00,
+    0x00, 0x00, 0x00, 0x6C, 0xA1, 0x00, 0x00, 0x00, 0x00, 0xDB, 0x60, 0x00,
+    0x00, 0x44, 0x58, 0xE8, 0x30, 0x00, 0x00, 0x88, 0xAB, 0xB5, 0x10, 0x00,
+    0x00, 0xEE, 0xEC, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC8, 0x40, 0x6A,
+    0x80, 0x00, 0x00, 0x00, 0xC8, 0x40, 0x6A, 0x80, 0x00, 0x00, 0x00, 0x85,
+    0x30, 0x47, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6C,
+    0xC6, 0x00, 0x00, 0x01, 0x5E, 0xB4, 0x2A, 0xDA, 0x00, 0x00, 0x03, 0x8F,
+    0x62, 0x07, 0xBD, 0x21, 0x00, 0x06, 0xBE, 0x31, 0x04, 0x9F, 0x41, 0x00,
+    0x09, 0xDB, 0x00, 0x00, 0x4D, 0xB4, 0x00, 0x6C, 0xB4, 0x00, 0x00, 0x38,
+    0xE6, 0x10, 0xAC, 0x91, 0x00, 0x00, 0x14, 0xE8, 0x41, 0xDA, 0x60, 0x00,
+    0x00, 0x00, 0xDB, 0x84, 0xF8, 0x30, 0x00, 0x00, 0x00, 0x6C, 0xEC, 0xB4,
+    0x00, 0x00, 0x00, 0x00, 0x2A, 0xEE, 0x62, 0x00, 0x00, 0x00, 0x00, 0x08,
+    0xDF, 0x31, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x06, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x06, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6F, 0xC4, 0x00, 0x00,
+    0x00, 0x04, 0x8F, 0x62, 0x00, 0x00, 0x00, 0x06, 0xAC, 0x21, 0x00, 0x00,
+    0x00, 0x09, 0xB7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xCC, 0xCC, 0xCC, 0xCC, 0xCE, 0xFE, 0x77,
+    0x77, 0x77, 0x77, 0x7C, 0xEC, 0x00, 0x00, 0x00, 0x00, 0x9D, 0xB2, 0x00,
+    0x00, 0x00, 0x13, 0xDA, 0x61, 0x00, 0x00, 0x00, 0x37, 0xE8, 0x30, 0x00,
+    0x00, 0x01, 0x5D, 0xB4, 0x00, 0x00, 0x00, 0x07, 0xBE, 0x21, 0x00, 0x00,
+    0x00, 0x4A, 0xC8, 0x10, 0x00, 0x00, 0x01, 0x8C, 0xA4, 0x00, 0x00, 0x00,
+    0x12, 0xEB, 0x70, 0x00, 0x00, 0x00, 0x4B, 0xD5, 0x10, 0x00, 0x00, 0x03,
+    0x8E, 0x73, 0x00, 0x00, 0x00, 0x17, 0xBD, 0x31, 0x00, 0x00, 0x00, 0x3B,
+    0xD9, 0x00, 0x00, 0x00, 0x00, 0xCE, 0xC7, 0x77, 0x77, 0x77, 0x77, 0xEF,
+    0xEC, 0xCC, 0xCC, 0xCC, 0xCC, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x00,
+    0x00, 0x2A, 0xEC, 0x00, 0x00, 0x00, 0x5C, 0xC6, 0x00, 0x00, 0x00, 0x9B,
+    0x92, 0x00, 0x00, 0x00, 0xD9, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xA3, 0xBB, 0xBB, 0xBB, 0xCE, 0xE5, 0x44, 0x44,
+    0x44, 0x7D, 0xD4, 0x00, 0x00, 0x05, 0xAF, 0x31, 0x00, 0x00, 0x29, 0xB9,
+    0x10, 0x00, 0x00, 0x7B, 0xB5, 0x00, 0x00, 0x01, 0xDC, 0x70, 0x00, 0x00,
+    0x39, 0xE6, 0x10, 0x00, 0x02, 0x7D, 0x83, 0x00, 0x00, 0x15, 0xAD, 0x31,
+    0x00, 0x00, 0x2A, 0xC9, 0x00, 0x00, 0x00, 0xBD, 0xB4, 0x44, 0x44, 0x41,
+    0xEE, 0xEB, 0xBB, 0xBB, 0xB4, 0xAA, 0xAA, 0xAA, 0xAA, 0xA3, 0x00, 0x00,
+    0x08, 0xA5, 0x00, 0x00, 0x00, 0x00, 0x08, 0xA5, 0x00, 0x00, 0x00, 0x00,
+    0x06, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x99, 0x99, 0x99, 0x99, 0xAD, 0xED, 0x44, 0x44,
+    0x44, 0x44, 0x8C, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x9D, 0xB2, 0x00, 0x00,
+    0x00, 0x14, 0xF9, 0x40, 0x00, 0x00, 0x00, 0x4A, 0xC6, 0x10, 0x00, 0x00,
+    0x03, 0x7E, 0x83, 0x00, 0x00, 0x00, 0x07, 0xBE, 0x21, 0x00, 0x00, 0x00,
+    0x5C, 0xC5, 0x00, 0x00, 0x00, 0x01, 0xBB, 0x82, 0x00, 0x00, 0x00, 0x25,
+    0xE9, 0x50, 0x00, 0x00, 0x00, 0x4B, 0xD5, 0x10, 0x00, 0x00, 0x05, 0xAF,
+    0x41, 0x00, 0x00, 0x00, 0x29, 0xCB, 0x10, 0x00, 0x00, 0x00, 0x6C, 0xC8,
+    0x22, 0x22, 0x22, 0x22, 0xCE, 0xC7, 0x77, 0x77, 0x77, 0x77, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00,
+    0xC8, 0x40, 0x00, 0x00, 0x00, 0xC8, 0x40, 0x00, 0x00, 0x00, 0x85, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x88,
+    0x88, 0x88, 0xAE, 0xD4, 0x33, 0x33, 0x34, 0x8E, 0x93, 0x00, 0x00, 0x05,
+    0xAF, 0x31, 0x00, 0x00, 0x3B, 0xC7, 0x00, 0x00, 0x00, 0xAB, 0x92, 0x00,
+    0x00, 0x14, 0xDA, 0x50, 0x00, 0x00, 0x39, 0xE6, 0x10, 0x00, 0x03, 0x8F,
+    0x52, 0x00, 0x00, 0x18, 0xBB, 0x21, 0x00, 0x00, 0x5B, 0xC8, 0x11, 0x11,
+    0x10, 0xBD, 0xB4, 0x44, 0x44, 0x41, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x55,
+    0x55, 0x55, 0x55, 0x52, 0x00, 0x4C, 0x83, 0x38, 0xC4, 0x00, 0x00, 0x26,
+    0xC8, 0x8D, 0x62, 0x00, 0x00, 0x12, 0xDC, 0xCD, 0x21, 0x00, 0x00, 0x00,
+    0x9D, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xCC, 0xCC, 0xCC, 0xCC, 0xCE, 0xFE, 0x77, 0x77,
+    0x77, 0x77, 0x7C, 0xEC, 0x00, 0x00, 0x00, 0x00, 0x9D, 0xB2, 0x00, 0x00,
+    0x00, 0x13, 0xDA, 0x61, 0x00, 0x00, 0x00, 0x37, 0xE8, 0x30, 0x00, 0x00,
+    0x01, 0x5D, 0xB4, 0x00, 0x00, 0x00, 0x07, 0xBE, 0x21, 0x00, 0x00, 0x00,
+    0x4A, 0xC8, 0x10, 0x00, 0x00, 0x01, 0x8C, 0xA4, 0x00, 0x00, 0x00, 0x12,
+    0xEB, 0x70, 0x00, 0x00, 0x00, 0x4B, 0xD5, 0x10, 0x00, 0x00, 0x03, 0x8E,
+    0x73, 0x00, 0x00, 0x00, 0x17, 0xBD, 0x31, 0x00, 0x00, 0x00, 0x3B, 0xD9,
+    0x00, 0x00, 0x00, 0x00, 0xCE, 0xC7, 0x77, 0x77, 0x77, 0x77, 0xEF, 0xEC,
+    0xCC, 0xCC, 0xCC, 0xCC, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x08, 0xB8,
+    0x05, 0x9C, 0x00, 0x04, 0x8C, 0x6A, 0xA6, 0x00, 0x01, 0x6D, 0xBC, 0x92,
+    0x00, 0x00, 0x39, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xA3, 0xBB, 0xBB, 0xBB, 0xCE, 0xE5, 0x44, 0x44, 0x44,
+    0x7D, 0xD4, 0x00, 0x00, 0x05, 0xAF, 0x31, 0x00, 0x00, 0x29, 0xB9, 0x10,
+    0x00, 0x00, 0x7B, 0xB5, 0x00, 0x00, 0x01, 0xDC, 0x70, 0x00, 0x00, 0x39,
+    0xE6, 0x10, 0x00, 0x02, 0x7D, 0x83, 0x00, 0x00, 0x15, 0xAD, 0x31, 0x00,
+    0x00, 0x2A, 0xC9, 0x00, 0x00, 0x00, 0xBD, 0xB4, 0x44, 0x44, 0x41, 0xEE,
+    0xEB, 0xBB, 0xBB, 0xB4, 0xAA, 0xAA, 0xAA, 0xAA, 0xA3, 0x17, 0xBE, 0xFE,
+    0xDB, 0x6B, 0xCA, 0x99, 0x87, 0xBC, 0xB5, 0x44, 0x44, 0xDC, 0x70, 0x00,
+    0x00, 0xFB, 0x60, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0xFB, 0x60, 0x00,
+    0x00, 0xFB, 0x60, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0xFB, 0x60, 0x00,
+    0x00, 0xFB, 0x60, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0xFB, 0x60, 0x00,
+    0x00, 0xFB, 0x60, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0xFB, 0x60, 0x00,
+    0x00, 0xFB, 0x60, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0xA7, 0x40, 0x00,
+    0x00, 0x02, 0x5A, 0xDE, 0xEE, 0xDB, 0x96, 0x49, 0xBC, 0xAA, 0xAA, 0xBC,
+    0xB8, 0x8C, 0xC9, 0x65, 0x55, 0x68, 0x86, 0xDD, 0x91, 0x00, 0x00, 0x00,
+    0x00, 0xEC, 0x70, 0x00, 0x00, 0x00, 0x00, 0xCD, 0xA3, 0x00, 0x00, 0x00,
+    0x00, 0x8C, 0xC7, 0x42, 0x10, 0x00, 0x00, 0x2A, 0xEF, 0xB7, 0x41, 0x00,
+    0x00, 0x01, 0x37, 0xDE, 0xFE, 0xA5, 0x20, 0x00, 0x12, 0x46, 0x8B, 0xDB,
+    0x83, 0x00, 0x00, 0x01, 0x36, 0xAD, 0xC7, 0x00, 0x00, 0x00, 0x00, 0x2A,
+    0xDC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x19,
+    0xDD, 0x54, 0x33, 0x22, 0x23, 0x5B, 0xC9, 0xFC, 0xA8, 0x77, 0x78, 0xEE,
+    0xB4, 0x9B, 0xDE, 0xFF, 0xED, 0x95, 0x20, 0x34, 0x45, 0x55, 0x54, 0x32,
+    0x10, 0x00, 0x00, 0x02, 0x35, 0x00, 0x00, 0x00, 0x00, 0x05, 0x9E, 0x00,
+    0x00, 0x00, 0x00, 0x06, 0x98, 0x00, 0x00, 0x00, 0x00, 0x08, 0x93, 0x00,
+    0x00, 0x00, 0x00, 0x06, 0x61, 0x00, 0x00, 0x16, 0xAD, 0xFE, 0xDC, 0x72,
+    0x7A, 0xB9, 0x89, 0x9B, 0x83, 0xCC, 0xA5, 0x44, 0x57, 0x62, 0xEB, 0x60,
+    0x00, 0x00, 0x00, 0xCD, 0xB6, 0x00, 0x00, 0x00, 0x5A, 0xCC, 0x97, 0x41,
+    0x00, 0x16, 0x9B, 0xCB, 0x96, 0x10, 0x00, 0x14, 0xAD, 0xFE, 0x41, 0x00,
+    0x00, 0x01, 0x5D, 0xD4, 0x00, 0x00, 0x00, 0x4B, 0xE5, 0x43, 0x32, 0x22,
+    0x6B, 0xC4, 0xDA, 0x86, 0x57, 0xAF, 0x93, 0x9C, 0xEF, 0xED, 0xB7, 0x00,
+    0x34, 0x55, 0x54, 0x42, 0x00, 0x00, 0x12, 0x52, 0x00, 0x00, 0x00, 0x27,
+    0xE5, 0x00, 0x00, 0x00, 0x3A, 0x83, 0x00, 0x00, 0x00, 0x4C, 0x31, 0x00,
+    0x00, 0x00, 0x39, 0x10, 0x00, 0x00, 0x9D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xF5, 0x68, 0x99, 0x9C, 0xEF, 0x99, 0x99, 0x93, 0x34, 0x44, 0x49, 0xCF,
+    0x54, 0x44, 0x41, 0x00, 0x00, 0x06, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x06, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x06, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
+    0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x06, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x06, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x06, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x45, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x9E, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x06, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+    0x93, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0x13, 0x52, 0x00, 0x00, 0x00, 0x27, 0x83, 0x00, 0x00, 0x00, 0x4B, 0x93,
+    0x00, 0x00, 0x00, 0x4D, 0x93, 0x00, 0x00, 0xBD, 0xEF, 0xFF, 0xFF, 0xF5,
+    0x67, 0xAF, 0xC9, 0x88, 0x83, 0x33, 0x7F, 0xA5, 0x33, 0x31, 0x00, 0x5F,
+    0x93, 0x00, 0x00, 0x00, 0x5F, 0x93, 0x00, 0x00, 0x00, 0x5F, 0x93, 0x00,
+    0x00, 0x00, 0x5F, 0x93, 0x00, 0x00, 0x00, 0x5F, 0x93, 0x00, 0x00, 0x00,
+    0x5F, 0x93, 0x00, 0x00, 0x00, 0x5E, 0xA3, 0x00, 0x00, 0x00, 0x4D, 0xC5,
+    0x22, 0x21, 0x00, 0x3A, 0xFA, 0x75, 0x62, 0x00, 0x01, 0xAD, 0xEE, 0xC4,
+    0x00, 0x00, 0x34, 0x55, 0x41, 0x00, 0x00, 0x24, 0x30, 0x00, 0x00, 0x00,
+    0x7B, 0x90, 0x00, 0x00, 0x00, 0xA8, 0x50, 0x00, 0x00, 0x00, 0xC6, 0x20,
+    0x00, 0x00, 0x00, 0x93, 0x00, 0x00, 0xAC, 0x9B, 0xB7, 0xD9, 0x4E, 0x62,
+    0x00, 0x12, 0xFD, 0x80, 0x00, 0x26, 0xE8, 0x30, 0x43, 0x49, 0xA5, 0x34,
+    0xC8, 0x8D, 0x35, 0x8C, 0xC8, 0x40, 0x04, 0x8C, 0x43, 0x10, 0x01, 0x34,
+    0x07, 0xBE, 0x05, 0xAF, 0x83, 0x00, 0x00, 0x00, 0x7B, 0xA0, 0x8C, 0xFC,
+    0x40, 0x00, 0x00, 0x08, 0xB7, 0x1A, 0xDC, 0xE6, 0x10, 0x00, 0x00, 0x9A,
+    0x34, 0xBD, 0x8F, 0x83, 0x00, 0x00, 0x00, 0x00, 0x9D, 0xA1, 0xFB, 0x60,
+    0x00, 0x00, 0x00, 0x0C, 0xC8, 0x0C, 0xC8, 0x00, 0x00, 0x00, 0x12, 0xEB,
+    0x60, 0x9D, 0xA2, 0x00, 0x00, 0x02, 0x5F, 0x94, 0x06, 0xCC, 0x50, 0x00,
+    0x00, 0x3A, 0xF6, 0x10, 0x1A, 0xDA, 0x00, 0x00, 0x05, 0xDD, 0x50, 0x00,
+    0x9D, 0xD1, 0x00, 0x02, 0x7F, 0xD8, 0x55, 0x5A, 0xDF, 0x31, 0x00, 0x49,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0x20, 0x07, 0xCF, 0x77, 0x77, 0x77, 0x9F,
+    0xB4, 0x01, 0x9D, 0xC2, 0x22, 0x22, 0x25, 0xCE, 0x51, 0x3B, 0xD8, 0x00,
+    0x00, 0x00, 0x38, 0xF7, 0x27, 0xCB, 0x40, 0x00, 0x00, 0x01, 0x4F, 0xA5,
+    0xCD, 0x90, 0x00, 0x00, 0x00, 0x00, 0xDD, 0x84, 0x43, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0x43, 0xBB, 0x8B, 0xB8, 0x88, 0x50, 0xAC, 0xEF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xF5, 0xBB, 0xCF, 0xDB, 0x99, 0x99, 0x99, 0x93, 0xD9, 0x9F,
+    0xB7, 0x44, 0x44, 0x44, 0x41, 0xE6, 0x7F, 0xA3, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x5F, 0xA3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xA3, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x5F, 0xB7, 0x55, 0x55, 0x55, 0x52, 0x00, 0x5F, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xF5, 0x00, 0x5F, 0xC8, 0x77, 0x77, 0x77, 0x72, 0x00,
+    0x5F, 0xA5, 0x22, 0x22, 0x22, 0x21, 0x00, 0x5F, 0xA3, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x5F, 0xA3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xA3, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x5F, 0xA3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F,
+    0xA5, 0x22, 0x22, 0x22, 0x21, 0x00, 0x5F, 0xC8, 0x77, 0x77, 0x77, 0x72,
+    0x00, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x00, 0x25, 0x55, 0x55, 0x55,
+    0x55, 0x52, 0xAC, 0xEF, 0xA3, 0x00, 0x00, 0x00, 0xAD, 0xAB, 0xBC, 0xFA,
+    0x30, 0x00, 0x00, 0x0A, 0xDA, 0xD9, 0x9F, 0xA3, 0x00, 0x00, 0x00, 0xAD,
+    0xAE, 0x67, 0xFA, 0x30, 0x00, 0x00, 0x0A, 0xDA, 0x00, 0x5F, 0xA3, 0x00,
+    0x00, 0x00, 0xAD, 0xA0, 0x05, 0xFA, 0x30, 0x00, 0x00, 0x0A, 0xDA, 0x00,
+    0x5F, 0xB7, 0x55, 0x55, 0x55, 0xBE, 0xA0, 0x05, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFA, 0x00, 0x5F, 0xC8, 0x77, 0x77, 0x77, 0xCE, 0xA0, 0x05, 0xFA,
+    0x52, 0x22, 0x22, 0x2A, 0xDA, 0x00, 0x5F, 0xA3, 0x00, 0x00, 0x00, 0xAD,
+    0xA0, 0x05, 0xFA, 0x30, 0x00, 0x00, 0x0A, 0xDA, 0x00, 0x5F, 0xA3, 0x00,
+    0x00, 0x00, 0xAD, 0xA0, 0x05, 0xFA, 0x30, 0x00, 0x00, 0x0A, 0xDA, 0x00,
+    0x5F, 0xA3, 0x00, 0x00, 0x00, 0xAD, 0xA0, 0x05, 0xFA, 0x30, 0x00, 0x00,
+    0x0A, 0xDA, 0x00, 0x5F, 0xA3, 0x00, 0x00, 0x00, 0xAD, 0xA0, 0x02, 0x53,
+    0x10, 0x00, 0x00, 0x03, 0x43, 0xAC, 0xA3, 0xFF, 0xFF, 0xFF, 0xFF, 0x93,
+    0xBB, 0x72, 0x88, 0xAD, 0xFB, 0x88, 0x41, 0xD9, 0x50, 0x33, 0x6B, 0xF7,
+    0x33, 0x10, 0xE6, 0x20, 0x00, 0x39, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x39, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xF5, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x39, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xF5, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x39, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39,
+    0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xF5, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x39, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xF5, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x39, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x12, 0x4A, 0xF6,
+    0x21, 0x10, 0x00, 0x01, 0x45, 0x7C, 0xF9, 0x54, 0x21, 0x00, 0x13, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x93, 0x00, 0x01, 0x55, 0x55, 0x55, 0x55, 0x31, 0xAC,
+    0x90, 0x16, 0xAD, 0xFE, 0xB8, 0x00, 0x0B, 0xB7, 0x08, 0xBC, 0xBA, 0xBC,
+    0xD7, 0x20, 0xD9, 0x52, 0xCD, 0xB7, 0x56, 0x9D, 0xC5, 0x1E, 0x63, 0x5F,
+    0xB6, 0x00, 0x03, 0x8F, 0x83, 0x00, 0x3A, 0xF6, 0x10, 0x00, 0x01, 0xFB,
+    0x60, 0x04, 0xCE, 0x50, 0x00, 0x00, 0x0E, 0xC8, 0x00, 0x4D, 0xD4, 0x00,
+    0x00, 0x00, 0xDD, 0x90, 0x05, 0xEC, 0x40, 0x00, 0x00, 0x0C, 0xD9, 0x00,
+    0x5F, 0xB4, 0x00, 0x00, 0x00, 0xBE, 0xA0, 0x05, 0xFB, 0x40, 0x00, 0x00,
+    0x0B, 0xDA, 0x00, 0x5E, 0xC4, 0x00, 0x00, 0x00, 0xCD, 0x90, 0x04, 0xDD,
+    0x40, 0x00, 0x00, 0x0D, 0xD8, 0x00, 0x3A, 0xF6, 0x10, 0x00, 0x12, 0xFB,
+    0x60, 0x02, 0x7F, 0x94, 0x00, 0x02, 0x6F, 0x94, 0x00, 0x13, 0xEC, 0x83,
+    0x23, 0x6B, 0xD6, 0x20, 0x00, 0x0B, 0xED, 0xA7, 0x9C, 0xFA, 0x30, 0x00,
+    0x00, 0x16, 0xAD, 0xFE, 0xB7, 0x00, 0x00, 0x00, 0x00, 0x23, 0x45, 0x54,
+    0x20, 0x00, 0xAC, 0xB6, 0xF9, 0x40, 0x00, 0x00, 0x1A, 0xDB, 0xBB, 0x82,
+    0xEB, 0x70, 0x00, 0x00, 0x5B, 0xC6, 0xD9, 0x50, 0xBC, 0x92, 0x00, 0x00,
+    0x9C, 0xA3, 0xE6, 0x20, 0x6C, 0xB4, 0x00, 0x00, 0xDC, 0x80, 0x00, 0x00,
+    0x09, 0xCB, 0x00, 0x26, 0xF8, 0x30, 0x00, 0x00, 0x05, 0xAE, 0x21, 0x3A,
+    0xD5, 0x10, 0x00, 0x00, 0x03, 0x7E, 0x53, 0x5D, 0x93, 0x00, 0x00, 0x00,
+    0x00, 0x4D, 0xA6, 0x8F, 0x41, 0x00, 0x00, 0x00, 0x00, 0x26, 0xFD, 0xCB,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xEE, 0xC6, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xCE, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9D, 0xA0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9D, 0xA0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x9D, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9D, 0xA0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9D, 0xA0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x9D, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x30,
+    0x00, 0x00, 0xAC, 0x90, 0x15, 0xAD, 0xFE, 0xB8, 0x10, 0x00, 0xBB, 0x70,
+    0x8B, 0xCB, 0xAA, 0xBD, 0x72, 0x00, 0xD9, 0x52, 0xCC, 0xA7, 0x56, 0x9C,
+    0xC5, 0x10, 0xE6, 0x45, 0xFA, 0x50, 0x00, 0x27, 0xF9, 0x40, 0x00, 0x4B,
+    0xF5, 0x00, 0x00, 0x01, 0xFC, 0x70, 0x00, 0x4D, 0xD5, 0x00, 0x00, 0x00,
+    0xDD, 0x80, 0x00, 0x5E, 0xC4, 0x00, 0x00, 0x00, 0xCD, 0x90, 0x00, 0x5F,
+    0xB4, 0x00, 0x00, 0x00, 0xBE, 0xA0, 0x00, 0x5E, 0xC4, 0x00, 0x00, 0x00,
+    0xCD, 0x90, 0x00, 0x4D, 0xD4, 0x00, 0x00, 0x00, 0xDD, 0x90, 0x00, 0x4B,
+    0xE5, 0x00, 0x00, 0x01, 0xEC, 0x70, 0x00, 0x38, 0xF6, 0x10, 0x00, 0x12,
+    0xFA, 0x50, 0x00, 0x12, 0xF9, 0x50, 0x00, 0x27, 0xF6, 0x10, 0x00, 0x01,
+    0x9B, 0x81, 0x01, 0x4B, 0x93, 0x00, 0x00, 0x12, 0x6B, 0xA5, 0x03, 0x8D,
+    0x74, 0x20, 0x00, 0x37, 0x7A, 0xCC, 0x08, 0xCC, 0x77, 0x51, 0x01, 0x6F,
+    0xFF, 0xFF, 0x0A, 0xFF, 0xFF, 0xB2, 0x00, 0x25, 0x55, 0x55, 0x03, 0x55,
+    0x55, 0x41, 0x00, 0x12, 0xFD, 0x80, 0x00, 0x00, 0x26, 0xE8, 0x30, 0x00,
+    0x43, 0x49, 0xA5, 0x34, 0x00, 0xC8, 0x8D, 0x35, 0x8C, 0x00, 0xC8, 0x40,
+    0x04, 0x8C, 0x00, 0x43, 0x10, 0x01, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x93, 0x00, 0x00, 0x00,
+    0x5F, 0x93, 0x00, 0x00, 0x00, 0x5F, 0x93, 0x00, 0x00, 0x00, 0x5F, 0x93,
+    0x00, 0x00, 0x00, 0x5F, 0x93, 0x00, 0x00, 0x00, 0x5F, 0x93, 0x00, 0x00,
+    0x00, 0x5F, 0x93, 0x00, 0x00, 0x00, 0x5F, 0x93, 0x00, 0x00, 0x00, 0x5F,
+    0x93, 0x00, 0x00, 0x00, 0x5E, 0xA3, 0x00, 0x00, 0x00, 0x4C, 0xC6, 0x22,
+    0x21, 0x00, 0x3A, 0xFA, 0x75, 0x72, 0x00, 0x01, 0xAC, 0xEF, 0xD4, 0x00,
+    0x00, 0x34, 0x55, 0x41, 0x00, 0x00, 0x05, 0xAF, 0x83, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x8C, 0xFC, 0x40, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xDC, 0xE6,
+    0x10, 0x00, 0x00, 0x00, 0x04, 0xBD, 0x8F, 0x83, 0x00, 0x00, 0x00, 0x00,
+    0x9D, 0xA1, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x0C, 0xC8, 0x0C, 0xC8, 0x00,
+    0x00, 0x00, 0x12, 0xEB, 0x60, 0x9D, 0xA2, 0x00, 0x00, 0x02, 0x5F, 0x94,
+    0x06, 0xCC, 0x50, 0x00, 0x00, 0x3A, 0xF6, 0x10, 0x1A, 0xDA, 0x00, 0x00,
+    0x05, 0xDD, 0x50, 0x00, 0x9D, 0xD1, 0x00, 0x02, 0x7F, 0xD8, 0x55, 0x5A,
+    0xDF, 0x31, 0x00, 0x49, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0x20, 0x07, 0xCF,
+    0x77, 0x77, 0x77, 0x9F, 0xB4, 0x01, 0x9D, 0xC2, 0x22, 0x22, 0x25, 0xCE,
+    0x51, 0x3B, 0xD8, 0x00, 0x00, 0x00, 0x38, 0xF7, 0x27, 0xCB, 0x40, 0x00,
+    0x00, 0x01, 0x4F, 0xA5, 0xCD, 0x90, 0x00, 0x00, 0x00, 0x00, 0xDD, 0x84,
+    0x43, 0x00, 0x00, 0x00, 0x00, 0x04, 0x43, 0xFF, 0xFF, 0xFF, 0xFE, 0xC8,
+    0x40, 0xFE, 0xC9, 0x99, 0x9A, 0xCC, 0xA6, 0xFC, 0x94, 0x44, 0x45, 0x8C,
+    0xDB, 0xFB, 0x60, 0x00, 0x00, 0x09, 0xEE, 0xFB, 0x60, 0x00, 0x00, 0x08,
+    0xDE, 0xFB, 0x60, 0x00, 0x01, 0x5B, 0xC9, 0xFD, 0x95, 0x55, 0x56, 0x9A,
+    0x94, 0xFF, 0xFF, 0xFF, 0xFF, 0xC6, 0x20, 0xFD, 0xA6, 0x66, 0x79, 0xED,
+    0x92, 0xFC, 0x82, 0x22, 0x23, 0x6B, 0xC8, 0xFB, 0x60, 0x00, 0x00, 0x2A,
+    0xDC, 0xFB, 0x60, 0x00, 0x00, 0x08, 0xDE, 0xFB, 0x60, 0x00, 0x00, 0x08,
+    0xDE, 0xFB, 0x60, 0x00, 0x00, 0x2A, 0xDC, 0xFC, 0x82, 0x22, 0x23, 0x7C,
+    0xD8, 0xFD, 0xA6, 0x66, 0x78, 0xEE, 0xB3, 0xFF, 0xFF, 0xFF, 0xFE, 0xB6,
+    0x20, 0x55, 0x55, 0x55, 0x55, 0x42, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFE, 0xC9, 0x99, 0x99, 0x99, 0x99, 0xFC, 0x94, 0x44, 0x44, 0x44,
+    0x44, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00,
+    0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00,
+    0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00,
+    0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00,
+    0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00,
+    0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00,
+    0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00,
+    0x00, 0x54, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0xC7, 0x00,
+    0x00, 0x00, 0x00, 0xAD, 0xDB, 0x00, 0x00, 0x00, 0x00, 0xDD, 0xDD, 0x10,
+    0x00, 0x00, 0x01, 0xFB, 0xBF, 0x21, 0x00, 0x00, 0x26, 0xF7, 0x7F, 0x62,
+    0x00, 0x00, 0x39, 0xD5, 0x5D, 0x93, 0x00, 0x00, 0x4C, 0xB4, 0x4B, 0xC4,
+    0x00, 0x01, 0x5F, 0x83, 0x38, 0xF5, 0x10, 0x03, 0x8F, 0x31, 0x13, 0xF8,
+    0x30, 0x05, 0xAE, 0x10, 0x01, 0xEA, 0x50, 0x08, 0xBB, 0x00, 0x00, 0xBB,
+    0x70, 0x0A, 0xC8, 0x00, 0x00, 0x8C, 0x90, 0x4B, 0xB3, 0x00, 0x00, 0x3B,
+    0xB4, 0x7B, 0x91, 0x00, 0x00, 0x1A, 0xC7, 0xAC, 0x92, 0x22, 0x22, 0x29,
+    0xCA, 0xDC, 0xA7, 0x77, 0x77, 0x7A, 0xCD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xAF, 0xEC, 0x99, 0x99, 0x99, 0x96, 0xFC, 0x94, 0x44, 0x44, 0x44, 0x3F,
+    0xB6, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x0F, 0xB6,
+    0x00, 0x00, 0x00, 0x00, 0xFD, 0x95, 0x55, 0x55, 0x55, 0x3F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFA, 0xFD, 0xA7, 0x77, 0x77, 0x77, 0x4F, 0xC8, 0x22, 0x22,
+    0x22, 0x21, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x0F, 0xB6, 0x00, 0x00, 0x00,
+    0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x0F, 0xB6, 0x00, 0x00, 0x00, 0x00,
+    0xFC, 0x82, 0x22, 0x22, 0x22, 0x1F, 0xDA, 0x77, 0x77, 0x77, 0x74, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xA5, 0x55, 0x55, 0x55, 0x55, 0x53, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x99, 0x99, 0x99, 0x99, 0xAD, 0xED, 0x44, 0x44,
+    0x44, 0x44, 0x8C, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x9D, 0xB2, 0x00, 0x00,
+    0x00, 0x14, 0xF9, 0x40, 0x00, 0x00, 0x00, 0x4A, 0xC6, 0x10, 0x00, 0x00,
+    0x03, 0x7E, 0x83, 0x00, 0x00, 0x00, 0x07, 0xBE, 0x21, 0x00, 0x00, 0x00,
+    0x5C, 0xC5, 0x00, 0x00, 0x00, 0x01, 0xBB, 0x82, 0x00, 0x00, 0x00, 0x25,
+    0xE9, 0x50, 0x00, 0x00, 0x00, 0x4B, 0xD5, 0x10, 0x00, 0x00, 0x05, 0xAF,
+    0x41, 0x00, 0x00, 0x00, 0x29, 0xCB, 0x10, 0x00, 0x00, 0x00, 0x6C, 0xC8,
+    0x22, 0x22, 0x22, 0x22, 0xCE, 0xC7, 0x77, 0x77, 0x77, 0x77, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xFB, 0x60,
+    0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60,
+    0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60,
+    0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFD, 0x95,
+    0x55, 0x55, 0x59, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xA7,
+    0x77, 0x77, 0x7A, 0xDF, 0xFC, 0x82, 0x22, 0x22, 0x28, 0xCF, 0xFB, 0x60,
+    0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60,
+    0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60,
+    0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60,
+    0x00, 0x00, 0x06, 0xBF, 0x54, 0x20, 0x00, 0x00, 0x02, 0x45, 0x00, 0x38,
+    0xDE, 0xED, 0x83, 0x00, 0x05, 0x9D, 0xBA, 0xAB, 0xD9, 0x40, 0x29, 0xDD,
+    0x75, 0x57, 0xDC, 0x81, 0x5C, 0xD9, 0x00, 0x00, 0x8D, 0xB4, 0xAD, 0xB2,
+    0x00, 0x00, 0x1A, 0xD9, 0xCD, 0x91, 0x00, 0x00, 0x09, 0xDC, 0xDD, 0x80,
+    0x55, 0x55, 0x08, 0xDD, 0xED, 0x80, 0xFF, 0xFF, 0x08, 0xDE, 0xFC, 0x70,
+    0x66, 0x66, 0x07, 0xCF, 0xFD, 0x80, 0x22, 0x22, 0x08, 0xCE, 0xED, 0x80,
+    0x00, 0x00, 0x08, 0xDE, 0xDD, 0x90, 0x00, 0x00, 0x09, 0xDD, 0xAD, 0xB2,
+    0x00, 0x00, 0x2B, 0xD9, 0x7C, 0xC6, 0x00, 0x00, 0x6C, 0xC6, 0x3A, 0xDB,
+    0x33, 0x33, 0xBC, 0xA3, 0x07, 0xCF, 0xA8, 0x8A, 0xFB, 0x60, 0x00, 0x38,
+    0xDE, 0xED, 0x73, 0x00, 0x00, 0x13, 0x45, 0x54, 0x21, 0x00, 0x3B, 0xFF,
+    0xFF, 0xFF, 0xFB, 0x62, 0x68, 0x8D, 0xED, 0x98, 0x53, 0x02, 0x33, 0xBE,
+    0xB4, 0x32, 0x10, 0x00, 0x09, 0xDA, 0x00, 0x00, 0x00, 0x00, 0x9D, 0xA0,
+    0x00, 0x00, 0x00, 0x09, 0xDA, 0x00, 0x00, 0x00, 0x00, 0x9D, 0xA0, 0x00,
+    0x00, 0x00, 0x09, 0xDA, 0x00, 0x00, 0x00, 0x00, 0x9D, 0xA0, 0x00, 0x00,
+    0x00, 0x09, 0xDA, 0x00, 0x00, 0x00, 0x00, 0x9D, 0xA0, 0x00, 0x00, 0x00,
+    0x09, 0xDA, 0x00, 0x00, 0x00, 0x00, 0x9D, 0xA0, 0x00, 0x00, 0x00, 0x09,
+    0xDA, 0x00, 0x00, 0x01, 0x12, 0xAD, 0xB2, 0x11, 0x01, 0x34, 0x5C, 0xEC,
+    0x54, 0x31, 0x3B, 0xFF, 0xFF, 0xFF, 0xFB, 0x61, 0x45, 0x55, 0x55, 0x55,
+    0x42, 0xFB, 0x60, 0x00, 0x00, 0x4B, 0xDB, 0x00, 0xFB, 0x60, 0x00, 0x12,
+    0xBC, 0xA4, 0x00, 0xFB, 0x60, 0x00, 0x26, 0xDA, 0x60, 0x00, 0xFB, 0x60,
+    0x01, 0x5D, 0xC5, 0x10, 0x00, 0xFB, 0x60, 0x18, 0xCD, 0x10, 0x00, 0x00,
+    0xFB, 0x60, 0x8B, 0xA5, 0x00, 0x00, 0x00, 0xFB, 0x73, 0xCA, 0x71, 0x00,
+    0x00, 0x00, 0xFB, 0x99, 0xF6, 0x10, 0x00, 0x00, 0x00, 0xFE, 0xDD, 0xEA,
+    0x50, 0x00, 0x00, 0x00, 0xFE, 0xB6, 0x9B, 0x92, 0x00, 0x00, 0x00, 0xFD,
+    0x81, 0x4A, 0xB7, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x07, 0xCD, 0x10, 0x00,
+    0x00, 0xFB, 0x60, 0x01, 0x6E, 0xA3, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x39,
+    0xD7, 0x30, 0x00, 0xFB, 0x60, 0x00, 0x14, 0xEB, 0x61, 0x00, 0xFB, 0x60,
+    0x00, 0x00, 0xBD, 0xB3, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x2A, 0xED, 0x10,
+    0x54, 0x20, 0x00, 0x00, 0x13, 0x54, 0x00, 0x00, 0x00, 0x05, 0xAF, 0x83,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0xEB, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0x19, 0xDB, 0xE5, 0x10, 0x00, 0x00, 0x00, 0x03, 0xBC, 0x6F, 0x72, 0x00,
+    0x00, 0x00, 0x00, 0x8C, 0x90, 0xCA, 0x60, 0x00, 0x00, 0x00, 0x0C, 0xB7,
+    0x08, 0xB8, 0x00, 0x00, 0x00, 0x12, 0xEA, 0x50, 0x4B, 0xA2, 0x00, 0x00,
+    0x01, 0x4F, 0x83, 0x01, 0xAB, 0x50, 0x00, 0x00, 0x3A, 0xD5, 0x00, 0x08,
+    0xBA, 0x00, 0x00, 0x05, 0xDA, 0x30, 0x00, 0x6A, 0xD1, 0x00, 0x02, 0x6F,
+    0x62, 0x00, 0x03, 0x8F, 0x31, 0x00, 0x49, 0xF2, 0x10, 0x00, 0x16, 0xF6,
+    0x20, 0x07, 0xBC, 0x00, 0x00, 0x00, 0x4C, 0xB4, 0x01, 0x9C, 0x80, 0x00,
+    0x00, 0x03, 0x9E, 0x51, 0x3B, 0xB4, 0x00, 0x00, 0x00, 0x26, 0xF7, 0x27,
+    0xCA, 0x10, 0x00, 0x00, 0x01, 0x3F, 0xA5, 0xCB, 0x70, 0x00, 0x00, 0x00,
+    0x00, 0xED, 0x84, 0x42, 0x00, 0x00, 0x00, 0x00, 0x05, 0x43, 0xFD, 0x80,
+    0x00, 0x00, 0x09, 0xEF, 0xFE, 0xA1, 0x00, 0x00, 0x2A, 0xFF, 0xFE, 0xA3,
+    0x00, 0x00, 0x4A, 0xEF, 0xFD, 0xA5, 0x00, 0x00, 0x6A, 0xDF, 0xFC, 0xA9,
+    0x00, 0x00, 0x9A, 0xCF, 0xFC, 0xAA, 0x00, 0x00, 0xAA, 0xCF, 0xFC, 0xAA,
+    0x10, 0x01, 0xAA, 0xCF, 0xFC, 0xA9, 0x21, 0x13, 0x8A, 0xCF, 0xFC, 0x96,
+    0x62, 0x27, 0x59, 0xCF, 0xFC, 0x84, 0x83, 0x39, 0x38, 0xCF, 0xFC, 0x82,
+    0xB4, 0x4B, 0x18, 0xCF, 0xFC, 0x70, 0xD4, 0x4D, 0x07, 0xCF, 0xFC, 0x70,
+    0xB7, 0x7A, 0x07, 0xCF, 0xFC, 0x70, 0x9A, 0xA8, 0x07, 0xCF, 0xFC, 0x70,
+    0x7B, 0xB6, 0x07, 0xCF, 0xFC, 0x70, 0x5C, 0xB4, 0x07, 0xCF, 0xFC, 0x70,
+    0x2B, 0xA1, 0x07, 0xCF, 0x54, 0x20, 0x14, 0x30, 0x02, 0x45, 0xFE, 0x90,
+    0x00, 0x00, 0x05, 0xAF, 0xFF, 0xB5, 0x00, 0x00, 0x05, 0xAF, 0xFE, 0xC9,
+    0x00, 0x00, 0x05, 0xAF, 0xFD, 0xDE, 0x10, 0x00, 0x05, 0xAF, 0xFA, 0x9D,
+    0x83, 0x00, 0x05, 0xAF, 0xFA, 0x77, 0xD5, 0x10, 0x05, 0xAF, 0xFA, 0x63,
+    0xE8, 0x30, 0x05, 0xAF, 0xFA, 0x50, 0xBA, 0x70, 0x05, 0xAF, 0xFA, 0x50,
+    0x3B, 0xB3, 0x05, 0xAF, 0xFA, 0x50, 0x18, 0xB9, 0x05, 0xAF, 0xFA, 0x50,
+    0x05, 0x9D, 0x26, 0xAF, 0xFA, 0x50, 0x01, 0x6F, 0x56, 0xAF, 0xFA, 0x50,
+    0x00, 0x38, 0xD9, 0xAF, 0xFA, 0x50, 0x00, 0x13, 0xEC, 0xCF, 0xFA, 0x50,
+    0x00, 0x01, 0xCD, 0xEF, 0xFA, 0x50, 0x00, 0x00, 0x7C, 0xFF, 0xFA, 0x50,
+    0x00, 0x00, 0x09, 0xEF, 0x53, 0x20, 0x00, 0x00, 0x03, 0x55, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x55,
+    0x55, 0x55, 0x55, 0x30, 0x0A, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0x04, 0x77,
+    0x77, 0x77, 0x77, 0x40, 0x01, 0x22, 0x22, 0x22, 0x22, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x38,
+    0xDE, 0xED, 0x83, 0x00, 0x05, 0x9D, 0xBA, 0xAB, 0xD9, 0x40, 0x29, 0xDD,
+    0x75, 0x57, 0xDC, 0x81, 0x5C, 0xD9, 0x00, 0x00, 0x8D, 0xB4, 0xAD, 0xB2,
+    0x00, 0x00, 0x1A, 0xD9, 0xCD, 0x91, 0x00, 0x00, 0x09, 0xDC, 0xDD, 0x80,
+    0x00, 0x00, 0x08, 0xDD, 0xED, 0x80, 0x00, 0x00, 0x08, 0xDE, 0xFC, 0x70,
+    0x00, 0x00, 0x07, 0xCF, 0xFD, 0x80, 0x00, 0x00, 0x08, 0xCE, 0xED, 0x80,
+    0x00, 0x00, 0x08, 0xDE, 0xDD, 0x90, 0x00, 0x00, 0x09, 0xDD, 0xAD, 0xB2,
+    0x00, 0x00, 0x2B, 0xD9, 0x7C, 0xC6, 0x00, 0x00, 0x6C, 0xC6, 0x3A, 0xDB,
+    0x33, 0x33, 0xBC, 0xA3, 0x07, 0xCF, 0xA8, 0x8A, 0xFB, 0x60, 0x00, 0x38,
+    0xDE, 0xED, 0x73, 0x00, 0x00, 0x13, 0x45, 0x54, 0x21, 0x00, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xC9, 0x99, 0x99, 0x9C, 0xEF, 0xFC, 0x94,
+    0x44, 0x44, 0x49, 0xCF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60,
+    0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60,
+    0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60,
+    0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60,
+    0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60,
+    0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60,
+    0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60,
+    0x00, 0x00, 0x06, 0xBF, 0x54, 0x20, 0x00, 0x00, 0x02, 0x45, 0xFF, 0xFF,
+    0xFF, 0xED, 0xA6, 0x20, 0xFE, 0xC9, 0x99, 0xAB, 0xDC, 0x93, 0xFC, 0x94,
+    0x44, 0x56, 0xAD, 0xC8, 0xFB, 0x60, 0x00, 0x00, 0x3B, 0xED, 0xFB, 0x60,
+    0x00, 0x00, 0x08, 0xDF, 0xFB, 0x60, 0x00, 0x00, 0x09, 0xDD, 0xFB, 0x60,
+    0x00, 0x11, 0x4B, 0xDB, 0xFB, 0x60, 0x01, 0x23, 0xBE, 0xC6, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xE9, 0x40, 0xFE, 0xC9, 0x99, 0x87, 0x53, 0x10, 0xFC, 0x94,
+    0x44, 0x32, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60,
+    0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60,
+    0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60,
+    0x00, 0x00, 0x00, 0x00, 0x54, 0x20, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xC7, 0xBE, 0xEB, 0x99, 0x99, 0x99, 0x84, 0x7C, 0xDA,
+    0x54, 0x44, 0x44, 0x42, 0x19, 0xCC, 0x10, 0x00, 0x00, 0x00, 0x01, 0x6E,
+    0xA3, 0x00, 0x00, 0x00, 0x00, 0x37, 0xD8, 0x30, 0x00, 0x00, 0x00, 0x13,
+    0xCB, 0x72, 0x00, 0x00, 0x00, 0x00, 0x6C, 0xC5, 0x00, 0x00, 0x00, 0x00,
+    0x5C, 0xC6, 0x00, 0x00, 0x00, 0x01, 0xBC, 0x82, 0x00, 0x00, 0x00, 0x25,
+    0xE9, 0x50, 0x00, 0x00, 0x00, 0x4B, 0xD5, 0x10, 0x00, 0x00, 0x05, 0xAF,
+    0x41, 0x00, 0x00, 0x00, 0x29, 0xCA, 0x10, 0x00, 0x00, 0x00, 0x6C, 0xC8,
+    0x22, 0x22, 0x22, 0x22, 0xDE, 0xC7, 0x77, 0x77, 0x77, 0x77, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x9D, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x68, 0x99, 0x9C, 0xEF, 0x99, 0x99, 0x93,
+    0x34, 0x44, 0x49, 0xCF, 0x54, 0x44, 0x41, 0x00, 0x00, 0x06, 0xBF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
+    0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x06, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x06, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x06, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x06, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+    0x45, 0x00, 0x00, 0x00, 0x6C, 0xC6, 0x00, 0x00, 0x01, 0x5E, 0xB4, 0x2A,
+    0xDA, 0x00, 0x00, 0x03, 0x8F, 0x62, 0x07, 0xBD, 0x21, 0x00, 0x06, 0xBE,
+    0x31, 0x04, 0x9F, 0x41, 0x00, 0x09, 0xDB, 0x00, 0x00, 0x4D, 0xB4, 0x00,
+    0x6C, 0xB4, 0x00, 0x00, 0x38, 0xE6, 0x10, 0xAC, 0x91, 0x00, 0x00, 0x14,
+    0xE8, 0x41, 0xDA, 0x60, 0x00, 0x00, 0x00, 0xDB, 0x84, 0xF8, 0x30, 0x00,
+    0x00, 0x00, 0x6C, 0xEC, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xEE, 0x62,
+    0x00, 0x00, 0x00, 0x00, 0x08, 0xDF, 0x31, 0x00, 0x00, 0x00, 0x00, 0x06,
+    0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x06, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x06, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x06, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0x00, 0x00, 0x00,
+    0x01, 0x24, 0x59, 0xDF, 0x54, 0x31, 0x00, 0x02, 0x5B, 0xEF, 0xFF, 0xFD,
+    0x94, 0x00, 0x2A, 0xEE, 0x8A, 0xDF, 0x7B, 0xEF, 0x21, 0x7C, 0xC6, 0x38,
+    0xCF, 0x25, 0x9F, 0x72, 0xBD, 0xA2, 0x06, 0xBF, 0x01, 0x5E, 0xB4, 0xEC,
+    0x80, 0x06, 0xBF, 0x00, 0x4B, 0xD4, 0xFC, 0x70, 0x06, 0xBF, 0x00, 0x3A,
+    0xE5, 0xEC, 0x80, 0x06, 0xBF, 0x00, 0x4B, 0xD4, 0xCD, 0x91, 0x06, 0xBF,
+    0x01, 0x5D, 0xC4, 0x9D, 0xB3, 0x06, 0xBF, 0x02, 0x7F, 0x93, 0x2A, 0xEE,
+    0x8B, 0xDF, 0x7B, 0xEE, 0x21, 0x14, 0x8C, 0xCD, 0xEF, 0xCC, 0xA7, 0x10,
+    0x01, 0x37, 0x9C, 0xEF, 0xA8, 0x62, 0x00, 0x00, 0x00, 0x06, 0xBF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+    0x45, 0x00, 0x00, 0x00, 0xAD, 0xA2, 0x00, 0x00, 0x00, 0x12, 0xEB, 0x64,
+    0xAC, 0x80, 0x00, 0x00, 0x03, 0x8D, 0x73, 0x17, 0xBD, 0x31, 0x00, 0x01,
+    0x6C, 0xA4, 0x00, 0x27, 0xF7, 0x20, 0x00, 0x49, 0xF3, 0x10, 0x00, 0x38,
+    0xF7, 0x20, 0x3B, 0xC7, 0x00, 0x00, 0x01, 0x3D, 0xB6, 0x19, 0xB9, 0x30,
+    0x00, 0x00, 0x00, 0x9C, 0xA5, 0xDA, 0x60, 0x00, 0x00, 0x00, 0x02, 0xAE,
+    0xDE, 0x61, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0x93, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0x9D, 0xDD, 0x61, 0x00, 0x00, 0x00, 0x00, 0x6B, 0xC8, 0xE9,
+    0x40, 0x00, 0x00, 0x00, 0x1D, 0xB7, 0x0C, 0xC9, 0x10, 0x00, 0x00, 0x39,
+    0xE6, 0x10, 0x3B, 0xD9, 0x00, 0x00, 0x26, 0xD8, 0x30, 0x01, 0x7B, 0xD3,
+    0x10, 0x05, 0x9D, 0x41, 0x00, 0x03, 0x8E, 0x73, 0x01, 0x9C, 0xA0, 0x00,
+    0x00, 0x04, 0xCD, 0x51, 0xAC, 0xA1, 0x00, 0x00, 0x00, 0x13, 0xFB, 0x73,
+    0x43, 0x00, 0x00, 0x00, 0x00, 0x15, 0x42, 0xFB, 0x60, 0x07, 0xCF, 0x00,
+    0x3A, 0xF5, 0xFB, 0x60, 0x07, 0xCF, 0x00, 0x3A, 0xF5, 0xFB, 0x60, 0x07,
+    0xCF, 0x00, 0x3A, 0xF5, 0xFB, 0x60, 0x07, 0xCF, 0x00, 0x3A, 0xF5, 0xFB,
+    0x60, 0x07, 0xCF, 0x00, 0x3A, 0xF5, 0xFB, 0x60, 0x07, 0xCF, 0x00, 0x3A,
+    0xF5, 0xEC, 0x70, 0x07, 0xCF, 0x00, 0x3A, 0xE5, 0xEC, 0x70, 0x07, 0xCF,
+    0x00, 0x4B, 0xE5, 0xAD, 0xA1, 0x07, 0xCF, 0x00, 0x5E, 0xB4, 0x6C, 0xD9,
+    0x59, 0xCF, 0x57, 0xAF, 0x62, 0x28, 0xCC, 0xAC, 0xEF, 0x9B, 0xCC, 0x31,
+    0x03, 0x6B, 0xEF, 0xFF, 0xFD, 0xA5, 0x00, 0x00, 0x00, 0x07, 0xCF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x07, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+    0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xCF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x07, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x45, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x8B, 0xEF, 0xDA, 0x51, 0x00, 0x00, 0x03, 0x8D, 0xBA,
+    0xAB, 0xCB, 0x70, 0x00, 0x01, 0x5C, 0xC8, 0x65, 0x7A, 0xCC, 0x21, 0x00,
+    0x49, 0xF7, 0x20, 0x00, 0x5A, 0xF5, 0x20, 0x07, 0xCF, 0x10, 0x00, 0x01,
+    0x5F, 0xB4, 0x00, 0x8D, 0xD0, 0x00, 0x00, 0x05, 0xDD, 0x40, 0x09, 0xDC,
+    0x00, 0x00, 0x00, 0x4C, 0xE5, 0x00, 0xAE, 0xB0, 0x00, 0x00, 0x04, 0xBF,
+    0x50, 0x09, 0xDC, 0x00, 0x00, 0x00, 0x4C, 0xE5, 0x00, 0x9D, 0xD0, 0x00,
+    0x00, 0x04, 0xDD, 0x40, 0x07, 0xCE, 0x10, 0x00, 0x00, 0x5E, 0xB4, 0x00,
+    0x5A, 0xF2, 0x10, 0x00, 0x16, 0xF8, 0x30, 0x01, 0x6F, 0x72, 0x00, 0x05,
+    0x9F, 0x21, 0x00, 0x03, 0x9B, 0x41, 0x01, 0x8B, 0x91, 0x00, 0x02, 0x46,
+    0xD8, 0x30, 0x5A, 0xB7, 0x21, 0x01, 0x57, 0x7C, 0xC8, 0x0C, 0xCA, 0x77,
+    0x30, 0x1A, 0xFF, 0xFF, 0xA0, 0xFF, 0xFF, 0xF6, 0x10, 0x35, 0x55, 0x53,
+    0x05, 0x55, 0x55, 0x20, 0x00, 0x4C, 0x62, 0x26, 0xC4, 0x00, 0x04, 0xC6,
+    0x22, 0x6C, 0x40, 0x00, 0x38, 0x41, 0x14, 0x83, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x3B, 0xFF, 0xFF, 0xFF, 0xFB, 0x62, 0x68, 0x8D, 0xED, 0x98,
+    0x53, 0x02, 0x33, 0xBE, 0xB4, 0x32, 0x10, 0x00, 0x09, 0xDA, 0x00, 0x00,
+    0x00, 0x00, 0x9D, 0xA0, 0x00, 0x00, 0x00, 0x09, 0xDA, 0x00, 0x00, 0x00,
+    0x00, 0x9D, 0xA0, 0x00, 0x00, 0x00, 0x09, 0xDA, 0x00, 0x00, 0x00, 0x00,
+    0x9D, 0xA0, 0x00, 0x00, 0x00, 0x09, 0xDA, 0x00, 0x00, 0x00, 0x00, 0x9D,
+    0xA0, 0x00, 0x00, 0x00, 0x09, 0xDA, 0x00, 0x00, 0x00, 0x00, 0x9D, 0xA0,
+    0x00, 0x00, 0x00, 0x09, 0xDA, 0x00, 0x00, 0x01, 0x12, 0xAD, 0xB2, 0x11,
+    0x01, 0x34, 0x5C, 0xEC, 0x54, 0x31, 0x3B, 0xFF, 0xFF, 0xFF, 0xFB, 0x61,
+    0x45, 0x55, 0x55, 0x55, 0x42, 0x00, 0x00, 0xC8, 0x40, 0x6A, 0x80, 0x00,
+    0x00, 0x00, 0xC8, 0x40, 0x6A, 0x80, 0x00, 0x00, 0x00, 0x85, 0x30, 0x47,
+    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6C, 0xC6, 0x00,
+    0x00, 0x01, 0x5E, 0xB4, 0x2A, 0xDA, 0x00, 0x00, 0x03, 0x8F, 0x62, 0x07,
+    0xBD, 0x21, 0x00, 0x06, 0xBE, 0x31, 0x04, 0x9F, 0x41, 0x00, 0x09, 0xDB,
+    0x00, 0x00, 0x4D, 0xB4, 0x00, 0x6C, 0xB4, 0x00, 0x00, 0x38, 0xE6, 0x10,
+    0xAC, 0x91, 0x00, 0x00, 0x14, 0xE8, 0x41, 0xDA, 0x60, 0x00, 0x00, 0x00,
+    0xDB, 0x84, 0xF8, 0x30, 0x00, 0x00, 0x00, 0x6C, 0xEC, 0xB4, 0x00, 0x00,
+    0x00, 0x00, 0x2A, 0xEE, 0x62, 0x00, 0x00, 0x00, 0x00, 0x08, 0xDF, 0x31,
+    0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
+    0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x06, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x06, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x45,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xB7, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x09, 0xA3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x48, 0xA9, 0x85, 0x17, 0x83, 0x00, 0x15, 0x9C, 0xCB,
+    0xBA, 0x5B, 0xB4, 0x00, 0x2A, 0xED, 0x77, 0x9D, 0xCE, 0xB2, 0x00, 0x9D,
+    0xB2, 0x00, 0x01, 0xEF, 0xA1, 0x00, 0xCD, 0x91, 0x00, 0x00, 0xCE, 0xA1,
+    0x00, 0xEC, 0x80, 0x00, 0x00, 0xAD, 0xA0, 0x00, 0xFC, 0x70, 0x00, 0x00,
+    0x9D, 0xA0, 0x00, 0xFC, 0x70, 0x00, 0x00, 0x9D, 0xA0, 0x00, 0xEC, 0x80,
+    0x00, 0x00, 0xAD, 0xA0, 0x00, 0xCD, 0x91, 0x00, 0x00, 0xCE, 0xA0, 0x00,
+    0x9D, 0xB2, 0x00, 0x01, 0xEF, 0xA0, 0x00, 0x3B, 0xED, 0x66, 0x8C, 0xCE,
+    0xC7, 0x10, 0x15, 0x9C, 0xCB, 0xA9, 0x5A, 0xDC, 0x31, 0x02, 0x48, 0xA9,
+    0x74, 0x16, 0x89, 0x21, 0x00, 0x00, 0x07, 0xBE, 0x00, 0x00, 0x00, 0x07,
+    0xBA, 0x00, 0x00, 0x00, 0x08, 0xB7, 0x00, 0x00, 0x00, 0x09, 0xA3, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x79, 0xA9, 0x98, 0x52, 0x48, 0xBB,
+    0xCB, 0xBB, 0x83, 0xAD, 0xC8, 0x56, 0x79, 0xA3, 0xEB, 0x70, 0x00, 0x00,
+    0x00, 0xCC, 0x92, 0x00, 0x00, 0x00, 0x7B, 0xB7, 0x55, 0x30, 0x00, 0x17,
+    0xCF, 0xFF, 0xA0, 0x00, 0x6C, 0xD9, 0x55, 0x30, 0x00, 0xBC, 0x93, 0x22,
+    0x10, 0x00, 0xEC, 0x70, 0x00, 0x00, 0x00, 0xEC, 0x70, 0x00, 0x00, 0x00,
+    0x9D, 0xD9, 0x66, 0x78, 0xD4, 0x38, 0xAB, 0xBB, 0xBB, 0xA3, 0x03, 0x68,
+    0xA9, 0x98, 0x52, 0x00, 0x00, 0x07, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x7B,
+    0xA0, 0x00, 0x00, 0x00, 0x08, 0xB7, 0x00, 0x00, 0x00, 0x00, 0x9A, 0x30,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x64, 0x48, 0x99, 0x95, 0x20,
+    0xFA, 0x89, 0xBB, 0xCC, 0xA5, 0x2F, 0xDD, 0xE7, 0x67, 0xAF, 0xA5, 0xFF,
+    0xB3, 0x00, 0x00, 0xCD, 0x9F, 0xD9, 0x10, 0x00, 0x0A, 0xD9, 0xFC, 0x70,
+    0x00, 0x00, 0x9D, 0xAF, 0xB6, 0x00, 0x00, 0x09, 0xDA, 0xFB, 0x60, 0x00,
+    0x00, 0x9D, 0xAF, 0xB6, 0x00, 0x00, 0x09, 0xDA, 0xFB, 0x60, 0x00, 0x00,
+    0x9D, 0xAF, 0xB6, 0x00, 0x00, 0x09, 0xDA, 0xFB, 0x60, 0x00, 0x00, 0x9D,
+    0xAF, 0xB6, 0x00, 0x00, 0x09, 0xDA, 0xA7, 0x40, 0x00, 0x00, 0x9D, 0xA0,
+    0x00, 0x00, 0x00, 0x09, 0xDA, 0x00, 0x00, 0x00, 0x00, 0x9D, 0xA0, 0x00,
+    0x00, 0x00, 0x09, 0xDA, 0x00, 0x00, 0x00, 0x00, 0x9D, 0xA0, 0x00, 0x00,
+    0x00, 0x09, 0xDA, 0x07, 0xBE, 0x00, 0x00, 0x7B, 0xA0, 0x00, 0x08, 0xB7,
+    0x00, 0x00, 0x9A, 0x30, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x74, 0x00, 0x00,
+    0xFB, 0x60, 0x00, 0x0F, 0xB6, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x0F, 0xB6,
+    0x00, 0x00, 0xFB, 0x60, 0x00, 0x0F, 0xB6, 0x00, 0x00, 0xFB, 0x60, 0x00,
+    0x0F, 0xB6, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x0E, 0xC7, 0x00, 0x00, 0xAD,
+    0xC8, 0x56, 0x44, 0x9C, 0xCC, 0xB7, 0x15, 0x79, 0xA9, 0x60, 0x00, 0x00,
+    0x01, 0x6F, 0xB4, 0x00, 0x00, 0x00, 0x04, 0x9E, 0x52, 0x00, 0x00, 0x14,
+    0x27, 0xAA, 0x34, 0x30, 0x00, 0x4C, 0x6A, 0x93, 0x6A, 0x80, 0x00, 0x4C,
+    0x62, 0x00, 0x6A, 0x80, 0x00, 0x14, 0x21, 0x00, 0x23, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60,
+    0x00, 0x00, 0xAD, 0xB4, 0xFB, 0x60, 0x00, 0x00, 0x5C, 0xC7, 0xFB, 0x60,
+    0x00, 0x00, 0x2A, 0xDA, 0xFB, 0x60, 0x00, 0x00, 0x09, 0xDC, 0xFB, 0x60,
+    0x00, 0x00, 0x07, 0xBE, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBE, 0xFB, 0x60,
+    0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x07, 0xBE, 0xEC, 0x70,
+    0x00, 0x00, 0x08, 0xCC, 0xBD, 0xA2, 0x00, 0x00, 0x3A, 0xC9, 0x8C, 0xC6,
+    0x22, 0x23, 0x7C, 0xB5, 0x3B, 0xEE, 0x76, 0x68, 0xEE, 0x91, 0x02, 0x5A,
+    0xEE, 0xED, 0x94, 0x10, 0x01, 0x23, 0x55, 0x54, 0x31, 0x00, 0x02, 0x6B,
+    0xEE, 0xC8, 0x1A, 0xB5, 0x00, 0x18, 0xBD, 0x99, 0xAB, 0x9D, 0xB3, 0x00,
+    0x4B, 0xDA, 0x44, 0x69, 0xDE, 0xB2, 0x00, 0x9D, 0xB2, 0x00, 0x01, 0xEF,
+    0xA1, 0x00, 0xDC, 0x80, 0x00, 0x00, 0xBE, 0xA0, 0x00, 0xEC, 0x70, 0x00,
+    0x00, 0xAD, 0xA0, 0x00, 0xFC, 0x70, 0x00, 0x00, 0x9D, 0xA0, 0x00, 0xFC,
+    0x70, 0x00, 0x00, 0x9D, 0xA0, 0x00, 0xDC, 0x80, 0x00, 0x00, 0xBE, 0xA0,
+    0x00, 0xBD, 0xA2, 0x00, 0x01, 0xDE, 0xA0, 0x00, 0x7C, 0xC6, 0x22, 0x35,
+    0xEF, 0xB3, 0x00, 0x3B, 0xED, 0x66, 0x8C, 0xCE, 0xC7, 0x10, 0x02, 0x6C,
+    0xFE, 0xB7, 0x19, 0xDE, 0x31, 0x01, 0x24, 0x55, 0x42, 0x03, 0x45, 0x10,
+    0x03, 0x6B, 0xEE, 0xDC, 0x41, 0x00, 0x38, 0xBC, 0x99, 0xAC, 0xB6, 0x30,
+    0x6C, 0xD8, 0x44, 0x58, 0xEA, 0x50, 0xBD, 0xA1, 0x00, 0x01, 0xDD, 0x90,
+    0xEC, 0x70, 0x00, 0x00, 0xBD, 0xA0, 0xFB, 0x60, 0x00, 0x00, 0xCD, 0x90,
+    0xFB, 0x60, 0x00, 0x23, 0xDB, 0x60, 0xFB, 0x60, 0x01, 0x49, 0xE7, 0x20,
+    0xFB, 0x60, 0xFF, 0xEC, 0x31, 0x00, 0xFB, 0x60, 0x89, 0x9A, 0xB8, 0x40,
+    0xFB, 0x60, 0x34, 0x56, 0xBB, 0x93, 0xFB, 0x60, 0x00, 0x00, 0x3B, 0xD8,
+    0xFB, 0x60, 0x00, 0x00, 0x07, 0xCD, 0xFB, 0x60, 0x00, 0x00, 0x07, 0xCE,
+    0xFB, 0x60, 0x00, 0x00, 0x08, 0xCE, 0xFB, 0x60, 0x00, 0x00, 0x1A, 0xDC,
+    0xFF, 0xDA, 0x76, 0x67, 0xDE, 0xB4, 0xFE, 0xCB, 0xBB, 0xBB, 0xB8, 0x51,
+    0xFC, 0xA7, 0x9A, 0x99, 0x73, 0x10, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x00,
+    0xFB, 0x60, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x00,
+    0xFB, 0x60, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x00,
+    0xCD, 0x90, 0x00, 0x00, 0x08, 0xCC, 0x8C, 0xA2, 0x00, 0x00, 0x2A, 0xC9,
+    0x5C, 0xC5, 0x00, 0x00, 0x4B, 0xC5, 0x1A, 0xD9, 0x00, 0x00, 0x8C, 0xA2,
+    0x07, 0xBE, 0x00, 0x00, 0xDC, 0x70, 0x04, 0x9F, 0x31, 0x12, 0xEA, 0x50,
+    0x02, 0x7F, 0x62, 0x25, 0xF8, 0x30, 0x00, 0x5E, 0xA3, 0x38, 0xE5, 0x00,
+    0x00, 0x38, 0xE5, 0x5D, 0xA3, 0x00, 0x00, 0x25, 0xF8, 0x8E, 0x62, 0x00,
+    0x00, 0x12, 0xEB, 0xBF, 0x31, 0x00, 0x00, 0x00, 0xCD, 0xEE, 0x00, 0x00,
+    0x00, 0x00, 0x6C, 0xD8, 0x00, 0x00, 0x00, 0x00, 0x6C, 0xC5, 0x00, 0x00,
+    0x00, 0x00, 0x7C, 0xB2, 0x00, 0x00, 0x00, 0x00, 0xAD, 0x90, 0x00, 0x00,
+    0x00, 0x00, 0xDC, 0x80, 0x00, 0x00, 0x00, 0x00, 0xEC, 0x70, 0x00, 0x00,
+    0x00, 0x00, 0xA8, 0x50, 0x00, 0x00, 0x00, 0x12, 0xAD, 0xEE, 0xC9, 0x51,
+    0x00, 0x38, 0xDA, 0x99, 0xAB, 0x93, 0x00, 0x4C, 0xC7, 0x44, 0x69, 0x72,
+    0x00, 0x5E, 0x93, 0x00, 0x01, 0x10, 0x00, 0x4B, 0xD5, 0x10, 0x00, 0x00,
+    0x00, 0x25, 0xEB, 0x73, 0x00, 0x00, 0x00, 0x12, 0xBD, 0xC8, 0x31, 0x00,
+    0x00, 0x00, 0x5B, 0xFF, 0xA4, 0x10, 0x02, 0x6C, 0xEB, 0x87, 0xED, 0x81,
+    0x28, 0xBC, 0x64, 0x32, 0x8C, 0xB5, 0x6B, 0xC8, 0x10, 0x00, 0x3B, 0xD9,
+    0xBD, 0xA1, 0x00, 0x00, 0x08, 0xDD, 0xEC, 0x70, 0x00, 0x00, 0x07, 0xCF,
+    0xEC, 0x70, 0x00, 0x00, 0x08, 0xCE, 0xDD, 0x81, 0x00, 0x00, 0x19, 0xDC,
+    0xBD, 0xA2, 0x00, 0x00, 0x3B, 0xD9, 0x3A, 0xEE, 0x76, 0x68, 0xEE, 0xA2,
+    0x15, 0x8B, 0xCC, 0xCC, 0xB7, 0x41, 0x01, 0x37, 0x9A, 0xA9, 0x63, 0x10,
+    0x16, 0xAD, 0xFE, 0xDC, 0x72, 0x7B, 0xCA, 0x89, 0x9A, 0x93, 0xCD, 0xA5,
+    0x44, 0x56, 0x62, 0xEB, 0x70, 0x00, 0x00, 0x00, 0xBD, 0xA3, 0x00, 0x00,
+    0x00, 0x49, 0xBB, 0xAA, 0x70, 0x00, 0x39, 0xCD, 0xCC, 0x80, 0x00, 0x6C,
+    0xD9, 0x55, 0x30, 0x00, 0xEC, 0x70, 0x00, 0x00, 0x00, 0xEC, 0x70, 0x00,
+    0x00, 0x00, 0xCC, 0x93, 0x22, 0x23, 0x41, 0x9D, 0xD9, 0x66, 0x78, 0xD4,
+    0x05, 0x9D, 0xEE, 0xEC, 0x83, 0x02, 0x34, 0x55, 0x54, 0x31, 0x7C, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xA4, 0x78, 0x88, 0x89, 0xAF, 0xC7, 0x23, 0x33, 0x35,
+    0x7A, 0xC8, 0x40, 0x00, 0x00, 0x5A, 0xF6, 0x20, 0x00, 0x00, 0xBD, 0xB4,
+    0x00, 0x00, 0x03, 0x7D, 0x95, 0x10, 0x00, 0x02, 0x6C, 0xB5, 0x10, 0x00,
+    0x00, 0x6B, 0xF4, 0x10, 0x00, 0x00, 0x3B, 0xD8, 0x00, 0x00, 0x00, 0x07,
+    0xCB, 0x40, 0x00, 0x00, 0x00, 0xAD, 0xA1, 0x00, 0x00, 0x00, 0x0D, 0xC8,
+    0x00, 0x00, 0x00, 0x00, 0xFC, 0x70, 0x00, 0x00, 0x00, 0x0E, 0xC7, 0x00,
+    0x00, 0x00, 0x00, 0xDC, 0x81, 0x00, 0x00, 0x00, 0x0A, 0xDA, 0x20, 0x00,
+    0x00, 0x00, 0x3A, 0xEE, 0x85, 0x31, 0x00, 0x01, 0x58, 0xBC, 0xBB, 0xA7,
+    0x41, 0x01, 0x36, 0x9A, 0xBC, 0xC8, 0x40, 0x00, 0x00, 0x13, 0x6E, 0xD9,
+    0x00, 0x00, 0x00, 0x00, 0x9D, 0xA0, 0x00, 0x00, 0x00, 0x0B, 0xC8, 0x00,
+    0x00, 0x00, 0x01, 0xDA, 0x60, 0x00, 0x00, 0x01, 0x4F, 0x72, 0xF9, 0x66,
+    0xDE, 0xED, 0x83, 0x0F, 0xCB, 0xB9, 0x99, 0xBD, 0x84, 0xFE, 0xCA, 0x54,
+    0x57, 0xEB, 0x6F, 0xFB, 0x30, 0x00, 0x0C, 0xD9, 0xFD, 0x80, 0x00, 0x00,
+    0x9D, 0xAF, 0xC7, 0x00, 0x00, 0x09, 0xDA, 0xFB, 0x60, 0x00, 0x00, 0x9D,
+    0xAF, 0xB6, 0x00, 0x00, 0x09, 0xDA, 0xFB, 0x60, 0x00, 0x00, 0x9D, 0xAF,
+    0xB6, 0x00, 0x00, 0x09, 0xDA, 0xFB, 0x60, 0x00, 0x00, 0x9D, 0xAF, 0xB6,
+    0x00, 0x00, 0x09, 0xDA, 0xFB, 0x60, 0x00, 0x00, 0x9D, 0xA5, 0x42, 0x00,
+    0x00, 0x09, 0xDA, 0x00, 0x00, 0x00, 0x00, 0x9D, 0xA0, 0x00, 0x00, 0x00,
+    0x09, 0xDA, 0x00, 0x00, 0x00, 0x00, 0x9D, 0xA0, 0x00, 0x00, 0x00, 0x09,
+    0xDA, 0x00, 0x00, 0x00, 0x00, 0x69, 0x70, 0x01, 0x38, 0xDE, 0xED, 0x83,
+    0x00, 0x05, 0xAC, 0xA9, 0x9A, 0xC9, 0x50, 0x29, 0xCB, 0x54, 0x46, 0xCC,
+    0x81, 0x5C, 0xC5, 0x00, 0x00, 0x6C, 0xB4, 0xAD, 0x90, 0x00, 0x00, 0x1A,
+    0xDA, 0xCC, 0x80, 0x00, 0x00, 0x09, 0xCC, 0xDC, 0x71, 0x11, 0x11, 0x18,
+    0xCD, 0xEC, 0x72, 0x22, 0x22, 0x28, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xEC, 0x95, 0x55, 0x55, 0x5A, 0xDE, 0xEB, 0x70, 0x00, 0x00, 0x07,
+    0xCE, 0xDB, 0x70, 0x00, 0x00, 0x08, 0xCD, 0xAC, 0x90, 0x00, 0x00, 0x0A,
+    0xDA, 0x6C, 0xB3, 0x00, 0x00, 0x4B, 0xC6, 0x3A, 0xC8, 0x32, 0x23, 0x9C,
+    0xA3, 0x07, 0xCE, 0x86, 0x68, 0xFC, 0x70, 0x00, 0x38, 0xDE, 0xED, 0x83,
+    0x00, 0x00, 0x13, 0x45, 0x54, 0x31, 0x00, 0xFB, 0x60, 0x00, 0x0F, 0xB6,
+    0x00, 0x00, 0xFB, 0x60, 0x00, 0x0F, 0xB6, 0x00, 0x00, 0xFB, 0x60, 0x00,
+    0x0F, 0xB6, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x0F, 0xB6, 0x00, 0x00, 0xFB,
+    0x60, 0x00, 0x0E, 0xB7, 0x00, 0x00, 0xCC, 0x93, 0x22, 0x1A, 0xDC, 0x85,
+    0x64, 0x17, 0xBE, 0xFD, 0x80, 0x24, 0x55, 0x43, 0xFB, 0x60, 0x00, 0x25,
+    0xFA, 0x50, 0xFB, 0x60, 0x02, 0x5B, 0xA5, 0x20, 0xFB, 0x60, 0x15, 0x9C,
+    0x52, 0x00, 0xFB, 0x60, 0x3A, 0xC7, 0x00, 0x00, 0xFA, 0x62, 0xE9, 0x50,
+    0x00, 0x00, 0xFA, 0x89, 0xA5, 0x20, 0x00, 0x00, 0xFB, 0xBD, 0xA4, 0x10,
+    0x00, 0x00, 0xFE, 0xEE, 0xE6, 0x20, 0x00, 0x00, 0xFC, 0x70, 0x9C, 0xA2,
+    0x00, 0x00, 0xFB, 0x60, 0x38, 0xBA, 0x10, 0x00, 0xFB, 0x60, 0x04, 0x9D,
+    0x62, 0x00, 0xFB, 0x60, 0x00, 0x4B, 0xD6, 0x10, 0xFB, 0x60, 0x00, 0x01,
+    0xCD, 0x92, 0x54, 0x20, 0x00, 0x00, 0x44, 0x31, 0x06, 0xBE, 0xC6, 0x20,
+    0x00, 0x00, 0x00, 0x04, 0x69, 0xDA, 0x60, 0x00, 0x00, 0x00, 0x02, 0x34,
+    0xAC, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4B, 0xB4, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x09, 0xC9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xDC, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x19, 0xEE, 0x10, 0x00, 0x00, 0x00, 0x00, 0x4B,
+    0xFF, 0x41, 0x00, 0x00, 0x00, 0x00, 0xAB, 0xCD, 0x83, 0x00, 0x00, 0x00,
+    0x01, 0xDA, 0x9B, 0xC4, 0x00, 0x00, 0x00, 0x14, 0xF8, 0x68, 0xE5, 0x10,
+    0x00, 0x00, 0x39, 0xF6, 0x25, 0xF7, 0x20, 0x00, 0x01, 0x5E, 0x93, 0x01,
+    0xFA, 0x50, 0x00, 0x03, 0x8F, 0x52, 0x00, 0xCB, 0x70, 0x00, 0x06, 0xBE,
+    0x21, 0x00, 0x9C, 0x91, 0x00, 0x09, 0xDB, 0x00, 0x00, 0x6C, 0xB2, 0x00,
+    0x5C, 0xC5, 0x00, 0x00, 0x2A, 0xEB, 0x31, 0x9C, 0xA2, 0x00, 0x00, 0x17,
+    0xBD, 0x62, 0x88, 0x60, 0x00, 0x00, 0x04, 0x7A, 0x52, 0xFB, 0x60, 0x00,
+    0x00, 0x9D, 0xAF, 0xB6, 0x00, 0x00, 0x09, 0xDA, 0xFB, 0x60, 0x00, 0x00,
+    0x9D, 0xAF, 0xB6, 0x00, 0x00, 0x09, 0xDA, 0xFB, 0x60, 0x00, 0x00, 0x9D,
+    0xAF, 0xB6, 0x00, 0x00, 0x09, 0xDA, 0xFB, 0x60, 0x00, 0x00, 0x9D, 0xAF,
+    0xB6, 0x00, 0x00, 0x09, 0xDA, 0xFB, 0x60, 0x00, 0x00, 0xBE, 0xAF, 0xD8,
+    0x00, 0x00, 0x1D, 0xEA, 0xFE, 0xA3, 0x22, 0x35, 0xEF, 0xAF, 0xFD, 0xA6,
+    0x69, 0xDD, 0xEA, 0xFC, 0xBC, 0xEE, 0xB7, 0x6C, 0xAF, 0xB8, 0x45, 0x54,
+    0x22, 0x43, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x0F, 0xB6, 0x00, 0x00, 0x00,
+    0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x0F, 0xB6, 0x00, 0x00, 0x00, 0x00,
+    0xA7, 0x40, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xD9, 0x00, 0x00, 0x00, 0x39,
+    0xF5, 0x08, 0xCC, 0x00, 0x00, 0x00, 0x39, 0xE5, 0x06, 0xAE, 0x21, 0x00,
+    0x00, 0x3A, 0xD4, 0x03, 0x8F, 0x52, 0x00, 0x00, 0x4B, 0xC4, 0x00, 0x5E,
+    0xB4, 0x00, 0x00, 0x4D, 0xA3, 0x00, 0x3A, 0xE5, 0x10, 0x01, 0x5E, 0x72,
+    0x00, 0x26, 0xF7, 0x20, 0x02, 0x7F, 0x41, 0x00, 0x12, 0xFA, 0x50, 0x04,
+    0x9E, 0x10, 0x00, 0x00, 0xCC, 0x80, 0x09, 0xC8, 0x00, 0x00, 0x00, 0x8C,
+    0xA2, 0x6B, 0xA3, 0x00, 0x00, 0x00, 0x4B, 0xC6, 0xAA, 0x70, 0x00, 0x00,
+    0x00, 0x1A, 0xDB, 0xE7, 0x20, 0x00, 0x00, 0x00, 0x06, 0xBF, 0x41, 0x00,
+    0x00, 0x00, 0x00, 0x02, 0x45, 0x10, 0x00, 0x00, 0x1A, 0xFF, 0xFF, 0xFF,
+    0xF5, 0x16, 0x9B, 0xED, 0xB9, 0x83, 0x04, 0x7A, 0xA8, 0x64, 0x31, 0x04,
+    0x9F, 0x41, 0x00, 0x00, 0x09, 0xCA, 0x00, 0x00, 0x00, 0x09, 0xDA, 0x00,
+    0x00, 0x00, 0x08, 0xCB, 0x21, 0x00, 0x00, 0x06, 0xBF, 0x63, 0x10, 0x00,
+    0x00, 0x4A, 0xFF, 0xFF, 0xF5, 0x04, 0x9D, 0xA8, 0x77, 0x72, 0x38, 0xBA,
+    0x53, 0x22, 0x21, 0x7C, 0xB3, 0x00, 0x00, 0x00, 0xDC, 0x80, 0x00, 0x00,
+    0x00, 0xEC, 0x70, 0x00, 0x00, 0x00, 0xEC, 0x80, 0x00, 0x00, 0x00, 0xCD,
+    0xA1, 0x00, 0x00, 0x00, 0x6C, 0xED, 0x64, 0x10, 0x00, 0x27, 0xBE, 0xCB,
+    0xA8, 0x31, 0x03, 0x6A, 0xBC, 0xDD, 0x72, 0x00, 0x00, 0x47, 0xAF, 0xD4,
+    0x00, 0x00, 0x00, 0x39, 0xE5, 0x00, 0x00, 0x00, 0x4B, 0xC4, 0x00, 0x00,
+    0x01, 0x5D, 0x83, 0x00, 0x00, 0x03, 0x8F, 0x31, 0x01, 0x38, 0xDE, 0xED,
+    0x83, 0x00, 0x06, 0xAC, 0xA9, 0x9A, 0xC9, 0x50, 0x3A, 0xCB, 0x54, 0x45,
+    0xBC, 0x93, 0x8D, 0xB4, 0x00, 0x00, 0x4B, 0xC7, 0xDD, 0x80, 0x00, 0x00,
+    0x09, 0xDC, 0xEC, 0x80, 0x00, 0x00, 0x08, 0xCE, 0xFC, 0x70, 0x00, 0x00,
+    0x07, 0xCE, 0xFC, 0x70, 0x00, 0x00, 0x07, 0xCE, 0xCD, 0x90, 0x00, 0x00,
+    0x09, 0xDC, 0x9C, 0xA3, 0x00, 0x00, 0x3A, 0xD9, 0x5B, 0xC8, 0x32, 0x23,
+    0x8C, 0xB5, 0x08, 0xDE, 0x86, 0x68, 0xED, 0x81, 0x01, 0x38, 0xDE, 0xED,
+    0x83, 0x10, 0x00, 0x13, 0x45, 0x54, 0x31, 0x00, 0x9D, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xD4, 0x68, 0xBF, 0xCA, 0x88, 0xCE, 0xD8, 0x72, 0x33, 0x7F,
+    0xA6, 0x33, 0xAD, 0xB3, 0x31, 0x00, 0x5F, 0x93, 0x00, 0x9D, 0xA0, 0x00,
+    0x00, 0x5F, 0x93, 0x00, 0x9D, 0xA0, 0x00, 0x00, 0x5F, 0x93, 0x00, 0x9D,
+    0xA0, 0x00, 0x00, 0x5F, 0x93, 0x00, 0x9D, 0xA0, 0x00, 0x00, 0x5F, 0x93,
+    0x00, 0x9D, 0xA0, 0x00, 0x00, 0x5F, 0x93, 0x00, 0x9D, 0xA0, 0x00, 0x00,
+    0x5F, 0x93, 0x00, 0x9D, 0xA0, 0x00, 0x00, 0x5F, 0x93, 0x00, 0x8D, 0xB3,
+    0x10, 0x00, 0x5F, 0x93, 0x00, 0x7C, 0xC7, 0x41, 0x00, 0x5F, 0x93, 0x00,
+    0x18, 0xDF, 0x72, 0x00, 0x25, 0x31, 0x00, 0x03, 0x45, 0x21, 0x01, 0x38,
+    0xDE, 0xED, 0x94, 0x10, 0x06, 0xAC, 0xA9, 0x9A, 0xCA, 0x60, 0x3A, 0xCA,
+    0x54, 0x45, 0xBC, 0xA3, 0x8D, 0xB3, 0x00, 0x00, 0x4B, 0xD8, 0xDC, 0x80,
+    0x00, 0x00, 0x08, 0xDC, 0xEB, 0x70, 0x00, 0x00, 0x08, 0xCE, 0xFB, 0x60,
+    0x00, 0x00, 0x07, 0xCE, 0xFB, 0x60, 0x00, 0x00, 0x07, 0xCE, 0xFB, 0x60,
+    0x00, 0x00, 0x08, 0xDC, 0xFB, 0x60, 0x00, 0x00, 0x2A, 0xD9, 0xFD, 0x94,
+    0x22, 0x23, 0x7C, 0xB5, 0xFF, 0xEB, 0x76, 0x68, 0xED, 0x91, 0xFC, 0xA9,
+    0xDE, 0xED, 0x83, 0x10, 0xFB, 0x73, 0x45, 0x54, 0x31, 0x00, 0xFB, 0x60,
+    0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60,
+    0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x00, 0xA7, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x49, 0xEE, 0xED, 0x93, 0x17, 0xAD, 0xA9,
+    0x9A, 0x83, 0x3A, 0xDB, 0x54, 0x45, 0x52, 0x8D, 0xC5, 0x00, 0x00, 0x00,
+    0xCD, 0x90, 0x00, 0x00, 0x00, 0xEC, 0x80, 0x00, 0x00, 0x00, 0xEC, 0x70,
+    0x00, 0x00, 0x00, 0xFC, 0x70, 0x00, 0x00, 0x00, 0xDC, 0x70, 0x00, 0x00,
+    0x00, 0xBC, 0x91, 0x00, 0x00, 0x00, 0x7C, 0xB5, 0x21, 0x00, 0x00, 0x3A,
+    0xED, 0x73, 0x10, 0x00, 0x02, 0x6B, 0xFF, 0xEB, 0x21, 0x01, 0x24, 0x68,
+    0xAD, 0x93, 0x00, 0x00, 0x13, 0x7C, 0xD4, 0x00, 0x00, 0x00, 0x39, 0xE5,
+    0x00, 0x00, 0x00, 0x4C, 0xB4, 0x00, 0x00, 0x02, 0x7E, 0x62, 0x00, 0x00,
+    0x02, 0x5A, 0x21, 0x00, 0x37, 0xCE, 0xFF, 0xFF, 0xFF, 0xC4, 0x06, 0xAC,
+    0xA9, 0x98, 0xED, 0xB8, 0x62, 0x3A, 0xCB, 0x65, 0x43, 0xBC, 0xA5, 0x31,
+    0x7C, 0xB4, 0x00, 0x00, 0x5C, 0xB4, 0x00, 0xCD, 0x90, 0x00, 0x00, 0x09,
+    0xDA, 0x00, 0xEC, 0x70, 0x00, 0x00, 0x08, 0xCD, 0x00, 0xFC, 0x70, 0x00,
+    0x00, 0x07, 0xCE, 0x00, 0xFC, 0x70, 0x00, 0x00, 0x07, 0xCF, 0x00, 0xDD,
+    0x90, 0x00, 0x00, 0x08, 0xCD, 0x00, 0xAD, 0xB3, 0x00, 0x00, 0x2A, 0xDA,
+    0x00, 0x6C, 0xC8, 0x32, 0x23, 0x7C, 0xB6, 0x00, 0x19, 0xEF, 0x87, 0x68,
+    0xED, 0x91, 0x00, 0x01, 0x49, 0xEE, 0xED, 0x94, 0x10, 0x00, 0x00, 0x13,
+    0x55, 0x54, 0x31, 0x00, 0x00, 0x7C, 0xFF, 0xFF, 0xFF, 0xFF, 0xB4, 0x57,
+    0x88, 0xFD, 0xB8, 0x88, 0x62, 0x33, 0x33, 0xFC, 0x83, 0x33, 0x21, 0x00,
+    0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00,
+    0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00,
+    0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00,
+    0x00, 0xEC, 0x70, 0x00, 0x00, 0x00, 0x00, 0xCC, 0x93, 0x22, 0x10, 0x00,
+    0x00, 0xAD, 0xD8, 0x56, 0x40, 0x00, 0x00, 0x17, 0xBE, 0xFD, 0x80, 0x00,
+    0x00, 0x02, 0x45, 0x54, 0x30, 0xFB, 0x60, 0x00, 0x00, 0xAD, 0xB4, 0xFB,
+    0x60, 0x00, 0x00, 0x5C, 0xC7, 0xFB, 0x60, 0x00, 0x00, 0x2A, 0xDA, 0xFB,
+    0x60, 0x00, 0x00, 0x09, 0xDC, 0xFB, 0x60, 0x00, 0x00, 0x07, 0xBE, 0xFB,
+    0x60, 0x00, 0x00, 0x06, 0xBE, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB,
+    0x60, 0x00, 0x00, 0x07, 0xBE, 0xEC, 0x70, 0x00, 0x00, 0x08, 0xCC, 0xBD,
+    0xA2, 0x00, 0x00, 0x3A, 0xC9, 0x8C, 0xC6, 0x22, 0x23, 0x7C, 0xB5, 0x3B,
+    0xEE, 0x76, 0x68, 0xEE, 0x91, 0x02, 0x5A, 0xEE, 0xED, 0x94, 0x10, 0x01,
+    0x23, 0x55, 0x54, 0x31, 0x00, 0x05, 0x77, 0x01, 0x5B, 0xED, 0xA5, 0x00,
+    0x19, 0xB8, 0x05, 0x9D, 0x9A, 0xBC, 0x21, 0x4B, 0xC6, 0x07, 0xCD, 0x46,
+    0x9E, 0x52, 0x9D, 0xA1, 0x09, 0xCA, 0x00, 0x5D, 0x93, 0xDB, 0x70, 0x0A,
+    0xD9, 0x00, 0x3A, 0xD4, 0xEB, 0x60, 0x0A, 0xD8, 0x00, 0x39, 0xE5, 0xFB,
+    0x60, 0x0A, 0xD8, 0x00, 0x39, 0xE5, 0xFB, 0x60, 0x0A, 0xD8, 0x00, 0x3A,
+    0xE5, 0xDC, 0x80, 0x0A, 0xD8, 0x00, 0x4C, 0xC4, 0xAD, 0xA2, 0x0A, 0xD8,
+    0x02, 0x7E, 0x83, 0x7C, 0xC6, 0x2B, 0xD9, 0x36, 0xAE, 0x52, 0x2A, 0xEE,
+    0x7C, 0xEB, 0x9D, 0xEC, 0x00, 0x02, 0x5A, 0xEF, 0xFF, 0xD9, 0x51, 0x00,
+    0x01, 0x23, 0x5C, 0xEB, 0x43, 0x20, 0x00, 0x00, 0x00, 0x0A, 0xD8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0A, 0xD8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A,
+    0xD8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x07, 0x96, 0x00, 0x00, 0x00, 0x09, 0xEE, 0x41, 0x00, 0x00, 0x4D,
+    0xB4, 0x06, 0xAD, 0xA4, 0x00, 0x03, 0x8E, 0x52, 0x03, 0x6A, 0xE6, 0x10,
+    0x17, 0xAC, 0x10, 0x00, 0x25, 0xF9, 0x40, 0x2A, 0xC8, 0x00, 0x00, 0x00,
+    0xDC, 0x80, 0xAC, 0x91, 0x00, 0x00, 0x00, 0xAC, 0xB4, 0xDA, 0x50, 0x00,
+    0x00, 0x00, 0x6C, 0xD9, 0xE7, 0x20, 0x00, 0x00, 0x00, 0x2B, 0xFF, 0xB4,
+    0x00, 0x00, 0x00, 0x00, 0x08, 0xDF, 0x31, 0x00, 0x00, 0x00, 0x00, 0x19,
+    0xEF, 0x41, 0x00, 0x00, 0x00, 0x00, 0x5B, 0xEF, 0x72, 0x00, 0x00, 0x00,
+    0x00, 0xAD, 0xEE, 0xB4, 0x00, 0x00, 0x00, 0x14, 0xF9, 0x68, 0xF6, 0x10,
+    0x00, 0x00, 0x4A, 0xD6, 0x34, 0xF9, 0x40, 0x00, 0x02, 0x6E, 0x93, 0x01,
+    0xEB, 0x70, 0x00, 0x05, 0xAF, 0x31, 0x00, 0xBD, 0x91, 0x00, 0x2A, 0xD9,
+    0x00, 0x00, 0x4B, 0xDA, 0x52, 0x8C, 0xB4, 0x00, 0x00, 0x17, 0xBD, 0xB4,
+    0x79, 0x61, 0x00, 0x00, 0x04, 0x79, 0x93, 0x00, 0x00, 0x0A, 0xD8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0A, 0xD8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A,
+    0xD8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0A, 0xD8, 0x00, 0x00, 0x00, 0xA7, 0x40, 0x0A, 0xD8, 0x04, 0x7A,
+    0x31, 0xFB, 0x60, 0x0A, 0xD8, 0x05, 0xAF, 0x62, 0xFB, 0x60, 0x0A, 0xD8,
+    0x02, 0x7F, 0x83, 0xFB, 0x60, 0x0A, 0xD8, 0x00, 0x4D, 0xC4, 0xFB, 0x60,
+    0x0A, 0xD8, 0x00, 0x4B, 0xD4, 0xFB, 0x60, 0x0A, 0xD8, 0x00, 0x3A, 0xE5,
+    0xFB, 0x60, 0x0A, 0xD8, 0x00, 0x39, 0xF5, 0xFB, 0x60, 0x0A, 0xD8, 0x00,
+    0x3A, 0xE5, 0xEC, 0x70, 0x0A, 0xD8, 0x00, 0x4C, 0xD4, 0xCC, 0x91, 0x0A,
+    0xD8, 0x01, 0x6D, 0xB4, 0xAD, 0xB3, 0x0A, 0xD8, 0x03, 0x8F, 0x72, 0x3B,
+    0xEE, 0x7C, 0xEB, 0x9D, 0xED, 0x10, 0x15, 0x9C, 0xCE, 0xFE, 0xCB, 0x95,
+    0x00, 0x02, 0x47, 0x9D, 0xED, 0x97, 0x41, 0x00, 0x00, 0x00, 0x0A, 0xD8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD8, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0xD8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0A, 0xD8, 0x00, 0x00, 0x00, 0x1A, 0xC6, 0x00, 0x00, 0x04,
+    0x9F, 0x10, 0x5B, 0xB3, 0x00, 0x00, 0x02, 0x7F, 0x52, 0x8C, 0xA1, 0x00,
+    0x00, 0x01, 0x5E, 0x83, 0xBC, 0x80, 0x00, 0x00, 0x00, 0x4D, 0xB4, 0xDB,
+    0x70, 0x00, 0x00, 0x00, 0x3A, 0xD4, 0xEB, 0x60, 0x07, 0x96, 0x00, 0x39,
+    0xE5, 0xFB, 0x60, 0x0A, 0xD8, 0x00, 0x39, 0xF5, 0xFB, 0x60, 0x0A, 0xD8,
+    0x00, 0x39, 0xF5, 0xEB, 0x60, 0x0A, 0xD9, 0x00, 0x3A, 0xE5, 0xCC, 0x80,
+    0x1A, 0xDA, 0x00, 0x4C, 0xC4, 0xAC, 0xA2, 0x5B, 0xDC, 0x33, 0x6E, 0x93,
+    0x7C, 0xC7, 0xBC, 0xDF, 0x88, 0xBF, 0x62, 0x07, 0xBF, 0xC6, 0x46, 0xEE,
+    0xC9, 0x00, 0x02, 0x45, 0x42, 0x12, 0x55, 0x43, 0x00, 0xC8, 0x40, 0x6A,
+    0x80, 0xC8, 0x40, 0x6A, 0x80, 0x85, 0x30, 0x47, 0x50, 0x00, 0x00, 0x00,
+    0x00, 0x0A, 0xD9, 0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00, 0x0A, 0xD9, 0x00,
+    0x00, 0x0A, 0xD9, 0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00, 0x0A, 0xD9, 0x00,
+    0x00, 0x0A, 0xD9, 0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00, 0x0A, 0xD9, 0x00,
+    0x00, 0x09, 0xDA, 0x00, 0x00, 0x08, 0xCC, 0x32, 0x22, 0x07, 0xBF, 0x86,
+    0x67, 0x01, 0x4A, 0xEE, 0xED, 0x00, 0x13, 0x55, 0x54, 0x00, 0x4C, 0x62,
+    0x26, 0xC4, 0x00, 0x00, 0x4C, 0x62, 0x26, 0xC4, 0x00, 0x00, 0x38, 0x41,
+    0x14, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00,
+    0x00, 0xAD, 0xB4, 0xFB, 0x60, 0x00, 0x00, 0x5C, 0xC7, 0xFB, 0x60, 0x00,
+    0x00, 0x2A, 0xDA, 0xFB, 0x60, 0x00, 0x00, 0x09, 0xDC, 0xFB, 0x60, 0x00,
+    0x00, 0x07, 0xBE, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBE, 0xFB, 0x60, 0x00,
+    0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x07, 0xBE, 0xEC, 0x70, 0x00,
+    0x00, 0x08, 0xCC, 0xBD, 0xA2, 0x00, 0x00, 0x3A, 0xC9, 0x8C, 0xC6, 0x22,
+    0x23, 0x7C, 0xB5, 0x3B, 0xEE, 0x76, 0x68, 0xEE, 0x91, 0x02, 0x5A, 0xEE,
+    0xED, 0x94, 0x10, 0x01, 0x23, 0x55, 0x54, 0x31, 0x00, 0x00, 0x00, 0x07,
+    0xBE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x08,
+    0xB7, 0x00, 0x00, 0x00, 0x00, 0x09, 0xA3, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x26, 0x99, 0x99, 0x52, 0x00, 0x03, 0x7A, 0xBC,
+    0xCB, 0xA6, 0x30, 0x19, 0xDE, 0x86, 0x68, 0xED, 0x80, 0x8D, 0xB4, 0x00,
+    0x00, 0x4B, 0xC7, 0xBD, 0x91, 0x00, 0x00, 0x19, 0xDB, 0xDC, 0x80, 0x00,
+    0x00, 0x08, 0xCD, 0xFC, 0x70, 0x00, 0x00, 0x07, 0xCE, 0xFC, 0x70, 0x00,
+    0x00, 0x07, 0xCE, 0xDC, 0x80, 0x00, 0x00, 0x08, 0xCD, 0xBD, 0x91, 0x00,
+    0x00, 0x19, 0xDB, 0x7C, 0xB4, 0x00, 0x00, 0x4B, 0xC7, 0x08, 0xDE, 0x86,
+    0x68, 0xED, 0x81, 0x03, 0x6A, 0xCC, 0xCB, 0xA7, 0x30, 0x00, 0x25, 0x99,
+    0x99, 0x62, 0x00, 0x00, 0x00, 0x07, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x07,
+    0xBA, 0x00, 0x00, 0x00, 0x00, 0x08, 0xB7, 0x00, 0x00, 0x00, 0x00, 0x09,
+    0xA3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA7, 0x40, 0x00,
+    0x00, 0x79, 0x72, 0xFB, 0x60, 0x00, 0x00, 0x8D, 0xC5, 0xFB, 0x60, 0x00,
+    0x00, 0x3B, 0xD8, 0xFB, 0x60, 0x00, 0x00, 0x09, 0xDC, 0xFB, 0x60, 0x00,
+    0x00, 0x07, 0xCD, 0xFB, 0x60, 0x00, 0x00, 0x07, 0xBE, 0xFB, 0x60, 0x00,
+    0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x07, 0xBE, 0xEC, 0x70, 0x00,
+    0x00, 0x08, 0xCD, 0xCC, 0x91, 0x00, 0x00, 0x19, 0xCA, 0xAD, 0xB2, 0x00,
+    0x00, 0x4B, 0xD8, 0x3B, 0xEE, 0x76, 0x68, 0xEE, 0x91, 0x15, 0x8C, 0xCC,
+    0xCB, 0xB7, 0x40, 0x01, 0x47, 0x9A, 0xA9, 0x63, 0x10, 0x00, 0x00, 0x00,
+    0x3A, 0xE5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4B, 0xA3, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x4D, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0x31, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x84, 0x00, 0x00,
+    0x03, 0x6A, 0x10, 0x3B, 0xB5, 0x00, 0x00, 0x03, 0x8F, 0x31, 0x6C, 0xA1,
+    0x00, 0x00, 0x01, 0x6F, 0x62, 0xBC, 0x80, 0x00, 0x00, 0x00, 0x4D, 0xB4,
+    0xCB, 0x70, 0x00, 0x00, 0x00, 0x4B, 0xC4, 0xEB, 0x60, 0x03, 0x43, 0x00,
+    0x3A, 0xE5, 0xFB, 0x60, 0x0A, 0xD8, 0x00, 0x39, 0xF5, 0xFB, 0x60, 0x0A,
+    0xD8, 0x00, 0x39, 0xF5, 0xEB, 0x60, 0x0A, 0xD9, 0x00, 0x39, 0xE5, 0xDB,
+    0x70, 0x1A, 0xD9, 0x00, 0x4B, 0xD4, 0xCC, 0x80, 0x2B, 0xEB, 0x00, 0x4D,
+    0xB4, 0x7C, 0xC7, 0xBC, 0xDF, 0x88, 0xBF, 0x62, 0x28, 0xCC, 0xC8, 0x79,
+    0xCC, 0xCB, 0x21, 0x04, 0x8A, 0x84, 0x24, 0x99, 0x86, 0x00, 0x00, 0x4C,
+    0xF6, 0x10, 0x00, 0x00, 0x02, 0x6F, 0x83, 0x00, 0x00, 0x00, 0x12, 0xCA,
+    0x60, 0x00, 0x00, 0x00, 0x07, 0xB9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xA7, 0xFE, 0xDC, 0xCC, 0xCC, 0xCC,
+    0x8F, 0xDA, 0x77, 0x77, 0x77, 0x74, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x0F,
+    0xB6, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x0F, 0xB6,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0xEC, 0x99,
+    0x99, 0x99, 0x96, 0xFC, 0x94, 0x44, 0x44, 0x44, 0x3F, 0xB6, 0x00, 0x00,
+    0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x0F, 0xB6, 0x00, 0x00, 0x00,
+    0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x0F, 0xB6, 0x00, 0x00, 0x00, 0x00,
+    0xFD, 0xA7, 0x77, 0x77, 0x77, 0x4F, 0xED, 0xCC, 0xCC, 0xCC, 0xC8, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0x70, 0x00, 0x4C, 0x62, 0x26, 0xC4, 0x00, 0x04,
+    0xC6, 0x22, 0x6C, 0x40, 0x00, 0x38, 0x41, 0x14, 0x83, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0xEC, 0x99, 0x99,
+    0x99, 0x96, 0xFC, 0x94, 0x44, 0x44, 0x44, 0x3F, 0xB6, 0x00, 0x00, 0x00,
+    0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x0F, 0xB6, 0x00, 0x00, 0x00, 0x00,
+    0xFD, 0x95, 0x55, 0x55, 0x55, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0xFD,
+    0xA7, 0x77, 0x77, 0x77, 0x4F, 0xC8, 0x22, 0x22, 0x22, 0x21, 0xFB, 0x60,
+    0x00, 0x00, 0x00, 0x0F, 0xB6, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00,
+    0x00, 0x00, 0x0F, 0xB6, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x82, 0x22, 0x22,
+    0x22, 0x1F, 0xDA, 0x77, 0x77, 0x77, 0x74, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xA5, 0x55, 0x55, 0x55, 0x55, 0x53, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0,
+    0x00, 0x99, 0x99, 0xFE, 0xC9, 0x99, 0x60, 0x00, 0x44, 0x44, 0xFC, 0x94,
+    0x44, 0x30, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFB, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFD, 0x95, 0x55, 0x43, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE,
+    0xC8, 0x10, 0x00, 0x00, 0xFD, 0xA7, 0x79, 0xCF, 0x83, 0x00, 0x00, 0xFC,
+    0x82, 0x23, 0x7D, 0xC4, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x4C, 0xE5, 0x00,
+    0x00, 0xFB, 0x60, 0x00, 0x3A, 0xF5, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x3A,
+    0xF5, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x4B, 0xE5, 0x00, 0x00, 0xFB, 0x60,
+    0x33, 0x6D, 0xB4, 0x00, 0x00, 0xFB, 0x60, 0x89, 0xBF, 0x83, 0x00, 0x00,
+    0xFB, 0x60, 0xEE, 0xC9, 0x10, 0x00, 0x00, 0x54, 0x20, 0x55, 0x43, 0x00,
+    0x00, 0x00, 0x01, 0x6F, 0xC4, 0x00, 0x00, 0x00, 0x04, 0x8F, 0x62, 0x00,
+    0x00, 0x00, 0x06, 0xAC, 0x21, 0x00, 0x00, 0x00, 0x09, 0xB7, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xFE, 0xDC, 0xCC, 0xCC, 0xCC, 0xCC, 0xFD, 0xA7, 0x77, 0x77, 0x77, 0x77,
+    0xFB, 0x60, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x00,
+    0xFB, 0x60, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x00,
+    0xFB, 0x60, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x00,
+    0xFB, 0x60, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x00,
+    0xFB, 0x60, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x00,
+    0xFB, 0x60, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x00,
+    0xFB, 0x60, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x00,
+    0xA8, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x9C, 0xEF, 0xEC, 0xA6,
+    0x02, 0x5A, 0xDC, 0xBA, 0xAB, 0xB8, 0x05, 0x9E, 0xB8, 0x65, 0x57, 0x77,
+    0x1A, 0xEE, 0x21, 0x00, 0x00, 0x00, 0x7C, 0xB4, 0x00, 0x00, 0x00, 0x00,
+    0xAD, 0xA2, 0x00, 0x00, 0x00, 0x00, 0xCE, 0xB5, 0x55, 0x55, 0x52, 0x00,
+    0xEF, 0xFF, 0xFF, 0xFF, 0xF5, 0x00, 0xFE, 0xB7, 0x77, 0x77, 0x72, 0x00,
+    0xED, 0x92, 0x22, 0x22, 0x21, 0x00, 0xDD, 0x90, 0x00, 0x00, 0x00, 0x00,
+    0xCE, 0xA1, 0x00, 0x00, 0x00, 0x00, 0x8D, 0xC6, 0x00, 0x00, 0x00, 0x00,
+    0x4B, 0xEC, 0x21, 0x00, 0x00, 0x00, 0x18, 0xCE, 0x75, 0x32, 0x23, 0x34,
+    0x03, 0x8F, 0xFC, 0x97, 0x78, 0xAC, 0x00, 0x12, 0x9C, 0xEF, 0xED, 0xC9,
+    0x00, 0x01, 0x34, 0x55, 0x54, 0x43, 0x02, 0x5A, 0xDE, 0xEE, 0xDB, 0x96,
+    0x49, 0xBC, 0xAA, 0xAA, 0xBC, 0xB8, 0x8C, 0xC9, 0x65, 0x55, 0x68, 0x86,
+    0xDD, 0x91, 0x00, 0x00, 0x00, 0x00, 0xEC, 0x70, 0x00, 0x00, 0x00, 0x00,
+    0xCD, 0xA3, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xC7, 0x42, 0x10, 0x00, 0x00,
+    0x2A, 0xEF, 0xB7, 0x41, 0x00, 0x00, 0x01, 0x37, 0xDE, 0xFE, 0xA5, 0x20,
+    0x00, 0x12, 0x46, 0x8B, 0xDB, 0x83, 0x00, 0x00, 0x01, 0x36, 0xAD, 0xC7,
+    0x00, 0x00, 0x00, 0x00, 0x2A, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xCF,
+    0x00, 0x00, 0x00, 0x00, 0x19, 0xDD, 0x54, 0x33, 0x22, 0x23, 0x5B, 0xC9,
+    0xFC, 0xA8, 0x77, 0x78, 0xEE, 0xB4, 0x9B, 0xDE, 0xFF, 0xED, 0x95, 0x20,
+    0x34, 0x45, 0x55, 0x54, 0x32, 0x10, 0x3B, 0xFF, 0xFF, 0xFF, 0xFB, 0x62,
+    0x68, 0x8D, 0xED, 0x98, 0x53, 0x02, 0x33, 0xBE, 0xB4, 0x32, 0x10, 0x00,
+    0x09, 0xDA, 0x00, 0x00, 0x00, 0x00, 0x9D, 0xA0, 0x00, 0x00, 0x00, 0x09,
+    0xDA, 0x00, 0x00, 0x00, 0x00, 0x9D, 0xA0, 0x00, 0x00, 0x00, 0x09, 0xDA,
+    0x00, 0x00, 0x00, 0x00, 0x9D, 0xA0, 0x00, 0x00, 0x00, 0x09, 0xDA, 0x00,
+    0x00, 0x00, 0x00, 0x9D, 0xA0, 0x00, 0x00, 0x00, 0x09, 0xDA, 0x00, 0x00,
+    0x00, 0x00, 0x9D, 0xA0, 0x00, 0x00, 0x00, 0x09, 0xDA, 0x00, 0x00, 0x01,
+    0x12, 0xAD, 0xB2, 0x11, 0x01, 0x34, 0x5C, 0xEC, 0x54, 0x31, 0x3B, 0xFF,
+    0xFF, 0xFF, 0xFB, 0x61, 0x45, 0x55, 0x55, 0x55, 0x42, 0x00, 0x4C, 0x62,
+    0x26, 0xC4, 0x00, 0x04, 0xC6, 0x22, 0x6C, 0x40, 0x00, 0x38, 0x41, 0x14,
+    0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0xFF, 0xFF, 0xFF, 0xFB,
+    0x62, 0x68, 0x8D, 0xED, 0x98, 0x53, 0x02, 0x33, 0xBE, 0xB4, 0x32, 0x10,
+    0x00, 0x09, 0xDA, 0x00, 0x00, 0x00, 0x00, 0x9D, 0xA0, 0x00, 0x00, 0x00,
+    0x09, 0xDA, 0x00, 0x00, 0x00, 0x00, 0x9D, 0xA0, 0x00, 0x00, 0x00, 0x09,
+    0xDA, 0x00, 0x00, 0x00, 0x00, 0x9D, 0xA0, 0x00, 0x00, 0x00, 0x09, 0xDA,
+    0x00, 0x00, 0x00, 0x00, 0x9D, 0xA0, 0x00, 0x00, 0x00, 0x09, 0xDA, 0x00,
+    0x00, 0x00, 0x00, 0x9D, 0xA0, 0x00, 0x00, 0x00, 0x09, 0xDA, 0x00, 0x00,
+    0x01, 0x12, 0xAD, 0xB2, 0x11, 0x01, 0x34, 0x5C, 0xEC, 0x54, 0x31, 0x3B,
+    0xFF, 0xFF, 0xFF, 0xFB, 0x61, 0x45, 0x55, 0x55, 0x55, 0x42, 0x00, 0x00,
+    0x00, 0x00, 0xAD, 0xA0, 0x00, 0x00, 0x00, 0x0A, 0xDA, 0x00, 0x00, 0x00,
+    0x00, 0xAD, 0xA0, 0x00, 0x00, 0x00, 0x0A, 0xDA, 0x00, 0x00, 0x00, 0x00,
+    0xAD, 0xA0, 0x00, 0x00, 0x00, 0x0A, 0xDA, 0x00, 0x00, 0x00, 0x00, 0xAD,
+    0xA0, 0x00, 0x00, 0x00, 0x0A, 0xDA, 0x00, 0x00, 0x00, 0x00, 0xAD, 0xA0,
+    0x00, 0x00, 0x00, 0x0A, 0xDA, 0x00, 0x00, 0x00, 0x00, 0xAD, 0xA0, 0x00,
+    0x00, 0x00, 0x0A, 0xDA, 0x00, 0x00, 0x00, 0x00, 0xCD, 0x90, 0x00, 0x00,
+    0x01, 0x3E, 0xC8, 0x43, 0x32, 0x23, 0x58, 0xEA, 0x5D, 0xA8, 0x77, 0x9C,
+    0xFD, 0x61, 0xAC, 0xEF, 0xFD, 0xB8, 0x10, 0x03, 0x45, 0x55, 0x44, 0x30,
+    0x00, 0x0A, 0xFF, 0xFF, 0xFF, 0xA3, 0x00, 0x00, 0x00, 0xAE, 0xD9, 0x9B,
+    0xFA, 0x30, 0x00, 0x00, 0x0A, 0xEC, 0x44, 0x8F, 0xA3, 0x00, 0x00, 0x00,
+    0xAD, 0xA0, 0x05, 0xFA, 0x30, 0x00, 0x00, 0x1A, 0xDA, 0x00, 0x5F, 0xA3,
+    0x00, 0x00, 0x01, 0xAD, 0x90, 0x05, 0xFA, 0x30, 0x00, 0x00, 0x1A, 0xD9,
+    0x00, 0x5F, 0xB7, 0x44, 0x21, 0x01, 0xAD, 0x90, 0x05, 0xFF, 0xED, 0xC5,
+    0x20, 0x1A, 0xD8, 0x00, 0x5F, 0xC9, 0x9C, 0xF8, 0x32, 0xBD, 0x80, 0x05,
+    0xFA, 0x53, 0x4D, 0xB6, 0x2B, 0xC7, 0x00, 0x5F, 0xA3, 0x00, 0xBC, 0x82,
+    0xBC, 0x70, 0x05, 0xFA, 0x30, 0x09, 0xC9, 0x3B, 0xC6, 0x00, 0x5F, 0xA3,
+    0x00, 0x9D, 0xA3, 0xBC, 0x50, 0x05, 0xFA, 0x30, 0x0C, 0xC8, 0x6C, 0xB4,
+    0x00, 0x5F, 0xA5, 0x34, 0xEB, 0x6A, 0xDB, 0x20, 0x05, 0xFC, 0x89, 0xCF,
+    0x83, 0xEB, 0x60, 0x00, 0x5F, 0xFF, 0xDC, 0x52, 0x05, 0x42, 0x00, 0x02,
+    0x55, 0x54, 0x42, 0x10, 0xFB, 0x60, 0x0A, 0xDA, 0x00, 0x00, 0x00, 0xFB,
+    0x60, 0x0A, 0xDA, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x0A, 0xDA, 0x00, 0x00,
+    0x00, 0xFB, 0x60, 0x0A, 0xDA, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x0A, 0xDA,
+    0x00, 0x00, 0x00, 0xFB, 0x60, 0x0A, 0xDA, 0x00, 0x00, 0x00, 0xFD, 0x95,
+    0x5C, 0xEB, 0x54, 0x32, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xED, 0x95, 0x00,
+    0xFD, 0xA7, 0x7C, 0xEC, 0x8B, 0xDF, 0x52, 0xFC, 0x82, 0x2B, 0xDA, 0x34,
+    0x7D, 0xA3, 0xFB, 0x60, 0x0A, 0xDA, 0x00, 0x4B, 0xD4, 0xFB, 0x60, 0x0A,
+    0xDA, 0x00, 0x39, 0xF5, 0xFB, 0x60, 0x0A, 0xDA, 0x00, 0x39, 0xE5, 0xFB,
+    0x60, 0x0A, 0xDA, 0x00, 0x4C, 0xD4, 0xFB, 0x60, 0x0A, 0xDA, 0x24, 0x7E,
+    0x93, 0xFB, 0x60, 0x0A, 0xEC, 0x7A, 0xDF, 0x52, 0xFB, 0x60, 0x0A, 0xFF,
+    0xED, 0x95, 0x00, 0x54, 0x20, 0x03, 0x55, 0x54, 0x32, 0x00, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xA0, 0x00, 0x99, 0x99, 0xFE, 0xC9, 0x99, 0x60, 0x00,
+    0x44, 0x44, 0xFC, 0x94, 0x44, 0x30, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB,
+    0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x95, 0x55, 0x43, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0xFE, 0xC8, 0x10, 0x00, 0x00, 0xFD, 0xA7, 0x79, 0xCF,
+    0x83, 0x00, 0x00, 0xFC, 0x82, 0x23, 0x7D, 0xB4, 0x00, 0x00, 0xFB, 0x60,
+    0x00, 0x4C, 0xE5, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x3A, 0xF5, 0x00, 0x00,
+    0xFB, 0x60, 0x00, 0x3A, 0xF5, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x3A, 0xF5,
+    0x00, 0x00, 0xFB, 0x60, 0x00, 0x3A, 0xF5, 0x00, 0x00, 0xFB, 0x60, 0x00,
+    0x3A, 0xF5, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x3A, 0xF5, 0x00, 0x00, 0x54,
+    0x20, 0x00, 0x13, 0x52, 0x00, 0x00, 0x01, 0x6F, 0xC4, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0x8F, 0x62, 0x00, 0x00, 0x00, 0x00, 0x06, 0xAC, 0x21, 0x00,
+    0x00, 0x00, 0x00, 0x09, 0xB7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xA8, 0x40, 0x00, 0x00, 0x16, 0x98, 0x00, 0xFB, 0x60,
+    0x00, 0x00, 0x6B, 0xB8, 0x00, 0xFB, 0x60, 0x00, 0x01, 0xDC, 0x81, 0x00,
+    0xFB, 0x60, 0x01, 0x5C, 0xD5, 0x10, 0x00, 0xFB, 0x60, 0x05, 0xAD, 0x52,
+    0x00, 0x00, 0xFB, 0x60, 0x49, 0xBA, 0x10, 0x00, 0x00, 0xFB, 0x60, 0xAD,
+    0xA2, 0x00, 0x00, 0x00, 0xFB, 0xA9, 0xE7, 0x20, 0x00, 0x00, 0x00, 0xFD,
+    0xCD, 0xC5, 0x10, 0x00, 0x00, 0x00, 0xFD, 0xCC, 0xC6, 0x20, 0x00, 0x00,
+    0x00, 0xFB, 0x96, 0xFA, 0x50, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x8D, 0xC6,
+    0x00, 0x00, 0x00, 0xFB, 0x60, 0x39, 0xCC, 0x31, 0x00, 0x00, 0xFB, 0x60,
+    0x05, 0x9E, 0x73, 0x10, 0x00, 0xFB, 0x60, 0x00, 0x4C, 0xE6, 0x20, 0x00,
+    0xFB, 0x60, 0x00, 0x01, 0xDD, 0x91, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x6B,
+    0xC8, 0x00, 0xA8, 0x40, 0x00, 0x00, 0x27, 0x98, 0x00, 0x00, 0x00, 0xCE,
+    0xA2, 0x00, 0x00, 0x00, 0x00, 0x6C, 0xC5, 0x00, 0x00, 0x00, 0x00, 0x29,
+    0xB9, 0x00, 0x00, 0x00, 0x00, 0x05, 0x9D, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xA7, 0x30, 0x00, 0x00, 0x06, 0x9A, 0xFA, 0x50, 0x00,
+    0x00, 0x3A, 0xEF, 0xFA, 0x50, 0x00, 0x00, 0x7C, 0xFF, 0xFA, 0x50, 0x00,
+    0x01, 0xED, 0xDF, 0xFA, 0x50, 0x00, 0x26, 0xDA, 0xBF, 0xFA, 0x50, 0x00,
+    0x4A, 0xA8, 0xAF, 0xFA, 0x50, 0x01, 0x6F, 0x46, 0xAF, 0xFA, 0x50, 0x07,
+    0xAB, 0x05, 0xAF, 0xFA, 0x50, 0x2A, 0xB6, 0x05, 0xAF, 0xFA, 0x50, 0x6B,
+    0x92, 0x05, 0xAF, 0xFA, 0x50, 0xBA, 0x60, 0x05, 0xAF, 0xFA, 0x65, 0xF6,
+    0x10, 0x05, 0xAF, 0xFA, 0x8A, 0xA4, 0x00, 0x05, 0xAF, 0xFB, 0xAD, 0x62,
+    0x00, 0x05, 0xAF, 0xFD, 0xDE, 0x10, 0x00, 0x05, 0xAF, 0xFF, 0xC7, 0x00,
+    0x00, 0x05, 0xAF, 0xFE, 0xA3, 0x00, 0x00, 0x05, 0xAF, 0xA9, 0x60, 0x00,
+    0x00, 0x03, 0x7A, 0x00, 0x5E, 0x93, 0x00, 0x06, 0xBD, 0x00, 0x00, 0x04,
+    0xBC, 0x63, 0x24, 0xAC, 0xA0, 0x00, 0x00, 0x27, 0xD9, 0x77, 0x8B, 0xA6,
+    0x00, 0x00, 0x00, 0x19, 0xCE, 0xFD, 0xA5, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x97, 0x10, 0x00, 0x00, 0x00, 0x09, 0x85,
+    0x9D, 0xB3, 0x00, 0x00, 0x00, 0x13, 0xEB, 0x64, 0xBD, 0x80, 0x00, 0x00,
+    0x02, 0x7F, 0x83, 0x08, 0xCE, 0x10, 0x00, 0x00, 0x5D, 0xC4, 0x00, 0x59,
+    0xF5, 0x20, 0x00, 0x38, 0xE7, 0x20, 0x02, 0x7E, 0x93, 0x00, 0x06, 0xAE,
+    0x31, 0x00, 0x04, 0xCE, 0x50, 0x00, 0x9D, 0xC0, 0x00, 0x00, 0x25, 0xF9,
+    0x40, 0x5C, 0xC5, 0x00, 0x00, 0x01, 0x2D, 0xC7, 0x0A, 0xC9, 0x20, 0x00,
+    0x00, 0x00, 0xAC, 0xA3, 0xDB, 0x70, 0x00, 0x00, 0x00, 0x05, 0xCD, 0x9F,
+    0x83, 0x00, 0x00, 0x00, 0x00, 0x09, 0xDF, 0xD4, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x6B, 0xF8, 0x30, 0x00, 0x00, 0x00, 0x00, 0x06, 0xAF, 0x41, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x8C, 0xE0, 0x00, 0x00, 0x00, 0x07, 0x97, 0xBE,
+    0xC5, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xCC, 0xA6, 0x20, 0x00, 0x00, 0x00,
+    0x06, 0x9A, 0x85, 0x20, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00,
+    0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00,
+    0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00,
+    0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00,
+    0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00,
+    0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00,
+    0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00,
+    0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFC, 0x82, 0x22, 0x22,
+    0x28, 0xCF, 0xFD, 0xA7, 0x77, 0x77, 0x7A, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x55, 0x55, 0xFD, 0x95, 0x55, 0x55, 0x00, 0x00, 0xFB, 0x60,
+    0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60,
+    0x00, 0x00, 0x00, 0x00, 0x54, 0x20, 0x00, 0x00, 0x00, 0x00, 0x05, 0xAF,
+    0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFC, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x1A, 0xDC, 0xE6, 0x10, 0x00, 0x00, 0x00, 0x04, 0xBD, 0x8F, 0x83,
+    0x00, 0x00, 0x00, 0x00, 0x9D, 0xA1, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x0C,
+    0xC8, 0x0C, 0xC8, 0x00, 0x00, 0x00, 0x12, 0xEB, 0x60, 0x9D, 0xA2, 0x00,
+    0x00, 0x02, 0x5F, 0x94, 0x06, 0xCC, 0x50, 0x00, 0x00, 0x3A, 0xF6, 0x10,
+    0x1A, 0xDA, 0x00, 0x00, 0x05, 0xDD, 0x50, 0x00, 0x9D, 0xD1, 0x00, 0x02,
+    0x7F, 0xD8, 0x55, 0x5A, 0xDF, 0x31, 0x00, 0x49, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xF6, 0x20, 0x07, 0xCF, 0x77, 0x77, 0x77, 0x9F, 0xB4, 0x01, 0x9D, 0xC2,
+    0x22, 0x22, 0x25, 0xCE, 0x51, 0x3B, 0xD8, 0x00, 0x00, 0x00, 0x38, 0xF7,
+    0x27, 0xCB, 0x40, 0x00, 0x00, 0x01, 0x4F, 0xA5, 0xCD, 0x90, 0x00, 0x00,
+    0x00, 0x00, 0xDD, 0x84, 0x43, 0x00, 0x00, 0x00, 0x00, 0x04, 0x43, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xB4, 0xFE, 0xC9, 0x99, 0x99, 0x99, 0x72, 0xFC,
+    0x94, 0x44, 0x44, 0x44, 0x31, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x00, 0xFB,
+    0x60, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x00, 0xFD,
+    0x95, 0x55, 0x54, 0x32, 0x10, 0xFF, 0xFF, 0xFF, 0xED, 0xA5, 0x20, 0xFD,
+    0xA7, 0x77, 0x89, 0xEF, 0xB4, 0xFC, 0x82, 0x22, 0x33, 0x7C, 0xD9, 0xFB,
+    0x60, 0x00, 0x00, 0x2A, 0xDC, 0xFB, 0x60, 0x00, 0x00, 0x08, 0xDE, 0xFB,
+    0x60, 0x00, 0x00, 0x08, 0xDE, 0xFB, 0x60, 0x00, 0x00, 0x2A, 0xDC, 0xFC,
+    0x82, 0x22, 0x23, 0x7C, 0xD9, 0xFD, 0xA6, 0x66, 0x79, 0xEF, 0xB3, 0xFF,
+    0xFF, 0xFF, 0xEE, 0xA5, 0x20, 0x55, 0x55, 0x55, 0x55, 0x32, 0x10, 0xFF,
+    0xFF, 0xFF, 0xFE, 0xC8, 0x40, 0xFE, 0xC9, 0x99, 0x9A, 0xCC, 0xA6, 0xFC,
+    0x94, 0x44, 0x45, 0x8C, 0xDB, 0xFB, 0x60, 0x00, 0x00, 0x09, 0xEE, 0xFB,
+    0x60, 0x00, 0x00, 0x08, 0xDE, 0xFB, 0x60, 0x00, 0x01, 0x5B, 0xC9, 0xFD,
+    0x95, 0x55, 0x56, 0x9A, 0x94, 0xFF, 0xFF, 0xFF, 0xFF, 0xC6, 0x20, 0xFD,
+    0xA6, 0x66, 0x79, 0xED, 0x92, 0xFC, 0x82, 0x22, 0x23, 0x6B, 0xC8, 0xFB,
+    0x60, 0x00, 0x00, 0x2A, 0xDC, 0xFB, 0x60, 0x00, 0x00, 0x08, 0xDE, 0xFB,
+    0x60, 0x00, 0x00, 0x08, 0xDE, 0xFB, 0x60, 0x00, 0x00, 0x2A, 0xDC, 0xFC,
+    0x82, 0x22, 0x23, 0x7C, 0xD8, 0xFD, 0xA6, 0x66, 0x78, 0xEE, 0xB3, 0xFF,
+    0xFF, 0xFF, 0xFE, 0xB6, 0x20, 0x55, 0x55, 0x55, 0x55, 0x42, 0x10, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xC9, 0x99, 0x99, 0x99, 0x99, 0xFC,
+    0x94, 0x44, 0x44, 0x44, 0x44, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x00, 0xFB,
+    0x60, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x00, 0xFB,
+    0x60, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x00, 0xFB,
+    0x60, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x00, 0xFB,
+    0x60, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x00, 0xFB,
+    0x60, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x00, 0xFB,
+    0x60, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x00, 0xFB,
+    0x60, 0x00, 0x00, 0x00, 0x00, 0x54, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xEC, 0x99, 0xCE,
+    0xF0, 0x00, 0x00, 0x00, 0xFC, 0x94, 0x49, 0xCF, 0x00, 0x00, 0x00, 0x0F,
+    0xB6, 0x00, 0x6B, 0xF0, 0x00, 0x00, 0x00, 0xFA, 0x50, 0x06, 0xBF, 0x00,
+    0x00, 0x00, 0x1F, 0x94, 0x00, 0x6B, 0xF0, 0x00, 0x00, 0x12, 0xF9, 0x40,
+    0x06, 0xBF, 0x00, 0x00, 0x01, 0x3F, 0x83, 0x00, 0x6B, 0xF0, 0x00, 0x00,
+    0x25, 0xF7, 0x20, 0x06, 0xBF, 0x00, 0x00, 0x02, 0x6F, 0x61, 0x00, 0x6B,
+    0xF0, 0x00, 0x00, 0x39, 0xE5, 0x00, 0x06, 0xBF, 0x00, 0x00, 0x04, 0xBC,
+    0x40, 0x00, 0x6B, 0xF0, 0x00, 0x01, 0x6F, 0x83, 0x00, 0x06, 0xBF, 0x00,
+    0x00, 0x38, 0xF4, 0x10, 0x00, 0x6B, 0xF0, 0x00, 0x27, 0xBE, 0x33, 0x22,
+    0x28, 0xCF, 0x22, 0x17, 0xBD, 0xC7, 0x77, 0x77, 0xAD, 0xF7, 0x74, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0xC8, 0x55, 0x55, 0x55, 0x55,
+    0x5A, 0xDA, 0xFA, 0x50, 0x00, 0x00, 0x00, 0x00, 0x8D, 0xAF, 0xA5, 0x00,
+    0x00, 0x00, 0x00, 0x08, 0xDA, 0xFA, 0x50, 0x00, 0x00, 0x00, 0x00, 0x8D,
+    0xA5, 0x32, 0x00, 0x00, 0x00, 0x00, 0x03, 0x43, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xAF, 0xEC, 0x99, 0x99, 0x99, 0x96, 0xFC, 0x94, 0x44, 0x44, 0x44,
+    0x3F, 0xB6, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x0F,
+    0xB6, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x95, 0x55, 0x55, 0x55, 0x3F, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFA, 0xFD, 0xA7, 0x77, 0x77, 0x77, 0x4F, 0xC8, 0x22,
+    0x22, 0x22, 0x21, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x0F, 0xB6, 0x00, 0x00,
+    0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x0F, 0xB6, 0x00, 0x00, 0x00,
+    0x00, 0xFC, 0x82, 0x22, 0x22, 0x22, 0x1F, 0xDA, 0x77, 0x77, 0x77, 0x74,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA5, 0x55, 0x55, 0x55, 0x55, 0x53, 0x1A,
+    0xC8, 0x00, 0x5F, 0xA3, 0x00, 0x8C, 0xA1, 0x07, 0xBC, 0x00, 0x5F, 0xA3,
+    0x01, 0xCB, 0x70, 0x04, 0x9E, 0x21, 0x5F, 0xA3, 0x13, 0xE8, 0x40, 0x01,
+    0x6F, 0x62, 0x5F, 0xA3, 0x38, 0xE5, 0x10, 0x00, 0x3A, 0xC4, 0x5F, 0xA4,
+    0x5E, 0x72, 0x00, 0x00, 0x26, 0xE6, 0x7F, 0xA7, 0x8E, 0x31, 0x00, 0x00,
+    0x13, 0xE8, 0x9F, 0xAA, 0xAC, 0x10, 0x00, 0x00, 0x00, 0xCB, 0xCF, 0xAD,
+    0xC7, 0x00, 0x00, 0x00, 0x00, 0x9C, 0xEF, 0xEF, 0xB3, 0x00, 0x00, 0x00,
+    0x00, 0xCB, 0xCF, 0xBD, 0xC8, 0x00, 0x00, 0x00, 0x12, 0xE9, 0x9F, 0xAA,
+    0xBC, 0x10, 0x00, 0x00, 0x26, 0xF7, 0x7F, 0xA7, 0x9F, 0x21, 0x00, 0x00,
+    0x4C, 0xB4, 0x5F, 0xA4, 0x5E, 0x93, 0x00, 0x01, 0x6E, 0x72, 0x5F, 0xA3,
+    0x3A, 0xD5, 0x10, 0x03, 0x8F, 0x41, 0x5F, 0xA3, 0x26, 0xF7, 0x20, 0x06,
+    0xBE, 0x00, 0x5F, 0xA3, 0x01, 0xFA, 0x50, 0x1A, 0xC8, 0x00, 0x5F, 0xA3,
+    0x00, 0x9D, 0xA1, 0x03, 0x43, 0x00, 0x25, 0x31, 0x00, 0x34, 0x30, 0x14,
+    0x8B, 0xEE, 0xEE, 0xB7, 0x30, 0x7A, 0xCB, 0xA9, 0x99, 0xCC, 0xA5, 0x79,
+    0xA7, 0x54, 0x45, 0x9C, 0xDA, 0x12, 0x20, 0x00, 0x00, 0x19, 0xEE, 0x00,
+    0x00, 0x00, 0x00, 0x09, 0xDD, 0x00, 0x00, 0x00, 0x13, 0x7C, 0xB7, 0x00,
+    0x25, 0x55, 0x67, 0xAA, 0x73, 0x00, 0x5F, 0xFF, 0xFF, 0x94, 0x10, 0x00,
+    0x26, 0x67, 0x8A, 0xFD, 0x81, 0x00, 0x12, 0x22, 0x33, 0x7C, 0xB7, 0x00,
+    0x00, 0x00, 0x00, 0x2A, 0xDB, 0x00, 0x00, 0x00, 0x00, 0x08, 0xDE, 0x00,
+    0x00, 0x00, 0x00, 0x08, 0xDE, 0x10, 0x00, 0x00, 0x00, 0x3A, 0xDB, 0x54,
+    0x33, 0x22, 0x33, 0x8C, 0xC7, 0xFC, 0xA8, 0x67, 0x8A, 0xFE, 0xA2, 0x7A,
+    0xCE, 0xFF, 0xEC, 0x83, 0x10, 0x23, 0x45, 0x55, 0x54, 0x31, 0x00, 0xFA,
+    0x50, 0x00, 0x00, 0x09, 0xEF, 0xFA, 0x50, 0x00, 0x00, 0x5B, 0xFF, 0xFA,
+    0x50, 0x00, 0x00, 0x9C, 0xEF, 0xFA, 0x50, 0x00, 0x01, 0xED, 0xDF, 0xFA,
+    0x50, 0x00, 0x38, 0xD9, 0xAF, 0xFA, 0x50, 0x01, 0x5D, 0x77, 0xAF, 0xFA,
+    0x50, 0x03, 0x8E, 0x36, 0xAF, 0xFA, 0x50, 0x07, 0xAB, 0x05, 0xAF, 0xFA,
+    0x50, 0x3B, 0xB3, 0x05, 0xAF, 0xFA, 0x50, 0x9B, 0x81, 0x05, 0xAF, 0xFA,
+    0x62, 0xC9, 0x50, 0x05, 0xAF, 0xFA, 0x65, 0xF6, 0x10, 0x05, 0xAF, 0xFA,
+    0x9D, 0x83, 0x00, 0x05, 0xAF, 0xFC, 0xCE, 0x31, 0x00, 0x05, 0xAF, 0xFE,
+    0xDC, 0x10, 0x00, 0x05, 0xAF, 0xFF, 0xC7, 0x00, 0x00, 0x05, 0xAF, 0xFE,
+    0x90, 0x00, 0x00, 0x05, 0xAF, 0x55, 0x30, 0x00, 0x00, 0x02, 0x35, 0x09,
+    0xC9, 0x00, 0x00, 0xAC, 0x90, 0x07, 0xBC, 0x32, 0x34, 0xDB, 0x70, 0x04,
+    0x9D, 0x87, 0x78, 0xC8, 0x40, 0x01, 0x49, 0xDE, 0xED, 0x83, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xA7, 0x30, 0x00, 0x00, 0x06, 0x9A, 0xFA,
+    0x50, 0x00, 0x00, 0x3A, 0xEF, 0xFA, 0x50, 0x00, 0x00, 0x7C, 0xFF, 0xFA,
+    0x50, 0x00, 0x01, 0xED, 0xDF, 0xFA, 0x50, 0x00, 0x26, 0xDA, 0xBF, 0xFA,
+    0x50, 0x00, 0x4A, 0xA8, 0xAF, 0xFA, 0x50, 0x01, 0x6F, 0x46, 0xAF, 0xFA,
+    0x50, 0x07, 0xAB, 0x05, 0xAF, 0xFA, 0x50, 0x2A, 0xB6, 0x05, 0xAF, 0xFA,
+    0x50, 0x6B, 0x92, 0x05, 0xAF, 0xFA, 0x50, 0xBA, 0x60, 0x05, 0xAF, 0xFA,
+    0x65, 0xF6, 0x10, 0x05, 0xAF, 0xFA, 0x8A, 0xA4, 0x00, 0x05, 0xAF, 0xFB,
+    0xAD, 0x62, 0x00, 0x05, 0xAF, 0xFD, 0xDE, 0x10, 0x00, 0x05, 0xAF, 0xFF,
+    0xC7, 0x00, 0x00, 0x05, 0xAF, 0xFE, 0xA3, 0x00, 0x00, 0x05, 0xAF, 0xA9,
+    0x60, 0x00, 0x00, 0x03, 0x7A, 0xFB, 0x60, 0x00, 0x00, 0x2A, 0xDB, 0x00,
+    0xFB, 0x60, 0x00, 0x01, 0x9B, 0xA4, 0x00, 0xFB, 0x60, 0x00, 0x25, 0xDA,
+    0x61, 0x00, 0xFB, 0x60, 0x01, 0x5C, 0xD5, 0x10, 0x00, 0xFB, 0x60, 0x08,
+    0xCD, 0x21, 0x00, 0x00, 0xFB, 0x60, 0x7B, 0xB6, 0x10, 0x00, 0x00, 0xFB,
+    0x83, 0xCB, 0x72, 0x00, 0x00, 0x00, 0xFB, 0xA9, 0xE7, 0x20, 0x00, 0x00,
+    0x00, 0xFD, 0xDF, 0xB4, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xA9, 0xE8, 0x40,
+    0x00, 0x00, 0x00, 0xFB, 0x84, 0xDB, 0x82, 0x00, 0x00, 0x00, 0xFB, 0x60,
+    0x8D, 0xC6, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x07, 0xCF, 0x41, 0x00, 0x00,
+    0xFB, 0x60, 0x03, 0x7D, 0xB5, 0x10, 0x00, 0xFB, 0x60, 0x00, 0x38, 0xE9,
+    0x40, 0x00, 0xFB, 0x60, 0x00, 0x01, 0xDD, 0x91, 0x00, 0xFB, 0x60, 0x00,
+    0x00, 0x2A, 0xDC, 0x10, 0x54, 0x20, 0x00, 0x00, 0x13, 0x44, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x00, 0x01, 0xFE, 0xC9, 0x99, 0xBD,
+    0xF5, 0x00, 0x01, 0xFC, 0x94, 0x44, 0x7B, 0xF5, 0x00, 0x01, 0xFB, 0x60,
+    0x00, 0x3A, 0xF5, 0x00, 0x12, 0xFA, 0x50, 0x00, 0x3A, 0xF5, 0x00, 0x12,
+    0xF9, 0x40, 0x00, 0x3A, 0xF5, 0x00, 0x13, 0xF9, 0x40, 0x00, 0x3A, 0xF5,
+    0x00, 0x14, 0xF8, 0x30, 0x00, 0x3A, 0xF5, 0x00, 0x25, 0xF7, 0x20, 0x00,
+    0x3A, 0xF5, 0x00, 0x26, 0xF6, 0x10, 0x00, 0x3A, 0xF5, 0x00, 0x27, 0xF6,
+    0x10, 0x00, 0x3A, 0xF5, 0x00, 0x38, 0xE5, 0x00, 0x00, 0x3A, 0xF5, 0x00,
+    0x4B, 0xC4, 0x00, 0x00, 0x3A, 0xF5, 0x01, 0x5E, 0x93, 0x00, 0x00, 0x3A,
+    0xF5, 0x24, 0x9F, 0x62, 0x00, 0x00, 0x3A, 0xF5, 0x7A, 0xDE, 0x21, 0x00,
+    0x00, 0x3A, 0xF5, 0xDD, 0xA4, 0x00, 0x00, 0x00, 0x3A, 0xF5, 0x44, 0x31,
+    0x00, 0x00, 0x00, 0x13, 0x52, 0xFD, 0x80, 0x00, 0x00, 0x09, 0xEF, 0xFE,
+    0xA1, 0x00, 0x00, 0x2A, 0xFF, 0xFE, 0xA3, 0x00, 0x00, 0x4A, 0xEF, 0xFD,
+    0xA5, 0x00, 0x00, 0x6A, 0xDF, 0xFC, 0xA9, 0x00, 0x00, 0x9A, 0xCF, 0xFC,
+    0xAA, 0x00, 0x00, 0xAA, 0xCF, 0xFC, 0xAA, 0x10, 0x01, 0xAA, 0xCF, 0xFC,
+    0xA9, 0x21, 0x13, 0x8A, 0xCF, 0xFC, 0x96, 0x62, 0x27, 0x59, 0xCF, 0xFC,
+    0x84, 0x83, 0x39, 0x38, 0xCF, 0xFC, 0x82, 0xB4, 0x4B, 0x18, 0xCF, 0xFC,
+    0x70, 0xD4, 0x4D, 0x07, 0xCF, 0xFC, 0x70, 0xB7, 0x7A, 0x07, 0xCF, 0xFC,
+    0x70, 0x9A, 0xA8, 0x07, 0xCF, 0xFC, 0x70, 0x7B, 0xB6, 0x07, 0xCF, 0xFC,
+    0x70, 0x5C, 0xB4, 0x07, 0xCF, 0xFC, 0x70, 0x2B, 0xA1, 0x07, 0xCF, 0x54,
+    0x20, 0x14, 0x30, 0x02, 0x45, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB,
+    0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB,
+    0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB,
+    0x60, 0x00, 0x00, 0x06, 0xBF, 0xFD, 0x95, 0x55, 0x55, 0x59, 0xDF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xA7, 0x77, 0x77, 0x7A, 0xDF, 0xFC,
+    0x82, 0x22, 0x22, 0x28, 0xCF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB,
+    0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB,
+    0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB,
+    0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0x54,
+    0x20, 0x00, 0x00, 0x02, 0x45, 0x00, 0x38, 0xDE, 0xED, 0x83, 0x00, 0x05,
+    0x9D, 0xBA, 0xAB, 0xD9, 0x40, 0x29, 0xDD, 0x75, 0x57, 0xDC, 0x81, 0x5C,
+    0xD9, 0x00, 0x00, 0x8D, 0xB4, 0xAD, 0xB2, 0x00, 0x00, 0x1A, 0xD9, 0xCD,
+    0x91, 0x00, 0x00, 0x09, 0xDC, 0xDD, 0x80, 0x00, 0x00, 0x08, 0xDD, 0xED,
+    0x80, 0x00, 0x00, 0x08, 0xDE, 0xFC, 0x70, 0x00, 0x00, 0x07, 0xCF, 0xFD,
+    0x80, 0x00, 0x00, 0x08, 0xCE, 0xED, 0x80, 0x00, 0x00, 0x08, 0xDE, 0xDD,
+    0x90, 0x00, 0x00, 0x09, 0xDD, 0xAD, 0xB2, 0x00, 0x00, 0x2B, 0xD9, 0x7C,
+    0xC6, 0x00, 0x00, 0x6C, 0xC6, 0x3A, 0xDB, 0x33, 0x33, 0xBC, 0xA3, 0x07,
+    0xCF, 0xA8, 0x8A, 0xFB, 0x60, 0x00, 0x38, 0xDE, 0xED, 0x73, 0x00, 0x00,
+    0x13, 0x45, 0x54, 0x21, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
+    0xC9, 0x99, 0x99, 0x9C, 0xEF, 0xFC, 0x94, 0x44, 0x44, 0x49, 0xCF, 0xFB,
+    0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB,
+    0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB,
+    0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB,
+    0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB,
+    0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB,
+    0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB,
+    0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0x54,
+    0x20, 0x00, 0x00, 0x02, 0x45, 0xFF, 0xFF, 0xFF, 0xED, 0xA6, 0x20, 0xFE,
+    0xC9, 0x99, 0xAB, 0xDC, 0x93, 0xFC, 0x94, 0x44, 0x56, 0xAD, 0xC8, 0xFB,
+    0x60, 0x00, 0x00, 0x3B, 0xED, 0xFB, 0x60, 0x00, 0x00, 0x08, 0xDF, 0xFB,
+    0x60, 0x00, 0x00, 0x09, 0xDD, 0xFB, 0x60, 0x00, 0x11, 0x4B, 0xDB, 0xFB,
+    0x60, 0x01, 0x23, 0xBE, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0x40, 0xFE,
+    0xC9, 0x99, 0x87, 0x53, 0x10, 0xFC, 0x94, 0x44, 0x32, 0x00, 0x00, 0xFB,
+    0x60, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x00, 0xFB,
+    0x60, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x00, 0xFB,
+    0x60, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x00, 0x54,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x9C, 0xEF, 0xEC, 0xA6, 0x02,
+    0x5A, 0xDB, 0xAA, 0xAB, 0xB8, 0x05, 0x9E, 0xB8, 0x65, 0x57, 0x77, 0x1A,
+    0xEE, 0x31, 0x00, 0x00, 0x00, 0x7C, 0xC6, 0x00, 0x00, 0x00, 0x00, 0xAD,
+    0xB2, 0x00, 0x00, 0x00, 0x00, 0xCD, 0x90, 0x00, 0x00, 0x00, 0x00, 0xED,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x70, 0x00, 0x00, 0x00, 0x00, 0xED,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0xDD, 0x90, 0x00, 0x00, 0x00, 0x00, 0xCE,
+    0xA0, 0x00, 0x00, 0x00, 0x00, 0x8D, 0xC5, 0x00, 0x00, 0x00, 0x00, 0x4B,
+    0xDB, 0x21, 0x00, 0x00, 0x00, 0x18, 0xCE, 0x74, 0x32, 0x23, 0x34, 0x03,
+    0x8F, 0xFC, 0x97, 0x78, 0xAD, 0x00, 0x12, 0x9C, 0xEF, 0xED, 0xC9, 0x00,
+    0x01, 0x34, 0x55, 0x54, 0x43, 0x9D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5,
+    0x68, 0x99, 0x9C, 0xEF, 0x99, 0x99, 0x93, 0x34, 0x44, 0x49, 0xCF, 0x54,
+    0x44, 0x41, 0x00, 0x00, 0x06, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
+    0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x06, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x06, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x06, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x06, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
+    0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x45, 0x00, 0x00, 0x00, 0xBD,
+    0xA1, 0x00, 0x00, 0x00, 0x01, 0xEC, 0x87, 0xCC, 0x50, 0x00, 0x00, 0x02,
+    0x5F, 0x94, 0x3A, 0xDA, 0x00, 0x00, 0x00, 0x39, 0xE6, 0x20, 0x8C, 0xE1,
+    0x00, 0x00, 0x05, 0xDC, 0x40, 0x03, 0x8F, 0x72, 0x00, 0x04, 0x9F, 0x41,
+    0x00, 0x15, 0xDB, 0x40, 0x00, 0x7B, 0xD1, 0x00, 0x00, 0x3A, 0xE6, 0x20,
+    0x2A, 0xCA, 0x00, 0x00, 0x02, 0x5F, 0x94, 0x05, 0xCC, 0x50, 0x00, 0x00,
+    0x00, 0xCD, 0x90, 0xCC, 0x80, 0x00, 0x00, 0x00, 0x08, 0xCC, 0x6E, 0xA5,
+    0x00, 0x00, 0x00, 0x00, 0x3B, 0xDB, 0xE7, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x9D, 0xFD, 0x40, 0x00, 0x00, 0x00, 0x00, 0x05, 0xAF, 0x62, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x7B, 0xE2, 0x10, 0x00, 0x00, 0x02, 0x32, 0x4A, 0xCB,
+    0x00, 0x00, 0x00, 0x00, 0x79, 0x7B, 0xEC, 0x50, 0x00, 0x00, 0x00, 0x09,
+    0xEF, 0xD8, 0x40, 0x00, 0x00, 0x00, 0x00, 0x35, 0x54, 0x31, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
+    0xBF, 0x00, 0x00, 0x00, 0x01, 0x24, 0x59, 0xDF, 0x54, 0x31, 0x00, 0x02,
+    0x5B, 0xEF, 0xFF, 0xFD, 0x94, 0x00, 0x2A, 0xEE, 0x8A, 0xDF, 0x7B, 0xEF,
+    0x21, 0x7C, 0xC6, 0x38, 0xCF, 0x25, 0x9F, 0x72, 0xBD, 0xA2, 0x06, 0xBF,
+    0x01, 0x5E, 0xB4, 0xEC, 0x80, 0x06, 0xBF, 0x00, 0x4B, 0xD4, 0xFC, 0x70,
+    0x06, 0xBF, 0x00, 0x3A, 0xE5, 0xEC, 0x80, 0x06, 0xBF, 0x00, 0x4B, 0xD4,
+    0xCD, 0x91, 0x06, 0xBF, 0x01, 0x5D, 0xC4, 0x9D, 0xB3, 0x06, 0xBF, 0x02,
+    0x7F, 0x93, 0x2A, 0xEE, 0x8B, 0xDF, 0x7B, 0xEE, 0x21, 0x14, 0x8C, 0xCD,
+    0xEF, 0xCC, 0xA7, 0x10, 0x01, 0x37, 0x9C, 0xEF, 0xA8, 0x62, 0x00, 0x00,
+    0x00, 0x06, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x02, 0x45, 0x00, 0x00, 0x00, 0xAD, 0xA2, 0x00, 0x00,
+    0x00, 0x12, 0xEB, 0x64, 0xAC, 0x80, 0x00, 0x00, 0x03, 0x8D, 0x73, 0x17,
+    0xBD, 0x31, 0x00, 0x01, 0x6C, 0xA4, 0x00, 0x27, 0xF7, 0x20, 0x00, 0x49,
+    0xF3, 0x10, 0x00, 0x38, 0xF7, 0x20, 0x3B, 0xC7, 0x00, 0x00, 0x01, 0x3D,
+    0xB6, 0x19, 0xB9, 0x30, 0x00, 0x00, 0x00, 0x9C, 0xA5, 0xDA, 0x60, 0x00,
+    0x00, 0x00, 0x02, 0xAE, 0xDE, 0x61, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF,
+    0x93, 0x00, 0x00, 0x00, 0x00, 0x02, 0x9D, 0xDD, 0x61, 0x00, 0x00, 0x00,
+    0x00, 0x6B, 0xC8, 0xE9, 0x40, 0x00, 0x00, 0x00, 0x1D, 0xB7, 0x0C, 0xC9,
+    0x10, 0x00, 0x00, 0x39, 0xE6, 0x10, 0x3B, 0xD9, 0x00, 0x00, 0x26, 0xD8,
+    0x30, 0x01, 0x7B, 0xD3, 0x10, 0x05, 0x9D, 0x41, 0x00, 0x03, 0x8E, 0x73,
+    0x01, 0x9C, 0xA0, 0x00, 0x00, 0x04, 0xCD, 0x51, 0xAC, 0xA1, 0x00, 0x00,
+    0x00, 0x13, 0xFB, 0x73, 0x43, 0x00, 0x00, 0x00, 0x00, 0x15, 0x42, 0xFB,
+    0x60, 0x00, 0x00, 0xAD, 0xA0, 0x00, 0xFB, 0x60, 0x00, 0x00, 0xAD, 0xA0,
+    0x00, 0xFB, 0x60, 0x00, 0x00, 0xAD, 0xA0, 0x00, 0xFB, 0x60, 0x00, 0x00,
+    0xAD, 0xA0, 0x00, 0xFB, 0x60, 0x00, 0x00, 0xAD, 0xA0, 0x00, 0xFB, 0x60,
+    0x00, 0x00, 0xAD, 0xA0, 0x00, 0xFB, 0x60, 0x00, 0x00, 0xAD, 0xA0, 0x00,
+    0xFB, 0x60, 0x00, 0x00, 0xAD, 0xA0, 0x00, 0xFB, 0x60, 0x00, 0x00, 0xAD,
+    0xA0, 0x00, 0xFB, 0x60, 0x00, 0x00, 0xAD, 0xA0, 0x00, 0xFB, 0x60, 0x00,
+    0x00, 0xAD, 0xA0, 0x00, 0xFB, 0x60, 0x00, 0x00, 0xAD, 0xA0, 0x00, 0xFB,
+    0x60, 0x00, 0x00, 0xAD, 0xA0, 0x00, 0xFB, 0x60, 0x00, 0x00, 0xAD, 0xA0,
+    0x00, 0xFC, 0x82, 0x22, 0x22, 0xAD, 0xB2, 0x21, 0xFD, 0xA7, 0x77, 0x77,
+    0xCE, 0xC7, 0x72, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x7A, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xF5,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x38, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x52, 0xFB, 0x60, 0x00,
+    0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00,
+    0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00,
+    0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFC, 0x70, 0x00,
+    0x00, 0x07, 0xCF, 0xED, 0x80, 0x00, 0x00, 0x07, 0xCF, 0x9D, 0xEB, 0x78,
+    0x8A, 0xEF, 0xFF, 0x38, 0xBC, 0xCC, 0xBB, 0x9B, 0xDF, 0x04, 0x69, 0xA9,
+    0x97, 0x59, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0x00, 0x00, 0x00,
+    0x00, 0x06, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0x00, 0x00, 0x00,
+    0x00, 0x06, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0x00, 0x00, 0x00,
+    0x00, 0x06, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x02, 0x45, 0xFB, 0x60, 0x0A,
+    0xDA, 0x00, 0x3A, 0xF5, 0xFB, 0x60, 0x0A, 0xDA, 0x00, 0x3A, 0xF5, 0xFB,
+    0x60, 0x0A, 0xDA, 0x00, 0x3A, 0xF5, 0xFB, 0x60, 0x0A, 0xDA, 0x00, 0x3A,
+    0xF5, 0xFB, 0x60, 0x0A, 0xDA, 0x00, 0x3A, 0xF5, 0xFB, 0x60, 0x0A, 0xDA,
+    0x00, 0x3A, 0xF5, 0xFB, 0x60, 0x0A, 0xDA, 0x00, 0x3A, 0xF5, 0xFB, 0x60,
+    0x0A, 0xDA, 0x00, 0x3A, 0xF5, 0xFB, 0x60, 0x0A, 0xDA, 0x00, 0x3A, 0xF5,
+    0xFB, 0x60, 0x0A, 0xDA, 0x00, 0x3A, 0xF5, 0xFB, 0x60, 0x0A, 0xDA, 0x00,
+    0x3A, 0xF5, 0xFB, 0x60, 0x0A, 0xDA, 0x00, 0x3A, 0xF5, 0xFB, 0x60, 0x0A,
+    0xDA, 0x00, 0x3A, 0xF5, 0xFB, 0x60, 0x0A, 0xDA, 0x00, 0x3A, 0xF5, 0xFC,
+    0x82, 0x2B, 0xDA, 0x22, 0x5A, 0xF5, 0xFD, 0xA7, 0x7C, 0xEC, 0x77, 0x8C,
+    0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x52, 0xFB, 0x60, 0x0A, 0xDA, 0x00, 0x3A, 0xF5, 0x0F, 0xB6,
+    0x00, 0xAD, 0xA0, 0x03, 0xAF, 0x50, 0xFB, 0x60, 0x0A, 0xDA, 0x00, 0x3A,
+    0xF5, 0x0F, 0xB6, 0x00, 0xAD, 0xA0, 0x03, 0xAF, 0x50, 0xFB, 0x60, 0x0A,
+    0xDA, 0x00, 0x3A, 0xF5, 0x0F, 0xB6, 0x00, 0xAD, 0xA0, 0x03, 0xAF, 0x50,
+    0xFB, 0x60, 0x0A, 0xDA, 0x00, 0x3A, 0xF5, 0x0F, 0xB6, 0x00, 0xAD, 0xA0,
+    0x03, 0xAF, 0x50, 0xFB, 0x60, 0x0A, 0xDA, 0x00, 0x3A, 0xF5, 0x0F, 0xB6,
+    0x00, 0xAD, 0xA0, 0x03, 0xAF, 0x50, 0xFB, 0x60, 0x0A, 0xDA, 0x00, 0x3A,
+    0xF5, 0x0F, 0xB6, 0x00, 0xAD, 0xA0, 0x03, 0xAF, 0x50, 0xFB, 0x60, 0x0A,
+    0xDA, 0x00, 0x3A, 0xF5, 0x0F, 0xB6, 0x00, 0xAD, 0xA0, 0x03, 0xAF, 0x50,
+    0xFC, 0x82, 0x2B, 0xDA, 0x22, 0x5A, 0xF6, 0x1F, 0xDA, 0x77, 0xCE, 0xC7,
+    0x78, 0xCF, 0x94, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA5, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x5A, 0xDA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x8D, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xDA, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x8D, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x43,
+    0xFF, 0xFF, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x99, 0x99, 0xFB, 0x60, 0x00,
+    0x00, 0x00, 0x44, 0x44, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB,
+    0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x95, 0x44, 0x21,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xDB, 0x72, 0x00, 0x00, 0x00, 0xFD, 0xA7,
+    0x9D, 0xEE, 0x31, 0x00, 0x00, 0xFC, 0x82, 0x35, 0x9F, 0x83, 0x00, 0x00,
+    0xFB, 0x60, 0x01, 0x6E, 0xC4, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x4C, 0xE5,
+    0x00, 0x00, 0xFB, 0x60, 0x00, 0x4C, 0xE5, 0x00, 0x00, 0xFB, 0x60, 0x01,
+    0x6E, 0xC4, 0x00, 0x00, 0xFC, 0x82, 0x35, 0x9F, 0x83, 0x00, 0x00, 0xFD,
+    0xA6, 0x8C, 0xEF, 0x31, 0x00, 0x00, 0xFF, 0xFF, 0xEB, 0x83, 0x00, 0x00,
+    0x00, 0x55, 0x55, 0x54, 0x31, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x05, 0xAF,
+    0xFB, 0x60, 0x00, 0x00, 0x05, 0xAF, 0xFB, 0x60, 0x00, 0x00, 0x05, 0xAF,
+    0xFB, 0x60, 0x00, 0x00, 0x05, 0xAF, 0xFB, 0x60, 0x00, 0x00, 0x05, 0xAF,
+    0xFB, 0x60, 0x00, 0x00, 0x05, 0xAF, 0xFD, 0x95, 0x42, 0x10, 0x05, 0xAF,
+    0xFF, 0xFE, 0xC7, 0x30, 0x05, 0xAF, 0xFD, 0xB8, 0xCE, 0xC5, 0x05, 0xAF,
+    0xFC, 0x83, 0x4A, 0xC9, 0x05, 0xAF, 0xFB, 0x60, 0x08, 0xCC, 0x05, 0xAF,
+    0xFB, 0x60, 0x06, 0xAE, 0x05, 0xAF, 0xFB, 0x60, 0x06, 0xBE, 0x05, 0xAF,
+    0xFB, 0x60, 0x08, 0xCD, 0x05, 0xAF, 0xFC, 0x82, 0x4A, 0xC9, 0x05, 0xAF,
+    0xFD, 0xA7, 0xCE, 0xC5, 0x05, 0xAF, 0xFF, 0xFE, 0xC7, 0x30, 0x05, 0xAF,
+    0x55, 0x55, 0x42, 0x10, 0x02, 0x35, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x00,
+    0xFB, 0x60, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x00,
+    0xFB, 0x60, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x00,
+    0xFB, 0x60, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x95, 0x55, 0x54, 0x31, 0x00,
+    0xFF, 0xFF, 0xFF, 0xEC, 0x84, 0x10, 0xFD, 0xA7, 0x77, 0x8A, 0xFE, 0xA3,
+    0xFC, 0x82, 0x22, 0x33, 0x7C, 0xD8, 0xFB, 0x60, 0x00, 0x00, 0x3A, 0xDC,
+    0xFB, 0x60, 0x00, 0x00, 0x08, 0xDE, 0xFB, 0x60, 0x00, 0x00, 0x08, 0xDE,
+    0xFB, 0x60, 0x00, 0x00, 0x3A, 0xDC, 0xFC, 0x82, 0x22, 0x33, 0x8C, 0xD8,
+    0xFD, 0xA6, 0x67, 0x8A, 0xFE, 0xA3, 0xFF, 0xFF, 0xFF, 0xED, 0x94, 0x10,
+    0x55, 0x55, 0x55, 0x54, 0x31, 0x00, 0x05, 0x9C, 0xEE, 0xED, 0x94, 0x10,
+    0x00, 0x07, 0xBC, 0xAA, 0xAB, 0xDB, 0x83, 0x00, 0x05, 0x88, 0x55, 0x56,
+    0xAD, 0xC7, 0x10, 0x00, 0x00, 0x00, 0x00, 0x29, 0xDE, 0x21, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x7F, 0x83, 0x00, 0x00, 0x00, 0x00, 0x01, 0x5E, 0xB4,
+    0x00, 0x00, 0x55, 0x55, 0x55, 0x8E, 0xD4, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xE5, 0x00, 0x00, 0x77, 0x77, 0x77, 0x9D, 0xF5, 0x00, 0x00, 0x22,
+    0x22, 0x22, 0x6D, 0xE5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5D, 0xD4, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x5F, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x04, 0x9F,
+    0x72, 0x00, 0x00, 0x00, 0x00, 0x28, 0xCE, 0x31, 0x03, 0x43, 0x22, 0x33,
+    0x7C, 0xDA, 0x10, 0x08, 0xB9, 0x77, 0x8A, 0xFE, 0xB4, 0x00, 0x06, 0xAD,
+    0xEE, 0xED, 0x94, 0x10, 0x00, 0x02, 0x34, 0x55, 0x54, 0x31, 0x00, 0x00,
+    0xFB, 0x60, 0x05, 0xAE, 0xE9, 0x40, 0xFB, 0x60, 0x39, 0xCB, 0xBC, 0x92,
+    0xFB, 0x60, 0x6C, 0xC6, 0x7C, 0xB5, 0xFB, 0x60, 0x9C, 0x90, 0x09, 0xC9,
+    0xFB, 0x60, 0xCB, 0x70, 0x07, 0xBC, 0xFB, 0x60, 0xDA, 0x60, 0x06, 0xAD,
+    0xFD, 0x95, 0xEA, 0x60, 0x06, 0xAE, 0xFF, 0xFF, 0xFA, 0x50, 0x05, 0xAF,
+    0xFD, 0xA7, 0xFA, 0x50, 0x05, 0xAF, 0xFC, 0x82, 0xFA, 0x50, 0x05, 0xAF,
+    0xFB, 0x60, 0xEA, 0x50, 0x05, 0xAE, 0xFB, 0x60, 0xDA, 0x60, 0x06, 0xAE,
+    0xFB, 0x60, 0xBA, 0x70, 0x07, 0xBC, 0xFB, 0x60, 0x9B, 0x80, 0x08, 0xBA,
+    0xFB, 0x60, 0x7B, 0xA3, 0x4A, 0xC7, 0xFB, 0x60, 0x3B, 0xDA, 0xAD, 0xB3,
+    0xFB, 0x60, 0x04, 0x9E, 0xE9, 0x40, 0x54, 0x20, 0x01, 0x35, 0x53, 0x10,
+    0x00, 0x00, 0x48, 0xBD, 0xFF, 0xFF, 0xFF, 0xA0, 0x01, 0x4B, 0xCC, 0xB9,
+    0x99, 0x9D, 0xEA, 0x00, 0x38, 0xFC, 0x96, 0x54, 0x44, 0xBE, 0xA0, 0x04,
+    0xDE, 0x62, 0x00, 0x00, 0x0A, 0xDA, 0x00, 0x5F, 0xC4, 0x00, 0x00, 0x00,
+    0xAD, 0xA0, 0x04, 0xDD, 0x50, 0x00, 0x00, 0x0A, 0xDA, 0x00, 0x3A, 0xE8,
+    0x31, 0x00, 0x00, 0xAD, 0xA0, 0x02, 0x5F, 0xD9, 0x41, 0x00, 0x0A, 0xDA,
+    0x00, 0x00, 0x49, 0xDF, 0xFF, 0xFF, 0xFF, 0xA0, 0x00, 0x01, 0x6B, 0xFC,
+    0xA9, 0x9D, 0xEA, 0x00, 0x00, 0x17, 0xBE, 0x75, 0x44, 0xBE, 0xA0, 0x00,
+    0x03, 0xBE, 0xD1, 0x00, 0x0A, 0xDA, 0x00, 0x00, 0xCE, 0xB3, 0x00, 0x00,
+    0xAD, 0xA0, 0x02, 0x5E, 0xB7, 0x10, 0x00, 0x0A, 0xDA, 0x01, 0x4A, 0xE8,
+    0x30, 0x00, 0x00, 0xAD, 0xA0, 0x27, 0xFB, 0x40, 0x00, 0x00, 0x0A, 0xDA,
+    0x19, 0xDE, 0x21, 0x00, 0x00, 0x00, 0xAD, 0xA0, 0x34, 0x51, 0x00, 0x00,
+    0x00, 0x03, 0x43, 0x15, 0x8C, 0xEE, 0xED, 0x83, 0x01, 0x8B, 0xA9, 0x99,
+    0xBD, 0x84, 0x16, 0x86, 0x44, 0x57, 0xEB, 0x70, 0x00, 0x00, 0x00, 0x0C,
+    0xD9, 0x00, 0x00, 0x00, 0x00, 0x9D, 0xA0, 0x24, 0x78, 0x99, 0xAD, 0xEA,
+    0x26, 0x9A, 0xAA, 0xAA, 0xDE, 0xA7, 0xCE, 0xB5, 0x43, 0x2A, 0xDA, 0xED,
+    0x80, 0x00, 0x00, 0xAD, 0xAE, 0xC8, 0x00, 0x00, 0x1D, 0xEA, 0xDC, 0x92,
+    0x12, 0x35, 0xDE, 0xAA, 0xDC, 0x74, 0x69, 0xDC, 0xEA, 0x17, 0xBE, 0xFD,
+    0xA6, 0x4B, 0xA0, 0x24, 0x55, 0x43, 0x21, 0x43, 0x00, 0x00, 0x03, 0x57,
+    0x9B, 0xCA, 0x00, 0x25, 0xAB, 0xBC, 0xBB, 0xA8, 0x02, 0x6A, 0xCB, 0xBA,
+    0x87, 0x64, 0x06, 0xBF, 0x95, 0x20, 0x00, 0x00, 0x3B, 0xD8, 0x00, 0x00,
+    0x00, 0x00, 0x7C, 0xB3, 0x00, 0x00, 0x00, 0x00, 0xAC, 0xA2, 0x44, 0x55,
+    0x42, 0x10, 0xCC, 0x93, 0xBD, 0xEE, 0xB6, 0x20, 0xED, 0xEE, 0xA7, 0x67,
+    0xDE, 0xB3, 0xEE, 0xC8, 0x32, 0x22, 0x5C, 0xD8, 0xFE, 0xA3, 0x00, 0x00,
+    0x19, 0xDC, 0xFC, 0x70, 0x00, 0x00, 0x08, 0xCE, 0xDC, 0x70, 0x00, 0x00,
+    0x07, 0xCF, 0xBC, 0x90, 0x00, 0x00, 0x08, 0xCE, 0x9C, 0xA2, 0x00, 0x00,
+    0x19, 0xCC, 0x5C, 0xC6, 0x00, 0x00, 0x2B, 0xD9, 0x07, 0xCF, 0x86, 0x67,
+    0xED, 0x91, 0x03, 0x6A, 0xCC, 0xCB, 0xB7, 0x40, 0x00, 0x25, 0x99, 0xA9,
+    0x63, 0x10, 0xFF, 0xFF, 0xFF, 0xFE, 0xDA, 0x61, 0xFD, 0xB8, 0x88, 0x88,
+    0xAC, 0xB8, 0xFC, 0x83, 0x33, 0x34, 0x5A, 0xDC, 0xFB, 0x60, 0x00, 0x00,
+    0x06, 0xBE, 0xFB, 0x60, 0x00, 0x01, 0x3A, 0xCA, 0xFE, 0xCA, 0xAA, 0xAA,
+    0xB9, 0x73, 0xFE, 0xDC, 0xCC, 0xCC, 0xDA, 0x72, 0xFC, 0x95, 0x55, 0x56,
+    0x9D, 0xC6, 0xFB, 0x60, 0x00, 0x00, 0x07, 0xBE, 0xFB, 0x60, 0x00, 0x00,
+    0x07, 0xCE, 0xFB, 0x72, 0x22, 0x22, 0x39, 0xCC, 0xFC, 0x95, 0x55, 0x56,
+    0xAD, 0xD9, 0xFF, 0xFF, 0xFF, 0xFE, 0xC8, 0x40, 0x55, 0x55, 0x55, 0x55,
+    0x43, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xB8, 0x88, 0x88, 0xFC, 0x83,
+    0x33, 0x33, 0xFB, 0x60, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0xFB, 0x60,
+    0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0xFB, 0x60,
+    0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0xFB, 0x60,
+    0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x54, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xFC, 0x98, 0x8A, 0xDF, 0x00,
+    0x00, 0x12, 0xF9, 0x53, 0x37, 0xCF, 0x00, 0x00, 0x12, 0xF8, 0x30, 0x06,
+    0xBF, 0x00, 0x00, 0x25, 0xF6, 0x10, 0x06, 0xBF, 0x00, 0x00, 0x26, 0xE5,
+    0x00, 0x06, 0xBF, 0x00, 0x00, 0x39, 0xD4, 0x00, 0x06, 0xBF, 0x00, 0x00,
+    0x4B, 0xB4, 0x00, 0x06, 0xBF, 0x00, 0x01, 0x6F, 0x62, 0x00, 0x06, 0xBF,
+    0x00, 0x03, 0x8E, 0x21, 0x00, 0x06, 0xBF, 0x00, 0x27, 0xAD, 0x22, 0x22,
+    0x27, 0xBF, 0x21, 0x5B, 0xDB, 0x55, 0x55, 0x59, 0xCF, 0x52, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0xFC, 0x95, 0x55, 0x55, 0x55, 0x7B, 0xF5,
+    0xFB, 0x60, 0x00, 0x00, 0x00, 0x38, 0xF5, 0xFB, 0x60, 0x00, 0x00, 0x00,
+    0x38, 0xF5, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x38, 0xF5, 0x54, 0x20, 0x00,
+    0x00, 0x00, 0x13, 0x52, 0x00, 0x38, 0xDE, 0xEE, 0xA5, 0x10, 0x05, 0x9C,
+    0xA9, 0x99, 0xCB, 0x71, 0x39, 0xCB, 0x54, 0x45, 0x9C, 0xB5, 0x7C, 0xB3,
+    0x00, 0x00, 0x1A, 0xDA, 0xCC, 0x80, 0x00, 0x00, 0x07, 0xCE, 0xEE, 0xDA,
+    0xAA, 0xAA, 0xAC, 0xEF, 0xEE, 0xDC, 0xCC, 0xCC, 0xCC, 0xCC, 0xFD, 0xA5,
+    0x55, 0x55, 0x55, 0x55, 0xCD, 0x90, 0x00, 0x00, 0x00, 0x00, 0x9C, 0xB3,
+    0x00, 0x00, 0x00, 0x00, 0x5B, 0xC8, 0x32, 0x22, 0x23, 0x32, 0x07, 0xCF,
+    0x97, 0x66, 0x7A, 0xA7, 0x00, 0x27, 0xCE, 0xEE, 0xDB, 0x73, 0x00, 0x12,
+    0x45, 0x55, 0x44, 0x21, 0x19, 0xCA, 0x00, 0x5F, 0x93, 0x00, 0xAC, 0x91,
+    0x06, 0xAD, 0x21, 0x5F, 0x93, 0x13, 0xD9, 0x50, 0x03, 0x7E, 0x62, 0x5F,
+    0x93, 0x38, 0xD6, 0x20, 0x00, 0x4C, 0xB4, 0x5F, 0x93, 0x5D, 0x93, 0x00,
+    0x00, 0x14, 0xF8, 0x8F, 0x99, 0xAE, 0x10, 0x00, 0x00, 0x01, 0xCA, 0xBF,
+    0xBC, 0xB8, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xDF, 0xBE, 0xC6, 0x00, 0x00,
+    0x00, 0x00, 0xCB, 0xCF, 0xBD, 0xC7, 0x00, 0x00, 0x00, 0x25, 0xF7, 0x7F,
+    0x98, 0xAE, 0x21, 0x00, 0x00, 0x4A, 0xC5, 0x6F, 0x95, 0x6E, 0x83, 0x00,
+    0x02, 0x6E, 0x83, 0x5F, 0x93, 0x4A, 0xC5, 0x10, 0x04, 0x9F, 0x31, 0x5F,
+    0x93, 0x25, 0xF8, 0x30, 0x19, 0xDB, 0x00, 0x5F, 0x93, 0x00, 0xBD, 0x91,
+    0x03, 0x44, 0x00, 0x25, 0x31, 0x00, 0x44, 0x30, 0x7A, 0xDE, 0xFE, 0xC9,
+    0x10, 0x9A, 0xA9, 0x89, 0xBD, 0x72, 0x66, 0x64, 0x45, 0x8D, 0xC4, 0x00,
+    0x00, 0x00, 0x39, 0xE5, 0x00, 0x00, 0x12, 0x7D, 0xB4, 0x00, 0x3A, 0xAB,
+    0xBC, 0x41, 0x00, 0x4C, 0xCD, 0xDD, 0x31, 0x00, 0x25, 0x68, 0xBF, 0x83,
+    0x00, 0x00, 0x00, 0x3A, 0xE5, 0x00, 0x00, 0x00, 0x3A, 0xE5, 0x43, 0x22,
+    0x23, 0x6C, 0xC4, 0xDA, 0x76, 0x68, 0xBF, 0x93, 0x9B, 0xDE, 0xED, 0xB7,
+    0x00, 0x34, 0x45, 0x54, 0x42, 0x00, 0xFB, 0x60, 0x00, 0x12, 0xFF, 0xAF,
+    0xB6, 0x00, 0x03, 0x8F, 0xFA, 0xFB, 0x60, 0x01, 0x5C, 0xDE, 0xAF, 0xB6,
+    0x00, 0x37, 0xE9, 0xDA, 0xFB, 0x60, 0x08, 0xA7, 0x8D, 0xAF, 0xB6, 0x04,
+    0xA9, 0x38, 0xDA, 0xFB, 0x60, 0x8A, 0x70, 0x8D, 0xAF, 0xB6, 0x1D, 0x83,
+    0x08, 0xDA, 0xFA, 0x87, 0xC4, 0x00, 0x8D, 0xAF, 0xBA, 0xC6, 0x20, 0x08,
+    0xDA, 0xFC, 0xBD, 0x21, 0x00, 0x8D, 0xAF, 0xFD, 0xA0, 0x00, 0x08, 0xDA,
+    0xFF, 0xB2, 0x00, 0x00, 0x8D, 0xA5, 0x54, 0x10, 0x00, 0x03, 0x43, 0x09,
+    0xC9, 0x00, 0x00, 0xAC, 0x90, 0x7B, 0xC3, 0x23, 0x4D, 0xB7, 0x04, 0x9D,
+    0x87, 0x78, 0xC8, 0x40, 0x14, 0x9D, 0xEE, 0xD8, 0x30, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0A, 0x74, 0x00, 0x01, 0x2A, 0xA7, 0xFB, 0x60, 0x00, 0x25,
+    0xFF, 0xAF, 0xB6, 0x00, 0x03, 0xAE, 0xFA, 0xFB, 0x60, 0x03, 0x7E, 0x9D,
+    0xAF, 0xB6, 0x00, 0x69, 0x98, 0xDA, 0xFB, 0x60, 0x29, 0xA5, 0x8D, 0xAF,
+    0xB6, 0x06, 0xB9, 0x08, 0xDA, 0xFB, 0x61, 0xD8, 0x30, 0x8D, 0xAF, 0xA7,
+    0x5C, 0x51, 0x08, 0xDA, 0xFB, 0x9A, 0x93, 0x00, 0x8D, 0xAF, 0xBB, 0xE3,
+    0x10, 0x08, 0xDA, 0xFF, 0xDA, 0x00, 0x00, 0x8D, 0xAF, 0xFB, 0x50, 0x00,
+    0x08, 0xDA, 0xAA, 0x71, 0x00, 0x00, 0x69, 0x70, 0xFB, 0x60, 0x00, 0x00,
+    0x7C, 0xC6, 0xFB, 0x60, 0x00, 0x26, 0xC9, 0x62, 0xFB, 0x60, 0x03, 0x6A,
+    0xA5, 0x20, 0xFB, 0x60, 0x17, 0xBD, 0x21, 0x00, 0xFB, 0x61, 0xCB, 0x81,
+    0x00, 0x00, 0xFC, 0xA9, 0xA6, 0x30, 0x00, 0x00, 0xFC, 0xBC, 0xA4, 0x10,
+    0x00, 0x00, 0xFB, 0xAB, 0xD6, 0x10, 0x00, 0x00, 0xFB, 0x60, 0xBD, 0xA3,
+    0x00, 0x00, 0xFB, 0x60, 0x49, 0xBB, 0x31, 0x00, 0xFB, 0x60, 0x04, 0x9D,
+    0x84, 0x10, 0xFB, 0x60, 0x00, 0x39, 0xF8, 0x40, 0xFB, 0x60, 0x00, 0x00,
+    0x8D, 0xC7, 0x54, 0x20, 0x00, 0x00, 0x34, 0x42, 0x00, 0x5F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x00, 0x5F, 0xCA, 0x88, 0x8B, 0xDF, 0x00, 0x5F, 0xB6, 0x33,
+    0x38, 0xCF, 0x01, 0x6F, 0x93, 0x00, 0x06, 0xBF, 0x01, 0x6F, 0x93, 0x00,
+    0x06, 0xBF, 0x02, 0x7F, 0x93, 0x00, 0x06, 0xBF, 0x02, 0x7F, 0x83, 0x00,
+    0x06, 0xBF, 0x03, 0x8F, 0x72, 0x00, 0x06, 0xBF, 0x04, 0x9F, 0x41, 0x00,
+    0x06, 0xBF, 0x05, 0xAF, 0x21, 0x00, 0x06, 0xBF, 0x17, 0xBC, 0x00, 0x00,
+    0x06, 0xBF, 0x4B, 0xC8, 0x00, 0x00, 0x06, 0xBF, 0xFC, 0x71, 0x00, 0x00,
+    0x06, 0xBF, 0x54, 0x20, 0x00, 0x00, 0x02, 0x45, 0xFF, 0xA1, 0x00, 0x00,
+    0x0A, 0xEF, 0xFF, 0xB3, 0x00, 0x00, 0x3B, 0xFF, 0xFE, 0xC7, 0x00, 0x00,
+    0x6C, 0xEF, 0xFD, 0xBA, 0x00, 0x00, 0xAB, 0xDF, 0xFB, 0xBE, 0x10, 0x00,
+    0xEB, 0xBF, 0xFB, 0xAC, 0x31, 0x13, 0xCA, 0xBF, 0xFB, 0x99, 0x62, 0x26,
+    0x99, 0xBF, 0xFB, 0x86, 0xA3, 0x3A, 0x68, 0xBF, 0xFB, 0x61, 0xE5, 0x5E,
+    0x16, 0xBF, 0xFB, 0x60, 0xC7, 0x7C, 0x06, 0xBF, 0xFB, 0x60, 0xAA, 0xAA,
+    0x06, 0xBF, 0xFB, 0x60, 0x7C, 0xC7, 0x06, 0xBF, 0xFB, 0x60, 0x2B, 0xB2,
+    0x06, 0xBF, 0x54, 0x20, 0x14, 0x41, 0x02, 0x45, 0xFB, 0x60, 0x00, 0x00,
+    0x9D, 0xAF, 0xB6, 0x00, 0x00, 0x09, 0xDA, 0xFB, 0x60, 0x00, 0x00, 0x9D,
+    0xAF, 0xB6, 0x00, 0x00, 0x09, 0xDA, 0xFB, 0x60, 0x00, 0x00, 0x9D, 0xAF,
+    0xEC, 0xAA, 0xAA, 0xAD, 0xEA, 0xFE, 0xDC, 0xCC, 0xCC, 0xEF, 0xAF, 0xC9,
+    0x55, 0x55, 0x5B, 0xEA, 0xFB, 0x60, 0x00, 0x00, 0x9D, 0xAF, 0xB6, 0x00,
+    0x00, 0x09, 0xDA, 0xFB, 0x60, 0x00, 0x00, 0x9D, 0xAF, 0xB6, 0x00, 0x00,
+    0x09, 0xDA, 0xFB, 0x60, 0x00, 0x00, 0x9D, 0xA5, 0x42, 0x00, 0x00, 0x03,
+    0x43, 0x01, 0x38, 0xDE, 0xED, 0x83, 0x00, 0x06, 0xAC, 0xA9, 0x9A, 0xC9,
+    0x50, 0x3A, 0xCB, 0x54, 0x45, 0xBC, 0x93, 0x8D, 0xB4, 0x00, 0x00, 0x4B,
+    0xC7, 0xDD, 0x80, 0x00, 0x00, 0x09, 0xDC, 0xEC, 0x80, 0x00, 0x00, 0x08,
+    0xCE, 0xFC, 0x70, 0x00, 0x00, 0x07, 0xCE, 0xFC, 0x70, 0x00, 0x00, 0x07,
+    0xCE, 0xCD, 0x90, 0x00, 0x00, 0x09, 0xDC, 0x9C, 0xA3, 0x00, 0x00, 0x3A,
+    0xD9, 0x5B, 0xC8, 0x32, 0x23, 0x8C, 0xB5, 0x08, 0xDE, 0x86, 0x68, 0xED,
+    0x81, 0x01, 0x38, 0xDE, 0xED, 0x83, 0x10, 0x00, 0x13, 0x45, 0x54, 0x31,
+    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0xDB, 0x88, 0x88, 0x8C, 0xEA,
+    0xFC, 0x83, 0x33, 0x33, 0xAD, 0xAF, 0xB6, 0x00, 0x00, 0x09, 0xDA, 0xFB,
+    0x60, 0x00, 0x00, 0x9D, 0xAF, 0xB6, 0x00, 0x00, 0x09, 0xDA, 0xFB, 0x60,
+    0x00, 0x00, 0x9D, 0xAF, 0xB6, 0x00, 0x00, 0x09, 0xDA, 0xFB, 0x60, 0x00,
+    0x00, 0x9D, 0xAF, 0xB6, 0x00, 0x00, 0x09, 0xDA, 0xFB, 0x60, 0x00, 0x00,
+    0x9D, 0xAF, 0xB6, 0x00, 0x00, 0x09, 0xDA, 0xFB, 0x60, 0x00, 0x00, 0x9D,
+    0xA5, 0x42, 0x00, 0x00, 0x03, 0x43, 0xFA, 0x64, 0xCE, 0xEE, 0xA5, 0x10,
+    0xFC, 0xBA, 0x99, 0x9A, 0xDB, 0x71, 0xFE, 0xCA, 0x54, 0x45, 0xBD, 0xB4,
+    0xFF, 0xA2, 0x00, 0x00, 0x4B, 0xD8, 0xFC, 0x70, 0x00, 0x00, 0x08, 0xDD,
+    0xFC, 0x70, 0x00, 0x00, 0x08, 0xCE, 0xFB, 0x60, 0x00, 0x00, 0x07, 0xCF,
+    0xFB, 0x60, 0x00, 0x00, 0x07, 0xCE, 0xFC, 0x70, 0x00, 0x00, 0x09, 0xDD,
+    0xFE, 0x91, 0x00, 0x00, 0x3A, 0xDA, 0xFE, 0xB6, 0x32, 0x23, 0x7C, 0xC6,
+    0xFE, 0xDE, 0x86, 0x68, 0xEE, 0x91, 0xFB, 0x75, 0xCE, 0xEE, 0xA4, 0x10,
+    0xFB, 0x62, 0x45, 0x55, 0x31, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x00,
+    0xFB, 0x60, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x00,
+    0xFB, 0x60, 0x00, 0x00, 0x00, 0x00, 0xA7, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x4A, 0xEE, 0xED, 0x93, 0x17, 0xBD, 0xA9, 0x9A, 0x93, 0x4B, 0xDB,
+    0x54, 0x45, 0x62, 0x8D, 0xB4, 0x00, 0x00, 0x00, 0xDD, 0x90, 0x00, 0x00,
+    0x00, 0xEC, 0x80, 0x00, 0x00, 0x00, 0xFC, 0x70, 0x00, 0x00, 0x00, 0xFC,
+    0x70, 0x00, 0x00, 0x00, 0xDD, 0x80, 0x00, 0x00, 0x00, 0xAD, 0xA3, 0x00,
+    0x00, 0x00, 0x6C, 0xC7, 0x32, 0x22, 0x41, 0x1A, 0xEE, 0x86, 0x67, 0xB4,
+    0x01, 0x4A, 0xEE, 0xED, 0xA3, 0x00, 0x13, 0x55, 0x54, 0x31, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x88, 0x88, 0x8D, 0xEC, 0x88, 0x88, 0x83,
+    0x33, 0x33, 0x3B, 0xDA, 0x33, 0x33, 0x31, 0x00, 0x00, 0x0A, 0xD9, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A,
+    0xD9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0A, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD9,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x43, 0x00, 0x00, 0x00,
+    0xCC, 0x80, 0x00, 0x00, 0x08, 0xCC, 0x8C, 0xA2, 0x00, 0x00, 0x2A, 0xC8,
+    0x5C, 0xC5, 0x00, 0x00, 0x4B, 0xC5, 0x1A, 0xD8, 0x00, 0x00, 0x8C, 0xA1,
+    0x07, 0xBE, 0x00, 0x00, 0xDB, 0x70, 0x04, 0x9F, 0x31, 0x12, 0xE9, 0x40,
+    0x02, 0x7F, 0x62, 0x25, 0xF7, 0x20, 0x00, 0x5E, 0xA3, 0x38, 0xE5, 0x00,
+    0x00, 0x38, 0xE5, 0x5D, 0x83, 0x00, 0x00, 0x14, 0xF8, 0x8E, 0x52, 0x00,
+    0x00, 0x12, 0xEB, 0xBE, 0x21, 0x00, 0x00, 0x00, 0xCD, 0xDC, 0x00, 0x00,
+    0x00, 0x00, 0x6C, 0xC7, 0x00, 0x00, 0x00, 0x00, 0x6C, 0xB3, 0x00, 0x00,
+    0x00, 0x00, 0x9C, 0x91, 0x00, 0x00, 0x00, 0x00, 0xDB, 0x60, 0x00, 0x00,
+    0x66, 0x7B, 0xE6, 0x10, 0x00, 0x00, 0xBB, 0xCC, 0x73, 0x00, 0x00, 0x00,
+    0x99, 0x98, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0A, 0xD8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD8, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0xD8, 0x00, 0x00, 0x00, 0x01, 0x36, 0x9D, 0xED, 0x86, 0x30, 0x00,
+    0x14, 0x7B, 0xCE, 0xFE, 0xBA, 0x85, 0x00, 0x2A, 0xEE, 0x7C, 0xEB, 0x9D,
+    0xEC, 0x10, 0x9D, 0xB3, 0x0A, 0xD8, 0x03, 0x8F, 0x83, 0xBC, 0x91, 0x0A,
+    0xD8, 0x01, 0x5D, 0xB4, 0xDC, 0x70, 0x0A, 0xD8, 0x00, 0x4B, 0xD4, 0xFB,
+    0x60, 0x0A, 0xD8, 0x00, 0x39, 0xF5, 0xFB, 0x60, 0x0A, 0xD8, 0x00, 0x39,
+    0xF5, 0xDC, 0x70, 0x0A, 0xD8, 0x00, 0x4B, 0xD4, 0xBC, 0x91, 0x0A, 0xD8,
+    0x01, 0x5D, 0xB4, 0x9D, 0xB3, 0x0A, 0xD8, 0x03, 0x8F, 0x83, 0x19, 0xEE,
+    0x7C, 0xEB, 0x9D, 0xED, 0x10, 0x04, 0x7B, 0xCE, 0xFE, 0xBB, 0x85, 0x00,
+    0x01, 0x36, 0x9D, 0xED, 0x86, 0x41, 0x00, 0x00, 0x00, 0x0A, 0xD8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0A, 0xD8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A,
+    0xD8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0A, 0xD8, 0x00, 0x00, 0x00, 0x7C, 0xC5, 0x00, 0x00, 0x4B, 0xC7,
+    0x29, 0xCB, 0x10, 0x00, 0xAC, 0x93, 0x05, 0xAE, 0x31, 0x13, 0xEA, 0x60,
+    0x01, 0x6E, 0x93, 0x38, 0xE6, 0x10, 0x00, 0x25, 0xF9, 0x9F, 0x62, 0x00,
+    0x00, 0x12, 0xCC, 0xCC, 0x21, 0x00, 0x00, 0x00, 0xBD, 0xEB, 0x00, 0x00,
+    0x00, 0x00, 0xCE, 0xEC, 0x00, 0x00, 0x00, 0x38, 0xE7, 0x7E, 0x83, 0x00,
+    0x02, 0x6D, 0x94, 0x49, 0xD6, 0x20, 0x05, 0x9E, 0x41, 0x14, 0xE9, 0x50,
+    0x19, 0xDC, 0x00, 0x00, 0xBD, 0x91, 0xAD, 0xB2, 0x00, 0x00, 0x2B, 0xDA,
+    0x34, 0x41, 0x00, 0x00, 0x14, 0x43, 0xFB, 0x60, 0x00, 0x00, 0x9D, 0xA0,
+    0xFB, 0x60, 0x00, 0x00, 0x9D, 0xA0, 0xFB, 0x60, 0x00, 0x00, 0x9D, 0xA0,
+    0xFB, 0x60, 0x00, 0x00, 0x9D, 0xA0, 0xFB, 0x60, 0x00, 0x00, 0x9D, 0xA0,
+    0xFB, 0x60, 0x00, 0x00, 0x9D, 0xA0, 0xFB, 0x60, 0x00, 0x00, 0x9D, 0xA0,
+    0xFB, 0x60, 0x00, 0x00, 0x9D, 0xA0, 0xFB, 0x60, 0x00, 0x00, 0x9D, 0xA0,
+    0xFB, 0x60, 0x00, 0x00, 0x9D, 0xA0, 0xFB, 0x72, 0x22, 0x22, 0xAD, 0xB2,
+    0xFC, 0x95, 0x55, 0x55, 0xBE, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x55, 0x55, 0x55, 0x55, 0x59, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF,
+    0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x45, 0xFB, 0x60, 0x00, 0x00, 0x9D, 0xAF,
+    0xB6, 0x00, 0x00, 0x09, 0xDA, 0xFB, 0x60, 0x00, 0x00, 0x9D, 0xAF, 0xB6,
+    0x00, 0x00, 0x09, 0xDA, 0xFB, 0x60, 0x00, 0x00, 0x9D, 0xAE, 0xB7, 0x00,
+    0x00, 0x0A, 0xDA, 0xCC, 0x93, 0x22, 0x34, 0xCE, 0xA9, 0xDD, 0x85, 0x79,
+    0xDF, 0xFA, 0x16, 0xBE, 0xED, 0xA6, 0x9D, 0xA0, 0x24, 0x55, 0x43, 0x29,
+    0xDA, 0x00, 0x00, 0x00, 0x00, 0x9D, 0xA0, 0x00, 0x00, 0x00, 0x09, 0xDA,
+    0x00, 0x00, 0x00, 0x00, 0x9D, 0xA0, 0x00, 0x00, 0x00, 0x03, 0x43, 0xFB,
+    0x60, 0x0A, 0xD8, 0x00, 0x38, 0xF5, 0xFB, 0x60, 0x0A, 0xD8, 0x00, 0x38,
+    0xF5, 0xFB, 0x60, 0x0A, 0xD8, 0x00, 0x38, 0xF5, 0xFB, 0x60, 0x0A, 0xD8,
+    0x00, 0x38, 0xF5, 0xFB, 0x60, 0x0A, 0xD8, 0x00, 0x38, 0xF5, 0xFB, 0x60,
+    0x0A, 0xD8, 0x00, 0x38, 0xF5, 0xFB, 0x60, 0x0A, 0xD8, 0x00, 0x38, 0xF5,
+    0xFB, 0x60, 0x0A, 0xD8, 0x00, 0x38, 0xF5, 0xFB, 0x60, 0x0A, 0xD8, 0x00,
+    0x38, 0xF5, 0xFB, 0x60, 0x0A, 0xD8, 0x00, 0x38, 0xF5, 0xFB, 0x72, 0x2B,
+    0xD9, 0x22, 0x49, 0xF5, 0xFC, 0x95, 0x5C, 0xEB, 0x55, 0x7B, 0xF5, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x52, 0xFB, 0x60, 0x0A, 0xD8, 0x00, 0x38, 0xF5, 0x0F, 0xB6, 0x00, 0xAD,
+    0x80, 0x03, 0x8F, 0x50, 0xFB, 0x60, 0x0A, 0xD8, 0x00, 0x38, 0xF5, 0x0F,
+    0xB6, 0x00, 0xAD, 0x80, 0x03, 0x8F, 0x50, 0xFB, 0x60, 0x0A, 0xD8, 0x00,
+    0x38, 0xF5, 0x0F, 0xB6, 0x00, 0xAD, 0x80, 0x03, 0x8F, 0x50, 0xFB, 0x60,
+    0x0A, 0xD8, 0x00, 0x38, 0xF5, 0x0F, 0xB6, 0x00, 0xAD, 0x80, 0x03, 0x8F,
+    0x50, 0xFB, 0x60, 0x0A, 0xD8, 0x00, 0x38, 0xF5, 0x0F, 0xB6, 0x00, 0xAD,
+    0x80, 0x03, 0x8F, 0x50, 0xFB, 0x72, 0x2B, 0xD9, 0x22, 0x49, 0xF6, 0x1F,
+    0xC9, 0x55, 0xCE, 0xB5, 0x57, 0xBF, 0x83, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xA5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5B, 0xEA, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x8D, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+    0xDA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8D, 0xA0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x43, 0xFF, 0xFF, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x88,
+    0x88, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x33, 0x33, 0xFB, 0x60, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xCA, 0xA9, 0x75, 0x00, 0x00, 0x00,
+    0xFE, 0xDC, 0xBB, 0xBA, 0x31, 0x00, 0x00, 0xFC, 0x95, 0x68, 0xBF, 0x93,
+    0x00, 0x00, 0xFB, 0x60, 0x00, 0x3A, 0xE5, 0x00, 0x00, 0xFB, 0x60, 0x00,
+    0x3A, 0xE5, 0x00, 0x00, 0xFB, 0x72, 0x23, 0x6C, 0xC4, 0x00, 0x00, 0xFC,
+    0x95, 0x68, 0xBF, 0x83, 0x00, 0x00, 0xFF, 0xFF, 0xED, 0xB7, 0x00, 0x00,
+    0x00, 0x55, 0x55, 0x54, 0x42, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF,
+    0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF,
+    0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF, 0xFB, 0x60, 0x00, 0x00, 0x06, 0xBF,
+    0xFE, 0xCA, 0x97, 0x41, 0x06, 0xBF, 0xFE, 0xDC, 0xBB, 0x94, 0x06, 0xBF,
+    0xFC, 0x95, 0x8C, 0xDA, 0x06, 0xBF, 0xFB, 0x60, 0x07, 0xBE, 0x06, 0xBF,
+    0xFB, 0x60, 0x07, 0xBE, 0x06, 0xBF, 0xFB, 0x72, 0x39, 0xCC, 0x06, 0xBF,
+    0xFC, 0x95, 0x8C, 0xD9, 0x06, 0xBF, 0xFF, 0xFF, 0xDA, 0x61, 0x06, 0xBF,
+    0x55, 0x55, 0x43, 0x20, 0x02, 0x45, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x00,
+    0xFB, 0x60, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x00,
+    0xFB, 0x60, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x00,
+    0xFE, 0xCA, 0xAA, 0xA9, 0x86, 0x30, 0xFE, 0xDC, 0xCC, 0xCC, 0xBA, 0x73,
+    0xFC, 0x95, 0x55, 0x56, 0xAD, 0xD9, 0xFB, 0x60, 0x00, 0x00, 0x07, 0xCE,
+    0xFB, 0x60, 0x00, 0x00, 0x07, 0xCE, 0xFB, 0x72, 0x22, 0x22, 0x39, 0xCC,
+    0xFC, 0x95, 0x55, 0x56, 0xAD, 0xD8, 0xFF, 0xFF, 0xFF, 0xFE, 0xC9, 0x50,
+    0x55, 0x55, 0x55, 0x55, 0x43, 0x20, 0x9C, 0xEF, 0xEB, 0x72, 0x00, 0x99,
+    0x99, 0xAC, 0xCA, 0x10, 0x65, 0x54, 0x58, 0xBE, 0x41, 0x00, 0x00, 0x02,
+    0x7F, 0x93, 0x00, 0x00, 0x00, 0x4C, 0xD4, 0x07, 0xAA, 0xAA, 0xBE, 0xE5,
+    0x08, 0xCC, 0xCC, 0xCE, 0xF5, 0x03, 0x55, 0x55, 0x7C, 0xF5, 0x00, 0x00,
+    0x00, 0x4D, 0xD4, 0x00, 0x00, 0x02, 0x7E, 0xA3, 0x43, 0x22, 0x36, 0xAE,
+    0x62, 0xB8, 0x65, 0x8C, 0xED, 0x10, 0xAC, 0xEF, 0xEB, 0x72, 0x00, 0x34,
+    0x55, 0x54, 0x21, 0x00, 0xFB, 0x60, 0x05, 0x9D, 0xE9, 0x50, 0xFB, 0x60,
+    0x49, 0xCA, 0xAC, 0x93, 0xFB, 0x60, 0x7C, 0xB6, 0x6B, 0xC6, 0xFB, 0x60,
+    0xBC, 0x80, 0x08, 0xCA, 0xFB, 0x60, 0xEB, 0x60, 0x06, 0xBD, 0xFE, 0xCA,
+    0xFB, 0x60, 0x06, 0xBE, 0xFE, 0xDC, 0xFB, 0x60, 0x06, 0xBF, 0xFC, 0x95,
+    0xFB, 0x60, 0x06, 0xBF, 0xFB, 0x60, 0xDB, 0x60, 0x06, 0xBE, 0xFB, 0x60,
+    0xBB, 0x80, 0x08, 0xCC, 0xFB, 0x60, 0x9C, 0xA3, 0x3A, 0xC9, 0xFB, 0x60,
+    0x5C, 0xD8, 0x8D, 0xC5, 0xFB, 0x60, 0x05, 0xAE, 0xEA, 0x50, 0x54, 0x20,
+    0x02, 0x35, 0x53, 0x20, 0x00, 0x37, 0xDE, 0xFF, 0xFF, 0xFF, 0x04, 0x8C,
+    0xA9, 0x88, 0x8B, 0xDF, 0x07, 0xBE, 0x64, 0x33, 0x38, 0xCF, 0x09, 0xDB,
+    0x00, 0x00, 0x06, 0xBF, 0x09, 0xDA, 0x00, 0x00, 0x06, 0xBF, 0x08, 0xCD,
+    0x31, 0x00, 0x06, 0xBF, 0x05, 0x9D, 0x86, 0x55, 0x59, 0xCF, 0x01, 0x4A,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xEB, 0x85, 0x59, 0xCF, 0x00, 0x27,
+    0xE7, 0x32, 0x27, 0xBF, 0x01, 0x5B, 0xB4, 0x10, 0x06, 0xBF, 0x03, 0x8F,
+    0x62, 0x00, 0x06, 0xBF, 0x19, 0xDC, 0x00, 0x00, 0x06, 0xBF, 0x03, 0x44,
+    0x00, 0x00, 0x02, 0x45, 0x00, 0x00, 0xCE, 0xA2, 0x00, 0x00, 0x00, 0x00,
+    0x6C, 0xC5, 0x00, 0x00, 0x00, 0x00, 0x29, 0xB9, 0x00, 0x00, 0x00, 0x00,
+    0x05, 0x9D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25,
+    0x99, 0xA9, 0x63, 0x10, 0x03, 0x6A, 0xBB, 0xCB, 0xB8, 0x41, 0x08, 0xCE,
+    0x86, 0x67, 0xDE, 0xA2, 0x7C, 0xB3, 0x00, 0x00, 0x1A, 0xDA, 0xAC, 0x91,
+    0x00, 0x00, 0x08, 0xCC, 0xDD, 0xA5, 0x55, 0x55, 0x5A, 0xDE, 0xEF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xA5, 0x55, 0x55, 0x55, 0x55, 0xDD, 0x92,
+    0x22, 0x22, 0x22, 0x22, 0xBD, 0xA2, 0x00, 0x00, 0x00, 0x00, 0x7C, 0xC5,
+    0x00, 0x00, 0x00, 0x00, 0x07, 0xCF, 0x97, 0x66, 0x7A, 0xA7, 0x03, 0x69,
+    0xBB, 0xCC, 0xBA, 0x84, 0x00, 0x24, 0x89, 0xAA, 0x97, 0x52, 0x00, 0x4C,
+    0x62, 0x26, 0xC4, 0x00, 0x00, 0x4C, 0x62, 0x26, 0xC4, 0x00, 0x00, 0x38,
+    0x41, 0x14, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38,
+    0xDE, 0xEE, 0xA5, 0x10, 0x05, 0x9C, 0xA9, 0x99, 0xCB, 0x71, 0x39, 0xCB,
+    0x54, 0x45, 0x9C, 0xB5, 0x7C, 0xB3, 0x00, 0x00, 0x1A, 0xDA, 0xCC, 0x80,
+    0x00, 0x00, 0x07, 0xCE, 0xEE, 0xDA, 0xAA, 0xAA, 0xAC, 0xEF, 0xEE, 0xDC,
+    0xCC, 0xCC, 0xCC, 0xCC, 0xFD, 0xA5, 0x55, 0x55, 0x55, 0x55, 0xCD, 0x90,
+    0x00, 0x00, 0x00, 0x00, 0x9C, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x5B, 0xC8,
+    0x32, 0x22, 0x23, 0x32, 0x07, 0xCF, 0x97, 0x66, 0x7A, 0xA7, 0x00, 0x27,
+    0xCE, 0xEE, 0xDB, 0x73, 0x00, 0x12, 0x45, 0x55, 0x44, 0x21, 0x00, 0x5F,
+    0x93, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x93, 0x00, 0x00, 0x00, 0x00,
+    0x24, 0x8F, 0xB7, 0x55, 0x52, 0x00, 0x00, 0x6C, 0xFF, 0xFF, 0xFF, 0xE5,
+    0x00, 0x00, 0x12, 0x7F, 0xA5, 0x22, 0x21, 0x00, 0x00, 0x01, 0x6F, 0x96,
+    0x69, 0xA9, 0x75, 0x00, 0x00, 0x5F, 0xA9, 0x9B, 0xCC, 0xBA, 0x31, 0x00,
+    0x5F, 0xDD, 0xB7, 0x69, 0xCF, 0x72, 0x00, 0x5F, 0xF6, 0x10, 0x00, 0x4D,
+    0xD4, 0x00, 0x5F, 0xC4, 0x00, 0x00, 0x3A, 0xE5, 0x00, 0x5F, 0xB4, 0x00,
+    0x00, 0x39, 0xF5, 0x00, 0x5F, 0x93, 0x00, 0x00, 0x39, 0xF5, 0x00, 0x5F,
+    0x93, 0x00, 0x00, 0x39, 0xF5, 0x00, 0x5F, 0x93, 0x00, 0x00, 0x39, 0xF5,
+    0x00, 0x5F, 0x93, 0x00, 0x00, 0x39, 0xF5, 0x00, 0x5F, 0x93, 0x00, 0x00,
+    0x39, 0xF5, 0x00, 0x5F, 0x93, 0x00, 0x00, 0x39, 0xF5, 0x00, 0x5F, 0x93,
+    0x00, 0x00, 0x39, 0xF5, 0x00, 0x3A, 0x62, 0x00, 0x00, 0x39, 0xF5, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x39, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39,
+    0xE5, 0x00, 0x00, 0x00, 0x00, 0x11, 0x4C, 0xC4, 0x00, 0x00, 0x00, 0x00,
+    0x66, 0x8C, 0x83, 0x00, 0x00, 0x00, 0x00, 0xEE, 0xDB, 0x21, 0x00, 0x12,
+    0xFD, 0x80, 0x00, 0x25, 0xF9, 0x40, 0x00, 0x39, 0xC6, 0x20, 0x00, 0x4D,
+    0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0xAA, 0xAA, 0xFE, 0xDC,
+    0xCC, 0xCC, 0xFC, 0x95, 0x55, 0x55, 0xFB, 0x60, 0x00, 0x00, 0xFB, 0x60,
+    0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0xFB, 0x60,
+    0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0xFB, 0x60,
+    0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0xA7, 0x40,
+    0x00, 0x00, 0x01, 0x49, 0xDE, 0xEE, 0xA4, 0x01, 0x7A, 0xCA, 0x99, 0x9A,
+    0x40, 0x4A, 0xDA, 0x54, 0x45, 0x72, 0x08, 0xDB, 0x30, 0x00, 0x00, 0x00,
+    0xDC, 0x80, 0x00, 0x00, 0x00, 0x0E, 0xED, 0xAA, 0xAA, 0xA0, 0x00, 0xFE,
+    0xDC, 0xCC, 0xCC, 0x00, 0x0F, 0xDA, 0x55, 0x55, 0x50, 0x00, 0xDD, 0x90,
+    0x00, 0x00, 0x00, 0x0A, 0xDA, 0x30, 0x00, 0x00, 0x00, 0x6C, 0xC8, 0x32,
+    0x22, 0x41, 0x01, 0x9E, 0xE8, 0x66, 0x7B, 0x40, 0x01, 0x49, 0xEE, 0xED,
+    0xA3, 0x00, 0x01, 0x35, 0x55, 0x43, 0x10, 0x16, 0xAD, 0xFE, 0xDC, 0x72,
+    0x7A, 0xB9, 0x89, 0x9B, 0x83, 0xCC, 0xA5, 0x44, 0x57, 0x62, 0xEB, 0x60,
+    0x00, 0x00, 0x00, 0xCD, 0xB6, 0x00, 0x00, 0x00, 0x5A, 0xCC, 0x97, 0x41,
+    0x00, 0x16, 0x9B, 0xCB, 0x96, 0x10, 0x00, 0x14, 0xAD, 0xFE, 0x41, 0x00,
+    0x00, 0x01, 0x5D, 0xD4, 0x00, 0x00, 0x00, 0x4B, 0xE5, 0x43, 0x32, 0x22,
+    0x6B, 0xC4, 0xDA, 0x86, 0x57, 0xAF, 0x93, 0x9C, 0xEF, 0xED, 0xB7, 0x00,
+    0x34, 0x55, 0x54, 0x42, 0x00, 0x00, 0x00, 0x09, 0xB8, 0x00, 0x00, 0x00,
+    0x00, 0x09, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x06, 0x75, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+    0x6A, 0xAA, 0x96, 0x00, 0x00, 0x02, 0x6B, 0xBE, 0xD9, 0x00, 0x00, 0x00,
+    0x12, 0x3B, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00, 0x00,
+    0x00, 0x0A, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00, 0x00,
+    0x00, 0x0A, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00, 0x00,
+    0x00, 0x0A, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00, 0x00,
+    0x00, 0x0A, 0xD9, 0x00, 0x00, 0x01, 0x22, 0x3B, 0xDA, 0x32, 0x21, 0x07,
+    0xBB, 0xBE, 0xED, 0xBB, 0xA7, 0x07, 0xAA, 0xAA, 0xAA, 0xAA, 0x97, 0x00,
+    0x4C, 0x62, 0x26, 0xC4, 0x00, 0x00, 0x4C, 0x62, 0x26, 0xC4, 0x00, 0x00,
+    0x38, 0x41, 0x14, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+    0x9F, 0xFF, 0xD9, 0x00, 0x00, 0x01, 0x36, 0x7C, 0xD9, 0x00, 0x00, 0x00,
+    0x11, 0x2B, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00, 0x00,
+    0x00, 0x0A, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00, 0x00,
+    0x00, 0x0A, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00, 0x00,
+    0x00, 0x0A, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD9, 0x00, 0x00, 0x00,
+    0x11, 0x1A, 0xD9, 0x11, 0x10, 0x01, 0x22, 0x3B, 0xDA, 0x32, 0x21, 0x0A,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xDA, 0x03, 0x55, 0x55, 0x55, 0x55, 0x43, 0x00,
+    0x00, 0x07, 0xAB, 0x00, 0x00, 0x07, 0xAB, 0x00, 0x00, 0x04, 0x77, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xAA, 0xAA, 0xAA, 0x07,
+    0xBB, 0xBD, 0xEF, 0x01, 0x22, 0x38, 0xCF, 0x00, 0x00, 0x06, 0xBF, 0x00,
+    0x00, 0x06, 0xBF, 0x00, 0x00, 0x06, 0xBF, 0x00, 0x00, 0x06, 0xBF, 0x00,
+    0x00, 0x06, 0xBF, 0x00, 0x00, 0x06, 0xBF, 0x00, 0x00, 0x06, 0xBF, 0x00,
+    0x00, 0x06, 0xBF, 0x00, 0x00, 0x06, 0xBF, 0x00, 0x00, 0x06, 0xBF, 0x00,
+    0x00, 0x06, 0xBF, 0x00, 0x00, 0x06, 0xBF, 0x00, 0x00, 0x08, 0xCD, 0x64,
+    0x44, 0x6B, 0xC9, 0xA9, 0x98, 0xBC, 0xA5, 0xCD, 0xEF, 0xD9, 0x50, 0x00,
+    0x5F, 0xFF, 0xFF, 0x93, 0x00, 0x00, 0x00, 0x05, 0xFA, 0x9B, 0xF9, 0x30,
+    0x00, 0x00, 0x00, 0x5F, 0x64, 0x7F, 0x93, 0x00, 0x00, 0x00, 0x05, 0xF4,
+    0x15, 0xF9, 0x30, 0x00, 0x00, 0x00, 0x5F, 0x31, 0x5F, 0x93, 0x00, 0x00,
+    0x00, 0x05, 0xF3, 0x15, 0xFD, 0xB9, 0x85, 0x20, 0x01, 0x6F, 0x21, 0x5F,
+    0xEC, 0xBB, 0xA6, 0x20, 0x16, 0xF2, 0x15, 0xFB, 0x77, 0x9F, 0xB6, 0x02,
+    0x7F, 0x00, 0x5F, 0x93, 0x00, 0xAD, 0x90, 0x38, 0xD0, 0x05, 0xF9, 0x30,
+    0x0A, 0xC9, 0x16, 0x9B, 0x00, 0x5F, 0xA4, 0x23, 0xCC, 0x83, 0x9B, 0x90,
+    0x05, 0xFB, 0x77, 0x9F, 0xA5, 0xFD, 0x92, 0x00, 0x5F, 0xFE, 0xEC, 0x72,
+    0x05, 0x43, 0x10, 0x02, 0x55, 0x55, 0x42, 0x10, 0xFB, 0x60, 0x0A, 0xD8,
+    0x00, 0x00, 0x00, 0xFB, 0x60, 0x0A, 0xD8, 0x00, 0x00, 0x00, 0xFB, 0x60,
+    0x0A, 0xD8, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x0A, 0xD8, 0x00, 0x00, 0x00,
+    0xFB, 0x60, 0x0A, 0xD9, 0x00, 0x00, 0x00, 0xFE, 0xCA, 0xAD, 0xED, 0xA9,
+    0x85, 0x00, 0xFE, 0xDC, 0xCE, 0xED, 0xBB, 0xBA, 0x31, 0xFC, 0x95, 0x5C,
+    0xDA, 0x57, 0xAF, 0x93, 0xFB, 0x60, 0x0A, 0xD8, 0x00, 0x3A, 0xE5, 0xFB,
+    0x60, 0x0A, 0xD8, 0x00, 0x3A, 0xD4, 0xFB, 0x60, 0x0A, 0xD9, 0x23, 0x6C,
+    0xC4, 0xFB, 0x60, 0x0A, 0xEB, 0x68, 0xBF, 0x83, 0xFB, 0x60, 0x0A, 0xFF,
+    0xED, 0xB7, 0x00, 0x54, 0x20, 0x03, 0x55, 0x54, 0x42, 0x00, 0x00, 0x5F,
+    0x93, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x93, 0x00, 0x00, 0x00, 0x00,
+    0x24, 0x8F, 0xB7, 0x55, 0x53, 0x10, 0x00, 0x6C, 0xFF, 0xFF, 0xFF, 0xF8,
+    0x30, 0x00, 0x12, 0x7F, 0xA5, 0x22, 0x21, 0x00, 0x00, 0x01, 0x6F, 0x96,
+    0x69, 0xB9, 0x85, 0x00, 0x00, 0x5F, 0xA9, 0x9B, 0xCC, 0xCA, 0x31, 0x00,
+    0x5F, 0xDD, 0xB7, 0x69, 0xCF, 0x83, 0x00, 0x5F, 0xF6, 0x10, 0x00, 0x4D,
+    0xD4, 0x00, 0x5F, 0xC4, 0x00, 0x00, 0x4B, 0xE5, 0x00, 0x5F, 0xB4, 0x00,
+    0x00, 0x39, 0xF5, 0x00, 0x5F, 0x93, 0x00, 0x00, 0x39, 0xF5, 0x00, 0x5F,
+    0x93, 0x00, 0x00, 0x39, 0xF5, 0x00, 0x5F, 0x93, 0x00, 0x00, 0x39, 0xF5,
+    0x00, 0x5F, 0x93, 0x00, 0x00, 0x39, 0xF5, 0x00, 0x5F, 0x93, 0x00, 0x00,
+    0x39, 0xF5, 0x00, 0x5F, 0x93, 0x00, 0x00, 0x39, 0xF5, 0x00, 0x5F, 0x93,
+    0x00, 0x00, 0x39, 0xF5, 0x00, 0x3A, 0x62, 0x00, 0x00, 0x26, 0xA3, 0x00,
+    0x00, 0x2A, 0xEC, 0x00, 0x00, 0x00, 0x00, 0x5C, 0xC6, 0x00, 0x00, 0x00,
+    0x00, 0x9B, 0x92, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x50, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xA7, 0x40, 0x00, 0x13, 0xA7, 0x30, 0xFB,
+    0x60, 0x01, 0x48, 0xC7, 0x30, 0xFB, 0x60, 0x03, 0x7F, 0x72, 0x00, 0xFB,
+    0x60, 0x3A, 0xC7, 0x00, 0x00, 0xFA, 0x61, 0xAA, 0x72, 0x00, 0x00, 0xFA,
+    0x75, 0xC7, 0x30, 0x00, 0x00, 0xFA, 0x9C, 0x93, 0x00, 0x00, 0x00, 0xFE,
+    0xEE, 0xE6, 0x20, 0x00, 0x00, 0xFD, 0xA5, 0xAA, 0x72, 0x00, 0x00, 0xFC,
+    0x70, 0x6A, 0xA6, 0x10, 0x00, 0xFB, 0x60, 0x07, 0xBD, 0x21, 0x00, 0xFB,
+    0x60, 0x00, 0x4B, 0xD6, 0x10, 0xFB, 0x60, 0x00, 0x14, 0xCA, 0x71, 0xA7,
+    0x40, 0x00, 0x00, 0x89, 0x61, 0x00, 0x4C, 0xF6, 0x10, 0x00, 0x00, 0x02,
+    0x6F, 0x83, 0x00, 0x00, 0x00, 0x12, 0xCA, 0x60, 0x00, 0x00, 0x00, 0x07,
+    0xB9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x74, 0x00, 0x01,
+    0x2A, 0xA7, 0xFB, 0x60, 0x00, 0x25, 0xFF, 0xAF, 0xB6, 0x00, 0x03, 0xAE,
+    0xFA, 0xFB, 0x60, 0x03, 0x7E, 0x9D, 0xAF, 0xB6, 0x00, 0x69, 0x98, 0xDA,
+    0xFB, 0x60, 0x29, 0xA5, 0x8D, 0xAF, 0xB6, 0x06, 0xB9, 0x08, 0xDA, 0xFB,
+    0x61, 0xD8, 0x30, 0x8D, 0xAF, 0xA7, 0x5C, 0x51, 0x08, 0xDA, 0xFB, 0x9A,
+    0x93, 0x00, 0x8D, 0xAF, 0xBB, 0xE3, 0x10, 0x08, 0xDA, 0xFF, 0xDA, 0x00,
+    0x00, 0x8D, 0xAF, 0xFB, 0x50, 0x00, 0x08, 0xDA, 0xAA, 0x71, 0x00, 0x00,
+    0x69, 0x70, 0x09, 0xC9, 0x00, 0x00, 0xAC, 0x90, 0x07, 0xBC, 0x32, 0x34,
+    0xDB, 0x70, 0x04, 0x9D, 0x87, 0x78, 0xC8, 0x40, 0x01, 0x49, 0xDE, 0xED,
+    0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x60, 0x00, 0x00,
+    0x06, 0x88, 0xAC, 0x91, 0x00, 0x00, 0x19, 0xCA, 0x7C, 0xB3, 0x00, 0x00,
+    0x3B, 0xC7, 0x1A, 0xD8, 0x00, 0x00, 0x8C, 0xA1, 0x08, 0xCC, 0x00, 0x00,
+    0xBC, 0x80, 0x06, 0xAE, 0x10, 0x01, 0xEA, 0x60, 0x03, 0x8F, 0x41, 0x13,
+    0xF8, 0x30, 0x00, 0x5E, 0xA3, 0x38, 0xE5, 0x00, 0x00, 0x3A, 0xD4, 0x4C,
+    0xA3, 0x00, 0x00, 0x26, 0xE7, 0x6E, 0x72, 0x00, 0x00, 0x12, 0xFA, 0xAF,
+    0x31, 0x00, 0x00, 0x00, 0xCD, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xD8,
+    0x00, 0x00, 0x00, 0x00, 0x6C, 0xC5, 0x00, 0x00, 0x00, 0x00, 0x6C, 0xA1,
+    0x00, 0x00, 0x00, 0x00, 0xDB, 0x60, 0x00, 0x00, 0x44, 0x58, 0xE8, 0x30,
+    0x00, 0x00, 0x88, 0xAB, 0xB5, 0x10, 0x00, 0x00, 0xEE, 0xEC, 0x41, 0x00,
+    0x00, 0x00, 0xFB, 0x60, 0x00, 0x00, 0x9D, 0xAF, 0xB6, 0x00, 0x00, 0x09,
+    0xDA, 0xFB, 0x60, 0x00, 0x00, 0x9D, 0xAF, 0xB6, 0x00, 0x00, 0x09, 0xDA,
+    0xFB, 0x60, 0x00, 0x00, 0x9D, 0xAF, 0xB6, 0x00, 0x00, 0x09, 0xDA, 0xFB,
+    0x60, 0x00, 0x00, 0x9D, 0xAF, 0xB6, 0x00, 0x00, 0x09, 0xDA, 0xFB, 0x60,
+    0x00, 0x00, 0x9D, 0xAF, 0xB6, 0x00, 0x00, 0x09, 0xDA, 0xFB, 0x72, 0x22,
+    0x22, 0xAD, 0xAF, 0xC9, 0x55, 0x55, 0x5B, 0xEA, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xA5, 0x55, 0x5F, 0xC9, 0x55, 0x53, 0x00, 0x00, 0xFB, 0x60, 0x00,
+    0x00, 0x00, 0x0F, 0xB6, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x60, 0x00, 0x00,
+    0x00, 0x05, 0x42, 0x00, 0x00,
+};
+
+constexpr BitmapFont NotoMono24 = {NotoMono24Glyphs, 491, NotoMono24Bitmaps,
+                                25, 19, 6};
+}  // namespace fonts
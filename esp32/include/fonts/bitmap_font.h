@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstdint>
+
+namespace fonts {
+/**
+ * Metrics of a glyph, relative to the cursor placed at the top left corner of
+ * the line
+ */
+struct Glyph {
+    // byte offset of the bitmap in BitmapFont::m_bitmaps
+    uint32_t m_offset;
+    uint16_t m_codepoint;
+    uint8_t m_width;
+    uint8_t m_height;
+    // horizontal distance from the cursor to the next one
+    uint8_t m_xAdvance;
+    // horizontal distance from the cursor to the left edge of the bitmap
+    int8_t m_dX;
+    // vertical distance from the baseline to the top edge of the bitmap
+    int8_t m_dY;
+};
+
+/**
+ * Bitmap font generated at build time by fonts/font_pipeline.py. Both the
+ * glyphs and their bitmaps are read in place from flash.
+ */
+struct BitmapFont {
+    // sorted by codepoint
+    Glyph const* m_glyphs;
+    uint16_t m_numGlyphs;
+    // 4 bits of alpha per pixel, two pixels per byte with the leftmost in the
+    // high nibble; every glyph starts on a new byte and its rows are packed
+    uint8_t const* m_bitmaps;
+    // height of a line
+    uint8_t m_yAdvance;
+    // distance from the top of the line to the baseline
+    uint8_t m_ascent;
+    // width of the box drawn in place of a missing glyph
+    uint8_t m_spaceWidth;
+};
+}  // namespace fonts
@@ -0,0 +1,169 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+enum class Gesture : uint8_t {
+    TAP,
+    // a second tap on the same pad within GestureTimings::m_doubleTapWindow
+    DOUBLE_TAP,
+    LONG_PRESS,
+    // while the long press is held, every GestureTimings::m_repeatInterval
+    REPEAT,
+    // across the pads, from the first to the last
+    SWIPE_CLOCKWISE,
+    // from the last pad to the first
+    SWIPE_ANTI_CLOCKWISE,
+};
+
+/**
+ * Timings of the gestures, in milliseconds: 0 disables the gesture
+ */
+struct GestureTimings {
+    // touch held for a long press of a pad in the middle: the press of the
+    // middle pad, 100 ms as before the recognizer
+    uint32_t m_longPress{100};
+    // of a pad at an end, where a swipe starts: longer than m_swipeStep, not
+    // to take a slide for a long press of the pad it started on
+    uint32_t m_endLongPress{300};
+    // a tap waits this long for a second one: taps are reported late by as
+    // much, thus double taps are disabled unless wanted
+    uint32_t m_doubleTapWindow{0};
+    // from the long press to the first repeat, and between two repeats
+    uint32_t m_repeatDelay{400};
+    uint32_t m_repeatInterval{150};
+    // the most a swipe takes from a pad to the next one
+    uint32_t m_swipeStep{150};
+};
+
+struct GestureEvent {
+    Gesture m_gesture;
+    // the pad touched, the first one of a swipe
+    uint8_t m_pad;
+    // microseconds of the sample or of the deadline completing the gesture
+    int64_t m_time;
+};
+
+/**
+ * Recognizes the gestures on a row of touch pads from samples of the pads
+ * touched, without waiting: a gesture which completes by time alone (e.g. a
+ * long press) is reported by the first update() at or after getDeadline().
+ *
+ * The recognizer is a table of transitions between states, driven by the
+ * changes of the pads and by the deadlines. It reads no clock, thus a trace
+ * of samples is recognized the same on the device and on the host.
+ */
+class GestureRecognizer {
+public:
+    inline static constexpr int64_t noDeadline = -1;
+
+    /**
+     * @param numPads in a row, at most 8: a swipe goes from one end to the
+     * other
+     * @param onGesture called by update() for each gesture recognized
+     */
+    GestureRecognizer(size_t numPads,
+                      GestureTimings const& timings,
+                      std::function<void(GestureEvent const&)> onGesture);
+
+    /**
+     * Feeds the pads touched at @p{now}, after reporting the gestures whose
+     * deadline passed before
+     * @param pads bit i set if pad i is touched
+     * @param now microseconds, not decreasing from a call to the next
+     */
+    void update(uint8_t pads, int64_t now);
+
+    /**
+     * Returns the time update() has to be called at, even if the pads do not
+     * change, noDeadline if none
+     */
+    int64_t getDeadline() const { return m_deadline; }
+
+    /**
+     * Returns the pads touched at the last update()
+     */
+    uint8_t getPads() const { return m_pads; }
+
+private:
+    enum class State : uint8_t {
+        IDLE,
+        // a pad touched, neither released nor long pressed yet
+        DOWN,
+        // moving across the pads from an end
+        SLIDING,
+        // long pressed, repeating
+        HELD,
+        // a tap released, waiting for a second one
+        RELEASED,
+        SECOND_DOWN,
+        // the gesture reported, waiting for the pads to be released
+        DONE,
+    };
+
+    enum class Input : uint8_t {
+        // pads touched after none
+        PRESS,
+        // the pad tapped before touched again
+        PRESS_AGAIN,
+        RELEASE,
+        // the pad next to the last one towards the other end touched
+        SLIDE,
+        // the other end reached
+        ARRIVE,
+        TIMEOUT,
+    };
+
+    enum class Action : uint8_t {
+        NONE,
+        // a touch starts, the long press awaited
+        START,
+        // the tap released, a second one awaited
+        AWAIT_SECOND,
+        // the tap before reported, and a touch of another pad starts
+        TAP_AND_START,
+        TAP,
+        DOUBLE_TAP,
+        LONG_PRESS,
+        REPEAT,
+        STEP,
+        SWIPE,
+    };
+
+    struct Transition {
+        State m_from;
+        Input m_input;
+        State m_to;
+        Action m_action;
+    };
+
+    // the input following a change of the pads touched, if any
+    bool classify(uint8_t previous, uint8_t pads, Input& input);
+    void apply(Input input, int64_t time);
+    void perform(Action action, int64_t time);
+    void emit(Gesture gesture, int64_t time);
+    // sets the deadline @p{ms} milliseconds after @p{time}, none if 0
+    void setDeadline(int64_t time, uint32_t ms);
+    // times out the deadlines passed at @p{now}
+    void expire(int64_t now);
+    // +1 or -1 towards the other end from the pad the touch started on, 0
+    // from a pad in the middle
+    int getDirection() const;
+
+private:
+    static Transition const transitions[];
+
+    size_t const m_numPads;
+    GestureTimings const m_timings;
+    std::function<void(GestureEvent const&)> const m_onGesture;
+
+    State m_state;
+    uint8_t m_pads;
+    int64_t m_deadline;
+    // pad the gesture started on, and the last one reached by a swipe
+    uint8_t m_pad;
+    uint8_t m_lastPad;
+    // pad touched by the last PRESS
+    uint8_t m_pressedPad;
+};
@@ -1,20 +1,30 @@
 #pragma once
 
+#include <cstdint>
 #include <string>
 
+/**
+ * Gesture recognized on the pads of the touch sensor
+ */
+struct InputEvent {
+    // microseconds since the boot when the touch completing the gesture was
+    // read from the sensor
+    int64_t m_time{0};
+};
+
 // Input events
-struct Press {
+struct Press : InputEvent {
     inline static char const name[] = "press";
 };
 
-struct Click {
+struct Click : InputEvent {
     inline static char const name[] = "click";
 };
 
-struct SwipeClockwise {
+struct SwipeClockwise : InputEvent {
     inline static char const name[] = "swipe_clockwise";
 };
 
-struct SwipeAntiClockwise {
+struct SwipeAntiClockwise : InputEvent {
     inline static char const name[] = "swipe_anti_clockwise";
-};
\ No newline at end of file
+};
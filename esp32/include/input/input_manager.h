@@ -1,34 +1,83 @@
 #pragma once
 
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <Wire.h>
+#include <cstdint>
 #include <string>
+#include <thread>
 #include "SparkFun_CAP1203.h"
+#include "input/gesture_recognizer.h"
 #include "input/input_events.h"
 #include "notifications/notification_manager.h"
-#include <string>
-
-#include <Wire.h>
+#include "utility/session_recorder.h"
 
+/**
+ * Gestures on the pads of the CAP1203 touch sensor.
+ *
+ * The sensor asserts its ALERT line when a pad is touched or released: the
+ * interrupt wakes a task of its own, which reads the pads once and feeds them
+ * to a GestureRecognizer: the gestures completed, by the pads or by their
+ * deadline, are posted to the main queue. The observers are notified by the
+ * main loop, which never waits for the sensor.
+ */
 class InputManager
     : public NotificationManagerImpl<Press, Click, SwipeClockwise,
                                      SwipeAntiClockwise> {
 public:
-  InputManager();
+    InputManager();
 
-  void handleInput();
+    static InputManager* getInstance();
 
-  static InputManager *getInstance();
+    InputManager(const InputManager&) = delete;
 
-  InputManager(const InputManager &) = delete;
+    InputManager& operator=(const InputManager&) = delete;
 
-  InputManager &operator=(const InputManager &) = delete;
+    /**
+     * Posts the gesture @p{event} as if the pads had been touched now, e.g.
+     * replayed by a SessionReplayer
+     */
+    void inject(SessionEvent event);
 
 private:
-  inline static char const TAG[] = "InputManager";
+    // configures the sensor to assert ALERT on touches and releases only
+    void setupInterrupt();
+    // the task reading the sensor when woken by onAlert()
+    void runInput();
+    // feeds the recognizer the pads touched since the last interrupt and
+    // the ones still touched
+    void sample(int64_t now);
+    // posts the event of the pad and the gesture recognized
+    void onGesture(GestureEvent const& gesture);
+    template <typename E>
+    void post(E event, int64_t time);
+
+    // @param inputTask the handle of the input task, to notify
+    static void onAlert(void* inputTask);
 
 private:
-  CAP1203 sensor;
+    inline static char const TAG[] = "InputManager";
+
+    // GPIO wired to the ALERT pin of the sensor, open drain and active low
+    static constexpr uint8_t alertPin = 27;
+    // pads, by their bit in the status of the sensor
+    static constexpr uint8_t leftPad = 0;
+    static constexpr uint8_t middlePad = 1;
+    static constexpr uint8_t rightPad = 2;
+    static constexpr uint8_t numPads = 3;
+    static constexpr uint8_t padMask = (1 << numPads) - 1;
+    // milliseconds after which the task reads the sensor if ALERT is still
+    // asserted, should an edge be missed
+    static constexpr uint32_t alertCheckPeriod = 1000;
+    static constexpr size_t inputTaskStackSize = 3072;
+
+private:
+    CAP1203 sensor;
+
+    static InputManager* instance;
 
-  static InputManager *instance;
+    // used by the input task only
+    GestureRecognizer m_recognizer;
 
-  int64_t const m_timeMs{100};
-};
\ No newline at end of file
+    std::thread m_inputThread;
+};
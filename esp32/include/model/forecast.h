@@ -0,0 +1,91 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string_view>
+
+#include "protocol/wire.h"
+
+namespace model {
+/**
+ * Weather condition of a time slot, of fixed size: the time is kept inline
+ * and the icon by its interned id, so that storing it never allocates.
+ */
+struct Condition {
+    // longest time slot kept, e.g. "Now" or "14:00"
+    inline static constexpr size_t maxTimeSize = 7;
+
+    // NUL terminated, truncated to maxTimeSize bytes
+    char m_time[maxTimeSize + 1];
+    // degrees Celsius
+    int16_t m_temperature;
+    // hPa
+    uint16_t m_pressure;
+    // see protocol::getIconId
+    uint8_t m_icon;
+
+    std::string_view getTime() const { return m_time; }
+
+    bool operator==(Condition const& other) const;
+    bool operator!=(Condition const& other) const { return !(*this == other); }
+};
+
+/**
+ * Conditions of the time slots forecast, in the order the phone sent them.
+ * They are kept in an array allocated with the forecast, and a change
+ * touches only the slot it names.
+ */
+class Forecast {
+public:
+    // the current condition and up to 40 forecasts, the most the phone sends
+    inline static constexpr size_t maxNumConditions = 41;
+
+    Forecast() : m_size{0} {}
+
+    void clear() { m_size = 0; }
+
+    /**
+     * Appends @p{cond}, even if its time slot is there already: the forecasts
+     * further than a day share the time of the day with earlier ones
+     * @return false if @p{cond} has an unknown icon or the forecast is full
+     */
+    bool append(protocol::ConditionView const& cond);
+
+    /**
+     * Replaces the first condition of the time slot of @p{cond}, or appends
+     * it if the slot is new
+     * @return false if @p{cond} has an unknown icon or the forecast is full
+     */
+    bool upsert(protocol::ConditionView const& cond);
+
+    /**
+     * Removes the first condition of the time slot @p{time}, shifting the
+     * next ones
+     * @return false if there is none
+     */
+    bool remove(std::string_view time);
+
+    /**
+     * Returns the position of the first condition of the time slot @p{time},
+     * -1 if there is none
+     */
+    int find(std::string_view time) const;
+
+    size_t size() const { return m_size; }
+
+    bool isEmpty() const { return m_size == 0; }
+
+    Condition const& operator[](size_t idx) const { return m_conditions[idx]; }
+
+private:
+    // writes @p{cond} into the slot @p{idx}, m_size if a new one
+    bool assign(size_t idx, protocol::ConditionView const& cond);
+
+private:
+    inline static char const TAG[] = "Forecast";
+
+private:
+    std::array<Condition, maxNumConditions> m_conditions;
+    size_t m_size;
+};
+}  // namespace model
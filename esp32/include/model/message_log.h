@@ -0,0 +1,185 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+#include "storage/flash.h"
+
+namespace model {
+/**
+ * Message read back from a MessageLog
+ */
+struct LoggedMessage {
+    // sequence number, that is the number of messages appended before, since
+    // the log was created the first time
+    uint32_t m_seq;
+    uint32_t m_timestamp;
+    std::string m_app;
+    std::string m_sender;
+    std::string m_body;
+};
+
+/**
+ * History of the messages appended to a log in flash, which survives reboots
+ * and power losses.
+ *
+ * Sectors are written one after the other round-robin, spreading the erasures
+ * evenly among them. Each sector starts with a header numbering it, to find
+ * the order of the sectors at boot, and each record carries a CRC: a record
+ * torn by a power loss is discarded and ends the valid part of its sector.
+ *
+ * Only the last @p{maxNumRetained} messages are retained and indexed in RAM.
+ * Being the newest ones, they are always in the sectors last written: a
+ * background task compacts the log by erasing the oldest sectors as soon as
+ * they hold no retained message, so that the writes find erased sectors
+ * ahead and nothing is ever copied. The erasures, which take tens of
+ * milliseconds, run without the lock: the appends and the reads go on
+ * meanwhile, hence @p{flash} is accessed by two tasks.
+ */
+class MessageLog {
+public:
+    struct Stats {
+        // bytes of the records appended
+        uint32_t m_numBytesAppended{0};
+        // bytes written to the flash: the ones appended and the headers of the
+        // sectors
+        uint32_t m_numBytesWritten{0};
+        uint32_t m_numSectorsErased{0};
+    };
+
+    /**
+     * Mounts the log kept in @p{flash}, recovering the messages appended
+     * before, and starts the background compaction
+     * @param flash of at least @p{maxNumRetained} + minNumFreeSectors + 1
+     * sectors
+     */
+    MessageLog(std::unique_ptr<storage::Flash> flash, size_t maxNumRetained);
+
+    ~MessageLog();
+
+    /**
+     * Appends a message, truncating its body if the record would not fit a
+     * sector
+     * @return true if the message has been written
+     */
+    bool append(std::string_view app,
+                std::string_view sender,
+                std::string_view body,
+                uint32_t timestamp);
+
+    /**
+     * Returns the number of messages retained
+     */
+    size_t size();
+
+    /**
+     * Calls @p{f} on the messages retained, from the oldest one
+     * @return the number of messages visited
+     */
+    size_t forEach(std::function<void(LoggedMessage const&)> const& f);
+
+    Stats getStats();
+
+private:
+    struct SectorHeader {
+        uint32_t m_magic;
+        uint32_t m_seq;
+    };
+
+    struct RecordHeader {
+        uint32_t m_seq;
+        uint32_t m_timestamp;
+        uint16_t m_appSize;
+        uint16_t m_senderSize;
+        uint16_t m_bodySize;
+        uint16_t m_padding;
+        // of the fields above and of the text following the header
+        uint32_t m_crc;
+
+        size_t getTextSize() const {
+            return m_appSize + m_senderSize + m_bodySize;
+        }
+
+        // records start at addresses multiple of 4
+        size_t getFootprint() const {
+            return (sizeof(RecordHeader) + getTextSize() + 3) & ~size_t{3};
+        }
+    };
+
+    // the following methods are called with m_mutex held
+
+    void mount();
+    // visit the records of the sector @p{idxSector} with a valid layout,
+    // returning the offset after the last one. If @p{isClosed}, the space
+    // after it cannot be written
+    size_t scanSector(
+        size_t idxSector,
+        bool& isClosed,
+        std::function<void(size_t address, RecordHeader const&)> const& f);
+    bool readRecord(size_t address, LoggedMessage& msg);
+    bool writeRecord(RecordHeader header,
+                     std::string_view app,
+                     std::string_view sender,
+                     std::string_view body);
+    bool openNextSector();
+    bool eraseTail();
+    // forgets the tail sector once erased
+    void releaseTail();
+    bool isRetained(uint32_t seq) const;
+    size_t getNumFreeSectors() const;
+    // true if the oldest sector holds no retained message and is not the one
+    // written
+    bool isTailReclaimable() const;
+
+    void runCompaction();
+
+private:
+    inline static char const TAG[] = "MessageLog";
+
+    inline static constexpr uint32_t sectorMagic = 0x31474C4E;  // "NLG1"
+    inline static constexpr uint32_t noAddress = UINT32_MAX;
+    // sectors left erased ahead of the writes in the worst case, so that
+    // appending does not wait for an erasure
+    inline static constexpr size_t minNumFreeSectors = 2;
+
+private:
+    std::unique_ptr<storage::Flash> m_flash;
+    size_t const m_sectorSize;
+    size_t const m_numSectors;
+    size_t const m_maxNumRetained;
+
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    bool m_isStopping;
+    // the compactor is erasing the tail sector, without the lock
+    bool m_isErasingTail;
+    std::condition_variable m_tailErased;
+
+    // the sectors in use go from the tail to the head, round-robin
+    size_t m_idxTailSector;
+    size_t m_idxHeadSector;
+    size_t m_numUsedSectors;
+    uint32_t m_seqHeadSector;
+    // offset in the head sector where the next record is written, the sector
+    // size if the head is closed
+    size_t m_headOffset;
+    // one past the highest sequence number of a message in each sector, 0 if
+    // the sector holds none
+    std::vector<uint32_t> m_maxSeqOfSector;
+
+    // sequence number of the next message
+    uint32_t m_numAppended;
+    // address of the message of sequence number seq at seq % m_maxNumRetained
+    std::vector<uint32_t> m_index;
+
+    Stats m_stats;
+
+    std::thread m_compactor;
+};
+}  // namespace model
@@ -0,0 +1,134 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string_view>
+
+namespace model {
+/**
+ * Message stored in a MessageStore. The strings point into the arena of the
+ * store and are valid until the next message is appended.
+ */
+struct MessageView {
+    // sequence number, that is the number of messages appended before
+    uint32_t m_seq;
+    // milliseconds since boot when the message arrived
+    uint32_t m_timestamp;
+    std::string_view m_app;
+    std::string_view m_sender;
+    std::string_view m_body;
+};
+
+/**
+ * Bounded store of the latest messages received. Records are kept in a ring
+ * of @p{maxNumMessages} slots and their text in a ring arena of
+ * @p{arenaSize} bytes, both allocated once: appending a message evicts the
+ * oldest ones whose slot or text it needs, thus the memory used does not grow
+ * whatever the number of messages arriving.
+ */
+class MessageStore {
+public:
+    MessageStore(size_t maxNumMessages, size_t arenaSize);
+
+    /**
+     * Appends a message in O(1), truncating its body when the message would
+     * not fit the arena.
+     * @return the sequence number of the message
+     */
+    uint32_t append(std::string_view app,
+                    std::string_view sender,
+                    std::string_view body,
+                    uint32_t timestamp);
+
+    /**
+     * Returns the number of messages stored
+     */
+    size_t size() const { return m_size; }
+
+    /**
+     * Returns the number of messages appended since the creation of this
+     * store, which is the sequence number of the next message
+     */
+    uint32_t getNumAppended() const { return m_numAppended; }
+
+    /**
+     * Returns the message @p{idx} positions before the latest one, without
+     * copying its text.
+     * @param idx lower than size(), 0 is the latest message
+     */
+    MessageView latest(size_t idx) const;
+
+    /**
+     * Calls @p{f} on the latest @p{k} messages stored, from the latest one
+     * @return the number of messages visited
+     */
+    template <typename F>
+    size_t forEachLatest(size_t k, F&& f) const {
+        size_t num = k < m_size ? k : m_size;
+        for (size_t i = 0; i < num; i++) {
+            f(latest(i));
+        }
+        return num;
+    }
+
+    /**
+     * Calls @p{f} on the message of sequence number @p{seq}, if still stored
+     * @return true if the message has been visited
+     */
+    template <typename F>
+    bool visit(uint32_t seq, F&& f) const {
+        if (seq >= m_numAppended || m_numAppended - seq > m_size)
+            return false;
+        f(latest(m_numAppended - 1 - seq));
+        return true;
+    }
+
+    /**
+     * Calls @p{f} on the at most @p{k} latest messages stored with sequence
+     * number @p{seq} or higher, from the latest one
+     * @return the number of messages visited
+     */
+    template <typename F>
+    size_t forEachSince(uint32_t seq, size_t k, F&& f) const {
+        size_t numSince = seq < m_numAppended ? m_numAppended - seq : 0;
+        return forEachLatest(numSince < k ? numSince : k, f);
+    }
+
+private:
+    struct Record {
+        uint32_t m_seq;
+        uint32_t m_timestamp;
+        // the app, the sender and the body are stored one after the other
+        // and followed by a '\0', so that every record takes some space in
+        // the arena
+        uint32_t m_offset;
+        uint16_t m_appSize;
+        uint16_t m_senderSize;
+        uint16_t m_bodySize;
+
+        uint32_t end() const {
+            return m_offset + m_appSize + m_senderSize + m_bodySize + 1;
+        }
+    };
+
+    // evict the oldest records while their text overlaps [beg, end)
+    void evictOverlapping(size_t beg, size_t end);
+    void evictOldest();
+
+private:
+    inline static char const TAG[] = "MessageStore";
+
+private:
+    size_t const m_maxNumMessages;
+    size_t const m_arenaSize;
+    std::unique_ptr<Record[]> m_records;
+    std::unique_ptr<char[]> m_arena;
+
+    // slot of the oldest record
+    size_t m_idxOldest;
+    size_t m_size;
+    // where the text of the next message is written
+    size_t m_arenaHead;
+    uint32_t m_numAppended;
+};
+}  // namespace model
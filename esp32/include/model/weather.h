@@ -0,0 +1,47 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+
+#include "model/forecast.h"
+#include "protocol/wire.h"
+
+namespace model {
+/**
+ * Forecast of a location as the phone last sent it, kept apart from the page
+ * showing it so that the updates arriving while the page is not shown are
+ * not lost. A WEATHER frame replaces the whole forecast, a WEATHER_DELTA one
+ * changes the forecast sent before: the deltas are dropped until a whole
+ * forecast arrives, since they would be applied to slots the device never
+ * got.
+ */
+class Weather {
+public:
+    Weather() : m_isSynced{false} {}
+
+    /**
+     * Applies the WEATHER or WEATHER_DELTA @p{frame}
+     * @return false if @p{frame} is of another type, malformed, or a delta
+     * while no whole forecast has arrived
+     */
+    bool apply(protocol::Frame const& frame);
+
+    std::string_view getLocation() const { return m_location; }
+
+    Forecast const& getForecast() const { return m_forecast; }
+
+    /**
+     * Returns whether a whole forecast has arrived, to which the deltas
+     * apply
+     */
+    bool isSynced() const { return m_isSynced; }
+
+private:
+    inline static char const TAG[] = "Weather";
+
+private:
+    std::string m_location;
+    Forecast m_forecast;
+    bool m_isSynced;
+};
+}  // namespace model
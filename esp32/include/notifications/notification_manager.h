@@ -1,6 +1,7 @@
 #pragma once
 
 #include <atomic>
+#include <type_traits>
 #include <unordered_map>
 #include <variant>
 #include "esp_log.h"
@@ -23,6 +24,21 @@ struct Observer : ObserverBase<Args>... {
 template <typename... Args>
 using NotificationType = std::variant<Args...>;
 
+/**
+ * Priority of the events of type T in the main queue: NORMAL unless T
+ * declares a static member 'priority'
+ */
+template <typename T, typename = void>
+struct NotificationPriority {
+    static constexpr view::UIEventPriority value =
+        view::UIEventPriority::NORMAL;
+};
+
+template <typename T>
+struct NotificationPriority<T, std::void_t<decltype(T::priority)>> {
+    static constexpr view::UIEventPriority value = T::priority;
+};
+
 /**
  * Generic class that implements the observer design pattern to allow objects to
  * communicate without having an explicit reference (dependency) between them.
@@ -196,11 +212,17 @@ public:
     void notify(char const* eventName,
                 NotificationType<Args...> notification) override {
         auto mainQueue = view::MainEventQueue::getInstance();
+        view::UIEventPriority priority = std::visit(
+            [](auto const& n) {
+                return NotificationPriority<std::decay_t<decltype(n)>>::value;
+            },
+            notification);
         mainQueue->push(std::make_unique<view::RemoteProcedure>(
             [this, eventName, notification] {
                 std::lock_guard<std::recursive_mutex> lock(mutex);
                 m_notificationManger.notify(eventName, notification);
-            }));
+            },
+            priority));
     }
 
     static DistributedNotificationManager<Args...>* getInstance() {
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include "protocol/wire.h"
+
+/**
+ * Batches of short messages sent in a single write or notification, to save
+ * the per packet overhead of the link:
+ *
+ *   marker (1 byte), message field, message field, ...
+ *
+ * where each message is a field (see wire.h) of tag batchEntryTag. Like
+ * fragments, batches are told apart from frames and JSON documents by their
+ * first byte, not valid utf-8.
+ */
+namespace protocol {
+inline constexpr uint8_t batchMarker = 0xC2;
+
+inline constexpr uint8_t batchEntryTag = 1;
+
+/**
+ * Returns true if @p{data} starts like a batch
+ */
+inline bool isBatch(std::string_view data) {
+    return !data.empty() && static_cast<uint8_t>(data[0]) == batchMarker;
+}
+
+/**
+ * Returns the bytes @p{msg} takes in a batch
+ */
+size_t getBatchedSize(std::string_view msg);
+
+/**
+ * Appends @p{msg} to @p{batch}, starting the batch if empty
+ */
+void appendToBatch(std::string& batch, std::string_view msg);
+
+/**
+ * Calls @p{f} on the messages of @p{batch}, in order
+ * @return false if the batch is malformed
+ */
+template <typename F>
+bool forEachInBatch(std::string_view batch, F&& f) {
+    if (!isBatch(batch))
+        return false;
+    FieldReader reader{batch.substr(1)};
+    Field field;
+    while (reader.next(field)) {
+        if (field.m_tag == batchEntryTag)
+            f(field.m_value);
+    }
+    return !reader.isMalformed();
+}
+}  // namespace protocol
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include "protocol/wire.h"
+
+/**
+ * JSON format of the phones not speaking the binary protocol, e.g.
+ * {"command": "n", "source": ..., "sender": ..., "content": ...}.
+ *
+ * The protocol is negotiated by the phone writing {"command": "h", "v": <the
+ * highest version it speaks>, "c": <codec it compresses with, 0 if none>}:
+ * the device answers with the version to speak, 0 meaning JSON, and the codec
+ * it accepts for the rest of the connection. Until then the phone writes
+ * uncompressed JSON, thus the phones which do not negotiate keep working.
+ *
+ * Any command may carry "ts", the milliseconds of the clock of the phone when
+ * it wrote the document, see tag::sentAt.
+ */
+namespace protocol {
+inline constexpr char helloCommand[] = "h";
+
+/**
+ * Returns the version to speak with a phone speaking up to @p{phoneVersion}
+ */
+inline uint32_t negotiateVersion(uint32_t phoneVersion) {
+    return phoneVersion < version ? phoneVersion : version;
+}
+
+/**
+ * Returns the JSON answer to a phone negotiating the protocol
+ */
+std::string makeHelloAnswer(uint32_t negotiatedVersion,
+                            uint32_t negotiatedCompression);
+
+/**
+ * Transcodes the JSON document @p{json} into a frame, so that the rest of the
+ * device handles a single format
+ * @return false if the document is malformed, its command unknown or the
+ * frame does not fit the writer
+ */
+bool transcodeJSON(std::string_view json, Writer& writer);
+}  // namespace protocol
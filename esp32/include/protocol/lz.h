@@ -0,0 +1,146 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include "protocol/wire.h"
+
+/**
+ * LZSS codec of the bodies of the frames, in the spirit of heatshrink: the
+ * decoder keeps only a window of the last windowSize bytes it produced, thus
+ * it takes a few hundred bytes of RAM and it decodes a stream arriving in
+ * chunks.
+ *
+ * Messages are too short to repeat much of themselves: the window starts
+ * filled with a dictionary of common words, which the copies can refer to.
+ * Changing the dictionary requires a new codec id.
+ *
+ * The stream is a sequence of bits, most significant first, made of tokens:
+ *   1, byte (8 bits): a literal
+ *   0, distance - 1 (8 bits), length - minMatchSize (4 bits): a copy of the
+ *   length bytes starting distance bytes back
+ * The last byte is padded with zeros, which cannot complete a token.
+ */
+namespace protocol {
+namespace lz {
+inline constexpr uint8_t codecId = 1;
+
+inline constexpr size_t windowBits = 8;
+inline constexpr size_t lengthBits = 4;
+inline constexpr size_t windowSize = size_t{1} << windowBits;
+// a copy takes 13 bits, two literals 18
+inline constexpr size_t minMatchSize = 2;
+inline constexpr size_t maxMatchSize = minMatchSize + (1 << lengthBits) - 1;
+
+/**
+ * Returns the content of the window at the beginning of a stream
+ */
+std::string_view getDictionary();
+
+/**
+ * Compresses @p{input} into @p{output}
+ * @return the size of the compressed data, 0 if it does not fit @p{capacity}
+ */
+size_t compress(std::string_view input, char* output, size_t capacity);
+
+/**
+ * Streaming decoder: the compressed data can be fed in any number of chunks
+ */
+class Decoder {
+public:
+    Decoder() { reset(); }
+
+    /**
+     * Prepares the decoding of a new stream
+     */
+    void reset();
+
+    /**
+     * Decodes the chunk @p{input}, calling @p{sink} on each byte produced
+     * @param sink bool(char), returning false to stop the decoding
+     * @return false if the sink stopped it or the data refers before the
+     * dictionary
+     */
+    template <typename Sink>
+    bool feed(std::string_view input, Sink&& sink) {
+        for (char c : input) {
+            m_bits = (m_bits << 8) | static_cast<uint8_t>(c);
+            m_numBits += 8;
+            while (m_numBits >= literalBits) {
+                bool isLiteral = (m_bits >> (m_numBits - 1)) & 1;
+                if (isLiteral) {
+                    m_numBits -= literalBits;
+                    if (!produce((m_bits >> m_numBits) & 0xFF, sink))
+                        return false;
+                    continue;
+                }
+                if (m_numBits < copyBits)
+                    break;
+                m_numBits -= copyBits;
+                uint32_t token = m_bits >> m_numBits;
+                size_t distance = ((token >> lengthBits) & 0xFF) + 1;
+                size_t length =
+                    (token & ((1 << lengthBits) - 1)) + minMatchSize;
+                if (distance > m_numProduced)
+                    return false;
+                for (size_t i = 0; i < length; i++) {
+                    if (!produce(m_window[(m_head - distance) % windowSize],
+                                 sink))
+                        return false;
+                }
+            }
+            m_bits &= (uint32_t{1} << m_numBits) - 1;
+        }
+        return true;
+    }
+
+private:
+    template <typename Sink>
+    bool produce(char c, Sink& sink) {
+        m_window[m_head] = c;
+        m_head = (m_head + 1) % windowSize;
+        m_numProduced++;
+        return sink(c);
+    }
+
+private:
+    inline static constexpr size_t literalBits = 9;
+    inline static constexpr size_t copyBits = 1 + windowBits + lengthBits;
+
+private:
+    char m_window[windowSize];
+    size_t m_head;
+    // including the dictionary
+    size_t m_numProduced;
+    // bits received and not decoded yet, the last m_numBits ones
+    uint32_t m_bits;
+    size_t m_numBits;
+};
+
+/**
+ * Returns true if the bodies of the frames of type @p{type} are worth trying
+ * to compress: the short or binary ones are not
+ */
+bool isCompressible(MessageType type);
+
+/**
+ * Writes into @p{output} the frame @p{frame} with its body compressed
+ * @return the size of the compressed frame, 0 if its type is not
+ * compressible, it does not fit @p{capacity} or it is not shorter than
+ * @p{frame}
+ */
+size_t compressFrame(std::string_view frame, char* output, size_t capacity);
+
+/**
+ * Writes into @p{output} the frame @p{frame}, whose body is compressed, with
+ * its body decompressed
+ * @param inflated set to the frame decompressed
+ * @return false if the body is malformed or the frame does not fit
+ * @p{capacity}
+ */
+bool inflateFrame(Frame const& frame,
+                  char* output,
+                  size_t capacity,
+                  std::string_view& inflated);
+}  // namespace lz
+}  // namespace protocol
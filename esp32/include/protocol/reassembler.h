@@ -0,0 +1,133 @@
+#pragma once
+
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+
+/**
+ * Fragmentation of the messages longer than what a single write of the
+ * characteristic can carry. Each fragment is
+ *
+ *   marker (1 byte), flags (1 byte), message id (1 byte), sequence number
+ *   (1 byte), total size (2 bytes, LE), offset (2 bytes, LE), payload
+ *
+ * where the sequence number counts the fragments of a message from 0, the
+ * offset is the one of the payload in the message and the flags tell the
+ * last fragment. Fragments can arrive in any order and interleaved with the
+ * ones of other messages. The marker is not valid utf-8, thus fragments,
+ * frames and JSON documents can be told apart by their first byte.
+ */
+namespace protocol {
+inline constexpr uint8_t fragmentMarker = 0xC1;
+
+inline constexpr size_t fragmentHeaderSize = 8;
+
+inline constexpr uint8_t lastFragmentFlag = 0x01;
+
+// sequence numbers are one byte
+inline constexpr size_t maxNumFragments = 256;
+
+/**
+ * Returns true if @p{data} starts like a fragment
+ */
+inline bool isFragment(std::string_view data) {
+    return !data.empty() && static_cast<uint8_t>(data[0]) == fragmentMarker;
+}
+
+/**
+ * Splits a message into fragments of at most @p{maxFragmentSize} bytes
+ */
+class Fragmenter {
+public:
+    Fragmenter(std::string_view message, uint8_t id, size_t maxFragmentSize);
+
+    /**
+     * Writes the next fragment into @p{buffer}, of at least maxFragmentSize
+     * bytes
+     * @return the size of the fragment, 0 once the message is over or if it
+     * needs more than maxNumFragments fragments
+     */
+    size_t next(char* buffer);
+
+private:
+    std::string_view const m_message;
+    uint8_t const m_id;
+    size_t const m_maxPayloadSize;
+    size_t m_offset;
+    size_t m_seq;
+};
+
+/**
+ * Reassembles the fragments received into a pool of buffers allocated once.
+ * Each message being reassembled takes a buffer, which is given back once the
+ * message is complete or no fragment of it arrives for a timeout.
+ */
+class Reassembler {
+public:
+    struct Stats {
+        uint32_t m_numCompleted{0};
+        // incomplete messages discarded since no fragment of them arrived for
+        // the timeout, or to make room for a newer one
+        uint32_t m_numExpired{0};
+        // fragments malformed or of messages longer than a buffer
+        uint32_t m_numDropped{0};
+    };
+
+    /**
+     * @param numBuffers messages reassembled at the same time
+     * @param bufferSize maximum size of a message
+     * @param timeout in milliseconds after which an incomplete message is
+     * discarded
+     */
+    Reassembler(size_t numBuffers, size_t bufferSize, uint32_t timeout);
+
+    /**
+     * Adds the fragment @p{fragment}, arrived at @p{now} milliseconds
+     * @param message set to the message completed by the fragment, valid
+     * until the next call
+     * @return true if the fragment completed a message
+     */
+    bool push(std::string_view fragment,
+              uint32_t now,
+              std::string_view& message);
+
+    Stats getStats() const { return m_stats; }
+
+private:
+    struct Slot {
+        bool m_isUsed{false};
+        uint8_t m_id;
+        uint16_t m_totalSize;
+        size_t m_numBytesReceived;
+        size_t m_numFragmentsReceived;
+        // number of fragments of the message, known at the last one
+        size_t m_numFragments;
+        uint32_t m_lastUpdate;
+        std::bitset<maxNumFragments> m_isReceived;
+    };
+
+    // discard the incomplete messages without news since the timeout
+    void expire(uint32_t now);
+    // return the slot of the message @p{id}, taking a free one or the least
+    // recently updated if it is new
+    Slot& findSlot(uint8_t id, uint16_t totalSize, uint32_t now);
+    char* getBuffer(Slot const& slot) {
+        return m_buffers.get() + (&slot - m_slots.get()) * m_bufferSize;
+    }
+
+private:
+    inline static char const TAG[] = "Reassembler";
+
+private:
+    size_t const m_numBuffers;
+    size_t const m_bufferSize;
+    uint32_t const m_timeout;
+    std::unique_ptr<Slot[]> m_slots;
+    std::unique_ptr<char[]> m_buffers;
+    // slot of the message returned by the last push, freed by the next one
+    Slot* m_completed;
+    Stats m_stats;
+};
+}  // namespace protocol
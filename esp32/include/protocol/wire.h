@@ -0,0 +1,329 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+/**
+ * Compact binary framing of the messages exchanged with the phone.
+ *
+ * A frame is made of a header followed by a body:
+ *
+ *   marker | version (1 byte), type (1 byte), body size (2 bytes, LE), body
+ *
+ * where the high bit of the type tells a compressed body. The first byte can
+ * never start a JSON document, which remains the fallback for the phones not
+ * speaking this protocol: the two formats are told apart by it. The body is a
+ * sequence of fields
+ *
+ *   tag (1 byte), value size (varint), value
+ *
+ * where integers are varints, strings are utf-8 without terminator and nested
+ * records (e.g. the weather conditions) are sequences of fields themselves.
+ * Unknown tags are skipped, thus fields can be added without breaking the
+ * older decoders.
+ *
+ * Decoding does not allocate: the views returned point into the frame.
+ */
+namespace protocol {
+inline constexpr uint8_t version = 1;
+
+// high nibble of the first byte of a frame, a utf-8 continuation byte which
+// cannot start a text
+inline constexpr uint8_t frameMarker = 0xB0;
+
+inline constexpr size_t headerSize = 4;
+
+// set in the type byte of the frames whose body is compressed, see lz.h
+inline constexpr uint8_t compressedFlag = 0x80;
+
+// longest frame received, either in a single write of the characteristic or
+// in fragments (see reassembler.h)
+inline constexpr size_t maxFrameSize = 2048;
+
+enum class MessageType : uint8_t {
+    // negotiation of the protocol, see json_fallback.h
+    HELLO = 1,
+    NOTIFICATION = 2,
+    CALL = 3,
+    TRANSLATION = 4,
+    // only the tail of an utterance following its stable prefix
+    PARTIAL_TRANSCRIPT = 5,
+    WEATHER = 6,
+    // changes to the conditions of the last WEATHER, by time slot: sent only
+    // while the time slots are unique, i.e. within a day
+    WEATHER_DELTA = 7,
+};
+
+namespace tag {
+// any message, optional: milliseconds of the clock of the phone, modulo 2^32,
+// when it wrote the message (see Tracer)
+inline constexpr uint8_t sentAt = 0x7F;
+// HELLO
+inline constexpr uint8_t helloVersion = 1;
+// codec of the compressed bodies, 0 if none
+inline constexpr uint8_t helloCompression = 2;
+// NOTIFICATION, CALL
+inline constexpr uint8_t notificationSource = 1;
+inline constexpr uint8_t notificationSender = 2;
+inline constexpr uint8_t notificationContent = 3;
+// TRANSLATION
+inline constexpr uint8_t translationText = 1;
+// PARTIAL_TRANSCRIPT
+inline constexpr uint8_t transcriptUtterance = 1;
+// size in bytes of the prefix of the utterance kept
+inline constexpr uint8_t transcriptNumStableBytes = 2;
+inline constexpr uint8_t transcriptTail = 3;
+// WEATHER
+inline constexpr uint8_t weatherLocation = 1;
+inline constexpr uint8_t weatherCondition = 2;
+// fields of a weather condition
+inline constexpr uint8_t conditionTime = 1;
+// signed, degrees Celsius
+inline constexpr uint8_t conditionTemperature = 2;
+// hPa
+inline constexpr uint8_t conditionPressure = 3;
+// interned, see getIconId
+inline constexpr uint8_t conditionIcon = 4;
+// WEATHER_DELTA, whose changes are applied in the order they are encoded
+// a condition, replacing the one of its time slot or else appended
+inline constexpr uint8_t weatherUpsert = 1;
+// time slot of the condition removed
+inline constexpr uint8_t weatherRemove = 2;
+}  // namespace tag
+
+inline constexpr uint8_t unknownIcon = UINT8_MAX;
+
+// weather icons interned, their ids are lower
+inline constexpr uint8_t numIcons = 22;
+
+/**
+ * Returns the id interning the weather icon @p{name}, unknownIcon if none
+ */
+uint8_t getIconId(std::string_view name);
+
+/**
+ * Returns the name of the weather icon interned by @p{id}, empty if unknown
+ */
+std::string_view getIconName(uint8_t id);
+
+/**
+ * Returns true if @p{data} starts like a frame rather than a JSON document
+ */
+inline bool isFrame(std::string_view data) {
+    return !data.empty() &&
+           (static_cast<uint8_t>(data[0]) & 0xF0) == frameMarker;
+}
+
+struct Frame {
+    MessageType m_type;
+    // the body has to be decompressed before decoding it
+    bool m_isCompressed;
+    std::string_view m_body;
+};
+
+/**
+ * Splits @p{data} into the type and the body of a frame
+ * @return false if @p{data} is not a frame of this version or it is truncated
+ */
+bool decodeFrame(std::string_view data, Frame& frame);
+
+struct Field {
+    uint8_t m_tag;
+    std::string_view m_value;
+
+    /**
+     * Returns the value as an unsigned varint, 0 if malformed
+     */
+    uint32_t asUInt() const;
+
+    /**
+     * Returns the value as a zigzag signed varint, 0 if malformed
+     */
+    int32_t asInt() const;
+};
+
+/**
+ * Iterates over the fields of a body or of a nested record
+ */
+class FieldReader {
+public:
+    explicit FieldReader(std::string_view data) : m_data{data} {}
+
+    /**
+     * Reads the next field into @p{field}
+     * @return false at the end of the data or if a field is truncated
+     */
+    bool next(Field& field);
+
+    /**
+     * Returns true if the reading stopped at a truncated field
+     */
+    bool isMalformed() const { return m_isMalformed; }
+
+private:
+    std::string_view m_data;
+    bool m_isMalformed{false};
+};
+
+// decoded messages: the strings point into the frame they come from
+
+struct HelloView {
+    uint32_t m_version{0};
+    uint32_t m_compression{0};
+};
+
+struct NotificationView {
+    std::string_view m_source;
+    std::string_view m_sender;
+    std::string_view m_content;
+};
+
+struct TranslationView {
+    std::string_view m_text;
+};
+
+struct PartialTranscriptView {
+    uint32_t m_idUtterance{0};
+    uint32_t m_numStableBytes{0};
+    std::string_view m_tail;
+};
+
+struct ConditionView {
+    std::string_view m_time;
+    int32_t m_temperature{0};
+    uint32_t m_pressure{0};
+    uint8_t m_icon{unknownIcon};
+};
+
+/**
+ * Decodes the fields of a nested condition record
+ */
+ConditionView decodeCondition(std::string_view fields);
+
+struct WeatherView {
+    std::string_view m_location;
+    // the fields of the body, among which the conditions
+    std::string_view m_fields;
+
+    /**
+     * Calls @p{f} on the conditions, in the order they were encoded
+     * @return the number of conditions visited
+     */
+    template <typename F>
+    size_t forEachCondition(F&& f) const {
+        size_t num = 0;
+        FieldReader reader{m_fields};
+        Field field;
+        while (reader.next(field)) {
+            if (field.m_tag != tag::weatherCondition)
+                continue;
+            f(decodeCondition(field.m_value));
+            num++;
+        }
+        return num;
+    }
+};
+
+struct WeatherDeltaView {
+    std::string_view m_fields;
+
+    /**
+     * Calls @p{upsert} on the conditions upserted and @p{remove} on the time
+     * slots removed, in the order they were encoded
+     * @return the number of changes visited
+     */
+    template <typename U, typename R>
+    size_t forEachChange(U&& upsert, R&& remove) const {
+        size_t num = 0;
+        FieldReader reader{m_fields};
+        Field field;
+        while (reader.next(field)) {
+            if (field.m_tag == tag::weatherUpsert)
+                upsert(decodeCondition(field.m_value));
+            else if (field.m_tag == tag::weatherRemove)
+                remove(field.m_value);
+            else
+                continue;
+            num++;
+        }
+        return num;
+    }
+};
+
+/**
+ * Looks up the time the phone stamped @p{frame} with, see tag::sentAt
+ * @return false if the frame is not stamped
+ */
+bool findSentAt(Frame const& frame, uint32_t& sentAt);
+
+/**
+ * Decode the body of @p{frame}, which must be of the matching type
+ * @return false if the type does not match or the body is malformed
+ */
+bool decode(Frame const& frame, HelloView& msg);
+bool decode(Frame const& frame, NotificationView& msg);
+bool decode(Frame const& frame, TranslationView& msg);
+bool decode(Frame const& frame, PartialTranscriptView& msg);
+bool decode(Frame const& frame, WeatherView& msg);
+bool decode(Frame const& frame, WeatherDeltaView& msg);
+
+/**
+ * Encodes a frame into a buffer of the caller. Once the buffer overflows the
+ * writes are ignored and finish() fails, so that the fields can be written
+ * without checking each of them.
+ */
+class Writer {
+public:
+    Writer(char* buffer, size_t capacity);
+
+    /**
+     * Starts a frame of type @p{type}, discarding the one written before
+     */
+    void begin(MessageType type);
+
+    void putString(uint8_t tag, std::string_view value);
+
+    void putUInt(uint8_t tag, uint32_t value);
+
+    void putInt(uint8_t tag, int32_t value);
+
+    /**
+     * Starts a nested record, whose fields are the ones put until the
+     * matching endNested()
+     * @return the position to pass to endNested()
+     */
+    size_t beginNested(uint8_t tag);
+
+    void endNested(size_t position);
+
+    /**
+     * Completes the header of the frame
+     * @return false if the frame did not fit the buffer
+     */
+    bool finish();
+
+    /**
+     * Returns the frame written, valid after a successful finish()
+     */
+    std::string_view getFrame() const {
+        return std::string_view{m_buffer, m_size};
+    }
+
+private:
+    void putByte(uint8_t byte);
+    void putVarint(uint32_t value);
+    void putBytes(std::string_view bytes);
+
+private:
+    // a nested record reserves the longest varint needed by its size, that is
+    // 2 bytes for the frames fitting maxFrameSize
+    inline static constexpr size_t nestedSizeReserved = 2;
+
+private:
+    char* const m_buffer;
+    size_t const m_capacity;
+    size_t m_size;
+    bool m_hasOverflowed;
+};
+}  // namespace protocol
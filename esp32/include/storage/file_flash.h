@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include "storage/flash.h"
+
+namespace storage {
+/**
+ * Stand-in for a flash region kept in a file, e.g. to run the storage on the
+ * host or to inspect a dump of a partition. Writes behave like on NOR flash:
+ * they can only clear bits. As a partition, it can be accessed by several
+ * tasks at once.
+ */
+class FileFlash : public Flash {
+public:
+    /**
+     * Opens the file at @p{path} as a flash of @p{numSectors} sectors of
+     * @p{sectorSize} bytes, creating it erased if it does not exist
+     * @return the flash, or nullptr if the file cannot be opened
+     */
+    static std::unique_ptr<FileFlash> open(char const* path,
+                                           size_t sectorSize,
+                                           size_t numSectors);
+
+    ~FileFlash();
+
+    size_t getSize() const override { return m_sectorSize * m_numSectors; }
+
+    size_t getSectorSize() const override { return m_sectorSize; }
+
+    bool read(size_t offset, void* dst, size_t size) override;
+
+    bool write(size_t offset, void const* src, size_t size) override;
+
+    bool eraseSector(size_t idxSector) override;
+
+private:
+    FileFlash(FILE* file, size_t sectorSize, size_t numSectors)
+        : m_file{file}, m_sectorSize{sectorSize}, m_numSectors{numSectors} {}
+
+    // called with m_mutex held
+    bool readAt(size_t offset, void* dst, size_t size);
+
+private:
+    inline static char const TAG[] = "FileFlash";
+
+private:
+    std::mutex m_mutex;
+    FILE* m_file;
+    size_t const m_sectorSize;
+    size_t const m_numSectors;
+};
+}  // namespace storage
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstddef>
+
+namespace storage {
+/**
+ * Region of NOR flash. Erasing a sector sets all its bits to 1 and writing
+ * can only clear bits, thus a byte can be written once between two erasures.
+ */
+class Flash {
+public:
+    virtual ~Flash() = default;
+
+    /**
+     * Returns the size in bytes of the region, a multiple of the sector size
+     */
+    virtual size_t getSize() const = 0;
+
+    /**
+     * Returns the size in bytes of the smallest erasable unit
+     */
+    virtual size_t getSectorSize() const = 0;
+
+    /**
+     * Reads @p{size} bytes at @p{offset} into @p{dst}
+     * @return true on success
+     */
+    virtual bool read(size_t offset, void* dst, size_t size) = 0;
+
+    /**
+     * Writes @p{size} bytes of @p{src} at @p{offset}, which must have been
+     * erased and not written since
+     * @return true on success
+     */
+    virtual bool write(size_t offset, void const* src, size_t size) = 0;
+
+    /**
+     * Erases the sector @p{idxSector}
+     * @return true on success
+     */
+    virtual bool eraseSector(size_t idxSector) = 0;
+};
+}  // namespace storage
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <esp_partition.h>
+#include <memory>
+#include "storage/flash.h"
+
+namespace storage {
+/**
+ * Flash of a data partition of the partition table, accessed raw
+ */
+class PartitionFlash : public Flash {
+public:
+    /**
+     * Returns the flash of the data partition @p{label}, or nullptr if the
+     * partition table has none
+     */
+    static std::unique_ptr<PartitionFlash> open(char const* label);
+
+    size_t getSize() const override { return m_partition->size; }
+
+    size_t getSectorSize() const override { return SPI_FLASH_SEC_SIZE; }
+
+    bool read(size_t offset, void* dst, size_t size) override;
+
+    bool write(size_t offset, void const* src, size_t size) override;
+
+    bool eraseSector(size_t idxSector) override;
+
+private:
+    explicit PartitionFlash(esp_partition_t const* partition)
+        : m_partition{partition} {}
+
+private:
+    inline static char const TAG[] = "PartitionFlash";
+
+private:
+    esp_partition_t const* m_partition;
+};
+}  // namespace storage
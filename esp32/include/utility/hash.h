@@ -0,0 +1,22 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+inline constexpr uint32_t fnv1aOffsetBasis = 2166136261u;
+
+/**
+ * 32 bits FNV-1a hash of the @p{size} bytes at @p{data}.
+ * @param h hash of the bytes preceding @p{data}, to resume the hash of a
+ * sequence given in more chunks
+ * @return the hash of the bytes
+ */
+uint32_t fnv1a(void const* data, size_t size, uint32_t h = fnv1aOffsetBasis);
+
+/**
+ * CRC-32 (IEEE 802.3, the one of zlib) of the @p{size} bytes at @p{data}.
+ * @param crc of the bytes preceding @p{data}, to resume the checksum of a
+ * sequence given in more chunks
+ * @return the checksum of the bytes
+ */
+uint32_t crc32(void const* data, size_t size, uint32_t crc = 0);
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <queue>
+
+/**
+ * Thread safe queue with a lane per priority: the elements are removed from
+ * the first lane that is not empty, and in order of arrival within a lane
+ */
+template <typename T, size_t numLanes>
+class PriorityBlockingQueue {
+public:
+    /**
+     * Pushes an element to the queue
+     * @param item to push
+     * @param lane of the item, 0 being removed first
+     */
+    void push(T&& item, size_t lane) {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_lanes[lane].push(std::move(item));
+        }
+        m_cv.notify_one();
+    }
+
+    /**
+     * Removes the element with the highest priority off the queue and returns
+     * it, waiting if the queue is empty
+     */
+    T remove() {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_cv.wait(lock, [this]() { return !isEmptyLocked(); });
+        return takeLocked();
+    }
+
+    /**
+     * Removes the element with the highest priority off the queue, waiting at
+     * most @p{timeout} for one to arrive
+     * @param item set to the element removed
+     * @return false if the queue was still empty after @p{timeout}
+     */
+    bool remove(T& item, std::chrono::milliseconds timeout) {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        if (!m_cv.wait_for(lock, timeout,
+                           [this]() { return !isEmptyLocked(); }))
+            return false;
+        item = takeLocked();
+        return true;
+    }
+
+    bool isEmpty() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return isEmptyLocked();
+    }
+
+private:
+    bool isEmptyLocked() const {
+        for (std::queue<T> const& lane : m_lanes) {
+            if (!lane.empty())
+                return false;
+        }
+        return true;
+    }
+
+    T takeLocked() {
+        for (std::queue<T>& lane : m_lanes) {
+            if (lane.empty())
+                continue;
+            T item(std::move(lane.front()));
+            lane.pop();
+            return item;
+        }
+        return T{};
+    }
+
+private:
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    std::array<std::queue<T>, numLanes> m_lanes;
+};
@@ -0,0 +1,109 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include "storage/flash.h"
+
+/**
+ * Inputs of the device recorded in a session, see SessionRecorder
+ */
+enum class SessionEvent : uint8_t {
+    // gestures of the touch sensor, as posted by InputManager
+    PRESS,
+    CLICK,
+    SWIPE_CLOCKWISE,
+    SWIPE_ANTI_CLOCKWISE,
+    // a write of the phone as received, its bytes as the payload
+    PHONE_WRITE,
+};
+inline constexpr size_t numSessionEvents = 5;
+
+/**
+ * Records the inputs of the device, the gestures and the writes of the
+ * phone, with the time they arrived, so that a session can be replayed the
+ * same by a SessionReplayer, e.g. to compare the drawing of two builds.
+ *
+ * The trace is a sequence of records, each a header of 7 bytes: the
+ * microseconds since the recording started (4 bytes, thus a session lasts up
+ * to 71 minutes), the SessionEvent (1 byte) and the size of the payload (2
+ * bytes), little endian, followed by the payload. In flash the records follow
+ * each other from the start, up to an erased header.
+ *
+ * Streamed as text, each record is a line "session <record in hex>": the
+ * trace is rebuilt from a log of the serial port with
+ *
+ *   grep '^session ' log | cut -d' ' -f2 | xxd -r -p > trace.bin
+ *
+ * Recording costs a load of an atomic to the inputs while stopped.
+ */
+class SessionRecorder {
+public:
+    /**
+     * Takes each record in turn
+     * @return false if full, which stops the recording
+     */
+    using Sink = std::function<bool(std::string_view record)>;
+
+    inline static constexpr size_t headerSize = 7;
+    // the largest write of the phone
+    inline static constexpr size_t maxPayloadSize = 512;
+
+    static SessionRecorder* getInstance();
+
+    /**
+     * Returns a sink appending the records to @p{flash} from its start,
+     * erased whole before the recording starts so that recording only writes
+     * (a sink failing every record if the erasure fails)
+     */
+    static Sink makeFlashSink(std::unique_ptr<storage::Flash> flash);
+
+    /**
+     * Returns a sink handing each record as a line of text to @p{print},
+     * e.g. to stream it over the serial port
+     */
+    static Sink makeTextSink(std::function<void(char const* line)> print);
+
+    /**
+     * Starts recording into @p{sink}, from now
+     */
+    void start(Sink sink);
+
+    void stop();
+
+    bool isRecording() const {
+        return m_isRecording.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * Records @p{event} if recording, on the task of the caller
+     * @param time lower 32 bits of esp_timer_get_time() when @p{event}
+     * arrived, less than 71 minutes ago. The recording stops once the session
+     * lasts longer than the header can tell
+     * @param payload dropped with the record if longer than maxPayloadSize
+     */
+    void record(SessionEvent event,
+                uint32_t time,
+                std::string_view payload = {});
+
+    /**
+     * Returns the number of records taken by the sink since the start
+     */
+    uint32_t getNumRecords() const { return m_numRecords; }
+
+private:
+    inline static char const TAG[] = "SessionRecorder";
+
+private:
+    std::atomic<bool> m_isRecording{false};
+    // the sink is called by a task at a time, in the order of the records
+    std::mutex m_mutex;
+    Sink m_sink;
+    int64_t m_startTime{0};
+    std::atomic<uint32_t> m_numRecords{0};
+};
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <thread>
+#include "storage/flash.h"
+#include "utility/session_recorder.h"
+#include "utility/tracer.h"
+
+/**
+ * Replays a session recorded by SessionRecorder, injecting its records at the
+ * pace they were recorded or faster, and measures the frames they cost to the
+ * main loop: the same trace is a benchmark of the drawing, e.g. of the
+ * navigation between the pages, from a build to the next.
+ *
+ * The main loop reports the time it spends on each event through onFrame():
+ * the frames are added to the record injected last, until the next one is.
+ * At the original pace the records seldom overlap, and the events which only
+ * make sense with the ones before, e.g. the fragments of a message, are
+ * replayed in order.
+ */
+class SessionReplayer {
+public:
+    /**
+     * Injects a record as if it arrived now, e.g. a write of the phone into
+     * ConnectionManager::onCharacteristicChange()
+     */
+    using Injector =
+        std::function<void(SessionEvent event, std::string_view payload)>;
+
+    /**
+     * @param trace holding the records from its start
+     */
+    SessionReplayer(storage::Flash& trace, Injector inject);
+
+    ~SessionReplayer();
+
+    SessionReplayer(SessionReplayer const&) = delete;
+
+    SessionReplayer& operator=(SessionReplayer const&) = delete;
+
+    /**
+     * Starts the replay on a task of its own
+     * @param speed times the pace of the recording, at least 1
+     */
+    void start(uint32_t speed);
+
+    /**
+     * Waits for the replay to end, the frames of the last record included
+     */
+    void wait();
+
+    bool isReplaying() const { return m_isReplaying; }
+
+    /**
+     * Adds a frame of @p{duration} microseconds to the record injected last,
+     * called by the main loop after each event
+     */
+    void onFrame(uint32_t duration);
+
+    /**
+     * Returns a table of the records replayed and the percentiles of the
+     * time of their frames by event, in microseconds
+     */
+    std::string report() const;
+
+private:
+    void run(uint32_t speed);
+    // adds the frames since the last call to the record injected last
+    void fold();
+
+private:
+    inline static char const TAG[] = "SessionReplayer";
+
+    // microseconds without frames after which the last record is done
+    static constexpr int64_t settleTime = 500000;
+    static constexpr size_t replayTaskStackSize = 4096;
+
+private:
+    storage::Flash& m_trace;
+    Injector const m_inject;
+
+    std::atomic<bool> m_isReplaying{false};
+    // the record injected last, and its frames: time in microseconds and
+    // number
+    SessionEvent m_event{SessionEvent::PHONE_WRITE};
+    uint32_t m_index{0};
+    std::atomic<uint32_t> m_frameTime{0};
+    std::atomic<uint32_t> m_numFrames{0};
+    std::atomic<int64_t> m_lastFrameTime{0};
+
+    // time of the frames of a record, by event
+    std::array<Tracer::Histogram, numSessionEvents> m_histograms;
+    std::atomic<uint32_t> m_numRecords{0};
+    // records injected later than due, the replay falling behind
+    std::atomic<uint32_t> m_numLate{0};
+
+    std::thread m_task;
+};
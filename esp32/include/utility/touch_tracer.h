@@ -0,0 +1,123 @@
+#pragma once
+
+#include <esp_timer.h>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include "utility/session_recorder.h"
+#include "utility/tracer.h"
+
+// 0 compiles the stamps of TouchTracer out
+#ifndef TOUCH_LATENCY
+#define TOUCH_LATENCY 1
+#endif
+
+/**
+ * Latency from a touch of the pads to the screen showing its outcome, e.g. a
+ * swipe scrolling a Roll or a press rebuilding the page, by gesture.
+ *
+ * A gesture is stamped when the sensor is read (or when its deadline passes,
+ * see GestureRecognizer), when InputManager posts it, and when the main loop
+ * starts and ends handling it. In between, each view drawn or cleared stamps
+ * the end of its transfers to the display: TFT_eSPI transfers synchronously,
+ * thus the last stamp is when the screen shows the gesture.
+ *
+ * Only the main loop stamps, a gesture at a time, and the histograms are
+ * read by the diagnostics. Built with -DTOUCH_LATENCY=0 the stamps compile to
+ * nothing, otherwise they cost a few reads of the clock per gesture and one
+ * per view drawn.
+ */
+class TouchTracer {
+public:
+    static TouchTracer* getInstance();
+
+    /**
+     * Starts the handling of @p{gesture} by the main loop
+     * @param gesture of the touch sensor, PHONE_WRITE excluded
+     * @param touchTime microseconds since the boot when the sensor was read
+     * @param postTime when the gesture was posted to the main queue
+     */
+    void beginHandling(SessionEvent gesture,
+                       int64_t touchTime,
+                       int64_t postTime) {
+#if TOUCH_LATENCY
+        m_gesture = gesture;
+        m_touchTime = touchTime;
+        m_postTime = postTime;
+        m_transferTime = 0;
+        m_isHandling = true;
+        m_beginTime = esp_timer_get_time();
+#endif
+    }
+
+    /**
+     * Ends the handling, adding its latencies to the histograms
+     */
+    void endHandling() {
+#if TOUCH_LATENCY
+        fold(esp_timer_get_time());
+#endif
+    }
+
+    /**
+     * Stamps the end of the transfers of a view to the display, called by
+     * the views when drawn or cleared
+     */
+    void stampTransfer() {
+#if TOUCH_LATENCY
+        if (m_isHandling)
+            m_transferTime = esp_timer_get_time();
+#endif
+    }
+
+    /**
+     * Returns a table of the count and the percentiles of the latencies in
+     * microseconds, stage by stage and from the touch to the screen by
+     * gesture, short enough for a read of a characteristic
+     */
+    std::string dump() const;
+
+    /**
+     * Returns the number of gestures handled
+     */
+    uint32_t getNumHandled() const { return m_numHandled; }
+
+private:
+    // stages of a gesture after the touch, in order
+    enum class Stage : uint8_t {
+        // by InputManager
+        POSTED,
+        // by the main loop
+        BEGUN,
+        // the last view drawn
+        TRANSFERRED,
+        ENDED,
+    };
+
+    void fold(int64_t endTime);
+
+private:
+    inline static constexpr size_t numStages = 4;
+    inline static constexpr size_t numGestures =
+        static_cast<size_t>(SessionEvent::PHONE_WRITE);
+
+private:
+    // the gesture being handled
+    bool m_isHandling{false};
+    SessionEvent m_gesture{SessionEvent::PRESS};
+    int64_t m_touchTime{0};
+    int64_t m_postTime{0};
+    int64_t m_beginTime{0};
+    // 0 while no view has been drawn
+    int64_t m_transferTime{0};
+
+    // from the stage before, by stage
+    std::array<Tracer::Histogram, numStages> m_stages;
+    // from the touch to the last transfer, by gesture
+    std::array<Tracer::Histogram, numGestures> m_gestures;
+    std::atomic<uint32_t> m_numHandled{0};
+    // gestures handled without drawing, e.g. a click on a page ignoring it
+    std::atomic<uint32_t> m_numUndrawn{0};
+};
@@ -0,0 +1,169 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/**
+ * Stages of a message of the phone on its way to the screen, in order
+ */
+enum class TraceStage : uint8_t {
+    // written by the phone, estimated on the clock of the device
+    SENT,
+    // copied by the BLE callback
+    RECEIVED,
+    // decoded into a frame by the RX task
+    DECODED,
+    // pushed into the main queue
+    QUEUED,
+    // taken by the main loop
+    DEQUEUED,
+    // handled by the page, whose drawing is synchronous
+    DRAWN,
+};
+inline constexpr size_t numTraceStages = 6;
+
+/**
+ * Latency of the messages from the phone to the screen, stage by stage.
+ *
+ * Each message gets an id, and each stage it goes through stamps the id with
+ * the time into a ring: the stamps are written without locks, thus from the
+ * BLE callback too, and the ring is allocated once. When the message is drawn
+ * its stamps are looked up in the ring and the time between two consecutive
+ * stages, and from the arrival to the screen, is added to histograms.
+ *
+ * The tasks in between pass the id along with the message: the RX task sets
+ * it as the current one of its thread while handling the message, the events
+ * of the main queue take it from there (see view::UIEvent).
+ *
+ * The phone may stamp its messages with the time it wrote them (see
+ * protocol::tag::sentAt). The clocks are not synchronized, thus the lowest
+ * difference seen between the arrival and the phone stamp stands for the
+ * offset of the clocks plus the fastest transfer: the phone leg is estimated
+ * above that.
+ */
+class Tracer {
+public:
+    /**
+     * Latencies in microseconds, in buckets 4 per power of 2
+     */
+    class Histogram {
+    public:
+        void add(uint32_t value);
+
+        uint32_t getCount() const { return m_count; }
+
+        uint32_t getMax() const { return m_max; }
+
+        /**
+         * Returns the upper bound of the bucket of the @p{percent}-th
+         * percentile, 0 if empty
+         */
+        uint32_t getPercentile(uint32_t percent) const;
+
+    private:
+        inline static constexpr size_t numBuckets = 4 + 30 * 4;
+
+        static size_t getBucket(uint32_t value);
+        static uint32_t getUpperBound(size_t bucket);
+
+    private:
+        // written by the main loop only, read by the diagnostics
+        std::array<std::atomic<uint32_t>, numBuckets> m_buckets{};
+        std::atomic<uint32_t> m_count{0};
+        std::atomic<uint32_t> m_max{0};
+    };
+
+    static Tracer* getInstance();
+
+    /**
+     * Starts the trace of a message received at @p{receivedTime}
+     * @param receivedTime lower 32 bits of esp_timer_get_time()
+     * @return the id of the message, never 0, wrapping after 2^24 messages
+     */
+    uint32_t begin(uint32_t receivedTime);
+
+    /**
+     * Stamps the message @p{id} at @p{stage} with the current time, nothing
+     * if @p{id} is 0 i.e. the event does not come from a message
+     */
+    void record(uint32_t id, TraceStage stage);
+
+    /**
+     * Stamps the SENT stage of the message @p{id} from the time @p{sentAt}
+     * of the phone, in milliseconds
+     */
+    void recordSent(uint32_t id, uint32_t sentAt, uint32_t receivedTime);
+
+    /**
+     * Forgets the offset of the clock of the phone, e.g. a new phone
+     * connected
+     */
+    void resetPhoneClock() { m_hasPhoneOffset = false; }
+
+    /**
+     * Returns a table of the count and the percentiles of the latencies, in
+     * microseconds, and the number of messages drawn whose stamps were lost,
+     * short enough for a read of a characteristic
+     */
+    std::string dump() const;
+
+    /**
+     * Returns the number of messages whose latency is in the histograms
+     */
+    uint32_t getNumDrawn() const { return m_total.getCount(); }
+
+    /**
+     * Id of the message handled by the calling thread, 0 if none
+     */
+    static uint32_t getCurrent() { return current; }
+
+    static void setCurrent(uint32_t id) { current = id; }
+
+private:
+    struct Stamp {
+        // 2 * position + 2 once written, odd while being written
+        std::atomic<uint32_t> m_seq{0};
+        // id << 8 | stage
+        std::atomic<uint32_t> m_idStage{0};
+        std::atomic<uint32_t> m_time{0};
+    };
+
+    void record(uint32_t id, TraceStage stage, uint32_t time);
+    // looks up the stamps of @p{id} and adds its latencies to the histograms
+    void fold(uint32_t id);
+
+private:
+    // 3 KB, the stamps of about 40 messages from the arrival to the screen
+    inline static constexpr size_t ringSize = 256;
+    inline static constexpr uint32_t maxId = 0xFFFFFF;
+
+    static inline thread_local uint32_t current = 0;
+
+private:
+    std::array<Stamp, ringSize> m_ring;
+    std::atomic<uint32_t> m_head{0};
+    std::atomic<uint32_t> m_nextId{1};
+
+    std::atomic<bool> m_hasPhoneOffset{false};
+    // lowest arrival minus phone stamp, in milliseconds
+    std::atomic<int32_t> m_phoneOffset{0};
+
+    // from the previous stage, by stage but SENT
+    std::array<Histogram, numTraceStages - 1> m_stages;
+    // from RECEIVED to DRAWN
+    Histogram m_total;
+    // messages drawn whose arrival was overwritten in the ring
+    std::atomic<uint32_t> m_numLost{0};
+};
+
+/**
+ * Makes @p{id} the current message of the thread until the end of the scope
+ */
+class TraceScope {
+public:
+    explicit TraceScope(uint32_t id) { Tracer::setCurrent(id); }
+    ~TraceScope() { Tracer::setCurrent(0); }
+};
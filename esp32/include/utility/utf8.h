@@ -0,0 +1,10 @@
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+
+/**
+ * Returns the longest prefix of @p{str} of at most @p{maxSize} bytes which
+ * does not split a utf-8 sequence
+ */
+std::string_view truncateUTF8(std::string_view str, size_t maxSize);
@@ -1,6 +1,6 @@
 #pragma once
 
-#include "ArduinoJson.h"
+#include "model/message_store.h"
 #include "view/page/page.h"
 #include "view/text/scrollable_text.h"
 
@@ -28,9 +28,13 @@ protected:
 private:
     void updateScreenWithNewMessages();
 
-    void setUpTitle(std::vector<std::string> const&);
+    void setUpTitle();
 
-    void setUpMessages(std::vector<std::string> const&);
+    /**
+     * Sets the content of the view of the message equal to the focused
+     * message, read from the store
+     */
+    void showFocusedMessage();
 
     void setMessageFullScreen(std::unique_ptr<ScrollableText> const& pMsg);
 
@@ -38,26 +42,13 @@ private:
 
     void removeFocusFromMessage(std::unique_ptr<ScrollableText> const& pMsg);
 
-    std::string extractContent(std::string const& msg) {
-        JsonDocument doc;
-        DeserializationError error = deserializeJson(doc, msg);
-        if (error) {
-            ESP_LOGD(TAG, "Error '%s' when deserializing '%s'\n", error.c_str(),
-                     msg.c_str());
-            return "";
-        }
-
-        std::string source = doc["source"];
-        std::string sender = doc["sender"];
-        std::string content = doc["content"];
-
-        byte indendLevel = 5;
-        std::string spaces(indendLevel, ' ');
-        // return spaces + source + " from '" + sender + "' : " + content;
-        //  alternative: "source: " + source + "\nsender: '" + sender +
-        //  "'\ncontent : " + content;
-        return "source: " + source + "\nsender: '" + sender +
-               "'\ncontent : " + content;
+    void extractContent(model::MessageView const& msg, std::string& content) {
+        content = "source: ";
+        content += msg.m_app;
+        content += "\nsender: '";
+        content += msg.m_sender;
+        content += "'\ncontent : ";
+        content += msg.m_body;
     }
 
 private:
@@ -67,8 +58,15 @@ private:
 
 private:
     MessageNotificationPage();
-    std::array<std::unique_ptr<ScrollableText>, maxNumMessages> m_messages;
+    // the only view of a message, showing the focused one: the others are
+    // kept in the store and laid out when focused
+    std::unique_ptr<ScrollableText> m_message;
+    // content of the focused message, reused to avoid reallocations
+    std::string m_content;
     byte m_messagesSz;
+    // sequence number of the first message not shown yet, the message at
+    // index i of the list has sequence number m_seqNextMessage - 1 - i
+    uint32_t m_seqNextMessage;
     byte m_idxFocusedMessage;
     bool m_isFocused;
     TextArea* m_title;
@@ -8,6 +8,7 @@
 #include "view/image/image.h"
 #include "view/page/page.h"
 #include "view/screen/screen.h"
+#include "view/text/teleprompter.h"
 #include "view/text/text_area.h"
 #include "view/window.h"
 
@@ -29,12 +30,23 @@ protected:
 private:
     TranslationPage();
 
-    inline static std::string const commandName = "t";
+    /**
+     * Shows the transcript in place of the placeholder, if not already done
+     */
+    void showTranscript();
 
     inline static char const TAG[] = "TranslationPage";
 
 private:
+    // placeholder shown until the first translation arrives
     TextArea* m_text;
+    Teleprompter* m_transcript;
+
+    // id of the utterance whose tail is being received
+    int32_t m_idUtterance;
+    // the tails received do not follow the text shown, until the whole text
+    // of the utterance arrives
+    bool m_isOutOfSync;
 };
 
 }  // namespace view
\ No newline at end of file
@@ -5,6 +5,7 @@
 #include <SPI.h>
 #include <TFT_eSPI.h>
 
+#include "model/weather.h"
 #include "view/image/image.h"
 #include "view/page/page.h"
 #include "view/screen/screen.h"
@@ -32,13 +33,34 @@ protected:
     void drawOnScreen() override;
 
 private:
-    inline static std::string const commandName = "w";
-
     inline static char const TAG[] = "Weather";
 
+    // layouts kept by each text of the conditions
+    inline static constexpr size_t numLayoutsCached = 8;
+
+private:
+    // what the page shows, to redraw it only when it changes
+    struct Shown {
+        bool m_isEmpty;
+        model::Condition m_condition;
+        bool m_hasPrevious;
+        bool m_hasNext;
+
+        bool operator==(Shown const& other) const;
+        bool operator!=(Shown const& other) const { return !(*this == other); }
+    };
+
 private:
     WeatherPage();
 
+    Shown getShown() const;
+
+    /**
+     * Copies the forecast kept by the controller
+     * @return true if the location changed
+     */
+    bool readWeather();
+
     TextArea* m_txtWhenNoData;
     TextArea* m_location;
     TextArea* m_time;
@@ -46,15 +68,13 @@ private:
     TextArea* m_pressure;
     Image* m_leftArrow;
     Image* m_rightArrow;
-    std::unordered_map<std::string, Image*> m_mapIdToIcon;
+    // by interned id, see protocol::getIconId
+    std::array<Image*, protocol::numIcons> m_icons;
 
-    struct Condition {
-        std::string m_time;
-        std::string m_temperature;
-        std::string m_pressure;
-        std::string m_icon;
-    };
-    std::vector<Condition> m_conditions;
+    // copy of the forecast shown, see readWeather()
+    model::Weather m_weather;
     byte m_idxCurCondition;
+    // icon made visible last, unknownIcon if none
+    uint8_t m_iconShown;
 };
 }  // namespace view
\ No newline at end of file
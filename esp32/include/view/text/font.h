@@ -0,0 +1,112 @@
+#pragma once
+
+#include <cstdint>
+#include "fonts/bitmap_font.h"
+#include "view/tft.h"
+
+namespace view {
+enum class FontSize { SMALL, MEDIUM, LARGE };
+
+/**
+ * Draws text with a bitmap font kept in flash. Unlike the smooth fonts of
+ * TFT_eSPI, no metric is copied into the heap: glyphs are looked up with a
+ * binary search on their codepoint and their bitmaps are read in place.
+ */
+class Font {
+public:
+    explicit Font(fonts::BitmapFont const& font) : m_font(font) {}
+
+    /**
+     * Returns the font of the given size, MEDIUM being the one used by default
+     * by the texts on screen
+     */
+    static Font const& get(FontSize size);
+
+    /**
+     * Returns the glyph of @p{codepoint}, or nullptr if the font lacks it
+     */
+    fonts::Glyph const* findGlyph(uint32_t codepoint) const;
+
+    /**
+     * Returns the width in pixels of the null terminated UTF-8 string
+     * @p{str}, that is the sum of the advances of its glyphs
+     */
+    uint16_t textWidth(char const* str) const;
+
+    uint16_t getHeight() const { return m_font.m_yAdvance; }
+
+    /**
+     * Draws the glyph of @p{codepoint} with the cursor at (@p{x}, @p{y}),
+     * filling with @p{bg} the rest of its cell.
+     * @return the horizontal advance of the cursor
+     */
+    uint16_t drawGlyph(TFT_eSPI* tft,
+                       int16_t x,
+                       int16_t y,
+                       uint32_t codepoint,
+                       uint16_t fg,
+                       uint16_t bg) const;
+
+    /**
+     * Draws the null terminated UTF-8 string @p{str} on a single line.
+     * @return the horizontal advance of the cursor
+     */
+    uint16_t drawText(TFT_eSPI* tft,
+                      int16_t x,
+                      int16_t y,
+                      char const* str,
+                      uint16_t fg,
+                      uint16_t bg) const;
+
+    /**
+     * Returns the bytes of a band of @p{width} pixels and the height of a
+     * line, see renderText
+     */
+    size_t getBandSize(uint16_t width) const {
+        return (size_t{width} * m_font.m_yAdvance + 1) / 2;
+    }
+
+    /**
+     * Renders the null terminated UTF-8 string @p{str} on a single line into
+     * @p{band}, the alpha of its pixels on 4 bits packed as in the bitmaps,
+     * so that the band can be drawn again without looking the glyphs up.
+     * @param width in pixels of the band, the text beyond it is cut
+     * @return the width in pixels of the text rendered, ink included
+     */
+    uint16_t renderText(char const* str, uint8_t* band, uint16_t width) const;
+
+    /**
+     * Draws the first @p{numColumns} columns of @p{band}, rendered by
+     * renderText, with its top left corner at (@p{x}, @p{y})
+     * @param width in pixels of the band
+     */
+    void drawBand(TFT_eSPI* tft,
+                  int16_t x,
+                  int16_t y,
+                  uint8_t const* band,
+                  uint16_t width,
+                  uint16_t numColumns,
+                  uint16_t fg,
+                  uint16_t bg) const;
+
+    /**
+     * Decodes the UTF-8 sequence at @p{str}, moving @p{str} past it.
+     * @return the codepoint, or 0 at the end of the string
+     */
+    static uint32_t decodeUTF8(char const*& str);
+
+private:
+    uint8_t getAlpha(fonts::Glyph const& glyph, int16_t gx, int16_t gy) const;
+
+private:
+    inline static char const TAG[] = "Font";
+
+    // pixels composed before being pushed to the display, a glyph taller than
+    // the buffer is pushed in bands
+    inline static constexpr size_t numBufferPixels = 512;
+    inline static uint16_t buffer[numBufferPixels];
+
+private:
+    fonts::BitmapFont const& m_font;
+};
+}  // namespace view
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace view {
+/**
+ * Splits an UTF-8 encoded text into lines no wider than a given width.
+ * Lines are broken on spaces, or on '\n', and only tokens longer than a whole
+ * line are broken between two characters. The result is a compact index of
+ * byte offsets and widths, so that the text needs to be measured only once,
+ * a glyph at a time.
+ */
+class LineBreaker {
+public:
+    struct Line {
+        // byte offset of the first character of the line
+        uint32_t m_beg;
+        // number of bytes in the line, trailing spaces and '\n' excluded
+        uint16_t m_len;
+        // width of the line in pixels
+        uint16_t m_width;
+
+        uint32_t end() const { return m_beg + m_len; }
+    };
+
+    /**
+     * Function returning the width in pixels of a null terminated string,
+     * the sum of the widths of its glyphs
+     */
+    using Measure = std::function<uint16_t(char const*)>;
+
+    LineBreaker(Measure measure, uint16_t maxWidth = 0)
+        : m_measure(measure), m_maxWidth(maxWidth) {}
+
+    void setMaxWidth(uint16_t maxWidth) { m_maxWidth = maxWidth; }
+
+    uint16_t getMaxWidth() const { return m_maxWidth; }
+
+    /**
+     * Lays out @p{text} from the byte @p{beg}, appending the resulting lines to
+     * @p{lines} until either the text is over or @p{lines} holds
+     * @p{maxNumLines} lines.
+     * @param text to lay out
+     * @param beg byte offset from which to start, it must be the beginning of
+     * a line
+     * @param lines line index to extend
+     * @param maxNumLines maximum number of lines @p{lines} can hold
+     * @return the byte offset of the first character that did not fit, or
+     * text.size() if the whole text has been laid out
+     */
+    size_t breakLines(std::string const& text,
+                      size_t beg,
+                      std::vector<Line>& lines,
+                      size_t maxNumLines);
+
+    /**
+     * Computes the line starting at the byte @p{beg} of @p{text}.
+     * @param text to lay out
+     * @param beg byte offset of the first character of the line
+     * @param next set to the byte offset where the following line begins
+     * @return the line starting at @p{beg}
+     */
+    Line nextLine(std::string const& text, size_t beg, size_t& next);
+
+    /**
+     * Returns the number of bytes of the UTF-8 sequence starting with
+     * @p{firstByte}, or 0 if it is not a valid leading byte.
+     */
+    static uint8_t getUTF8SequenceLength(unsigned char firstByte);
+
+private:
+    // width of the glyph of @p{len} bytes at the byte @p{i} of @p{text}
+    uint16_t measure(std::string const& text, size_t i, size_t len);
+
+    static size_t skipSpaces(std::string const& text, size_t i) {
+        while (i < text.size() && text[i] == ' ')
+            i++;
+        return i;
+    }
+
+private:
+    inline static char const TAG[] = "LineBreaker";
+
+private:
+    Measure m_measure;
+    uint16_t m_maxWidth;
+};
+}  // namespace view
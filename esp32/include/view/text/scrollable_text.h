@@ -3,8 +3,14 @@
 #include "view/image/image.h"
 #include "view/text/text.h"
 #include "view/text/text_area.h"
+#include "view/text/text_document.h"
 
 namespace view {
+/**
+ * Text of arbitrary length shown one page at a time. The text is stored once
+ * in a TextDocument and only the visible page is materialized into a single
+ * TextArea, which is reused for every page.
+ */
 class ScrollableText : public Text, public View {
 public:
     ScrollableText(RectType frame, View* superiorView, std::string const&);
@@ -13,12 +19,13 @@ public:
 
     size_t appendContent(std::string const& content) override;
 
+    /**
+     * A ScrollableText never runs out of space as new pages are added on
+     * demand, hence no character is ever wrapped nor discarded.
+     */
     void wrapTextVertically(bool wrap) override;
 
-    bool isEmpty() override {
-        auto const& pTextArea = m_textFrames[0];
-        return !pTextArea || pTextArea->isEmpty();
-    }
+    bool isEmpty() override { return m_document.isEmpty(); }
 
     void onEvent(SwipeClockwise const&) override;
 
@@ -38,24 +45,25 @@ protected:
 private:
     void placeComponents();
 
-    size_t handleExceedingText(std::string const& content, size_t beg);
+    /**
+     * Sets the content of the TextArea equal to the page at index @p{idx}
+     */
+    void materializePage(size_t idx);
 
 private:
-    inline static constexpr byte maxNumText = 3;
-
     inline static char const TAG[] = "ScrollableText";
 
 private:
     // use unique_ptr to take ownership of the TextArea
-    std::array<std::unique_ptr<TextArea>, maxNumText> m_textFrames;
-    byte m_textFramesSz;
-    byte m_idxCurFrame;
-    bool m_wrapText;
-    std::function<void(std::string const&)> m_onExceedingText;
+    std::unique_ptr<TextArea> m_textArea;
+    TextDocument m_document;
+    size_t m_idxCurPage;
+    // bytes of the visible page, reused to avoid reallocations
+    std::string m_page;
 
     // indicators when the text exceeds the frame
     Image* m_leftArrow;
     Image* m_rightArrow;
     bool m_showArrows;
 };
-}  // namespace view
\ No newline at end of file
+}  // namespace view
@@ -0,0 +1,210 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include "view/text/font.h"
+#include "view/text/line_breaker.h"
+#include "view/text/text.h"
+#include "view/tft.h"
+#include "view/view.h"
+
+namespace view {
+/**
+ * Text streamed line after line: new text is appended at the bottom and, once
+ * the frame is full, the older lines scroll up and out of the frame.
+ *
+ * The lines are kept in a ring of row slots. When the display is in its native
+ * portrait orientation, the frame is the vertical scrolling area of the
+ * ILI9341 and a scroll only moves the start address of that area, so a new
+ * line costs the redraw of its own band. In any other orientation, as the
+ * landscape rotation 3 of the device, the controller scrolls along the wrong
+ * axis: each slot keeps its row rendered in a strip buffer, the alpha of its
+ * pixels on 4 bits, and a scroll renders only the new row, the others being
+ * pushed again from their strips at their new position. Every row in the
+ * frame is still sent to the display, but only as wide as its text or the
+ * text it replaces, thus a short line costs less than the width of the
+ * frame.
+ *
+ * The text of the last utterance is kept so that its tail can be revised, as
+ * it happens to the partial results of a speech recognizer: only the lines
+ * following the stable prefix are laid out and drawn again.
+ */
+class Teleprompter : public Text, public View {
+public:
+    Teleprompter(RectType frame, View* superiorView);
+
+    ~Teleprompter();
+
+    /**
+     * If @p{content} shares a prefix with the current utterance, it replaces
+     * the utterance redrawing only the lines after the common prefix,
+     * otherwise @p{content} starts a new utterance below the text already
+     * shown.
+     * @return the number of characters in @p{content}
+     */
+    size_t setContent(std::string const& content) override;
+
+    /**
+     * Appends @p{content} at the end of the current utterance, scrolling up
+     * the older lines when the frame is full.
+     * @return the number of characters in @p{content}
+     */
+    size_t appendContent(std::string const& content) override;
+
+    /**
+     * Starts a new utterance on a new line. The lines of the previous
+     * utterances cannot be edited anymore.
+     */
+    void startUtterance();
+
+    /**
+     * Keeps the first @p{numStableBytes} bytes of the current utterance and
+     * replaces the rest with @p{tail}. Only the lines from the one holding
+     * the first replaced byte onwards are laid out again, and only the ones
+     * whose bytes changed are redrawn. Lines already scrolled out of the frame
+     * are never edited.
+     * @param numStableBytes bytes of the utterance left untouched, capped to
+     * the size of the utterance
+     * @param tail new text following the stable prefix
+     * @return the number of bytes of the utterance actually kept
+     */
+    size_t editTail(size_t numStableBytes, std::string const& tail);
+
+    size_t getUtteranceSize() const { return m_utterance.size(); }
+
+    /**
+     * Rows drawn since the creation of this Teleprompter
+     */
+    uint32_t getNumRowsDrawn() const { return m_numRowsDrawn; }
+
+    /**
+     * Rows laid out in pixels since the creation of this Teleprompter, the
+     * ones drawn again from their strip buffer excluded
+     */
+    uint32_t getNumRowsRendered() const { return m_numRowsRendered; }
+
+    /**
+     * Bytes of pixels sent to the display since the creation of this
+     * Teleprompter, 16 bits per pixel
+     */
+    uint32_t getNumPixelBytesPushed() const { return m_numPixelBytesPushed; }
+
+    /**
+     * A Teleprompter always scrolls the text, no character is ever wrapped
+     * from the top of the frame.
+     */
+    void wrapTextVertically(bool wrap) override;
+
+    bool isEmpty() override { return m_numUsedRows == 0; }
+
+    void clearFromScreen() override;
+
+    bool resize(Size const& newSize) override;
+
+    bool move(Coordinates const& coordinates) override;
+
+protected:
+    void drawOnScreen() override;
+
+private:
+    /**
+     * Computes the rows fitting the frame and whether the controller can
+     * scroll them, dropping the text laid out so far.
+     */
+    void placeRows();
+
+    size_t replaceTail(size_t numStableBytes, char const* data, size_t size);
+
+    /**
+     * Lays out the current utterance again from the used row at index
+     * @p{idxRow}, whose first byte is at offset @p{beg} of the utterance
+     */
+    void layOutUtterance(size_t idxRow, size_t beg);
+
+    /**
+     * Sets the bytes of the line in @p{slot}, marking it to be redrawn only if
+     * they changed
+     */
+    void setRow(size_t slot, char const* data, size_t size);
+
+    /**
+     * Starts a new empty line at the bottom, scrolling up the others if the
+     * frame is full.
+     */
+    void newRow();
+
+    size_t getSlotOfRow(size_t idxRow) const {
+        return (m_idxTopSlot + idxRow) % m_rows.size();
+    }
+
+    size_t getLastSlot() const { return getSlotOfRow(m_numUsedRows - 1); }
+
+    /**
+     * Sets the first line of the vertical scrolling area shown at the top of
+     * the frame. Only valid when the controller scrolls the frame.
+     */
+    void setScrollStart(uint16_t line);
+
+    /**
+     * Restores the identity between the lines written and the lines shown
+     */
+    void resetScroll();
+
+    // parameters of the controller commands are sent most significant byte
+    // first
+    void writeData16(uint16_t data);
+
+private:
+    inline static char const TAG[] = "Teleprompter";
+
+    // commands of the ILI9341 controlling the vertical scrolling
+    inline static uint8_t const VSCRDEF = 0x33;
+    inline static uint8_t const VSCRSADD = 0x37;
+
+    // lines of the controller memory along the scrolling direction
+    inline static uint16_t const numMemoryLines = 320;
+
+private:
+    TFT_eSPI* m_tft;
+    Font const& m_font;
+    uint16_t const m_fgColour;
+    uint16_t const m_bgColour;
+    uint16_t m_charHeight;
+
+    LineBreaker m_lineBreaker;
+
+    // ring of row slots, each holding the bytes of a line
+    std::vector<std::string> m_rows;
+    // rows whose text changed since drawn
+    std::vector<bool> m_isRowDirty;
+    // every row to be drawn again, at a new position or over a cleared frame
+    bool m_isFrameMoved;
+    // without the hardware scroll, the row of each slot rendered by
+    // Font::renderText, a strip of m_stripSize bytes, and the width of its
+    // text
+    std::vector<uint8_t> m_strips;
+    size_t m_stripSize;
+    std::vector<uint16_t> m_stripWidths;
+    // width of the text drawn on each line of the frame, as laid out in the
+    // controller memory, the part to clear when the line is drawn again
+    std::vector<uint16_t> m_drawnWidths;
+    // slot of the line shown at the top of the frame
+    size_t m_idxTopSlot;
+    size_t m_numUsedRows;
+
+    bool m_hasHardwareScroll;
+    bool m_isScrollPending;
+
+    // text of the last utterance, which can still be edited
+    std::string m_utterance;
+    // byte offset in m_utterance of the first character of each slot, valid
+    // for the rows of the utterance only
+    std::vector<uint32_t> m_rowOffsets;
+    // number of rows at the bottom holding the utterance
+    size_t m_numUtteranceRows;
+
+    uint32_t m_numRowsDrawn;
+    uint32_t m_numRowsRendered;
+    uint32_t m_numPixelBytesPushed;
+};
+}  // namespace view
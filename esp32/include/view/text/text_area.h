@@ -1,5 +1,7 @@
 #pragma once
 
+#include "view/text/font.h"
+#include "view/text/line_breaker.h"
 #include "view/text/text.h"
 #include "view/tft.h"
 #include "view/view.h"
@@ -21,7 +23,7 @@ public:
 
     size_t appendContent(std::string const& content) override;
 
-    void wrapTextVertically(bool wrap) override { m_wrap = wrap; }
+    void wrapTextVertically(bool wrap) override;
 
     bool isEmpty() override { return m_currentFrame.size() == 0; }
 
@@ -31,21 +33,53 @@ public:
 
     bool resize(Size const& newSize) override;
 
+    /**
+     * Sets the font used to draw this TextArea, MEDIUM by default, laying out
+     * the current content again
+     */
+    void setFont(FontSize size);
+
+    /**
+     * Keeps the layout of the last @p{capacity} distinct contents set, so that
+     * setting one of them again, e.g. when going back and forth between pages
+     * of data, does not lay it out again. No layout is kept by default.
+     */
+    void setLayoutCacheCapacity(size_t capacity);
+
+    struct LayoutCacheStats {
+        // content set equal to the current one: neither laid out nor drawn
+        // again
+        uint32_t m_numUnchanged{0};
+        // layout restored from the cache
+        uint32_t m_numHits{0};
+        // content laid out
+        uint32_t m_numMisses{0};
+    };
+
+    LayoutCacheStats const& getLayoutCacheStats() const {
+        return m_layoutCacheStats;
+    }
+
+    /**
+     * Returns the maximum number of lines fitting the frame of this TextArea
+     */
+    size_t getMaxNumLines() { return getNumRowsWorstCase(); }
+
 protected:
     void drawOnScreen() override;
 
 private:
-    void prepareLineBuffer();
+    void prepareLineIndex();
 
-    uint16_t getMinCharWidth() { return m_tft->textWidth("i"); }
+    /**
+     * Rebuilds the glyphs to print starting from the line at index
+     * @p{idxFstLine}, the glyphs of the lines before are left untouched.
+     */
+    void updateFrame(size_t idxFstLine);
 
-    uint16_t getNumRowsWorstCase() { return getSize().m_height / m_charHeight; }
+    uint16_t getMinCharWidth() { return m_font->textWidth("i"); }
 
-    byte getNumColumnsWorstCase() {
-        auto w = getMinCharWidth();
-        assert(w > 0 && "minimum char width cannot be zero");
-        return getSize().m_width / w;
-    }
+    uint16_t getNumRowsWorstCase() { return getSize().m_height / m_charHeight; }
 
     size_t getNumCharsWorstCase() {
         auto frameSz = getSize();
@@ -56,11 +90,6 @@ private:
                getNumRowsWorstCase();
     }
 
-    byte getNumBytesForALineWorstCase() {
-        // 4 because an unicode character can be encoded in at most 4 bytes
-        return getNumColumnsWorstCase() * 4;
-    }
-
 public:
     static std::string getUTF8Sequence(std::string const& str, size_t idx);
 
@@ -119,55 +148,32 @@ private:
     void hideGlyph(char const* glyph);
     void printGlyph(char const* glyph, uint16_t fg, uint16_t bg);
     void hide(Frame const& frame, uint32_t beg);
-    bool overflowOnX(std::string const& glyph, char const* line) {
-        auto frameSz = getSize();
-        auto frameCoordinates = getCoordinates();
-        char buf[strlen(line) + glyph.length() + 1];
-        buf[0] = '\0';
-        strcpy(buf, line);
-        strcat(buf, glyph.c_str());
-        uint16_t xCursorIfAddingTheGlyph =
-            frameCoordinates.m_x + m_tft->textWidth(buf);
-        ESP_LOGD(TAG, "cursorX if the glyph '%s' was added: %u", glyph.c_str(),
-                 xCursorIfAddingTheGlyph);
-        return xCursorIfAddingTheGlyph > frameCoordinates.m_x + frameSz.m_width;
-    }
-
-    bool overFlowOnY(std::string const& glyph, Coordinates cursorCoordinates) {
-        auto frameSz = getSize();
-        auto frameCoordinates = getCoordinates();
-        return cursorCoordinates.m_y + m_tft->fontHeight() >
-               frameCoordinates.m_y + frameSz.m_height;
-    }
-
-    bool beginningOfTheLine(Coordinates cursorCoordinates) {
-        auto frameCoordinates = getCoordinates();
-        return cursorCoordinates.m_x == frameCoordinates.m_x;
-    }
-
+    // forget the content set and the layouts kept, after a change making them
+    // no longer valid
+    void invalidateLayouts();
     // compute the coordinates of the center based on the text stored in this
     // TextArea
     Coordinates center();
 
-    void restoreLine(char* line);
-
 private:
     inline static char const TAG[] = "Text";
 
-    inline static bool isFontAlreadyLoaded = false;
-
 private:
-    // saved cursor coordinates to know where starting inserting new characters,
-    // useful when content is appended as the cursor is not restored to the
-    // frame's coordinates
-    Coordinates m_cursorCoordinatesAfterAddingTheLastCharacter;
-
     // saved cursor coordinates of the last character printed, useful when
     // clearing the screen to know where to set the cursor
     Coordinates m_cursorCoordinatesFirstCharacterPrinted;
 
-    // line saved, useful when appending text to restore the last line
-    std::unique_ptr<char[]> m_curLine;
+    // bytes currently laid out in this TextArea
+    std::string m_text;
+
+    // line index of m_text: appending text re-lays out only the last line, and
+    // sizing or centering the text does not need to measure it again
+    std::vector<LineBreaker::Line> m_lines;
+
+    LineBreaker m_lineBreaker;
+
+    // index in m_currentFrame of the first glyph of the last line
+    size_t m_idxFstGlyphLastLine;
 
     Frame m_currentFrame;
 
@@ -177,7 +183,42 @@ private:
     bool m_center;
     RectType m_reference;
 
-    int const m_font;
+    // hash and size of the content last set and the number of its bytes
+    // accepted, to recognize the same content set again before comparing
+    // its bytes
+    struct ContentKey {
+        uint32_t m_hash;
+        size_t m_size;
+        size_t m_numBytesAccepted;
+    };
+
+    bool m_hasContentKey;
+    ContentKey m_contentKey;
+    // the content last set, valid with m_contentKey
+    std::string m_content;
+
+    struct Layout {
+        ContentKey m_key;
+        // the content set, the text laid out being only what fit of it
+        std::string m_content;
+        std::string m_text;
+        std::vector<LineBreaker::Line> m_lines;
+        // value of m_layoutCacheClock when last used, the least recently used
+        // layout is evicted
+        uint32_t m_lastUse;
+    };
+
+    std::vector<Layout> m_layoutCache;
+    size_t m_layoutCacheCapacity;
+    uint32_t m_layoutCacheClock;
+    LayoutCacheStats m_layoutCacheStats;
+
+    // true when the screen shows the current frame, which is not drawn again
+    // unless an overlapping area has been cleared in the meantime
+    bool m_isFrameDrawn;
+    uint32_t m_numClearsAtDraw;
+
+    Font const* m_font;
     TFT_eSPI* m_tft;
     uint16_t const m_fgColour;
     uint16_t const m_bgColour;
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include "view/text/line_breaker.h"
+
+namespace view {
+/**
+ * Text stored once and split in pages, each holding at most a fixed number of
+ * lines of a fixed width. Page boundaries are computed lazily, only when a page
+ * is requested, and kept in a page index, so that going back to a page already
+ * visited does not lay out the text preceding it again.
+ */
+class TextDocument {
+public:
+    TextDocument(LineBreaker::Measure measure)
+        : m_lineBreaker(measure),
+          m_numLinesPerPage{0},
+          m_pages{0},
+          m_isIndexComplete{false} {}
+
+    /**
+     * Replaces the text of this TextDocument, invalidating the page index
+     */
+    void setText(std::string const& text);
+
+    /**
+     * Appends @p{text} at the end of this TextDocument. Pages already indexed
+     * are left untouched as appending cannot move their boundaries.
+     */
+    void append(std::string const& text);
+
+    /**
+     * Sets the geometry of a page, invalidating the page index if it changed.
+     * @param lineWidth maximum width in pixels of a line
+     * @param numLinesPerPage maximum number of lines in a page
+     */
+    void setLayout(uint16_t lineWidth, size_t numLinesPerPage);
+
+    bool isEmpty() const { return m_text.empty(); }
+
+    /**
+     * Returns true iff the page at index @p{idx} exists, indexing the pages
+     * up to it if not already done.
+     */
+    bool hasPage(size_t idx);
+
+    /**
+     * Copies into @p{out} the bytes of the page at index @p{idx}, or clears
+     * @p{out} if the page does not exist.
+     */
+    void getPage(size_t idx, std::string& out);
+
+    size_t getNumIndexedPages() const { return m_pages.size(); }
+
+private:
+    /**
+     * Lays out the last indexed page to find where the next one begins.
+     * @return true iff a new page has been indexed
+     */
+    bool indexNextPage();
+
+    void resetIndex() {
+        m_pages.assign(1, 0);
+        m_isIndexComplete = false;
+    }
+
+private:
+    inline static char const TAG[] = "TextDocument";
+
+private:
+    std::string m_text;
+    LineBreaker m_lineBreaker;
+    size_t m_numLinesPerPage;
+
+    // byte offset of the first character of each page indexed so far
+    std::vector<uint32_t> m_pages;
+
+    // true when the last indexed page reaches the end of the text
+    bool m_isIndexComplete;
+
+    // lines of the page being indexed, reused to avoid reallocations
+    std::vector<LineBreaker::Line> m_lines;
+};
+}  // namespace view
@@ -1,31 +1,56 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <string>
+#include "utility/tracer.h"
 
 namespace view {
 
 enum class UIEventTag { RemoteProcedure };
 
 /**
- * Abstract class representing events related to the UI
+ * Order in which the events are handled: the URGENT ones before all the NORMAL
+ * ones waiting, e.g. a call before a burst of messages. The gestures of the
+ * touch sensor go in between, ahead of the messages but never of a call
+ */
+enum class UIEventPriority { URGENT, GESTURE, NORMAL };
+inline constexpr size_t numUIEventPriorities = 3;
+
+/**
+ * Abstract class representing events related to the UI. An event created
+ * while a message of the phone is handled carries its trace id (see Tracer)
  */
 class UIEvent {
 public:
-    UIEvent(UIEventTag tag) : m_tag(tag) {}
+    UIEvent(UIEventTag tag,
+            UIEventPriority priority = UIEventPriority::NORMAL)
+        : m_tag(tag),
+          m_priority(priority),
+          m_traceId(Tracer::getCurrent()) {}
 
     virtual ~UIEvent() {}
 
     UIEventTag getTag() { return m_tag; }
 
+    UIEventPriority getPriority() { return m_priority; }
+
+    // 0 if the event does not come from a message of the phone
+    uint32_t getTraceId() { return m_traceId; }
+
 private:
     UIEventTag m_tag;
+    UIEventPriority m_priority;
+    uint32_t m_traceId;
 };
 
 class RemoteProcedure : public UIEvent {
 public:
-    RemoteProcedure(std::function<void()> callback)
-        : UIEvent::UIEvent(UIEventTag::RemoteProcedure), m_callback(callback) {}
+    RemoteProcedure(std::function<void()> callback,
+                    UIEventPriority priority = UIEventPriority::NORMAL)
+        : UIEvent::UIEvent(UIEventTag::RemoteProcedure, priority),
+          m_callback(callback) {}
 
     void call() { m_callback(); }
 
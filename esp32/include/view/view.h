@@ -2,6 +2,7 @@
 
 #include <Arduino.h>
 #include "input/input_manager.h"
+#include "utility/touch_tracer.h"
 #include "view/coordinates.h"
 #include "view/rectangular_type.h"
 #include "view/remote_responder.h"
@@ -22,8 +23,8 @@ public:
          View* superiorView,
          std::string const& tag,
          bool isVisible = true)
-        : m_frame(frame),
-          m_parentView(nullptr),
+        : m_parentView(nullptr),
+          m_frame(frame),
           m_tag(tag),
           m_isVisible(isVisible) {
         if (superiorView != nullptr) {
@@ -36,6 +37,8 @@ public:
     void draw() {
         if (m_isVisible) {
             drawOnScreen();
+            // the transfers to the display are over, see TouchTracer
+            TouchTracer::getInstance()->stampTransfer();
         }
     }
 
@@ -45,6 +48,7 @@ public:
         auto size = getSize();
         tft->fillRect(coordinates.m_x, coordinates.m_y, size.m_width,
                       size.m_height, TFT_BLACK);
+        recordClear(m_frame);
     }
 
     /**
@@ -240,9 +244,32 @@ protected:
      */
     void detachAll() { m_subViews.clear(); }
 
+    /**
+     * Records that the area @p{rect} of the screen has been cleared, so that
+     * views skipping the redraw of unchanged content know it has been erased
+     */
+    static void recordClear(RectType const& rect);
+
+    /**
+     * Returns the number of clears recorded so far
+     */
+    static uint32_t getNumClears() { return numClears; }
+
+    /**
+     * Returns true iff an area overlapping @p{rect} may have been cleared
+     * since @p{numClearsBefore} clears had been recorded
+     */
+    static bool isClearedSince(RectType const& rect, uint32_t numClearsBefore);
+
 private:
     inline static char const TAG[] = "View";
 
+    // only the last clears are remembered, older ones are assumed to overlap
+    // any area
+    inline static constexpr size_t numRecentClears = 8;
+    inline static RectType recentClears[numRecentClears];
+    inline static uint32_t numClears = 0;
+
 private:
     View* m_parentView;
 
@@ -0,0 +1,99 @@
+#pragma once
+
+// The GPIOs of Arduino for the native environment: the level of a pin is set
+// by the fakes of the devices wired to it, e.g. the ALERT line of the CAP1203,
+// and a falling edge calls the interrupt attached to the pin
+
+#include <array>
+#include <cassert>
+#include <cstdarg>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include "esp_log.h"
+
+#define IRAM_ATTR
+#define LOW 0x0
+#define HIGH 0x1
+#define INPUT_PULLUP 0x05
+#define FALLING 0x02
+
+using byte = uint8_t;
+
+// the serial port is the standard output
+struct HardwareSerial {
+    int printf(char const* format, ...) {
+        va_list args;
+        va_start(args, format);
+        int size = vprintf(format, args);
+        va_end(args);
+        return size;
+    }
+};
+
+inline HardwareSerial Serial;
+
+namespace native {
+struct Gpio {
+    static constexpr size_t numPins = 40;
+
+    std::mutex m_mutex;
+    // pulled up until driven
+    std::array<int, numPins> m_levels;
+    std::array<void (*)(void*), numPins> m_handlers{};
+    std::array<void*, numPins> m_args{};
+
+    Gpio() { m_levels.fill(HIGH); }
+
+    // never destroyed, the tasks reading the pins outliving the tests
+    static Gpio& getInstance() {
+        static Gpio* instance = new Gpio();
+        return *instance;
+    }
+};
+
+/**
+ * Drives @p{pin} to @p{level}, calling its interrupt on a falling edge
+ */
+inline void setPinLevel(uint8_t pin, int level) {
+    Gpio& gpio = Gpio::getInstance();
+    void (*handler)(void*) = nullptr;
+    void* arg = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(gpio.m_mutex);
+        if (gpio.m_levels[pin] == HIGH && level == LOW) {
+            handler = gpio.m_handlers[pin];
+            arg = gpio.m_args[pin];
+        }
+        gpio.m_levels[pin] = level;
+    }
+    if (handler)
+        handler(arg);
+}
+}  // namespace native
+
+inline void pinMode(uint8_t, uint8_t) {}
+
+inline int digitalRead(uint8_t pin) {
+    native::Gpio& gpio = native::Gpio::getInstance();
+    std::lock_guard<std::mutex> lock(gpio.m_mutex);
+    return gpio.m_levels[pin];
+}
+
+inline uint8_t digitalPinToInterrupt(uint8_t pin) {
+    return pin;
+}
+
+inline void attachInterruptArg(uint8_t pin,
+                               void (*handler)(void*),
+                               void* arg,
+                               int) {
+    native::Gpio& gpio = native::Gpio::getInstance();
+    std::lock_guard<std::mutex> lock(gpio.m_mutex);
+    gpio.m_handlers[pin] = handler;
+    gpio.m_args[pin] = arg;
+}
+
+// the fakes answer at once
+inline void delay(uint32_t) {}
@@ -0,0 +1,3 @@
+#pragma once
+
+// SPI of Arduino for the native environment, the display being a fake
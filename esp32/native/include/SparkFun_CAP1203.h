@@ -0,0 +1,82 @@
+#pragma once
+
+// The CAP1203 touch sensor of SparkFun for the native environment, scripted
+// by the tests: CAP1203::touch() sets the pads touched, asserting the ALERT
+// line as the sensor does
+
+#include <cstdint>
+#include <mutex>
+#include "Arduino.h"
+
+enum CAP1203_Register : uint8_t {
+    SENSOR_INPUT_STATUS = 0x03,
+    REPEAT_RATE_ENABLE = 0x28,
+    CONFIG_2 = 0x44,
+};
+
+#define SENSITIVITY_2X 0x60
+
+class CAP1203 {
+public:
+    // GPIO the ALERT pin of the sensor is wired to on the board
+    static constexpr uint8_t alertPin = 27;
+
+    bool begin() { return true; }
+
+    void setSensitivity(uint8_t sensitivity) { m_sensitivity = sensitivity; }
+
+    uint8_t getSensitivity() { return m_sensitivity; }
+
+    void setInterruptEnabled() {}
+
+    /**
+     * Releases ALERT, the status keeping the pads still touched
+     */
+    void clearInterrupt() {
+        Pads& pads = Pads::getInstance();
+        {
+            std::lock_guard<std::mutex> lock(pads.m_mutex);
+            pads.m_latched = pads.m_touched;
+        }
+        native::setPinLevel(alertPin, HIGH);
+    }
+
+    uint8_t readRegister(CAP1203_Register reg) {
+        Pads& pads = Pads::getInstance();
+        std::lock_guard<std::mutex> lock(pads.m_mutex);
+        return reg == SENSOR_INPUT_STATUS ? pads.m_latched : 0;
+    }
+
+    void writeRegister(CAP1203_Register, uint8_t) {}
+
+    /**
+     * Sets the pads touched, bit i for pad i: a touch or a release asserts
+     * ALERT, and the status latches the pads touched until cleared
+     */
+    static void touch(uint8_t touched) {
+        Pads& pads = Pads::getInstance();
+        {
+            std::lock_guard<std::mutex> lock(pads.m_mutex);
+            if (touched == pads.m_touched)
+                return;
+            pads.m_touched = touched;
+            pads.m_latched |= touched;
+        }
+        native::setPinLevel(alertPin, LOW);
+    }
+
+private:
+    // the pads of the sensors, shared by the test and the one of the device
+    struct Pads {
+        std::mutex m_mutex;
+        uint8_t m_touched{0};
+        uint8_t m_latched{0};
+
+        static Pads& getInstance() {
+            static Pads* instance = new Pads();
+            return *instance;
+        }
+    };
+
+    uint8_t m_sensitivity{0};
+};
@@ -0,0 +1,57 @@
+#pragma once
+
+// The display of TFT_eSPI for the native environment: nothing is shown, the
+// pixels and the bytes of the commands sent are counted instead, e.g. to
+// measure what a view pushes to the display
+
+#include <cstdint>
+#include "Arduino.h"
+
+#define TFT_BLACK 0x0000
+#define TFT_LIGHTGREY 0xD69A
+#define TFT_WHITE 0xFFFF
+
+class TFT_eSPI {
+public:
+    void begin() {}
+
+    void setRotation(uint8_t rotation) { m_rotation = rotation; }
+
+    uint8_t getRotation() { return m_rotation; }
+
+    void fillScreen(uint32_t) { m_numPixels += 320 * 240; }
+
+    void startWrite() {}
+
+    void endWrite() {}
+
+    void writecommand(uint8_t) { m_numCommandBytes++; }
+
+    void writedata(uint8_t) { m_numCommandBytes++; }
+
+    void fillRect(int32_t, int32_t, int32_t w, int32_t h, uint32_t) {
+        m_numPixels += w * h;
+    }
+
+    void drawRect(int32_t, int32_t, int32_t w, int32_t h, uint32_t) {
+        m_numPixels += 2 * (w + h);
+    }
+
+    void drawPixel(int32_t, int32_t, uint32_t) { m_numPixels++; }
+
+    void pushImage(int32_t, int32_t, int32_t w, int32_t h, uint16_t*) {
+        m_numPixels += w * h;
+    }
+
+    uint16_t alphaBlend(uint8_t alpha, uint16_t fg, uint16_t bg) {
+        return alpha > 127 ? fg : bg;
+    }
+
+public:
+    // pixels written and bytes of the commands with their parameters
+    uint64_t m_numPixels{0};
+    uint64_t m_numCommandBytes{0};
+
+private:
+    uint8_t m_rotation{0};
+};
@@ -0,0 +1,10 @@
+#pragma once
+
+// I2C of Arduino for the native environment, where the fakes of the devices
+// answer without a bus
+
+struct TwoWire {
+    void begin() {}
+};
+
+inline TwoWire Wire;
@@ -0,0 +1,30 @@
+#pragma once
+
+// Logging of ESP-IDF for the native environment: the messages up to
+// NATIVE_LOG_LEVEL (1 errors, 2 warnings, 3 info, 4 debug) go to stderr
+
+#include <cstdarg>
+#include <cstdio>
+
+#ifndef NATIVE_LOG_LEVEL
+#define NATIVE_LOG_LEVEL 1
+#endif
+
+inline void esp_log_native(int level,
+                           char const* tag,
+                           char const* format,
+                           ...) {
+    if (level > NATIVE_LOG_LEVEL)
+        return;
+    va_list args;
+    va_start(args, format);
+    fprintf(stderr, "%c (%s) ", "?EWID"[level], tag);
+    vfprintf(stderr, format, args);
+    fputc('\n', stderr);
+    va_end(args);
+}
+
+#define ESP_LOGE(tag, ...) esp_log_native(1, tag, __VA_ARGS__)
+#define ESP_LOGW(tag, ...) esp_log_native(2, tag, __VA_ARGS__)
+#define ESP_LOGI(tag, ...) esp_log_native(3, tag, __VA_ARGS__)
+#define ESP_LOGD(tag, ...) esp_log_native(4, tag, __VA_ARGS__)
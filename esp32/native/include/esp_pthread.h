@@ -0,0 +1,22 @@
+#pragma once
+
+// Configuration of the pthreads of ESP-IDF for the native environment, where
+// the threads keep the defaults of the host
+
+#include <cstddef>
+
+struct esp_pthread_cfg_t {
+    size_t stack_size;
+    size_t prio;
+    bool inherit_cfg;
+    char const* thread_name;
+    int pin_to_core;
+};
+
+inline esp_pthread_cfg_t esp_pthread_get_default_config() {
+    return esp_pthread_cfg_t{0, 0, false, nullptr, -1};
+}
+
+inline int esp_pthread_set_cfg(esp_pthread_cfg_t const*) {
+    return 0;
+}
@@ -0,0 +1,16 @@
+#pragma once
+
+// esp_timer of ESP-IDF for the native environment
+
+#include <chrono>
+#include <cstdint>
+
+/**
+ * Returns the microseconds since the start of the process
+ */
+inline int64_t esp_timer_get_time() {
+    static auto const start = std::chrono::steady_clock::now();
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+               std::chrono::steady_clock::now() - start)
+        .count();
+}
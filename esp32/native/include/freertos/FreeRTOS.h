@@ -0,0 +1,15 @@
+#pragma once
+
+// FreeRTOS for the native environment: the ticks are milliseconds
+
+#include <cstdint>
+
+using BaseType_t = int;
+using TickType_t = uint32_t;
+
+#define pdFALSE 0
+#define pdTRUE 1
+#define portTICK_PERIOD_MS 1
+#define pdMS_TO_TICKS(ms) (static_cast<TickType_t>(ms))
+#define portMAX_DELAY UINT32_MAX
+#define portYIELD_FROM_ISR()
@@ -0,0 +1,47 @@
+#pragma once
+
+// The notifications of the tasks of FreeRTOS for the native environment,
+// between threads: the handle of a task is the one of its thread
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include "freertos/FreeRTOS.h"
+
+struct tskTaskControlBlock {
+    std::mutex m_mutex;
+    std::condition_variable m_notified;
+    uint32_t m_notificationValue{0};
+};
+
+using TaskHandle_t = tskTaskControlBlock*;
+
+inline TaskHandle_t xTaskGetCurrentTaskHandle() {
+    // never destroyed, an interrupt may notify the task as its thread exits
+    thread_local TaskHandle_t task = new tskTaskControlBlock();
+    return task;
+}
+
+inline void vTaskNotifyGiveFromISR(TaskHandle_t task,
+                                   BaseType_t* isHigherPriorityTaskWoken) {
+    {
+        std::lock_guard<std::mutex> lock(task->m_mutex);
+        task->m_notificationValue++;
+    }
+    task->m_notified.notify_one();
+    if (isHigherPriorityTaskWoken)
+        *isHigherPriorityTaskWoken = pdFALSE;
+}
+
+inline uint32_t ulTaskNotifyTake(BaseType_t clearCountOnExit,
+                                 TickType_t ticksToWait) {
+    TaskHandle_t task = xTaskGetCurrentTaskHandle();
+    std::unique_lock<std::mutex> lock(task->m_mutex);
+    task->m_notified.wait_for(lock, std::chrono::milliseconds{ticksToWait},
+                              [task]() { return task->m_notificationValue; });
+    uint32_t value = task->m_notificationValue;
+    if (value > 0)
+        task->m_notificationValue = clearCountOnExit ? 0 : value - 1;
+    return value;
+}
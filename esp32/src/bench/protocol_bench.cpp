@@ -0,0 +1,1114 @@
+/**
+ * Drives ConnectionManager over a LoopbackTransport with a scripted phone, and
+ * measures the messages processed per second and the latency from the write
+ * of the phone to the delivery to the observers in the main loop:
+ *
+ *   pio run -e native && .pio/build/native/program [numMessages]
+ *
+ * The phone speaks the binary protocol with compression, and mixes the kinds
+ * of writes the device gets: single frames, batches of partial transcripts,
+ * compressed translations and weather forecasts split into fragments.
+ *
+ * Then it floods the device with notifications, each costing the main loop
+ * the time of a redraw, and checks that a call written in the middle of the
+ * flood is delivered within callLatencyBound: the program fails otherwise.
+ *
+ * At last it prints the latencies traced stage by stage (see Tracer), the
+ * notifications being stamped with the time the phone wrote them.
+ *
+ * It also records and replays sessions (see SessionRecorder):
+ *
+ *   .pio/build/native/program record <trace>
+ *   .pio/build/native/program replay <trace> [speed]
+ *
+ * The first records the standard session, a navigation between the pages
+ * with messages arriving meanwhile, into the file <trace>; the second replays
+ * a trace, recorded here or on the device, <speed> times faster than
+ * recorded, and prints the frame times by event. The pages are not built on
+ * the host: a touch costs the main loop its dispatch only.
+ *
+ * And it measures the write amplification of the history of the messages
+ * (see MessageLog), appending messages to a log kept in the file <log>:
+ *
+ *   .pio/build/native/program history <log>
+ *
+ * and compares the binary frames with the JSON documents of the phones not
+ * speaking them (see json_fallback.h), by kind of message: the bytes on air
+ * and the time the device takes to decode them, JSON transcoded first.
+ *
+ *   .pio/build/native/program formats
+ *
+ * and, over the same messages, the ratio of the compression of the frames
+ * (see lz.h) and the time to decode them, per KB of the frame inflated:
+ *
+ *   .pio/build/native/program compression
+ *
+ * and replays the forecasts of a day, refreshed every 10 minutes, as the
+ * phone sends them: whole, or as deltas with a whole forecast every
+ * fullUpdateInterval updates. It prints the bytes of the updates, the
+ * allocations of the device applying them and the redraws of the weather
+ * page, and how long a device rebooted in the middle of the day shows a
+ * stale forecast (see model::Weather):
+ *
+ *   .pio/build/native/program weather
+ */
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <mutex>
+#include <new>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <ArduinoJson.h>
+#include <esp_timer.h>
+#include "ble/connection_manager.h"
+#include "ble/loopback_transport.h"
+#include "ble/remote_dispatcher.h"
+#include "model/message_log.h"
+#include "model/weather.h"
+#include "protocol/batch.h"
+#include "protocol/json_fallback.h"
+#include "protocol/lz.h"
+#include "protocol/reassembler.h"
+#include "protocol/wire.h"
+#include "storage/file_flash.h"
+#include "utility/session_recorder.h"
+#include "utility/session_replayer.h"
+#include "utility/tracer.h"
+#include "view/main_event_queue.h"
+#include "view/remote_responder.h"
+
+// the tests link the sources of the native environment, not the benchmark
+#ifndef PIO_UNIT_TESTING
+namespace {
+// payload of a packet with an MTU of 247
+constexpr size_t maxPacketSize = 244;
+// messages written and not delivered yet, as the link would allow
+constexpr size_t maxNumInFlight = 16;
+constexpr size_t defaultNumMessages = 20000;
+
+// time the main loop takes to draw an event in the flood, and the most a call
+// may wait: the event being drawn and the write being decoded when it arrives
+constexpr std::chrono::milliseconds eventCost{5};
+constexpr std::chrono::milliseconds callLatencyBound{20};
+constexpr size_t numFloodMessages = 400;
+
+// steps of the standard session, a touch or a message each, and the time
+// between two
+constexpr size_t numSessionSteps = 80;
+constexpr std::chrono::milliseconds sessionStepPeriod{100};
+// trace file, as large as the partition of the device
+constexpr size_t traceSectorSize = 4096;
+constexpr size_t numTraceSectors = 64;
+
+// history of the messages, as the partition of the device and the messages
+// retained by ConnectionManager
+constexpr size_t historySectorSize = 4096;
+constexpr size_t numHistorySectors = 48;
+constexpr size_t numHistoryRetained = 32;
+constexpr uint32_t numHistoryMessages = 20000;
+
+// decodings of each message of the corpus, timed together
+constexpr uint32_t numDecodeRounds = 20000;
+
+// refreshes of the forecast in a day, one every 10 minutes from midnight,
+// and deltas the phone sends between two whole forecasts, as the app does
+constexpr uint32_t numForecastRefreshes = 144;
+constexpr uint32_t forecastRefreshPeriod = 10;
+constexpr uint32_t fullUpdateInterval = 10;
+// refresh before which the device reboots, at 12:30
+constexpr size_t forecastRebootAt = 75;
+
+// operator new calls of the program, see below
+std::atomic<size_t> numAllocations{0};
+
+// timing the frames of the main loop while a session is replayed
+std::atomic<SessionReplayer*> activeReplayer{nullptr};
+
+std::string finishFrame(protocol::Writer& writer) {
+    writer.finish();
+    return std::string{writer.getFrame()};
+}
+
+std::string makeNotification(uint32_t idx) {
+    char buffer[protocol::maxFrameSize];
+    protocol::Writer writer{buffer, sizeof(buffer)};
+    writer.begin(protocol::MessageType::NOTIFICATION);
+    writer.putString(protocol::tag::notificationSource, "whatsapp");
+    writer.putString(protocol::tag::notificationSender, "Alice");
+    writer.putString(protocol::tag::notificationContent,
+                     "are you coming to the meeting today? #" +
+                         std::to_string(idx));
+    // the phone shares the clock of the device here
+    writer.putUInt(protocol::tag::sentAt, esp_timer_get_time() / 1000);
+    return finishFrame(writer);
+}
+
+std::string makePartialTranscript(uint32_t idx) {
+    char buffer[protocol::maxFrameSize];
+    protocol::Writer writer{buffer, sizeof(buffer)};
+    writer.begin(protocol::MessageType::PARTIAL_TRANSCRIPT);
+    writer.putUInt(protocol::tag::transcriptUtterance, idx / 8);
+    writer.putUInt(protocol::tag::transcriptNumStableBytes, 12);
+    writer.putString(protocol::tag::transcriptTail, "where is the station");
+    return finishFrame(writer);
+}
+
+std::string makeCall() {
+    char buffer[protocol::maxFrameSize];
+    protocol::Writer writer{buffer, sizeof(buffer)};
+    writer.begin(protocol::MessageType::CALL);
+    return finishFrame(writer);
+}
+
+std::string makeTranslation() {
+    char buffer[protocol::maxFrameSize];
+    protocol::Writer writer{buffer, sizeof(buffer)};
+    writer.begin(protocol::MessageType::TRANSLATION);
+    writer.putString(protocol::tag::translationText,
+                     "Thank you for the message, I will be there when the "
+                     "meeting starts, please wait for me");
+    std::string frame = finishFrame(writer);
+    char compressed[protocol::maxFrameSize];
+    size_t size =
+        protocol::lz::compressFrame(frame, compressed, sizeof(compressed));
+    return size ? std::string{compressed, size} : frame;
+}
+
+std::string makeWeather() {
+    char buffer[protocol::maxFrameSize];
+    protocol::Writer writer{buffer, sizeof(buffer)};
+    writer.begin(protocol::MessageType::WEATHER);
+    writer.putString(protocol::tag::weatherLocation, "Milano");
+    for (uint32_t i = 0; i < 24; i++) {
+        size_t position = writer.beginNested(protocol::tag::weatherCondition);
+        writer.putUInt(protocol::tag::conditionTime, 1700000000 + i * 3600);
+        writer.putInt(protocol::tag::conditionTemperature, 12 - int32_t(i));
+        writer.putUInt(protocol::tag::conditionPressure, 1013);
+        writer.putUInt(protocol::tag::conditionIcon, i % 4);
+        writer.endNested(position);
+    }
+    return finishFrame(writer);
+}
+
+/**
+ * Message of the corpus, written by the phone in each format
+ */
+struct Sample {
+    char const* m_kind;
+    std::string m_json;
+    std::string m_frame;
+};
+
+std::string toJSON(JsonDocument const& doc) {
+    std::string json;
+    serializeJson(doc, json);
+    return json;
+}
+
+/**
+ * Returns the kinds of messages of a day of use, each with the same content
+ * in both formats
+ */
+std::vector<Sample> makeCorpus() {
+    std::vector<Sample> corpus;
+    char buffer[protocol::maxFrameSize];
+
+    auto addNotification = [&](char const* kind, char const* source,
+                               char const* sender, char const* content) {
+        JsonDocument doc;
+        doc["command"] = "n";
+        doc["source"] = source;
+        doc["sender"] = sender;
+        doc["content"] = content;
+        protocol::Writer writer{buffer, sizeof(buffer)};
+        writer.begin(protocol::MessageType::NOTIFICATION);
+        writer.putString(protocol::tag::notificationSource, source);
+        writer.putString(protocol::tag::notificationSender, sender);
+        writer.putString(protocol::tag::notificationContent, content);
+        corpus.push_back(Sample{kind, toJSON(doc), finishFrame(writer)});
+    };
+    addNotification("chat", "whatsapp", "Alice",
+                    "are you coming to the meeting today?");
+    addNotification("email", "gmail", "Bob Smith",
+                    "Hi all, please find attached the minutes of the meeting "
+                    "of this morning. The next one will be on Monday at 10 "
+                    "in the usual room, let me know if you cannot attend so "
+                    "that we can reschedule it. Thank you, Bob");
+
+    {
+        JsonDocument doc;
+        doc["command"] = "tp";
+        doc["u"] = 12;
+        doc["s"] = 18;
+        doc["x"] = "where is the station";
+        protocol::Writer writer{buffer, sizeof(buffer)};
+        writer.begin(protocol::MessageType::PARTIAL_TRANSCRIPT);
+        writer.putUInt(protocol::tag::transcriptUtterance, 12);
+        writer.putUInt(protocol::tag::transcriptNumStableBytes, 18);
+        writer.putString(protocol::tag::transcriptTail,
+                         "where is the station");
+        corpus.push_back(Sample{"partial", toJSON(doc), finishFrame(writer)});
+    }
+
+    {
+        char const text[] =
+            "Thank you for the message, I will be there when the meeting "
+            "starts, please wait for me";
+        JsonDocument doc;
+        doc["command"] = "t";
+        doc["text"] = text;
+        protocol::Writer writer{buffer, sizeof(buffer)};
+        writer.begin(protocol::MessageType::TRANSLATION);
+        writer.putString(protocol::tag::translationText, text);
+        corpus.push_back(
+            Sample{"translate", toJSON(doc), finishFrame(writer)});
+    }
+
+    {
+        char const* const icons[] = {"sun", "cloud", "rain", "snow"};
+        JsonDocument doc;
+        doc["command"] = "w";
+        doc["location"] = "Milano";
+        protocol::Writer writer{buffer, sizeof(buffer)};
+        writer.begin(protocol::MessageType::WEATHER);
+        writer.putString(protocol::tag::weatherLocation, "Milano");
+        for (int32_t hour = 0; hour < 24; hour++) {
+            char time[6];
+            snprintf(time, sizeof(time), "%02d:00", static_cast<int>(hour));
+            JsonVariant cond = doc["conditions"].add<JsonObject>();
+            cond["time"] = time;
+            cond["temperature"] = 12 - hour;
+            cond["pressure"] = 1013;
+            cond["iconName"] = icons[hour % 4];
+            size_t position =
+                writer.beginNested(protocol::tag::weatherCondition);
+            writer.putString(protocol::tag::conditionTime, time);
+            writer.putInt(protocol::tag::conditionTemperature, 12 - hour);
+            writer.putUInt(protocol::tag::conditionPressure, 1013);
+            writer.putUInt(protocol::tag::conditionIcon,
+                           protocol::getIconId(icons[hour % 4]));
+            writer.endNested(position);
+        }
+        corpus.push_back(Sample{"weather", toJSON(doc), finishFrame(writer)});
+    }
+    return corpus;
+}
+
+/**
+ * Decodes @p{data} as the device does, a JSON document transcoded first and
+ * a compressed frame inflated, down to the fields of the message
+ * @return false if malformed
+ */
+bool decodeMessage(std::string_view data) {
+    char transcoded[protocol::maxFrameSize];
+    char inflated[protocol::maxFrameSize];
+    if (!protocol::isFrame(data)) {
+        protocol::Writer writer{transcoded, sizeof(transcoded)};
+        if (!protocol::transcodeJSON(data, writer))
+            return false;
+        data = writer.getFrame();
+    }
+    protocol::Frame frame;
+    if (!protocol::decodeFrame(data, frame))
+        return false;
+    if (frame.m_isCompressed &&
+        (!protocol::lz::inflateFrame(frame, inflated, sizeof(inflated),
+                                     data) ||
+         !protocol::decodeFrame(data, frame)))
+        return false;
+
+    switch (frame.m_type) {
+        case protocol::MessageType::NOTIFICATION: {
+            protocol::NotificationView notification;
+            return protocol::decode(frame, notification);
+        }
+        case protocol::MessageType::TRANSLATION: {
+            protocol::TranslationView translation;
+            return protocol::decode(frame, translation);
+        }
+        case protocol::MessageType::PARTIAL_TRANSCRIPT: {
+            protocol::PartialTranscriptView partial;
+            return protocol::decode(frame, partial);
+        }
+        case protocol::MessageType::WEATHER: {
+            protocol::WeatherView weather;
+            return protocol::decode(frame, weather) &&
+                   weather.forEachCondition(
+                       [](protocol::ConditionView const&) {}) > 0;
+        }
+        default:
+            return false;
+    }
+}
+
+/**
+ * Returns the nanoseconds @p{data} takes to decode, on average, or -1 if it
+ * is malformed
+ */
+double timeDecoding(std::string_view data) {
+    int64_t start = esp_timer_get_time();
+    for (uint32_t i = 0; i < numDecodeRounds; i++) {
+        if (!decodeMessage(data))
+            return -1;
+    }
+    return (esp_timer_get_time() - start) * 1000.0 / numDecodeRounds;
+}
+
+/**
+ * Prints the bytes and the decoding time of each message of the corpus, as a
+ * frame and as JSON
+ * @return false if a message cannot be decoded
+ */
+bool compareFormats() {
+    bool isSuccess = true;
+    printf("kind       frame B   JSON B  frame ns   JSON ns\n");
+    for (Sample const& sample : makeCorpus()) {
+        double frameTime = timeDecoding(sample.m_frame);
+        double jsonTime = timeDecoding(sample.m_json);
+        isSuccess = isSuccess && frameTime >= 0 && jsonTime >= 0;
+        printf("%-9s %8zu %8zu %9.0f %9.0f\n", sample.m_kind,
+               sample.m_frame.size(), sample.m_json.size(), frameTime,
+               jsonTime);
+    }
+    return isSuccess;
+}
+
+/**
+ * Prints, for each message of the corpus, the bytes of its frame before and
+ * after the compression and the time to decode it in both forms, per KB of
+ * the frame
+ * @return false if a message cannot be decoded
+ */
+bool measureCompression() {
+    bool isSuccess = true;
+    size_t totalSize = 0;
+    size_t totalCompressedSize = 0;
+    printf("kind       frame B  lz B  ratio  us/KB  lz us/KB\n");
+    for (Sample const& sample : makeCorpus()) {
+        char compressed[protocol::maxFrameSize];
+        size_t compressedSize = protocol::lz::compressFrame(
+            sample.m_frame, compressed, sizeof(compressed));
+        double kilobytes = sample.m_frame.size() / 1024.0;
+        double time = timeDecoding(sample.m_frame);
+        isSuccess = isSuccess && time >= 0;
+        totalSize += sample.m_frame.size();
+        // not compressible, or not worth it: sent as it is
+        if (compressedSize == 0) {
+            totalCompressedSize += sample.m_frame.size();
+            printf("%-9s %8zu     -      -  %5.2f         -\n", sample.m_kind,
+                   sample.m_frame.size(), time / 1000 / kilobytes);
+            continue;
+        }
+        double compressedTime =
+            timeDecoding(std::string_view{compressed, compressedSize});
+        isSuccess = isSuccess && compressedTime >= 0;
+        totalCompressedSize += compressedSize;
+        printf("%-9s %8zu %5zu %6.2f  %5.2f  %8.2f\n", sample.m_kind,
+               sample.m_frame.size(), compressedSize,
+               static_cast<double>(sample.m_frame.size()) / compressedSize,
+               time / 1000 / kilobytes, compressedTime / 1000 / kilobytes);
+    }
+    printf("all       %8zu %5zu %6.2f\n", totalSize, totalCompressedSize,
+           static_cast<double>(totalSize) / totalCompressedSize);
+    return isSuccess;
+}
+
+/**
+ * Observer of the events of the device, timing the messages delivered
+ */
+class Probe : public view::RemoteResponder {
+public:
+    void onEvent(ble::ConnectionState const&) override {}
+    void onEvent(ble::BondingState const&) override {}
+    void onEvent(ble::UpdateMessage const&) override { onDelivered(); }
+    void onEvent(ble::MessageNotification const&) override { onDelivered(); }
+    void onEvent(ble::CallNotification const&) override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_callLatency = esp_timer_get_time() - m_callWriteTime;
+        m_cv.notify_all();
+    }
+
+    char const* getName() override { return "probe"; }
+
+    // the messages are delivered in the order they are written
+    void onWritten(size_t numMessages) {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_cv.wait(lock, [this]() {
+            return m_writeTimes.size() < maxNumInFlight;
+        });
+        int64_t now = esp_timer_get_time();
+        for (size_t i = 0; i < numMessages; i++)
+            m_writeTimes.push_back(now);
+    }
+
+    void waitForAll() {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_cv.wait(lock, [this]() { return m_writeTimes.empty(); });
+    }
+
+    std::vector<int64_t> takeLatencies() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return std::move(m_latencies);
+    }
+
+    /**
+     * Makes each message delivered take @p{cost} to the main loop, with no
+     * timing
+     */
+    void simulateDrawing(std::chrono::milliseconds cost) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_eventCost = cost;
+    }
+
+    size_t getNumDrawn() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_numDrawn;
+    }
+
+    void onCallWritten() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_callWriteTime = esp_timer_get_time();
+        m_callLatency = -1;
+    }
+
+    /**
+     * Returns the microseconds from the write of the call to its delivery
+     */
+    int64_t waitForCall() {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_cv.wait(lock, [this]() { return m_callLatency >= 0; });
+        return m_callLatency;
+    }
+
+private:
+    void onDelivered() {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        if (m_eventCost.count() > 0) {
+            std::chrono::milliseconds cost = m_eventCost;
+            lock.unlock();
+            std::this_thread::sleep_for(cost);
+            lock.lock();
+            m_numDrawn++;
+            return;
+        }
+        if (m_writeTimes.empty())
+            return;
+        m_latencies.push_back(esp_timer_get_time() - m_writeTimes.front());
+        m_writeTimes.pop_front();
+        m_cv.notify_all();
+    }
+
+private:
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    std::deque<int64_t> m_writeTimes;
+    std::vector<int64_t> m_latencies;
+
+    std::chrono::milliseconds m_eventCost{0};
+    size_t m_numDrawn{0};
+    int64_t m_callWriteTime{0};
+    int64_t m_callLatency{-1};
+};
+
+void runThroughput(ble::LoopbackTransport& phone,
+                   Probe& probe,
+                   size_t numMessages) {
+    std::string const translation = makeTranslation();
+    std::string const weather = makeWeather();
+    char fragment[maxPacketSize];
+    uint8_t idFragmented = 0;
+    size_t numWrites = 0;
+    int64_t start = esp_timer_get_time();
+    for (uint32_t idx = 0; idx < numMessages;) {
+        switch (idx % 8) {
+            case 0: {
+                probe.onWritten(1);
+                protocol::Fragmenter fragmenter{weather, idFragmented++,
+                                                maxPacketSize};
+                while (size_t size = fragmenter.next(fragment)) {
+                    phone.write(std::string_view{fragment, size});
+                    numWrites++;
+                }
+                idx++;
+                break;
+            }
+            case 1:
+            case 5: {
+                std::string batch;
+                for (int i = 0; i < 3; i++)
+                    protocol::appendToBatch(batch,
+                                            makePartialTranscript(idx + i));
+                probe.onWritten(3);
+                phone.write(batch);
+                numWrites++;
+                idx += 3;
+                break;
+            }
+            case 4:
+                probe.onWritten(1);
+                phone.write(translation);
+                numWrites++;
+                idx++;
+                break;
+            default:
+                probe.onWritten(1);
+                phone.write(makeNotification(idx));
+                numWrites++;
+                idx++;
+        }
+    }
+    probe.waitForAll();
+    int64_t elapsed = esp_timer_get_time() - start;
+
+    std::vector<int64_t> latencies = probe.takeLatencies();
+    std::sort(latencies.begin(), latencies.end());
+    auto percentile = [&latencies](size_t p) {
+        return latencies[std::min(latencies.size() - 1,
+                                  latencies.size() * p / 100)];
+    };
+    printf("%zu messages in %zu writes, %.1f ms: %.0f messages/s\n",
+           latencies.size(), numWrites, elapsed / 1000.0,
+           latencies.size() * 1e6 / elapsed);
+    printf("latency from the write to the observer (us): p50 %lld, p90 %lld, "
+           "p99 %lld, max %lld\n",
+           static_cast<long long>(percentile(50)),
+           static_cast<long long>(percentile(90)),
+           static_cast<long long>(percentile(99)),
+           static_cast<long long>(latencies.back()));
+}
+
+/**
+ * @return false if the call took longer than callLatencyBound
+ */
+bool runCallFlood(ble::LoopbackTransport& phone, Probe& probe) {
+    probe.simulateDrawing(eventCost);
+    // the device drops what does not fit its queues, as it would over the air
+    for (uint32_t idx = 0; idx < numFloodMessages / 2; idx++)
+        phone.write(makeNotification(idx));
+    // let the backlog reach the main loop
+    std::this_thread::sleep_for(callLatencyBound);
+
+    size_t numDrawnBefore = probe.getNumDrawn();
+    probe.onCallWritten();
+    phone.write(makeCall());
+    for (uint32_t idx = numFloodMessages / 2; idx < numFloodMessages; idx++)
+        phone.write(makeNotification(idx));
+    int64_t latency = probe.waitForCall();
+    size_t numDrawnAhead = probe.getNumDrawn() - numDrawnBefore;
+
+    // wait for the flood to be drawn
+    while (!view::MainEventQueue::getInstance()->isEmpty())
+        std::this_thread::sleep_for(eventCost);
+    probe.simulateDrawing(std::chrono::milliseconds{0});
+
+    bool isWithinBound =
+        latency <= std::chrono::microseconds{callLatencyBound}.count();
+    printf("call delivered in %lld us during a flood, %zu messages drawn "
+           "before it, %zu after: %s the bound of %lld ms\n",
+           static_cast<long long>(latency), numDrawnAhead,
+           probe.getNumDrawn() - numDrawnBefore - numDrawnAhead,
+           isWithinBound ? "within" : "OVER",
+           static_cast<long long>(callLatencyBound.count()));
+    return isWithinBound;
+}
+// posts a gesture as InputManager would, recording it
+void postTouch(SessionEvent event) {
+    SessionRecorder::getInstance()->record(
+        event, static_cast<uint32_t>(esp_timer_get_time()));
+    view::MainEventQueue::getInstance()->push(
+        std::make_unique<view::RemoteProcedure>(
+            []() {}, view::UIEventPriority::GESTURE));
+}
+
+void runSession(ble::LoopbackTransport& phone) {
+    std::string const translation = makeTranslation();
+    std::string const weather = makeWeather();
+    char fragment[maxPacketSize];
+    uint8_t idFragmented = 0;
+    for (uint32_t step = 0; step < numSessionSteps; step++) {
+        switch (step % 8) {
+            case 0:
+                phone.write(makeNotification(step));
+                break;
+            case 1:
+            case 2:
+                postTouch(SessionEvent::SWIPE_CLOCKWISE);
+                break;
+            case 3:
+                postTouch(SessionEvent::CLICK);
+                break;
+            case 4: {
+                protocol::Fragmenter fragmenter{weather, idFragmented++,
+                                                maxPacketSize};
+                while (size_t size = fragmenter.next(fragment))
+                    phone.write(std::string_view{fragment, size});
+                break;
+            }
+            case 5:
+                postTouch(SessionEvent::SWIPE_ANTI_CLOCKWISE);
+                break;
+            case 6:
+                phone.write(translation);
+                break;
+            default:
+                postTouch(SessionEvent::PRESS);
+        }
+        std::this_thread::sleep_for(sessionStepPeriod);
+    }
+}
+
+/**
+ * @return false if the trace cannot be read
+ */
+bool replaySession(ble::LoopbackTransport& phone,
+                   char const* path,
+                   uint32_t speed) {
+    std::unique_ptr<storage::FileFlash> trace =
+        storage::FileFlash::open(path, traceSectorSize, numTraceSectors);
+    if (!trace)
+        return false;
+    SessionReplayer replayer{
+        *trace, [&phone](SessionEvent event, std::string_view payload) {
+            if (event == SessionEvent::PHONE_WRITE)
+                phone.write(payload);
+            else
+                postTouch(event);
+        }};
+    activeReplayer = &replayer;
+    int64_t start = esp_timer_get_time();
+    replayer.start(speed);
+    replayer.wait();
+    activeReplayer = nullptr;
+    printf("session replayed %ux in %.1f ms:\n%s", speed,
+           (esp_timer_get_time() - start) / 1000.0,
+           replayer.report().c_str());
+    return true;
+}
+/**
+ * Appends messages of the usual sizes to a new log in @p{path}, and prints
+ * the bytes written to the flash and the sectors erased for each byte
+ * appended
+ * @return false if the log cannot be created
+ */
+bool measureHistory(char const* path) {
+    std::remove(path);
+    std::unique_ptr<storage::FileFlash> flash =
+        storage::FileFlash::open(path, historySectorSize, numHistorySectors);
+    if (!flash)
+        return false;
+    model::MessageLog::Stats stats;
+    int64_t start = esp_timer_get_time();
+    {
+        model::MessageLog log{std::move(flash), numHistoryRetained};
+        // bodies of 20 to about 400 bytes, a chat message to an email
+        std::string body;
+        for (uint32_t i = 0; i < numHistoryMessages; i++) {
+            body.assign(20 + (i * 7919) % 380, 'a' + i % 26);
+            if (!log.append("whatsapp", "Alice", body, i))
+                return false;
+        }
+        stats = log.getStats();
+    }
+    double elapsed = (esp_timer_get_time() - start) / 1000.0;
+    printf("history: %u messages appended in %.1f ms, %u bytes\n",
+           numHistoryMessages, elapsed, stats.m_numBytesAppended);
+    printf("written %u bytes, write amplification %.3f\n",
+           stats.m_numBytesWritten,
+           static_cast<double>(stats.m_numBytesWritten) /
+               stats.m_numBytesAppended);
+    printf("erased %u sectors, %.2f bytes erased per byte appended\n",
+           stats.m_numSectorsErased,
+           static_cast<double>(stats.m_numSectorsErased) * historySectorSize /
+               stats.m_numBytesAppended);
+    return true;
+}
+
+/**
+ * Condition of a time slot, as the phone computes it
+ */
+struct PhoneCondition {
+    std::string m_time;
+    int32_t m_temperature;
+    uint32_t m_pressure;
+    uint8_t m_icon;
+
+    bool operator==(PhoneCondition const& other) const {
+        return m_time == other.m_time &&
+               m_temperature == other.m_temperature &&
+               m_pressure == other.m_pressure && m_icon == other.m_icon;
+    }
+};
+
+using PhoneForecast = std::vector<PhoneCondition>;
+
+/**
+ * Returns the forecasts of a day, the current condition and @p{numSlots}
+ * 3 hour slots each: the current temperature drifts, a slot is revised now
+ * and then, and the slots roll every 3 hours. Past a day the slots share the
+ * time of the day with earlier ones.
+ */
+std::vector<PhoneForecast> makeForecastDay(size_t numSlots) {
+    // temperatures by slot of the day, from midnight
+    int32_t const temperatures[] = {9, 8, 10, 14, 17, 18, 15, 12};
+    std::array<int32_t, 8> revisions{};
+    uint32_t seed = 42;
+    auto random = [&seed](uint32_t bound) {
+        seed = seed * 1103515245 + 12345;
+        return (seed >> 16) % bound;
+    };
+    auto icon = [](uint32_t hour) -> uint8_t {
+        return hour < 6 || hour >= 21 ? 3 : 2 + hour % 2 * 4;
+    };
+
+    std::vector<PhoneForecast> day;
+    int32_t drift = 0;
+    for (uint32_t i = 0; i < numForecastRefreshes; i++) {
+        uint32_t minute = i * forecastRefreshPeriod;
+        uint32_t hour = minute / 60;
+        if (random(3) == 0)
+            drift += random(2) ? 1 : -1;
+        if (random(8) == 0)
+            revisions[random(8)] += random(2) ? 1 : -1;
+
+        PhoneForecast forecast;
+        forecast.push_back(PhoneCondition{
+            "Now", temperatures[hour / 3] + drift, 1013, icon(hour)});
+        for (size_t j = 0; j < numSlots; j++) {
+            uint32_t slotHour = (hour / 3 + 1 + j) % 8 * 3;
+            char time[8];
+            snprintf(time, sizeof(time), "%02u:00", slotHour);
+            forecast.push_back(PhoneCondition{
+                time, temperatures[slotHour / 3] + revisions[slotHour / 3],
+                1013, icon(slotHour)});
+        }
+        day.push_back(forecast);
+    }
+    return day;
+}
+
+void putCondition(protocol::Writer& writer,
+                  uint8_t tag,
+                  PhoneCondition const& cond) {
+    size_t position = writer.beginNested(tag);
+    writer.putString(protocol::tag::conditionTime, cond.m_time);
+    writer.putInt(protocol::tag::conditionTemperature, cond.m_temperature);
+    writer.putUInt(protocol::tag::conditionPressure, cond.m_pressure);
+    writer.putUInt(protocol::tag::conditionIcon, cond.m_icon);
+    writer.endNested(position);
+}
+
+std::string makeFullWeather(PhoneForecast const& forecast) {
+    char buffer[protocol::maxFrameSize];
+    protocol::Writer writer{buffer, sizeof(buffer)};
+    writer.begin(protocol::MessageType::WEATHER);
+    writer.putString(protocol::tag::weatherLocation, "Milano");
+    for (PhoneCondition const& cond : forecast)
+        putCondition(writer, protocol::tag::weatherCondition, cond);
+    return finishFrame(writer);
+}
+
+/**
+ * Encodes the forecasts as WeatherDeltaEncoder of the app does: a delta by
+ * time slot when it rebuilds the forecast, the whole forecast otherwise and
+ * every fullUpdateInterval deltas
+ */
+class PhoneWeatherEncoder {
+public:
+    std::string encode(PhoneForecast const& forecast) {
+        PhoneForecast previous = std::move(m_lastSent);
+        m_lastSent = forecast;
+        if (m_isFirst || m_numDeltas >= fullUpdateInterval ||
+            !hasUniqueSlots(previous) || !hasUniqueSlots(forecast))
+            return full(forecast);
+
+        std::vector<std::string> removed;
+        for (PhoneCondition const& cond : previous) {
+            if (std::none_of(forecast.begin(), forecast.end(),
+                             [&](PhoneCondition const& other) {
+                                 return other.m_time == cond.m_time;
+                             }))
+                removed.push_back(cond.m_time);
+        }
+        PhoneForecast upserted;
+        for (PhoneCondition const& cond : forecast) {
+            if (std::find(previous.begin(), previous.end(), cond) ==
+                previous.end())
+                upserted.push_back(cond);
+        }
+        // a slot moving around cannot be told by a delta
+        if (apply(previous, removed, upserted) != forecast)
+            return full(forecast);
+
+        char buffer[protocol::maxFrameSize];
+        protocol::Writer writer{buffer, sizeof(buffer)};
+        writer.begin(protocol::MessageType::WEATHER_DELTA);
+        for (std::string const& time : removed)
+            writer.putString(protocol::tag::weatherRemove, time);
+        for (PhoneCondition const& cond : upserted)
+            putCondition(writer, protocol::tag::weatherUpsert, cond);
+        m_numDeltas++;
+        return finishFrame(writer);
+    }
+
+private:
+    std::string full(PhoneForecast const& forecast) {
+        m_isFirst = false;
+        m_numDeltas = 0;
+        return makeFullWeather(forecast);
+    }
+
+    static bool hasUniqueSlots(PhoneForecast const& forecast) {
+        for (size_t i = 0; i < forecast.size(); i++) {
+            for (size_t j = 0; j < i; j++) {
+                if (forecast[i].m_time == forecast[j].m_time)
+                    return false;
+            }
+        }
+        return true;
+    }
+
+    static PhoneForecast apply(PhoneForecast const& forecast,
+                               std::vector<std::string> const& removed,
+                               PhoneForecast const& upserted) {
+        PhoneForecast result;
+        for (PhoneCondition const& cond : forecast) {
+            if (std::find(removed.begin(), removed.end(), cond.m_time) ==
+                removed.end())
+                result.push_back(cond);
+        }
+        for (PhoneCondition const& cond : upserted) {
+            auto it = std::find_if(result.begin(), result.end(),
+                                   [&](PhoneCondition const& other) {
+                                       return other.m_time == cond.m_time;
+                                   });
+            if (it == result.end())
+                result.push_back(cond);
+            else
+                *it = cond;
+        }
+        return result;
+    }
+
+private:
+    PhoneForecast m_lastSent;
+    bool m_isFirst{true};
+    uint32_t m_numDeltas{0};
+};
+
+bool isShowing(model::Weather const& weather, PhoneForecast const& forecast) {
+    model::Forecast const& shown = weather.getForecast();
+    if (shown.size() != forecast.size())
+        return false;
+    for (size_t i = 0; i < shown.size(); i++) {
+        if (shown[i].getTime() != forecast[i].m_time ||
+            shown[i].m_temperature != forecast[i].m_temperature)
+            return false;
+    }
+    return true;
+}
+
+/**
+ * Outcome of the updates of a day applied by the device
+ */
+struct WeatherReplay {
+    size_t m_numBytes{0};
+    size_t m_numAllocations{0};
+    size_t m_numRedraws{0};
+    // refreshes after which the device did not show the forecast of the phone
+    size_t m_numStale{0};
+};
+
+/**
+ * Applies @p{updates} as ConnectionManager does, and copies the forecast
+ * into a page showing the current condition as WeatherPage does, counting
+ * the redraws of the condition shown. The device reboots before the update
+ * @p{rebootAt}, if any.
+ */
+WeatherReplay replayWeather(std::vector<PhoneForecast> const& day,
+                            std::vector<std::string> const& updates,
+                            size_t rebootAt) {
+    WeatherReplay replay;
+    std::unique_ptr<model::Weather> device =
+        std::make_unique<model::Weather>();
+    model::Weather page;
+    for (size_t i = 0; i < updates.size(); i++) {
+        if (i == rebootAt)
+            device = std::make_unique<model::Weather>();
+        replay.m_numBytes += updates[i].size();
+
+        size_t numAllocationsBefore = numAllocations;
+        protocol::Frame frame;
+        bool isApplied = protocol::decodeFrame(updates[i], frame) &&
+                         device->apply(frame);
+        model::Condition before{};
+        bool wasEmpty = page.getForecast().isEmpty();
+        if (!wasEmpty)
+            before = page.getForecast()[0];
+        if (isApplied)
+            page = *device;
+        replay.m_numAllocations += numAllocations - numAllocationsBefore;
+
+        bool isEmpty = page.getForecast().isEmpty();
+        if (isEmpty != wasEmpty ||
+            (!isEmpty && page.getForecast()[0] != before))
+            replay.m_numRedraws++;
+        if (!isShowing(*device, day[i]))
+            replay.m_numStale++;
+    }
+    return replay;
+}
+
+/**
+ * Prints, for forecasts of several lengths, the bytes of the updates of a
+ * day whole and as deltas, with the allocations and redraws of the device,
+ * and the refreshes a device rebooted at 12:30 shows a stale forecast
+ * @return false if the device does not end up showing the forecast
+ */
+bool measureWeather() {
+    bool isSuccess = true;
+    printf("slots  updates  full B  delta B  ratio  allocs  redraws  "
+           "stale\n");
+    for (size_t numSlots : {4, 8, 16}) {
+        std::vector<PhoneForecast> day = makeForecastDay(numSlots);
+        std::vector<std::string> fullUpdates;
+        std::vector<std::string> deltaUpdates;
+        PhoneWeatherEncoder encoder;
+        for (PhoneForecast const& forecast : day) {
+            fullUpdates.push_back(makeFullWeather(forecast));
+            deltaUpdates.push_back(encoder.encode(forecast));
+        }
+
+        WeatherReplay full = replayWeather(day, fullUpdates, SIZE_MAX);
+        WeatherReplay delta = replayWeather(day, deltaUpdates, SIZE_MAX);
+        WeatherReplay rebooted =
+            replayWeather(day, deltaUpdates, forecastRebootAt);
+        isSuccess = isSuccess && delta.m_numStale == 0 &&
+                    rebooted.m_numStale <= fullUpdateInterval;
+        printf("%5zu  %7zu  %6zu  %7zu  %5.2f  %6zu  %7zu  %5zu\n",
+               numSlots + 1, day.size(), full.m_numBytes, delta.m_numBytes,
+               static_cast<double>(full.m_numBytes) / delta.m_numBytes,
+               delta.m_numAllocations, delta.m_numRedraws,
+               rebooted.m_numStale);
+    }
+    return isSuccess;
+}
+}  // namespace
+
+// counting the allocations of the device, see measureWeather: out of line,
+// else the compiler pairs the malloc with the operator delete of the library
+[[gnu::noinline]] void* operator new(std::size_t size) {
+    numAllocations++;
+    if (void* ptr = std::malloc(size ? size : 1))
+        return ptr;
+    throw std::bad_alloc{};
+}
+
+int main(int argc, char** argv) {
+    std::string mode = argc > 1 ? argv[1] : "";
+    // without the device
+    if (mode == "history" && argc > 2)
+        return measureHistory(argv[2]) ? 0 : 1;
+    if (mode == "formats")
+        return compareFormats() ? 0 : 1;
+    if (mode == "compression")
+        return measureCompression() ? 0 : 1;
+    if (mode == "weather")
+        return measureWeather() ? 0 : 1;
+    bool isRecording = mode == "record" && argc > 2;
+    bool isReplaying = mode == "replay" && argc > 2;
+    size_t numMessages = argc > 1 && !isRecording && !isReplaying
+                             ? std::strtoul(argv[1], nullptr, 10)
+                             : defaultNumMessages;
+
+    std::mutex phoneMutex;
+    std::condition_variable phoneCv;
+    size_t numPacketsReceived = 0;
+    auto transport = std::make_unique<ble::LoopbackTransport>(
+        [&](std::string_view) {
+            std::lock_guard<std::mutex> lock(phoneMutex);
+            numPacketsReceived++;
+            phoneCv.notify_all();
+        },
+        maxPacketSize);
+    ble::LoopbackTransport* phone = transport.get();
+    ble::ConnectionManager connectionManager{std::move(transport), nullptr};
+
+    Probe probe;
+    auto dispatcher = ble::RemoteDispatcher::getInstance();
+    dispatcher->addObserver(ble::UpdateMessage::name, &probe);
+    dispatcher->addObserver(ble::MessageNotification::name, &probe);
+    dispatcher->addObserver(ble::CallNotification::name, &probe);
+
+    // the main loop of the device, without the display
+    std::atomic<bool> isRunning{true};
+    std::thread mainLoop([&isRunning]() {
+        auto mainEventQueue = view::MainEventQueue::getInstance();
+        auto tracer = Tracer::getInstance();
+        while (isRunning) {
+            std::unique_ptr<view::UIEvent> event;
+            if (!mainEventQueue->remove(event, std::chrono::milliseconds{100}))
+                continue;
+            tracer->record(event->getTraceId(), TraceStage::DEQUEUED);
+            int64_t frameStart = esp_timer_get_time();
+            static_cast<view::RemoteProcedure*>(event.get())->call();
+            tracer->record(event->getTraceId(), TraceStage::DRAWN);
+            if (SessionReplayer* replayer = activeReplayer)
+                replayer->onFrame(esp_timer_get_time() - frameStart);
+        }
+    });
+
+    // the session starts with the negotiation, as on the device
+    if (isRecording) {
+        std::unique_ptr<storage::FileFlash> trace = storage::FileFlash::open(
+            argv[2], traceSectorSize, numTraceSectors);
+        if (!trace)
+            return 1;
+        SessionRecorder::getInstance()->start(
+            SessionRecorder::makeFlashSink(std::move(trace)));
+    }
+    phone->connect();
+    char buffer[protocol::maxFrameSize];
+    protocol::Writer writer{buffer, sizeof(buffer)};
+    writer.begin(protocol::MessageType::HELLO);
+    writer.putUInt(protocol::tag::helloVersion, protocol::version);
+    writer.putUInt(protocol::tag::helloCompression, protocol::lz::codecId);
+    phone->write(finishFrame(writer));
+    {
+        std::unique_lock<std::mutex> lock(phoneMutex);
+        phoneCv.wait(lock, [&]() { return numPacketsReceived > 0; });
+    }
+
+    bool isSuccess = true;
+    if (isRecording) {
+        runSession(*phone);
+        // the last writes are recorded once decoded
+        std::this_thread::sleep_for(sessionStepPeriod);
+        SessionRecorder::getInstance()->stop();
+        printf("session of %u records recorded into %s\n",
+               SessionRecorder::getInstance()->getNumRecords(), argv[2]);
+    } else if (isReplaying) {
+        uint32_t speed =
+            argc > 3 ? std::strtoul(argv[3], nullptr, 10) : 1;
+        isSuccess = replaySession(*phone, argv[2], speed);
+    } else {
+        runThroughput(*phone, probe, numMessages);
+        isSuccess = runCallFlood(*phone, probe);
+        printf("latency by stage:\n%s",
+               Tracer::getInstance()->dump().c_str());
+    }
+
+    isRunning = false;
+    mainLoop.join();
+    phone->disconnect();
+    return isSuccess ? 0 : 1;
+}
+#endif
@@ -0,0 +1,338 @@
+#include "ble/ble_transport.h"
+
+#include "ble/callback/bondingcallback.h"
+#include "ble/callback/characteristiccallback.h"
+#include "ble/callback/diagnosticscallback.h"
+#include "ble/callback/servercallback.h"
+#include "ble/constants.h"
+#include "utility/member_fun_bridge.h"
+#include "utility/touch_tracer.h"
+#include "utility/tracer.h"
+
+namespace ble {
+BleTransport::BleTransport()
+    : m_handler{nullptr},
+      m_txSubscription{nullptr},
+      m_isSendDelivered{false},
+      m_linkProfile{controller::LinkProfile::IDLE},
+      m_peerAddress{},
+      m_linkStats{},
+      m_isConnected{false},
+      m_reconnector{*this},
+      m_reconnectionTimer{nullptr} {}
+
+BleTransport::~BleTransport() {
+    if (m_reconnectionTimer) {
+        esp_timer_stop(m_reconnectionTimer);
+        esp_timer_delete(m_reconnectionTimer);
+    }
+}
+
+void BleTransport::begin(RemoteEventsHandler* handler) {
+    m_handler = handler;
+    // Create the BLE Device
+    BLEDevice::init("ESP32 device");
+    // set the maximum supported MTU so that more bytes can be written in one
+    // shot
+    BLEDevice::setMTU(500);
+    setupBonding();
+    setupConnectionMonitoring();
+    setupCharacteristics();
+    setupAdvertising();
+    // the GAP reports the parameters actually negotiated
+    using GapBridge =
+        MemberFunctionBridge<BleTransport, void, esp_gap_ble_cb_event_t,
+                             esp_ble_gap_cb_param_t*>;
+    GapBridge::setup(this, &BleTransport::onGapEvent);
+    BLEDevice::setCustomGapHandler(GapBridge::wrapper);
+
+    esp_timer_create_args_t timerArgs{};
+    timerArgs.callback = [](void* arg) {
+        static_cast<BleTransport*>(arg)->m_reconnector.onTimeout();
+    };
+    timerArgs.arg = this;
+    timerArgs.name = "reconnection";
+    if (esp_timer_create(&timerArgs, &m_reconnectionTimer) != ESP_OK)
+        ESP_LOGE(TAG, "Timer of the reconnection not created");
+    // the bonded phone, if any, is looked for since the boot
+    m_reconnector.onDisconnected(esp_timer_get_time());
+}
+
+void BleTransport::setupBonding() {
+    randomSeed(analogRead(0));
+
+    BLEDevice::setEncryptionLevel(ESP_BLE_SEC_ENCRYPT_MITM);
+
+    BondingCallaback* bondingCallback = new BondingCallaback(m_handler);
+
+    BLEDevice::setSecurityCallbacks(bondingCallback);
+
+    BLESecurity* pSecurity = new BLESecurity();
+    // the device can only prints stuff. This is important to find out the
+    // mechanism to carry out authentication
+    pSecurity->setCapability(ESP_IO_CAP_OUT);
+    pSecurity->setAuthenticationMode(ESP_LE_AUTH_REQ_SC_MITM_BOND);
+}
+
+void BleTransport::setupConnectionMonitoring() {
+    m_server = std::unique_ptr<BLEServer>(BLEDevice::createServer());
+
+    ServerCallaback* serverCallback = new ServerCallaback(this);
+
+    m_server->setCallbacks(serverCallback);
+}
+
+void BleTransport::setupCharacteristics() {
+    // Create the NUS BLE Service
+    BLEService* pService = m_server->createService(service_uuid);
+
+    m_txCharacteristic =
+        std::unique_ptr<BLECharacteristic>(pService->createCharacteristic(
+            characteristic_uuid_tx, BLECharacteristic::PROPERTY_INDICATE |
+                                        BLECharacteristic::PROPERTY_NOTIFY));
+
+    m_txSubscription = new BLE2902();
+    m_txCharacteristic->addDescriptor(m_txSubscription);
+
+    m_rxCharacteristic =
+        std::unique_ptr<BLECharacteristic>(pService->createCharacteristic(
+            characteristic_uuid_rx, BLECharacteristic::PROPERTY_WRITE));
+
+    CharacteristicCallback* characteristicCallback =
+        new CharacteristicCallback(this);
+
+    m_rxCharacteristic->setCallbacks(characteristicCallback);
+    // the outcome of the packets sent
+    m_txCharacteristic->setCallbacks(characteristicCallback);
+
+    m_diagnosticsCharacteristic =
+        std::unique_ptr<BLECharacteristic>(pService->createCharacteristic(
+            characteristic_uuid_diagnostics, BLECharacteristic::PROPERTY_READ));
+    m_diagnosticsCharacteristic->setCallbacks(new DiagnosticsCallback(
+        []() { return Tracer::getInstance()->dump(); }));
+
+    m_touchDiagnosticsCharacteristic =
+        std::unique_ptr<BLECharacteristic>(pService->createCharacteristic(
+            characteristic_uuid_touch_diagnostics,
+            BLECharacteristic::PROPERTY_READ));
+    m_touchDiagnosticsCharacteristic->setCallbacks(new DiagnosticsCallback(
+        []() { return TouchTracer::getInstance()->dump(); }));
+
+    // Start the service
+    pService->start();
+}
+
+void BleTransport::setupAdvertising() {
+    BLEAdvertising* pAdvertising = m_server->getAdvertising();
+    pAdvertising->addServiceUUID(service_uuid);
+    pAdvertising->setScanResponse(true);
+    // connection interval preferred: the beginning of a connection exchanges
+    // the MTU, the keys and the hello, then the page sets its profile
+    pAdvertising->setMinPreferred(interactiveParameters.m_minInterval);
+    pAdvertising->setMaxPreferred(interactiveParameters.m_maxInterval);
+}
+
+void BleTransport::advertise() {
+    ESP_LOGD(TAG, "Advertising for any phone");
+    m_reconnector.advertiseToAny();
+    if (m_isConnected)
+        disconnect();
+}
+
+void BleTransport::disconnect() {
+    auto connectionId = m_server->getConnId();
+    m_server->disconnect(connectionId);
+}
+
+bool BleTransport::transmit(std::string_view packet, bool isIndication) {
+    m_isSendDelivered = false;
+    m_txCharacteristic->setValue(
+        reinterpret_cast<uint8_t*>(const_cast<char*>(packet.data())),
+        packet.size());
+    // the phone subscribes to either kind of packets, follow its choice
+    if (!m_txSubscription->getNotifications())
+        isIndication = true;
+    else if (!m_txSubscription->getIndications())
+        isIndication = false;
+    // an indication returns once confirmed by the phone or timed out
+    if (isIndication)
+        m_txCharacteristic->indicate();
+    else
+        m_txCharacteristic->notify();
+    return m_isSendDelivered;
+}
+
+size_t BleTransport::getMaxPacketSize() {
+    size_t mtu = m_server->getPeerMTU(m_server->getConnId());
+    return (mtu > minMTU ? mtu : minMTU) - attHeaderSize;
+}
+
+void BleTransport::setLinkProfile(controller::LinkProfile profile) {
+    if (m_linkProfile.exchange(profile) == profile)
+        return;
+    ESP_LOGD(TAG, "Link profile %s",
+             profile == controller::LinkProfile::INTERACTIVE ? "interactive"
+                                                             : "idle");
+    if (m_isConnected)
+        applyLinkProfile();
+}
+
+void BleTransport::applyLinkProfile() {
+    LinkParameters const& parameters =
+        m_linkProfile == controller::LinkProfile::INTERACTIVE
+            ? interactiveParameters
+            : idleParameters;
+
+    std::lock_guard<std::mutex> lock(m_linkMutex);
+    esp_ble_conn_update_params_t update{};
+    memcpy(update.bda, m_peerAddress, sizeof(esp_bd_addr_t));
+    update.min_int = parameters.m_minInterval;
+    update.max_int = parameters.m_maxInterval;
+    update.latency = parameters.m_latency;
+    update.timeout = parameters.m_timeout;
+    if (esp_ble_gap_update_conn_params(&update) != ESP_OK)
+        ESP_LOGE(TAG, "Connection parameters not requested");
+    if (!parameters.m_isFast)
+        return;
+
+    // longer packets cost nothing when idle, thus they are kept
+    if (m_linkStats.m_dataLength < maxDataLength)
+        esp_ble_gap_set_pkt_data_len(m_peerAddress, maxDataLength);
+#if CONFIG_BT_BLE_50_FEATURES_SUPPORTED
+    if (!m_linkStats.m_is2MPhy)
+        esp_ble_gap_set_preferred_phy(
+            m_peerAddress, ESP_BLE_GAP_PHY_OPTIONS_NO_PREF,
+            ESP_BLE_GAP_PHY_1M_PREF_MASK | ESP_BLE_GAP_PHY_2M_PREF_MASK,
+            ESP_BLE_GAP_PHY_1M_PREF_MASK | ESP_BLE_GAP_PHY_2M_PREF_MASK,
+            ESP_BLE_GAP_PHY_OPTIONS_NO_PREF);
+#endif
+}
+
+void BleTransport::onGapEvent(esp_gap_ble_cb_event_t event,
+                                   esp_ble_gap_cb_param_t* param) {
+    std::lock_guard<std::mutex> lock(m_linkMutex);
+    switch (event) {
+        case ESP_GAP_BLE_UPDATE_CONN_PARAMS_EVT:
+            if (param->update_conn_params.status != ESP_BT_STATUS_SUCCESS)
+                return;
+            m_linkStats.m_interval = param->update_conn_params.conn_int;
+            m_linkStats.m_latency = param->update_conn_params.latency;
+            m_linkStats.m_timeout = param->update_conn_params.timeout;
+            ESP_LOGD(TAG, "Connection interval %u, latency %u, timeout %u",
+                     m_linkStats.m_interval, m_linkStats.m_latency,
+                     m_linkStats.m_timeout);
+            break;
+        case ESP_GAP_BLE_SET_PKT_LENGTH_COMPLETE_EVT:
+            if (param->pkt_data_length_cmpl.status != ESP_BT_STATUS_SUCCESS)
+                return;
+            m_linkStats.m_dataLength =
+                param->pkt_data_length_cmpl.params.tx_len;
+            ESP_LOGD(TAG, "Data length %u", m_linkStats.m_dataLength);
+            break;
+#if CONFIG_BT_BLE_50_FEATURES_SUPPORTED
+        case ESP_GAP_BLE_PHY_UPDATE_COMPLETE_EVT:
+            if (param->phy_update.status != ESP_BT_STATUS_SUCCESS)
+                return;
+            m_linkStats.m_is2MPhy =
+                param->phy_update.tx_phy == ESP_BLE_GAP_PHY_2M;
+            ESP_LOGD(TAG, "PHY %s", m_linkStats.m_is2MPhy ? "2M" : "1M");
+            break;
+#endif
+        default:
+            break;
+    }
+}
+
+controller::LinkStats BleTransport::getLinkStats() {
+    Reconnector::Stats reconnectionStats = m_reconnector.getStats();
+    std::lock_guard<std::mutex> lock(m_linkMutex);
+    controller::LinkStats stats = m_linkStats;
+    stats.m_profile = m_linkProfile;
+    stats.m_reconnectionTime = reconnectionStats.m_lastTime;
+    return stats;
+}
+
+void BleTransport::onPeerConnected(esp_bd_addr_t const address) {
+    std::lock_guard<std::mutex> lock(m_linkMutex);
+    memcpy(m_peerAddress, address, sizeof(esp_bd_addr_t));
+    // the link starts with the default parameters
+    m_linkStats = controller::LinkStats{};
+}
+
+void BleTransport::onConnectionStateChange(ConnectionState const& ev) {
+    m_isConnected = ev.phase == ConnectionState::CONNECTED;
+    if (m_isConnected) {
+        m_reconnector.onConnected(esp_timer_get_time());
+        applyLinkProfile();
+    } else {
+        {
+            std::lock_guard<std::mutex> lock(m_linkMutex);
+            m_linkStats = controller::LinkStats{};
+        }
+        m_reconnector.onDisconnected(esp_timer_get_time());
+    }
+    m_handler->onConnectionStateChange(ev);
+}
+
+bool BleTransport::findBondedPeer(Reconnector::Address& address,
+                                  uint8_t& addressType) {
+    // the bonding info is stored in flash by the stack
+    int num = esp_ble_get_bond_device_num();
+    if (num <= 0)
+        return false;
+    auto bonded = std::make_unique<esp_ble_bond_dev_t[]>(num);
+    if (esp_ble_get_bond_device_list(&num, bonded.get()) != ESP_OK ||
+        num <= 0)
+        return false;
+
+    // the phone connected last if bonded, else the one bonded last
+    int idx = num - 1;
+    {
+        std::lock_guard<std::mutex> lock(m_linkMutex);
+        for (int i = 0; i < num; i++) {
+            if (memcmp(bonded[i].bd_addr, m_peerAddress,
+                       sizeof(esp_bd_addr_t)) == 0)
+                idx = i;
+        }
+    }
+    memcpy(address.data(), bonded[idx].bd_addr, address.size());
+    addressType = bonded[idx].bond_key.pid_key.addr_type;
+    return true;
+}
+
+void BleTransport::advertiseDirected(Reconnector::Address const& address,
+                                     uint8_t addressType) {
+    // BLEAdvertising has no peer address, and a directed advertisement
+    // carries no data
+    esp_ble_adv_params_t params{};
+    params.adv_type = ADV_TYPE_DIRECT_IND_HIGH;
+    params.own_addr_type = BLE_ADDR_TYPE_PUBLIC;
+    memcpy(params.peer_addr, address.data(), address.size());
+    params.peer_addr_type = static_cast<esp_ble_addr_type_t>(addressType);
+    params.channel_map = ADV_CHNL_ALL;
+    params.adv_filter_policy = ADV_FILTER_ALLOW_SCAN_ANY_CON_ANY;
+    if (esp_ble_gap_start_advertising(&params) != ESP_OK)
+        ESP_LOGE(TAG, "Directed advertising not started");
+}
+
+void BleTransport::advertiseUndirected(uint16_t minInterval,
+                                       uint16_t maxInterval) {
+    BLEAdvertising* pAdvertising = m_server->getAdvertising();
+    pAdvertising->setMinInterval(minInterval);
+    pAdvertising->setMaxInterval(maxInterval);
+    pAdvertising->start();
+}
+
+void BleTransport::stopAdvertising() {
+    m_server->getAdvertising()->stop();
+}
+
+void BleTransport::startTimer(uint32_t ms) {
+    esp_timer_stop(m_reconnectionTimer);
+    esp_timer_start_once(m_reconnectionTimer, uint64_t{ms} * 1000);
+}
+
+void BleTransport::stopTimer() {
+    esp_timer_stop(m_reconnectionTimer);
+}
+}  // namespace ble
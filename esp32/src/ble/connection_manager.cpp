@@ -1,98 +1,141 @@
 #include "ble/connection_manager.h"
-#include <ArduinoJson.h>
-#include "ble/callback/bondingcallback.h"
-#include "ble/callback/characteristiccallback.h"
-#include "ble/callback/servercallback.h"
-#include "ble/constants.h"
+
+#include <esp_pthread.h>
+#include <esp_timer.h>
 #include "ble/remote_dispatcher.h"
+#include "protocol/batch.h"
+#include "protocol/json_fallback.h"
+#include "protocol/lz.h"
+#include "utility/session_recorder.h"
+#include "utility/tracer.h"
 #include "view/main_event_queue.h"
 
 namespace ble {
-
-ConnectionManager::ConnectionManager()
-    : m_connectionState(ConnectionState{ConnectionState::DISCONNECTED}),
-      m_bondingState(BondingState{BondingState::NOTBONDED, 0}),
-      m_isAdvertising{false},
-      m_messageDb{std::make_unique<model::ModelList<std::string>>()} {
-    // Create the BLE Device
-    BLEDevice::init("ESP32 device");
-    // set the maximum supported MTU so that more bytes can be written in one
-    // shot
-    BLEDevice::setMTU(500);
-    setupBonding();
-    setupConnectionMonitoring();
-    setupCharacteristics();
-    ESP_LOGD(TAG, "ConnectionManager setup correctly\n");
+namespace {
+// milliseconds since the boot, as millis() without depending on Arduino
+uint32_t getMillis() {
+    return esp_timer_get_time() / 1000;
 }
 
-void ConnectionManager::setupBonding() {
-    randomSeed(analogRead(0));
-
-    BLEDevice::setEncryptionLevel(ESP_BLE_SEC_ENCRYPT_MITM);
+// tells the calls apart without decoding the write: a false positive only
+// costs its turn to another write
+bool isCall(std::string_view data) {
+    if (protocol::isFrame(data))
+        return data.size() > 1 &&
+               static_cast<uint8_t>(data[1]) ==
+                   static_cast<uint8_t>(protocol::MessageType::CALL);
+    // the JSON of the phone, with its "source":"call"
+    return data.find("\"call\"") != std::string_view::npos;
+}
+}  // namespace
 
-    BondingCallaback* bondingCallback = new BondingCallaback(this);
+ConnectionManager::ConnectionManager(
+    std::unique_ptr<Transport> transport,
+    std::unique_ptr<storage::Flash> historyFlash)
+    : m_transport{std::move(transport)},
+      m_messageDb{maxNumMessages, messagesArenaSize},
+      m_rxRing{rxRingCapacity, urgentRxRingCapacity},
+      m_maxCallbackTime{0},
+      m_numSlowCallbacks{0},
+      m_reassembler{numReassemblyBuffers, protocol::maxFrameSize,
+                    reassemblyTimeout},
+      m_isCompressionNegotiated{false},
+      m_lastNumBytesSent{0},
+      m_lastStatsTime{0},
+      m_connectionState(ConnectionState{ConnectionState::DISCONNECTED}),
+      m_bondingState(BondingState{BondingState::NOTBONDED, 0}) {
+    m_txQueue = std::make_unique<TxQueue>(
+        [this](std::string_view packet, bool isIndication) {
+            return m_transport->transmit(packet, isIndication);
+        },
+        [this]() { return m_transport->getMaxPacketSize(); },
+        txQueueCapacity);
+    restoreHistory(std::move(historyFlash));
 
-    BLEDevice::setSecurityCallbacks(bondingCallback);
+    esp_pthread_cfg_t config = esp_pthread_get_default_config();
+    config.stack_size = rxTaskStackSize;
+    config.thread_name = "ble_rx";
+    esp_pthread_set_cfg(&config);
+    m_rxTask = std::thread([this]() { runRx(); });
+    // the threads started later by this one get the default configuration
+    config = esp_pthread_get_default_config();
+    esp_pthread_set_cfg(&config);
 
-    BLESecurity* pSecurity = new BLESecurity();
-    // the device can only prints stuff. This is important to find out the
-    // mechanism to carry out authentication
-    pSecurity->setCapability(ESP_IO_CAP_OUT);
-    pSecurity->setAuthenticationMode(ESP_LE_AUTH_REQ_SC_MITM_BOND);
+    // the events may arrive from now on
+    m_transport->begin(this);
+    ESP_LOGD(TAG, "ConnectionManager setup correctly\n");
 }
 
-void ConnectionManager::setupConnectionMonitoring() {
-    m_server = std::unique_ptr<BLEServer>(BLEDevice::createServer());
+ConnectionManager::~ConnectionManager() {
+    m_rxRing.stop();
+    m_rxTask.join();
+}
 
-    ServerCallaback* serverCallback = new ServerCallaback(this);
+void ConnectionManager::restoreHistory(
+    std::unique_ptr<storage::Flash> flash) {
+    if (!flash) {
+        ESP_LOGE(TAG, "No flash for the history, messages kept in RAM only");
+        return;
+    }
+    m_history =
+        std::make_unique<model::MessageLog>(std::move(flash), maxNumMessages);
 
-    m_server->setCallbacks(serverCallback);
+    std::lock_guard<std::mutex> lock(m_messagesMutex);
+    size_t numRestored =
+        m_history->forEach([this](model::LoggedMessage const& msg) {
+            m_messageDb.append(msg.m_app, msg.m_sender, msg.m_body,
+                               msg.m_timestamp);
+        });
+    ESP_LOGD(TAG, "%u messages restored from the history", numRestored);
 }
 
-void ConnectionManager::setupCharacteristics() {
-    // Create the NUS BLE Service
-    BLEService* pService = m_server->createService(service_uuid);
-
-    m_txCharacteristic =
-        std::unique_ptr<BLECharacteristic>(pService->createCharacteristic(
-            characteristic_uuid_tx, BLECharacteristic::PROPERTY_INDICATE));
+void ConnectionManager::advertise() {
+    ESP_LOGD(TAG, "Start advertising");
+    m_transport->advertise();
+}
 
-    m_txCharacteristic->addDescriptor(new BLE2902());
+void ConnectionManager::disconnect() {
+    m_transport->disconnect();
+}
 
-    m_rxCharacteristic =
-        std::unique_ptr<BLECharacteristic>(pService->createCharacteristic(
-            characteristic_uuid_rx, BLECharacteristic::PROPERTY_WRITE));
+void ConnectionManager::setLinkProfile(controller::LinkProfile profile) {
+    m_transport->setLinkProfile(profile);
+}
 
-    CharacteristicCallback* characteristicCallback =
-        new CharacteristicCallback(this);
+controller::LinkStats ConnectionManager::getLinkStats() {
+    TxQueue::Stats txStats = m_txQueue->getStats();
+    int64_t now = esp_timer_get_time();
 
-    m_rxCharacteristic->setCallbacks(characteristicCallback);
+    controller::LinkStats stats = m_transport->getLinkStats();
+    stats.m_numRxDropped = m_rxRing.getStats().m_numDropped;
+    stats.m_goodput = 0;
+    if (now > m_lastStatsTime)
+        stats.m_goodput = (txStats.m_numBytesSent - m_lastNumBytesSent) *
+                          int64_t{1000000} / (now - m_lastStatsTime);
+    m_lastNumBytesSent = txStats.m_numBytesSent;
+    m_lastStatsTime = now;
+    return stats;
+}
 
-    // Start the service
-    pService->start();
+size_t ConnectionManager::readMessagesSince(
+    uint32_t seq,
+    size_t maxNumMessages,
+    std::function<void(model::MessageView const&)> const& f) {
+    std::lock_guard<std::mutex> lock(m_messagesMutex);
+    return m_messageDb.forEachSince(seq, maxNumMessages, f);
 }
 
-void ConnectionManager::advertise() {
-    ESP_LOGD(TAG, "Start advertising");
-    ConnectionState currentState = m_connectionState.load();
-    if (currentState.phase == ConnectionState::CONNECTED) {
-        disconnect();
-    }
-    BLEAdvertising* pAdvertising = m_server->getAdvertising();
-    if (m_isAdvertising)
-        pAdvertising->stop();
-    pAdvertising->addServiceUUID(service_uuid);
-    pAdvertising->setScanResponse(true);
-    // preferred minimum interval after which two devices exchange info
-    pAdvertising->setMinPreferred(0x06);
-    pAdvertising->setMinPreferred(0x12);
-    pAdvertising->start();
-    m_isAdvertising = true;
+bool ConnectionManager::readMessage(
+    uint32_t seq,
+    std::function<void(model::MessageView const&)> const& f) {
+    std::lock_guard<std::mutex> lock(m_messagesMutex);
+    return m_messageDb.visit(seq, f);
 }
 
-void ConnectionManager::disconnect() {
-    auto connectionId = m_server->getConnId();
-    m_server->disconnect(connectionId);
+void ConnectionManager::readWeather(
+    std::function<void(model::Weather const&)> const& f) {
+    std::lock_guard<std::mutex> lock(m_weatherMutex);
+    f(m_weather);
 }
 
 void ConnectionManager::onConnectionStateChange(ConnectionState const& ev) {
@@ -101,7 +144,12 @@ void ConnectionManager::onConnectionStateChange(ConnectionState const& ev) {
     } else {
         ESP_LOGD(TAG, "Received network event: device is not connected\n");
     }
-    m_isAdvertising = false;
+    // a new connection has to negotiate again, and the messages for the
+    // previous one are stale
+    m_isCompressionNegotiated = false;
+    m_txQueue->clear();
+    // the phone connecting may be another one, with its own clock
+    Tracer::getInstance()->resetPhoneClock();
     m_connectionState = ev;
     auto dispatcher = RemoteDispatcher::getInstance();
     dispatcher->notify(ConnectionState::name, ConnectionState(ev));
@@ -113,37 +161,162 @@ void ConnectionManager::onBondingStateChange(BondingState const& ev) {
     dispatcher->notify(BondingState::name, BondingState(ev));
 }
 
-void ConnectionManager::onCharacteristicChange(std::string const& msg) {
-    ESP_LOGD(TAG, "A message arrived: '%s'\n", msg.c_str());
+void ConnectionManager::onCharacteristicChange(std::string_view data) {
+    int64_t start = esp_timer_get_time();
+    bool isQueued =
+        m_rxRing.push(data, isCall(data), static_cast<uint32_t>(start));
+    uint32_t elapsed = esp_timer_get_time() - start;
+
+    // the log is left to the RX task, since it would take longer than the
+    // copy
+    if (elapsed > m_maxCallbackTime)
+        m_maxCallbackTime = elapsed;
+    if (elapsed > callbackTimeBudget || !isQueued)
+        m_numSlowCallbacks++;
+}
+
+void ConnectionManager::runRx() {
+    uint32_t numSlowCallbacks = 0;
+    uint32_t receivedTime;
+    while (size_t size =
+               m_rxRing.pop(m_rxBuffer, sizeof(m_rxBuffer), receivedTime)) {
+        if (m_numSlowCallbacks != numSlowCallbacks) {
+            numSlowCallbacks = m_numSlowCallbacks;
+            ESP_LOGE(TAG,
+                     "%u writes over %u us or dropped (%u), longest copied "
+                     "in %u us",
+                     numSlowCallbacks, callbackTimeBudget,
+                     m_rxRing.getStats().m_numDropped,
+                     m_maxCallbackTime.load());
+        }
+        std::string_view data{m_rxBuffer, size};
+        SessionRecorder::getInstance()->record(SessionEvent::PHONE_WRITE,
+                                               receivedTime, data);
+        processWrite(data, receivedTime);
+    }
+}
+
+void ConnectionManager::processWrite(std::string_view data,
+                                     uint32_t receivedTime) {
+    ESP_LOGD(TAG, "A message of %u bytes arrived\n", data.size());
+
+    if (protocol::isFragment(data) &&
+        !m_reassembler.push(data, getMillis(), data))
+        return;
 
-    JsonDocument doc;
-    DeserializationError error(deserializeJson(doc, msg));
-    if (error) {
-        ESP_LOGD(TAG, "Error '%s' when deserializing\n", error.c_str());
+    // a message in fragments is traced from its last one
+    if (!protocol::isBatch(data)) {
+        handleMessage(data, receivedTime);
         return;
     }
+    auto handle = [this, receivedTime](std::string_view msg) {
+        handleMessage(msg, receivedTime);
+    };
+    if (!protocol::forEachInBatch(data, handle))
+        ESP_LOGD(TAG, "Malformed batch");
+}
 
-    std::string command(doc["command"]);
+void ConnectionManager::handleMessage(std::string_view data,
+                                      uint32_t receivedTime) {
+    // the events notified carry the id of the message to the main loop
+    auto tracer = Tracer::getInstance();
+    uint32_t traceId = tracer->begin(receivedTime);
+    TraceScope traceScope{traceId};
 
-    auto dispatcher = RemoteDispatcher::getInstance();
+    if (!protocol::isFrame(data)) {
+        // the phone speaks JSON
+        protocol::Writer writer{m_frameBuffer, sizeof(m_frameBuffer)};
+        if (!protocol::transcodeJSON(data, writer)) {
+            ESP_LOGD(TAG, "Malformed JSON message: '%.*s'\n",
+                     static_cast<int>(data.size()), data.data());
+            return;
+        }
+        data = writer.getFrame();
+    }
+
+    protocol::Frame frame;
+    if (!protocol::decodeFrame(data, frame)) {
+        ESP_LOGD(TAG, "Malformed or unsupported frame");
+        return;
+    }
+
+    if (frame.m_isCompressed) {
+        if (!m_isCompressionNegotiated) {
+            ESP_LOGD(TAG, "Compressed frame without negotiation, dropped");
+            return;
+        }
+        // the frame is either the write received or a reassembled one, not
+        // in the buffer
+        if (!protocol::lz::inflateFrame(frame, m_frameBuffer,
+                                        sizeof(m_frameBuffer), data) ||
+            !protocol::decodeFrame(data, frame)) {
+            ESP_LOGD(TAG, "Malformed compressed frame");
+            return;
+        }
+    }
+    tracer->record(traceId, TraceStage::DECODED);
+    uint32_t sentAt;
+    if (protocol::findSentAt(frame, sentAt))
+        tracer->recordSent(traceId, sentAt, receivedTime);
 
-    if (command == "n") {
-        ESP_LOGD(TAG, "Notification arrived", msg);
-        std::string typeOfNotification = doc["source"];
+    auto dispatcher = RemoteDispatcher::getInstance();
 
-        if (typeOfNotification == "call") {
+    switch (frame.m_type) {
+        case protocol::MessageType::HELLO: {
+            protocol::HelloView hello;
+            if (!protocol::decode(frame, hello))
+                return;
+            uint32_t version = protocol::negotiateVersion(hello.m_version);
+            uint32_t compression =
+                hello.m_compression == protocol::lz::codecId
+                    ? protocol::lz::codecId
+                    : 0;
+            m_isCompressionNegotiated = compression != 0;
+            ESP_LOGD(TAG, "Protocol version %u, compression %u negotiated",
+                     version, compression);
+            send(protocol::makeHelloAnswer(version, compression));
+            break;
+        }
+        case protocol::MessageType::CALL:
             ESP_LOGD(TAG, "Call notification arrived");
             dispatcher->notify(CallNotification::name, CallNotification());
-        } else {
-            m_messageDb->add(msg);
+            break;
+        case protocol::MessageType::NOTIFICATION: {
+            protocol::NotificationView notification;
+            if (!protocol::decode(frame, notification))
+                return;
+            {
+                std::lock_guard<std::mutex> lock(m_messagesMutex);
+                m_messageDb.append(notification.m_source, notification.m_sender,
+                                   notification.m_content, getMillis());
+            }
+            if (m_history)
+                m_history->append(notification.m_source, notification.m_sender,
+                                  notification.m_content, getMillis());
             ESP_LOGD(TAG, "Message notification arrived");
             dispatcher->notify(MessageNotification::name,
                                MessageNotification());
+            break;
         }
-    } else {
-        ESP_LOGD(TAG, "notifying about the message");
-        dispatcher->notify(UpdateMessage::name, UpdateMessage{msg});
-    };
+        case protocol::MessageType::WEATHER:
+        case protocol::MessageType::WEATHER_DELTA: {
+            bool isApplied;
+            {
+                std::lock_guard<std::mutex> lock(m_weatherMutex);
+                isApplied = m_weather.apply(frame);
+            }
+            if (!isApplied)
+                return;
+            ESP_LOGD(TAG, "Weather update arrived");
+            dispatcher->notify(UpdateMessage::name,
+                               UpdateMessage{std::string{data}});
+            break;
+        }
+        default:
+            ESP_LOGD(TAG, "notifying about the message");
+            dispatcher->notify(UpdateMessage::name,
+                               UpdateMessage{std::string{data}});
+    }
 }
 
 }  // namespace ble
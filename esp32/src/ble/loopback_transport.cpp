@@ -0,0 +1,75 @@
+#include "ble/loopback_transport.h"
+
+#include <esp_log.h>
+
+namespace ble {
+LoopbackTransport::LoopbackTransport(Phone phone, size_t maxPacketSize)
+    : m_phone{std::move(phone)},
+      m_maxPacketSize{maxPacketSize},
+      m_handler{nullptr},
+      m_isConnected{false},
+      m_linkProfile{controller::LinkProfile::IDLE} {}
+
+void LoopbackTransport::begin(RemoteEventsHandler* handler) {
+    m_handler = handler;
+}
+
+void LoopbackTransport::advertise() {
+    ESP_LOGD(TAG, "Advertising, waiting for connect()");
+}
+
+void LoopbackTransport::disconnect() {
+    setConnected(false);
+}
+
+void LoopbackTransport::connect() {
+    setConnected(true);
+}
+
+void LoopbackTransport::setConnected(bool isConnected) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_isConnected == isConnected)
+            return;
+        m_isConnected = isConnected;
+    }
+    m_handler->onConnectionStateChange(ConnectionState{
+        isConnected ? ConnectionState::CONNECTED
+                    : ConnectionState::DISCONNECTED});
+}
+
+bool LoopbackTransport::transmit(std::string_view packet,
+                                 [[maybe_unused]] bool isIndication) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_isConnected)
+            return false;
+    }
+    // the phone acknowledges the indications as soon as it gets them
+    m_phone(packet);
+    return true;
+}
+
+bool LoopbackTransport::write(std::string_view data) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_isConnected)
+            return false;
+    }
+    m_handler->onCharacteristicChange(data);
+    return true;
+}
+
+void LoopbackTransport::setLinkProfile(controller::LinkProfile profile) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_linkProfile = profile;
+}
+
+controller::LinkStats LoopbackTransport::getLinkStats() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    controller::LinkStats stats{};
+    stats.m_profile = m_linkProfile;
+    stats.m_dataLength = m_maxPacketSize;
+    return stats;
+}
+}  // namespace ble
@@ -0,0 +1,124 @@
+#include "ble/reconnector.h"
+
+#include <esp_log.h>
+
+namespace ble {
+Reconnector::Reconnector(Gap& gap)
+    : m_gap{gap},
+      m_phase{Phase::IDLE},
+      m_isAnyPhoneWanted{false},
+      m_isReconnecting{false},
+      m_disconnectionTime{0} {}
+
+void Reconnector::onDisconnected(int64_t now) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_disconnectionTime = now;
+    m_isReconnecting = !m_isAnyPhoneWanted;
+    if (m_isAnyPhoneWanted) {
+        m_isAnyPhoneWanted = false;
+        enter(Phase::FAST);
+    } else {
+        enter(Phase::DIRECTED);
+    }
+}
+
+void Reconnector::onConnected(int64_t now) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    Phase phase = m_phase;
+    m_gap.stopTimer();
+    m_phase = Phase::CONNECTED;
+    if (!m_isReconnecting || phase == Phase::CONNECTED)
+        return;
+    m_isReconnecting = false;
+
+    uint32_t elapsed = (now - m_disconnectionTime) / 1000;
+    m_stats.m_numReconnections++;
+    m_stats.m_lastTime = elapsed;
+    if (elapsed > m_stats.m_maxTime)
+        m_stats.m_maxTime = elapsed;
+    m_stats.m_lastPhase = phase;
+    ESP_LOGD(TAG, "Connected in %u ms through %s advertising, at most %u ms",
+             elapsed, getPhaseName(phase), m_stats.m_maxTime);
+}
+
+void Reconnector::advertiseToAny() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_phase == Phase::CONNECTED) {
+        m_isAnyPhoneWanted = true;
+        return;
+    }
+    // a new phone pairing, not a reconnection
+    m_isReconnecting = false;
+    m_gap.stopAdvertising();
+    enter(Phase::FAST);
+}
+
+void Reconnector::onTimeout() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    // a timer expiring as the phase changed is stale
+    if (m_phase == Phase::DIRECTED) {
+        m_gap.stopAdvertising();
+        enter(Phase::FAST);
+    } else if (m_phase == Phase::FAST) {
+        m_gap.stopAdvertising();
+        enter(Phase::SLOW);
+    }
+}
+
+Reconnector::Phase Reconnector::getPhase() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_phase;
+}
+
+Reconnector::Stats Reconnector::getStats() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_stats;
+}
+
+char const* Reconnector::getPhaseName(Phase phase) {
+    switch (phase) {
+        case Phase::IDLE:
+            return "idle";
+        case Phase::DIRECTED:
+            return "directed";
+        case Phase::FAST:
+            return "fast";
+        case Phase::SLOW:
+            return "slow";
+        case Phase::CONNECTED:
+            return "connected";
+    }
+    return "";
+}
+
+void Reconnector::enter(Phase phase) {
+    Address address;
+    uint8_t addressType;
+    if (phase == Phase::DIRECTED &&
+        !m_gap.findBondedPeer(address, addressType)) {
+        ESP_LOGD(TAG, "No phone bonded, waiting for a new one");
+        m_gap.stopTimer();
+        m_phase = Phase::IDLE;
+        return;
+    }
+
+    ESP_LOGD(TAG, "%s advertising", getPhaseName(phase));
+    m_phase = phase;
+    switch (phase) {
+        case Phase::DIRECTED:
+            m_gap.advertiseDirected(address, addressType);
+            m_gap.startTimer(directedWindow);
+            break;
+        case Phase::FAST:
+            m_gap.advertiseUndirected(fastMinInterval, fastMaxInterval);
+            m_gap.startTimer(fastWindow);
+            break;
+        case Phase::SLOW:
+            m_gap.advertiseUndirected(slowMinInterval, slowMaxInterval);
+            m_gap.stopTimer();
+            break;
+        default:
+            break;
+    }
+}
+}  // namespace ble
@@ -0,0 +1,98 @@
+#include "ble/rx_ring.h"
+
+#include <esp_log.h>
+#include <algorithm>
+#include <cstring>
+
+namespace ble {
+RxRing::Ring::Ring(size_t capacity)
+    : m_capacity{capacity},
+      m_data{std::make_unique<char[]>(capacity)},
+      m_head{0},
+      m_tail{0},
+      m_used{0} {}
+
+void RxRing::Ring::write(char const* data, size_t size) {
+    size_t first = std::min(size, m_capacity - m_head);
+    memcpy(m_data.get() + m_head, data, first);
+    memcpy(m_data.get(), data + first, size - first);
+    m_head = (m_head + size) % m_capacity;
+    m_used += size;
+}
+
+void RxRing::Ring::read(char* data, size_t size) {
+    size_t first = std::min(size, m_capacity - m_tail);
+    memcpy(data, m_data.get() + m_tail, first);
+    memcpy(data + first, m_data.get(), size - first);
+    m_tail = (m_tail + size) % m_capacity;
+    m_used -= size;
+}
+
+RxRing::RxRing(size_t capacity, size_t urgentCapacity)
+    : m_isStopping{false}, m_urgent{urgentCapacity}, m_normal{capacity} {}
+
+bool RxRing::push(std::string_view data, bool isUrgent, uint32_t time) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        Ring& ring = isUrgent ? m_urgent : m_normal;
+        size_t size = headerSize + data.size();
+        if (data.size() > UINT16_MAX || ring.m_used + size > ring.m_capacity) {
+            m_stats.m_numDropped++;
+            return false;
+        }
+        char header[headerSize] = {static_cast<char>(data.size() & 0xFF),
+                                   static_cast<char>(data.size() >> 8),
+                                   static_cast<char>(time & 0xFF),
+                                   static_cast<char>(time >> 8),
+                                   static_cast<char>(time >> 16),
+                                   static_cast<char>(time >> 24)};
+        ring.write(header, headerSize);
+        ring.write(data.data(), data.size());
+        m_stats.m_numPushed++;
+        m_stats.m_used += size;
+        m_stats.m_maxUsed = std::max(m_stats.m_maxUsed, m_stats.m_used);
+    }
+    m_cv.notify_one();
+    return true;
+}
+
+size_t RxRing::pop(char* buffer, size_t capacity, uint32_t& time) {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true) {
+        m_cv.wait(lock,
+                  [this]() { return m_isStopping || m_stats.m_used > 0; });
+        if (m_isStopping)
+            return 0;
+
+        Ring& ring = m_urgent.m_used > 0 ? m_urgent : m_normal;
+        char header[headerSize];
+        ring.read(header, headerSize);
+        auto byte = [&header](size_t idx) -> uint32_t {
+            return static_cast<uint8_t>(header[idx]);
+        };
+        size_t size = byte(0) | byte(1) << 8;
+        time = byte(2) | byte(3) << 8 | byte(4) << 16 | byte(5) << 24;
+        m_stats.m_used -= headerSize + size;
+        if (size <= capacity && size > 0) {
+            ring.read(buffer, size);
+            return size;
+        }
+        ESP_LOGD(TAG, "Write of %u bytes discarded", size);
+        ring.m_tail = (ring.m_tail + size) % ring.m_capacity;
+        ring.m_used -= size;
+    }
+}
+
+void RxRing::stop() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_isStopping = true;
+    }
+    m_cv.notify_one();
+}
+
+RxRing::Stats RxRing::getStats() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_stats;
+}
+}  // namespace ble
@@ -0,0 +1,163 @@
+#include "ble/tx_queue.h"
+
+#include <esp_log.h>
+#include <esp_timer.h>
+#include "protocol/batch.h"
+#include "protocol/reassembler.h"
+
+namespace ble {
+TxQueue::TxQueue(Link link,
+                 std::function<size_t()> getMaxPacketSize,
+                 size_t capacity)
+    : m_link{std::move(link)},
+      m_getMaxPacketSize{std::move(getMaxPacketSize)},
+      m_capacity{capacity},
+      m_isStopping{false},
+      m_size{0},
+      m_idFragmented{0} {
+    m_sender = std::thread([this]() { run(); });
+}
+
+TxQueue::~TxQueue() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_isStopping = true;
+    }
+    m_cv.notify_one();
+    m_sender.join();
+}
+
+bool TxQueue::push(std::string msg) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_size + msg.size() > m_capacity) {
+            ESP_LOGD(TAG, "Queue full, message of %u bytes rejected",
+                     msg.size());
+            m_stats.m_numMessagesRejected++;
+            return false;
+        }
+        m_size += msg.size();
+        m_messages.push_back(std::move(msg));
+        m_stats.m_numMessagesQueued++;
+        m_stats.m_depth = m_messages.size();
+        if (m_stats.m_depth > m_stats.m_maxDepth)
+            m_stats.m_maxDepth = m_stats.m_depth;
+    }
+    m_cv.notify_one();
+    return true;
+}
+
+void TxQueue::clear() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stats.m_numMessagesDropped += m_messages.size();
+    m_messages.clear();
+    m_size = 0;
+    m_stats.m_depth = 0;
+}
+
+TxQueue::Stats TxQueue::getStats() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_stats;
+}
+
+void TxQueue::takePackets(size_t maxPacketSize, std::deque<Packet>& packets) {
+    std::string& front = m_messages.front();
+    size_t numTaken = 1;
+    size_t sizeTaken = front.size();
+
+    if (front.size() > maxPacketSize) {
+        protocol::Fragmenter fragmenter{front, m_idFragmented++,
+                                        maxPacketSize};
+        std::string fragment(maxPacketSize, '\0');
+        while (size_t size = fragmenter.next(fragment.data())) {
+            packets.push_back(Packet{fragment.substr(0, size), 0});
+        }
+        if (packets.empty()) {
+            ESP_LOGE(TAG, "Message of %u bytes too long, dropped",
+                     front.size());
+            m_stats.m_numMessagesDropped++;
+        } else {
+            // the message is lost with its last fragment at least
+            packets.back().m_numMessages = 1;
+        }
+        m_messages.pop_front();
+    } else if (m_messages.size() == 1 ||
+               1 + protocol::getBatchedSize(front) +
+                       protocol::getBatchedSize(m_messages[1]) >
+                   maxPacketSize) {
+        packets.push_back(Packet{std::move(front), 1});
+        m_messages.pop_front();
+    } else {
+        std::string batch;
+        sizeTaken = 0;
+        numTaken = 0;
+        while (!m_messages.empty() &&
+               m_messages.front().size() <= maxPacketSize) {
+            std::string const& msg = m_messages.front();
+            size_t batchedSize =
+                protocol::getBatchedSize(msg) + (batch.empty() ? 1 : 0);
+            if (batch.size() + batchedSize > maxPacketSize)
+                break;
+            protocol::appendToBatch(batch, msg);
+            sizeTaken += msg.size();
+            numTaken++;
+            m_messages.pop_front();
+        }
+        packets.push_back(
+            Packet{std::move(batch), static_cast<uint32_t>(numTaken)});
+    }
+
+    m_size -= sizeTaken;
+    m_stats.m_depth = m_messages.size();
+    ESP_LOGD(TAG, "%u messages packed into %u packets, %u waiting", numTaken,
+             packets.size(), m_messages.size());
+}
+
+void TxQueue::run() {
+    std::deque<Packet> packets;
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true) {
+        m_cv.wait(lock,
+                  [this]() { return m_isStopping || !m_messages.empty(); });
+        if (m_isStopping)
+            return;
+        takePackets(m_getMaxPacketSize(), packets);
+
+        while (!packets.empty()) {
+            Packet& packet = packets.front();
+            // the end of the backlog waits for the phone to catch up
+            bool isIndication = packets.size() == 1 && m_messages.empty();
+            lock.unlock();
+            int64_t start = esp_timer_get_time();
+            bool isDelivered = m_link(packet.m_data, isIndication);
+            int64_t elapsed = esp_timer_get_time() - start;
+            lock.lock();
+
+            m_stats.m_sendTime += elapsed;
+            if (isIndication)
+                m_stats.m_numIndications++;
+            else
+                m_stats.m_numNotifications++;
+            if (isDelivered) {
+                m_stats.m_numBytesSent += packet.m_data.size();
+            } else {
+                ESP_LOGD(TAG, "Packet of %u bytes not delivered",
+                         packet.m_data.size());
+                m_stats.m_numPacketsFailed++;
+                m_stats.m_numMessagesDropped += packet.m_numMessages;
+            }
+            packets.pop_front();
+
+            uint32_t numPackets =
+                m_stats.m_numIndications + m_stats.m_numNotifications;
+            if (numPackets % statsPeriod == 0 && m_stats.m_sendTime > 0)
+                ESP_LOGD(TAG,
+                         "%u packets, %u bytes sent at %llu B/s, max depth %u",
+                         numPackets, m_stats.m_numBytesSent,
+                         m_stats.m_numBytesSent * 1000000ull /
+                             m_stats.m_sendTime,
+                         m_stats.m_maxDepth);
+        }
+    }
+}
+}  // namespace ble
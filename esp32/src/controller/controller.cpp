@@ -5,5 +5,11 @@
 namespace controller {
 void CentralController::changePage(view::PageType page) {
     m_window->setPage(page);
+    // streams arrive on the translation page only, elsewhere the link can
+    // save power
+    if (m_remoteController)
+        m_remoteController->setLinkProfile(page == view::PageType::TRANSLATION
+                                               ? LinkProfile::INTERACTIVE
+                                               : LinkProfile::IDLE);
 }
 }  // namespace controller
\ No newline at end of file
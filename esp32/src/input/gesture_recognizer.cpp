@@ -0,0 +1,154 @@
+#include "input/gesture_recognizer.h"
+
+// an input with no row leaves the gesture in progress as it is
+GestureRecognizer::Transition const GestureRecognizer::transitions[] = {
+    {State::IDLE, Input::PRESS, State::DOWN, Action::START},
+    {State::DOWN, Input::RELEASE, State::RELEASED, Action::AWAIT_SECOND},
+    {State::DOWN, Input::TIMEOUT, State::HELD, Action::LONG_PRESS},
+    {State::DOWN, Input::SLIDE, State::SLIDING, Action::STEP},
+    {State::DOWN, Input::ARRIVE, State::DONE, Action::SWIPE},
+    {State::SLIDING, Input::SLIDE, State::SLIDING, Action::STEP},
+    {State::SLIDING, Input::ARRIVE, State::DONE, Action::SWIPE},
+    // too slow to be a swipe
+    {State::SLIDING, Input::TIMEOUT, State::DONE, Action::NONE},
+    {State::SLIDING, Input::RELEASE, State::IDLE, Action::NONE},
+    {State::HELD, Input::TIMEOUT, State::HELD, Action::REPEAT},
+    {State::HELD, Input::RELEASE, State::IDLE, Action::NONE},
+    {State::RELEASED, Input::TIMEOUT, State::IDLE, Action::TAP},
+    {State::RELEASED, Input::PRESS, State::DOWN, Action::TAP_AND_START},
+    {State::RELEASED, Input::PRESS_AGAIN, State::SECOND_DOWN, Action::NONE},
+    {State::SECOND_DOWN, Input::RELEASE, State::IDLE, Action::DOUBLE_TAP},
+    {State::DONE, Input::RELEASE, State::IDLE, Action::NONE},
+};
+
+GestureRecognizer::GestureRecognizer(
+    size_t numPads,
+    GestureTimings const& timings,
+    std::function<void(GestureEvent const&)> onGesture)
+    : m_numPads{numPads},
+      m_timings{timings},
+      m_onGesture{std::move(onGesture)},
+      m_state{State::IDLE},
+      m_pads{0},
+      m_deadline{noDeadline},
+      m_pad{0},
+      m_lastPad{0},
+      m_pressedPad{0} {}
+
+void GestureRecognizer::update(uint8_t pads, int64_t now) {
+    // the deadlines passed before the pads changed
+    expire(now);
+    uint8_t previous = m_pads;
+    m_pads = pads;
+    Input input;
+    if (classify(previous, pads, input))
+        apply(input, now);
+    // the ones set by the change, e.g. a tap not waiting for a second one
+    expire(now);
+}
+
+bool GestureRecognizer::classify(uint8_t previous, uint8_t pads, Input& input) {
+    if (pads == previous)
+        return false;
+    if (pads == 0) {
+        input = Input::RELEASE;
+        return true;
+    }
+    if (previous == 0) {
+        // the first pad of the row if more are touched at once
+        m_pressedPad = __builtin_ctz(pads);
+        input = m_state == State::RELEASED && m_pressedPad == m_pad
+                    ? Input::PRESS_AGAIN
+                    : Input::PRESS;
+        return true;
+    }
+
+    int direction = getDirection();
+    int next = m_lastPad + direction;
+    uint8_t touched = pads & ~previous;
+    if (m_timings.m_swipeStep == 0 || direction == 0 || next < 0 ||
+        next >= static_cast<int>(m_numPads) || !(touched & 1 << next))
+        return false;
+    bool isOtherEnd = next == 0 || next == static_cast<int>(m_numPads) - 1;
+    input = isOtherEnd ? Input::ARRIVE : Input::SLIDE;
+    return true;
+}
+
+void GestureRecognizer::apply(Input input, int64_t time) {
+    for (Transition const& transition : transitions) {
+        if (transition.m_from != m_state || transition.m_input != input)
+            continue;
+        m_state = transition.m_to;
+        perform(transition.m_action, time);
+        return;
+    }
+}
+
+void GestureRecognizer::perform(Action action, int64_t time) {
+    m_deadline = noDeadline;
+    switch (action) {
+        case Action::NONE:
+            break;
+        case Action::TAP_AND_START:
+            emit(Gesture::TAP, time);
+            [[fallthrough]];
+        case Action::START:
+            m_pad = m_pressedPad;
+            m_lastPad = m_pressedPad;
+            setDeadline(time, getDirection() != 0 ? m_timings.m_endLongPress
+                                                  : m_timings.m_longPress);
+            break;
+        case Action::AWAIT_SECOND:
+            // timed out at once if double taps are disabled
+            m_deadline = time + m_timings.m_doubleTapWindow * int64_t{1000};
+            break;
+        case Action::TAP:
+            emit(Gesture::TAP, time);
+            break;
+        case Action::DOUBLE_TAP:
+            emit(Gesture::DOUBLE_TAP, time);
+            break;
+        case Action::LONG_PRESS:
+            emit(Gesture::LONG_PRESS, time);
+            if (m_timings.m_repeatInterval > 0)
+                setDeadline(time, m_timings.m_repeatDelay);
+            break;
+        case Action::REPEAT:
+            emit(Gesture::REPEAT, time);
+            setDeadline(time, m_timings.m_repeatInterval);
+            break;
+        case Action::STEP:
+            m_lastPad += getDirection();
+            setDeadline(time, m_timings.m_swipeStep);
+            break;
+        case Action::SWIPE:
+            emit(m_pad == 0 ? Gesture::SWIPE_CLOCKWISE
+                            : Gesture::SWIPE_ANTI_CLOCKWISE,
+                 time);
+            break;
+    }
+}
+
+void GestureRecognizer::emit(Gesture gesture, int64_t time) {
+    m_onGesture(GestureEvent{gesture, m_pad, time});
+}
+
+void GestureRecognizer::setDeadline(int64_t time, uint32_t ms) {
+    m_deadline = ms > 0 ? time + ms * int64_t{1000} : noDeadline;
+}
+
+void GestureRecognizer::expire(int64_t now) {
+    while (m_deadline != noDeadline && m_deadline <= now) {
+        int64_t deadline = m_deadline;
+        m_deadline = noDeadline;
+        apply(Input::TIMEOUT, deadline);
+    }
+}
+
+int GestureRecognizer::getDirection() const {
+    if (m_pad == 0)
+        return 1;
+    if (m_pad == m_numPads - 1)
+        return -1;
+    return 0;
+}
@@ -1,5 +1,30 @@
 #include "input/input_manager.h"
 
+#include <esp_pthread.h>
+#include <esp_timer.h>
+#include <algorithm>
+#include <memory>
+#include "utility/touch_tracer.h"
+#include "view/main_event_queue.h"
+
+namespace {
+SessionEvent toSessionEvent(Press const&) {
+    return SessionEvent::PRESS;
+}
+
+SessionEvent toSessionEvent(Click const&) {
+    return SessionEvent::CLICK;
+}
+
+SessionEvent toSessionEvent(SwipeClockwise const&) {
+    return SessionEvent::SWIPE_CLOCKWISE;
+}
+
+SessionEvent toSessionEvent(SwipeAntiClockwise const&) {
+    return SessionEvent::SWIPE_ANTI_CLOCKWISE;
+}
+}  // namespace
+
 InputManager* InputManager::instance = nullptr;
 
 InputManager* InputManager::getInstance() {
@@ -9,7 +34,11 @@ InputManager* InputManager::getInstance() {
     return instance;
 }
 
-InputManager::InputManager() {
+InputManager::InputManager()
+    : m_recognizer{numPads, GestureTimings{},
+                   [this](GestureEvent const& gesture) {
+                       onGesture(gesture);
+                   }} {
     Wire.begin();
     delay(1000);
 
@@ -29,251 +58,140 @@ InputManager::InputManager() {
 
     sensor.setSensitivity(SENSITIVITY_2X);
     ESP_LOGD(TAG, "current sensitivity is %ldX\n", sensor.getSensitivity());
+    setupInterrupt();
+
+    esp_pthread_cfg_t config = esp_pthread_get_default_config();
+    config.stack_size = inputTaskStackSize;
+    config.thread_name = "input";
+    esp_pthread_set_cfg(&config);
+    m_inputThread = std::thread([this]() { runInput(); });
+    // the threads started later by this one get the default configuration
+    config = esp_pthread_get_default_config();
+    esp_pthread_set_cfg(&config);
 }
 
-/*
-The device used to detect input has no double click or press key
-functionality, hence the following mappings will be used
-instead:  - left: pressing right: double click
-*/
-
-void InputManager::handleInput() {
-    if (sensor.isLeftTouched()) {
-        ESP_LOGD(TAG, "Left");
-        while (sensor.isLeftTouched() == true)
-            ;
-        notify(SwipeAntiClockwise::name, SwipeAntiClockwise());
-        return;
-    }
-
-    if (sensor.isRightTouched()) {
-        ESP_LOGD(TAG, "Right");
-        while (sensor.isRightTouched() == true)
-            ;
-        notify(SwipeClockwise::name, SwipeClockwise());
-        return;
-    }
-
-    if (sensor.isMiddleTouched()) {
-        ESP_LOGD(TAG, "Middle");
-        auto start = std::chrono::high_resolution_clock::now();
-        while (sensor.isMiddleTouched() == true)
-            ;
-        auto end = std::chrono::high_resolution_clock::now();
-
-        int64_t elapsed_ms =
-            std::chrono::duration_cast<std::chrono::milliseconds>(end - start)
-                .count();
-
-        ESP_LOGD(TAG, "elapsedMs = %lld\ttimeMs = %ld", elapsed_ms, m_timeMs);
-
-        if (elapsed_ms >= m_timeMs) {
-            ESP_LOGD(TAG, "Press");
-            notify(Press::name, Press());
-            return;
-        }
-
-        ESP_LOGD(TAG, "Click");
-        notify(Click::name, Click());
-        return;
-    }
+void InputManager::setupInterrupt() {
+    // a pad held does not assert ALERT again until released
+    sensor.writeRegister(REPEAT_RATE_ENABLE, 0);
+    // INT_REL_n cleared: ALERT on the releases too
+    sensor.writeRegister(CONFIG_2, sensor.readRegister(CONFIG_2) & ~0x01);
+    sensor.setInterruptEnabled();
+    sensor.clearInterrupt();
 }
 
-#if 0
-InputManager::USER_ACTION InputManager::detectTouchFromLeftToRight() {
-    bool isLeftTouched = false;
-    unsigned long startTime = millis();
-    while ((millis() - startTime) < 100) {
-        if (sensor.isLeftTouched()) {
-            isLeftTouched = true;
-            break;
-        }
-    }
-
-    startTime = millis();
-    bool isMiddleTouched = false;
-    while ((millis() - startTime) < 100) {
-        if (sensor.isMiddleTouched()) {
-            isMiddleTouched = true;
-            break;
-        }
-    }
-
-    if (!isMiddleTouched) {
-        if (isLeftTouched)
-            return LEFT;
-    } else {
-        if (!isLeftTouched)
-            return MIDDLE;
-    }
-
-    startTime = millis();
-    bool isRightSwiped = false;
-    while ((millis() - startTime) < 100) {
-        if (sensor.isRightTouched() == true) {
-            isRightSwiped = true;
-            break;
-        }
-    }
-
-    if (isRightSwiped) {
-        // swipe from left->right completed
-        if (isLeftTouched) {
-            return SWIPE_CLOCKWISE;
-        } else {
-            return RIGHT;
-        }
-    }
-
-    return NONE;
+void IRAM_ATTR InputManager::onAlert(void* inputTask) {
+    BaseType_t isHigherPriorityTaskWoken = pdFALSE;
+    vTaskNotifyGiveFromISR(static_cast<TaskHandle_t>(inputTask),
+                           &isHigherPriorityTaskWoken);
+    if (isHigherPriorityTaskWoken)
+        portYIELD_FROM_ISR();
 }
-#endif
-
-#if 0
-InputManager::USER_ACTION InputManager::detectTouchFromLeftToRight() {
-    bool isLeftTouched = sensor.isLeftTouched();
-    bool isMiddleTouched = sensor.isMiddleTouched();
-    bool isRightTouched = sensor.isRightTouched();
-
-    if (isLeftTouched) {
-        if (!isMiddleTouched)
-            return LEFT;
-        if (isRightTouched)
-            return SWIPE_CLOCKWISE;
-        return NONE;
-    } else if (isMiddleTouched) {
-        return MIDDLE;
-    } else {
-
-    }
-
-    bool isLeftTouched = false;
-    unsigned long startTime = millis();
-    while ((millis() - startTime) < 100) {
-        if (sensor.isLeftTouched()) {
-            isLeftTouched = true;
-            break;
-        }
-    }
-
-    startTime = millis();
-    bool isMiddleTouched = false;
-    while ((millis() - startTime) < 100) {
-        if (sensor.isMiddleTouched()) {
-            isMiddleTouched = true;
-            break;
-        }
-    }
-
-    if (!isMiddleTouched) {
-        if (isLeftTouched)
-            return LEFT;
-    } else {
-        if (!isLeftTouched)
-            return MIDDLE;
-    }
-
-    startTime = millis();
-    bool isRightSwiped = false;
-    while ((millis() - startTime) < 100) {
-        if (sensor.isRightTouched() == true) {
-            isRightSwiped = true;
-            break;
-        }
-    }
 
-    if (isRightSwiped) {
-        // swipe from left->right completed
-        if (isLeftTouched) {
-            return SWIPE_CLOCKWISE;
-        } else {
-            return RIGHT;
+void InputManager::runInput() {
+    pinMode(alertPin, INPUT_PULLUP);
+    // the handle goes with the interrupt: an edge as soon as it is attached,
+    // e.g. before getInstance() returned, finds the task to wake
+    attachInterruptArg(digitalPinToInterrupt(alertPin), onAlert,
+                       xTaskGetCurrentTaskHandle(), FALLING);
+    // touched before the interrupt was attached
+    sample(esp_timer_get_time());
+
+    while (true) {
+        // woken by the deadline of the gesture in progress as well, e.g. a
+        // long press, the pads unchanged
+        TickType_t timeout = pdMS_TO_TICKS(alertCheckPeriod);
+        int64_t deadline = m_recognizer.getDeadline();
+        if (deadline != GestureRecognizer::noDeadline) {
+            // rounded up, not to wake up before the deadline
+            int64_t tick = portTICK_PERIOD_MS * 1000;
+            int64_t remaining = deadline - esp_timer_get_time();
+            timeout = std::clamp<int64_t>((remaining + tick - 1) / tick, 0,
+                                          timeout);
         }
+        bool isWoken = ulTaskNotifyTake(pdTRUE, timeout) > 0;
+        int64_t now = esp_timer_get_time();
+        if (isWoken || digitalRead(alertPin) == LOW)
+            sample(now);
+        else
+            m_recognizer.update(m_recognizer.getPads(), now);
     }
-
-    return NONE;
 }
 
-InputManager::USER_ACTION InputManager::detectTouchFromRightToLeft() {
-    bool isRightTouched = false;
+void InputManager::sample(int64_t now) {
+    // the status latches the pads touched since the interrupt was cleared,
+    // once cleared it keeps the ones still touched: a tap between two reads
+    // is seen as well
+    uint8_t latched = sensor.readRegister(SENSOR_INPUT_STATUS);
+    sensor.clearInterrupt();
+    uint8_t touched = sensor.readRegister(SENSOR_INPUT_STATUS);
+    m_recognizer.update(latched & padMask, now);
+    m_recognizer.update(touched & padMask, now);
+}
 
-    unsigned long startTime = millis();
-    while ((millis() - startTime) < 100) {
-        if (sensor.isRightTouched()) {
-            isRightTouched = true;
+void InputManager::onGesture(GestureEvent const& gesture) {
+    // the sensor has no double tap: the side pads scroll, once or repeated
+    // while held, the middle one clicks or presses
+    switch (gesture.m_gesture) {
+        case Gesture::TAP:
+        case Gesture::LONG_PRESS:
+        case Gesture::REPEAT:
+            if (gesture.m_pad == leftPad) {
+                post(SwipeAntiClockwise(), gesture.m_time);
+            } else if (gesture.m_pad == rightPad) {
+                post(SwipeClockwise(), gesture.m_time);
+            } else if (gesture.m_gesture == Gesture::TAP) {
+                post(Click(), gesture.m_time);
+            } else if (gesture.m_gesture == Gesture::LONG_PRESS) {
+                post(Press(), gesture.m_time);
+            }
             break;
-        }
-    }
-
-    startTime = millis();
-    bool isMiddleTouched = false;
-    while ((millis() - startTime) < 100) {
-        if (sensor.isMiddleTouched()) {
-            isMiddleTouched = true;
+        case Gesture::SWIPE_CLOCKWISE:
+            post(SwipeClockwise(), gesture.m_time);
             break;
-        }
-    }
-
-    if (!isMiddleTouched) {
-        if (isRightTouched)
-            return RIGHT;
-    } else {
-        if (!isRightTouched)
-            return MIDDLE;
-    }
-
-    startTime = millis();
-    bool isLeftTouched = false;
-    while ((millis() - startTime) < 100) {
-        if (sensor.isLeftTouched()) {
-            isLeftTouched = true;
+        case Gesture::SWIPE_ANTI_CLOCKWISE:
+            post(SwipeAntiClockwise(), gesture.m_time);
+            break;
+        case Gesture::DOUBLE_TAP:
             break;
-        }
-    }
-
-    if (isLeftTouched) {
-        // swipe from left->right completed
-        if (isRightTouched) {
-            return SWIPE_ANTI_CLOCKWISE;
-        } else {
-            return LEFT;
-        }
     }
-
-    return NONE;
 }
 
-void InputManager::handleInput() {
-    auto action = detectTouchFromLeftToRight();
-    if (action == NONE)
-        action = detectTouchFromRightToLeft();
-
-    if (action == NONE)
-        return;
-
-    switch (action) {
-        case LEFT:
-            ESP_LOGD(TAG, "Left");
-            notify(Press::name, Press());
+void InputManager::inject(SessionEvent event) {
+    int64_t now = esp_timer_get_time();
+    switch (event) {
+        case SessionEvent::PRESS:
+            post(Press(), now);
             break;
-        case MIDDLE:
-            ESP_LOGD(TAG, "Middle");
-            notify(Click::name, Click());
+        case SessionEvent::CLICK:
+            post(Click(), now);
             break;
-        case RIGHT:
-            ESP_LOGD(TAG, "Right");
-            notify(DoubleClick::name, DoubleClick());
+        case SessionEvent::SWIPE_CLOCKWISE:
+            post(SwipeClockwise(), now);
             break;
-        case SWIPE_CLOCKWISE:
-            ESP_LOGD(TAG, "Swipe clockwise");
-            notify(SwipeClockwise::name, SwipeClockwise());
+        case SessionEvent::SWIPE_ANTI_CLOCKWISE:
+            post(SwipeAntiClockwise(), now);
             break;
-        case SWIPE_ANTI_CLOCKWISE:
-            ESP_LOGD(TAG, "Swipe anti clockwise");
-            notify(SwipeAntiClockwise::name, SwipeAntiClockwise());
+        case SessionEvent::PHONE_WRITE:
             break;
-        default:
-            ESP_LOGD(TAG, "No action");
     }
 }
-#endif
+
+template <typename E>
+void InputManager::post(E event, int64_t time) {
+    event.m_time = time;
+    SessionRecorder::getInstance()->record(toSessionEvent(event),
+                                           static_cast<uint32_t>(time));
+    int64_t postTime = esp_timer_get_time();
+    // the observers, e.g. the pages, are notified by the main loop; a touch
+    // goes before a burst of messages, after a call
+    view::MainEventQueue::getInstance()->push(
+        std::make_unique<view::RemoteProcedure>(
+            [this, event, postTime]() {
+                TouchTracer* tracer = TouchTracer::getInstance();
+                tracer->beginHandling(toSessionEvent(event), event.m_time,
+                                      postTime);
+                notify(E::name, event);
+                tracer->endHandling();
+            },
+            view::UIEventPriority::GESTURE));
+}
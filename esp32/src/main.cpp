@@ -1,19 +1,91 @@
 #include <Arduino.h>
 
+#include <esp_timer.h>
 #include <memory>
 
+#include "ble/ble_transport.h"
 #include "ble/connection_manager.h"
 #include "controller/central_controller.h"
 #include "esp_heap_caps.h"
+#include "input/input_manager.h"
+#include "storage/partition_flash.h"
+#include "utility/session_recorder.h"
+#include "utility/session_replayer.h"
+#include "utility/touch_tracer.h"
+#include "utility/tracer.h"
 #include "view/main_event_queue.h"
 #include "view/page/page_factory_impl.h"
 #include "view/ui_event.h"
 #include "view/window.h"
 
 auto mainEventQueue = view::MainEventQueue::getInstance();
+auto tracer = Tracer::getInstance();
+auto touchTracer = TouchTracer::getInstance();
 
 char const TAG[] = "main";
 
+// data partition of the flash keeping the history of the messages
+char const historyPartitionLabel[] = "spiffs";
+
+// data partition of the flash a session is recorded into and replayed from,
+// see SessionRecorder: built with -DSESSION_RECORD the device records the
+// session from the boot, streamed over the serial port if the partition
+// table has none; built with -DSESSION_REPLAY=<speed> it replays it after
+// the setup, <speed> times faster than recorded
+char const sessionPartitionLabel[] = "session";
+
+// the trace being replayed, and the replayer timing the frames of the loop
+std::unique_ptr<storage::Flash> sessionFlash;
+std::unique_ptr<SessionReplayer> replayer;
+
+// milliseconds the loop waits for an event before its periodic work, e.g.
+// the logs
+constexpr uint32_t loopPeriod = 100;
+
+// milliseconds between two logs of the metrics of the link
+constexpr uint32_t linkStatsPeriod = 10000;
+
+void logLinkStats(controller::CentralController* controller) {
+    static uint32_t lastLogTime = 0;
+    if (!controller->isConnected() || millis() - lastLogTime < linkStatsPeriod)
+        return;
+    lastLogTime = millis();
+    controller::LinkStats stats = controller->getLinkStats();
+    ESP_LOGD(TAG,
+             "Link %s: interval %u, latency %u, timeout %u, data length %u, "
+             "%s PHY, goodput %u B/s, reconnected in %u ms, %u writes "
+             "dropped",
+             stats.m_profile == controller::LinkProfile::INTERACTIVE
+                 ? "interactive"
+                 : "idle",
+             stats.m_interval, stats.m_latency, stats.m_timeout,
+             stats.m_dataLength, stats.m_is2MPhy ? "2M" : "1M",
+             stats.m_goodput, stats.m_reconnectionTime,
+             stats.m_numRxDropped);
+}
+
+// latencies of the messages of the phone and of the touches, logged along
+// with the link ones if new messages or gestures were handled
+void logTraces() {
+    static uint32_t lastLogTime = 0;
+    static uint32_t lastNumDrawn = 0;
+    static uint32_t lastNumHandled = 0;
+    if (millis() - lastLogTime < linkStatsPeriod)
+        return;
+    if (tracer->getNumDrawn() != lastNumDrawn) {
+        lastLogTime = millis();
+        lastNumDrawn = tracer->getNumDrawn();
+        ESP_LOGD(TAG, "Latencies from the phone to the screen:\n%s",
+                 tracer->dump().c_str());
+    }
+    if (touchTracer->getNumHandled() != lastNumHandled) {
+        lastLogTime = millis();
+        lastNumHandled = touchTracer->getNumHandled();
+        ESP_LOGD(TAG, "Latencies from the touches to the screen:\n%s",
+                 touchTracer->dump().c_str());
+    }
+}
+
 void heap_caps_alloc_failed_hook(size_t requested_size,
                                  uint32_t caps,
                                  const char* function_name) {
@@ -27,6 +99,33 @@ void heap_caps_alloc_failed_hook(size_t requested_size,
     ESP_LOGD(TAG, "######");
 }
 
+void recordSession() {
+    sessionFlash = storage::PartitionFlash::open(sessionPartitionLabel);
+    SessionRecorder::getInstance()->start(
+        sessionFlash
+            ? SessionRecorder::makeFlashSink(std::move(sessionFlash))
+            : SessionRecorder::makeTextSink(
+                  [](char const* line) { Serial.println(line); }));
+}
+
+void replaySession(ble::ConnectionManager* connectionManager,
+                   uint32_t speed) {
+    sessionFlash = storage::PartitionFlash::open(sessionPartitionLabel);
+    if (!sessionFlash) {
+        ESP_LOGE(TAG, "No partition '%s' to replay", sessionPartitionLabel);
+        return;
+    }
+    replayer = std::make_unique<SessionReplayer>(
+        *sessionFlash,
+        [connectionManager](SessionEvent event, std::string_view payload) {
+            if (event == SessionEvent::PHONE_WRITE)
+                connectionManager->onCharacteristicChange(payload);
+            else
+                InputManager::getInstance()->inject(event);
+        });
+    replayer->start(speed);
+}
+
 void setup() {
     Serial.begin(115200);
     delay(3000);
@@ -41,8 +140,14 @@ void setup() {
     controller::CentralController* controller =
         controller::CentralController::getInstance();
 
+    std::unique_ptr<storage::Flash> historyFlash =
+        storage::PartitionFlash::open(historyPartitionLabel);
     std::unique_ptr<ble::ConnectionManager> connectionManager =
-        std::make_unique<ble::ConnectionManager>();
+        std::make_unique<ble::ConnectionManager>(
+            std::make_unique<ble::BleTransport>(), std::move(historyFlash));
+    // owned by the controller from now on, for good
+    [[maybe_unused]] ble::ConnectionManager* connectionManagerPtr =
+        connectionManager.get();
 
     std::unique_ptr<view::PageFactory> pageFactory =
         std::make_unique<view::PageFactoryImpl>();
@@ -55,18 +160,32 @@ void setup() {
     controller->setRemoteController(std::move(connectionManager));
     controller->setWindow(std::move(window));
 
+#if defined(SESSION_RECORD)
+    recordSession();
+#elif defined(SESSION_REPLAY)
+    replaySession(connectionManagerPtr, SESSION_REPLAY);
+#endif
+
     ESP_LOGD(TAG, "Setup finished");
     ESP_LOGD(TAG, "Available heap: %lu", heap_caps_get_free_size(DEFAULT));
     delay(1000);
 }
 
 void loop() {
-    auto inputManager = InputManager::getInstance();
     auto controller = controller::CentralController::getInstance();
-    if (!mainEventQueue->isEmpty()) {
+    // the events, the touches included (see InputManager), are handled as
+    // soon as they arrive, by priority: a call does not wait behind a burst
+    // of messages
+    uint32_t start = millis();
+    uint32_t elapsed;
+    while ((elapsed = millis() - start) < loopPeriod) {
+        std::unique_ptr<view::UIEvent> event;
+        if (!mainEventQueue->remove(
+                event, std::chrono::milliseconds{loopPeriod - elapsed}))
+            break;
         ESP_LOGD(TAG, "pulling an event out from the main queue");
-        std::unique_ptr<view::UIEvent> event =
-            std::move(mainEventQueue->remove());
+        tracer->record(event->getTraceId(), TraceStage::DEQUEUED);
+        int64_t frameStart = esp_timer_get_time();
         view::UIEventTag tag = event->getTag();
         switch (tag) {
             case view::UIEventTag::RemoteProcedure:
@@ -75,7 +194,11 @@ void loop() {
                 remoteProcedure->call();
                 break;
         }
+        // the pages draw synchronously
+        tracer->record(event->getTraceId(), TraceStage::DRAWN);
+        if (replayer)
+            replayer->onFrame(esp_timer_get_time() - frameStart);
     }
-    inputManager->handleInput();
-    delay(100);
-}
\ No newline at end of file
+    logLinkStats(controller);
+    logTraces();
+}
@@ -0,0 +1,72 @@
+#include "model/forecast.h"
+
+#include <esp_log.h>
+#include <algorithm>
+#include <cstring>
+#include "utility/utf8.h"
+
+namespace model {
+namespace {
+// the time slots are told apart by the bytes kept of them
+std::string_view toSlot(std::string_view time) {
+    return truncateUTF8(time, Condition::maxTimeSize);
+}
+}  // namespace
+
+bool Condition::operator==(Condition const& other) const {
+    return getTime() == other.getTime() &&
+           m_temperature == other.m_temperature &&
+           m_pressure == other.m_pressure && m_icon == other.m_icon;
+}
+
+bool Forecast::append(protocol::ConditionView const& cond) {
+    return assign(m_size, cond);
+}
+
+bool Forecast::upsert(protocol::ConditionView const& cond) {
+    int idx = find(cond.m_time);
+    return assign(idx < 0 ? m_size : idx, cond);
+}
+
+bool Forecast::remove(std::string_view time) {
+    int idx = find(time);
+    if (idx < 0)
+        return false;
+    std::copy(m_conditions.begin() + idx + 1, m_conditions.begin() + m_size,
+              m_conditions.begin() + idx);
+    m_size--;
+    return true;
+}
+
+int Forecast::find(std::string_view time) const {
+    std::string_view slot = toSlot(time);
+    for (size_t i = 0; i < m_size; i++) {
+        if (m_conditions[i].getTime() == slot)
+            return i;
+    }
+    return -1;
+}
+
+bool Forecast::assign(size_t idx, protocol::ConditionView const& cond) {
+    if (cond.m_icon >= protocol::numIcons) {
+        ESP_LOGD(TAG, "Unknown icon %u, condition skipped", cond.m_icon);
+        return false;
+    }
+    if (idx == m_size) {
+        if (m_size == maxNumConditions) {
+            ESP_LOGD(TAG, "Forecast full, condition skipped");
+            return false;
+        }
+        m_size++;
+    }
+
+    std::string_view slot = toSlot(cond.m_time);
+    Condition& condition = m_conditions[idx];
+    memcpy(condition.m_time, slot.data(), slot.size());
+    condition.m_time[slot.size()] = '\0';
+    condition.m_temperature = static_cast<int16_t>(cond.m_temperature);
+    condition.m_pressure = static_cast<uint16_t>(cond.m_pressure);
+    condition.m_icon = cond.m_icon;
+    return true;
+}
+}  // namespace model
@@ -0,0 +1,384 @@
+#include "model/message_log.h"
+
+#include <esp_log.h>
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include "utility/hash.h"
+#include "utility/utf8.h"
+
+namespace model {
+MessageLog::MessageLog(std::unique_ptr<storage::Flash> flash,
+                       size_t maxNumRetained)
+    : m_flash{std::move(flash)},
+      m_sectorSize{m_flash->getSectorSize()},
+      m_numSectors{m_flash->getSize() / m_flash->getSectorSize()},
+      m_maxNumRetained{maxNumRetained},
+      m_isStopping{false},
+      m_isErasingTail{false},
+      m_idxTailSector{0},
+      m_idxHeadSector{0},
+      m_numUsedSectors{0},
+      m_seqHeadSector{0},
+      m_headOffset{0},
+      m_maxSeqOfSector(m_numSectors, 0),
+      m_numAppended{0},
+      m_index(maxNumRetained, noAddress) {
+    // the retained messages take at most a sector each, and the head may be
+    // another one: at least minNumFreeSectors sectors are left to reclaim
+    assert(m_numSectors > maxNumRetained + minNumFreeSectors &&
+           "The flash is too small for the messages to retain");
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        mount();
+    }
+    m_compactor = std::thread([this]() { runCompaction(); });
+}
+
+MessageLog::~MessageLog() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_isStopping = true;
+    }
+    m_cv.notify_one();
+    m_compactor.join();
+}
+
+bool MessageLog::append(std::string_view app,
+                        std::string_view sender,
+                        std::string_view body,
+                        uint32_t timestamp) {
+    size_t maxTextSize =
+        m_sectorSize - sizeof(SectorHeader) - sizeof(RecordHeader);
+    app = truncateUTF8(app, maxTextSize / 4);
+    sender = truncateUTF8(sender, maxTextSize / 4);
+    body = truncateUTF8(body, maxTextSize - app.size() - sender.size());
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    RecordHeader header{};
+    header.m_seq = m_numAppended;
+    header.m_timestamp = timestamp;
+    header.m_appSize = app.size();
+    header.m_senderSize = sender.size();
+    header.m_bodySize = body.size();
+    // a full flash waits for the erasure in progress rather than erase the
+    // same sector
+    m_tailErased.wait(lock, [this]() {
+        return !m_isErasingTail || getNumFreeSectors() > 0;
+    });
+    if (!writeRecord(header, app, sender, body)) {
+        ESP_LOGE(TAG, "The message %u cannot be written", m_numAppended);
+        return false;
+    }
+
+    m_numAppended++;
+    m_stats.m_numBytesAppended += header.getFootprint();
+    lock.unlock();
+    m_cv.notify_one();
+    return true;
+}
+
+size_t MessageLog::size() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return std::count_if(m_index.begin(), m_index.end(), [](uint32_t address) {
+        return address != noAddress;
+    });
+}
+
+size_t MessageLog::forEach(
+    std::function<void(LoggedMessage const&)> const& f) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    uint32_t seq = m_numAppended > m_maxNumRetained
+                       ? m_numAppended - m_maxNumRetained
+                       : 0;
+    size_t numVisited = 0;
+    LoggedMessage msg;
+    for (; seq < m_numAppended; seq++) {
+        uint32_t address = m_index[seq % m_maxNumRetained];
+        if (address == noAddress || !readRecord(address, msg) ||
+            msg.m_seq != seq)
+            continue;
+        f(msg);
+        numVisited++;
+    }
+    return numVisited;
+}
+
+MessageLog::Stats MessageLog::getStats() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_stats;
+}
+
+void MessageLog::mount() {
+    std::vector<SectorHeader> headers(m_numSectors);
+    bool isEmpty = true;
+    for (size_t s = 0; s < m_numSectors; s++) {
+        SectorHeader& header = headers[s];
+        if (!m_flash->read(s * m_sectorSize, &header, sizeof(header)) ||
+            header.m_magic != sectorMagic) {
+            header.m_magic = 0;
+            continue;
+        }
+        if (isEmpty || header.m_seq > headers[m_idxHeadSector].m_seq)
+            m_idxHeadSector = s;
+        isEmpty = false;
+    }
+
+    if (isEmpty) {
+        ESP_LOGD(TAG, "No message in the log");
+        m_idxHeadSector = m_numSectors - 1;
+        m_idxTailSector = 0;
+        m_headOffset = m_sectorSize;
+        return;
+    }
+
+    // the sectors in use are the ones numbered consecutively up to the head,
+    // the others are reclaimed when the head reaches them
+    m_seqHeadSector = headers[m_idxHeadSector].m_seq;
+    m_idxTailSector = m_idxHeadSector;
+    m_numUsedSectors = 1;
+    while (m_numUsedSectors < m_numSectors) {
+        size_t prev = (m_idxTailSector + m_numSectors - 1) % m_numSectors;
+        if (headers[prev].m_magic != sectorMagic ||
+            headers[prev].m_seq + 1 != headers[m_idxTailSector].m_seq)
+            break;
+        m_idxTailSector = prev;
+        m_numUsedSectors++;
+    }
+
+    // records are scanned in the order they have been written, thus the last
+    // record found for an entry of the index is the one to keep
+    std::vector<uint32_t> seqOfIndexed(m_maxNumRetained, 0);
+    for (size_t i = 0; i < m_numUsedSectors; i++) {
+        size_t s = (m_idxTailSector + i) % m_numSectors;
+        bool isClosed = false;
+        size_t end = scanSector(
+            s, isClosed, [&](size_t address, RecordHeader const& header) {
+                m_maxSeqOfSector[s] =
+                    std::max(m_maxSeqOfSector[s], header.m_seq + 1);
+                m_numAppended = std::max(m_numAppended, header.m_seq + 1);
+                size_t idx = header.m_seq % m_maxNumRetained;
+                if (m_index[idx] == noAddress ||
+                    header.m_seq >= seqOfIndexed[idx]) {
+                    m_index[idx] = address;
+                    seqOfIndexed[idx] = header.m_seq;
+                }
+            });
+        if (s == m_idxHeadSector)
+            m_headOffset = isClosed ? m_sectorSize : end;
+    }
+
+    // entries left by messages no longer retained
+    for (size_t idx = 0; idx < m_maxNumRetained; idx++) {
+        if (m_index[idx] != noAddress && !isRetained(seqOfIndexed[idx]))
+            m_index[idx] = noAddress;
+    }
+
+    ESP_LOGD(TAG,
+             "Log mounted: sectors %u to %u in use, %u messages appended so "
+             "far",
+             m_idxTailSector, m_idxHeadSector, m_numAppended);
+}
+
+size_t MessageLog::scanSector(
+    size_t idxSector,
+    bool& isClosed,
+    std::function<void(size_t address, RecordHeader const&)> const& f) {
+    size_t beg = idxSector * m_sectorSize;
+    size_t offset = sizeof(SectorHeader);
+    isClosed = false;
+    while (offset + sizeof(RecordHeader) <= m_sectorSize) {
+        RecordHeader header;
+        if (!m_flash->read(beg + offset, &header, sizeof(header))) {
+            isClosed = true;
+            return offset;
+        }
+
+        // the erased space left after the last record
+        auto bytes = reinterpret_cast<uint8_t const*>(&header);
+        if (std::all_of(bytes, bytes + sizeof(header),
+                        [](uint8_t b) { return b == 0xFF; }))
+            return offset;
+
+        // the checksum is computed in chunks, not to need a buffer as big as
+        // the biggest record
+        bool isValid = offset + header.getFootprint() <= m_sectorSize;
+        uint32_t crc = crc32(&header, offsetof(RecordHeader, m_crc));
+        uint8_t chunk[64];
+        size_t textSize = header.getTextSize();
+        for (size_t i = 0; isValid && i < textSize; i += sizeof(chunk)) {
+            size_t chunkSize = std::min(sizeof(chunk), textSize - i);
+            isValid = m_flash->read(beg + offset + sizeof(header) + i, chunk,
+                                    chunkSize);
+            crc = crc32(chunk, chunkSize, crc);
+        }
+        if (!isValid || crc != header.m_crc) {
+            // torn by a power loss: what follows cannot be trusted
+            ESP_LOGD(TAG, "Invalid record at 0x%x", beg + offset);
+            isClosed = true;
+            return offset;
+        }
+
+        f(beg + offset, header);
+        offset += header.getFootprint();
+    }
+    return offset;
+}
+
+bool MessageLog::readRecord(size_t address, LoggedMessage& msg) {
+    RecordHeader header;
+    if (!m_flash->read(address, &header, sizeof(header)))
+        return false;
+
+    msg.m_seq = header.m_seq;
+    msg.m_timestamp = header.m_timestamp;
+    msg.m_app.resize(header.m_appSize);
+    msg.m_sender.resize(header.m_senderSize);
+    msg.m_body.resize(header.m_bodySize);
+    address += sizeof(header);
+    return m_flash->read(address, msg.m_app.data(), header.m_appSize) &&
+           m_flash->read(address + header.m_appSize, msg.m_sender.data(),
+                         header.m_senderSize) &&
+           m_flash->read(address + header.m_appSize + header.m_senderSize,
+                         msg.m_body.data(), header.m_bodySize);
+}
+
+bool MessageLog::writeRecord(RecordHeader header,
+                             std::string_view app,
+                             std::string_view sender,
+                             std::string_view body) {
+    size_t footprint = header.getFootprint();
+    if (m_headOffset + footprint > m_sectorSize && !openNextSector())
+        return false;
+
+    uint32_t crc = crc32(&header, offsetof(RecordHeader, m_crc));
+    crc = crc32(app.data(), app.size(), crc);
+    crc = crc32(sender.data(), sender.size(), crc);
+    header.m_crc = crc32(body.data(), body.size(), crc);
+
+    size_t address = m_idxHeadSector * m_sectorSize + m_headOffset;
+    bool isWritten =
+        m_flash->write(address, &header, sizeof(header)) &&
+        m_flash->write(address + sizeof(header), app.data(), app.size()) &&
+        m_flash->write(address + sizeof(header) + app.size(), sender.data(),
+                       sender.size()) &&
+        m_flash->write(address + sizeof(header) + app.size() + sender.size(),
+                       body.data(), body.size());
+    if (!isWritten) {
+        // the space may be partially written
+        m_headOffset = m_sectorSize;
+        return false;
+    }
+
+    m_headOffset += footprint;
+    m_maxSeqOfSector[m_idxHeadSector] =
+        std::max(m_maxSeqOfSector[m_idxHeadSector], header.m_seq + 1);
+    m_index[header.m_seq % m_maxNumRetained] = address;
+    m_stats.m_numBytesWritten += footprint;
+    return true;
+}
+
+bool MessageLog::openNextSector() {
+    if (getNumFreeSectors() == 0 && !eraseTail())
+        return false;
+
+    size_t next = (m_idxHeadSector + 1) % m_numSectors;
+    // a sector outside the ones in use may not be blank after a power loss
+    // during its erasure
+    size_t beg = next * m_sectorSize;
+    uint8_t chunk[64];
+    bool isBlank = true;
+    for (size_t offset = 0; isBlank && offset < m_sectorSize;
+         offset += sizeof(chunk)) {
+        isBlank = m_flash->read(beg + offset, chunk, sizeof(chunk)) &&
+                  std::all_of(chunk, chunk + sizeof(chunk),
+                              [](uint8_t b) { return b == 0xFF; });
+    }
+    if (!isBlank) {
+        if (!m_flash->eraseSector(next))
+            return false;
+        m_stats.m_numSectorsErased++;
+    }
+
+    SectorHeader header{sectorMagic, m_seqHeadSector + 1};
+    if (!m_flash->write(beg, &header, sizeof(header)))
+        return false;
+
+    ESP_LOGD(TAG, "Sector %u opened", next);
+    if (m_numUsedSectors == 0)
+        m_idxTailSector = next;
+    m_idxHeadSector = next;
+    m_seqHeadSector++;
+    m_numUsedSectors++;
+    m_headOffset = sizeof(header);
+    m_maxSeqOfSector[next] = 0;
+    m_stats.m_numBytesWritten += sizeof(header);
+    return true;
+}
+
+bool MessageLog::eraseTail() {
+    uint32_t maxSeq = m_maxSeqOfSector[m_idxTailSector];
+    if (m_numUsedSectors == 0 || (maxSeq > 0 && isRetained(maxSeq - 1))) {
+        ESP_LOGE(TAG, "The oldest sector holds messages still retained");
+        return false;
+    }
+    if (!m_flash->eraseSector(m_idxTailSector))
+        return false;
+    releaseTail();
+    return true;
+}
+
+void MessageLog::releaseTail() {
+    ESP_LOGD(TAG, "Sector %u erased", m_idxTailSector);
+    m_stats.m_numSectorsErased++;
+    m_maxSeqOfSector[m_idxTailSector] = 0;
+    m_idxTailSector = (m_idxTailSector + 1) % m_numSectors;
+    m_numUsedSectors--;
+    if (m_numUsedSectors == 0) {
+        // the next record opens the sector following the head
+        m_headOffset = m_sectorSize;
+    }
+}
+
+bool MessageLog::isRetained(uint32_t seq) const {
+    return seq + m_maxNumRetained >= m_numAppended;
+}
+
+size_t MessageLog::getNumFreeSectors() const {
+    return m_numSectors - m_numUsedSectors;
+}
+
+bool MessageLog::isTailReclaimable() const {
+    uint32_t maxSeq = m_maxSeqOfSector[m_idxTailSector];
+    return m_numUsedSectors > 1 && (maxSeq == 0 || !isRetained(maxSeq - 1));
+}
+
+void MessageLog::runCompaction() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (!m_isStopping) {
+        // the retained messages are the newest ones: the sectors before the
+        // first one holding any are reclaimed without copying anything. The
+        // tail stays in use while erased, nothing being written or read there
+        while (isTailReclaimable()) {
+            size_t idxSector = m_idxTailSector;
+            m_isErasingTail = true;
+            lock.unlock();
+            bool isErased = m_flash->eraseSector(idxSector);
+            lock.lock();
+            m_isErasingTail = false;
+            m_tailErased.notify_all();
+            if (!isErased)
+                break;
+            releaseTail();
+            ESP_LOGD(TAG, "%u bytes appended, %u written, %u sectors erased",
+                     m_stats.m_numBytesAppended, m_stats.m_numBytesWritten,
+                     m_stats.m_numSectorsErased);
+        }
+
+        uint32_t numAppended = m_numAppended;
+        m_cv.wait(lock, [this, numAppended]() {
+            return m_isStopping || m_numAppended != numAppended;
+        });
+    }
+}
+}  // namespace model
@@ -0,0 +1,100 @@
+#include "model/message_store.h"
+
+#include <esp_log.h>
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include "utility/utf8.h"
+
+namespace model {
+MessageStore::MessageStore(size_t maxNumMessages, size_t arenaSize)
+    : m_maxNumMessages{maxNumMessages},
+      m_arenaSize{arenaSize},
+      m_records{std::make_unique<Record[]>(maxNumMessages)},
+      m_arena{std::make_unique<char[]>(arenaSize)},
+      m_idxOldest{0},
+      m_size{0},
+      m_arenaHead{0},
+      m_numAppended{0} {
+    assert(maxNumMessages > 0 && arenaSize >= 4 &&
+           "The store must hold at least a message");
+}
+
+uint32_t MessageStore::append(std::string_view app,
+                              std::string_view sender,
+                              std::string_view body,
+                              uint32_t timestamp) {
+    // the app and the sender cannot leave the body without space
+    size_t maxFieldSize = std::min<size_t>(UINT16_MAX, m_arenaSize / 4);
+    app = truncateUTF8(app, maxFieldSize);
+    sender = truncateUTF8(sender, maxFieldSize);
+    body = truncateUTF8(body, std::min<size_t>(UINT16_MAX, m_arenaSize - 1 -
+                                                           app.size() -
+                                                           sender.size()));
+    size_t footprint = app.size() + sender.size() + body.size() + 1;
+
+    if (m_size == m_maxNumMessages)
+        evictOldest();
+
+    if (m_arenaHead + footprint > m_arenaSize) {
+        // the text does not fit the end of the arena: the records there are
+        // the oldest ones and their space is given up
+        evictOverlapping(m_arenaHead, m_arenaSize);
+        m_arenaHead = 0;
+    }
+    evictOverlapping(m_arenaHead, m_arenaHead + footprint);
+
+    Record& record = m_records[(m_idxOldest + m_size) % m_maxNumMessages];
+    record.m_seq = m_numAppended;
+    record.m_timestamp = timestamp;
+    record.m_offset = m_arenaHead;
+    record.m_appSize = app.size();
+    record.m_senderSize = sender.size();
+    record.m_bodySize = body.size();
+
+    char* text = m_arena.get() + m_arenaHead;
+    memcpy(text, app.data(), app.size());
+    text += app.size();
+    memcpy(text, sender.data(), sender.size());
+    text += sender.size();
+    memcpy(text, body.data(), body.size());
+    text[body.size()] = '\0';
+
+    m_arenaHead += footprint;
+    m_size++;
+    ESP_LOGD(TAG, "Message %u stored, %u messages in the store", m_numAppended,
+             m_size);
+    return m_numAppended++;
+}
+
+MessageView MessageStore::latest(size_t idx) const {
+    assert(idx < m_size && "No such message");
+    Record const& record =
+        m_records[(m_idxOldest + m_size - 1 - idx) % m_maxNumMessages];
+    char const* text = m_arena.get() + record.m_offset;
+    return MessageView{
+        record.m_seq, record.m_timestamp,
+        std::string_view{text, record.m_appSize},
+        std::string_view{text + record.m_appSize, record.m_senderSize},
+        std::string_view{text + record.m_appSize + record.m_senderSize,
+                         record.m_bodySize}};
+}
+
+void MessageStore::evictOverlapping(size_t beg, size_t end) {
+    // texts follow the order of the records and the space after the head is
+    // the one of the oldest record: once a record does not overlap, the newer
+    // ones do not either
+    while (m_size > 0) {
+        Record const& oldest = m_records[m_idxOldest];
+        if (oldest.m_offset >= end || oldest.end() <= beg)
+            return;
+        evictOldest();
+    }
+}
+
+void MessageStore::evictOldest() {
+    ESP_LOGD(TAG, "Evicting message %u", m_records[m_idxOldest].m_seq);
+    m_idxOldest = (m_idxOldest + 1) % m_maxNumMessages;
+    m_size--;
+}
+}  // namespace model
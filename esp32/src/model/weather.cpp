@@ -0,0 +1,49 @@
+#include "model/weather.h"
+
+#include <esp_log.h>
+
+namespace model {
+bool Weather::apply(protocol::Frame const& frame) {
+    auto log = [](protocol::ConditionView const& cond) {
+        ESP_LOGD(TAG, "time: '%.*s'\ttemperature: %d\tpressure: %u\ticon: %u",
+                 static_cast<int>(cond.m_time.size()), cond.m_time.data(),
+                 cond.m_temperature, cond.m_pressure, cond.m_icon);
+    };
+
+    if (frame.m_type == protocol::MessageType::WEATHER) {
+        protocol::WeatherView weather;
+        if (!protocol::decode(frame, weather))
+            return false;
+        m_location = weather.m_location;
+        m_forecast.clear();
+        weather.forEachCondition([&](protocol::ConditionView const& cond) {
+            log(cond);
+            m_forecast.append(cond);
+        });
+        m_isSynced = true;
+    } else if (frame.m_type == protocol::MessageType::WEATHER_DELTA) {
+        protocol::WeatherDeltaView delta;
+        if (!protocol::decode(frame, delta))
+            return false;
+        // e.g. the device rebooted: the phone sends a whole forecast from
+        // time to time
+        if (!m_isSynced) {
+            ESP_LOGD(TAG, "No forecast to apply the delta to, dropped");
+            return false;
+        }
+        delta.forEachChange(
+            [&](protocol::ConditionView const& cond) {
+                log(cond);
+                m_forecast.upsert(cond);
+            },
+            [this](std::string_view time) {
+                ESP_LOGD(TAG, "time: '%.*s' removed",
+                         static_cast<int>(time.size()), time.data());
+                m_forecast.remove(time);
+            });
+    } else {
+        return false;
+    }
+    return true;
+}
+}  // namespace model
@@ -0,0 +1,30 @@
+#include "protocol/batch.h"
+
+namespace protocol {
+namespace {
+size_t getVarintSize(uint32_t value) {
+    size_t size = 1;
+    for (value >>= 7; value != 0; value >>= 7) {
+        size++;
+    }
+    return size;
+}
+}  // namespace
+
+size_t getBatchedSize(std::string_view msg) {
+    return 1 + getVarintSize(msg.size()) + msg.size();
+}
+
+void appendToBatch(std::string& batch, std::string_view msg) {
+    if (batch.empty())
+        batch.push_back(batchMarker);
+    batch.push_back(batchEntryTag);
+    uint32_t size = msg.size();
+    while (size >= 0x80) {
+        batch.push_back(0x80 | (size & 0x7F));
+        size >>= 7;
+    }
+    batch.push_back(size);
+    batch.append(msg);
+}
+}  // namespace protocol
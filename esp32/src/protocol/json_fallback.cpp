@@ -0,0 +1,87 @@
+#include "protocol/json_fallback.h"
+
+#include <ArduinoJson.h>
+#include <esp_log.h>
+
+namespace protocol {
+namespace {
+char const TAG[] = "JSONFallback";
+
+void putCondition(Writer& writer, uint8_t tag, JsonVariantConst cond) {
+    size_t position = writer.beginNested(tag);
+    writer.putString(tag::conditionTime, cond["time"] | "");
+    writer.putInt(tag::conditionTemperature, cond["temperature"].as<int32_t>());
+    writer.putUInt(tag::conditionPressure, cond["pressure"].as<uint32_t>());
+    writer.putUInt(tag::conditionIcon, getIconId(cond["iconName"] | ""));
+    writer.endNested(position);
+}
+}  // namespace
+
+std::string makeHelloAnswer(uint32_t negotiatedVersion,
+                            uint32_t negotiatedCompression) {
+    JsonDocument doc;
+    doc["command"] = helloCommand;
+    doc["v"] = negotiatedVersion;
+    doc["c"] = negotiatedCompression;
+    std::string answer;
+    serializeJson(doc, answer);
+    return answer;
+}
+
+bool transcodeJSON(std::string_view json, Writer& writer) {
+    JsonDocument doc;
+    DeserializationError error =
+        deserializeJson(doc, json.data(), json.size());
+    if (error) {
+        ESP_LOGD(TAG, "Error '%s' when deserializing\n", error.c_str());
+        return false;
+    }
+
+    std::string_view command = doc["command"] | "";
+    if (command == helloCommand) {
+        writer.begin(MessageType::HELLO);
+        writer.putUInt(tag::helloVersion, doc["v"] | 0u);
+        writer.putUInt(tag::helloCompression, doc["c"] | 0u);
+    } else if (command == "n") {
+        std::string_view source = doc["source"] | "";
+        writer.begin(source == "call" ? MessageType::CALL
+                                      : MessageType::NOTIFICATION);
+        writer.putString(tag::notificationSource, source);
+        writer.putString(tag::notificationSender, doc["sender"] | "");
+        writer.putString(tag::notificationContent, doc["content"] | "");
+    } else if (command == "t") {
+        writer.begin(MessageType::TRANSLATION);
+        writer.putString(tag::translationText, doc["text"] | "");
+    } else if (command == "tp") {
+        writer.begin(MessageType::PARTIAL_TRANSCRIPT);
+        writer.putUInt(tag::transcriptUtterance, doc["u"] | 0u);
+        writer.putUInt(tag::transcriptNumStableBytes, doc["s"] | 0u);
+        writer.putString(tag::transcriptTail, doc["x"] | "");
+    } else if (command == "w") {
+        writer.begin(MessageType::WEATHER);
+        writer.putString(tag::weatherLocation, doc["location"] | "");
+        for (JsonVariantConst cond : doc["conditions"].as<JsonArrayConst>()) {
+            putCondition(writer, tag::weatherCondition, cond);
+        }
+    } else if (command == "wd") {
+        // the slots removed first, so that the ones appended keep the order
+        writer.begin(MessageType::WEATHER_DELTA);
+        for (JsonVariantConst time : doc["r"].as<JsonArrayConst>()) {
+            writer.putString(tag::weatherRemove, time | "");
+        }
+        for (JsonVariantConst cond : doc["u"].as<JsonArrayConst>()) {
+            putCondition(writer, tag::weatherUpsert, cond);
+        }
+    } else {
+        ESP_LOGD(TAG, "Command '%.*s' not recognised",
+                 static_cast<int>(command.size()), command.data());
+        return false;
+    }
+    // the clock of the phone may not fit 32 bits, only differences matter
+    JsonVariantConst sentAt = doc["ts"];
+    if (sentAt.is<uint64_t>())
+        writer.putUInt(tag::sentAt,
+                       static_cast<uint32_t>(sentAt.as<uint64_t>()));
+    return writer.finish();
+}
+}  // namespace protocol
@@ -0,0 +1,173 @@
+#include "protocol/lz.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace protocol {
+namespace lz {
+namespace {
+// frequent words of the languages of the messages, English and Italian
+constexpr char dictionary[] =
+    " the and you for that with this are have not will your from what when"
+    " where there about please thank today meeting message di che per non"
+    " una con sono della questo come anche alla gli del più grazie domani"
+    " oggi ciao casa quando dove tutto essere ";
+constexpr size_t dictionarySize = sizeof(dictionary) - 1;
+static_assert(dictionarySize <= windowSize,
+              "The dictionary must fit the window");
+
+class BitWriter {
+public:
+    BitWriter(char* output, size_t capacity)
+        : m_output{output},
+          m_capacity{capacity},
+          m_size{0},
+          m_bits{0},
+          m_numBits{0},
+          m_hasOverflowed{false} {}
+
+    void put(uint32_t bits, size_t numBits) {
+        m_bits = (m_bits << numBits) | bits;
+        m_numBits += numBits;
+        while (m_numBits >= 8) {
+            m_numBits -= 8;
+            putByte(m_bits >> m_numBits);
+        }
+        m_bits &= (uint32_t{1} << m_numBits) - 1;
+    }
+
+    // pads the last byte with zeros
+    size_t finish() {
+        if (m_numBits > 0)
+            putByte(m_bits << (8 - m_numBits));
+        m_numBits = 0;
+        return m_hasOverflowed ? 0 : m_size;
+    }
+
+private:
+    void putByte(uint8_t byte) {
+        if (m_size == m_capacity) {
+            m_hasOverflowed = true;
+            return;
+        }
+        m_output[m_size++] = byte;
+    }
+
+private:
+    char* const m_output;
+    size_t const m_capacity;
+    size_t m_size;
+    uint32_t m_bits;
+    size_t m_numBits;
+    bool m_hasOverflowed;
+};
+}  // namespace
+
+std::string_view getDictionary() {
+    return std::string_view{dictionary, dictionarySize};
+}
+
+size_t compress(std::string_view input, char* output, size_t capacity) {
+    // the input follows the dictionary
+    auto at = [input](size_t idx) {
+        return idx < dictionarySize ? dictionary[idx]
+                                    : input[idx - dictionarySize];
+    };
+    size_t end = dictionarySize + input.size();
+
+    BitWriter writer{output, capacity};
+    size_t pos = dictionarySize;
+    while (pos < end) {
+        // greedy: the longest match in the window, the nearest among equals
+        size_t bestLength = 0;
+        size_t bestDistance = 0;
+        size_t maxLength = std::min(maxMatchSize, end - pos);
+        size_t maxDistance = std::min(windowSize, pos);
+        for (size_t distance = 1;
+             distance <= maxDistance && bestLength < maxLength; distance++) {
+            size_t length = 0;
+            while (length < maxLength &&
+                   at(pos - distance + length) == at(pos + length)) {
+                length++;
+            }
+            if (length > bestLength) {
+                bestLength = length;
+                bestDistance = distance;
+            }
+        }
+
+        if (bestLength >= minMatchSize) {
+            writer.put(0, 1);
+            writer.put(bestDistance - 1, windowBits);
+            writer.put(bestLength - minMatchSize, lengthBits);
+            pos += bestLength;
+        } else {
+            writer.put(1, 1);
+            writer.put(static_cast<uint8_t>(at(pos)), 8);
+            pos++;
+        }
+    }
+    return writer.finish();
+}
+
+void Decoder::reset() {
+    memcpy(m_window, dictionary, dictionarySize);
+    m_head = dictionarySize % windowSize;
+    m_numProduced = dictionarySize;
+    m_bits = 0;
+    m_numBits = 0;
+}
+
+bool isCompressible(MessageType type) {
+    switch (type) {
+        case MessageType::NOTIFICATION:
+        case MessageType::TRANSLATION:
+        case MessageType::WEATHER:
+            return true;
+        default:
+            return false;
+    }
+}
+
+size_t compressFrame(std::string_view frame, char* output, size_t capacity) {
+    Frame decoded;
+    if (!decodeFrame(frame, decoded) || decoded.m_isCompressed ||
+        !isCompressible(decoded.m_type) || capacity < headerSize)
+        return 0;
+    size_t bodySize =
+        compress(decoded.m_body, output + headerSize, capacity - headerSize);
+    if (bodySize == 0 || headerSize + bodySize >= frame.size())
+        return 0;
+    output[0] = frame[0];
+    output[1] = static_cast<uint8_t>(decoded.m_type) | compressedFlag;
+    output[2] = bodySize & 0xFF;
+    output[3] = bodySize >> 8;
+    return headerSize + bodySize;
+}
+
+bool inflateFrame(Frame const& frame,
+                  char* output,
+                  size_t capacity,
+                  std::string_view& inflated) {
+    if (capacity < headerSize)
+        return false;
+    size_t size = headerSize;
+    Decoder decoder;
+    bool isDecoded = decoder.feed(frame.m_body, [&](char c) {
+        if (size == capacity)
+            return false;
+        output[size++] = c;
+        return true;
+    });
+    size_t bodySize = size - headerSize;
+    if (!isDecoded || bodySize > UINT16_MAX)
+        return false;
+    output[0] = frameMarker | version;
+    output[1] = static_cast<uint8_t>(frame.m_type);
+    output[2] = bodySize & 0xFF;
+    output[3] = bodySize >> 8;
+    inflated = std::string_view{output, size};
+    return true;
+}
+}  // namespace lz
+}  // namespace protocol
@@ -0,0 +1,152 @@
+#include "protocol/reassembler.h"
+
+#include <esp_log.h>
+#include <algorithm>
+#include <cstring>
+
+namespace protocol {
+namespace {
+uint16_t readU16(char const* data) {
+    return static_cast<uint8_t>(data[0]) | static_cast<uint8_t>(data[1]) << 8;
+}
+
+void writeU16(char* data, uint16_t value) {
+    data[0] = value & 0xFF;
+    data[1] = value >> 8;
+}
+}  // namespace
+
+Fragmenter::Fragmenter(std::string_view message,
+                       uint8_t id,
+                       size_t maxFragmentSize)
+    : m_message{message},
+      m_id{id},
+      m_maxPayloadSize{maxFragmentSize - fragmentHeaderSize},
+      m_offset{0},
+      m_seq{0} {}
+
+size_t Fragmenter::next(char* buffer) {
+    if (m_offset == m_message.size() && m_seq > 0)
+        return 0;
+    if (m_message.size() > UINT16_MAX ||
+        (m_message.size() + m_maxPayloadSize - 1) / m_maxPayloadSize >
+            maxNumFragments)
+        return 0;
+
+    size_t payloadSize =
+        std::min(m_maxPayloadSize, m_message.size() - m_offset);
+    bool isLast = m_offset + payloadSize == m_message.size();
+    buffer[0] = fragmentMarker;
+    buffer[1] = isLast ? lastFragmentFlag : 0;
+    buffer[2] = m_id;
+    buffer[3] = m_seq;
+    writeU16(buffer + 4, m_message.size());
+    writeU16(buffer + 6, m_offset);
+    memcpy(buffer + fragmentHeaderSize, m_message.data() + m_offset,
+           payloadSize);
+    m_offset += payloadSize;
+    m_seq++;
+    return fragmentHeaderSize + payloadSize;
+}
+
+Reassembler::Reassembler(size_t numBuffers, size_t bufferSize, uint32_t timeout)
+    : m_numBuffers{numBuffers},
+      m_bufferSize{bufferSize},
+      m_timeout{timeout},
+      m_slots{std::make_unique<Slot[]>(numBuffers)},
+      m_buffers{std::make_unique<char[]>(numBuffers * bufferSize)},
+      m_completed{nullptr} {}
+
+bool Reassembler::push(std::string_view fragment,
+                       uint32_t now,
+                       std::string_view& message) {
+    if (m_completed) {
+        m_completed->m_isUsed = false;
+        m_completed = nullptr;
+    }
+    expire(now);
+
+    if (fragment.size() < fragmentHeaderSize || !isFragment(fragment)) {
+        m_stats.m_numDropped++;
+        return false;
+    }
+    bool isLast = fragment[1] & lastFragmentFlag;
+    uint8_t id = fragment[2];
+    uint8_t seq = fragment[3];
+    uint16_t totalSize = readU16(fragment.data() + 4);
+    uint16_t offset = readU16(fragment.data() + 6);
+    std::string_view payload = fragment.substr(fragmentHeaderSize);
+    if (totalSize > m_bufferSize || offset > totalSize ||
+        payload.size() > static_cast<size_t>(totalSize - offset) ||
+        (isLast && offset + payload.size() != static_cast<size_t>(totalSize))) {
+        ESP_LOGD(TAG, "Fragment %u of message %u dropped", seq, id);
+        m_stats.m_numDropped++;
+        return false;
+    }
+
+    Slot& slot = findSlot(id, totalSize, now);
+    slot.m_lastUpdate = now;
+    if (slot.m_isReceived[seq])
+        return false;
+    slot.m_isReceived[seq] = true;
+    memcpy(getBuffer(slot) + offset, payload.data(), payload.size());
+    slot.m_numBytesReceived += payload.size();
+    slot.m_numFragmentsReceived++;
+    if (isLast)
+        slot.m_numFragments = seq + 1;
+
+    if (slot.m_numFragmentsReceived != slot.m_numFragments ||
+        slot.m_numBytesReceived != slot.m_totalSize)
+        return false;
+    ESP_LOGD(TAG, "Message %u of %u bytes reassembled from %u fragments", id,
+             slot.m_totalSize, slot.m_numFragments);
+    m_stats.m_numCompleted++;
+    m_completed = &slot;
+    message = std::string_view{getBuffer(slot), slot.m_totalSize};
+    return true;
+}
+
+void Reassembler::expire(uint32_t now) {
+    for (size_t i = 0; i < m_numBuffers; i++) {
+        Slot& slot = m_slots[i];
+        if (slot.m_isUsed && now - slot.m_lastUpdate > m_timeout) {
+            ESP_LOGD(TAG, "Message %u timed out with %u of %u bytes",
+                     slot.m_id, slot.m_numBytesReceived, slot.m_totalSize);
+            slot.m_isUsed = false;
+            m_stats.m_numExpired++;
+        }
+    }
+}
+
+Reassembler::Slot& Reassembler::findSlot(uint8_t id,
+                                         uint16_t totalSize,
+                                         uint32_t now) {
+    Slot* victim = nullptr;
+    for (size_t i = 0; i < m_numBuffers; i++) {
+        Slot& slot = m_slots[i];
+        if (!slot.m_isUsed) {
+            if (!victim || victim->m_isUsed)
+                victim = &slot;
+            continue;
+        }
+        if (slot.m_id == id && slot.m_totalSize == totalSize)
+            return slot;
+        if (!victim || (victim->m_isUsed &&
+                        now - slot.m_lastUpdate > now - victim->m_lastUpdate))
+            victim = &slot;
+    }
+
+    if (victim->m_isUsed) {
+        ESP_LOGD(TAG, "Message %u discarded for message %u", victim->m_id, id);
+        m_stats.m_numExpired++;
+    }
+    victim->m_isUsed = true;
+    victim->m_id = id;
+    victim->m_totalSize = totalSize;
+    victim->m_numBytesReceived = 0;
+    victim->m_numFragmentsReceived = 0;
+    victim->m_numFragments = maxNumFragments + 1;
+    victim->m_isReceived.reset();
+    return *victim;
+}
+}  // namespace protocol
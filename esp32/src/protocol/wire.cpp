@@ -0,0 +1,334 @@
+#include "protocol/wire.h"
+
+#include <cstring>
+
+namespace protocol {
+namespace {
+// weather icons in the order of their ids: only appending keeps the ids sent
+// by the phones already deployed
+constexpr std::string_view iconNames[] = {
+    "clear",
+    "clear_night",
+    "clouds_1",
+    "clouds_1_night",
+    "clouds_2",
+    "clouds_3",
+    "rain_1",
+    "rain_1_night",
+    "rain_2",
+    "rain_3",
+    "rain_4",
+    "snow_1",
+    "snow_1_night",
+    "snow_2",
+    "snow_3",
+    "thunderstorm_1",
+    "thunderstorm_1_3_night",
+    "thunderstorm_2",
+    "thunderstorm_3",
+    "fog",
+    "tornado",
+    "squall",
+};
+static_assert(sizeof(iconNames) / sizeof(iconNames[0]) == numIcons);
+
+// reads a varint from the beginning of @p{data}, consuming it
+bool readVarint(std::string_view& data, uint32_t& value) {
+    value = 0;
+    for (size_t i = 0; i < data.size() && i < 5; i++) {
+        uint8_t byte = data[i];
+        value |= uint32_t{byte & 0x7Fu} << (7 * i);
+        if ((byte & 0x80) == 0) {
+            data.remove_prefix(i + 1);
+            return true;
+        }
+    }
+    return false;
+}
+}  // namespace
+
+uint8_t getIconId(std::string_view name) {
+    for (size_t i = 0; i < numIcons; i++) {
+        if (iconNames[i] == name)
+            return i;
+    }
+    return unknownIcon;
+}
+
+std::string_view getIconName(uint8_t id) {
+    return id < numIcons ? iconNames[id] : std::string_view{};
+}
+
+bool decodeFrame(std::string_view data, Frame& frame) {
+    if (data.size() < headerSize ||
+        static_cast<uint8_t>(data[0]) != (frameMarker | version))
+        return false;
+    size_t bodySize = static_cast<uint8_t>(data[2]) |
+                      static_cast<uint8_t>(data[3]) << 8;
+    if (data.size() - headerSize < bodySize)
+        return false;
+    uint8_t type = data[1];
+    frame.m_type = static_cast<MessageType>(type & ~compressedFlag);
+    frame.m_isCompressed = type & compressedFlag;
+    frame.m_body = data.substr(headerSize, bodySize);
+    return true;
+}
+
+uint32_t Field::asUInt() const {
+    std::string_view data = m_value;
+    uint32_t value;
+    return readVarint(data, value) ? value : 0;
+}
+
+int32_t Field::asInt() const {
+    uint32_t zigzag = asUInt();
+    return static_cast<int32_t>(zigzag >> 1) ^
+           -static_cast<int32_t>(zigzag & 1);
+}
+
+bool FieldReader::next(Field& field) {
+    if (m_data.empty())
+        return false;
+    std::string_view data = m_data.substr(1);
+    uint32_t size;
+    if (!readVarint(data, size) || size > data.size()) {
+        m_isMalformed = true;
+        m_data = {};
+        return false;
+    }
+    field.m_tag = m_data[0];
+    field.m_value = data.substr(0, size);
+    m_data = data.substr(size);
+    return true;
+}
+
+bool findSentAt(Frame const& frame, uint32_t& sentAt) {
+    FieldReader reader{frame.m_body};
+    Field field;
+    while (reader.next(field)) {
+        if (field.m_tag == tag::sentAt) {
+            sentAt = field.asUInt();
+            return true;
+        }
+    }
+    return false;
+}
+
+bool decode(Frame const& frame, HelloView& msg) {
+    if (frame.m_type != MessageType::HELLO)
+        return false;
+    FieldReader reader{frame.m_body};
+    Field field;
+    while (reader.next(field)) {
+        if (field.m_tag == tag::helloVersion)
+            msg.m_version = field.asUInt();
+        else if (field.m_tag == tag::helloCompression)
+            msg.m_compression = field.asUInt();
+    }
+    return !reader.isMalformed();
+}
+
+bool decode(Frame const& frame, NotificationView& msg) {
+    if (frame.m_type != MessageType::NOTIFICATION &&
+        frame.m_type != MessageType::CALL)
+        return false;
+    FieldReader reader{frame.m_body};
+    Field field;
+    while (reader.next(field)) {
+        switch (field.m_tag) {
+            case tag::notificationSource:
+                msg.m_source = field.m_value;
+                break;
+            case tag::notificationSender:
+                msg.m_sender = field.m_value;
+                break;
+            case tag::notificationContent:
+                msg.m_content = field.m_value;
+                break;
+        }
+    }
+    return !reader.isMalformed();
+}
+
+bool decode(Frame const& frame, TranslationView& msg) {
+    if (frame.m_type != MessageType::TRANSLATION)
+        return false;
+    FieldReader reader{frame.m_body};
+    Field field;
+    while (reader.next(field)) {
+        if (field.m_tag == tag::translationText)
+            msg.m_text = field.m_value;
+    }
+    return !reader.isMalformed();
+}
+
+bool decode(Frame const& frame, PartialTranscriptView& msg) {
+    if (frame.m_type != MessageType::PARTIAL_TRANSCRIPT)
+        return false;
+    FieldReader reader{frame.m_body};
+    Field field;
+    while (reader.next(field)) {
+        switch (field.m_tag) {
+            case tag::transcriptUtterance:
+                msg.m_idUtterance = field.asUInt();
+                break;
+            case tag::transcriptNumStableBytes:
+                msg.m_numStableBytes = field.asUInt();
+                break;
+            case tag::transcriptTail:
+                msg.m_tail = field.m_value;
+                break;
+        }
+    }
+    return !reader.isMalformed();
+}
+
+bool decode(Frame const& frame, WeatherView& msg) {
+    if (frame.m_type != MessageType::WEATHER)
+        return false;
+    FieldReader reader{frame.m_body};
+    Field field;
+    while (reader.next(field)) {
+        if (field.m_tag == tag::weatherLocation)
+            msg.m_location = field.m_value;
+    }
+    msg.m_fields = frame.m_body;
+    return !reader.isMalformed();
+}
+
+bool decode(Frame const& frame, WeatherDeltaView& msg) {
+    if (frame.m_type != MessageType::WEATHER_DELTA)
+        return false;
+    // only checks the framing of the changes, forEachChange decodes them
+    FieldReader reader{frame.m_body};
+    Field field;
+    while (reader.next(field)) {
+    }
+    msg.m_fields = frame.m_body;
+    return !reader.isMalformed();
+}
+
+ConditionView decodeCondition(std::string_view fields) {
+    ConditionView condition;
+    FieldReader reader{fields};
+    Field field;
+    while (reader.next(field)) {
+        switch (field.m_tag) {
+            case tag::conditionTime:
+                condition.m_time = field.m_value;
+                break;
+            case tag::conditionTemperature:
+                condition.m_temperature = field.asInt();
+                break;
+            case tag::conditionPressure:
+                condition.m_pressure = field.asUInt();
+                break;
+            case tag::conditionIcon:
+                condition.m_icon = field.asUInt();
+                break;
+        }
+    }
+    return condition;
+}
+
+Writer::Writer(char* buffer, size_t capacity)
+    : m_buffer{buffer},
+      m_capacity{capacity},
+      m_size{0},
+      m_hasOverflowed{false} {}
+
+void Writer::begin(MessageType type) {
+    m_size = 0;
+    m_hasOverflowed = false;
+    putByte(frameMarker | version);
+    putByte(static_cast<uint8_t>(type));
+    // body size, completed by finish()
+    putByte(0);
+    putByte(0);
+}
+
+void Writer::putString(uint8_t tag, std::string_view value) {
+    putByte(tag);
+    putVarint(value.size());
+    putBytes(value);
+}
+
+void Writer::putUInt(uint8_t tag, uint32_t value) {
+    uint8_t size = 1;
+    for (uint32_t v = value >> 7; v != 0; v >>= 7) {
+        size++;
+    }
+    putByte(tag);
+    putByte(size);
+    putVarint(value);
+}
+
+void Writer::putInt(uint8_t tag, int32_t value) {
+    // zigzag, so that small negative numbers take few bytes too
+    putUInt(tag, (static_cast<uint32_t>(value) << 1) ^
+                     static_cast<uint32_t>(value >> 31));
+}
+
+size_t Writer::beginNested(uint8_t tag) {
+    putByte(tag);
+    size_t position = m_size;
+    for (size_t i = 0; i < nestedSizeReserved; i++) {
+        putByte(0);
+    }
+    return position;
+}
+
+void Writer::endNested(size_t position) {
+    if (m_hasOverflowed)
+        return;
+    size_t begin = position + nestedSizeReserved;
+    size_t size = m_size - begin;
+    if (size >= 1u << 14) {
+        m_hasOverflowed = true;
+        return;
+    }
+    if (size < 0x80) {
+        // a single byte suffices: pull the fields back by one
+        m_buffer[position] = size;
+        memmove(m_buffer + position + 1, m_buffer + begin, size);
+        m_size--;
+    } else {
+        m_buffer[position] = 0x80 | (size & 0x7F);
+        m_buffer[position + 1] = size >> 7;
+    }
+}
+
+bool Writer::finish() {
+    size_t bodySize = m_size - headerSize;
+    if (m_hasOverflowed || bodySize > UINT16_MAX)
+        return false;
+    m_buffer[2] = bodySize & 0xFF;
+    m_buffer[3] = bodySize >> 8;
+    return true;
+}
+
+void Writer::putByte(uint8_t byte) {
+    if (m_size == m_capacity) {
+        m_hasOverflowed = true;
+        return;
+    }
+    m_buffer[m_size++] = byte;
+}
+
+void Writer::putVarint(uint32_t value) {
+    while (value >= 0x80) {
+        putByte(0x80 | (value & 0x7F));
+        value >>= 7;
+    }
+    putByte(value);
+}
+
+void Writer::putBytes(std::string_view bytes) {
+    if (m_capacity - m_size < bytes.size()) {
+        m_hasOverflowed = true;
+        return;
+    }
+    memcpy(m_buffer + m_size, bytes.data(), bytes.size());
+    m_size += bytes.size();
+}
+}  // namespace protocol
@@ -0,0 +1,70 @@
+#include "storage/file_flash.h"
+
+#include <esp_log.h>
+#include <vector>
+
+namespace storage {
+std::unique_ptr<FileFlash> FileFlash::open(char const* path,
+                                           size_t sectorSize,
+                                           size_t numSectors) {
+    FILE* file = fopen(path, "r+b");
+    bool isNew = !file;
+    if (isNew)
+        file = fopen(path, "w+b");
+    if (!file) {
+        ESP_LOGE(TAG, "Cannot open '%s'", path);
+        return nullptr;
+    }
+
+    auto flash = std::unique_ptr<FileFlash>(
+        new FileFlash(file, sectorSize, numSectors));
+    // a new or shorter file is extended with erased sectors
+    fseek(file, 0, SEEK_END);
+    long fileSize = ftell(file);
+    for (size_t s = fileSize / sectorSize; s < numSectors; s++) {
+        flash->eraseSector(s);
+    }
+    return flash;
+}
+
+FileFlash::~FileFlash() {
+    fclose(m_file);
+}
+
+bool FileFlash::read(size_t offset, void* dst, size_t size) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return readAt(offset, dst, size);
+}
+
+bool FileFlash::readAt(size_t offset, void* dst, size_t size) {
+    if (offset + size > getSize() || fseek(m_file, offset, SEEK_SET) != 0)
+        return false;
+    return fread(dst, 1, size, m_file) == size;
+}
+
+bool FileFlash::write(size_t offset, void const* src, size_t size) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::vector<unsigned char> bytes(size);
+    if (!readAt(offset, bytes.data(), size))
+        return false;
+    auto srcBytes = static_cast<unsigned char const*>(src);
+    for (size_t i = 0; i < size; i++) {
+        bytes[i] &= srcBytes[i];
+    }
+    if (fseek(m_file, offset, SEEK_SET) != 0 ||
+        fwrite(bytes.data(), 1, size, m_file) != size)
+        return false;
+    return fflush(m_file) == 0;
+}
+
+bool FileFlash::eraseSector(size_t idxSector) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (idxSector >= m_numSectors ||
+        fseek(m_file, idxSector * m_sectorSize, SEEK_SET) != 0)
+        return false;
+    std::vector<unsigned char> erased(m_sectorSize, 0xFF);
+    if (fwrite(erased.data(), 1, m_sectorSize, m_file) != m_sectorSize)
+        return false;
+    return fflush(m_file) == 0;
+}
+}  // namespace storage
@@ -0,0 +1,42 @@
+#include "storage/partition_flash.h"
+
+#include <esp_log.h>
+
+namespace storage {
+std::unique_ptr<PartitionFlash> PartitionFlash::open(char const* label) {
+    esp_partition_t const* partition = esp_partition_find_first(
+        ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, label);
+    if (!partition) {
+        ESP_LOGE(TAG, "No data partition '%s'", label);
+        return nullptr;
+    }
+    ESP_LOGD(TAG, "Partition '%s' at 0x%x of %u bytes", label,
+             partition->address, partition->size);
+    return std::unique_ptr<PartitionFlash>(new PartitionFlash(partition));
+}
+
+bool PartitionFlash::read(size_t offset, void* dst, size_t size) {
+    esp_err_t error = esp_partition_read(m_partition, offset, dst, size);
+    if (error != ESP_OK)
+        ESP_LOGE(TAG, "Reading %u bytes at 0x%x: %s", size, offset,
+                 esp_err_to_name(error));
+    return error == ESP_OK;
+}
+
+bool PartitionFlash::write(size_t offset, void const* src, size_t size) {
+    esp_err_t error = esp_partition_write(m_partition, offset, src, size);
+    if (error != ESP_OK)
+        ESP_LOGE(TAG, "Writing %u bytes at 0x%x: %s", size, offset,
+                 esp_err_to_name(error));
+    return error == ESP_OK;
+}
+
+bool PartitionFlash::eraseSector(size_t idxSector) {
+    esp_err_t error = esp_partition_erase_range(
+        m_partition, idxSector * SPI_FLASH_SEC_SIZE, SPI_FLASH_SEC_SIZE);
+    if (error != ESP_OK)
+        ESP_LOGE(TAG, "Erasing the sector %u: %s", idxSector,
+                 esp_err_to_name(error));
+    return error == ESP_OK;
+}
+}  // namespace storage
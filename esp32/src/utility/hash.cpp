@@ -0,0 +1,24 @@
+#include "utility/hash.h"
+
+uint32_t fnv1a(void const* data, size_t size, uint32_t h) {
+    auto bytes = static_cast<unsigned char const*>(data);
+    for (size_t i = 0; i < size; i++) {
+        h ^= bytes[i];
+        h *= 16777619u;
+    }
+    return h;
+}
+
+uint32_t crc32(void const* data, size_t size, uint32_t crc) {
+    // bitwise: records are checked once when written and once when read back
+    // at boot, not worth a table in RAM
+    auto bytes = static_cast<unsigned char const*>(data);
+    crc = ~crc;
+    for (size_t i = 0; i < size; i++) {
+        crc ^= bytes[i];
+        for (int b = 0; b < 8; b++) {
+            crc = (crc >> 1) ^ (0xEDB88320u & -(crc & 1));
+        }
+    }
+    return ~crc;
+}
@@ -0,0 +1,118 @@
+#include "utility/session_recorder.h"
+
+#include <esp_log.h>
+#include <esp_timer.h>
+#include <algorithm>
+
+SessionRecorder* SessionRecorder::getInstance() {
+    static SessionRecorder instance;
+    return &instance;
+}
+
+SessionRecorder::Sink SessionRecorder::makeFlashSink(
+    std::unique_ptr<storage::Flash> flash) {
+    // erased ahead rather than by the inputs recorded, which would wait for
+    // the sectors with the lock of the recorder held; the header after the
+    // last record is left erased, ending the trace
+    size_t numSectors = flash->getSize() / flash->getSectorSize();
+    for (size_t sector = 0; sector < numSectors; sector++) {
+        if (!flash->eraseSector(sector)) {
+            ESP_LOGE(TAG, "Sector %u of the session trace not erased", sector);
+            return [](std::string_view) { return false; };
+        }
+    }
+
+    // the sink is copied into a std::function, sharing its position
+    struct State {
+        std::unique_ptr<storage::Flash> m_flash;
+        size_t m_offset{0};
+    };
+    auto state = std::make_shared<State>();
+    state->m_flash = std::move(flash);
+    return [state](std::string_view record) {
+        storage::Flash& flash = *state->m_flash;
+        size_t end = state->m_offset + record.size();
+        if (end > flash.getSize())
+            return false;
+        if (!flash.write(state->m_offset, record.data(), record.size()))
+            return false;
+        state->m_offset = end;
+        return true;
+    };
+}
+
+SessionRecorder::Sink SessionRecorder::makeTextSink(
+    std::function<void(char const* line)> print) {
+    return [print](std::string_view record) {
+        static char const digits[] = "0123456789abcdef";
+        std::string line = "session ";
+        line.reserve(line.size() + 2 * record.size());
+        for (char c : record) {
+            line += digits[static_cast<uint8_t>(c) >> 4];
+            line += digits[static_cast<uint8_t>(c) & 0xF];
+        }
+        print(line.c_str());
+        return true;
+    };
+}
+
+void SessionRecorder::start(Sink sink) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_sink = std::move(sink);
+    m_startTime = esp_timer_get_time();
+    m_numRecords = 0;
+    m_isRecording = true;
+    ESP_LOGD(TAG, "Recording the session");
+}
+
+void SessionRecorder::stop() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_isRecording = false;
+    m_sink = nullptr;
+    ESP_LOGD(TAG, "Session recorded, %u records", m_numRecords.load());
+}
+
+void SessionRecorder::record(SessionEvent event,
+                             uint32_t time,
+                             std::string_view payload) {
+    if (!isRecording())
+        return;
+    if (payload.size() > maxPayloadSize) {
+        ESP_LOGE(TAG, "Record of %u bytes dropped", payload.size());
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_isRecording)
+        return;
+    // the time of the input in full, from the 32 bits of the ones before now
+    int64_t now = esp_timer_get_time();
+    int64_t fullTime =
+        now - static_cast<uint32_t>(static_cast<uint32_t>(now) - time);
+    // an input arrived before the start, e.g. a write waiting to be decoded,
+    // is recorded at the start
+    int64_t elapsed = std::max<int64_t>(fullTime - m_startTime, 0);
+    if (elapsed > UINT32_MAX) {
+        ESP_LOGE(TAG, "Session over 71 minutes, stopped after %u records",
+                 m_numRecords.load());
+        m_isRecording = false;
+        m_sink = nullptr;
+        return;
+    }
+    char record[headerSize + maxPayloadSize];
+    for (size_t i = 0; i < 4; i++)
+        record[i] = static_cast<char>(elapsed >> (8 * i));
+    record[4] = static_cast<char>(event);
+    record[5] = static_cast<char>(payload.size());
+    record[6] = static_cast<char>(payload.size() >> 8);
+    payload.copy(record + headerSize, payload.size());
+
+    if (!m_sink(std::string_view{record, headerSize + payload.size()})) {
+        ESP_LOGE(TAG, "Session trace full after %u records",
+                 m_numRecords.load());
+        m_isRecording = false;
+        m_sink = nullptr;
+        return;
+    }
+    m_numRecords++;
+}
@@ -0,0 +1,133 @@
+#include "utility/session_replayer.h"
+
+#include <esp_log.h>
+#include <esp_pthread.h>
+#include <esp_timer.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+
+namespace {
+// names of the events, by SessionEvent
+char const* const eventNames[numSessionEvents] = {"press", "click", "swipe+",
+                                                  "swipe-", "phone"};
+
+// microseconds a record may be injected after its time before the replay
+// counts as behind, e.g. the frames of the record before lasting longer
+constexpr int64_t maxLateness = 10000;
+}  // namespace
+
+SessionReplayer::SessionReplayer(storage::Flash& trace, Injector inject)
+    : m_trace{trace}, m_inject{std::move(inject)} {}
+
+SessionReplayer::~SessionReplayer() {
+    wait();
+}
+
+void SessionReplayer::start(uint32_t speed) {
+    wait();
+    m_isReplaying = true;
+    esp_pthread_cfg_t config = esp_pthread_get_default_config();
+    config.stack_size = replayTaskStackSize;
+    config.thread_name = "replay";
+    esp_pthread_set_cfg(&config);
+    m_task = std::thread([this, speed]() { run(speed > 0 ? speed : 1); });
+    // the threads started later by this one get the default configuration
+    config = esp_pthread_get_default_config();
+    esp_pthread_set_cfg(&config);
+}
+
+void SessionReplayer::wait() {
+    if (m_task.joinable())
+        m_task.join();
+}
+
+void SessionReplayer::onFrame(uint32_t duration) {
+    if (!m_isReplaying)
+        return;
+    m_frameTime.fetch_add(duration, std::memory_order_relaxed);
+    m_numFrames.fetch_add(1, std::memory_order_relaxed);
+    m_lastFrameTime = esp_timer_get_time();
+}
+
+std::string SessionReplayer::report() const {
+    char text[512];
+    int size = snprintf(text, sizeof(text), "frame us   n     p50     p90     "
+                                            "p99     max\n");
+    for (size_t event = 0; event < numSessionEvents; event++) {
+        if (size < 0 || static_cast<size_t>(size) >= sizeof(text))
+            break;
+        Tracer::Histogram const& histogram = m_histograms[event];
+        size += snprintf(text + size, sizeof(text) - size,
+                         "%-6s %5u %7u %7u %7u %7u\n", eventNames[event],
+                         histogram.getCount(), histogram.getPercentile(50),
+                         histogram.getPercentile(90),
+                         histogram.getPercentile(99), histogram.getMax());
+    }
+    if (size >= 0 && static_cast<size_t>(size) < sizeof(text))
+        size += snprintf(text + size, sizeof(text) - size,
+                         "records %u, late %u\n", m_numRecords.load(),
+                         m_numLate.load());
+    if (size < 0)
+        return {};
+    return std::string{text, std::min(static_cast<size_t>(size),
+                                      sizeof(text) - 1)};
+}
+
+void SessionReplayer::run(uint32_t speed) {
+    char record[SessionRecorder::headerSize + SessionRecorder::maxPayloadSize];
+    size_t offset = 0;
+    int64_t start = esp_timer_get_time();
+    while (offset + SessionRecorder::headerSize <= m_trace.getSize()) {
+        auto header = reinterpret_cast<uint8_t const*>(record);
+        if (!m_trace.read(offset, record, SessionRecorder::headerSize))
+            break;
+        // an erased header ends the trace
+        if (header[4] >= numSessionEvents)
+            break;
+        uint32_t time = header[0] | header[1] << 8 | header[2] << 16 |
+                        static_cast<uint32_t>(header[3]) << 24;
+        size_t size = header[5] | header[6] << 8;
+        size_t end = offset + SessionRecorder::headerSize + size;
+        if (size > SessionRecorder::maxPayloadSize || end > m_trace.getSize() ||
+            !m_trace.read(offset + SessionRecorder::headerSize,
+                          record + SessionRecorder::headerSize, size)) {
+            ESP_LOGE(TAG, "Record at %u malformed, replay ended", offset);
+            break;
+        }
+
+        int64_t due = start + time / speed;
+        int64_t now = esp_timer_get_time();
+        if (due > now)
+            std::this_thread::sleep_for(std::chrono::microseconds{due - now});
+        else if (now - due > maxLateness)
+            m_numLate++;
+        // the frames so far go to the record before
+        fold();
+        m_event = static_cast<SessionEvent>(header[4]);
+        m_index = m_numRecords++;
+        m_inject(m_event, std::string_view{record + SessionRecorder::headerSize,
+                                           size});
+        offset = end;
+    }
+
+    // the frames of the last record, until the main loop is idle
+    m_lastFrameTime = esp_timer_get_time();
+    while (esp_timer_get_time() - m_lastFrameTime < settleTime)
+        std::this_thread::sleep_for(std::chrono::microseconds{settleTime / 10});
+    fold();
+    m_isReplaying = false;
+    ESP_LOGD(TAG, "Session replayed:\n%s", report().c_str());
+}
+
+void SessionReplayer::fold() {
+    uint32_t numFrames = m_numFrames.exchange(0, std::memory_order_relaxed);
+    uint32_t frameTime = m_frameTime.exchange(0, std::memory_order_relaxed);
+    // the frames before the first record are not the replay's, and a record
+    // drawing nothing, e.g. a fragment, has no frame time
+    if (m_numRecords == 0 || numFrames == 0)
+        return;
+    m_histograms[static_cast<size_t>(m_event)].add(frameTime);
+    ESP_LOGD(TAG, "record %u (%s): %u frames in %u us", m_index,
+             eventNames[static_cast<size_t>(m_event)], numFrames, frameTime);
+}
@@ -0,0 +1,64 @@
+#include "utility/touch_tracer.h"
+
+#include <algorithm>
+#include <cstdio>
+
+namespace {
+// names of the stages, by the stage they end, and of the gestures
+char const* const stageNames[] = {"post", "queue", "draw", "tail"};
+char const* const gestureNames[] = {"press", "click", "swipe+", "swipe-"};
+}  // namespace
+
+TouchTracer* TouchTracer::getInstance() {
+    static TouchTracer instance;
+    return &instance;
+}
+
+std::string TouchTracer::dump() const {
+    char text[512];
+    int size = snprintf(text, sizeof(text), "us       n     p50     p90     "
+                                            "p99     max\n");
+    auto print = [&](char const* name, Tracer::Histogram const& histogram) {
+        if (size < 0 || static_cast<size_t>(size) >= sizeof(text))
+            return;
+        size += snprintf(text + size, sizeof(text) - size,
+                         "%-6s %5u %7u %7u %7u %7u\n", name,
+                         histogram.getCount(), histogram.getPercentile(50),
+                         histogram.getPercentile(90),
+                         histogram.getPercentile(99), histogram.getMax());
+    };
+    for (size_t stage = 0; stage < numStages; stage++)
+        print(stageNames[stage], m_stages[stage]);
+    for (size_t gesture = 0; gesture < numGestures; gesture++)
+        print(gestureNames[gesture], m_gestures[gesture]);
+    if (size >= 0 && static_cast<size_t>(size) < sizeof(text))
+        size += snprintf(text + size, sizeof(text) - size, "undrawn %4u\n",
+                         m_numUndrawn.load());
+    if (size < 0)
+        return {};
+    return std::string{text, std::min(static_cast<size_t>(size),
+                                      sizeof(text) - 1)};
+}
+
+void TouchTracer::fold(int64_t endTime) {
+    if (!m_isHandling)
+        return;
+    m_isHandling = false;
+    auto add = [this](Stage stage, int64_t from, int64_t to) {
+        m_stages[static_cast<size_t>(stage)].add(
+            static_cast<uint32_t>(std::max<int64_t>(to - from, 0)));
+    };
+    add(Stage::POSTED, m_touchTime, m_postTime);
+    add(Stage::BEGUN, m_postTime, m_beginTime);
+    if (m_transferTime == 0) {
+        m_numUndrawn.fetch_add(1, std::memory_order_relaxed);
+    } else {
+        add(Stage::TRANSFERRED, m_beginTime, m_transferTime);
+        add(Stage::ENDED, m_transferTime, endTime);
+        size_t gesture = static_cast<size_t>(m_gesture);
+        if (gesture < numGestures)
+            m_gestures[gesture].add(static_cast<uint32_t>(
+                std::max<int64_t>(m_transferTime - m_touchTime, 0)));
+    }
+    m_numHandled.fetch_add(1, std::memory_order_relaxed);
+}
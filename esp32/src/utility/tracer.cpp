@@ -0,0 +1,177 @@
+#include "utility/tracer.h"
+
+#include <esp_timer.h>
+#include <algorithm>
+#include <cstdio>
+
+namespace {
+// microseconds since the boot, wrapping after 71 minutes: the latencies are
+// differences, far shorter
+uint32_t getTime() {
+    return static_cast<uint32_t>(esp_timer_get_time());
+}
+
+// names of the stages, by the stage they end
+char const* const stageNames[numTraceStages - 1] = {"phone", "decode",
+                                                    "queue", "wait", "draw"};
+}  // namespace
+
+void Tracer::Histogram::add(uint32_t value) {
+    m_buckets[getBucket(value)].fetch_add(1, std::memory_order_relaxed);
+    if (value > m_max)
+        m_max = value;
+    m_count.fetch_add(1, std::memory_order_relaxed);
+}
+
+uint32_t Tracer::Histogram::getPercentile(uint32_t percent) const {
+    uint32_t count = m_count;
+    if (count == 0)
+        return 0;
+    // rank of the percentile, from 1
+    uint32_t rank = (static_cast<uint64_t>(count) * percent + 99) / 100;
+    if (rank == 0)
+        rank = 1;
+    uint32_t seen = 0;
+    for (size_t bucket = 0; bucket < numBuckets; bucket++) {
+        seen += m_buckets[bucket].load(std::memory_order_relaxed);
+        if (seen >= rank)
+            return std::min(getUpperBound(bucket), getMax());
+    }
+    return getMax();
+}
+
+size_t Tracer::Histogram::getBucket(uint32_t value) {
+    if (value < 4)
+        return value;
+    // the 2 bits after the highest one tell the bucket within its power of 2
+    size_t msb = 31 - __builtin_clz(value);
+    size_t sub = (value >> (msb - 2)) & 3;
+    return 4 + (msb - 2) * 4 + sub;
+}
+
+uint32_t Tracer::Histogram::getUpperBound(size_t bucket) {
+    if (bucket < 4)
+        return bucket;
+    size_t shift = (bucket - 4) / 4;
+    uint64_t lower = static_cast<uint64_t>(4 + (bucket - 4) % 4) << shift;
+    return lower + (uint64_t{1} << shift) - 1;
+}
+
+Tracer* Tracer::getInstance() {
+    // constructed once, before the tasks stamping the messages start
+    static Tracer instance;
+    return &instance;
+}
+
+uint32_t Tracer::begin(uint32_t receivedTime) {
+    uint32_t id = m_nextId.fetch_add(1, std::memory_order_relaxed) & maxId;
+    if (id == 0)
+        id = m_nextId.fetch_add(1, std::memory_order_relaxed) & maxId;
+    record(id, TraceStage::RECEIVED, receivedTime);
+    return id;
+}
+
+void Tracer::record(uint32_t id, TraceStage stage) {
+    if (id == 0)
+        return;
+    record(id, stage, getTime());
+    if (stage == TraceStage::DRAWN)
+        fold(id);
+}
+
+void Tracer::recordSent(uint32_t id, uint32_t sentAt, uint32_t receivedTime) {
+    if (id == 0)
+        return;
+    // the arrival on the millisecond clock of the boot, as the phone stamps
+    int64_t now = esp_timer_get_time();
+    uint32_t age = static_cast<uint32_t>(now) - receivedTime;
+    uint32_t receivedMs = static_cast<uint32_t>((now - age) / 1000);
+
+    // differences modulo 2^32, both clocks wrap
+    uint32_t difference = receivedMs - sentAt;
+    if (!m_hasPhoneOffset ||
+        static_cast<int32_t>(difference - m_phoneOffset) < 0) {
+        m_phoneOffset = difference;
+        m_hasPhoneOffset = true;
+    }
+    uint32_t leg = difference - m_phoneOffset;
+    record(id, TraceStage::SENT, receivedTime - leg * 1000);
+}
+
+std::string Tracer::dump() const {
+    char text[512];
+    int size = snprintf(text, sizeof(text), "us       n     p50     p90     "
+                                            "p99     max\n");
+    auto print = [&](char const* name, Histogram const& histogram) {
+        if (size < 0 || static_cast<size_t>(size) >= sizeof(text))
+            return;
+        size += snprintf(text + size, sizeof(text) - size,
+                         "%-6s %5u %7u %7u %7u %7u\n", name,
+                         histogram.getCount(), histogram.getPercentile(50),
+                         histogram.getPercentile(90),
+                         histogram.getPercentile(99), histogram.getMax());
+    };
+    for (size_t stage = 0; stage < m_stages.size(); stage++)
+        print(stageNames[stage], m_stages[stage]);
+    print("total", m_total);
+    if (size >= 0 && static_cast<size_t>(size) < sizeof(text))
+        size += snprintf(text + size, sizeof(text) - size, "lost   %5u\n",
+                         m_numLost.load());
+    if (size < 0)
+        return {};
+    return std::string{text, std::min(static_cast<size_t>(size),
+                                      sizeof(text) - 1)};
+}
+
+void Tracer::record(uint32_t id, TraceStage stage, uint32_t time) {
+    uint32_t position = m_head.fetch_add(1, std::memory_order_relaxed);
+    Stamp& stamp = m_ring[position % ringSize];
+    // a reader seeing an odd or another sequence skips the stamp, the
+    // writer lapping this one included
+    stamp.m_seq.store(2 * position + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    stamp.m_idStage.store(id << 8 | static_cast<uint8_t>(stage),
+                          std::memory_order_relaxed);
+    stamp.m_time.store(time, std::memory_order_relaxed);
+    stamp.m_seq.store(2 * position + 2, std::memory_order_release);
+}
+
+void Tracer::fold(uint32_t id) {
+    std::array<uint32_t, numTraceStages> times;
+    std::array<bool, numTraceStages> isStamped{};
+
+    // newest first, back to the arrival, which is stamped first
+    uint32_t head = m_head.load(std::memory_order_relaxed);
+    for (uint32_t back = 1; back <= ringSize && back <= head; back++) {
+        uint32_t position = head - back;
+        Stamp const& stamp = m_ring[position % ringSize];
+        uint32_t seq = stamp.m_seq.load(std::memory_order_acquire);
+        uint32_t idStage = stamp.m_idStage.load(std::memory_order_relaxed);
+        uint32_t time = stamp.m_time.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        size_t stage = idStage & 0xFF;
+        if (seq != 2 * position + 2 ||
+            stamp.m_seq.load(std::memory_order_relaxed) != seq ||
+            idStage >> 8 != id || stage >= numTraceStages ||
+            isStamped[stage])
+            continue;
+        times[stage] = time;
+        isStamped[stage] = true;
+        if (stage == static_cast<size_t>(TraceStage::RECEIVED))
+            break;
+    }
+
+    // the stamps of a message waiting longer than the ring lasts, e.g. in a
+    // backlog, are overwritten: the histograms miss it, the count tells
+    size_t received = static_cast<size_t>(TraceStage::RECEIVED);
+    size_t drawn = static_cast<size_t>(TraceStage::DRAWN);
+    if (!isStamped[received]) {
+        m_numLost.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    for (size_t stage = 1; stage < numTraceStages; stage++)
+        if (isStamped[stage - 1] && isStamped[stage])
+            m_stages[stage - 1].add(times[stage] - times[stage - 1]);
+    if (isStamped[drawn])
+        m_total.add(times[drawn] - times[received]);
+}
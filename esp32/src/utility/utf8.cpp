@@ -0,0 +1,11 @@
+#include "utility/utf8.h"
+
+std::string_view truncateUTF8(std::string_view str, size_t maxSize) {
+    if (str.size() <= maxSize)
+        return str;
+    size_t size = maxSize;
+    // continuation bytes are 10xxxxxx
+    while (size > 0 && (static_cast<unsigned char>(str[size]) & 0xC0) == 0x80)
+        size--;
+    return str.substr(0, size);
+}
@@ -1,10 +1,22 @@
 #pragma once
-#include "utility/blocking_queue.h"
+#include <memory>
+#include "utility/priority_blocking_queue.h"
 #include "view/ui_event.h"
 
 namespace view {
-class MainEventQueue : public BlockingQueue<std::unique_ptr<UIEvent>> {
+/**
+ * Events for the main loop, handled by priority
+ */
+class MainEventQueue
+    : public PriorityBlockingQueue<std::unique_ptr<UIEvent>,
+                                   numUIEventPriorities> {
 public:
+    void push(std::unique_ptr<UIEvent>&& event) {
+        size_t lane = static_cast<size_t>(event->getPriority());
+        Tracer::getInstance()->record(event->getTraceId(), TraceStage::QUEUED);
+        PriorityBlockingQueue::push(std::move(event), lane);
+    }
+
     static MainEventQueue* getInstance() {
         if (instance)
             return instance;
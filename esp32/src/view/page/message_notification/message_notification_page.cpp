@@ -1,13 +1,21 @@
 #include "view/page/message_notification/message_notification_page.h"
 #include "ble/remote_dispatcher.h"
 #include "controller/central_controller.h"
+#include "esp_timer.h"
 
 namespace view {
 std::unique_ptr<MessageNotificationPage>
 MessageNotificationPage::Factory::create() {
+    int64_t begUs = esp_timer_get_time();
+    uint32_t freeHeapBefore = esp_get_free_heap_size();
+
     std::unique_ptr<MessageNotificationPage> messagesPage =
         std::unique_ptr<MessageNotificationPage>(new MessageNotificationPage());
 
+    ESP_LOGD(TAG, "Page constructed in %lld us, taking %d bytes of heap",
+             esp_timer_get_time() - begUs,
+             static_cast<int>(freeHeapBefore - esp_get_free_heap_size()));
+
     auto remoteDispatcher = ble::RemoteDispatcher::getInstance();
 
     remoteDispatcher->addObserver(ble::MessageNotification::name,
@@ -26,6 +34,7 @@ MessageNotificationPage::MessageNotificationPage()
     : Page::Page(RectType{Coordinates{0, 0}, Size{SCREEN_WIDTH, SCREEN_HEIGHT}},
                  nullptr),
       m_messagesSz{0},
+      m_seqNextMessage{0},
       m_idxFocusedMessage{0},
       m_isFocused{false},
       m_title{new TextArea(RectType{Coordinates{0, 0}, Size{200, 20}}, this)} {
@@ -35,36 +44,33 @@ MessageNotificationPage::MessageNotificationPage()
 void MessageNotificationPage::updateScreenWithNewMessages() {
     auto controller = controller::CentralController::getInstance();
 
-    std::vector<std::string> newMessages =
-        controller->getMessages(maxNumMessages);
+    // only the number of messages arrived since the last update is needed,
+    // their content is read from the store when they are focused
+    uint32_t seqNextMessage = m_seqNextMessage;
+    size_t numNewMessages = controller->readMessagesSince(
+        m_seqNextMessage, maxNumMessages, [&](model::MessageView const& msg) {
+            seqNextMessage = std::max(seqNextMessage, msg.m_seq + 1);
+        });
+    m_seqNextMessage = seqNextMessage;
 
-    ESP_LOGD(TAG, "There are %u new messages: ", newMessages.size());
+    ESP_LOGD(TAG, "There are %u new messages", numNewMessages);
 
-    byte oldIdx{m_idxFocusedMessage};
-
-    // reset the idx of the current message to the first one to print the title
-    // correctly
-    m_idxFocusedMessage = 0;
-    setUpTitle(newMessages);
-
-    // set the index back to its original value to be able to delete it
-    m_idxFocusedMessage = oldIdx;
-    setUpMessages(newMessages);
+    m_messagesSz =
+        std::min<size_t>(maxNumMessages, m_messagesSz + numNewMessages);
+    // set back to the most recent message
     m_idxFocusedMessage = 0;
+    setUpTitle();
+    showFocusedMessage();
 }
 
-void MessageNotificationPage::setUpTitle(
-    std::vector<std::string> const& newMessages) {
+void MessageNotificationPage::setUpTitle() {
     std::string title;
 
-    byte numMessages = std::min(
-        static_cast<byte>(m_messagesSz + newMessages.size()), maxNumMessages);
-
-    if (numMessages == 0) {
+    if (m_messagesSz == 0) {
         title = "No messages yet";
     } else {
         title = "Message " + std::to_string(m_idxFocusedMessage + 1) + " / " +
-                std::to_string(numMessages);
+                std::to_string(m_messagesSz);
     }
 
     m_title->clearFromScreen();
@@ -83,6 +89,28 @@ void MessageNotificationPage::setUpTitle(
     m_title->makeVisible(true);
 }
 
+void MessageNotificationPage::showFocusedMessage() {
+    if (m_messagesSz == 0)
+        return;
+
+    if (!m_message)
+        m_message = allocateNewMessage();
+
+    uint32_t seq = m_seqNextMessage - 1 - m_idxFocusedMessage;
+    auto controller = controller::CentralController::getInstance();
+    bool isStored = controller->readMessage(
+        seq, [this](model::MessageView const& msg) {
+            extractContent(msg, m_content);
+        });
+    if (!isStored) {
+        ESP_LOGD(TAG, "The message %u has been evicted", seq);
+        m_content = "The message is no longer available";
+    }
+
+    ESP_LOGD(TAG, "Showing the message %u: '%s'", seq, m_content.c_str());
+    m_message->setContent(m_content);
+}
+
 void MessageNotificationPage::removeFocusFromMessage(
     std::unique_ptr<ScrollableText> const& pMsg) {
     auto [titleX, titleY] = m_title->getCoordinates();
@@ -107,42 +135,6 @@ std::unique_ptr<ScrollableText> MessageNotificationPage::allocateNewMessage() {
     return pMsg;
 }
 
-void MessageNotificationPage::setUpMessages(
-    std::vector<std::string> const& newMessages) {
-    byte numNewMessages = newMessages.size();
-    // no new message, nothing to change
-    if (numNewMessages == 0)
-        return;
-
-    assert(numNewMessages <= maxNumMessages);
-
-    // shift by numNewMessages to have space for the new messages
-    for (int16_t i = m_messagesSz - 1; i >= 0; i--) {
-        if (i == m_idxFocusedMessage)
-            m_messages[i]->clearFromScreen();
-        if (i + numNewMessages < m_messages.size()) {
-            ESP_LOGD(TAG, "Shifing the %u message", i + numNewMessages);
-            std::swap(m_messages[i], m_messages[i + numNewMessages]);
-        }
-    }
-
-    for (byte i = 0; i < numNewMessages; i++) {
-        auto& pMsg = m_messages[i];
-        if (!pMsg)
-            pMsg = allocateNewMessage();
-
-        ESP_LOGD(TAG, "Set message content to the new incoming one: '%s'",
-                 newMessages[i].c_str());
-        pMsg->setContent(extractContent(newMessages[i]));
-    }
-
-    // set back to the most recent message
-    m_idxFocusedMessage = 0;
-    // update the messages'size
-    m_messagesSz = std::min(maxNumMessages,
-                            static_cast<byte>(numNewMessages + m_messagesSz));
-}
-
 void MessageNotificationPage::setMessageFullScreen(
     std::unique_ptr<ScrollableText> const& pMsg) {
     ESP_LOGD(TAG, "Setting the message full screen");
@@ -163,7 +155,7 @@ void MessageNotificationPage::setMessageFullScreen(
  * time the page with all messages returns back visible.
  */
 void MessageNotificationPage::onEvent(Click const&) {
-    auto& pMsg = m_messages[m_idxFocusedMessage];
+    auto& pMsg = m_message;
 
     if (!pMsg) {
         ESP_LOGD(TAG, "No messages, click has no effectl");
@@ -187,30 +179,32 @@ void MessageNotificationPage::onEvent(Click const&) {
 void MessageNotificationPage::onEvent(SwipeClockwise const& event) {
     if (m_isFocused) {
         ESP_LOGD(TAG, "Message is focused, deliver to it the clockwise swipe");
-        m_messages[m_idxFocusedMessage]->onEvent(event);
+        m_message->onEvent(event);
         return;
     }
 
     if (m_idxFocusedMessage + 1 < m_messagesSz) {
         ESP_LOGD(TAG, "Message is not focused, swiping");
-        m_messages[m_idxFocusedMessage]->clearFromScreen();
+        m_message->clearFromScreen();
         m_idxFocusedMessage += 1;
-        setUpTitle(std::vector<std::string>());
+        setUpTitle();
+        showFocusedMessage();
         draw();
     }
 }
 
 void MessageNotificationPage::onEvent(SwipeAntiClockwise const& event) {
     if (m_isFocused) {
-        m_messages[m_idxFocusedMessage]->onEvent(event);
+        m_message->onEvent(event);
         return;
     }
 
     if (m_idxFocusedMessage - 1 >= 0) {
         // clear previous message
-        m_messages[m_idxFocusedMessage]->clearFromScreen();
+        m_message->clearFromScreen();
         m_idxFocusedMessage -= 1;
-        setUpTitle(std::vector<std::string>());
+        setUpTitle();
+        showFocusedMessage();
         draw();
     }
 }
@@ -229,7 +223,7 @@ void MessageNotificationPage::onEvent(ble::MessageNotification const& event) {
 
 void MessageNotificationPage::drawOnScreen() {
     m_title->draw();
-    auto const& pMsg = m_messages[m_idxFocusedMessage];
+    auto const& pMsg = m_message;
     if (pMsg) {
         ESP_LOGD(TAG, "Printint the message");
         ESP_LOGD(TAG, "The message is empty? %d", pMsg->isEmpty());
@@ -1,8 +1,8 @@
 #include "view/page/translation/translation.h"
 
-#include <ArduinoJson.h>
 #include "ble/remote_dispatcher.h"
 #include "input/input_manager.h"
+#include "protocol/wire.h"
 #include "utility/resource_monitor.h"
 
 namespace view {
@@ -13,9 +13,14 @@ TranslationPage::TranslationPage()
       m_text(new TextArea(
           RectType{Coordinates{0, 60}, Size{SCREEN_WIDTH, SCREEN_HEIGHT - 60}},
           this,
-          "No data arrived yet")) {
-    m_text->wrapTextVertically(true);
+          "No data arrived yet")),
+      m_transcript(new Teleprompter(
+          RectType{Coordinates{0, 60}, Size{SCREEN_WIDTH, SCREEN_HEIGHT - 60}},
+          this)),
+      m_idUtterance{-1},
+      m_isOutOfSync{false} {
     m_text->setCenter(true, getFrame());
+    m_transcript->makeVisible(false);
 }
 
 std::unique_ptr<TranslationPage> TranslationPage::Factory::create() {
@@ -32,27 +37,62 @@ std::unique_ptr<TranslationPage> TranslationPage::Factory::create() {
 }
 
 void TranslationPage::onEvent(const ble::UpdateMessage& event) {
-    ESP_LOGD(TAG, "The translation page received a new message: %s\n",
-             event.msg.c_str());
-
-    JsonDocument doc;
-    DeserializationError error = deserializeJson(doc, event.msg);
-    if (error) {
-        ESP_LOGD(TAG, "Error '%s' when deserializing\n", error.c_str());
+    protocol::Frame frame;
+    if (!protocol::decodeFrame(event.msg, frame))
         return;
-    }
 
-    if (doc["command"] != commandName) {
+    protocol::PartialTranscriptView partial;
+    if (protocol::decode(frame, partial)) {
+        int32_t idUtterance = partial.m_idUtterance;
+
+        showTranscript();
+        bool isNewUtterance = idUtterance != m_idUtterance;
+        if (isNewUtterance) {
+            m_idUtterance = idUtterance;
+            m_transcript->startUtterance();
+        }
+        // the stable prefix is unknown if sent before the page was created
+        // or in a write lost since: the tails would be appended to the wrong
+        // text, thus they are dropped until the phone sends the whole text
+        // again, see TranscriptDeltaEncoder
+        if (partial.m_numStableBytes == 0)
+            m_isOutOfSync = false;
+        else if (isNewUtterance ||
+                 partial.m_numStableBytes > m_transcript->getUtteranceSize())
+            m_isOutOfSync = true;
+        if (m_isOutOfSync) {
+            ESP_LOGD(TAG, "The stable prefix of utterance %d is unknown",
+                     idUtterance);
+            return;
+        }
+        m_transcript->editTail(partial.m_numStableBytes,
+                               std::string{partial.m_tail});
+        ESP_LOGD(TAG, "%u bytes received for an utterance of %u bytes",
+                 event.msg.size(), m_transcript->getUtteranceSize());
+        m_transcript->draw();
         return;
     }
 
-    std::string msg = doc["text"];
-    if (msg.empty())
+    protocol::TranslationView translation;
+    if (!protocol::decode(frame, translation) || translation.m_text.empty())
         return;
-    // do not center the text when it arrives from a translation
-    m_text->setCenter(false, RectType::none);
-    m_text->setContent(msg);
-    m_text->draw();
+    ESP_LOGD(TAG, "The translation page received a new message: %.*s\n",
+             static_cast<int>(translation.m_text.size()),
+             translation.m_text.data());
+    showTranscript();
+    // new lines are appended at the bottom, the older ones scroll up
+    m_idUtterance = -1;
+    m_isOutOfSync = false;
+    m_transcript->setContent(std::string{translation.m_text});
+    m_transcript->draw();
+}
+
+void TranslationPage::showTranscript() {
+    if (m_text->isVisible()) {
+        m_text->clearFromScreen();
+        m_text->makeVisible(false);
+        m_transcript->makeVisible(true);
+    }
 }
 
 void TranslationPage::drawOnScreen() {
@@ -1,9 +1,10 @@
 #include "view/page/weather/weather.h"
 
-#include <ArduinoJson.h>
+#include <cassert>
 #include "ble/remote_dispatcher.h"
 #include "controller/central_controller.h"
 #include "input/input_manager.h"
+#include "protocol/wire.h"
 #include "utility/resource_monitor.h"
 #include "view/bin_pngs/24/swipe_left.h"
 #include "view/bin_pngs/24/swipe_right.h"
@@ -63,7 +64,9 @@ WeatherPage::WeatherPage()
                              this,
                              {BIN_IMG(32, 32, swipe_right)})),
 
-      m_idxCurCondition{0} {
+      m_icons{},
+      m_idxCurCondition{0},
+      m_iconShown{protocol::unknownIcon} {
     auto [x, y] = getCoordinates();
     auto [w, h] = getSize();
     auto arrowSz = m_leftArrow->getSize();
@@ -94,6 +97,11 @@ WeatherPage::WeatherPage()
     m_location->move(
         Coordinates{x + horizontalSpaceForArrows + 20, yCenter - 50});
 
+    // swiping between the conditions sets the same contents again
+    m_time->setLayoutCacheCapacity(numLayoutsCached);
+    m_temperature->setLayoutCacheCapacity(numLayoutsCached);
+    m_pressure->setLayoutCacheCapacity(numLayoutsCached);
+
     auto [locationX, locationY] = m_location->getCoordinates();
 
     auto iconSz = Size{32, 32};
@@ -111,7 +119,7 @@ WeatherPage::WeatherPage()
     auto frameIcon = RectType{iconCoordinates, iconSz};
     auto parentView = this;
 
-    m_mapIdToIcon = std::unordered_map<std::string, Image*>{
+    std::pair<std::string_view, Image*> const icons[] = {
         IMG_MAP_ENTRY(clear, frameIcon, parentView, imgWidth, imgHeight),
         IMG_MAP_ENTRY(clear_night, frameIcon, parentView, imgWidth, imgHeight),
         IMG_MAP_ENTRY(clouds_1, frameIcon, parentView, imgWidth, imgHeight),
@@ -140,8 +148,11 @@ WeatherPage::WeatherPage()
         IMG_MAP_ENTRY(tornado, frameIcon, parentView, imgWidth, imgHeight),
         IMG_MAP_ENTRY(squall, frameIcon, parentView, imgWidth, imgHeight),
     };
-
-    ESP_LOGD(TAG, "Size of the map: %lu", sizeof(m_mapIdToIcon));
+    for (auto [name, icon] : icons) {
+        uint8_t id = protocol::getIconId(name);
+        assert(id != protocol::unknownIcon && "Icon not interned");
+        m_icons[id] = icon;
+    }
 
     m_temperature->move(Coordinates{iconCoordinates.m_x + iconSz.m_width + 10,
                                     iconCoordinates.m_y});
@@ -160,63 +171,76 @@ std::unique_ptr<WeatherPage> WeatherPage::Factory::create() {
     auto inputManager = InputManager::getInstance();
     inputManager->addObserver(SwipeClockwise::name, weatherPage.get());
     inputManager->addObserver(SwipeAntiClockwise::name, weatherPage.get());
+    // the forecast arrived while another page was shown
+    weatherPage->readWeather();
     return weatherPage;
 }
 
-void WeatherPage::onEvent(ble::UpdateMessage const& event) {
-    JsonDocument doc;
+bool WeatherPage::Shown::operator==(Shown const& other) const {
+    if (m_isEmpty || other.m_isEmpty)
+        return m_isEmpty == other.m_isEmpty;
+    return m_condition == other.m_condition &&
+           m_hasPrevious == other.m_hasPrevious && m_hasNext == other.m_hasNext;
+}
 
-    DeserializationError error = deserializeJson(doc, event.msg);
-    if (error) {
-        ESP_LOGD(TAG, "Error '%s' when deserializing\n", error.c_str());
-        return;
+WeatherPage::Shown WeatherPage::getShown() const {
+    model::Forecast const& forecast = m_weather.getForecast();
+    Shown shown{};
+    shown.m_isEmpty = forecast.isEmpty();
+    if (!shown.m_isEmpty) {
+        shown.m_condition = forecast[m_idxCurCondition];
+        shown.m_hasPrevious = m_idxCurCondition > 0;
+        shown.m_hasNext = m_idxCurCondition + 1u < forecast.size();
     }
+    return shown;
+}
 
-    if (doc["command"] != commandName)
-        return;
-
-    const char* location = doc["location"];
-
-    assert(location);
-
-    m_location->setContent(location);
+bool WeatherPage::readWeather() {
+    bool isLocationChanged = false;
+    controller::CentralController::getInstance()->readWeather(
+        [&](model::Weather const& weather) {
+            isLocationChanged =
+                weather.getLocation() != m_weather.getLocation();
+            // the forecast is copied into the page: it has no pointer, thus
+            // the model can go on being updated while the page draws
+            m_weather = weather;
+        });
+    if (isLocationChanged)
+        m_location->setContent(std::string{m_weather.getLocation()});
+    return isLocationChanged;
+}
 
-    JsonArrayConst conditions = doc["conditions"];
-    if (conditions.isNull()) {
-        ESP_LOGD(TAG, "Error in parsing the Json for the conditions");
+void WeatherPage::onEvent(ble::UpdateMessage const& event) {
+    protocol::Frame frame;
+    if (!protocol::decodeFrame(event.msg, frame) ||
+        (frame.m_type != protocol::MessageType::WEATHER &&
+         frame.m_type != protocol::MessageType::WEATHER_DELTA))
         return;
-    }
-
-    // make the current icon invisible, skip if none has been displayed yet
-    if (!m_conditions.empty()) {
-        m_mapIdToIcon[m_conditions[m_idxCurCondition].m_icon]->makeVisible(
-            false);
-    }
-    m_conditions.clear();
-    m_idxCurCondition = 0;
-    for (JsonVariantConst cond : conditions) {
-        char const* time = cond["time"];
-        assert(time);
-        std::string temperature = cond["temperature"];
-        temperature += " °C";
-        std::string pressure = cond["pressure"];
-        pressure += " hPa";
-        char const* iconName = cond["iconName"];
-        assert(iconName);
-        ESP_LOGD(TAG,
-                 "time: '%s'\ttemperature: %u\tpressure: %u\ticonName: '%s'",
-                 time, temperature, pressure, iconName);
-        m_conditions.push_back(
-            Condition{time, temperature, pressure, iconName});
-    }
 
-    draw();
+    Shown before = getShown();
+    // applied by ConnectionManager as it arrived, possibly with the ones
+    // after it
+    bool isLocationChanged = readWeather();
+
+    // keep showing the same time slot, else the one which took its place
+    model::Forecast const& forecast = m_weather.getForecast();
+    int idx =
+        before.m_isEmpty ? -1 : forecast.find(before.m_condition.getTime());
+    if (idx >= 0)
+        m_idxCurCondition = idx;
+    else if (m_idxCurCondition >= forecast.size())
+        m_idxCurCondition = forecast.isEmpty() ? 0 : forecast.size() - 1;
+
+    if (isLocationChanged || getShown() != before)
+        draw();
+    else
+        ESP_LOGD(TAG, "Condition shown unchanged, not redrawn");
 }
 
 void WeatherPage::onEvent(SwipeClockwise const&) {
-    ESP_LOGD(TAG, "Clockwise is detected with %u conditions",
-             m_conditions.size());
-    if (m_idxCurCondition + 1 < m_conditions.size()) {
+    size_t numConditions = m_weather.getForecast().size();
+    ESP_LOGD(TAG, "Clockwise is detected with %u conditions", numConditions);
+    if (m_idxCurCondition + 1u < numConditions) {
         m_idxCurCondition += 1;
         ESP_LOGD(TAG, "Current index is %u", m_idxCurCondition);
         draw();
@@ -234,38 +258,60 @@ void WeatherPage::onEvent(SwipeAntiClockwise const&) {
 
 void WeatherPage::drawOnScreen() {
     ResourceMonitor::printRemainingStackSize();
+    model::Forecast const& forecast = m_weather.getForecast();
 
     // no message with conditions is arrived yet
-    if (m_conditions.empty()) {
+    if (forecast.isEmpty()) {
+        // every condition has been removed
+        if (m_iconShown != protocol::unknownIcon) {
+            m_icons[m_iconShown]->clearFromScreen();
+            m_icons[m_iconShown]->makeVisible(false);
+            m_iconShown = protocol::unknownIcon;
+            m_time->clearFromScreen();
+            m_temperature->clearFromScreen();
+            m_pressure->clearFromScreen();
+            m_leftArrow->clearFromScreen();
+            m_rightArrow->clearFromScreen();
+        }
         m_txtWhenNoData->draw();
         return;
     }
 
     m_txtWhenNoData->clearFromScreen();
-    // update based on the current condition
-    Condition condition = m_conditions[m_idxCurCondition];
-    std::string time = condition.m_time;
-    ESP_LOGD(TAG, "time: '%s'", time.c_str());
-    m_time->setContent(time);
-    ESP_LOGD(TAG, "temperature: '%s'", condition.m_temperature.c_str());
-    m_temperature->setContent(condition.m_temperature);
-    ESP_LOGD(TAG, "pressure: '%s'", condition.m_pressure.c_str());
-    m_pressure->setContent(condition.m_pressure);
-    m_mapIdToIcon[condition.m_icon]->makeVisible(true);
+    // update based on the current condition, the strings fit their inline
+    // buffer thus formatting them does not allocate
+    model::Condition const& condition = forecast[m_idxCurCondition];
+    ESP_LOGD(TAG, "time: '%s'", condition.m_time);
+    m_time->setContent(condition.m_time);
+    char text[16];
+    snprintf(text, sizeof(text), "%d °C", condition.m_temperature);
+    m_temperature->setContent(text);
+    snprintf(text, sizeof(text), "%u hPa", condition.m_pressure);
+    m_pressure->setContent(text);
+    if (m_iconShown != condition.m_icon) {
+        if (m_iconShown != protocol::unknownIcon)
+            m_icons[m_iconShown]->makeVisible(false);
+        m_iconShown = condition.m_icon;
+        m_icons[m_iconShown]->makeVisible(true);
+    }
 
     // draw the condition
     m_location->draw();
     m_time->draw();
     m_temperature->draw();
     m_pressure->draw();
-    m_mapIdToIcon[condition.m_icon]->draw();
+    m_icons[m_iconShown]->draw();
+
+    auto stats = m_time->getLayoutCacheStats();
+    ESP_LOGD(TAG, "Layouts of the time: %u unchanged, %u hits, %u misses",
+             stats.m_numUnchanged, stats.m_numHits, stats.m_numMisses);
 
-    if (m_idxCurCondition + 1 < m_conditions.size())
+    if (m_idxCurCondition + 1u < forecast.size())
         m_rightArrow->draw();
     else
         m_rightArrow->clearFromScreen();
 
-    if (m_idxCurCondition - 1 >= 0)
+    if (m_idxCurCondition > 0)
         m_leftArrow->draw();
     else
         m_leftArrow->clearFromScreen();
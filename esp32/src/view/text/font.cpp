@@ -0,0 +1,242 @@
+#include "view/text/font.h"
+
+#include <algorithm>
+#include "fonts/bitmap/NotoMono12.h"
+#include "fonts/bitmap/NotoMono18.h"
+#include "fonts/bitmap/NotoMono24.h"
+#include "view/text/line_breaker.h"
+
+namespace view {
+Font const& Font::get(FontSize size) {
+    static Font const small{fonts::NotoMono12};
+    static Font const medium{fonts::NotoMono18};
+    static Font const large{fonts::NotoMono24};
+
+    switch (size) {
+        case FontSize::SMALL:
+            return small;
+        case FontSize::LARGE:
+            return large;
+        default:
+            return medium;
+    }
+}
+
+fonts::Glyph const* Font::findGlyph(uint32_t codepoint) const {
+    auto end = m_font.m_glyphs + m_font.m_numGlyphs;
+    auto glyph = std::lower_bound(
+        m_font.m_glyphs, end, codepoint,
+        [](fonts::Glyph const& g, uint32_t c) { return g.m_codepoint < c; });
+    if (glyph == end || glyph->m_codepoint != codepoint)
+        return nullptr;
+    return glyph;
+}
+
+uint16_t Font::textWidth(char const* str) const {
+    uint16_t width = 0;
+    while (uint32_t codepoint = decodeUTF8(str)) {
+        fonts::Glyph const* glyph = findGlyph(codepoint);
+        width += glyph ? glyph->m_xAdvance : m_font.m_spaceWidth + 1;
+    }
+    return width;
+}
+
+uint16_t Font::drawText(TFT_eSPI* tft,
+                        int16_t x,
+                        int16_t y,
+                        char const* str,
+                        uint16_t fg,
+                        uint16_t bg) const {
+    uint16_t advance = 0;
+    tft->startWrite();
+    while (uint32_t codepoint = decodeUTF8(str)) {
+        advance += drawGlyph(tft, x + advance, y, codepoint, fg, bg);
+    }
+    tft->endWrite();
+    return advance;
+}
+
+uint16_t Font::drawGlyph(TFT_eSPI* tft,
+                         int16_t x,
+                         int16_t y,
+                         uint32_t codepoint,
+                         uint16_t fg,
+                         uint16_t bg) const {
+    fonts::Glyph const* glyph = findGlyph(codepoint);
+    uint16_t h = m_font.m_yAdvance;
+    if (!glyph) {
+        ESP_LOGD(TAG, "Missing glyph for U+%04X", codepoint);
+        uint16_t w = m_font.m_spaceWidth + 1;
+        tft->fillRect(x, y, w, h, bg);
+        tft->drawRect(x, y, m_font.m_spaceWidth, m_font.m_ascent, fg);
+        return w;
+    }
+
+    uint16_t w = glyph->m_xAdvance;
+    int16_t left = glyph->m_dX;
+    int16_t top = m_font.m_ascent - glyph->m_dY;
+
+    // the cell of the glyph is composed in the buffer, in the byte order
+    // expected by the display
+    auto toPixel = [&](uint8_t alpha) -> uint16_t {
+        uint16_t colour = alpha == 0    ? bg
+                          : alpha == 15 ? fg
+                                        : tft->alphaBlend(alpha * 17, fg, bg);
+        return (colour << 8) | (colour >> 8);
+    };
+
+    uint16_t numBandRows =
+        std::max<size_t>(1, numBufferPixels / std::max<uint16_t>(w, 1));
+    for (uint16_t beg = 0; w > 0 && beg < h; beg += numBandRows) {
+        uint16_t numRows = std::min<uint16_t>(numBandRows, h - beg);
+        uint16_t* pixel = buffer;
+        for (int16_t r = beg; r < beg + numRows; r++) {
+            for (int16_t c = 0; c < w; c++) {
+                *pixel++ = toPixel(getAlpha(*glyph, c - left, r - top));
+            }
+        }
+        tft->pushImage(x, y + beg, w, numRows, buffer);
+    }
+
+    // accents of capital letters and glyphs wider than their advance spill
+    // out of the cell: draw their ink only, not to erase the neighbours
+    for (int16_t gy = 0; gy < glyph->m_height; gy++) {
+        for (int16_t gx = 0; gx < glyph->m_width; gx++) {
+            int16_t r = top + gy;
+            int16_t c = left + gx;
+            if (r >= 0 && r < h && c >= 0 && c < w)
+                continue;
+            uint8_t alpha = getAlpha(*glyph, gx, gy);
+            if (alpha > 0)
+                tft->drawPixel(x + c, y + r,
+                               tft->alphaBlend(alpha * 17, fg, bg));
+        }
+    }
+    return w;
+}
+
+uint16_t Font::renderText(char const* str,
+                          uint8_t* band,
+                          uint16_t width) const {
+    uint16_t h = m_font.m_yAdvance;
+    std::fill(band, band + getBandSize(width), 0);
+    uint16_t advance = 0;
+    uint16_t inkEnd = 0;
+    // the ink of the neighbours overlapping, the darker one is kept
+    auto plot = [&](int32_t c, int32_t r, uint8_t alpha) {
+        if (alpha == 0 || c < 0 || c >= width || r < 0 || r >= h)
+            return;
+        size_t idx = r * width + c;
+        uint8_t& byte = band[idx / 2];
+        uint8_t old = idx % 2 == 0 ? byte >> 4 : byte & 0x0F;
+        if (alpha <= old)
+            return;
+        byte = idx % 2 == 0 ? (byte & 0x0F) | alpha << 4
+                            : (byte & 0xF0) | alpha;
+        inkEnd = std::max<uint16_t>(inkEnd, c + 1);
+    };
+
+    while (uint32_t codepoint = decodeUTF8(str)) {
+        if (advance >= width)
+            break;
+        fonts::Glyph const* glyph = findGlyph(codepoint);
+        if (!glyph) {
+            ESP_LOGD(TAG, "Missing glyph for U+%04X", codepoint);
+            int32_t right = advance + m_font.m_spaceWidth - 1;
+            for (int32_t c = advance; c <= right; c++) {
+                plot(c, 0, 15);
+                plot(c, m_font.m_ascent - 1, 15);
+            }
+            for (int32_t r = 0; r < m_font.m_ascent; r++) {
+                plot(advance, r, 15);
+                plot(right, r, 15);
+            }
+            advance += m_font.m_spaceWidth + 1;
+            continue;
+        }
+
+        int32_t left = advance + glyph->m_dX;
+        int32_t top = m_font.m_ascent - glyph->m_dY;
+        for (int16_t gy = 0; gy < glyph->m_height; gy++) {
+            for (int16_t gx = 0; gx < glyph->m_width; gx++)
+                plot(left + gx, top + gy, getAlpha(*glyph, gx, gy));
+        }
+        advance += glyph->m_xAdvance;
+    }
+    return std::min(std::max(advance, inkEnd), width);
+}
+
+void Font::drawBand(TFT_eSPI* tft,
+                    int16_t x,
+                    int16_t y,
+                    uint8_t const* band,
+                    uint16_t width,
+                    uint16_t numColumns,
+                    uint16_t fg,
+                    uint16_t bg) const {
+    numColumns = std::min(numColumns, width);
+    if (numColumns == 0)
+        return;
+    // colour of each alpha, in the byte order expected by the display
+    uint16_t colours[16];
+    for (uint8_t alpha = 0; alpha < 16; alpha++) {
+        uint16_t colour = alpha == 0    ? bg
+                          : alpha == 15 ? fg
+                                        : tft->alphaBlend(alpha * 17, fg, bg);
+        colours[alpha] = (colour << 8) | (colour >> 8);
+    }
+
+    // a line wider than the buffer is pushed in blocks of columns too
+    uint16_t h = m_font.m_yAdvance;
+    uint16_t blockWidth = std::min<size_t>(numColumns, numBufferPixels);
+    uint16_t numBlockRows = numBufferPixels / blockWidth;
+    tft->startWrite();
+    for (uint16_t left = 0; left < numColumns; left += blockWidth) {
+        uint16_t w = std::min<uint16_t>(blockWidth, numColumns - left);
+        for (uint16_t beg = 0; beg < h; beg += numBlockRows) {
+            uint16_t numRows = std::min<uint16_t>(numBlockRows, h - beg);
+            uint16_t* pixel = buffer;
+            for (uint16_t r = beg; r < beg + numRows; r++) {
+                for (uint16_t c = left; c < left + w; c++) {
+                    size_t idx = size_t{r} * width + c;
+                    uint8_t byte = band[idx / 2];
+                    *pixel++ = colours[idx % 2 == 0 ? byte >> 4 : byte & 0x0F];
+                }
+            }
+            tft->pushImage(x + left, y + beg, w, numRows, buffer);
+        }
+    }
+    tft->endWrite();
+}
+
+uint8_t Font::getAlpha(fonts::Glyph const& glyph,
+                       int16_t gx,
+                       int16_t gy) const {
+    if (gx < 0 || gx >= glyph.m_width || gy < 0 || gy >= glyph.m_height)
+        return 0;
+    uint32_t idx = gy * glyph.m_width + gx;
+    uint8_t byte = m_font.m_bitmaps[glyph.m_offset + idx / 2];
+    return idx % 2 == 0 ? byte >> 4 : byte & 0x0F;
+}
+
+uint32_t Font::decodeUTF8(char const*& str) {
+    unsigned char c = *str;
+    if (c == '\0')
+        return 0;
+
+    uint8_t len = LineBreaker::getUTF8SequenceLength(c);
+    if (len == 0) {
+        // not a leading byte: skip it
+        str++;
+        return 0xFFFD;
+    }
+
+    static uint8_t const leadingBitsMask[] = {0, 0x7F, 0x1F, 0x0F, 0x07};
+    uint32_t codepoint = c & leadingBitsMask[len];
+    str++;
+    for (uint8_t i = 1; i < len && (*str & 0xC0) == 0x80; i++) {
+        codepoint = (codepoint << 6) | (*str++ & 0x3F);
+    }
+    return codepoint;
+}
+}  // namespace view
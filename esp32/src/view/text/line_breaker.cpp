@@ -0,0 +1,115 @@
+#include "view/text/line_breaker.h"
+
+#include <algorithm>
+#include <cassert>
+#include "esp_log.h"
+
+namespace view {
+
+size_t LineBreaker::breakLines(std::string const& text,
+                               size_t beg,
+                               std::vector<Line>& lines,
+                               size_t maxNumLines) {
+    size_t pos = beg;
+    while (pos < text.size() && lines.size() < maxNumLines) {
+        size_t next;
+        Line line = nextLine(text, pos, next);
+        lines.push_back(line);
+        bool isHardBreak =
+            line.end() < text.size() && text[line.end()] == '\n';
+        pos = next;
+        // keep an empty line at the end, so that appending text restarts from
+        // the line after the '\n'
+        if (isHardBreak && pos == text.size() && lines.size() < maxNumLines) {
+            lines.push_back(Line{static_cast<uint32_t>(pos), 0, 0});
+        }
+    }
+
+    ESP_LOGD(TAG, "%u lines laid out, stopped at %u / %u", lines.size(), pos,
+             text.size());
+    return pos;
+}
+
+LineBreaker::Line LineBreaker::nextLine(std::string const& text,
+                                        size_t beg,
+                                        size_t& next) {
+    Line line{static_cast<uint32_t>(beg), 0, 0};
+
+    // last position where the line can be broken on a space, with the width of
+    // the line up to that position
+    size_t breakEnd = std::string::npos;
+    uint16_t breakWidth = 0;
+
+    size_t i = beg;
+    while (i < text.size()) {
+        unsigned char c = text[i];
+        if (c == '\n') {
+            line.m_len = i - beg;
+            next = i + 1;
+            return line;
+        }
+
+        size_t len = getUTF8SequenceLength(c);
+        assert(len > 0 &&
+               "the sequence must contain only valid utf-8 encoded strings");
+        len = std::min(len, text.size() - i);
+
+        // spaces used for indentation are not a valid point to break the line
+        if (c == ' ' && i > beg && text[i - 1] != ' ') {
+            breakEnd = i;
+            breakWidth = line.m_width;
+        }
+
+        uint16_t width = line.m_width + measure(text, i, len);
+        if (width > m_maxWidth) {
+            if (breakEnd != std::string::npos) {
+                line.m_len = breakEnd - beg;
+                line.m_width = breakWidth;
+                next = skipSpaces(text, breakEnd);
+            } else if (c == ' ') {
+                line.m_len = i - beg;
+                next = skipSpaces(text, i);
+            } else if (i == beg) {
+                // the glyph alone is wider than the line, keep it anyway to
+                // make progress
+                line.m_len = len;
+                line.m_width = width;
+                next = i + len;
+            } else {
+                // the token is longer than a line: break between characters
+                line.m_len = i - beg;
+                next = i;
+            }
+            return line;
+        }
+
+        line.m_width = width;
+        i += len;
+    }
+
+    line.m_len = i - beg;
+    next = i;
+    return line;
+}
+
+uint16_t LineBreaker::measure(std::string const& text, size_t i, size_t len) {
+    // the width of a line is the sum of the advances of its glyphs (see
+    // Font::textWidth), thus each glyph is measured once
+    char glyph[5];
+    text.copy(glyph, len, i);
+    glyph[len] = '\0';
+    return m_measure(glyph);
+}
+
+uint8_t LineBreaker::getUTF8SequenceLength(unsigned char firstByte) {
+    if (firstByte <= 0x7F)
+        return 1;  // ASCII
+    if ((firstByte & 0xE0) == 0xC0)
+        return 2;  // 2-byte sequence
+    if ((firstByte & 0xF0) == 0xE0)
+        return 3;  // 3-byte sequence
+    if ((firstByte & 0xF8) == 0xF0)
+        return 4;  // 4-byte sequence
+    return 0;      // Invalid
+}
+}  // namespace view
@@ -7,9 +7,13 @@ ScrollableText::ScrollableText(RectType frame,
                                View* superiorView,
                                std::string const&)
     : View::View(frame, superiorView, "ScrollableText"),
-      m_textFramesSz{0},
-      m_idxCurFrame{0},
-      m_wrapText{true},
+      m_textArea{std::make_unique<TextArea>(
+          RectType{Coordinates{0, 0}, Size{0, 0}},
+          nullptr)},
+      m_document{[](char const* str) {
+          return Font::get(FontSize::MEDIUM).textWidth(str);
+      }},
+      m_idxCurPage{0},
       m_showArrows{true},
       m_leftArrow{new Image(RectType{Coordinates{0, 0}, Size{24, 24}},
                             this,
@@ -17,11 +21,7 @@ ScrollableText::ScrollableText(RectType frame,
       m_rightArrow{new Image(RectType{Coordinates{0, 0}, Size{24, 24}},
                              this,
                              {BIN_IMG(24, 24, swipe_right)})} {
-    for (auto& pTextArea : m_textFrames) {
-        pTextArea = std::make_unique<TextArea>(
-            RectType{Coordinates{0, 0}, Size{0, 0}}, nullptr);
-        pTextArea->wrapTextVertically(false);
-    }
+    m_textArea->wrapTextVertically(false);
     placeComponents();
 }
 
@@ -51,16 +51,22 @@ void ScrollableText::placeComponents() {
              m_rightArrow->getCoordinates().m_x,
              m_rightArrow->getCoordinates().m_y);
 
-    for (auto& pTextArea : m_textFrames) {
-        pTextArea->move(Coordinates{x + horizontalSpaceForArrows, y});
-        pTextArea->resize(Size{w - 2 * horizontalSpaceForArrows, h});
-        ESP_LOGD(TAG,
-                 "Placement for the text area. Coordinates: (%d, %d); Size: "
-                 "w=%d, h=%d",
-                 pTextArea->getCoordinates().m_x,
-                 pTextArea->getCoordinates().m_y, pTextArea->getSize().m_width,
-                 pTextArea->getSize().m_height);
-    }
+    m_textArea->move(Coordinates{x + horizontalSpaceForArrows, y});
+    m_textArea->resize(
+        Size{std::max(0, w - 2 * horizontalSpaceForArrows), h});
+    ESP_LOGD(TAG,
+             "Placement for the text area. Coordinates: (%d, %d); Size: "
+             "w=%d, h=%d",
+             m_textArea->getCoordinates().m_x, m_textArea->getCoordinates().m_y,
+             m_textArea->getSize().m_width, m_textArea->getSize().m_height);
+
+    // a different geometry moves the page boundaries: keep showing the same
+    // page number if it still exists
+    m_document.setLayout(m_textArea->getSize().m_width,
+                         m_textArea->getMaxNumLines());
+    if (!m_document.hasPage(m_idxCurPage))
+        m_idxCurPage = 0;
+    materializePage(m_idxCurPage);
 }
 
 bool ScrollableText::move(Coordinates const& coordinates) {
@@ -76,90 +82,66 @@ bool ScrollableText::resize(Size const& newSize) {
 }
 
 size_t ScrollableText::setContent(std::string const& content) {
-    m_textFramesSz = 1;
-    m_idxCurFrame = 0;
-    auto const& pTextArea = m_textFrames[0];
-    size_t fstIdxExceeding = pTextArea->setContent(content);
-    ESP_LOGD(TAG,
-             "Called ScrollableText::setContent for '%s' results in '%u'chars "
-             "exceeding: the string '%s'",
-             content.c_str(), content.size() - fstIdxExceeding,
-             content.substr(fstIdxExceeding).c_str());
-    return handleExceedingText(content, fstIdxExceeding);
+    m_document.setText(content);
+    m_idxCurPage = 0;
+    materializePage(m_idxCurPage);
+    ESP_LOGD(TAG, "Called ScrollableText::setContent for '%s'",
+             content.c_str());
+    return content.size();
 }
 
 size_t ScrollableText::appendContent(std::string const& content) {
-    if (m_textFramesSz == 0) {
+    if (m_document.isEmpty())
         return setContent(content);
-    } else {
-        auto const& pTextArea = m_textFrames[m_textFramesSz - 1];
-        size_t fstIdxExceeding = pTextArea->appendContent(content);
-        ESP_LOGD(TAG,
-                 "Called ScrollableText::appendContent for '%s' results in "
-                 "'%s' exceeding chars",
-                 content.c_str(), content.substr(fstIdxExceeding).c_str());
-        return handleExceedingText(content, fstIdxExceeding);
-    }
+
+    m_document.append(content);
+    ESP_LOGD(TAG, "Called ScrollableText::appendContent for '%s'",
+             content.c_str());
+
+    // only the last page can change by appending text
+    if (m_idxCurPage + 1 >= m_document.getNumIndexedPages())
+        materializePage(m_idxCurPage);
+    return content.size();
 }
 
-size_t ScrollableText::handleExceedingText(std::string const& content,
-                                           size_t beg) {
-    std::string exceedingContent(content.substr(beg));
-    if (exceedingContent.empty())
-        return content.size();
-
-    size_t addedChars{0};
-    if (m_textFramesSz + 1 <= maxNumText) {
-        ESP_LOGD(TAG, "There are exceeding characters yet to place:  '%s'",
-                 exceedingContent.c_str());
-        auto& pTextFrame = m_textFrames[m_textFramesSz++];
-        addedChars = pTextFrame->setContent(exceedingContent);
-    } else if (m_wrapText) {
-        m_textFramesSz = 0;
-        m_idxCurFrame = 0;
-        ESP_LOGD(TAG, "No text area left for %s, wrap it",
-                 exceedingContent.c_str());
-        addedChars = m_textFrames[m_idxCurFrame]->setContent(exceedingContent);
-    } else {
-        ESP_LOGD(TAG, "No text area left for %s, truncate",
-                 exceedingContent.c_str());
-        addedChars = 0;
-    }
-    return beg + addedChars;
+void ScrollableText::materializePage(size_t idx) {
+    m_document.getPage(idx, m_page);
+    ESP_LOGD(TAG, "Showing page %u: '%s'", idx, m_page.c_str());
+    m_textArea->setContent(m_page);
 }
 
 void ScrollableText::clearFromScreen() {
-    if (m_textFramesSz == 0)
+    if (m_document.isEmpty())
         return;
-    m_textFrames[m_idxCurFrame]->clearFromScreen();
+    m_textArea->clearFromScreen();
     m_leftArrow->clearFromScreen();
     m_rightArrow->clearFromScreen();
 }
 
-void ScrollableText::wrapTextVertically(bool wrap) {
-    m_wrapText = wrap;
-}
+void ScrollableText::wrapTextVertically(bool) {}
 
 void ScrollableText::onEvent(SwipeClockwise const&) {
-    if (m_idxCurFrame + 1 < m_textFramesSz) {
-        m_textFrames[m_idxCurFrame++]->clearFromScreen();
+    if (m_document.hasPage(m_idxCurPage + 1)) {
+        // the TextArea redraws only the glyphs differing from the previous
+        // page, so there is no need to clear it first
+        materializePage(++m_idxCurPage);
         draw();
     }
 }
 
 void ScrollableText::onEvent(SwipeAntiClockwise const&) {
-    if (m_idxCurFrame - 1 >= 0) {
-        m_textFrames[m_idxCurFrame--]->clearFromScreen();
+    if (m_idxCurPage > 0) {
+        materializePage(--m_idxCurPage);
         draw();
     }
 }
 
 void ScrollableText::drawOnScreen() {
-    if (m_textFramesSz == 0)
+    if (m_document.isEmpty())
         return;
 
-    ESP_LOGD(TAG, "current frame is at index: %u / %u", m_idxCurFrame,
-             m_textFramesSz);
+    ESP_LOGD(TAG, "current page is at index: %u / %u indexed so far",
+             m_idxCurPage, m_document.getNumIndexedPages());
     ESP_LOGD(TAG, "Scrollbar coordinates: (%d,%d)", getCoordinates().m_x,
              getCoordinates().m_y);
     ESP_LOGD(TAG, "Scrollbar size: w = %u, h = %u", getSize().m_width,
@@ -169,7 +151,7 @@ void ScrollableText::drawOnScreen() {
              m_leftArrow->getCoordinates().m_x,
              m_leftArrow->getCoordinates().m_y, m_leftArrow->getSize().m_width,
              m_leftArrow->getSize().m_height);
-    if (m_idxCurFrame > 0 && m_showArrows) {
+    if (m_idxCurPage > 0 && m_showArrows) {
         m_leftArrow->makeVisible(true);
         ESP_LOGD(TAG, "Left arrow is visible");
     } else {
@@ -185,7 +167,7 @@ void ScrollableText::drawOnScreen() {
              m_rightArrow->getCoordinates().m_y,
              m_rightArrow->getSize().m_width, m_rightArrow->getSize().m_height);
 
-    if (m_idxCurFrame + 1 < m_textFramesSz && m_showArrows) {
+    if (m_showArrows && m_document.hasPage(m_idxCurPage + 1)) {
         m_rightArrow->makeVisible(true);
         ESP_LOGD(TAG, "Right arrow is visible");
     } else {
@@ -196,12 +178,11 @@ void ScrollableText::drawOnScreen() {
 
     m_rightArrow->draw();
 
-    auto const& pTextArea = m_textFrames[m_idxCurFrame];
     ESP_LOGD(TAG,
              "Text area coordinates: (%d, %d), text area size: w = %u, h = %u",
-             pTextArea->getCoordinates().m_x, pTextArea->getCoordinates().m_y,
-             pTextArea->getSize().m_width, pTextArea->getSize().m_height);
-    pTextArea->draw();
+             m_textArea->getCoordinates().m_x, m_textArea->getCoordinates().m_y,
+             m_textArea->getSize().m_width, m_textArea->getSize().m_height);
+    m_textArea->draw();
 }
 
 void ScrollableText::showArrows(bool showArrows) {
@@ -0,0 +1,315 @@
+#include "view/text/teleprompter.h"
+
+#include <algorithm>
+
+namespace view {
+Teleprompter::Teleprompter(RectType frame, View* superiorView)
+    : View::View(frame, superiorView, "Teleprompter"),
+      m_tft{tft::Tft::getTFT_eSPI()},
+      m_font{Font::get(FontSize::MEDIUM)},
+      m_fgColour{TFT_LIGHTGREY},
+      m_bgColour{TFT_BLACK},
+      m_lineBreaker{[this](char const* str) {
+          return m_font.textWidth(str);
+      }},
+      m_isFrameMoved{false},
+      m_stripSize{0},
+      m_idxTopSlot{0},
+      m_numUsedRows{0},
+      m_hasHardwareScroll{false},
+      m_isScrollPending{false},
+      m_numUtteranceRows{0},
+      m_numRowsDrawn{0},
+      m_numRowsRendered{0},
+      m_numPixelBytesPushed{0} {
+    placeRows();
+}
+
+Teleprompter::~Teleprompter() {
+    if (m_hasHardwareScroll)
+        resetScroll();
+}
+
+void Teleprompter::placeRows() {
+    auto [x, y] = getCoordinates();
+    auto [w, h] = getSize();
+    m_charHeight = m_font.getHeight();
+    size_t numRows = m_charHeight > 0 ? h / m_charHeight : 0;
+
+    m_lineBreaker.setMaxWidth(w);
+    m_rows.resize(numRows);
+    for (auto& row : m_rows)
+        row.clear();
+    m_isRowDirty.assign(numRows, true);
+    // whatever the frame shows before the first draw
+    m_drawnWidths.assign(numRows, w);
+    m_rowOffsets.assign(numRows, 0);
+    m_idxTopSlot = 0;
+    m_numUsedRows = 0;
+    m_isScrollPending = false;
+    m_isFrameMoved = false;
+    m_utterance.clear();
+    m_numUtteranceRows = 0;
+
+    if (m_hasHardwareScroll)
+        resetScroll();
+
+    // in any rotation but the native one the controller scrolls either along
+    // the x axis of the screen or upside down
+    uint16_t scrollAreaHeight = numRows * m_charHeight;
+    m_hasHardwareScroll = numRows > 0 && m_tft->getRotation() == 0 && y >= 0 &&
+                          y + scrollAreaHeight <= numMemoryLines;
+
+    ESP_LOGD(TAG, "%u rows of %u pixels, hardware scroll: %d", numRows,
+             m_charHeight, m_hasHardwareScroll);
+
+    m_stripSize = m_hasHardwareScroll ? 0 : m_font.getBandSize(w);
+    m_strips.assign(numRows * m_stripSize, 0);
+    m_strips.shrink_to_fit();
+    m_stripWidths.assign(numRows, 0);
+
+    if (m_hasHardwareScroll) {
+        uint16_t bottomAreaHeight = numMemoryLines - y - scrollAreaHeight;
+        m_tft->writecommand(VSCRDEF);
+        writeData16(y);
+        writeData16(scrollAreaHeight);
+        writeData16(bottomAreaHeight);
+        setScrollStart(y);
+    }
+}
+
+bool Teleprompter::move(Coordinates const& coordinates) {
+    View::move(coordinates);
+    placeRows();
+    return true;
+}
+
+bool Teleprompter::resize(Size const& newSize) {
+    View::resize(newSize);
+    placeRows();
+    return true;
+}
+
+size_t Teleprompter::setContent(std::string const& content) {
+    size_t numCommonBytes = 0;
+    size_t maxNumCommonBytes = std::min(content.size(), m_utterance.size());
+    while (numCommonBytes < maxNumCommonBytes &&
+           content[numCommonBytes] == m_utterance[numCommonBytes])
+        numCommonBytes++;
+
+    if (numCommonBytes == 0)
+        startUtterance();
+    replaceTail(numCommonBytes, content.data() + numCommonBytes,
+                content.size() - numCommonBytes);
+    return content.size();
+}
+
+size_t Teleprompter::appendContent(std::string const& content) {
+    replaceTail(m_utterance.size(), content.data(), content.size());
+    return content.size();
+}
+
+void Teleprompter::startUtterance() {
+    if (m_rows.empty())
+        return;
+    if (m_numUsedRows == 0 || !m_rows[getLastSlot()].empty())
+        newRow();
+    m_utterance.clear();
+    m_numUtteranceRows = 1;
+    m_rowOffsets[getLastSlot()] = 0;
+}
+
+size_t Teleprompter::editTail(size_t numStableBytes, std::string const& tail) {
+    return replaceTail(numStableBytes, tail.data(), tail.size());
+}
+
+size_t Teleprompter::replaceTail(size_t numStableBytes,
+                                 char const* data,
+                                 size_t size) {
+    if (m_rows.empty() || m_lineBreaker.getMaxWidth() == 0)
+        return 0;
+    if (m_numUtteranceRows == 0)
+        startUtterance();
+
+    // never cut an UTF-8 sequence in half
+    numStableBytes = std::min(numStableBytes, m_utterance.size());
+    while (numStableBytes > 0 && numStableBytes < m_utterance.size() &&
+           (m_utterance[numStableBytes] & 0xC0) == 0x80)
+        numStableBytes--;
+
+    // last row holding a stable byte, the rows before it cannot change
+    size_t idxFstRow = m_numUsedRows - m_numUtteranceRows;
+    size_t idxRow = idxFstRow;
+    for (size_t i = m_numUsedRows; i-- > idxFstRow;) {
+        if (m_rowOffsets[getSlotOfRow(i)] <= numStableBytes) {
+            idxRow = i;
+            break;
+        }
+    }
+    // the first word of a line may now fit the line above it
+    if (idxRow > idxFstRow)
+        idxRow--;
+
+    size_t beg = m_rowOffsets[getSlotOfRow(idxRow)];
+    if (beg > numStableBytes) {
+        // the lines holding the edit cannot be drawn again: the new text
+        // takes the place of the oldest line still in the frame
+        ESP_LOGD(TAG, "The edit begins in a line scrolled out of the frame");
+        beg = numStableBytes;
+    }
+
+    ESP_LOGD(TAG, "Utterance edited from byte %u, laid out from row %u / %u",
+             numStableBytes, idxRow, m_numUsedRows);
+    m_utterance.resize(numStableBytes);
+    m_utterance.append(data, size);
+    layOutUtterance(idxRow, beg);
+    return numStableBytes;
+}
+
+void Teleprompter::layOutUtterance(size_t idxRow, size_t beg) {
+    size_t pos = beg;
+    while (true) {
+        size_t slot = getSlotOfRow(idxRow);
+        m_rowOffsets[slot] = pos;
+
+        size_t next;
+        LineBreaker::Line line =
+            m_lineBreaker.nextLine(m_utterance, pos, next);
+        bool isHardBreak =
+            line.end() < m_utterance.size() && m_utterance[line.end()] == '\n';
+        if (next >= m_utterance.size() && !isHardBreak) {
+            // keep the trailing spaces, the next text continues this line
+            setRow(slot, m_utterance.data() + pos, m_utterance.size() - pos);
+            break;
+        }
+
+        setRow(slot, m_utterance.data() + line.m_beg, line.m_len);
+        if (idxRow + 1 < m_numUsedRows) {
+            idxRow++;
+        } else {
+            newRow();
+            idxRow = m_numUsedRows - 1;
+        }
+        pos = next;
+    }
+
+    // the utterance got shorter: blank the rows it does not use anymore
+    while (m_numUsedRows > idxRow + 1) {
+        size_t slot = getLastSlot();
+        m_rows[slot].clear();
+        m_isRowDirty[slot] = true;
+        m_numUsedRows--;
+        m_numUtteranceRows--;
+    }
+}
+
+void Teleprompter::setRow(size_t slot, char const* data, size_t size) {
+    if (m_rows[slot].compare(0, std::string::npos, data, size) == 0)
+        return;
+    m_rows[slot].assign(data, size);
+    m_isRowDirty[slot] = true;
+}
+
+void Teleprompter::newRow() {
+    if (m_numUsedRows < m_rows.size()) {
+        m_numUsedRows++;
+    } else {
+        // the slot of the line scrolled out of the frame hosts the new line
+        m_idxTopSlot = (m_idxTopSlot + 1) % m_rows.size();
+        m_isScrollPending = true;
+        if (!m_hasHardwareScroll)
+            m_isFrameMoved = true;
+    }
+
+    m_numUtteranceRows = std::min(m_numUtteranceRows + 1, m_rows.size());
+
+    size_t slot = getLastSlot();
+    m_rows[slot].clear();
+    m_isRowDirty[slot] = true;
+}
+
+void Teleprompter::wrapTextVertically(bool) {}
+
+void Teleprompter::clearFromScreen() {
+    View::clearFromScreen();
+    m_isFrameMoved = true;
+    m_drawnWidths.assign(m_rows.size(), 0);
+}
+
+void Teleprompter::drawOnScreen() {
+    auto [x, y] = getCoordinates();
+    uint16_t w = getSize().m_width;
+
+    if (m_isScrollPending && m_hasHardwareScroll)
+        setScrollStart(y + m_idxTopSlot * m_charHeight);
+    m_isScrollPending = false;
+
+    size_t numRowsDrawn = 0;
+    size_t numRowsRendered = 0;
+    uint32_t numPixelBytes = 0;
+    for (size_t i = 0; i < m_rows.size(); i++) {
+        size_t slot = getSlotOfRow(i);
+        if (!m_isRowDirty[slot] && !m_isFrameMoved)
+            continue;
+
+        // with the hardware scroll a slot never moves in the controller memory,
+        // otherwise the row is drawn where it is shown
+        size_t line = m_hasHardwareScroll ? slot : i;
+        int16_t rowY = y + line * m_charHeight;
+        uint16_t drawnWidth = std::min(m_drawnWidths[line], w);
+        uint16_t textWidth;
+        if (m_stripSize == 0) {
+            textWidth = m_font.drawText(m_tft, x, rowY, m_rows[slot].c_str(),
+                                        m_fgColour, m_bgColour);
+            if (textWidth < drawnWidth)
+                m_tft->fillRect(x + textWidth, rowY, drawnWidth - textWidth,
+                                m_charHeight, m_bgColour);
+            numRowsRendered++;
+        } else {
+            // the strip is blank past the text, clearing the old one
+            uint8_t* strip = m_strips.data() + slot * m_stripSize;
+            if (m_isRowDirty[slot]) {
+                m_stripWidths[slot] =
+                    m_font.renderText(m_rows[slot].c_str(), strip, w);
+                numRowsRendered++;
+            }
+            textWidth = m_stripWidths[slot];
+            m_font.drawBand(m_tft, x, rowY, strip, w,
+                            std::max(textWidth, drawnWidth), m_fgColour,
+                            m_bgColour);
+        }
+        m_drawnWidths[line] = textWidth;
+        m_isRowDirty[slot] = false;
+        numRowsDrawn++;
+        // 16 bits per pixel, commands and addresses excluded
+        numPixelBytes +=
+            std::max(textWidth, drawnWidth) * uint32_t{m_charHeight} * 2;
+    }
+
+    m_isFrameMoved = false;
+    m_numRowsDrawn += numRowsDrawn;
+    m_numRowsRendered += numRowsRendered;
+    m_numPixelBytesPushed += numPixelBytes;
+    ESP_LOGD(TAG,
+             "%u / %u rows drawn, %u rendered: %u bytes of pixels pushed",
+             numRowsDrawn, m_rows.size(), numRowsRendered, numPixelBytes);
+}
+
+void Teleprompter::setScrollStart(uint16_t line) {
+    m_tft->writecommand(VSCRSADD);
+    writeData16(line);
+}
+
+void Teleprompter::resetScroll() {
+    m_tft->writecommand(VSCRDEF);
+    writeData16(0);
+    writeData16(numMemoryLines);
+    writeData16(0);
+    setScrollStart(0);
+}
+
+void Teleprompter::writeData16(uint16_t data) {
+    m_tft->writedata(data >> 8);
+    m_tft->writedata(data & 0xFF);
+}
+}  // namespace view
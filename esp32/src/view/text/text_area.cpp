@@ -1,6 +1,7 @@
 #include "view/text/text_area.h"
 
-#include "fonts/NotoMono18pt.h"
+#include <algorithm>
+#include "utility/hash.h"
 #include "utility/resource_monitor.h"
 #include "view/screen/screen.h"
 
@@ -9,41 +10,30 @@ TextArea::TextArea(RectType frame,
                    View* superiorView,
                    std::string const& content)
     : View::View(frame, superiorView, "Text"),
-      m_font{2},
+      m_font{&Font::get(FontSize::MEDIUM)},
       m_tft{tft::Tft::getTFT_eSPI()},
       m_fgColour{TFT_LIGHTGREY},
       m_bgColour{TFT_BLACK},
-      m_cursorCoordinatesAfterAddingTheLastCharacter{
-          Coordinates{getCoordinates()}},
       m_cursorCoordinatesFirstCharacterPrinted{getCoordinates()},
+      m_lineBreaker{[this](char const* str) {
+          return m_font->textWidth(str);
+      }},
+      m_idxFstGlyphLastLine{0},
       m_wrap{true},
-      m_center{false} {
+      m_center{false},
+      m_hasContentKey{false},
+      m_layoutCacheCapacity{0},
+      m_layoutCacheClock{0},
+      m_isFrameDrawn{false},
+      m_numClearsAtDraw{0} {
     auto frameSz = getSize();
     m_tft->setTextDatum(TL_DATUM);
     m_tft->setTextColor(m_fgColour, m_bgColour);
 
-#if UNICODE
-    ESP_LOGD(TAG, "State of the memory before loading the font:");
-    ResourceMonitor::printRemainingHeapSizeInfo();
-    if (!isFontAlreadyLoaded)
-        m_tft->loadFont(NotoMono_18pt);
-    isFontAlreadyLoaded = true;
-#else
-    m_tft->setTextFont(2);
-    m_tft->setTextSize(1);
-#endif
-
-    m_tft->setTextWrap(false, false);
-
-#if UNICODE
-    ESP_LOGD(TAG, "State of the memory after loading the font:");
-    ResourceMonitor::printRemainingHeapSizeInfo();
-
     ESP_LOGD(TAG, "State of the memory before reserving space in advance");
     ResourceMonitor::printRemainingHeapSizeInfo();
-#endif
 
-    m_charHeight = m_tft->fontHeight();
+    m_charHeight = m_font->getHeight();
     ESP_LOGD(TAG, "char height: %u", m_charHeight);
 
     auto numCharsWorstCase = getNumCharsWorstCase();
@@ -54,7 +44,7 @@ TextArea::TextArea(RectType frame,
     m_currentFrame.allocate(numCharsWorstCase);
     m_oldFrame.allocate(numCharsWorstCase);
 
-    prepareLineBuffer();
+    prepareLineIndex();
 
     setContent(content);
 
@@ -64,13 +54,61 @@ TextArea::TextArea(RectType frame,
 TextArea::~TextArea() {}
 
 size_t TextArea::setContent(std::string const& content) {
-    m_cursorCoordinatesAfterAddingTheLastCharacter = getCoordinates();
+    ContentKey key{fnv1a(content.data(), content.size()), content.size(), 0};
+    // the hash tells most contents apart, the bytes the ones colliding
+    auto isSame = [&](ContentKey const& other, std::string const& bytes) {
+        return other.m_hash == key.m_hash && other.m_size == key.m_size &&
+               bytes == content;
+    };
+    if (m_hasContentKey && isSame(m_contentKey, m_content)) {
+        m_layoutCacheStats.m_numUnchanged++;
+        return m_contentKey.m_numBytesAccepted;
+    }
 
-    m_currentFrame.reset();
+    auto cached = std::find_if(
+        m_layoutCache.begin(), m_layoutCache.end(), [&](Layout const& layout) {
+            return isSame(layout.m_key, layout.m_content);
+        });
+    if (cached != m_layoutCache.end()) {
+        ESP_LOGD(TAG, "Layout of '%s' found in the cache", content.c_str());
+        m_layoutCacheStats.m_numHits++;
+        cached->m_lastUse = ++m_layoutCacheClock;
+        m_text = cached->m_text;
+        m_lines = cached->m_lines;
+        updateFrame(0);
+        m_hasContentKey = true;
+        m_contentKey = cached->m_key;
+        m_content = content;
+        return m_contentKey.m_numBytesAccepted;
+    }
 
-    m_curLine[0] = '\0';
+    m_layoutCacheStats.m_numMisses++;
+    m_text.clear();
+    m_lines.clear();
+    m_currentFrame.reset();
+    m_idxFstGlyphLastLine = 0;
 
     size_t charactersWritten = appendContent(content);
+
+    key.m_numBytesAccepted = charactersWritten;
+    m_hasContentKey = true;
+    m_contentKey = key;
+    m_content = content;
+    if (m_layoutCacheCapacity > 0) {
+        // reuse the storage of the least recently used layout when full
+        if (m_layoutCache.size() < m_layoutCacheCapacity)
+            m_layoutCache.emplace_back();
+        auto lru = std::min_element(
+            m_layoutCache.begin(), m_layoutCache.end(),
+            [](Layout const& a, Layout const& b) {
+                return a.m_lastUse < b.m_lastUse;
+            });
+        lru->m_key = key;
+        lru->m_content = content;
+        lru->m_text = m_text;
+        lru->m_lines = m_lines;
+        lru->m_lastUse = ++m_layoutCacheClock;
+    }
     return charactersWritten;
 }
 
@@ -78,23 +116,12 @@ size_t TextArea::appendContent(std::string const& content) {
     if (content.empty())
         return 0;
 
-    auto frameSz = getSize();
-    auto frameCoordinates = getCoordinates();
-    if (!m_wrap && m_cursorCoordinatesAfterAddingTheLastCharacter.m_y >=
-                       frameCoordinates.m_y + frameSz.m_height) {
-        ESP_LOGD(TAG,
-                 "Text already full, no space for '%s'. The cursorY is at %u, "
-                 "but the maximum y is %u",
-                 content.c_str(),
-                 m_cursorCoordinatesAfterAddingTheLastCharacter.m_y,
-                 frameCoordinates.m_y + frameSz.m_height);
-        return 0;
-    }
-
-    ESP_LOGD(TAG, "Appending content '%s'\n", content.c_str());
+    // the text no longer matches the content last set
+    m_hasContentKey = false;
 
-    auto numBytesWorstCaseForALine = getNumBytesForALineWorstCase();
-    if (numBytesWorstCaseForALine == 0) {
+    auto frameSz = getSize();
+    size_t maxNumLines = getNumRowsWorstCase();
+    if (maxNumLines == 0 || m_lineBreaker.getMaxWidth() == 0) {
         ESP_LOGD(TAG,
                  "The frame is too small: width = %d, height = %d. No text can "
                  "be inserted",
@@ -102,90 +129,98 @@ size_t TextArea::appendContent(std::string const& content) {
         return 0;
     }
 
-    // use a line because counting each character individually may result in
-    // error as the computation would not take into account space adjustements
-    char line[numBytesWorstCaseForALine * 4 + 1];
-
-    // when appending text, the previous line needs to be restored
-    restoreLine(line);
-
-    auto cursorCoordinates = m_cursorCoordinatesAfterAddingTheLastCharacter;
-    byte inc = 0;
-    for (uint32_t i = 0; i < content.size(); i += inc) {
-        std::string glyph = getUTF8Sequence(content, i);
-        assert(glyph.size() > 0 &&
-               "the sequence must contain only valid utf-8 encoded strings");
-
-        inc = glyph.size();
-
-        if (overflowOnX(glyph, line)) {
-            ESP_LOGD(TAG,
-                     "Overflowing along the x axis for the glyph '%s' and the "
-                     "cursor's coordinates: "
-                     "(%d,%d)",
-                     glyph.c_str(), cursorCoordinates.m_x,
-                     cursorCoordinates.m_y);
-
-            if (glyph == " " || glyph == "\n")
-                continue;
+    ESP_LOGD(TAG, "Appending content '%s'\n", content.c_str());
 
-            // to know when drawing the string to break the line
-            m_currentFrame.addGlyph("\n");
+    size_t oldTextSz = m_text.size();
+    m_text += content;
+
+    // the lines before the last one cannot change by appending text, thus the
+    // layout restarts from the last line
+    size_t idxFstLine = m_lines.empty() ? 0 : m_lines.size() - 1;
+    size_t beg = m_lines.empty() ? 0 : m_lines.back().m_beg;
+    if (m_lines.size() > maxNumLines) {
+        // the frame has been shrunk since the last layout
+        idxFstLine = 0;
+        beg = 0;
+    }
+    m_lines.resize(idxFstLine);
+    size_t end = m_lineBreaker.breakLines(m_text, beg, m_lines, maxNumLines);
 
-            cursorCoordinates.m_x = frameCoordinates.m_x;
-            cursorCoordinates.m_y += m_tft->fontHeight();
-            line[0] = '\0';
+    size_t charactersWritten = content.size();
+    if (end < m_text.size() && m_wrap) {
+        ESP_LOGD(TAG,
+                 "Wrapping the text: the %u bytes exceeding restart from the "
+                 "top of the frame",
+                 m_text.size() - end);
+        // every iteration lays out at least one glyph, so it always ends
+        while (end < m_text.size()) {
+            m_text.erase(0, end);
+            m_lines.clear();
+            end = m_lineBreaker.breakLines(m_text, 0, m_lines, maxNumLines);
         }
-
-        if (overFlowOnY(glyph, cursorCoordinates)) {
-            if (glyph == " " || glyph == "\n")
-                continue;
-            ESP_LOGD(TAG,
-                     "Overflowing along the y axis for the cursor at (%d,%d)",
-                     cursorCoordinates.m_x, cursorCoordinates.m_y);
-            if (m_wrap) {
-                ESP_LOGD(TAG,
-                         "Wrapping the text: cursor back at the initial "
-                         "coordinates");
-                cursorCoordinates = getCoordinates();
-                m_currentFrame.reset();
-            } else {
-                ESP_LOGD(TAG, "Not wrapping text: truncate it");
-                return i;
-            }
+        idxFstLine = 0;
+    } else if (end < m_text.size()) {
+        ESP_LOGD(TAG, "Not wrapping text: truncate it at %u", end);
+        if (end < oldTextSz) {
+            // the last word already printed would be moved to a line that
+            // does not exist: keep the previous layout instead
+            end = oldTextSz;
+            m_text.resize(end);
+            m_lines.resize(idxFstLine);
+            m_lineBreaker.breakLines(m_text, beg, m_lines, maxNumLines);
+        } else {
+            m_text.resize(end);
         }
+        charactersWritten = end - oldTextSz;
+    }
+
+    updateFrame(idxFstLine);
+    return charactersWritten;
+}
 
-        // if it is not an indentation, skip it
-        if (glyph == " " && beginningOfTheLine(cursorCoordinates) &&
-            cursorCoordinates.m_y != getCoordinates().m_y)
-            continue;
+void TextArea::updateFrame(size_t idxFstLine) {
+    m_isFrameDrawn = false;
+    if (idxFstLine == 0) {
+        m_currentFrame.reset();
+        m_idxFstGlyphLastLine = 0;
+    } else {
+        // keep the '\n' closing the previous line
+        m_currentFrame.eraseFrom(m_idxFstGlyphLastLine);
+    }
 
-        m_currentFrame.addGlyph(glyph.c_str());
+    char glyph[5];
+    for (size_t l = idxFstLine; l < m_lines.size(); l++) {
+        // to know when drawing the string to break the line
+        if (l > idxFstLine)
+            m_currentFrame.addGlyph("\n");
 
-        if (glyph == "\n") {
-            cursorCoordinates = Coordinates{
-                frameCoordinates.m_x, cursorCoordinates.m_y + m_charHeight};
-            line[0] = '\0';
-        } else {
-            ESP_LOGD(TAG, "'%s' of width %u would be printed at (%u,%u)",
-                     glyph.c_str(), m_tft->textWidth(glyph.c_str()),
-                     cursorCoordinates.m_x, cursorCoordinates.m_y);
-            strcat(line, glyph.c_str());
-            cursorCoordinates.m_x =
-                frameCoordinates.m_x + m_tft->textWidth(line);
+        m_idxFstGlyphLastLine = m_currentFrame.size();
+
+        auto const& line = m_lines[l];
+        byte inc = 0;
+        for (uint32_t i = line.m_beg; i < line.end(); i += inc) {
+            inc = getUTF8SequenceLength(m_text[i]);
+            assert(inc > 0 && inc < sizeof(glyph) &&
+                   "the sequence must contain only valid utf-8 encoded "
+                   "strings");
+            memcpy(glyph, m_text.data() + i, inc);
+            glyph[inc] = '\0';
+            m_currentFrame.addGlyph(glyph);
         }
     }
-
-    m_cursorCoordinatesAfterAddingTheLastCharacter = cursorCoordinates;
-    strcpy(m_curLine.get(), line);
-    return content.size();
 }
 
 void TextArea::drawOnScreen() {
+    if (m_isFrameDrawn &&
+        m_cursorCoordinatesFirstCharacterPrinted ==
+            (m_center ? center() : getCoordinates()) &&
+        !isClearedSince(getFrame(), m_numClearsAtDraw)) {
+        ESP_LOGD(TAG, "The text drawn is unchanged");
+        return;
+    }
+
     ESP_LOGD(TAG, "Is centered? %d", m_center);
-    ESP_LOGD(TAG, "Cursor last char at (%d, %d)",
-             m_cursorCoordinatesAfterAddingTheLastCharacter.m_x,
-             m_cursorCoordinatesAfterAddingTheLastCharacter.m_y);
+    ESP_LOGD(TAG, "Number of lines: %u", m_lines.size());
     ESP_LOGD(TAG, "Last cursor used for printing at (%d, %d)",
              m_cursorCoordinatesFirstCharacterPrinted.m_x,
              m_cursorCoordinatesFirstCharacterPrinted.m_y);
@@ -249,6 +284,8 @@ void TextArea::drawOnScreen() {
         hide(m_oldFrame, curFrameSz);
 
     m_cursorCoordinatesFirstCharacterPrinted = cursorCoordinates;
+    m_isFrameDrawn = true;
+    m_numClearsAtDraw = getNumClears();
 }
 
 void TextArea::hideGlyph(char const* glyph) {
@@ -258,8 +295,18 @@ void TextArea::hideGlyph(char const* glyph) {
 }
 
 void TextArea::printGlyph(char const* glyph, uint16_t fg, uint16_t bg) {
-    m_tft->setTextColor(fg, bg);
-    m_tft->print(glyph);
+    int16_t x = m_tft->getCursorX();
+    int16_t y = m_tft->getCursorY();
+    if (strcmp(glyph, "\n") == 0) {
+        // like printing a new line with TFT_eSPI, the cursor moves to the
+        // first column of the screen
+        m_tft->setCursor(0, y + m_charHeight);
+        return;
+    }
+
+    uint16_t advance =
+        m_font->drawGlyph(m_tft, x, y, Font::decodeUTF8(glyph), fg, bg);
+    m_tft->setCursor(x + advance, y);
 }
 
 void TextArea::hide(Frame const& textFrame, uint32_t beg) {
@@ -276,19 +323,15 @@ void TextArea::hide(Frame const& textFrame, uint32_t beg) {
 }
 
 std::pair<int16_t, int16_t> TextArea::sizeContent() {
-    auto frameCoordinates = getCoordinates();
-    auto frameSz = getSize();
-    int16_t textWidth =
-        m_cursorCoordinatesAfterAddingTheLastCharacter.m_y >
-                frameCoordinates.m_y
-            ? frameSz.m_width
-            : m_cursorCoordinatesAfterAddingTheLastCharacter.m_x -
-                  frameCoordinates.m_x;
+    // the line index already knows the width of each line
+    int16_t textWidth = 0;
+    for (auto const& line : m_lines) {
+        textWidth = std::max<int16_t>(textWidth, line.m_width);
+    }
 
     ESP_LOGD(TAG, "Text width: %d", textWidth);
 
-    int16_t textHeight = m_cursorCoordinatesAfterAddingTheLastCharacter.m_y +
-                         m_charHeight - frameCoordinates.m_y;
+    int16_t textHeight = m_lines.size() * m_charHeight;
 
     ESP_LOGD(TAG, "Text height: %d", textHeight);
 
@@ -303,15 +346,7 @@ std::string TextArea::getUTF8Sequence(std::string const& str, size_t idx) {
 }
 
 byte TextArea::getUTF8SequenceLength(unsigned char firstByte) {
-    if (firstByte <= 0x7F)
-        return 1;  // ASCII
-    if ((firstByte & 0xE0) == 0xC0)
-        return 2;  // 2-byte sequence
-    if ((firstByte & 0xF0) == 0xE0)
-        return 3;  // 3-byte sequence
-    if ((firstByte & 0xF8) == 0xF0)
-        return 4;  // 4-byte sequence
-    return 0;      // Invalid
+    return LineBreaker::getUTF8SequenceLength(firstByte);
 }
 
 void TextArea::setCenter(bool center, RectType const& reference) {
@@ -330,11 +365,49 @@ void TextArea::setCenter(bool center, RectType const& reference) {
            "The reference must be bigger than this text area");
 
     m_reference = reference;
+    m_isFrameDrawn = false;
+}
+
+void TextArea::setFont(FontSize size) {
+    Font const* font = &Font::get(size);
+    if (font == m_font)
+        return;
+
+    clearFromScreen();
+    m_font = font;
+    m_charHeight = m_font->getHeight();
+    auto numCharsWorstCase = getNumCharsWorstCase();
+    m_currentFrame.allocate(numCharsWorstCase);
+    m_oldFrame.allocate(numCharsWorstCase);
+    prepareLineIndex();
+
+    // the same text takes a different number of lines
+    std::string text = m_text;
+    setContent(text);
+}
+
+void TextArea::setLayoutCacheCapacity(size_t capacity) {
+    m_layoutCacheCapacity = capacity;
+    if (m_layoutCache.size() > capacity)
+        m_layoutCache.clear();
+    m_layoutCache.reserve(capacity);
+}
+
+void TextArea::wrapTextVertically(bool wrap) {
+    if (wrap != m_wrap)
+        invalidateLayouts();
+    m_wrap = wrap;
+}
+
+void TextArea::invalidateLayouts() {
+    m_hasContentKey = false;
+    m_layoutCache.clear();
 }
 
 bool TextArea::resize(Size const& newSize) {
     View::resize(newSize);
-    prepareLineBuffer();
+    prepareLineIndex();
+    m_isFrameDrawn = false;
     return true;
 }
 
@@ -358,16 +431,20 @@ void TextArea::clearFromScreen() {
     m_tft->setCursor(m_cursorCoordinatesFirstCharacterPrinted.m_x,
                      m_cursorCoordinatesFirstCharacterPrinted.m_y);
 
+    m_isFrameDrawn = false;
+    if (m_oldFrame.size() == 0)
+        return;
+
     // before: hide(m_currentFrame, 0);
     hide(m_oldFrame, 0);
+    // text areas may overlap, those drawn over this one must be drawn again
+    recordClear(getFrame());
 }
 
 Coordinates TextArea::center() {
-    auto cursor = m_cursorCoordinatesAfterAddingTheLastCharacter;
     auto [x, y] = m_reference.m_coordinates;
     auto [w, h] = m_reference.m_size;
-    ESP_LOGD(TAG, "info: pos=(%u, %u), w = %u, h = %u, cursor=(%d,%d)", x, y, w,
-             h, cursor.m_x, cursor.m_y);
+    ESP_LOGD(TAG, "info: pos=(%u, %u), w = %u, h = %u", x, y, w, h);
 
     auto [textWidth, textHeight] = sizeContent();
 
@@ -380,23 +457,19 @@ Coordinates TextArea::center() {
     return centeredCoordinates;
 }
 
-void TextArea::restoreLine(char* line) {
-    line[0] = '\0';
-    ESP_LOGD(TAG, "Current line: '%s'", m_curLine.get());
-    strcpy(line, m_curLine.get());
-}
-
 // reserve space before hand to avoid dynamic reallocations as new
-// characters are added to the text
-// reserve space for new lines to know when break the line as the frame's
-// borders may not correspond to the screen one.
+// characters are added to the text.
 // NOTE. This function depends on the current frame's size and thus needs to be
 // called every time the text area is resized
-void TextArea::prepareLineBuffer() {
+void TextArea::prepareLineIndex() {
     auto numCharsWorstCase = getNumCharsWorstCase();
     ESP_LOGD(TAG, "Pre allocating %u characters", numCharsWorstCase);
 
-    m_curLine = std::make_unique<char[]>(getNumBytesForALineWorstCase() + 1);
-    m_curLine[0] = '\0';
+    m_lineBreaker.setMaxWidth(getSize().m_width);
+    // the layouts kept were made for the previous width or font
+    invalidateLayouts();
+    // 4 because an unicode character can be encoded in at most 4 bytes
+    m_text.reserve(numCharsWorstCase * 4);
+    m_lines.reserve(getNumRowsWorstCase());
 }
 }  // namespace view
@@ -0,0 +1,70 @@
+#include "view/text/text_document.h"
+
+#include "esp_log.h"
+
+namespace view {
+
+void TextDocument::setText(std::string const& text) {
+    m_text = text;
+    resetIndex();
+}
+
+void TextDocument::append(std::string const& text) {
+    m_text += text;
+    // every indexed page ends before the old end of the text, only the last
+    // one may grow
+    m_isIndexComplete = false;
+}
+
+void TextDocument::setLayout(uint16_t lineWidth, size_t numLinesPerPage) {
+    if (lineWidth == m_lineBreaker.getMaxWidth() &&
+        numLinesPerPage == m_numLinesPerPage)
+        return;
+
+    ESP_LOGD(TAG, "New page layout: width = %u, lines per page = %u",
+             lineWidth, numLinesPerPage);
+    m_lineBreaker.setMaxWidth(lineWidth);
+    m_numLinesPerPage = numLinesPerPage;
+    m_lines.reserve(numLinesPerPage);
+    resetIndex();
+}
+
+bool TextDocument::hasPage(size_t idx) {
+    while (m_pages.size() <= idx && indexNextPage())
+        ;
+    return idx < m_pages.size();
+}
+
+void TextDocument::getPage(size_t idx, std::string& out) {
+    if (!hasPage(idx)) {
+        ESP_LOGE(TAG, "Page %u requested out of %u", idx, m_pages.size());
+        out.clear();
+        return;
+    }
+    size_t beg = m_pages[idx];
+    // the last indexed page goes up to the end of the text only if there is
+    // no page after it
+    size_t end = hasPage(idx + 1) ? m_pages[idx + 1] : m_text.size();
+    out.assign(m_text, beg, end - beg);
+}
+
+bool TextDocument::indexNextPage() {
+    if (m_isIndexComplete || m_numLinesPerPage == 0 ||
+        m_lineBreaker.getMaxWidth() == 0)
+        return false;
+
+    size_t beg = m_pages.back();
+    m_lines.clear();
+    size_t end =
+        m_lineBreaker.breakLines(m_text, beg, m_lines, m_numLinesPerPage);
+
+    if (end >= m_text.size()) {
+        m_isIndexComplete = true;
+        return false;
+    }
+
+    ESP_LOGD(TAG, "Page %u begins at byte %u", m_pages.size(), end);
+    m_pages.push_back(end);
+    return true;
+}
+}  // namespace view
@@ -23,6 +23,27 @@ void View::applyRecursively(std::function<void(View&)> f) {
     f(*this);
 }
 
+void View::recordClear(RectType const& rect) {
+    recentClears[numClears % numRecentClears] = rect;
+    numClears++;
+    TouchTracer::getInstance()->stampTransfer();
+}
+
+bool View::isClearedSince(RectType const& rect, uint32_t numClearsBefore) {
+    if (numClears - numClearsBefore > numRecentClears)
+        return true;
+
+    auto [x, y] = rect.m_coordinates;
+    auto [w, h] = rect.m_size;
+    for (uint32_t i = numClearsBefore; i < numClears; i++) {
+        auto [cx, cy] = recentClears[i % numRecentClears].m_coordinates;
+        auto [cw, ch] = recentClears[i % numRecentClears].m_size;
+        if (x < cx + cw && cx < x + w && y < cy + ch && cy < y + h)
+            return true;
+    }
+    return false;
+}
+
 void View::printTree() const {
     auto printTreeAux = [](View const& view, uint16_t numSpaces,
                            auto&& printTreeAux) -> void {
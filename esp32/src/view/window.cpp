@@ -1,7 +1,7 @@
 #include "view/window.h"
-#include <ArduinoJson.h>
 #include "ble/remote_dispatcher.h"
 #include "controller/central_controller.h"
+#include "protocol/wire.h"
 #include "view/bin_pngs/24/connected.h"
 #include "view/bin_pngs/24/incoming_call.h"
 #include "view/bin_pngs/24/incoming_message.h"
@@ -130,27 +130,31 @@ void Window::onEvent(Press const&) {
 }
 
 void Window::onEvent(ble::UpdateMessage const& event) {
-    JsonDocument doc;
-    DeserializationError error = deserializeJson(doc, event.msg);
-
-    if (error)
+    protocol::Frame frame;
+    if (!protocol::decodeFrame(event.msg, frame))
         return;
 
-    std::string command = doc["command"];
     PageType pageReferredByTheMessage;
 
-    if (command == "t") {
-        pageReferredByTheMessage = PageType::TRANSLATION;
-    } else if (command == "w") {
-        pageReferredByTheMessage = PageType::WEATHER;
-    } else {
-        ESP_LOGD(TAG, "command not recognised, return");
-        return;
+    switch (frame.m_type) {
+        case protocol::MessageType::TRANSLATION:
+        case protocol::MessageType::PARTIAL_TRANSCRIPT:
+            pageReferredByTheMessage = PageType::TRANSLATION;
+            break;
+        case protocol::MessageType::WEATHER:
+        case protocol::MessageType::WEATHER_DELTA:
+            pageReferredByTheMessage = PageType::WEATHER;
+            break;
+        default:
+            ESP_LOGD(TAG, "command not recognised, return");
+            return;
     }
 
     PageType currentPage = m_currentPage->getType();
     if (currentPage != pageReferredByTheMessage) {
-        setPage(m_pageFactory->createPage(pageReferredByTheMessage));
+        // through the controller, which adapts the link to the page
+        controller::CentralController::getInstance()->changePage(
+            pageReferredByTheMessage);
         m_currentPage->onEvent(event);
     }
 }
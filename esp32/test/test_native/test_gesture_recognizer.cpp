@@ -0,0 +1,108 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+#include "input/gesture_recognizer.h"
+
+namespace {
+// pads touched from a time in milliseconds
+using Trace = std::vector<std::pair<int64_t, uint8_t>>;
+
+char const* const gestureNames[] = {"tap",  "double tap", "long press",
+                                    "repeat", "swipe+",   "swipe-"};
+
+/**
+ * Feeds @p{trace} to a recognizer of 3 pads, updating it at its deadlines
+ * too as InputManager does, up to @p{end}
+ * @return the gestures recognized, as "<gesture> <pad> <time in ms>"
+ */
+std::vector<std::string> recognize(Trace const& trace,
+                                   int64_t end,
+                                   GestureTimings const& timings = {}) {
+    std::vector<std::string> gestures;
+    GestureRecognizer recognizer{
+        3, timings, [&gestures](GestureEvent const& event) {
+            gestures.push_back(
+                std::string{gestureNames[static_cast<int>(event.m_gesture)]} +
+                " " + std::to_string(event.m_pad) + " " +
+                std::to_string(event.m_time / 1000));
+        }};
+    auto runUntil = [&recognizer](int64_t time) {
+        int64_t deadline;
+        while ((deadline = recognizer.getDeadline()) !=
+                   GestureRecognizer::noDeadline &&
+               deadline < time)
+            recognizer.update(recognizer.getPads(), deadline);
+    };
+    for (auto [time, pads] : trace) {
+        runUntil(time * 1000);
+        recognizer.update(pads, time * 1000);
+    }
+    runUntil(end * 1000 + 1);
+    return gestures;
+}
+
+using Gestures = std::vector<std::string>;
+}  // namespace
+
+TEST(GestureRecognizer, Taps) {
+    EXPECT_EQ(recognize({{0, 0b010}, {60, 0}}, 1000), (Gestures{"tap 1 60"}));
+    // the first pad of several touched at once
+    EXPECT_EQ(recognize({{0, 0b101}, {30, 0}}, 1000), (Gestures{"tap 0 30"}));
+}
+
+TEST(GestureRecognizer, LongPressesAndRepeats) {
+    EXPECT_EQ(recognize({{0, 0b010}, {1000, 0}}, 2000),
+              (Gestures{"long press 1 100", "repeat 1 500", "repeat 1 650",
+                        "repeat 1 800", "repeat 1 950"}));
+    // a pad at an end, released before the first repeat
+    EXPECT_EQ(recognize({{0, 0b001}, {500, 0}}, 2000),
+              (Gestures{"long press 0 300"}));
+    GestureTimings timings;
+    timings.m_repeatInterval = 0;
+    EXPECT_EQ(recognize({{0, 0b100}, {1000, 0}}, 2000, timings),
+              (Gestures{"long press 2 300"}));
+}
+
+TEST(GestureRecognizer, SwipesBothWays) {
+    EXPECT_EQ(recognize({{0, 0b001}, {50, 0b011}, {120, 0b110}, {180, 0}},
+                        1000),
+              (Gestures{"swipe+ 0 120"}));
+    EXPECT_EQ(recognize({{0, 0b100}, {60, 0b010}, {110, 0b001}, {150, 0}},
+                        1000),
+              (Gestures{"swipe- 2 110"}));
+    // a pad every 120 ms, slower than the long press of the middle pad
+    EXPECT_EQ(recognize({{0, 0b001}, {120, 0b011}, {240, 0b110}, {300, 0}},
+                        1000),
+              (Gestures{"swipe+ 0 240"}));
+}
+
+TEST(GestureRecognizer, IgnoresSlidesTooSlow) {
+    // the last pad reached later than a step after the middle one
+    EXPECT_EQ(recognize({{0, 0b001}, {50, 0b011}, {300, 0b110}, {350, 0}},
+                        1000),
+              Gestures{});
+    // the middle pad reached after the long press of the first one
+    EXPECT_EQ(recognize({{0, 0b001}, {350, 0b011}, {400, 0b110}, {450, 0}},
+                        1000),
+              (Gestures{"long press 0 300"}));
+}
+
+TEST(GestureRecognizer, DoubleTapsWhenEnabled) {
+    GestureTimings timings;
+    timings.m_doubleTapWindow = 250;
+    EXPECT_EQ(recognize({{0, 0b010}, {50, 0}, {150, 0b010}, {200, 0}}, 1000,
+                        timings),
+              (Gestures{"double tap 1 200"}));
+    // a single tap waits for the window
+    EXPECT_EQ(recognize({{0, 0b010}, {50, 0}}, 1000, timings),
+              (Gestures{"tap 1 300"}));
+    // another pad touched within the window
+    EXPECT_EQ(recognize({{0, 0b010}, {50, 0}, {150, 0b100}, {200, 0}}, 1000,
+                        timings),
+              (Gestures{"tap 1 150", "tap 2 450"}));
+    // disabled by default
+    EXPECT_EQ(recognize({{0, 0b010}, {50, 0}, {150, 0b010}, {200, 0}}, 1000),
+              (Gestures{"tap 1 50", "tap 1 200"}));
+}
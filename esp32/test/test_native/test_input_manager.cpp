@@ -0,0 +1,127 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+#include "SparkFun_CAP1203.h"
+#include "input/input_manager.h"
+#include "view/main_event_queue.h"
+#include "view/ui_event.h"
+
+namespace {
+using namespace std::chrono_literals;
+
+// the events of the pads, in order
+struct Recorder
+    : Observer<Press, Click, SwipeClockwise, SwipeAntiClockwise> {
+    void onEvent(Press const&) override { m_events.push_back("press"); }
+
+    void onEvent(Click const&) override { m_events.push_back("click"); }
+
+    void onEvent(SwipeClockwise const&) override {
+        m_events.push_back("swipe+");
+    }
+
+    void onEvent(SwipeAntiClockwise const&) override {
+        m_events.push_back("swipe-");
+    }
+
+    char const* getName() override { return "Recorder"; }
+
+    std::vector<std::string> m_events;
+};
+
+/**
+ * Runs the events posted to the main loop for @p{duration}, as the main loop
+ * does
+ */
+void runMainLoop(std::chrono::milliseconds duration) {
+    auto end = std::chrono::steady_clock::now() + duration;
+    while (std::chrono::steady_clock::now() < end) {
+        std::unique_ptr<view::UIEvent> event;
+        if (view::MainEventQueue::getInstance()->remove(event, 10ms))
+            static_cast<view::RemoteProcedure*>(event.get())->call();
+    }
+}
+
+// the pads of the CAP1203, by bit
+constexpr uint8_t left = 0b001;
+constexpr uint8_t middle = 0b010;
+constexpr uint8_t right = 0b100;
+
+using Events = std::vector<std::string>;
+}  // namespace
+
+// the sensor scripted as the pads are touched, the input task woken by the
+// interrupt on its ALERT line
+TEST(InputManager, PostsTheGesturesOfTheScriptedSensor) {
+    // touched as the device boots, the interrupt attached at once
+    CAP1203::touch(middle);
+    InputManager* inputManager = InputManager::getInstance();
+    Recorder recorder;
+    for (char const* name : {Press::name, Click::name, SwipeClockwise::name,
+                             SwipeAntiClockwise::name})
+        inputManager->addObserver(name, &recorder);
+    std::this_thread::sleep_for(20ms);
+    CAP1203::touch(0);
+    runMainLoop(50ms);
+    EXPECT_EQ(recorder.m_events, (Events{"click"}));
+
+    recorder.m_events.clear();
+    CAP1203::touch(middle);
+    runMainLoop(200ms);
+    CAP1203::touch(0);
+    runMainLoop(50ms);
+    EXPECT_EQ(recorder.m_events, (Events{"press"}));
+
+    // a tap shorter than the reads, latched by the sensor
+    recorder.m_events.clear();
+    CAP1203::touch(left);
+    CAP1203::touch(0);
+    runMainLoop(50ms);
+    CAP1203::touch(right);
+    std::this_thread::sleep_for(20ms);
+    CAP1203::touch(0);
+    runMainLoop(50ms);
+    EXPECT_EQ(recorder.m_events, (Events{"swipe-", "swipe+"}));
+
+    recorder.m_events.clear();
+    CAP1203::touch(left);
+    std::this_thread::sleep_for(30ms);
+    CAP1203::touch(left | middle);
+    std::this_thread::sleep_for(30ms);
+    CAP1203::touch(middle | right);
+    std::this_thread::sleep_for(30ms);
+    CAP1203::touch(0);
+    runMainLoop(50ms);
+    EXPECT_EQ(recorder.m_events, (Events{"swipe+"}));
+
+    inputManager->removeFromAllEvents(recorder);
+}
+
+// a gesture goes ahead of the messages waiting for the main loop, never of a
+// call
+TEST(InputManager, PostsTheGesturesBetweenTheCallsAndTheMessages) {
+    InputManager* inputManager = InputManager::getInstance();
+    Recorder recorder;
+    inputManager->addObserver(Click::name, &recorder);
+    auto push = [&recorder](char const* name,
+                            view::UIEventPriority priority) {
+        view::MainEventQueue::getInstance()->push(
+            std::make_unique<view::RemoteProcedure>(
+                [&recorder, name]() { recorder.m_events.push_back(name); },
+                priority));
+    };
+
+    push("message", view::UIEventPriority::NORMAL);
+    push("call", view::UIEventPriority::URGENT);
+    CAP1203::touch(middle);
+    std::this_thread::sleep_for(20ms);
+    CAP1203::touch(0);
+    std::this_thread::sleep_for(50ms);
+    runMainLoop(50ms);
+    EXPECT_EQ(recorder.m_events, (Events{"call", "click", "message"}));
+
+    inputManager->removeFromAllEvents(recorder);
+}
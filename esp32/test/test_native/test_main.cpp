@@ -0,0 +1,13 @@
+/**
+ * Unit tests of the parts of the device which run on the host, under the
+ * native environment:
+ *
+ *   pio test -e native
+ */
+
+#include <gtest/gtest.h>
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,141 @@
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+#include "model/message_log.h"
+#include "storage/file_flash.h"
+
+namespace {
+using model::LoggedMessage;
+using model::MessageLog;
+
+// small sectors, a few records each, to cross them often
+constexpr size_t sectorSize = 256;
+constexpr size_t numSectors = 8;
+constexpr size_t maxNumRetained = 4;
+
+// header of a sector and of a record, see MessageLog
+constexpr size_t sectorHeaderSize = 8;
+constexpr size_t recordHeaderSize = 20;
+
+// a log kept in a file of its own, erased at the start of each test
+class MessageLogTest : public testing::Test {
+protected:
+    void SetUp() override {
+        m_path = testing::TempDir() + "message_log_" +
+                 testing::UnitTest::GetInstance()->current_test_info()->name();
+        std::remove(m_path.c_str());
+    }
+
+    void TearDown() override { std::remove(m_path.c_str()); }
+
+    std::unique_ptr<storage::FileFlash> openFlash() {
+        return storage::FileFlash::open(m_path.c_str(), sectorSize,
+                                        numSectors);
+    }
+
+    std::unique_ptr<MessageLog> mount() {
+        return std::make_unique<MessageLog>(openFlash(), maxNumRetained);
+    }
+
+    // the messages retained, from the oldest one, as "seq:body"
+    static std::vector<std::string> read(MessageLog& log) {
+        std::vector<std::string> messages;
+        log.forEach([&](LoggedMessage const& msg) {
+            messages.push_back(std::to_string(msg.m_seq) + ":" + msg.m_body);
+        });
+        return messages;
+    }
+
+    std::string m_path;
+};
+
+TEST_F(MessageLogTest, RestoresTheMessagesInOrderWhenMounted) {
+    {
+        std::unique_ptr<MessageLog> log = mount();
+        EXPECT_TRUE(log->append("whatsapp", "Alice", "one", 10));
+        EXPECT_TRUE(log->append("gmail", "Bob", "two", 20));
+        EXPECT_TRUE(log->append("sms", "Carol", "three", 30));
+    }
+
+    std::unique_ptr<MessageLog> log = mount();
+    std::vector<LoggedMessage> messages;
+    log->forEach(
+        [&](LoggedMessage const& msg) { messages.push_back(msg); });
+    ASSERT_EQ(messages.size(), 3u);
+    EXPECT_EQ(messages[1].m_seq, 1u);
+    EXPECT_EQ(messages[1].m_timestamp, 20u);
+    EXPECT_EQ(messages[1].m_app, "gmail");
+    EXPECT_EQ(messages[1].m_sender, "Bob");
+    EXPECT_EQ(read(*log), (std::vector<std::string>{"0:one", "1:two",
+                                                     "2:three"}));
+
+    // the numbering goes on from the messages restored
+    EXPECT_TRUE(log->append("sms", "Carol", "four", 40));
+    EXPECT_EQ(read(*log).back(), "3:four");
+}
+
+TEST_F(MessageLogTest, DiscardsARecordTornByAPowerLoss) {
+    {
+        std::unique_ptr<MessageLog> log = mount();
+        EXPECT_TRUE(log->append("a", "b", "first", 0));
+        EXPECT_TRUE(log->append("a", "b", "second", 0));
+    }
+
+    // the last byte of the body of the second record was never written: a
+    // write only clears bits, as the power loss left it
+    {
+        size_t firstFootprint = (recordHeaderSize + 7 + 3) & ~size_t{3};
+        size_t lastByte =
+            sectorHeaderSize + firstFootprint + recordHeaderSize + 7;
+        std::unique_ptr<storage::FileFlash> flash = openFlash();
+        ASSERT_TRUE(flash);
+        char const zero = 0;
+        ASSERT_TRUE(flash->write(lastByte, &zero, 1));
+    }
+
+    std::unique_ptr<MessageLog> log = mount();
+    EXPECT_EQ(read(*log), (std::vector<std::string>{"0:first"}));
+
+    // the space after the torn record is not written again
+    EXPECT_TRUE(log->append("a", "b", "third", 0));
+    log.reset();
+    log = mount();
+    EXPECT_EQ(read(*log), (std::vector<std::string>{"0:first", "1:third"}));
+}
+
+TEST_F(MessageLogTest, WrapsAroundTheSectorsErasingTheOldest) {
+    std::string body(80, 'x');
+    uint32_t numMessages = 10 * numSectors;
+    {
+        std::unique_ptr<MessageLog> log = mount();
+        for (uint32_t i = 0; i < numMessages; i++) {
+            ASSERT_TRUE(log->append("app", "sender",
+                                    body + std::to_string(i), i))
+                << "message " << i;
+        }
+        // a couple of records per sector: the log went around several times
+        EXPECT_GT(log->getStats().m_numSectorsErased, 2 * numSectors);
+        EXPECT_EQ(log->size(), maxNumRetained);
+    }
+
+    std::unique_ptr<MessageLog> log = mount();
+    std::vector<std::string> expected;
+    for (uint32_t seq = numMessages - maxNumRetained; seq < numMessages; seq++)
+        expected.push_back(std::to_string(seq) + ":" + body +
+                           std::to_string(seq));
+    EXPECT_EQ(read(*log), expected);
+}
+
+TEST_F(MessageLogTest, RetainsOnlyTheNewestMessages) {
+    std::unique_ptr<MessageLog> log = mount();
+    for (uint32_t i = 0; i < maxNumRetained + 3; i++)
+        ASSERT_TRUE(log->append("app", "sender", std::to_string(i), i));
+
+    EXPECT_EQ(log->size(), maxNumRetained);
+    EXPECT_EQ(read(*log),
+              (std::vector<std::string>{"3:3", "4:4", "5:5", "6:6"}));
+}
+}  // namespace
@@ -0,0 +1,164 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+#include "protocol/reassembler.h"
+
+namespace {
+using protocol::Fragmenter;
+using protocol::Reassembler;
+
+std::string makeFragment(uint8_t id,
+                         uint8_t seq,
+                         bool isLast,
+                         uint16_t totalSize,
+                         uint16_t offset,
+                         std::string const& payload) {
+    std::string fragment{static_cast<char>(protocol::fragmentMarker),
+                         static_cast<char>(isLast),
+                         static_cast<char>(id),
+                         static_cast<char>(seq),
+                         static_cast<char>(totalSize & 0xFF),
+                         static_cast<char>(totalSize >> 8),
+                         static_cast<char>(offset & 0xFF),
+                         static_cast<char>(offset >> 8)};
+    return fragment + payload;
+}
+
+std::vector<std::string> fragment(std::string const& message,
+                                  uint8_t id,
+                                  size_t maxFragmentSize) {
+    Fragmenter fragmenter{message, id, maxFragmentSize};
+    std::vector<std::string> fragments;
+    char buffer[600];
+    while (size_t size = fragmenter.next(buffer))
+        fragments.emplace_back(buffer, size);
+    return fragments;
+}
+}  // namespace
+
+TEST(Reassembler, ReassemblesInOrder) {
+    std::string message(1000, 'x');
+    for (size_t i = 0; i < message.size(); i++)
+        message[i] = static_cast<char>(i);
+    Reassembler reassembler{2, 2048, 1000};
+    std::vector<std::string> fragments = fragment(message, 7, 100);
+    ASSERT_EQ(fragments.size(), 11u);
+
+    std::string_view out;
+    for (size_t i = 0; i + 1 < fragments.size(); i++)
+        EXPECT_FALSE(reassembler.push(fragments[i], 0, out));
+    ASSERT_TRUE(reassembler.push(fragments.back(), 0, out));
+    EXPECT_EQ(out, message);
+    EXPECT_EQ(reassembler.getStats().m_numCompleted, 1u);
+}
+
+// interleaved messages, fragments shuffled, duplicated and lost
+TEST(Reassembler, SurvivesShuffledDuplicatedAndLostFragments) {
+    std::mt19937 rng{1234};
+    for (int round = 0; round < 2000; round++) {
+        Reassembler reassembler{4, 2048, 2000};
+        size_t numMessages = 1 + rng() % 4;
+        std::vector<std::string> messages;
+        std::vector<bool> isLost(numMessages, false);
+        std::vector<std::string> fragments;
+        bool hasDuplicates = false;
+        for (size_t m = 0; m < numMessages; m++) {
+            std::string message(rng() % 2049, 0);
+            for (char& c : message)
+                c = static_cast<char>(rng());
+            messages.push_back(message);
+            // at most 256 fragments
+            size_t maxFragmentSize = 16 + rng() % 500;
+            std::vector<std::string> own =
+                fragment(message, round * 4 + m, maxFragmentSize);
+            ASSERT_FALSE(own.empty());
+            if (rng() % 10 == 0 && own.size() > 1) {
+                own.erase(own.begin() + rng() % own.size());
+                isLost[m] = true;
+            }
+            if (rng() % 4 == 0 && own.size() > 1) {
+                own.push_back(own[rng() % own.size()]);
+                hasDuplicates = true;
+            }
+            fragments.insert(fragments.end(), own.begin(), own.end());
+        }
+        std::shuffle(fragments.begin(), fragments.end(), rng);
+
+        std::vector<bool> isReceived(numMessages, false);
+        uint32_t now = 0;
+        for (std::string const& f : fragments) {
+            std::string_view out;
+            now += rng() % 2;
+            if (!reassembler.push(f, now, out))
+                continue;
+            auto it = std::find(messages.begin(), messages.end(), out);
+            ASSERT_NE(it, messages.end());
+            size_t idx = it - messages.begin();
+            EXPECT_FALSE(isReceived[idx]);
+            EXPECT_FALSE(isLost[idx]);
+            isReceived[idx] = true;
+        }
+        for (size_t m = 0; m < numMessages; m++)
+            EXPECT_NE(isReceived[m], isLost[m]) << "round " << round;
+
+        // the incomplete messages time out, at the next fragment
+        std::string_view out;
+        reassembler.push(makeFragment(0, 0, false, 0, 0, ""), now + 5000, out);
+        if (!hasDuplicates) {
+            EXPECT_EQ(reassembler.getStats().m_numExpired,
+                      static_cast<uint32_t>(
+                          std::count(isLost.begin(), isLost.end(), true)));
+        }
+    }
+}
+
+TEST(Reassembler, EvictsTheLeastRecentlyUpdated) {
+    Reassembler reassembler{2, 100, 1000};
+    std::string_view out;
+    auto push = [&](std::string const& fragment, uint32_t now) {
+        return reassembler.push(fragment, now, out);
+    };
+    EXPECT_FALSE(push(makeFragment(1, 0, false, 4, 0, "ab"), 0));
+    EXPECT_FALSE(push(makeFragment(2, 0, false, 4, 0, "cd"), 1));
+    // no buffer left: message 1 is discarded
+    EXPECT_FALSE(push(makeFragment(3, 0, false, 4, 0, "ef"), 2));
+    EXPECT_EQ(reassembler.getStats().m_numExpired, 1u);
+
+    ASSERT_TRUE(push(makeFragment(2, 1, true, 4, 2, "CD"), 3));
+    EXPECT_EQ(out, "cdCD");
+    EXPECT_FALSE(push(makeFragment(1, 1, true, 4, 2, "AB"), 4));
+    ASSERT_TRUE(push(makeFragment(3, 1, true, 4, 2, "EF"), 5));
+    EXPECT_EQ(out, "efEF");
+}
+
+TEST(Reassembler, ExpiresAfterTheTimeout) {
+    Reassembler reassembler{2, 100, 1000};
+    std::string_view out;
+    auto push = [&](std::string const& fragment, uint32_t now) {
+        return reassembler.push(fragment, now, out);
+    };
+    EXPECT_FALSE(push(makeFragment(1, 0, false, 4, 0, "ab"), 0));
+    EXPECT_FALSE(push(makeFragment(1, 1, true, 4, 2, "AB"), 1001));
+    EXPECT_EQ(reassembler.getStats().m_numExpired, 1u);
+    EXPECT_EQ(reassembler.getStats().m_numCompleted, 0u);
+}
+
+TEST(Reassembler, DropsMalformedFragments) {
+    Reassembler reassembler{2, 100, 1000};
+    std::string_view out;
+    auto push = [&](std::string const& fragment, uint32_t now) {
+        return reassembler.push(fragment, now, out);
+    };
+    // longer than a buffer
+    EXPECT_FALSE(push(makeFragment(5, 0, true, 200, 0, "x"), 0));
+    // past the end of the message
+    EXPECT_FALSE(push(makeFragment(5, 0, true, 4, 3, "xy"), 0));
+    // last, not reaching the end
+    EXPECT_FALSE(push(makeFragment(5, 0, true, 4, 0, "x"), 0));
+    // shorter than the header
+    EXPECT_FALSE(push(makeFragment(5, 0, true, 4, 0, "").substr(0, 3), 0));
+    EXPECT_EQ(reassembler.getStats().m_numDropped, 4u);
+}
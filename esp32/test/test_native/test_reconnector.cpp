@@ -0,0 +1,161 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+#include "ble/reconnector.h"
+
+namespace {
+using ble::Reconnector;
+using Phase = Reconnector::Phase;
+
+// records the calls of the reconnector, as text
+class FakeGap : public Reconnector::Gap {
+public:
+    bool findBondedPeer(Reconnector::Address& address,
+                        uint8_t& addressType) override {
+        address = {1, 2, 3, 4, 5, 6};
+        addressType = 0;
+        return m_isBonded;
+    }
+
+    void advertiseDirected(Reconnector::Address const&, uint8_t) override {
+        m_calls.push_back("directed");
+    }
+
+    void advertiseUndirected(uint16_t minInterval,
+                             uint16_t maxInterval) override {
+        m_calls.push_back("undirected " + std::to_string(minInterval) + "-" +
+                          std::to_string(maxInterval));
+    }
+
+    void stopAdvertising() override { m_calls.push_back("stop"); }
+
+    void startTimer(uint32_t ms) override {
+        m_calls.push_back("timer " + std::to_string(ms));
+    }
+
+    void stopTimer() override { m_calls.push_back("no timer"); }
+
+    // returns the calls since the last time
+    std::vector<std::string> take() {
+        std::vector<std::string> calls;
+        calls.swap(m_calls);
+        return calls;
+    }
+
+public:
+    bool m_isBonded{true};
+
+private:
+    std::vector<std::string> m_calls;
+};
+
+using Calls = std::vector<std::string>;
+}  // namespace
+
+TEST(Reconnector, StepsDownFromDirectedToSlow) {
+    FakeGap gap;
+    Reconnector reconnector{gap};
+    // the boot
+    reconnector.onDisconnected(0);
+    EXPECT_EQ(reconnector.getPhase(), Phase::DIRECTED);
+    EXPECT_EQ(gap.take(), (Calls{"directed", "timer 1280"}));
+
+    reconnector.onTimeout();
+    EXPECT_EQ(reconnector.getPhase(), Phase::FAST);
+    EXPECT_EQ(gap.take(), (Calls{"stop", "undirected 32-48", "timer 30000"}));
+
+    reconnector.onTimeout();
+    EXPECT_EQ(reconnector.getPhase(), Phase::SLOW);
+    EXPECT_EQ(gap.take(), (Calls{"stop", "undirected 1636-2056", "no timer"}));
+
+    reconnector.onConnected(40000000);
+    EXPECT_EQ(reconnector.getPhase(), Phase::CONNECTED);
+    EXPECT_EQ(gap.take(), (Calls{"no timer"}));
+    Reconnector::Stats stats = reconnector.getStats();
+    EXPECT_EQ(stats.m_numReconnections, 1u);
+    EXPECT_EQ(stats.m_lastTime, 40000u);
+    EXPECT_EQ(stats.m_maxTime, 40000u);
+    EXPECT_EQ(stats.m_lastPhase, Phase::SLOW);
+}
+
+TEST(Reconnector, TimesTheReconnections) {
+    FakeGap gap;
+    Reconnector reconnector{gap};
+    reconnector.onDisconnected(0);
+    reconnector.onConnected(300000);
+    reconnector.onDisconnected(1000000);
+    reconnector.onTimeout();
+    reconnector.onConnected(3000000);
+    // a second connection event is not a reconnection
+    reconnector.onConnected(4000000);
+
+    Reconnector::Stats stats = reconnector.getStats();
+    EXPECT_EQ(stats.m_numReconnections, 2u);
+    EXPECT_EQ(stats.m_lastTime, 2000u);
+    EXPECT_EQ(stats.m_maxTime, 2000u);
+    EXPECT_EQ(stats.m_lastPhase, Phase::FAST);
+}
+
+TEST(Reconnector, IgnoresStaleTimeouts) {
+    FakeGap gap;
+    Reconnector reconnector{gap};
+    reconnector.onDisconnected(0);
+    reconnector.onConnected(100000);
+    gap.take();
+    // the timer of the directed advertising expiring as the phone connected
+    reconnector.onTimeout();
+    EXPECT_EQ(reconnector.getPhase(), Phase::CONNECTED);
+    EXPECT_TRUE(gap.take().empty());
+
+    reconnector.onDisconnected(200000);
+    reconnector.onTimeout();
+    reconnector.onTimeout();
+    gap.take();
+    // slow advertising lasts until a phone connects
+    reconnector.onTimeout();
+    EXPECT_EQ(reconnector.getPhase(), Phase::SLOW);
+    EXPECT_TRUE(gap.take().empty());
+}
+
+TEST(Reconnector, StaysIdleWithoutBondedPhone) {
+    FakeGap gap;
+    gap.m_isBonded = false;
+    Reconnector reconnector{gap};
+    reconnector.onDisconnected(0);
+    EXPECT_EQ(reconnector.getPhase(), Phase::IDLE);
+    EXPECT_EQ(gap.take(), (Calls{"no timer"}));
+    reconnector.onTimeout();
+    EXPECT_EQ(reconnector.getPhase(), Phase::IDLE);
+    EXPECT_TRUE(gap.take().empty());
+
+    // pairing a new phone
+    reconnector.advertiseToAny();
+    EXPECT_EQ(reconnector.getPhase(), Phase::FAST);
+    EXPECT_EQ(gap.take(), (Calls{"stop", "undirected 32-48", "timer 30000"}));
+    reconnector.onConnected(5000000);
+    EXPECT_EQ(reconnector.getStats().m_numReconnections, 0u);
+}
+
+TEST(Reconnector, PairsOnceThePhoneConnectedHasDisconnected) {
+    FakeGap gap;
+    Reconnector reconnector{gap};
+    reconnector.onDisconnected(0);
+    reconnector.onConnected(100000);
+    gap.take();
+
+    reconnector.advertiseToAny();
+    EXPECT_EQ(reconnector.getPhase(), Phase::CONNECTED);
+    EXPECT_TRUE(gap.take().empty());
+
+    // skips the directed advertising to the phone bonded
+    reconnector.onDisconnected(1000000);
+    EXPECT_EQ(reconnector.getPhase(), Phase::FAST);
+    EXPECT_EQ(gap.take(), (Calls{"undirected 32-48", "timer 30000"}));
+    reconnector.onConnected(2000000);
+    EXPECT_EQ(reconnector.getStats().m_numReconnections, 1u);
+
+    // and the next disconnection reconnects again
+    reconnector.onDisconnected(3000000);
+    EXPECT_EQ(reconnector.getPhase(), Phase::DIRECTED);
+}
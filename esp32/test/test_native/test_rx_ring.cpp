@@ -0,0 +1,49 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include "ble/rx_ring.h"
+
+namespace {
+using ble::RxRing;
+
+// writes of 100 bytes, 4 of which fill a ring of 424 bytes
+constexpr size_t writeSize = 100;
+constexpr size_t capacity = 4 * (writeSize + RxRing::headerSize);
+
+TEST(RxRing, CountsTheWritesDroppedWhenFull) {
+    RxRing ring{capacity, 64};
+    std::string write(writeSize, 'n');
+    for (uint32_t i = 0; i < 4; i++)
+        EXPECT_TRUE(ring.push(write, false, i));
+    EXPECT_FALSE(ring.push(write, false, 4));
+    EXPECT_FALSE(ring.push(write, false, 5));
+
+    RxRing::Stats stats = ring.getStats();
+    EXPECT_EQ(stats.m_numPushed, 4u);
+    EXPECT_EQ(stats.m_numDropped, 2u);
+    EXPECT_EQ(stats.m_maxUsed, capacity);
+
+    // room again for a write once one is popped
+    char buffer[writeSize];
+    uint32_t time;
+    EXPECT_EQ(ring.pop(buffer, sizeof(buffer), time), writeSize);
+    EXPECT_EQ(time, 0u);
+    EXPECT_TRUE(ring.push(write, false, 6));
+    EXPECT_EQ(ring.getStats().m_numDropped, 2u);
+}
+
+TEST(RxRing, KeepsTheUrgentWritesWhenFull) {
+    RxRing ring{capacity, 64};
+    std::string write(writeSize, 'n');
+    while (ring.push(write, false, 0)) {
+    }
+    EXPECT_TRUE(ring.push("call", true, 1));
+
+    char buffer[writeSize];
+    uint32_t time;
+    ASSERT_EQ(ring.pop(buffer, sizeof(buffer), time), 4u);
+    EXPECT_EQ(std::string(buffer, 4), "call");
+    EXPECT_EQ(time, 1u);
+    EXPECT_EQ(ring.getStats().m_numDropped, 1u);
+}
+}  // namespace
@@ -0,0 +1,111 @@
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <string>
+#include <vector>
+#include "view/text/teleprompter.h"
+#include "view/tft.h"
+
+namespace {
+// the frame of the transcript on the translation page
+view::RectType const frame{view::Coordinates{0, 60}, view::Size{320, 180}};
+
+/**
+ * Partial results of a speech recognizer while a long sentence is spoken:
+ * a word more each time, the last one misheard first and then corrected
+ */
+std::vector<std::string> makePartialResults() {
+    std::vector<std::string> const words = {
+        "the",     "weather", "today",  "was",      "nice",   "and",
+        "sunny",   "in",      "Milano", "so",       "we",     "walked",
+        "along",   "the",     "canals", "until",    "the",    "evening",
+        "when",    "the",     "lights", "came",     "on",     "and",
+        "we",      "stopped", "for",    "a",        "drink",  "near",
+        "the",     "station", "before", "catching", "the",    "last",
+        "train",   "back",    "home",   "tired",    "but",    "happy"};
+    std::vector<std::string> partials;
+    std::string text;
+    for (size_t i = 0; i < words.size(); i++) {
+        std::string prefix = text.empty() ? text : text + " ";
+        if (i % 3 == 1)
+            partials.push_back(prefix + words[i].substr(0, 2) + "x");
+        text = prefix + words[i];
+        partials.push_back(text);
+    }
+    return partials;
+}
+
+// the stable prefix of @p{text} shared with @p{previous}, in bytes
+size_t getNumStableBytes(std::string const& previous, std::string const& text) {
+    size_t size = 0;
+    while (size < previous.size() && size < text.size() &&
+           previous[size] == text[size])
+        size++;
+    return size;
+}
+}  // namespace
+
+// the partial transcripts replayed as deltas, against the whole text drawn
+// again at each update as the text area did
+TEST(Teleprompter, DrawsLessWithDeltasThanWithWholeTexts) {
+    TFT_eSPI* tft = tft::Tft::getTFT_eSPI();
+    std::vector<std::string> const partials = makePartialResults();
+
+    view::Teleprompter deltas{frame, nullptr};
+    deltas.clearFromScreen();
+    uint64_t numPixelsBefore = tft->m_numPixels;
+    std::string previous;
+    for (std::string const& text : partials) {
+        size_t numStableBytes = getNumStableBytes(previous, text);
+        deltas.editTail(numStableBytes, text.substr(numStableBytes));
+        deltas.draw();
+        previous = text;
+    }
+    uint64_t numDeltaPixels = tft->m_numPixels - numPixelsBefore;
+
+    view::Teleprompter wholeTexts{frame, nullptr};
+    numPixelsBefore = tft->m_numPixels;
+    for (std::string const& text : partials) {
+        wholeTexts.clearFromScreen();
+        wholeTexts.editTail(0, text);
+        wholeTexts.draw();
+    }
+    uint64_t numWholePixels = tft->m_numPixels - numPixelsBefore;
+
+    printf("%zu updates: %llu bytes of pixels with deltas, %llu with whole "
+           "texts\n",
+           partials.size(), 2 * static_cast<unsigned long long>(numDeltaPixels),
+           2 * static_cast<unsigned long long>(numWholePixels));
+    EXPECT_LT(numDeltaPixels * 4, numWholePixels);
+}
+
+// in the rotation of the device the controller cannot scroll the frame: once
+// it is full, each new line is the only one rendered, the others being
+// pushed again from their strips
+TEST(Teleprompter, RendersOnlyTheNewLineWhenScrollingInLandscape) {
+    TFT_eSPI* tft = tft::Tft::getTFT_eSPI();
+    tft->setRotation(3);
+    view::Teleprompter teleprompter{frame, nullptr};
+    teleprompter.clearFromScreen();
+    uint16_t rowHeight = view::Font::get(view::FontSize::MEDIUM).getHeight();
+    size_t numRows = frame.m_size.m_height / rowHeight;
+
+    uint32_t numPixelBytes = 0;
+    for (size_t i = 0; i < 3 * numRows; i++) {
+        uint32_t numRendered = teleprompter.getNumRowsRendered();
+        uint32_t numDrawn = teleprompter.getNumRowsDrawn();
+        uint32_t numPixelBytesBefore = teleprompter.getNumPixelBytesPushed();
+        teleprompter.startUtterance();
+        teleprompter.editTail(0, "line " + std::to_string(i));
+        teleprompter.draw();
+        if (i < numRows)
+            continue;
+        numPixelBytes +=
+            teleprompter.getNumPixelBytesPushed() - numPixelBytesBefore;
+        EXPECT_EQ(teleprompter.getNumRowsRendered() - numRendered, 1u);
+        EXPECT_EQ(teleprompter.getNumRowsDrawn() - numDrawn, numRows);
+    }
+    printf("%zu rows scrolled: %u bytes of pixels pushed per line\n",
+           2 * numRows, static_cast<unsigned>(numPixelBytes / (2 * numRows)));
+    tft->setRotation(0);
+}
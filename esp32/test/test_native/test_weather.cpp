@@ -0,0 +1,108 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+#include "model/weather.h"
+#include "protocol/wire.h"
+
+namespace {
+using model::Weather;
+
+struct Slot {
+    char const* m_time;
+    int32_t m_temperature;
+};
+
+void putCondition(protocol::Writer& writer, uint8_t tag, Slot const& slot) {
+    size_t position = writer.beginNested(tag);
+    writer.putString(protocol::tag::conditionTime, slot.m_time);
+    writer.putInt(protocol::tag::conditionTemperature, slot.m_temperature);
+    writer.putUInt(protocol::tag::conditionPressure, 1013);
+    writer.putUInt(protocol::tag::conditionIcon, 2);
+    writer.endNested(position);
+}
+
+std::string finish(protocol::Writer& writer) {
+    EXPECT_TRUE(writer.finish());
+    return std::string{writer.getFrame()};
+}
+
+std::string makeFull(std::string_view location,
+                     std::vector<Slot> const& slots) {
+    char buffer[protocol::maxFrameSize];
+    protocol::Writer writer{buffer, sizeof(buffer)};
+    writer.begin(protocol::MessageType::WEATHER);
+    writer.putString(protocol::tag::weatherLocation, location);
+    for (Slot const& slot : slots)
+        putCondition(writer, protocol::tag::weatherCondition, slot);
+    return finish(writer);
+}
+
+std::string makeDelta(std::vector<char const*> const& removed,
+                      std::vector<Slot> const& upserted) {
+    char buffer[protocol::maxFrameSize];
+    protocol::Writer writer{buffer, sizeof(buffer)};
+    writer.begin(protocol::MessageType::WEATHER_DELTA);
+    for (char const* time : removed)
+        writer.putString(protocol::tag::weatherRemove, time);
+    for (Slot const& slot : upserted)
+        putCondition(writer, protocol::tag::weatherUpsert, slot);
+    return finish(writer);
+}
+
+bool update(Weather& weather, std::string const& data) {
+    protocol::Frame frame;
+    return protocol::decodeFrame(data, frame) && weather.apply(frame);
+}
+
+// the slots of the forecast, as "time:temperature"
+std::vector<std::string> read(Weather const& weather) {
+    std::vector<std::string> slots;
+    model::Forecast const& forecast = weather.getForecast();
+    for (size_t i = 0; i < forecast.size(); i++)
+        slots.push_back(std::string{forecast[i].getTime()} + ":" +
+                        std::to_string(forecast[i].m_temperature));
+    return slots;
+}
+
+TEST(Weather, DropsTheDeltasUntilAWholeForecastArrives) {
+    // e.g. the device rebooted while the phone went on sending deltas
+    Weather weather;
+    EXPECT_FALSE(update(weather, makeDelta({"12:00"}, {{"Now", 16}})));
+    EXPECT_FALSE(weather.isSynced());
+    EXPECT_TRUE(weather.getForecast().isEmpty());
+
+    std::string full =
+        makeFull("Milano", {{"Now", 15}, {"12:00", 16}, {"15:00", 18}});
+    ASSERT_TRUE(update(weather, full));
+    EXPECT_TRUE(weather.isSynced());
+    std::string delta = makeDelta({"12:00"}, {{"Now", 17}, {"18:00", 17}});
+    EXPECT_TRUE(update(weather, delta));
+    EXPECT_EQ(weather.getLocation(), "Milano");
+    EXPECT_EQ(read(weather),
+              (std::vector<std::string>{"Now:17", "15:00:18", "18:00:17"}));
+}
+
+TEST(Weather, KeepsTheUpdatesArrivedWhileThePageWasNotShown) {
+    Weather weather;
+    ASSERT_TRUE(
+        update(weather, makeFull("Milano", {{"Now", 15}, {"12:00", 16}})));
+
+    // a page shown again copies the forecast, deltas included
+    ASSERT_TRUE(update(weather, makeDelta({"12:00"}, {{"15:00", 18}})));
+    Weather shown = weather;
+    EXPECT_EQ(shown.getLocation(), "Milano");
+    EXPECT_EQ(read(shown), (std::vector<std::string>{"Now:15", "15:00:18"}));
+
+    // a forecast emptied by the deltas still takes the next ones
+    ASSERT_TRUE(update(weather, makeDelta({"Now", "15:00"}, {})));
+    EXPECT_TRUE(weather.getForecast().isEmpty());
+    EXPECT_TRUE(update(weather, makeDelta({}, {{"18:00", 17}})));
+    EXPECT_EQ(read(weather), (std::vector<std::string>{"18:00:17"}));
+
+    // a whole forecast replaces the location and the slots
+    ASSERT_TRUE(update(weather, makeFull("Roma", {{"Now", 20}})));
+    EXPECT_EQ(weather.getLocation(), "Roma");
+    EXPECT_EQ(read(weather), (std::vector<std::string>{"Now:20"}));
+}
+}  // namespace